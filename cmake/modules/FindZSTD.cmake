@@ -0,0 +1,56 @@
+#
+#
+# Locate zstd
+#
+# This module accepts the following environment variables:
+#
+#    ZSTD_DIR or ZSTD_ROOT - Specify the location of zstd
+#
+# This module defines the following CMake variables:
+#
+#    ZSTD_FOUND - True if libzstd is found
+#    ZSTD_LIBRARY - A variable pointing to the zstd library
+#    ZSTD_INCLUDE_DIR - Where to find the headers
+
+if (DEFINED ZSTD_ROOT AND NOT ZSTD_ROOT)
+	set (ZSTD_LIBRARY "" CACHE INTERNAL "")
+	set (ZSTD_INCLUDE_DIR "" CACHE INTERNAL "")
+	return()
+endif()
+
+find_path (ZSTD_INCLUDE_DIR zstd.h
+	HINTS
+	${ZSTD_DIR}
+	${ZSTD_ROOT}
+	$ENV{ZSTD_DIR}
+	$ENV{ZSTD_ROOT}
+	PATH_SUFFIXES include
+	PATHS
+	/sw # Fink
+	/opt/local # DarwinPorts
+	/opt/csw # Blastwave
+	/opt
+	/usr/local
+)
+
+find_library (ZSTD_LIBRARY
+	NAMES zstd
+	HINTS
+	${ZSTD_DIR}
+	${ZSTD_ROOT}
+	$ENV{ZSTD_DIR}
+	$ENV{ZSTD_ROOT}
+	PATH_SUFFIXES lib
+	PATHS
+	/sw
+	/opt/local
+	/opt/csw
+	/opt
+	/usr/local
+)
+
+include (FindPackageHandleStandardArgs)
+find_package_handle_standard_args (ZSTD DEFAULT_MSG ZSTD_LIBRARY ZSTD_INCLUDE_DIR)
+
+set (ZSTD_LIBRARIES ${ZSTD_LIBRARY})
+set (ZSTD_INCLUDE_DIRS ${ZSTD_INCLUDE_DIR})
@@ -81,6 +81,9 @@ struct BATCH_CTRL {
 		bool active;
 		char *prefix;	/* Job prefix and also name of working directory (but see -W) */
 	} N;
+	struct BATCH_P {	/* -P */
+		bool active;	/* Run jobs via a pool of persistent worker shells instead of one shell per job */
+	} P;
 	struct BATCH_Q {	/* -Q[s] */
 		bool active;
 		bool scripts;
@@ -214,7 +217,7 @@ static int usage (struct GMTAPI_CTRL *API, int level) {
 	const char *name = gmt_show_name_and_purpose (API, THIS_MODULE_LIB, THIS_MODULE_CLASSIC_NAME, THIS_MODULE_PURPOSE);
 	if (level == GMT_MODULE_PURPOSE) return (GMT_NOERROR);
 	GMT_Usage (API, 0, "usage: %s <mainscript> -N<prefix> -T<njobs>|<min>/<max>/<inc>[+n]|<timefile>[+p<width>][+s<first>][+w[<str>]|W] "
-		"[-D] [-F<template>] -I<includefile>] [-M[<job>]] [-Q[s]] [-Sb<postflight>] [-Sf<preflight>] "
+		"[-D] [-F<template>] -I<includefile>] [-M[<job>]] [-P] [-Q[s]] [-Sb<postflight>] [-Sf<preflight>] "
 		"[%s] [-W[<dir>]] [-Z] [%s] [-x[[-]<n>]] [%s]\n", name, GMT_V_OPT, GMT_f_OPT, GMT_PAR_OPT);
 
 	if (level == GMT_SYNOPSIS) return (GMT_MODULE_SYNOPSIS);
@@ -244,6 +247,11 @@ static int usage (struct GMTAPI_CTRL *API, int level) {
 		"Used to add constant variables needed by all batch scripts.");
 	GMT_Usage (API, 1, "\n-M[<job>]");
 	GMT_Usage (API, -2, "Run just the indicated job number [0] for testing [run all].");
+	GMT_Usage (API, 1, "\n-P");
+	GMT_Usage (API, -2, "Process the job queue via a pool of persistent worker shells (one per core): each worker "
+		"sources the job script for its share of the jobs within a single shell process instead of "
+		"launching a new shell per job. Recommended when jobs are small and numerous so that per-job "
+		"shell startup dominates [launch one shell per job].");
 	GMT_Usage (API, 1, "\n-Q[s]");
 	GMT_Usage (API, -2, "Debugging: Leave all intermediate files and directories behind for inspection. "
 		"Append s to only create the work scripts but none will be executed (except for <preflight> script).");
@@ -313,6 +321,10 @@ static int parse (struct GMT_CTRL *GMT, struct BATCH_CTRL *Ctrl, struct GMT_OPTI
 				n_errors += gmt_get_required_string (GMT, opt->arg, opt->option, 0, &Ctrl->N.prefix);
 				break;
 
+			case 'P':	/* Use a pool of persistent worker shells that each consume a share of the job queue */
+				n_errors += gmt_M_repeated_module_option (API, Ctrl->P.active);
+				break;
+
 			case 'Q':	/* Debug - leave temp files and directories behind; Use -Qs to only write scripts */
 				n_errors += gmt_M_repeated_module_option (API, Ctrl->Q.active);
 				if (opt->arg[0] == 's') Ctrl->Q.scripts = true;
@@ -401,6 +413,8 @@ static int parse (struct GMT_CTRL *GMT, struct BATCH_CTRL *Ctrl, struct GMT_OPTI
 					"Option -T: Must specify a string of characters if using +w<str>\n");
 	n_errors += gmt_M_check_condition (GMT, Ctrl->Q.active && Ctrl->Z.active,
 					"Option -Z: Not compatible with -Q\n");
+	n_errors += gmt_M_check_condition (GMT, Ctrl->P.active && Ctrl->M.active,
+					"Option -P: Not compatible with -M\n");
 	n_errors += gmt_M_check_condition (GMT, Ctrl->M.active && Ctrl->M.job < Ctrl->T.start_job,
 					"Option -M: Cannot specify a job before the first job number set via -T\n");
 	n_errors += gmt_M_check_condition (GMT, Ctrl->W.active && Ctrl->W.dir && !strcmp (Ctrl->W.dir, "/tmp"),
@@ -477,7 +491,7 @@ EXTERN_MSC int GMT_batch (void *V_API, int mode, void *args) {
 	size_t P_len = 0;
 
 	unsigned int n_values = 0, n_jobs = 0, job, i_job, col, k, n_cores_unused, n_to_run, n_fmts = 0;
-	unsigned int n_jobs_not_started = 0, n_jobs_completed = 0, first_i_job = 0, data_job;
+	unsigned int n_jobs_not_started = 0, n_jobs_completed = 0, first_i_job = 0, data_job, n_workers = 0;
 
 	bool done = false, n_written = false, has_text = false, is_classic = false, has_conf = false;
 	bool got_time_file = false, issue_col0_par = false;
@@ -493,6 +507,7 @@ EXTERN_MSC int GMT_batch (void *V_API, int mode, void *args) {
 	char pre_file[PATH_MAX] = {""}, post_file[PATH_MAX] = {""}, main_file[PATH_MAX] = {""}, line[PATH_MAX] = {""}, tmpwpath[PATH_MAX] = {""};
 	char string[GMT_LEN128] = {""}, cmd[GMT_LEN256] = {""}, cwd[PATH_MAX] = {""}, conf_file[PATH_MAX];
 	char completion_file[PATH_MAX] = {""}, topdir[PATH_MAX] = {""}, workdir[PATH_MAX] = {""}, datadir[PATH_MAX] = {""};
+	char pool_file[PATH_MAX] = {""}, worker_file[PATH_MAX] = {""};
 
 	char **work_files = NULL;
 
@@ -902,7 +917,10 @@ EXTERN_MSC int GMT_batch (void *V_API, int mode, void *args) {
 			fprintf (fp, "%s", line);	/* Just copy the line as is */
 		}
 	}
-	fclose (Ctrl->In.fp);	/* Done reading the main script */
+	if (Ctrl->P.active)	/* Must re-read the main script below when building the pool job script */
+		rewind (Ctrl->In.fp);
+	else
+		fclose (Ctrl->In.fp);	/* Done reading the main script */
 	if (!Ctrl->D.active)	/* Move job products up to main directory */
 		fprintf (fp, "%s %s* %s\n", mvfile[Ctrl->In.mode], gmt_place_var (Ctrl->In.mode, "BATCH_NAME"), topdir);
 	fprintf (fp, "cd ..\n");	/* cd up to parent dir */
@@ -916,6 +934,83 @@ EXTERN_MSC int GMT_batch (void *V_API, int mode, void *args) {
 	if (Ctrl->In.mode == GMT_DOS_MODE)	/* This is crucial to the "start /B ..." statement below to ensure the DOS process terminates */
 		fprintf (fp, "exit\n");
 	fclose (fp);	/* Done writing loop script */
+
+	if (Ctrl->P.active) {	/* Also build the pool job script and one worker script per core */
+		/* The pool job script is the main job script except it is sourced by a persistent worker shell,
+		 * so the job tag arrives via the BATCH_JOB_ARG variable rather than as a script argument and
+		 * the GMT_SESSION_NAME is set once by the worker instead of per job. */
+		n_workers = MIN ((unsigned int)MAX (1, Ctrl->x.n_threads - 1), n_jobs);	/* Reserve one core for batch itself */
+		sprintf (pool_file, "batch_pool_job.%s", extension[Ctrl->In.mode]);
+		GMT_Report (API, GMT_MSG_INFORMATION, "Create pool job script %s\n", pool_file);
+		if ((fp = fopen (pool_file, "w")) == NULL) {
+			GMT_Report (API, GMT_MSG_ERROR, "Unable to create pool job script file %s - exiting\n", pool_file);
+			fclose (Ctrl->In.fp);
+			Return (GMT_ERROR_ON_FOPEN);
+		}
+		gmt_set_script (fp, Ctrl->In.mode);	/* Write 1st line of a script */
+		gmt_set_comment (fp, Ctrl->In.mode, "Single job script sourced repeatedly by a worker; job tag given via BATCH_JOB_ARG");
+		gmt_set_comment (fp, Ctrl->In.mode, "Include static and job-specific parameters");
+		fprintf (fp, "%s %s\n", load[Ctrl->In.mode], init_file);	/* Include the initialization parameters */
+		fprintf (fp, "%s batch_params_%s.%s\n", load[Ctrl->In.mode], gmt_place_var (Ctrl->In.mode, "BATCH_JOB_ARG"), extension[Ctrl->In.mode]);	/* Include the job parameters */
+		fprintf (fp, "mkdir %s\n", gmt_place_var (Ctrl->In.mode, "BATCH_DIR"));	/* Make a temp directory for this job */
+		fprintf (fp, "cd %s\n", gmt_place_var (Ctrl->In.mode, "BATCH_DIR"));		/* cd to the temp directory */
+		while (gmt_fgets (GMT, line, PATH_MAX, Ctrl->In.fp)) {	/* Read the main script and copy to pool job script, with some exceptions */
+			if (gmt_is_gmtmodule (line, "begin")) {	/* Must insert DIR_DATA setting */
+				fprintf (fp, "%s", line);
+				if (has_conf && !strstr (line, "-C")) fprintf (fp, cpconf[Ctrl->In.mode], conf_file);
+				fprintf (fp, "\tgmt set DIR_DATA \"%s\"\n", datadir);
+			}
+			else if (!strstr (line, "#!/")) {		/* Skip any leading shell incantation since already placed */
+				if (strchr (line, '\n') == NULL) strcat (line, "\n");	/* In case the last line misses a newline */
+				fprintf (fp, "%s", line);	/* Just copy the line as is */
+			}
+		}
+		fclose (Ctrl->In.fp);	/* Done reading the main script */
+		if (!Ctrl->D.active)	/* Move job products up to main directory */
+			fprintf (fp, "%s %s* %s\n", mvfile[Ctrl->In.mode], gmt_place_var (Ctrl->In.mode, "BATCH_NAME"), topdir);
+		fprintf (fp, "cd ..\n");	/* cd up to parent dir */
+		/* Create completion file so batch knows this job is done */
+		fprintf (fp, "%s %s.___\n", createfile[Ctrl->In.mode], gmt_place_var (Ctrl->In.mode, "BATCH_DIR"));
+		if (!Ctrl->Q.active) {	/* Delete evidence; otherwise we want to leave debug evidence */
+			gmt_set_comment (fp, Ctrl->In.mode, "Remove job directory and job parameter file");
+			fprintf (fp, "%s %s\n", rmdir[Ctrl->In.mode], gmt_place_var (Ctrl->In.mode, "BATCH_DIR"));	/* Remove the work dir and any files in it */
+			fprintf (fp, "%s batch_params_%s.%s\n", rmfile[Ctrl->In.mode], gmt_place_var (Ctrl->In.mode, "BATCH_JOB_ARG"), extension[Ctrl->In.mode]);	/* Remove the parameter file for this job */
+		}
+		fclose (fp);	/* Done writing the pool job script; no executable bit needed since it is only sourced */
+
+		GMT_Report (API, GMT_MSG_INFORMATION, "Create %u worker scripts\n", n_workers);
+		for (k = 0; k < n_workers; k++) {	/* Worker k runs jobs k, k + n_workers, k + 2*n_workers, ... in one shell process */
+			sprintf (worker_file, "batch_worker_%u.%s", k, extension[Ctrl->In.mode]);
+			if ((fp = fopen (worker_file, "w")) == NULL) {
+				GMT_Report (API, GMT_MSG_ERROR, "Unable to create worker script file %s - exiting\n", worker_file);
+				Return (GMT_ERROR_ON_FOPEN);
+			}
+			gmt_set_script (fp, Ctrl->In.mode);	/* Write 1st line of a script */
+			sprintf (string, "Worker %u of %u: runs its share of the job queue in a single shell process", k, n_workers);
+			gmt_set_comment (fp, Ctrl->In.mode, string);
+			fprintf (fp, "%s", export[Ctrl->In.mode]);	/* Hardwire one GMT_SESSION_NAME per worker */
+			if (Ctrl->In.mode == GMT_DOS_MODE)	/* Set GMT_SESSION_NAME under Windows to be the worker number */
+				fprintf (fp, "set GMT_SESSION_NAME=%u\n", k + 1);
+			else	/* On UNIX we use the worker shell's PID as GMT_SESSION_NAME */
+				gmt_set_tvalue (fp, Ctrl->In.mode, true, "GMT_SESSION_NAME", "$$");
+			for (i_job = k; i_job < n_jobs; i_job += n_workers) {	/* Source the pool job script once per assigned job */
+				job = i_job + Ctrl->T.start_job;
+				sprintf (state_tag, "%*.*d", precision, precision, job);
+				gmt_set_tvalue (fp, Ctrl->In.mode, false, "BATCH_JOB_ARG", state_tag);
+				fprintf (fp, "%s %s\n", load[Ctrl->In.mode], pool_file);
+			}
+			if (Ctrl->In.mode == GMT_DOS_MODE)	/* This is crucial to the "start /B ..." statement below to ensure the DOS process terminates */
+				fprintf (fp, "exit\n");
+			fclose (fp);	/* Done writing this worker script */
+#ifndef WIN32	/* Set executable bit if not Windows cmd */
+			if (chmod (worker_file, S_IRWXU)) {
+				GMT_Report (API, GMT_MSG_ERROR, "Unable to make worker script %s executable - exiting\n", worker_file);
+				Return (GMT_RUNTIME_ERROR);
+			}
+#endif
+		}
+	}
+
 	if (Ctrl->In.mode == GMT_DOS_MODE)
 		gmt_strrepc (topdir, '\\', '/');	/* Revert */
 
@@ -949,6 +1044,27 @@ EXTERN_MSC int GMT_batch (void *V_API, int mode, void *args) {
 	n_cores_unused = MAX (1, Ctrl->x.n_threads - 1);	/* Save one core for the main batch module thread */
 	status = gmt_M_memory (GMT, NULL, n_jobs, struct BATCH_STATUS);	/* Used to keep track of job status */
 	GMT_Report (API, GMT_MSG_INFORMATION, "Build jobs using %u cores\n", n_cores_unused);
+	if (Ctrl->P.active) {	/* Launch the persistent worker shells; each consumes its share of the queue in-process */
+		GMT_Report (API, GMT_MSG_INFORMATION, "Launch %u persistent worker shells\n", n_workers);
+		for (k = 0; k < n_workers; k++) {
+			sprintf (worker_file, "batch_worker_%u.%s", k, extension[Ctrl->In.mode]);
+#ifdef WIN32
+			if (Ctrl->In.mode < GMT_DOS_MODE)	/* A bash or csh run from Windows. Need to call via "start" to get parallel */
+				sprintf (cmd, "start /B %s %s", sys_cmd_nowait[Ctrl->In.mode], worker_file);
+			else						/* Running batch, so no need for the above trick */
+				sprintf (cmd, "%s %s &", sys_cmd_nowait[Ctrl->In.mode], worker_file);
+#else
+			sprintf (cmd, "%s %s &", sys_cmd_nowait[Ctrl->In.mode], worker_file);
+#endif
+			GMT_Report (API, GMT_MSG_DEBUG, "Launch worker script %s\n", worker_file);
+			if ((error = system (cmd))) {
+				GMT_Report (API, GMT_MSG_ERROR, "Running script %s returned error %d - aborting.\n", cmd, error);
+				Return (GMT_RUNTIME_ERROR);
+			}
+		}
+		for (k = 0; k < n_jobs; k++) status[k].started = true;	/* The workers own the whole queue from the start */
+		i_job = n_jobs;	n_jobs_not_started = 0;	/* Nothing left for the per-job launcher below; we just poll for completions */
+	}
 	/* START PARALLEL EXECUTION OF JOB SCRIPTS */
 	GMT_Report (API, GMT_MSG_INFORMATION, "Execute batch job scripts in parallel\n");
 	while (!done) {	/* Keep running jobs until all jobs have completed */
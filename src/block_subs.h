@@ -288,4 +288,95 @@ static int BLK_compare_index_z (const void *point_1, const void *point_2) {
 	return (BLK_compare_sub (point_1, point_2, BLK_CASE_Z));
 }
 
+#ifdef _OPENMP
+/*! Merge two consecutive sorted runs src[lo..mid) and src[mid..hi) into dst[lo..hi) */
+static void BLK_merge_runs (struct BLK_DATA *src, struct BLK_DATA *dst, uint64_t lo, uint64_t mid, uint64_t hi, int (*cmp) (const void *, const void *)) {
+	uint64_t i = lo, j = mid, k = lo;
+	while (i < mid && j < hi) dst[k++] = (cmp (&src[i], &src[j]) <= 0) ? src[i++] : src[j++];
+	while (i < mid) dst[k++] = src[i++];
+	while (j < hi)  dst[k++] = src[j++];
+}
+#endif
+
+#define BLK_SORT_PARALLEL_MIN	65536	/* Smallest array worth sorting with threads */
+
+/*! Sort the data array using the given comparator.  With OpenMP and a large enough array we
+ * qsort per-thread runs in parallel and then merge pairs of runs through a scratch array,
+ * which gives the same ordering as the plain qsort but several times faster on the huge
+ * arrays that come out of large surveys.  Without the scratch memory we just sort serially. */
+static void BLK_sort (struct GMT_CTRL *GMT, struct BLK_DATA *data, uint64_t n, int (*cmp) (const void *, const void *)) {
+#ifdef _OPENMP
+	struct BLK_DATA *scratch = NULL;
+	if (GMT->common.x.n_threads > 1 && n >= BLK_SORT_PARALLEL_MIN && (scratch = gmt_M_memory (GMT, NULL, n, struct BLK_DATA)) != NULL) {
+		int64_t p, n_runs = MIN ((int64_t)GMT->common.x.n_threads, (int64_t)(n / (BLK_SORT_PARALLEL_MIN / 2)));
+		uint64_t run = (n + n_runs - 1) / n_runs, width;
+		struct BLK_DATA *src = data, *dst = scratch, *swap = NULL;
+#pragma omp parallel for private(p) shared(data,n,run,n_runs,cmp)
+		for (p = 0; p < n_runs; p++) {
+			uint64_t lo = (uint64_t)p * run;
+			if (lo < n) qsort (&data[lo], MIN (run, n - lo), sizeof (struct BLK_DATA), cmp);
+		}
+		for (width = run; width < n; width *= 2) {	/* Merge pairs of runs until a single sorted array remains */
+			int64_t n_pairs = (int64_t)((n + 2 * width - 1) / (2 * width));
+#pragma omp parallel for private(p) shared(src,dst,n,width,n_pairs,cmp)
+			for (p = 0; p < n_pairs; p++) {
+				uint64_t lo = (uint64_t)p * 2 * width, mid = MIN (lo + width, n), hi = MIN (lo + 2 * width, n);
+				BLK_merge_runs (src, dst, lo, mid, hi, cmp);
+			}
+			swap = src;	src = dst;	dst = swap;
+		}
+		if (src != data) gmt_M_memcpy (data, src, n, struct BLK_DATA);
+		gmt_M_free (GMT, scratch);
+		return;
+	}
+#endif
+	qsort (data, n, sizeof (struct BLK_DATA), cmp);
+}
+
+/*! Return the k'th smallest value (0-based) of z[0..n-1] by quickselect, partially reordering z
+ * so that z[0..k-1] <= z[k] <= z[k+1..n-1].  Replaces full sorts where only a quantile is needed. */
+static double BLK_select (double *z, uint64_t n, uint64_t k) {
+	uint64_t lo = 0, hi = n - 1, mid, i, j;
+	double pivot, tmp;
+
+	while (lo < hi) {
+		mid = lo + (hi - lo) / 2;	/* Median-of-three pivot guards against ordered input */
+		if (z[mid] < z[lo]) { tmp = z[lo]; z[lo] = z[mid]; z[mid] = tmp; }
+		if (z[hi] < z[lo]) { tmp = z[lo]; z[lo] = z[hi]; z[hi] = tmp; }
+		if (z[hi] < z[mid]) { tmp = z[mid]; z[mid] = z[hi]; z[hi] = tmp; }
+		pivot = z[mid];
+		i = lo;	j = hi;
+		while (i <= j) {	/* Hoare partition */
+			while (z[i] < pivot) i++;
+			while (z[j] > pivot) j--;
+			if (i > j) break;
+			tmp = z[i]; z[i] = z[j]; z[j] = tmp;
+			i++;
+			if (j == 0) break;	/* Guard unsigned underflow */
+			j--;
+		}
+		if (k <= j)
+			hi = j;
+		else if (k >= i)
+			lo = i;
+		else
+			return (z[k]);	/* Landed among elements equal to the pivot */
+	}
+	return (z[lo]);
+}
+
+/*! Median via selection rather than a full sort; reorders z */
+static double BLK_median_destructive (double *z, uint64_t n) {
+	uint64_t k;
+	double med, below;
+
+	med = BLK_select (z, n, n/2);
+	if (n%2 == 0) {	/* Must average with the largest value below the middle one */
+		below = z[0];
+		for (k = 1; k < n/2; k++) if (z[k] > below) below = z[k];
+		med = 0.5 * (med + below);
+	}
+	return (med);
+}
+
 #endif
@@ -37,7 +37,7 @@
 #define THIS_MODULE_PURPOSE	"Block average (x,y,z) data tables by median estimation"
 #define THIS_MODULE_KEYS	"<D{,>D},GG),A->"
 #define THIS_MODULE_NEEDS	"R"
-#define THIS_MODULE_OPTIONS "-:>RVabdefhioqrw" GMT_OPT("FH")
+#define THIS_MODULE_OPTIONS "-:>RVabdefhioqrw" GMT_ADD_x_OPT GMT_OPT("FH")
 
 #include "block_subs.h"
 
@@ -90,7 +90,7 @@ static int usage (struct GMTAPI_CTRL *API, int level) {
 	GMT_Usage (API, 3, "+w Read/write weights as is [Default].");
 	GMT_Option (API, "a,bi");
 	if (gmt_M_showusage (API)) GMT_Usage (API, -2, "Default is 3 columns (or 4 if -W is set).");
-	GMT_Option (API, "bo,d,e,f,h,i,o,q,r,w,:,.");
+	GMT_Option (API, "bo,d,e,f,h,i,o,q,r,w,x,:,.");
 
 	return (GMT_MODULE_USAGE);
 }
@@ -611,7 +611,7 @@ EXTERN_MSC int GMT_blockmedian (void *V_API, int mode, void *args) {
 
 	/* Sort on node and Z value */
 
-	qsort (data, n_pitched, sizeof (struct BLK_DATA), BLK_compare_index_z);
+	BLK_sort (GMT, data, n_pitched, BLK_compare_index_z);
 
 	Out = gmt_new_record (GMT, out, NULL);	/* Since we only need to worry about numerics in this module */
 
@@ -652,8 +652,7 @@ EXTERN_MSC int GMT_blockmedian (void *V_API, int mode, void *args) {
 			/* Turn z_tmp into absolute deviations from the median (out[GMT_Z]) */
 			if (nz > 1) {
 				for (node = 0; node < nz; node++) z_tmp[node] = fabs (z_tmp[node] - out[GMT_Z]);
-				gmt_sort_array (GMT, z_tmp, nz, GMT_DOUBLE);
-				out[3] = (nz%2) ? z_tmp[nz/2] : 0.5 * (z_tmp[(nz-1)/2] + z_tmp[nz/2]);
+				out[3] = BLK_median_destructive (z_tmp, nz);
 				out[3] *= MAD_NORMALIZE;	/* This will be L1 MAD-based scale */
 			}
 			else
@@ -37,7 +37,7 @@
 #define THIS_MODULE_PURPOSE	"Block average (x,y,z) data tables by mode estimation"
 #define THIS_MODULE_KEYS	"<D{,>D},GG),A->"
 #define THIS_MODULE_NEEDS	"R"
-#define THIS_MODULE_OPTIONS "-:>RVabdefhioqrw" GMT_OPT("FH")
+#define THIS_MODULE_OPTIONS "-:>RVabdefhioqrw" GMT_ADD_x_OPT GMT_OPT("FH")
 
 #include "block_subs.h"
 
@@ -106,7 +106,7 @@ static int usage (struct GMTAPI_CTRL *API, int level) {
 
 	GMT_Option (API, "a,bi");
 	if (gmt_M_showusage (API)) GMT_Usage (API, -2, "Default is 3 columns (or 4 if -W is set).");
-	GMT_Option (API, "bo,d,e,f,h,i,o,q,r,w,:,.");
+	GMT_Option (API, "bo,d,e,f,h,i,o,q,r,w,x,:,.");
 
 	return (GMT_MODULE_USAGE);
 }
@@ -741,7 +741,7 @@ EXTERN_MSC int GMT_blockmode (void *V_API, int mode, void *args) {
 
 	/* Sort on node and Z value */
 
-	qsort (data, n_pitched, sizeof (struct BLK_DATA), BLK_compare_index_z);
+	BLK_sort (GMT, data, n_pitched, BLK_compare_index_z);
 
 	if (Ctrl->D.active) {	/* Choose to compute unweighted modes by histogram binning */
 		B = blockmode_bin_setup (GMT, Ctrl->D.width, Ctrl->D.center, Ctrl->D.mode, is_integer, z_min, z_max);
@@ -865,8 +865,7 @@ EXTERN_MSC int GMT_blockmode (void *V_API, int mode, void *args) {
 			/* Turn z_tmp into absolute deviations from the mode (out[GMT_Z]) */
 			if (nz > 1) {
 				for (node = 0; node < nz; node++) z_tmp[node] = fabs (z_tmp[node] - out[GMT_Z]);
-				gmt_sort_array (GMT, z_tmp, nz, GMT_DOUBLE);
-				out[3] = (nz%2) ? z_tmp[nz/2] : 0.5 * (z_tmp[(nz-1)/2] + z_tmp[nz/2]);
+				out[3] = BLK_median_destructive (z_tmp, nz);
 				out[3] *= MAD_NORMALIZE;	/* This will be LMS MAD-based scale */
 			}
 			else
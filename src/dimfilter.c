@@ -573,23 +573,21 @@ GMT_LOCAL void dimfilter_set_weight_matrix (struct DIMFILTER_INFO *F, struct GMT
 EXTERN_MSC int GMT_dimfilter (void *V_API, int mode, void *args) {
 	unsigned short int **sector = NULL;
 
-	unsigned int *n_in_median, wsize = 0, one_or_zero = 1, effort_level, n_sectors_2 = 0, col_in, row_in;
-	unsigned int GMT_n_multiples = 0, col_out, row_out, i, j, k, s;
-	bool full_360, shift = false, slow, slow2, fast_way;
-	int j_origin, *i_origin = NULL, ii, jj, scol, srow, error = 0;
+	unsigned int *n_in_median, *t_nin = NULL, wsize = 0, one_or_zero = 1, effort_level, n_sectors_2 = 0, col_in, row_in;
+	unsigned int GMT_n_multiples = 0, i, j, k, s;
+	openmp_int col_out, row_out;
+	bool full_360, shift = false, slow, slow2, fast_way, *corridor = NULL;
+	int j_origin, *i_origin = NULL, ii, jj, scol, srow, error = 0, thread = 0, n_threads = 1;
 
 	uint64_t n_nan = 0, ij_in, ij_out, ij_wt;
 
 	double wesn[4], inc[2], x_scale, y_scale, x_width, y_width, angle, z = 0.0;
-	double x_out, y_out, *wt_sum = NULL, *value = NULL, last_median, this_median;
-	double last_median2 = 0.0, this_median2, d, **work_array = NULL, *x_shift = NULL;
-	double z_min, z_max, z2_min = 0.0, z2_max = 0.0, wx = 0.0, *c_x = NULL, *c_y = NULL;
-#ifdef DEBUG
-	double x_debug[5], y_debug[5], z_debug[5];
-#endif
+	double x_out, y_out, *wt_sum = NULL, *value = NULL, this_median, this_median2;
+	double d, **work_array = NULL, *x_shift = NULL;
+	double wx = 0.0, *c_x = NULL, *c_y = NULL;
+	double **t_work = NULL, *t_value = NULL, *t_wt = NULL;
 
 #ifdef OBSOLETE
-	bool first_time = true;
 	int n = 0;
 	int n_bad_planes = 0, S = 0;
 	double Sx = 0.0, Sy = 0.0, Sz = 0.0, Sxx = 0.0, Syy = 0.0, Sxy = 0.0, Sxz = 0.0, Syz = 0.0;
@@ -602,7 +600,7 @@ EXTERN_MSC int GMT_dimfilter (void *V_API, int mode, void *args) {
 	char *filter_name[5] = {"Boxcar", "Cosine Arch", "Gaussian", "Median", "Mode"};
 
 	struct GMT_GRID *Gin = NULL, *Gout = NULL;
-	struct DIMFILTER_INFO F;
+	struct DIMFILTER_INFO F, Fw;
 	struct DIMFILTER_CTRL *Ctrl = NULL;
 	struct GMT_CTRL *GMT = NULL, *GMT_cpy = NULL;
         struct GMT_OPTION *options = NULL;
@@ -642,6 +640,10 @@ EXTERN_MSC int GMT_dimfilter (void *V_API, int mode, void *args) {
 		slow  = (Ctrl->F.filter == DIMFILTER_MEDIAN || Ctrl->F.filter == DIMFILTER_MODE);	/* Will require sorting etc */
 		slow2 = (Ctrl->N.filter == DIMSECTOR_MEDIAN || Ctrl->N.filter == DIMSECTOR_MODE);	/* SCAN: Will also require sorting etc */
 
+#ifdef _OPENMP
+		n_threads = omp_get_max_threads ();	/* Output rows are filtered in parallel, each thread with its own work space */
+#endif
+
 		if (Ctrl->T.active)	/* Make output grid of the opposite registration */
 			one_or_zero = (Gin->header->registration == GMT_GRID_PIXEL_REG) ? 1 : 0;
 		else
@@ -668,9 +670,6 @@ EXTERN_MSC int GMT_dimfilter (void *V_API, int mode, void *args) {
 			Return (GMT_RUNTIME_ERROR);
 		}
 
-		last_median = 0.5 * (Gin->header->z_min + Gin->header->z_max);
-		z_min = Gin->header->z_min;	z_max = Gin->header->z_max;
-
 		if ((Gout = GMT_Create_Data (API, GMT_IS_GRID, GMT_IS_SURFACE, GMT_CONTAINER_AND_DATA, NULL, wesn, inc, \
 			!one_or_zero, GMT_NOTSET, NULL)) == NULL) Return (API->error);
 
@@ -728,27 +727,39 @@ EXTERN_MSC int GMT_dimfilter (void *V_API, int mode, void *args) {
 		F.n_columns = 2 * F.x_half_width + 1;
 		F.n_rows = 2 * F.y_half_width + 1;
 		F.width = Ctrl->F.width;
-		F.weight = gmt_M_memory (GMT, NULL, F.n_columns*F.n_rows, double);
 
-		if (slow) {	/* SCAN: Now require several work_arrays, one for each sector */
-			work_array = gmt_M_memory (GMT, NULL, Ctrl->N.n_sectors, double *);
+		/* Determine how much effort to compute weights:
+			1 = Compute weights once for entire grid
+			2 = Compute weights once per scanline
+			3 = Compute weights for every output point [slow]
+		*/
+
+		if (fast_way && Ctrl->D.mode <= 2)
+			effort_level = 1;
+		else if (fast_way && Ctrl->D.mode > 2)
+			effort_level = 2;
+		else
+			effort_level = 3;
+
+		/* If weights must be recomputed per scanline or per node then each thread writes into its own slab */
+		F.weight = gmt_M_memory (GMT, NULL, ((effort_level > 1) ? n_threads : 1) * ((size_t)F.n_columns * F.n_rows), double);
+
+		if (slow) {	/* SCAN: Now require several work_arrays, one for each sector (and thread) */
+			work_array = gmt_M_memory (GMT, NULL, n_threads * Ctrl->N.n_sectors, double *);
+			wsize = 2*F.n_columns*F.n_rows/Ctrl->N.n_sectors;	/* Should be enough, watch for messages to the contrary */
+			for (i = 0; i < n_threads * Ctrl->N.n_sectors; i++)
+				work_array[i] = gmt_M_memory (GMT, NULL, wsize, double);
 #ifdef OBSOLETE
 			if (Ctrl->S.active) work_array2 = gmt_M_memory (GMT, NULL, 2*F.n_columns*F.n_rows, double);
 			if (Ctrl->E.active) {
 				xx = gmt_M_memory (GMT, NULL, Ctrl->N.n_sectors, short int *);
 				yy = gmt_M_memory (GMT, NULL, Ctrl->N.n_sectors, short int *);
-			}
-#endif
-			wsize = 2*F.n_columns*F.n_rows/Ctrl->N.n_sectors;	/* Should be enough, watch for messages to the contrary */
-			for (i = 0; i < Ctrl->N.n_sectors; i++) {
-				work_array[i] = gmt_M_memory (GMT, NULL, wsize, double);
-#ifdef OBSOLETE
-				if (Ctrl->E.active) {
+				for (i = 0; i < Ctrl->N.n_sectors; i++) {
 					xx[i] = gmt_M_memory (GMT, NULL, wsize, short int);
 					yy[i] = gmt_M_memory (GMT, NULL, wsize, short int);
 				}
-#endif
 			}
+#endif
 		}
 
 		GMT_Report (API, GMT_MSG_INFORMATION, "Input n_columns,n_rows = (%d %d), output n_columns,n_rows = (%d %d), filter n_columns,n_rows = (%d %d)\n",
@@ -757,7 +768,7 @@ EXTERN_MSC int GMT_dimfilter (void *V_API, int mode, void *args) {
 
 		/* Compute nearest xoutput i-indices and shifts once */
 
-		for (col_out = 0; col_out < Gout->header->n_columns; col_out++) {
+		for (col_out = 0; col_out < (openmp_int)Gout->header->n_columns; col_out++) {
 			x_out = gmt_M_grd_col_to_x (GMT, col_out, Gout->header);	/* Current longitude */
 			i_origin[col_out] = (int)gmt_M_grd_x_to_col (GMT, x_out, Gin->header);
 			if (!fast_way) x_shift[col_out] = x_out - gmt_M_grd_col_to_x (GMT, i_origin[col_out], Gin->header);
@@ -765,19 +776,6 @@ EXTERN_MSC int GMT_dimfilter (void *V_API, int mode, void *args) {
 
 		/* Now we can do the filtering  */
 
-		/* Determine how much effort to compute weights:
-			1 = Compute weights once for entire grid
-			2 = Compute weights once per scanline
-			3 = Compute weights for every output point [slow]
-		*/
-
-		if (fast_way && Ctrl->D.mode <= 2)
-			effort_level = 1;
-		else if (fast_way && Ctrl->D.mode > 2)
-			effort_level = 2;
-		else
-			effort_level = 3;
-
 		if (effort_level == 1) dimfilter_set_weight_matrix (&F, Gout->header, 0.0, shift);	/* Only need this once */
 
 		if (Ctrl->C.active) {	/* Use fixed-width diagonal corridors instead of bow-ties */
@@ -788,6 +786,18 @@ EXTERN_MSC int GMT_dimfilter (void *V_API, int mode, void *args) {
 				angle = (i + 0.5) * (M_PI/n_sectors_2);	/* Angle of central diameter of each corridor */
 				sincos (angle, &c_y[i], &c_x[i]);	/* Unit vector of diameter */
 			}
+			/* Like the sector lookup below, corridor membership only depends on the (ii, jj) offset so we
+			 * precalculate it once instead of redoing the distance test for every sector at every node */
+			corridor = gmt_M_memory (GMT, NULL, (size_t)F.n_rows * F.n_columns * n_sectors_2, bool);
+			for (jj = -F.y_half_width; jj <= F.y_half_width; jj++) {
+				for (ii = -F.x_half_width; ii <= F.x_half_width; ii++) {
+					ij_wt = (jj + F.y_half_width) * (uint64_t)F.n_columns + ii + F.x_half_width;
+					for (s = 0; s < n_sectors_2; s++) {
+						d = sqrt (c_y[s] * ii + c_x[s] * jj);	/* Perpendicular distance to central diameter, in nodes */
+						corridor[ij_wt * n_sectors_2 + s] = !(d > F.y_half_width);	/* Inside this corridor */
+					}
+				}
+			}
 		}
 		else {
 		/* SCAN: Precalculate which sector each point belongs to */
@@ -805,23 +815,39 @@ EXTERN_MSC int GMT_dimfilter (void *V_API, int mode, void *args) {
 				}
 			}
 		}
-		n_in_median = gmt_M_memory (GMT, NULL, Ctrl->N.n_sectors, unsigned int);
-		value = gmt_M_memory (GMT, NULL, Ctrl->N.n_sectors, double);
-		wt_sum = gmt_M_memory (GMT, NULL, Ctrl->N.n_sectors, double);
+		n_in_median = gmt_M_memory (GMT, NULL, n_threads * Ctrl->N.n_sectors, unsigned int);
+		value = gmt_M_memory (GMT, NULL, n_threads * Ctrl->N.n_sectors, double);
+		wt_sum = gmt_M_memory (GMT, NULL, n_threads * Ctrl->N.n_sectors, double);
+
+#ifdef _OPENMP
+#pragma omp parallel for private(row_out,thread,Fw,t_work,t_nin,t_value,t_wt,y_out,j_origin,col_out,ij_out,ii,scol,col_in,jj,srow,row_in,ij_wt,ij_in,s,wx,k,this_median,this_median2,z) shared(GMT,API,Gin,Gout,Ctrl,F,slow,slow2,effort_level,shift,wsize,i_origin,sector,corridor,n_sectors_2,work_array,n_in_median,value,wt_sum) reduction(+:n_nan,GMT_n_multiples)
+#endif
+		for (row_out = 0; row_out < (openmp_int)Gout->header->n_rows; row_out++) {
 
-		for (row_out = 0; row_out < Gout->header->n_rows; row_out++) {
+#ifdef _OPENMP
+			thread = omp_get_thread_num ();
+#endif
+			Fw = F;	/* Local copy of the filter info; each thread writes recomputed weights into its own slab */
+			if (effort_level > 1) Fw.weight = F.weight + (size_t)thread * ((size_t)F.n_columns * F.n_rows);
+			t_work = (slow) ? work_array + thread * Ctrl->N.n_sectors : NULL;	/* This thread's share of the work space */
+			t_nin  = n_in_median + thread * Ctrl->N.n_sectors;
+			t_value = value + thread * Ctrl->N.n_sectors;
+			t_wt = wt_sum + thread * Ctrl->N.n_sectors;
 
 			GMT_Report (API, GMT_MSG_INFORMATION, "Processing output line %d\r", row_out);
 			y_out = gmt_M_grd_row_to_y (GMT, row_out, Gout->header);
 			j_origin = (int)gmt_M_grd_y_to_row (GMT, y_out, Gin->header);
-			if (effort_level == 2) dimfilter_set_weight_matrix (&F, Gout->header, y_out, shift);
+			if (effort_level == 2) dimfilter_set_weight_matrix (&Fw, Gout->header, y_out, shift);
 
-			for (col_out = 0; col_out < Gout->header->n_columns; col_out++) {
+			for (col_out = 0; col_out < (openmp_int)Gout->header->n_columns; col_out++) {
+#ifdef DEBUG
+				double x_debug[5], y_debug[5], z_debug[5];
+#endif
 
-				if (effort_level == 3) dimfilter_set_weight_matrix (&F, Gout->header, y_out, shift);
-				gmt_M_memset (n_in_median, Ctrl->N.n_sectors, unsigned int);
-				gmt_M_memset (value, Ctrl->N.n_sectors, double);
-				gmt_M_memset (wt_sum, Ctrl->N.n_sectors, double);
+				if (effort_level == 3) dimfilter_set_weight_matrix (&Fw, Gout->header, y_out, shift);
+				gmt_M_memset (t_nin, Ctrl->N.n_sectors, unsigned int);
+				gmt_M_memset (t_value, Ctrl->N.n_sectors, double);
+				gmt_M_memset (t_wt, Ctrl->N.n_sectors, double);
 #ifdef OBSOLETE
 				if (Ctrl->E.active) {
 					S = 0;
@@ -841,7 +867,7 @@ EXTERN_MSC int GMT_dimfilter (void *V_API, int mode, void *args) {
 						if (srow < 0 || (row_in = srow) >= Gin->header->n_rows) continue;
 
 						ij_wt = (jj + F.y_half_width) * (uint64_t)F.n_columns + ii + F.x_half_width;
-						if (F. weight[ij_wt] < 0.0) continue;
+						if (Fw.weight[ij_wt] < 0.0) continue;
 
 						ij_in = gmt_M_ijp (Gin->header, row_in, col_in);
 						if (gmt_M_is_fnan (Gin->data[ij_in])) continue;
@@ -850,22 +876,21 @@ EXTERN_MSC int GMT_dimfilter (void *V_API, int mode, void *args) {
 
 						if (Ctrl->C.active) {	/* Point can belong to several corridors */
 							for (s = 0; s < n_sectors_2; s++) {
-								d = sqrt (c_y[s] * ii + c_x[s] * jj);	/* Perpendicular distance to central diameter, in nodes */
-								if (d > F.y_half_width) continue;	/* Outside this corridor */
+								if (!corridor[ij_wt * n_sectors_2 + s]) continue;	/* Outside this corridor */
 								if (slow) {
-									work_array[s][n_in_median[s]] = Gin->data[ij_in];
+									t_work[s][t_nin[s]] = Gin->data[ij_in];
 #ifdef OBSOLETE
 									if (Ctrl->S.active) work_array2[n++] = Gin->data[ij_in];
 #endif
 #ifdef DEBUG
-									if (n_in_median[s] < 5) x_debug[n_in_median[s]] = (double)ii;
-									if (n_in_median[s] < 5) y_debug[n_in_median[s]] = (double)jj;
-									if (n_in_median[s] < 5) z_debug[n_in_median[s]] = Gin->data[ij_in];
+									if (t_nin[s] < 5) x_debug[t_nin[s]] = (double)ii;
+									if (t_nin[s] < 5) y_debug[t_nin[s]] = (double)jj;
+									if (t_nin[s] < 5) z_debug[t_nin[s]] = Gin->data[ij_in];
 #endif
 #ifdef OBSOLETE
 									if (Ctrl->E.active) {	/* Sum up required terms to solve for slope and intercepts of planar trend */
-									xx[s][n_in_median[s]] = ii;
-										yy[s][n_in_median[s]] = jj;
+									xx[s][t_nin[s]] = ii;
+										yy[s][t_nin[s]] = jj;
 										Sx += ii;
 										Sy += jj;
 										Sz += Gin->data[ij_in];
@@ -877,16 +902,16 @@ EXTERN_MSC int GMT_dimfilter (void *V_API, int mode, void *args) {
 										S++;
 									}
 #endif
-									n_in_median[s]++;
+									t_nin[s]++;
 								}
 								else {
-									wx = Gin->data[ij_in] * F. weight[ij_wt];
-									value[s] += wx;
-									wt_sum[s] += F. weight[ij_wt];
+									wx = Gin->data[ij_in] * Fw.weight[ij_wt];
+									t_value[s] += wx;
+									t_wt[s] += Fw.weight[ij_wt];
 #ifdef OBSOLETE
 									if (Ctrl->S.active) {
 										Sxx += wx * Gin->data[ij_in];
-										Sw += F. weight[ij_wt];
+										Sw += Fw.weight[ij_wt];
 										n++;
 									}
 #endif
@@ -896,16 +921,16 @@ EXTERN_MSC int GMT_dimfilter (void *V_API, int mode, void *args) {
 						else if (ii == 0 && jj == 0) {	/* Center point belongs to all sectors */
 							if (slow) {	/* Must store copy in all work arrays */
 								for (s = 0; s < Ctrl->N.n_sectors; s++) {
-									work_array[s][n_in_median[s]] = Gin->data[ij_in];
+									t_work[s][t_nin[s]] = Gin->data[ij_in];
 #ifdef DEBUG
-									if (n_in_median[s] < 5) x_debug[n_in_median[s]] = (double)ii;
-									if (n_in_median[s] < 5) y_debug[n_in_median[s]] = (double)jj;
-									if (n_in_median[s] < 5) z_debug[n_in_median[s]] = Gin->data[ij_in];
+									if (t_nin[s] < 5) x_debug[t_nin[s]] = (double)ii;
+									if (t_nin[s] < 5) y_debug[t_nin[s]] = (double)jj;
+									if (t_nin[s] < 5) z_debug[t_nin[s]] = Gin->data[ij_in];
 #endif
 #ifdef OBSOLETE
-									if (Ctrl->E.active) xx[s][n_in_median[s]] = yy[s][n_in_median[s]] = 0;	/*(0,0) at the node */
+									if (Ctrl->E.active) xx[s][t_nin[s]] = yy[s][t_nin[s]] = 0;	/*(0,0) at the node */
 #endif
-									n_in_median[s]++;
+									t_nin[s]++;
 								}
 #ifdef OBSOLETE
 								if (Ctrl->S.active) work_array2[n++] = Gin->data[ij_in];
@@ -913,14 +938,14 @@ EXTERN_MSC int GMT_dimfilter (void *V_API, int mode, void *args) {
 							}
 							else {	/* Simply add to the weighted sums */
 								for (s = 0; s < Ctrl->N.n_sectors; s++) {
-									wx = Gin->data[ij_in] * F. weight[ij_wt];
-									value[s] += wx;
-									wt_sum[s] += F. weight[ij_wt];
+									wx = Gin->data[ij_in] * Fw.weight[ij_wt];
+									t_value[s] += wx;
+									t_wt[s] += Fw.weight[ij_wt];
 								}
 #ifdef OBSOLETE
 								if (Ctrl->S.active) {
 									Sxx += wx * Gin->data[ij_in];
-									Sw += F. weight[ij_wt];
+									Sw += Fw.weight[ij_wt];
 									n++;
 								}
 #endif
@@ -936,22 +961,22 @@ EXTERN_MSC int GMT_dimfilter (void *V_API, int mode, void *args) {
 							s = sector[jj+F.y_half_width][ii+F.x_half_width];	/* Get the sector for this node */
 
 							if (slow) {
-								work_array[s][n_in_median[s]] = Gin->data[ij_in];
+								t_work[s][t_nin[s]] = Gin->data[ij_in];
 #ifdef OBSOLETE
 								if (Ctrl->S.active) work_array2[n++] = Gin->data[ij_in];
 #endif
 #ifdef DEBUG
-								if (n_in_median[s] < 5) x_debug[n_in_median[s]] = (double)ii;
-								if (n_in_median[s] < 5) y_debug[n_in_median[s]] = (double)jj;
-								if (n_in_median[s] < 5) z_debug[n_in_median[s]] = Gin->data[ij_in];
+								if (t_nin[s] < 5) x_debug[t_nin[s]] = (double)ii;
+								if (t_nin[s] < 5) y_debug[t_nin[s]] = (double)jj;
+								if (t_nin[s] < 5) z_debug[t_nin[s]] = Gin->data[ij_in];
 								(void)x_debug;
 								(void)y_debug;
 								(void)z_debug;
 #endif
 #ifdef OBSOLETE
 								if (Ctrl->E.active) {	/* Sum up required terms to solve for slope and intercepts of planar trend */
-									xx[s][n_in_median[s]] = ii;
-									yy[s][n_in_median[s]] = jj;
+									xx[s][t_nin[s]] = ii;
+									yy[s][t_nin[s]] = jj;
 									Sx += ii;
 									Sy += jj;
 									Sz += Gin->data[ij_in];
@@ -963,16 +988,16 @@ EXTERN_MSC int GMT_dimfilter (void *V_API, int mode, void *args) {
 									S++;
 								}
 #endif
-								n_in_median[s]++;
+								t_nin[s]++;
 							}
 							else {
-								wx = Gin->data[ij_in] * F. weight[ij_wt];
-								value[s] += wx;
-								wt_sum[s] += F. weight[ij_wt];
+								wx = Gin->data[ij_in] * Fw.weight[ij_wt];
+								t_value[s] += wx;
+								t_wt[s] += Fw.weight[ij_wt];
 #ifdef OBSOLETE
 								if (Ctrl->S.active) {
 									Sxx += wx * Gin->data[ij_in];
-									Sw += F. weight[ij_wt];
+									Sw += Fw.weight[ij_wt];
 									n++;
 								}
 #endif
@@ -1000,47 +1025,31 @@ EXTERN_MSC int GMT_dimfilter (void *V_API, int mode, void *args) {
 #endif
 
 				if (slow) {	/* Take median or mode of each work array for each sector */
-					if (slow2) {
-						z2_min = DBL_MAX;
-						z2_max = -DBL_MAX;
-					}
 					for (s = k = 0; s < Ctrl->N.n_sectors; s++) {
-						if (n_in_median[s]) {
-							if (n_in_median[s] >= wsize) GMT_Report (API, GMT_MSG_WARNING, "Exceed array size (%d > %d)!\n", n_in_median[s], wsize);
+						if (t_nin[s]) {
+							if (t_nin[s] >= wsize) GMT_Report (API, GMT_MSG_WARNING, "Exceed array size (%d > %d)!\n", t_nin[s], wsize);
 #ifdef OBSOLETE
-							if (Ctrl->E.active) {
-								z_min = DBL_MAX;
-								z_max = -DBL_MAX;
-								for (ii = 0; ii < n_in_median[s]; ii++) {
-									work_array[s][ii] -= (intercept + slope_x * xx[s][ii] + slope_y * yy[s][ii]);
-									if (work_array[s][ii] < z_min) z_min = work_array[s][ii];
-									if (work_array[s][ii] > z_max) z_max = work_array[s][ii];
-								}
-								if (first_time) last_median = 0.5 * (z_min + z_max), first_time = false;
+							if (Ctrl->E.active) {	/* Remove the planar trend from the sector values before filtering */
+								for (ii = 0; ii < (int)t_nin[s]; ii++)
+									t_work[s][ii] -= (intercept + slope_x * xx[s][ii] + slope_y * yy[s][ii]);
 							}
 #endif
-							if (Ctrl->F.filter == DIMFILTER_MEDIAN) {
-								gmt_median (GMT, work_array[s], n_in_median[s], z_min, z_max, last_median, &this_median);
-								last_median = this_median;
-							}
+							if (Ctrl->F.filter == DIMFILTER_MEDIAN)	/* Exact median by O(n) selection */
+								this_median = gmt_quantile_inplace (GMT, t_work[s], 50.0, t_nin[s]);
 							else
-								gmt_mode (GMT, work_array[s], n_in_median[s], n_in_median[s]/2, true, Ctrl->F.mode, &GMT_n_multiples, &this_median);
-							value[k] = this_median;
+								gmt_mode (GMT, t_work[s], t_nin[s], t_nin[s]/2, true, Ctrl->F.mode, &GMT_n_multiples, &this_median);
+							t_value[k] = this_median;
 #ifdef OBSOLETE
-							if (Ctrl->E.active) value[k] += intercept;	/* I.e., intercept + x * slope_x + y * slope_y, but x == y == 0 at node */
+							if (Ctrl->E.active) t_value[k] += intercept;	/* I.e., intercept + x * slope_x + y * slope_y, but x == y == 0 at node */
 #endif
-							if (slow2) {
-								if (value[k] < z2_min) z2_min = value[k];
-								if (value[k] > z2_max) z2_max = value[k];
-							}
 							k++;
 						}
 					}
 				}
 				else {	/* Simply divide weighted sums by the weights */
 					for (s = k = 0; s < Ctrl->N.n_sectors; s++) {
-						if (wt_sum[s] != 0.0) {
-							value[k] = (gmt_grdfloat)(value[s] / wt_sum[s]);
+						if (t_wt[s] != 0.0) {
+							t_value[k] = (gmt_grdfloat)(t_value[s] / t_wt[s]);
 							k++;
 						}
 					}
@@ -1056,12 +1065,10 @@ EXTERN_MSC int GMT_dimfilter (void *V_API, int mode, void *args) {
 				}
 
 				if (slow2) {	/* Get median (or mode) of all the medians (or modes) */
-					if (Ctrl->F.filter == DIMFILTER_MEDIAN) {
-						gmt_median (GMT, value, k, z2_min, z2_max, last_median2, &this_median2);
-						last_median2 = this_median2;
-					}
+					if (Ctrl->F.filter == DIMFILTER_MEDIAN)
+						this_median2 = gmt_quantile_inplace (GMT, t_value, 50.0, k);
 					else
-						gmt_mode (GMT, value, k, k/2, true, Ctrl->N.mode, &GMT_n_multiples, &this_median2);
+						gmt_mode (GMT, t_value, k, k/2, true, Ctrl->N.mode, &GMT_n_multiples, &this_median2);
 					z = this_median2;
 				}
 				else {	/* Get min, max, or mean */
@@ -1081,13 +1088,13 @@ EXTERN_MSC int GMT_dimfilter (void *V_API, int mode, void *args) {
 					for (s = 0; s < k; s++) {	/* Apply the min, max, or mean update */
 						switch (Ctrl->N.filter) {
 							case DIMSECTOR_MIN:	/* Lower bound */
-								if (value[s] < z) z = value[s];
+								if (t_value[s] < z) z = t_value[s];
 								break;
 							case DIMSECTOR_MAX:	/* Upper bound */
-								if (value[s] > z) z = value[s];
+								if (t_value[s] > z) z = t_value[s];
 								break;
 							case DIMSECTOR_MEAN:	/* Average (mean) */
-								z += value[s];
+								z += t_value[s];
 								break;
 							default:
 								break;
@@ -1137,25 +1144,28 @@ EXTERN_MSC int GMT_dimfilter (void *V_API, int mode, void *args) {
 
 		gmt_M_free (GMT, F. weight);
 		gmt_M_free (GMT, i_origin);
-		for (ii = 0; ii < F.n_rows; ii++) gmt_M_free (GMT, sector[ii]);
-		gmt_M_free (GMT, sector);
+		if (Ctrl->C.active) {	/* Free the corridor geometry */
+			gmt_M_free (GMT, corridor);
+			gmt_M_free (GMT, c_x);
+			gmt_M_free (GMT, c_y);
+		}
+		else {	/* Free the sector lookup */
+			for (ii = 0; ii < F.n_rows; ii++) gmt_M_free (GMT, sector[ii]);
+			gmt_M_free (GMT, sector);
+		}
 		gmt_M_free (GMT, value);
 		gmt_M_free (GMT, wt_sum);
 		gmt_M_free (GMT, n_in_median);
 		if (slow) {
-			for (j = 0; j < Ctrl->N.n_sectors; j++) {
-				gmt_M_free (GMT, work_array[j]);
-#ifdef OBSOLETE
-				if (Ctrl->E.active) {
-					gmt_M_free (GMT, xx[j]);
-					gmt_M_free (GMT, yy[j]);
-				}
-#endif
-			}
+			for (i = 0; i < n_threads * Ctrl->N.n_sectors; i++) gmt_M_free (GMT, work_array[i]);
 			gmt_M_free (GMT, work_array);
 #ifdef OBSOLETE
 			if (Ctrl->S.active) gmt_M_free (GMT, work_array2);
 			if (Ctrl->E.active) {
+				for (j = 0; j < Ctrl->N.n_sectors; j++) {
+					gmt_M_free (GMT, xx[j]);
+					gmt_M_free (GMT, yy[j]);
+				}
 				gmt_M_free (GMT, xx);
 				gmt_M_free (GMT, yy);
 			}
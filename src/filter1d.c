@@ -593,6 +593,141 @@ GMT_LOCAL void filter1d_get_robust_estimates (struct GMT_CTRL *GMT, struct FILTE
 	}
 }
 
+struct FILTER1D_SLIDER {	/* Sorted sliding window for incremental median estimates */
+	double *val;	/* Window values in ascending order */
+	uint64_t n;	/* Current number of values in the window */
+};
+
+GMT_LOCAL uint64_t filter1d_slider_lower_bound (struct FILTER1D_SLIDER *W, double x) {
+	/* Return index of the first window value >= x */
+	uint64_t lo = 0, hi = W->n, mid;
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		if (W->val[mid] < x)
+			lo = mid + 1;
+		else
+			hi = mid;
+	}
+	return (lo);
+}
+
+GMT_LOCAL void filter1d_slider_insert (struct FILTER1D_SLIDER *W, double x) {
+	/* Admit value x to the window, keeping the window sorted */
+	uint64_t p = filter1d_slider_lower_bound (W, x);
+	if (p < W->n) memmove (&W->val[p+1], &W->val[p], (size_t)(W->n - p) * sizeof (double));
+	W->val[p] = x;
+	W->n++;
+}
+
+GMT_LOCAL void filter1d_slider_remove (struct FILTER1D_SLIDER *W, double x) {
+	/* Retire value x from the window; x was inserted earlier so it must be present */
+	uint64_t p = filter1d_slider_lower_bound (W, x);
+	if (p == W->n) return;	/* Defensive; cannot happen for values that went through filter1d_slider_insert */
+	if (p < W->n - 1) memmove (&W->val[p], &W->val[p+1], (size_t)(W->n - 1 - p) * sizeof (double));
+	W->n--;
+}
+
+GMT_LOCAL double filter1d_slider_median (struct FILTER1D_SLIDER *W) {
+	uint64_t h = W->n / 2;
+	return ((W->n % 2) ? W->val[h] : 0.5 * (W->val[h-1] + W->val[h]));
+}
+
+GMT_LOCAL int filter1d_do_the_median_filter (struct GMTAPI_CTRL *C, struct FILTER1D_INFO *F) {
+	/* Fast path for fixed-width median filtering without window vetting (-L, -S).
+	 * Instead of copying and sorting the window contents from scratch for every
+	 * output point we keep one sorted sliding window per column and update it
+	 * incrementally as the window advances, so each sample enters and leaves the
+	 * window exactly once.  The columns are independent and are filtered in
+	 * parallel when OpenMP is enabled. */
+	uint64_t k, kk, first_k, last_k, n_out, n_good_ones, i_col, iq;
+	int64_t col;	/* Must be signed due to OpenMP restrictions */
+	double small, *result = NULL, *data_sum = NULL;
+	struct FILTER1D_SLIDER *slider = NULL;
+	struct GMT_RECORD *Out = NULL;
+	struct GMT_CTRL *GMT = C->GMT;
+
+	iq = lrint (F->q_factor);
+
+	if (F->out_at_time) {	/* Set up equidistant output times given the min/max/inc given */
+		if (gmt_create_array (GMT, 'T', &(F->T), &(F->t_start), &(F->t_stop)))
+			return GMT_RUNTIME_ERROR;
+		first_k = 0;	/* Start at first output point */
+		last_k = F->T.n - 1;
+	}
+	else {	/* Duplicate an output time array from the input times but exclude ends (unless -E) */
+		F->T.array = gmt_M_memory (GMT, NULL, F->n_rows, double);
+		gmt_M_memcpy (F->T.array, F->data[F->t_col], F->n_rows, double);
+		for (first_k = 0; F->data[F->t_col][first_k] < F->t_start; ++first_k);	/* Bypass points outside */
+		for (last_k = F->n_rows-1; last_k && F->data[F->t_col][last_k] > F->t_stop; --last_k);	/* Bypass points outside */
+	}
+	small = (F->T.array[1] - F->T.array[0]) * GMT_CONV8_LIMIT;
+	n_out = last_k - first_k + 1;
+
+	/* One medians-matrix row per output point; NaN means no estimate for that column */
+	result = gmt_M_memory (GMT, NULL, n_out * F->n_cols, double);
+	slider = gmt_M_memory (GMT, NULL, F->n_cols, struct FILTER1D_SLIDER);
+	for (i_col = 0; i_col < F->n_cols; ++i_col)	/* gmt_M_memory is not thread-safe so allocate all windows up front */
+		slider[i_col].val = gmt_M_memory (GMT, NULL, F->n_rows, double);
+
+#ifdef _OPENMP
+#pragma omp parallel for private(col) shared(F,GMT,slider,result,first_k,last_k,small,iq)
+#endif
+	for (col = 0; col < (int64_t)F->n_cols; ++col) {
+		uint64_t left = 0, right = 0, k, kk;
+		double med;
+		struct FILTER1D_SLIDER *W = &slider[col];
+		if ((uint64_t)col == F->t_col) continue;
+		for (k = first_k; k <= last_k; ++k) {
+			kk = k - first_k;
+			/* Advance the window; retire departing samples and admit arriving ones */
+			while (left < F->n_rows && (F->T.array[k] - F->data[F->t_col][left] - small) > F->half_width) {
+				if (!gmt_M_is_dnan (F->data[col][left])) filter1d_slider_remove (W, F->data[col][left]);
+				++left;
+			}
+			while (right < F->n_rows && (F->data[F->t_col][right] - F->T.array[k] - small) <= F->half_width) {
+				if (!gmt_M_is_dnan (F->data[col][right])) filter1d_slider_insert (W, F->data[col][right]);
+				++right;
+			}
+			if (right <= left || W->n == 0 || (F->check_q && W->n < iq)) {	/* Nothing usable in this window */
+				result[kk*F->n_cols+col] = GMT->session.d_NaN;
+				continue;
+			}
+			med = filter1d_slider_median (W);
+			result[kk*F->n_cols+col] = (F->highpass) ? F->data[col][k] - med : med;
+		}
+	}
+
+	for (i_col = 0; i_col < F->n_cols; ++i_col) gmt_M_free (GMT, slider[i_col].val);
+	gmt_M_free (GMT, slider);
+
+	data_sum = gmt_M_memory (GMT, NULL, F->n_cols, double);
+	Out = gmt_new_record (GMT, NULL, NULL);
+	Out->data = data_sum;
+
+	for (k = first_k; k <= last_k; ++k) {	/* Write the filtered records */
+		kk = k - first_k;
+		n_good_ones = 0;
+		for (i_col = 0; i_col < F->n_cols; ++i_col) {
+			if (i_col == F->t_col)
+				data_sum[i_col] = F->T.array[k];
+			else if (gmt_M_is_dnan (result[kk*F->n_cols+i_col]))
+				data_sum[i_col] = GMT->session.d_NaN;
+			else {
+				data_sum[i_col] = result[kk*F->n_cols+i_col];
+				++n_good_ones;
+			}
+		}
+		if (n_good_ones) GMT_Put_Record (C, GMT_WRITE_DATA, Out);
+	}
+
+	gmt_M_free (GMT, result);
+	gmt_M_free (GMT, data_sum);
+	gmt_M_free (GMT, Out);
+	gmt_M_free (GMT, F->T.array);
+
+	return (0);
+}
+
 GMT_LOCAL int filter1d_do_the_filter (struct GMTAPI_CTRL *C, struct FILTER1D_INFO *F) {
 	uint64_t i_row, left, right, n_l, n_r, k = 0, n_for_call, n_good_ones, last_k;
 	uint64_t iq, i_col, diff;
@@ -882,6 +1017,7 @@ GMT_LOCAL void filter1d_load_parameters (struct FILTER1D_INFO *F, struct FILTER1
 #define Return2(code) {Free_Ctrl (GMT, Ctrl); gmt_end_module (GMT, GMT_cpy); bailout (code);}
 
 EXTERN_MSC int GMT_filter1d (void *V_API, int mode, void *args) {
+	bool fast_median;
 	uint64_t col, tbl, row, seg, tseg;
 	int error;
 	unsigned int save_col[2], n_out_cols;
@@ -1051,6 +1187,9 @@ EXTERN_MSC int GMT_filter1d (void *V_API, int mode, void *args) {
 
 	GMT_Report (API, GMT_MSG_INFORMATION, "Filter the data columns\n");
 
+	/* Fixed-width median filtering with no window vetting can use the fast sliding-window path */
+	fast_median = (F.filter_type == FILTER1D_MEDIAN && !F.check_lack && !F.check_asym && !F.variable);
+
 	for (tbl = tseg = 0; tbl < D->n_tables; ++tbl) {	/* For each input table */
 		for (seg = 0; seg < D->table[tbl]->n_segments; ++seg, tseg++) {	/* For each segment */
 			/* Duplicate data and set up arrays and parameters needed to filter this segment */
@@ -1112,7 +1251,8 @@ EXTERN_MSC int GMT_filter1d (void *V_API, int mode, void *args) {
 
 			if (GMT->current.io.multi_segments[GMT_OUT]) GMT_Put_Record (API, GMT_WRITE_SEGMENT_HEADER, S->header);
 
-			if (filter1d_do_the_filter (API, &F)) {
+			error = (fast_median) ? filter1d_do_the_median_filter (API, &F) : filter1d_do_the_filter (API, &F);
+			if (error) {
 				filter1d_free_space (GMT, &F);
 				Return (GMT_RUNTIME_ERROR, "Fatal error in filtering routine.\n");
 			}
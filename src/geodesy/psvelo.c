@@ -225,54 +225,32 @@ GMT_LOCAL void psvelo_transform_local (double x0, double y0, double dxp, double
 
 }
 
-GMT_LOCAL void psvelo_trace_arrow (struct GMT_CTRL *GMT, double slon, double slat, double dxp, double dyp, double scale, double *x1, double *y1, double *x2, double *y2) {
+GMT_LOCAL void psvelo_trace_arrow (double x0, double y0, double dxp, double dyp, double scale, double t11, double t12, double t21, double t22, double *x1, double *y1, double *x2, double *y2) {
 	/* convert a vector arrow (delx,dely) arrow from (lat,lon) */
 
 	/* Kurt Feigl, from code by T. Herring */
 
 	/* INPUT */
-	/*   slat        - latitude, in degrees of arrow tail */
-	/*   slon        - longitude in degrees of arrow tail */
+	/*   x0,y0       - paper coordinates of arrow tail (from gmt_geo_to_xy) */
 	/*   dxp         - x component of arrow */
 	/*   dyp         - y component of arrow */
 	/*   scale       - scaling for arrow    */
+	/*   t11,t12,t21,t22 - local transformation matrix (from psvelo_get_trans) */
 
 	/* OUTPUT (returned) */
 	/*   x1,y1       - paper coordinates of arrow tail */
 	/*   x2,y2       - paper coordinates of arrow head */
 
-	/* local */
-	double t11, t12, t21, t22, xt, yt;
-
-	/* determine local transformation between (lon, lat) and (x, y) */
-	/* return this in the 2 x 2 matrix t */
-	psvelo_get_trans (GMT, slon, slat, &t11, &t12, &t21, &t22);
-
-	/* map start of arrow from lat, lon to x, y */
-	gmt_geo_to_xy (GMT, slon, slat, &xt, &yt);
+	/* The caller projects the station and builds the transformation once so
+	 * that several arrows at the same station share those map projections */
 
 	/* perform the transformation */
-	psvelo_transform_local (xt, yt, dxp, dyp, scale, t11, t12, t21, t22, x2, y2);
+	psvelo_transform_local (x0, y0, dxp, dyp, scale, t11, t12, t21, t22, x2, y2);
 
 	/* return values */
 
-	*x1 = xt;
-	*y1 = yt;
-}
-
-GMT_LOCAL void psvelo_trace_ellipse (double angle, double major, double minor, int npoints, double *x, double *y) {
-	/* Given specs for an ellipse, return it in x,y */
-	double phi = 0.0, sd, cd, s, c;
-	int i;
-
-	sincosd (angle, &sd, &cd);
-
-	for (i = 0; i < 360; i++) {
-		sincos (phi, &s, &c);
-		*x++ = major * c * cd - minor * s * sd;
-		*y++ = major * c * sd + minor * s * cd;
-		phi += M_PI*2.0/(npoints-2);
-	}
+	*x1 = x0;
+	*y1 = y0;
 }
 
 GMT_LOCAL void psvelo_ellipse_convert (double sigx, double sigy, double rho, double conrad, double *eigen1, double *eigen2, double *ang) {
@@ -327,14 +305,31 @@ GMT_LOCAL void psvelo_paint_ellipse (struct GMT_CTRL *GMT, double x0, double y0,
 #define NPOINTS_ELLIPSE 362
 
 	int npoints = NPOINTS_ELLIPSE, i;
-	/* relative to center of ellipse */
-	double dxe[NPOINTS_ELLIPSE],dye[NPOINTS_ELLIPSE];
+	double sd, cd, m11, m12, m21, m22;
 	/* absolute paper coordinates */
 	double axe[NPOINTS_ELLIPSE],aye[NPOINTS_ELLIPSE];
+	/* The unit circle sampled once; every ellipse is a 2x2 stamp of this shared outline */
+	static double ce[NPOINTS_ELLIPSE], se[NPOINTS_ELLIPSE];
+	static bool circle_ready = false;
+
+	if (!circle_ready) {	/* First ellipse samples the unit circle */
+		for (i = 0; i < npoints - 2; i++)
+			sincos (i * M_PI * 2.0 / (npoints - 2), &se[i], &ce[i]);
+		circle_ready = true;
+	}
 
-	psvelo_trace_ellipse (angle, major, minor, npoints, dxe, dye);
-
-	for (i = 0; i < npoints - 2; i++) psvelo_transform_local (x0, y0, dxe[i], dye[i], scale, t11, t12, t21, t22, &axe[i], &aye[i]);
+	/* Fold the rotation by angle, the axis lengths, the symbol scale, and the local
+	 * transformation t into one 2x2 matrix so each point costs four multiplies */
+	sincosd (angle, &sd, &cd);
+	m11 = scale * (t11 * cd + t12 * sd) * major;
+	m12 = scale * (t12 * cd - t11 * sd) * minor;
+	m21 = scale * (t21 * cd + t22 * sd) * major;
+	m22 = scale * (t22 * cd - t21 * sd) * minor;
+
+	for (i = 0; i < npoints - 2; i++) {
+		axe[i] = x0 + m11 * ce[i] + m12 * se[i];
+		aye[i] = y0 + m21 * ce[i] + m22 * se[i];
+	}
 	if (polygon) {
 		gmt_setfill (GMT, fill, outline);
 		PSL_plotpolygon (GMT->PSL, axe, aye, npoints - 2);
@@ -358,7 +353,7 @@ GMT_LOCAL int psvelo_trace_cross (struct GMT_CTRL *GMT, double slon, double slat
 	/*   v_width, h_length,h_width,vector_shape: arrow characteristics */
 
 	/* local */
-	double dx, dy, x1, x2, y1, y2, hl, hw, vw, s, c, dim[PSL_MAX_DIMS];
+	double dx, dy, x0, y0, x1, x2, y1, y2, hl, hw, vw, s, c, t11, t12, t21, t22, dim[PSL_MAX_DIMS];
 	gmt_M_unused(outline);
 
 	gmt_M_memset (dim, PSL_MAX_DIMS, double);
@@ -366,12 +361,16 @@ GMT_LOCAL int psvelo_trace_cross (struct GMT_CTRL *GMT, double slon, double slat
 	PSL_setfill (GMT->PSL, pen->rgb, 0);	/* Same color for arrow head fill with no outline */
 	sincosd (theta, &s, &c);
 
+	/* Project the station and get the local transformation once for all four arrows */
+	psvelo_get_trans (GMT, slon, slat, &t11, &t12, &t21, &t22);
+	gmt_geo_to_xy (GMT, slon, slat, &x0, &y0);
+
 	/*  extension component */
 	dx =  eps1 * c;
 	dy = -eps1 * s;
 
 	/* arrow is outward from slat,slon */
-	psvelo_trace_arrow (GMT, slon, slat, dx, dy, sscale, &x1, &y1, &x2, &y2);
+	psvelo_trace_arrow (x0, y0, dx, dy, sscale, t11, t12, t21, t22, &x1, &y1, &x2, &y2);
 
 	if (eps1 < 0.0) {
 		gmt_M_double_swap (x1, x2);
@@ -400,7 +399,7 @@ GMT_LOCAL int psvelo_trace_cross (struct GMT_CTRL *GMT, double slon, double slat
 
 	/* second, extensional arrow in opposite direction */
 
-	psvelo_trace_arrow (GMT, slon, slat, -dx, -dy, sscale, &x1, &y1, &x2, &y2);
+	psvelo_trace_arrow (x0, y0, -dx, -dy, sscale, t11, t12, t21, t22, &x1, &y1, &x2, &y2);
 
 	if (eps1 < 0.0) {
 		gmt_M_double_swap (x1, x2);
@@ -430,7 +429,7 @@ GMT_LOCAL int psvelo_trace_cross (struct GMT_CTRL *GMT, double slon, double slat
 	dx = eps2 * s;
 	dy = eps2 * c;
 	dim[PSL_VEC_STATUS] = PSL_VEC_BEGIN | PSL_VEC_FILL;
-	psvelo_trace_arrow (GMT, slon, slat, dx, dy, sscale, &x1, &y1, &x2, &y2);
+	psvelo_trace_arrow (x0, y0, dx, dy, sscale, t11, t12, t21, t22, &x1, &y1, &x2, &y2);
 
 	if (eps2 > 0.0) {
 		gmt_M_double_swap (x1, x2);
@@ -459,7 +458,7 @@ GMT_LOCAL int psvelo_trace_cross (struct GMT_CTRL *GMT, double slon, double slat
 
 	/* second, compressional arrow in opposite direction */
 
-	psvelo_trace_arrow (GMT, slon, slat, -dx, -dy, sscale, &x1, &y1, &x2, &y2);
+	psvelo_trace_arrow (x0, y0, -dx, -dy, sscale, t11, t12, t21, t22, &x1, &y1, &x2, &y2);
 
 	if (eps2 > 0.0) {
 		gmt_M_double_swap (x1, x2);
@@ -1250,8 +1249,8 @@ EXTERN_MSC int GMT_psvelo (void *V_API, int mode, void *args) {
 		switch (Ctrl->S.symbol) {
 			case CINE:
 				plot_vector = (hypot (vxy[0], vxy[1]) < 1.e-8) ? false : true;
-				psvelo_trace_arrow (GMT, in[GMT_X], in[GMT_Y], vxy[0], vxy[1], size, &plot_x, &plot_y, &plot_vx, &plot_vy);
 				psvelo_get_trans (GMT, in[GMT_X], in[GMT_Y], &t11, &t12, &t21, &t22);
+				psvelo_trace_arrow (plot_x, plot_y, vxy[0], vxy[1], size, t11, t12, t21, t22, &plot_x, &plot_y, &plot_vx, &plot_vy);
 				if (plot_ellipse) {	/* Optionally fill [-E] and optionally outline [-L] the error ellipse */
 					if (Ctrl->L.active) {	/* Draw ellipse outline */
 						current_pen = Ctrl->L.pen;
@@ -1329,7 +1328,8 @@ EXTERN_MSC int GMT_psvelo (void *V_API, int mode, void *args) {
 				}
 				break;
 			case ANISO:
-				psvelo_trace_arrow (GMT, in[GMT_X], in[GMT_Y], vxy[0], vxy[1], size, &plot_x, &plot_y, &plot_vx, &plot_vy);
+				psvelo_get_trans (GMT, in[GMT_X], in[GMT_Y], &t11, &t12, &t21, &t22);
+				psvelo_trace_arrow (plot_x, plot_y, vxy[0], vxy[1], size, t11, t12, t21, t22, &plot_x, &plot_y, &plot_vx, &plot_vy);
 				current_pen = Ctrl->W.pen;
 				if (Ctrl->H.active) {
 					double scl = (Ctrl->H.mode == PSVELO_READ_SCALE) ? in[xcol] : Ctrl->H.value;
@@ -1350,7 +1350,6 @@ EXTERN_MSC int GMT_psvelo (void *V_API, int mode, void *args) {
 				break;
 			case WEDGE:
 				PSL_comment (PSL, "begin wedge number %li", n_rec);
-				gmt_geo_to_xy (GMT, in[GMT_X], in[GMT_Y], &plot_x, &plot_y);
 				psvelo_get_trans (GMT, in[GMT_X], in[GMT_Y], &t11, &t12, &t21, &t22);
 				psvelo_paint_wedge (PSL, plot_x, plot_y, spin, spinsig, size, Ctrl->S.wedge_amp, t11, t12, t21, t22,
 					set_g_fill, Ctrl->G.fill.rgb, set_e_fill, Ctrl->E.fill.rgb, Ctrl->L.active);
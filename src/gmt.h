@@ -62,7 +62,7 @@ extern "C" {
  *=====================================================================================
  */
 
-/* 34 Primary API functions */
+/* 35 Primary API functions */
 EXTERN_MSC void * GMT_Create_Session   (const char *tag, unsigned int pad, unsigned int mode, int (*print_func) (FILE *, const char *));
 EXTERN_MSC void * GMT_Create_Data      (void *API, unsigned int family, unsigned int geometry, unsigned int mode, uint64_t dim[],
                                            double *wesn, double *inc, unsigned int registration, int pad, void *data);
@@ -71,6 +71,7 @@ EXTERN_MSC void * GMT_Read_Data        (void *API, unsigned int family, unsigned
 EXTERN_MSC void * GMT_Duplicate_Data   (void *API, unsigned int family, unsigned int mode, void *data);
 EXTERN_MSC void * GMT_Get_Record       (void *API, unsigned int mode, int *retval);
 EXTERN_MSC int GMT_Destroy_Session     (void *API);
+EXTERN_MSC int GMT_Reset_Session       (void *API);
 EXTERN_MSC int GMT_Register_IO         (void *API, unsigned int family, unsigned int method, unsigned int geometry,
                                            unsigned int direction, double wesn[], void *resource);
 EXTERN_MSC int GMT_Init_IO             (void *API, unsigned int family, unsigned int geometry, unsigned int direction,
@@ -109,6 +110,9 @@ EXTERN_MSC int GMT_Put_Strings         (void *API, unsigned int family, void *ob
 EXTERN_MSC char ** GMT_Get_Strings     (void *API, unsigned int family, void *object);
 /* This function is new in 6.2 and is being considered beta */
 EXTERN_MSC int GMT_Put_Levels          (void *API, struct GMT_CUBE *C, double *levels, uint64_t n_levels);
+/* These 2 functions move many data records per call and are being considered beta */
+EXTERN_MSC int64_t GMT_Get_Record_Batch (void *API, unsigned int mode, int64_t n_max, double *data);
+EXTERN_MSC int64_t GMT_Put_Record_Batch (void *API, unsigned int mode, int64_t n_records, double *data);
 
 /* 5 functions to relate (row,col) to a 1-D index for grids, cubes and images and to precompute equidistant coordinates for grids and images */
 
@@ -138,6 +142,11 @@ EXTERN_MSC int GMT_Handle_Messages     (void *API, unsigned int mode, unsigned i
 
 EXTERN_MSC int GMT_Call_Module	       (void *API, const char *module, int mode, void *args);
 
+/* 2 functions for embedders to monitor or cancel a module running in another thread */
+
+EXTERN_MSC int GMT_Cancel_Module       (void *API);
+EXTERN_MSC double GMT_Get_Progress     (void *API);
+
 /* 16 secondary functions for argument and option parsing */
 
 EXTERN_MSC struct GMT_OPTION * GMT_Create_Options    (void *API, int argc, const void *in);
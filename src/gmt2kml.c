@@ -632,6 +632,32 @@ GMT_LOCAL void gmt2kml_ascii_output_three (struct GMTAPI_CTRL *API, struct GMT_R
 	gmt2kml_print (API, Out, ntabs, "%s,%s,%s", X, Y, Z);
 }
 
+GMT_LOCAL size_t gmt2kml_coord_batch (struct GMTAPI_CTRL *API, struct GMT_RECORD *Out, double out[], int ntabs, char *batch, size_t len) {
+	/* Append one lon,lat,z tuple to the batch buffer and return the new buffer length.
+	 * When the buffer cannot hold another tuple we first emit it as a single record;
+	 * a call with out == NULL flushes whatever remains at the end of a coordinate block.
+	 * KML accepts any number of whitespace-separated tuples inside <coordinates>, so
+	 * batching ~100 vertices per record sidesteps the per-vertex GMT_Put_Record cost
+	 * that dominates the export of large lines and polygons. */
+	size_t need;
+	char X[GMT_LEN256] = {""}, Y[GMT_LEN256] = {""}, Z[GMT_LEN256] = {""};
+	if (out == NULL) {	/* Flush the final partial record for this coordinate block */
+		if (len) gmt2kml_print (API, Out, ntabs, "%s", batch);
+		return (0);
+	}
+	gmt_ascii_format_col (API->GMT, X, out[GMT_X], GMT_OUT, GMT_X);
+	gmt_ascii_format_col (API->GMT, Y, out[GMT_Y], GMT_OUT, GMT_Y);
+	gmt_ascii_format_col (API->GMT, Z, out[GMT_Z], GMT_OUT, GMT_Z);
+	need = strlen (X) + strlen (Y) + strlen (Z) + 3;	/* Two commas plus a leading space when appending */
+	if (len && (len + need + (size_t)ntabs) >= GMT_BUFSIZ) {	/* Full record assembled - write it out */
+		gmt2kml_print (API, Out, ntabs, "%s", batch);
+		len = 0;
+	}
+	if (len) batch[len++] = ' ';	/* Tuple separator within the record */
+	len += sprintf (&batch[len], "%s,%s,%s", X, Y, Z);
+	return (len);
+}
+
 GMT_LOCAL void gmt2kml_place_region_tag (struct GMTAPI_CTRL *API, struct GMT_RECORD *Out, double wesn[], double min[], double max[], int N) {
 	char text[GMT_LEN256] = {""};
 	if (gmt_M_360_range (wesn[XLO], wesn[XHI])) { wesn[XLO] = -180.0; wesn[XHI] = +180.0;}
@@ -745,6 +771,8 @@ GMT_LOCAL void gmt2kml_plot_object (struct GMTAPI_CTRL *API, struct GMT_RECORD *
 	static char *feature[5] = {"Point", "Point", "Point", "LineString", "Polygon"};
 	double out[3];
 	uint64_t k;
+	size_t clen = 0;
+	char batch[GMT_BUFSIZ] = {""};
 	gmt2kml_print (API, Out, N++, "<Placemark>");
 	gmt2kml_print (API, Out, N, "<name>%s</name>", name[type-LINE]);
 	gmt2kml_print (API, Out, N, "<styleUrl>#st-%d-%d</styleUrl>", process_id, 0); /* It is always style 0 */
@@ -759,8 +787,9 @@ GMT_LOCAL void gmt2kml_plot_object (struct GMTAPI_CTRL *API, struct GMT_RECORD *
 	for (k = 0; k < np; k++) {
 		out[GMT_X] = x[k];
 		out[GMT_Y] = y[k];
-		gmt2kml_ascii_output_three (API, Out, out, N);
+		clen = gmt2kml_coord_batch (API, Out, out, N, batch, clen);
 	}
+	(void) gmt2kml_coord_batch (API, Out, NULL, N, batch, clen);	/* Flush last batch of tuples */
 	gmt2kml_print (API, Out, --N, "</coordinates>");
 	if (type == POLYGON) {
 		gmt2kml_print (API, Out, --N, "</LinearRing>");
@@ -836,13 +865,13 @@ EXTERN_MSC int GMT_gmt2kml (void *V_API, int mode, void *args) {
 	unsigned int n_coord = 0, t1_col, t2_col, pnt_nr = 0, tbl;
 
 	uint64_t row, seg, n_tables, n_segments, n_rows;
-	size_t L = 0;
+	size_t L = 0, clen = 0;
 	int set_nr = 0, index, N = 1, error = 0, process_id;
 
 	char buffer[GMT_BUFSIZ] = {""}, description[GMT_BUFSIZ] = {""}, item[GMT_LEN128] = {""};
 	char *feature[5] = {"Point", "Point", "Point", "LineString", "Polygon"}, *Document[2] = {"Document", "Folder"};
 	char *name[5] = {"Point", "Event", "Timespan", "Line", "Polygon"};
-	char text[GMT_LEN256] = {""}, record[GMT_BUFSIZ] = {""};
+	char text[GMT_LEN256] = {""}, record[GMT_BUFSIZ] = {""}, batch[GMT_BUFSIZ] = {""};
 	char **file = NULL, *label = NULL, *header = NULL;
 
 	double rgb[4], out[5], last_x = 0, z_val;
@@ -1287,7 +1316,7 @@ EXTERN_MSC int GMT_gmt2kml (void *V_API, int mode, void *args) {
 					}
 					else {	/* For lines and polygons we just output the coordinates */
 						if (gmt_M_is_dnan (out[GMT_Z])) out[GMT_Z] = 0.0;	/* Google Earth can not handle lines at NaN altitude */
-						gmt2kml_ascii_output_three (API, Out, out, N);
+						clen = gmt2kml_coord_batch (API, Out, out, N, batch, clen);
 						if (row > 0 && no_dateline && gmt2kml_crossed_dateline (out[GMT_X], last_x)) {
 							/* GE cannot handle polygons crossing the dateline; warn for now */
 							GMT_Report (API, GMT_MSG_WARNING,
@@ -1308,6 +1337,7 @@ EXTERN_MSC int GMT_gmt2kml (void *V_API, int mode, void *args) {
 			else if (Ctrl->F.mode < LINE)
 				gmt2kml_print (API, Out, --N, "</Folder>");
 			else {
+				clen = gmt2kml_coord_batch (API, Out, NULL, N, batch, clen);	/* Flush last batch of tuples */
 				gmt2kml_print (API, Out, --N, "</coordinates>");
 				if (Ctrl->F.mode == POLYGON) {
 					gmt2kml_print (API, Out, --N, "</LinearRing>");
@@ -0,0 +1,433 @@
+/*--------------------------------------------------------------------
+ *
+ *	Copyright (c) 1991-2024 by the GMT Team (https://www.generic-mapping-tools.org/team.html)
+ *	See LICENSE.TXT file for copying and redistribution conditions.
+ *
+ *	This program is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation; version 3 or any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	Contact info: www.generic-mapping-tools.org
+ *--------------------------------------------------------------------*/
+/*
+ * API functions to support the gmt2tiles application.
+ *
+ * Brief synopsis: gmt2tiles renders a web map tile pyramid in the common
+ * XYZ (slippy map) scheme directly from a single grid.  The grid stays
+ * resident for the whole run and is coarsened in powers of two as the
+ * zoom level drops, each tile is colorized (and optionally illuminated)
+ * straight into a PNG raster without going via PostScript, and the tiles
+ * of a zoom level are rendered in parallel.  This replaces scripting one
+ * grdimage + psconvert session per tile, where session setup and grid
+ * re-reads dominate the run time.
+ */
+
+#include "gmt_dev.h"
+#include "longopt/gmt2tiles_inc.h"
+
+#define THIS_MODULE_CLASSIC_NAME	"gmt2tiles"
+#define THIS_MODULE_MODERN_NAME	"gmt2tiles"
+#define THIS_MODULE_LIB		"core"
+#define THIS_MODULE_PURPOSE	"Render a web map (XYZ) tile pyramid directly from a grid"
+#define THIS_MODULE_KEYS	"<G{,CC(,IG("
+#define THIS_MODULE_NEEDS	""
+#define THIS_MODULE_OPTIONS "-Vfn"
+
+#define GMT2TILES_TILE_SIZE	256	/* Standard web map tile dimension in pixels */
+#define GMT2TILES_MAX_LAT	85.05112877980659	/* atan(sinh(pi)); the Web Mercator latitude limit */
+#define GMT2TILES_MAX_ZOOM	24	/* Deeper pyramids than this are surely a mistake */
+#define GMT2TILES_MIN_DIM	16	/* Do not coarsen the resident grid below this many rows or columns */
+
+struct GMT2TILES_CTRL {
+	struct GMT2TILES_In {
+		bool active;
+		char *file;
+	} In;
+	struct GMT2TILES_C {	/* -C<cpt> or -C<color1>,<color2>[,<color3>,...][+i<dz>] */
+		bool active;
+		double dz;
+		char *file;
+	} C;
+	struct GMT2TILES_D {	/* -D<directory> */
+		bool active;
+		char *dir;
+	} D;
+	struct GMT2TILES_I {	/* -I<intensgrid>|<value> */
+		bool active;
+		bool constant;
+		double value;
+		char *file;
+	} I;
+	struct GMT2TILES_Z {	/* -Z<minzoom>[/<maxzoom>] */
+		bool active;
+		unsigned int min, max;
+	} Z;
+};
+
+static void *New_Ctrl (struct GMT_CTRL *GMT) {	/* Allocate and initialize a new control structure */
+	struct GMT2TILES_CTRL *C;
+
+	C = gmt_M_memory (GMT, NULL, 1, struct GMT2TILES_CTRL);
+
+	/* Initialize values whose defaults are not 0/false/NULL */
+	C->D.dir = strdup (".");
+	return (C);
+}
+
+static void Free_Ctrl (struct GMT_CTRL *GMT, struct GMT2TILES_CTRL *C) {	/* Deallocate control structure */
+	if (!C) return;
+	gmt_M_str_free (C->In.file);
+	gmt_M_str_free (C->C.file);
+	gmt_M_str_free (C->D.dir);
+	gmt_M_str_free (C->I.file);
+	gmt_M_free (GMT, C);
+}
+
+static int usage (struct GMTAPI_CTRL *API, int level) {
+	const char *name = gmt_show_name_and_purpose (API, THIS_MODULE_LIB, THIS_MODULE_CLASSIC_NAME, THIS_MODULE_PURPOSE);
+	if (level == GMT_MODULE_PURPOSE) return (GMT_NOERROR);
+	GMT_Usage (API, 0, "usage: %s %s -Z<minzoom>[/<maxzoom>] [-C<cpt>] [-D<directory>] [-I<intensgrid>|<value>] "
+		"[%s] [%s] [%s] [%s]\n", name, GMT_INGRID, GMT_V_OPT, GMT_f_OPT, GMT_n_OPT, GMT_PAR_OPT);
+
+	if (level == GMT_SYNOPSIS) return (GMT_MODULE_SYNOPSIS);
+
+	GMT_Message (API, GMT_TIME_NONE, "  REQUIRED ARGUMENTS:\n");
+	gmt_ingrid_syntax (API, 0, "Name of geographic grid to be rendered as web map tiles");
+	GMT_Usage (API, 1, "\n-Z<minzoom>[/<maxzoom>]");
+	GMT_Usage (API, -2, "Range of web map zoom levels to render [<maxzoom> defaults to <minzoom>].");
+	GMT_Message (API, GMT_TIME_NONE, "\n  OPTIONAL ARGUMENTS:\n");
+	GMT_Usage (API, 1, "\n-C<cpt>");
+	GMT_Usage (API, -2, "Color palette table to convert grid values to colors [Default uses the "
+		"current or default CPT stretched to the grid range].");
+	GMT_Usage (API, 1, "\n-D<directory>");
+	GMT_Usage (API, -2, "Top directory for the tile tree; tiles are written as "
+		"<directory>/<zoom>/<x>/<y>.png [current directory].");
+	GMT_Usage (API, 1, "\n-I<intensgrid>|<value>");
+	GMT_Usage (API, -2, "Apply illumination from an intensity grid covering the same region as the "
+		"input grid, or give a constant intensity (e.g., made with grdgradient).");
+	GMT_Option (API, "V,f,n,.");
+
+	return (GMT_MODULE_USAGE);
+}
+
+static int parse (struct GMT_CTRL *GMT, struct GMT2TILES_CTRL *Ctrl, struct GMT_OPTION *options) {
+
+	/* This parses the options provided to gmt2tiles and sets parameters in CTRL.
+	 * Any GMT common options will override values set previously by other commands.
+	 */
+
+	unsigned int n_errors = 0;
+	int n;
+	struct GMT_OPTION *opt = NULL;
+	struct GMTAPI_CTRL *API = GMT->parent;
+
+	for (opt = options; opt; opt = opt->next) {
+		switch (opt->option) {
+
+			case '<':	/* Input file */
+				n_errors += gmt_M_repeated_module_option (API, Ctrl->In.active);
+				n_errors += gmt_get_required_file (GMT, opt->arg, opt->option, 0, GMT_IS_GRID, GMT_IN, GMT_FILE_REMOTE, &(Ctrl->In.file));
+				break;
+
+			/* Processes program-specific parameters */
+
+			case 'C':	/* CPT */
+				n_errors += gmt_M_repeated_module_option (API, Ctrl->C.active);
+				gmt_M_str_free (Ctrl->C.file);
+				if (opt->arg[0]) Ctrl->C.file = strdup (opt->arg);
+				gmt_cpt_interval_modifier (GMT, &(Ctrl->C.file), &(Ctrl->C.dz));
+				break;
+			case 'D':	/* Output directory */
+				n_errors += gmt_M_repeated_module_option (API, Ctrl->D.active);
+				if (opt->arg[0]) {
+					gmt_M_str_free (Ctrl->D.dir);
+					Ctrl->D.dir = strdup (opt->arg);
+				}
+				break;
+			case 'I':	/* Intensity grid or constant */
+				n_errors += gmt_M_repeated_module_option (API, Ctrl->I.active);
+				if (!gmt_access (GMT, opt->arg, R_OK) || gmt_M_file_is_remote (opt->arg))	/* Got a grid file */
+					Ctrl->I.file = strdup (opt->arg);
+				else if (opt->arg[0] && !gmt_not_numeric (GMT, opt->arg)) {	/* Looks like a constant value */
+					Ctrl->I.value = atof (opt->arg);
+					Ctrl->I.constant = true;
+				}
+				else {
+					GMT_Report (API, GMT_MSG_ERROR, "Option -I: Requires a readable intensity grid or a constant intensity\n");
+					n_errors++;
+				}
+				break;
+			case 'Z':	/* Zoom range */
+				n_errors += gmt_M_repeated_module_option (API, Ctrl->Z.active);
+				if ((n = sscanf (opt->arg, "%u/%u", &Ctrl->Z.min, &Ctrl->Z.max)) < 1) {
+					GMT_Report (API, GMT_MSG_ERROR, "Option -Z: Cannot parse zoom range %s\n", opt->arg);
+					n_errors++;
+				}
+				else if (n == 1)	/* Single zoom level */
+					Ctrl->Z.max = Ctrl->Z.min;
+				break;
+
+			default:	/* Report bad options */
+				n_errors += gmt_default_option_error (GMT, opt);
+				break;
+		}
+	}
+
+	n_errors += gmt_M_check_condition (GMT, !Ctrl->In.active, "Must specify a single input grid file\n");
+	n_errors += gmt_M_check_condition (GMT, !Ctrl->Z.active, "Option -Z is required\n");
+	n_errors += gmt_M_check_condition (GMT, Ctrl->Z.active && Ctrl->Z.min > Ctrl->Z.max,
+	                                   "Option -Z: <minzoom> cannot exceed <maxzoom>\n");
+	n_errors += gmt_M_check_condition (GMT, Ctrl->Z.active && Ctrl->Z.max > GMT2TILES_MAX_ZOOM,
+	                                   "Option -Z: <maxzoom> cannot exceed %d\n", GMT2TILES_MAX_ZOOM);
+	return (n_errors ? GMT_PARSE_ERROR : GMT_NOERROR);
+}
+
+GMT_LOCAL double gmt2tiles_lat_to_ty (double lat, uint64_t n_tiles) {
+	/* Return the fractional Web Mercator tile row for this latitude at a zoom with n_tiles rows */
+	double m = log (tand (45.0 + 0.5 * lat));
+	return ((1.0 - m / M_PI) * 0.5 * (double)n_tiles);
+}
+
+GMT_LOCAL bool gmt2tiles_render_tile (struct GMT_CTRL *GMT, struct GMT_GRID *G, struct GMT_GRID *Intens, struct GMT2TILES_CTRL *Ctrl,
+	struct GMT_PALETTE *P, struct GMT_GRID_HEADER *H, unsigned int zoom, unsigned int tx, unsigned int ty,
+	double *lon, int *gcol, double *gwx, int *icol, double *iwx, gmt_grdfloat *z, gmt_grdfloat *zi, unsigned char *image) {
+	/* Render one tile (tx, ty) at this zoom into the pixel-interleaved (TRP) byte buffer image,
+	 * whose layout matches the reusable GMT_IMAGE container with header H.  The caller supplies the
+	 * per-thread scratch arrays for the interpolation stencils and sample rows.  Returns true
+	 * if any grid node contributed, so fully empty (all-NaN) tiles can be skipped on output. */
+	unsigned int px, py, band, ts = H->n_columns;
+	bool has_data = false;
+	uint64_t node, pix, n_pix = (uint64_t)(1ULL << zoom) * ts;	/* Pixels around the globe at this zoom */
+	double x, lat, yn, rgb[4] = {0.0, 0.0, 0.0, 0.0}, pix_deg = 360.0 / (double)n_pix;
+
+	for (px = 0; px < ts; px++) {	/* Pixel center longitudes, wrapped into the grid's longitude domain if possible */
+		x = -180.0 + ((double)((uint64_t)tx * ts + px) + 0.5) * pix_deg;
+		if (x < G->header->wesn[XLO] && x + 360.0 <= G->header->wesn[XHI] + GMT_CONV4_LIMIT)
+			x += 360.0;
+		else if (x > G->header->wesn[XHI] && x - 360.0 >= G->header->wesn[XLO] - GMT_CONV4_LIMIT)
+			x -= 360.0;
+		lon[px] = x;
+	}
+	gmt_bcr_prep_cols (GMT, G, lon, ts, gcol, gwx);	/* The x-stencils serve every pixel row in the tile */
+	if (Intens) gmt_bcr_prep_cols (GMT, Intens, lon, ts, icol, iwx);
+
+	for (py = 0; py < ts; py++) {
+		yn = 1.0 - 2.0 * ((double)((uint64_t)ty * ts + py) + 0.5) / (double)n_pix;
+		lat = atand (sinh (M_PI * yn));	/* Inverse Web Mercator for this pixel row */
+		gmt_bcr_get_z_row (GMT, G, lat, ts, gcol, gwx, z);
+		if (Intens) gmt_bcr_get_z_row (GMT, Intens, lat, ts, icol, iwx, zi);
+		for (px = 0; px < ts; px++) {
+			if (!gmt_M_is_fnan (z[px])) has_data = true;
+			(void)gmt_get_rgb_from_z (GMT, P, z[px], rgb);
+			if (Ctrl->I.constant)
+				gmt_illuminate (GMT, Ctrl->I.value, rgb);
+			else if (Intens && !gmt_M_is_fnan (zi[px]))
+				gmt_illuminate (GMT, zi[px], rgb);
+			node = gmt_M_ijp (H, py, px);
+			for (band = 0, pix = 3 * node; band < 3; band++, pix++)	/* March across the interleaved RGB values */
+				image[pix] = gmt_M_u255 (rgb[band]);
+		}
+	}
+	return (has_data);
+}
+
+#define bailout(code) {gmt_M_free_options (mode); return (code);}
+#define Return(code) {Free_Ctrl (GMT, Ctrl); gmt_end_module (GMT, GMT_cpy); bailout (code);}
+
+EXTERN_MSC int GMT_gmt2tiles (void *V_API, int mode, void *args) {
+	int error = 0, zoom, thread = 0, n_threads = 1, *gcol = NULL, *icol = NULL;
+	openmp_int b;
+	unsigned int ts = GMT2TILES_TILE_SIZE, tx, ty, tx0, tx1, ty0, ty1, n_batch;
+	uint64_t n_tiles, n_written = 0, n_skipped = 0, dim[3] = {0, 0, 3};
+	bool *has_data = NULL;
+	char file[PATH_MAX] = {""}, mem_layout[5] = {""};
+	double w, e, south, north, pix_deg, img_wesn[4] = {0.0, GMT2TILES_TILE_SIZE, 0.0, GMT2TILES_TILE_SIZE};
+	double img_inc[2] = {1.0, 1.0}, *lon = NULL, *gwx = NULL, *iwx = NULL;
+	gmt_grdfloat *z = NULL, *zi = NULL;
+	unsigned char **buffer = NULL;
+
+	struct GMT2TILES_CTRL *Ctrl = NULL;
+	struct GMT_GRID *G = NULL, *Coarse = NULL, *Intens = NULL;
+	struct GMT_IMAGE *I = NULL;
+	struct GMT_GRID_HEADER *H = NULL;
+	struct GMT_PALETTE *P = NULL;
+	struct GMT_CTRL *GMT = NULL, *GMT_cpy = NULL;
+	struct GMT_OPTION *options = NULL;
+	struct GMTAPI_CTRL *API = gmt_get_api_ptr (V_API);	/* Cast from void to GMTAPI_CTRL pointer */
+
+	/*----------------------- Standard module initialization and parsing ----------------------*/
+
+	if (API == NULL) return (GMT_NOT_A_SESSION);
+	if (mode == GMT_MODULE_PURPOSE) return (usage (API, GMT_MODULE_PURPOSE));	/* Return the purpose of program */
+	options = GMT_Create_Options (API, mode, args);	if (API->error) return (API->error);	/* Set or get option list */
+
+	if ((error = gmt_report_usage (API, options, 0, usage)) != GMT_NOERROR) bailout (error);	/* Give usage if requested */
+
+	/* Parse the command-line arguments */
+
+	if ((GMT = gmt_init_module (API, THIS_MODULE_LIB, THIS_MODULE_CLASSIC_NAME, THIS_MODULE_KEYS, THIS_MODULE_NEEDS, module_kw, &options, &GMT_cpy)) == NULL) bailout (API->error); /* Save current state */
+	if (GMT_Parse_Common (API, THIS_MODULE_OPTIONS, options)) Return (API->error);
+	Ctrl = New_Ctrl (GMT);	/* Allocate and initialize a new control structure */
+	if ((error = parse (GMT, Ctrl, options)) != 0) Return (error);
+
+	/*---------------------------- This is the gmt2tiles main code ----------------------------*/
+
+	gmt_set_geographic (GMT, GMT_IN);	/* Web map tiles imply a geographic grid */
+
+	GMT_Report (API, GMT_MSG_INFORMATION, "Processing input grid\n");
+	if ((G = GMT_Read_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_CONTAINER_AND_DATA, NULL, Ctrl->In.file, NULL)) == NULL) {
+		Return (API->error);
+	}
+
+	if ((P = gmt_get_palette (GMT, Ctrl->C.file, GMT_CPT_OPTIONAL, G->header->z_min, G->header->z_max, Ctrl->C.dz)) == NULL) {
+		Return (API->error);
+	}
+	gmt_cpt_prep_index (GMT, P);	/* Build the quantized CPT index serially since the batch render loop looks up colors in parallel */
+
+	if (Ctrl->I.file) {	/* Read the intensity grid; it is sampled at its own resolution so only the region must match */
+		if ((Intens = GMT_Read_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_CONTAINER_AND_DATA, NULL, Ctrl->I.file, NULL)) == NULL) {
+			Return (API->error);
+		}
+		if (!gmt_M_grd_same_region (GMT, G, Intens)) {
+			GMT_Report (API, GMT_MSG_ERROR, "Intensity grid must cover the same region as the input grid\n");
+			Return (GMT_RUNTIME_ERROR);
+		}
+	}
+
+#ifdef _OPENMP
+	n_threads = omp_get_max_threads ();	/* Tiles are rendered in parallel, each thread with its own scratch space */
+#endif
+
+	/* Create the reusable tile image container; each tile is a plain pixel raster whose
+	 * location is encoded by its <zoom>/<x>/<y> path, so a dummy Cartesian header will do.
+	 * The tiles are exported via GDAL, which only accepts the TCB and TRP/BRP memory layouts,
+	 * so create (and fill) the image pixel-interleaved */
+	if (GMT->current.gdal_read_in.O.mem_layout[0])
+		strcpy (mem_layout, GMT->current.gdal_read_in.O.mem_layout);	/* Backup current layout */
+	else
+		gmt_strncpy (mem_layout, "TRPa", 4);
+	GMT_Set_Default (API, "API_IMAGE_LAYOUT", "TRPa");
+	if ((I = GMT_Create_Data (API, GMT_IS_IMAGE, GMT_IS_SURFACE, GMT_CONTAINER_AND_DATA, dim, img_wesn, img_inc, GMT_GRID_PIXEL_REG, 0, NULL)) == NULL) {
+		Return (API->error);
+	}
+	GMT_Set_Default (API, "API_IMAGE_LAYOUT", mem_layout);		/* Reset to previous memory layout */
+	H = I->header;
+
+	/* Per-thread scratch for interpolation stencils and sampled rows, plus a batch of tile buffers
+	 * so rendering runs in parallel while the tiles are written sequentially through the API */
+
+	lon  = gmt_M_memory (GMT, NULL, (size_t)n_threads * ts, double);
+	gcol = gmt_M_memory (GMT, NULL, (size_t)n_threads * ts, int);
+	gwx  = gmt_M_memory (GMT, NULL, (size_t)n_threads * 4 * ts, double);
+	z    = gmt_M_memory (GMT, NULL, (size_t)n_threads * ts, gmt_grdfloat);
+	if (Intens) {
+		icol = gmt_M_memory (GMT, NULL, (size_t)n_threads * ts, int);
+		iwx  = gmt_M_memory (GMT, NULL, (size_t)n_threads * 4 * ts, double);
+		zi   = gmt_M_memory (GMT, NULL, (size_t)n_threads * ts, gmt_grdfloat);
+	}
+	n_batch = MAX (4 * n_threads, 8);	/* Tiles rendered per parallel pass */
+	buffer = gmt_M_memory (GMT, NULL, n_batch, unsigned char *);
+	for (b = 0; b < (openmp_int)n_batch; b++) buffer[b] = gmt_M_memory (GMT, NULL, H->size * 3, unsigned char);
+	has_data = gmt_M_memory (GMT, NULL, n_batch, bool);
+
+	north = MIN (G->header->wesn[YHI], GMT2TILES_MAX_LAT);	/* Web Mercator cannot go beyond +/- 85.05 degrees */
+	south = MAX (G->header->wesn[YLO], -GMT2TILES_MAX_LAT);
+	if (south >= north) {
+		GMT_Report (API, GMT_MSG_ERROR, "Grid has no latitudes inside the Web Mercator domain\n");
+		Return (GMT_RUNTIME_ERROR);
+	}
+
+	for (zoom = (int)Ctrl->Z.max; zoom >= (int)Ctrl->Z.min; zoom--) {	/* Render from finest to coarsest so the resident grid only ever shrinks */
+		n_tiles = (uint64_t)1ULL << zoom;
+		pix_deg = 360.0 / (double)(n_tiles * ts);
+
+		/* Coarsen the resident grid while it is still at least twice as fine as a tile pixel */
+		while (2.0 * G->header->inc[GMT_X] <= pix_deg && (G->header->n_columns + 1) / 2 >= GMT2TILES_MIN_DIM &&
+			(G->header->n_rows + 1) / 2 >= GMT2TILES_MIN_DIM && (Coarse = gmt_grd_halve (GMT, G)) != NULL) {
+			if (GMT_Destroy_Data (API, &G) != GMT_NOERROR) {	/* Done with the finer level */
+				Return (API->error);
+			}
+			G = Coarse;	Coarse = NULL;
+		}
+
+		/* Determine the range of tiles that can receive data from the grid region */
+
+		ty0 = (unsigned int)MAX (0.0, floor (gmt2tiles_lat_to_ty (north, n_tiles)));
+		ty1 = (unsigned int)MIN ((double)(n_tiles - 1), floor (gmt2tiles_lat_to_ty (south, n_tiles)));
+		w = G->header->wesn[XLO];	e = G->header->wesn[XHI];
+		if (e - w >= 360.0 - GMT_CONV4_LIMIT) {	/* Global grid: all tile columns */
+			tx0 = 0;	tx1 = (unsigned int)(n_tiles - 1);
+		}
+		else {
+			while (w > 180.0) w -= 360.0, e -= 360.0;	/* Normalize into the -180/+180 tile domain */
+			while (w < -180.0) w += 360.0, e += 360.0;
+			if (e > 180.0) {	/* Crosses the dateline; render all columns and let the empty ones drop out */
+				tx0 = 0;	tx1 = (unsigned int)(n_tiles - 1);
+			}
+			else {
+				tx0 = (unsigned int)MAX (0.0, floor ((w + 180.0) / 360.0 * (double)n_tiles));
+				tx1 = (unsigned int)MIN ((double)(n_tiles - 1), floor ((e + 180.0) / 360.0 * (double)n_tiles));
+			}
+		}
+		GMT_Report (API, GMT_MSG_INFORMATION, "Zoom %d: tiles x = %u-%u, y = %u-%u from a %u x %u grid\n",
+			zoom, tx0, tx1, ty0, ty1, G->header->n_columns, G->header->n_rows);
+
+		for (ty = ty0; ty <= ty1; ty++) {	/* For each tile row */
+			for (tx = tx0; tx <= tx1; tx += n_batch) {	/* Render a batch of tiles in parallel, then write them */
+				unsigned int n_here = MIN (n_batch, tx1 - tx + 1);
+#ifdef _OPENMP
+#pragma omp parallel for private(b,thread) shared(GMT,G,Intens,Ctrl,P,H,zoom,tx,ty,ts,n_here,lon,gcol,gwx,icol,iwx,z,zi,buffer,has_data)
+#endif
+				for (b = 0; b < (openmp_int)n_here; b++) {
+#ifdef _OPENMP
+					thread = omp_get_thread_num ();
+#endif
+					has_data[b] = gmt2tiles_render_tile (GMT, G, Intens, Ctrl, P, H, (unsigned int)zoom, tx + b, ty,
+						lon + (size_t)thread * ts, gcol + (size_t)thread * ts, gwx + (size_t)thread * 4 * ts,
+						(Intens) ? icol + (size_t)thread * ts : NULL, (Intens) ? iwx + (size_t)thread * 4 * ts : NULL,
+						z + (size_t)thread * ts, (Intens) ? zi + (size_t)thread * ts : NULL, buffer[b]);
+				}
+				for (b = 0; b < (openmp_int)n_here; b++) {	/* Write the rendered tiles sequentially */
+					if (!has_data[b]) {	/* Tile received no grid values at all */
+						n_skipped++;
+						continue;
+					}
+					snprintf (file, PATH_MAX, "%s/%d/%u", Ctrl->D.dir, zoom, tx + b);
+					if (gmt_mkdir (file)) {
+						GMT_Report (API, GMT_MSG_ERROR, "Unable to create tile directory %s\n", file);
+						Return (GMT_RUNTIME_ERROR);
+					}
+					snprintf (file, PATH_MAX, "%s/%d/%u/%u.png", Ctrl->D.dir, zoom, tx + b, ty);
+					gmt_M_memcpy (I->data, buffer[b], H->size * 3, unsigned char);
+					if (GMT_Write_Data (API, GMT_IS_IMAGE, GMT_IS_FILE, GMT_IS_SURFACE, GMT_CONTAINER_AND_DATA, NULL, file, I) != GMT_NOERROR) {
+						Return (API->error);
+					}
+					n_written++;
+				}
+			}
+		}
+	}
+
+	GMT_Report (API, GMT_MSG_INFORMATION, "Wrote %" PRIu64 " tiles to %s (%" PRIu64 " empty tiles skipped)\n",
+		n_written, Ctrl->D.dir, n_skipped);
+
+	gmt_M_free (GMT, lon);
+	gmt_M_free (GMT, gcol);
+	gmt_M_free (GMT, gwx);
+	gmt_M_free (GMT, z);
+	if (Intens) {
+		gmt_M_free (GMT, icol);
+		gmt_M_free (GMT, iwx);
+		gmt_M_free (GMT, zi);
+	}
+	for (b = 0; b < (openmp_int)n_batch; b++) gmt_M_free (GMT, buffer[b]);
+	gmt_M_free (GMT, buffer);
+	gmt_M_free (GMT, has_data);
+
+	Return (GMT_NOERROR);
+}
@@ -254,6 +254,7 @@ int gmt_agc_read_grd (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header, gmt_
 	 *		for real and imaginary parts when processed by grdfft etc.
 	 */
 
+	bool piped = false;			/* Cannot seek on a pipe so must read through skipped blocks */
 	int first_col, last_col, j, col;		/* First and last column to deal with */
 	int first_row, last_row, j_gmt, colend;		/* First and last row to deal with */
 	unsigned int width_in;			/* Number of items in one row of the subregion */
@@ -263,12 +264,13 @@ int gmt_agc_read_grd (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header, gmt_
 	unsigned int *k = NULL;			/* Array with indices */
 	unsigned int block, n_blocks, n_blocks_x, n_blocks_y;	/* Misc. counters */
 	unsigned int datablockcol, datablockrow, rowstart, rowend, colstart, row;
+	unsigned int arow_min, arow_max;	/* Range of AGC (south-to-north) rows inside the subregion */
 	uint64_t ij, imag_offset, width_out;
 	gmt_grdfloat z[ZBLOCKWIDTH][ZBLOCKHEIGHT];
 	FILE *fp = NULL;			/* File pointer to data or pipe */
 	struct GMT_GRID_HEADER_HIDDEN *HH = gmt_get_H_hidden (header);
 
-	if (!strcmp (HH->name, "=")) {	/* Read from pipe */
+	if ((piped = (strcmp (HH->name, "=") == 0))) {	/* Read from pipe */
 #ifdef SET_IO_MODE
 		gmt_setmode (GMT, GMT_IN);
 #endif
@@ -284,7 +286,9 @@ int gmt_agc_read_grd (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header, gmt_
 	if (pad[XLO] > 0) width_out += pad[XLO];
 	if (pad[XHI] > 0) width_out += pad[XHI];
 
-	/* Because of the 40x40 blocks we read the entire file and only use what we need */
+	/* The file stores fixed-size 40x40 blocks so we visit them all, but only decode the
+	 * blocks that intersect the requested subregion and seek past the rest (a pipe
+	 * cannot seek so there we must read through the skipped blocks) */
 
 	/* Rows are read south to north */
 
@@ -296,30 +300,45 @@ int gmt_agc_read_grd (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header, gmt_
 	n_blocks_y = urint (ceil ((double)header->n_rows / (double)ZBLOCKHEIGHT));
 	n_blocks_x = urint (ceil ((double)header->n_columns / (double)ZBLOCKWIDTH));
 	n_blocks = n_blocks_x * n_blocks_y;
+	arow_min = header->n_rows - 1 - last_row;	/* AGC rows run south to north while first/last_row count from the north */
+	arow_max = header->n_rows - 1 - first_row;
 	datablockcol = datablockrow = 0;
 	for (block = 0; block < n_blocks; block++) {
-		if (gmtagcio_read_record (fp, z)) {
-			gmt_M_free (GMT, k);
-			gmt_fclose (GMT, fp);
-			return (GMT_GRDIO_READ_FAILED);
-		}
 		rowstart = datablockrow * ZBLOCKHEIGHT;
 		rowend = MIN (rowstart + ZBLOCKHEIGHT, header->n_rows);
-		for (i = 0, row = rowstart; row < rowend; i++, row++) {
-			j_gmt = header->n_rows - 1 - row;	/* GMT internal row number */
-			if (j_gmt < first_row || j_gmt > last_row) continue;
-			colstart = datablockcol * ZBLOCKWIDTH;
-			colend = MIN (colstart + ZBLOCKWIDTH, header->n_columns);
-			for (j = 0, col = colstart; col < colend; j++, col++) {
-				if (col < first_col || col > last_col) continue;
-				ij = imag_offset + ((uint64_t)(((j_gmt - first_row) + pad[YHI])) * width_out + col - first_col) + pad[XLO];
-				grid[ij] = (z[j][i] == 0.0) ? GMT->session.f_NaN : z[j][i];	/* AGC uses exact zero as NaN flag */
-				if (gmt_M_is_fnan (grid[ij])) {
-					HH->has_NaNs = GMT_GRID_HAS_NANS;
-					continue;
+		colstart = datablockcol * ZBLOCKWIDTH;
+		colend = MIN (colstart + ZBLOCKWIDTH, header->n_columns);
+		if (rowstart > arow_max || rowend <= arow_min || colstart > (unsigned int)last_col || colend <= first_col) {
+			/* Block is entirely outside the subregion; skip its fixed-length record */
+			if (piped || fseek (fp, (off_t)(RECORDLENGTH * sizeof(gmt_grdfloat)), SEEK_CUR)) {
+				/* Cannot seek (pipe); must read the record and discard it */
+				if (gmtagcio_read_record (fp, z)) {
+					gmt_M_free (GMT, k);
+					gmt_fclose (GMT, fp);
+					return (GMT_GRDIO_READ_FAILED);
+				}
+			}
+		}
+		else {
+			if (gmtagcio_read_record (fp, z)) {
+				gmt_M_free (GMT, k);
+				gmt_fclose (GMT, fp);
+				return (GMT_GRDIO_READ_FAILED);
+			}
+			for (i = 0, row = rowstart; row < rowend; i++, row++) {
+				j_gmt = header->n_rows - 1 - row;	/* GMT internal row number */
+				if (j_gmt < first_row || j_gmt > last_row) continue;
+				for (j = 0, col = colstart; col < colend; j++, col++) {
+					if (col < first_col || col > last_col) continue;
+					ij = imag_offset + ((uint64_t)(((j_gmt - first_row) + pad[YHI])) * width_out + col - first_col) + pad[XLO];
+					grid[ij] = (z[j][i] == 0.0) ? GMT->session.f_NaN : z[j][i];	/* AGC uses exact zero as NaN flag */
+					if (gmt_M_is_fnan (grid[ij])) {
+						HH->has_NaNs = GMT_GRID_HAS_NANS;
+						continue;
+					}
+					header->z_min = MIN (header->z_min, (double)grid[ij]);
+					header->z_max = MAX (header->z_max, (double)grid[ij]);
 				}
-				header->z_min = MIN (header->z_min, (double)grid[ij]);
-				header->z_max = MAX (header->z_max, (double)grid[ij]);
 			}
 		}
 
@@ -22,16 +22,17 @@
  * Date:	1-JUN-2013
  * Version:	5
  *
- * The API presently consists of 69 documented functions.  For a full
+ * The API presently consists of 70 documented functions.  For a full
  * description of the API, see the api.rst documentation [in doc/rst/source/devdocs].
  * These functions have FORTRAN bindings as well, provided you add
  * -DFORTRAN_API to the C preprocessor flags [in ConfigUserAdvanced.cmake].
  *
- * There are 2 public functions used for GMT API session handling.
+ * There are 3 public functions used for GMT API session handling.
  * This part of the API helps the developer create and delete GMT sessions:
  *
  * GMT_Create_Session	   : Initialize a new GMT session
  * GMT_Destroy_Session	   : Destroy a GMT session
+ * GMT_Reset_Session	   : Return a session to its just-created state
  *
  * There is 2 public functions for common error reporting.
  * Errors will be reported to stderr or selected log file:
@@ -52,6 +53,7 @@
  * GMT_End_IO              : Disallow further rec-by-rec i/o
  * GMT_Get_Info            : Get meta-data from the object passed
  * GMT_Get_Record          : Get the next single data record from the source(s)
+ * GMT_Get_Record_Batch    : Get several consecutive data records in one call
  * GMT_Get_Row             : Read one row from a grid when in row-by-row mode
  * GMT_Get_Status          : Examine current status of record-by-record i/o
  * GMT_Get_Matrix          : Get user matrix from GMT_MATRIX array
@@ -63,6 +65,7 @@
  * GMT_Open_VirtualFile    : Open a memory location for reading or writing a "file" by a module
  * GMT_Put_Levels          : Place an array with 3rd dimension (z or time) coordinates for a cube
  * GMT_Put_Record          : Send the next output record to its destination
+ * GMT_Put_Record_Batch    : Send several consecutive data records in one call
  * GMT_Put_Row             : Write one row to a grid when in row-by-row mode
  * GMT_Put_Matrix          : Hook user matrix to a GMT_MATRIX array
  * GMT_Put_Vector          : Hook user vector to a GMT_VECTOR column
@@ -5542,7 +5545,29 @@ start_over_import_grid:		/* We may get here if we cannot honor a GMT_IS_REFERENC
 				return_null (API, GMT_MEMORY_ERROR);
 			G_obj->header->z_min = DBL_MAX;
 			G_obj->header->z_max = -DBL_MAX;
-			for (row = j0, row_out = 0; row <= j1; row++, row_out++) {
+			if (M_obj->type == GMT_GRDFLOAT && M_obj->shape == GMT_IS_ROW_FORMAT && (uint64_t)i1 < M_obj->n_columns) {
+				/* Matrix rows are already contiguous gmt_grdfloat arrays (and no periodic column wrap is needed),
+				 * so we copy each row in one go and then scan the copied row for NaNs and the z-range */
+				uint64_t n_use = (uint64_t)(i1 - i0 + 1);	/* Number of columns to copy per row */
+				for (row = j0, row_out = 0; row <= j1; row++, row_out++) {
+					ij = gmt_M_ijp (G_obj->header, row_out, 0);	/* Position in output grid at start of current row */
+					ij_orig = GMT_2D_to_index (row, i0, M_obj->dim);	/* Position in input matrix at start of current row */
+#ifdef DOUBLE_PRECISION_GRID
+					gmt_M_memcpy (&G_obj->data[ij], &M_obj->data.f8[ij_orig], n_use, gmt_grdfloat);
+#else
+					gmt_M_memcpy (&G_obj->data[ij], &M_obj->data.f4[ij_orig], n_use, gmt_grdfloat);
+#endif
+					for (col = i0; col <= i1; col++, ij++) {
+						if (gmt_M_is_fnan (G_obj->data[ij]))
+							HH->has_NaNs = GMT_GRID_HAS_NANS;
+						else {
+							G_obj->header->z_min = MIN (G_obj->header->z_min, G_obj->data[ij]);
+							G_obj->header->z_max = MAX (G_obj->header->z_max, G_obj->data[ij]);
+						}
+					}
+				}
+			}
+			else for (row = j0, row_out = 0; row <= j1; row++, row_out++) {
 				ij = gmt_M_ijp (G_obj->header, row_out, 0);	/* Position in output grid at start of current row */
 				for (col = i0; col <= i1; col++, ij++) {
 					kol = col % M_obj->n_columns;
@@ -7624,9 +7649,11 @@ GMT_LOCAL void *gmtapi_get_data (void *V_API, int object_ID, unsigned int mode,
 	S_obj->selected = true;	/* Make sure it the requested data set is selected */
 
 	/* OK, try to do the importing */
+	gmt_M_tic (API->GMT, GMT_TIMING_IO);
 	if ((new_obj = gmtapi_import_data (API, S_obj->family, object_ID, mode, data)) == NULL) {
 		return_null (API, API->error);
 	}
+	gmt_M_toc (API->GMT, GMT_TIMING_IO);
 
 	if (!was_enabled && GMT_End_IO (API, GMT_IN, 0) != GMT_NOERROR) {	/* Disables data input if we had to set it in this function */
 		return_null (API, API->error);
@@ -7777,7 +7804,9 @@ GMT_LOCAL int gmtapi_put_data (void *V_API, int object_ID, unsigned int mode, vo
 		return_error (API, API->error);
 	}
 	S_obj = API->object[item];	/* The current object we are trying to export */
+	gmt_M_tic (API->GMT, GMT_TIMING_IO);
 	if (gmtapi_export_data (API, S_obj->family, object_ID, mode, data) != GMT_NOERROR) return_error (API, API->error);
+	gmt_M_toc (API->GMT, GMT_TIMING_IO);
 
 	if (!was_enabled && GMT_End_IO (API, GMT_OUT, 0) != GMT_NOERROR) {	/* Disables data output if we had to set it in this function */
 		return_error (API, API->error);
@@ -8531,6 +8560,7 @@ int GMT_Destroy_Session (void *V_API) {
 	gmt_M_free (API->GMT, API->object);
 	if (API->GMT->session.std[GMT_ERR] != stderr)	/* Close the error log fp pointer */
 		fclose (API->GMT->session.std[GMT_ERR]);
+	gmt_free_ps_arenas (API);	/* Free any in-memory PostScript left behind by an unfinished workflow */
 	gmt_end (API->GMT);	/* Terminate GMT machinery */
 	gmt_M_str_free (API->session_tag);
 	gmt_M_str_free (API->session_name);
@@ -8551,6 +8581,56 @@ int GMT_Destroy_Session_ () {
 }
 #endif
 
+/*! ===>  Reset a registered GMT Session to its just-created state */
+
+int GMT_Reset_Session (void *V_API) {
+	/* GMT_Reset_Session returns an existing session to the state it had just after GMT_Create_Session,
+	 * without tearing down the API machinery.  Long-running programs that serve many independent
+	 * requests can call this between requests instead of a GMT_Destroy_Session/GMT_Create_Session pair
+	 * and thus keep warm everything that is expensive to rebuild but does not change between requests
+	 * (the shared library list, keyword and color-name hash tables, parsed settings records, and any
+	 * remote data set information already obtained).  We free leftover registered data resources, wipe
+	 * the command shorthand history, and reload the GMT defaults from the standard settings plus the
+	 * user's settings file.  The modern mode workflow directory, if any, is left untouched.
+	 * Returns false if all is well and true if there were errors. */
+
+	unsigned int i;
+	struct GMTAPI_CTRL *API = gmtapi_get_api_ptr (V_API);
+	struct GMT_CTRL *GMT = NULL;
+
+	if (API == NULL) return_error (API, GMT_NOT_A_SESSION);	/* GMT_Create_Session has not been called */
+	API->error = GMT_NOERROR;
+	GMT = API->GMT;
+
+	GMT_Report (API, GMT_MSG_DEBUG, "Entering GMT_Reset_Session\n");
+	gmtlib_garbage_collection (API, GMT_NOTSET);	/* Free any remaining memory from data registration during the session */
+
+	/* Deallocate all remaining objects associated with NULL pointers (e.g., rec-by-rec i/o) but keep the object array */
+	while (API->n_objects && gmtlib_unregister_io (API, (int)API->object[0]->ID, (unsigned int)GMT_NOTSET) == GMT_NOERROR);
+
+	for (i = 0; i < GMT_N_UNIQUE; i++)	/* Forget any command shorthands inherited from earlier commands */
+		gmt_M_str_free (GMT->init.history[i]);
+
+	gmt_reload_settings (GMT);	/* Overwrite any changed defaults with the standard settings plus the user's settings file */
+	/* Rebuild the output and plot format machinery from the restored format strings, as gmt_begin does */
+	gmtlib_geo_C_format (GMT);
+	gmtlib_plot_C_format (GMT);
+
+	/* Restore the default for -n parameters, as gmt_begin does */
+	GMT->common.n.antialias = true; GMT->common.n.interpolant = BCR_BICUBIC; GMT->common.n.threshold = 0.5;
+
+	API->remote_id = GMT_NOTSET;	/* Not read a remote grid yet in this life of the session */
+
+	return (GMT_NOERROR);
+}
+
+#ifdef FORTRAN_API
+int GMT_Reset_Session_ () {
+	/* FORTRAN version: We pass the hidden global GMT_FORTRAN structure */
+	return (GMT_Reset_Session (GMT_FORTRAN));
+}
+#endif
+
 /*! . */
 GMT_LOCAL char gmtapi_debug_geometry_code (unsigned int geometry) {
 	char c;
@@ -10122,7 +10202,7 @@ GMT_LOCAL struct GMT_RECORD *gmtapi_get_record_matrix (struct GMTAPI_CTRL *API,
 		}
 		else {	/* Valid data record */
 			if (M->text)	/* Also have text as part of record */
-				strncpy (GMT->current.io.curr_trailing_text, M->text[S->rec-1], GMT_BUFSIZ-1);
+				gmtlib_set_trailing_text (GMT, M->text[S->rec-1]);
 			record = &GMT->current.io.record;
 			*n_fields = (int)API->current_get_n_columns;
 		}
@@ -10180,7 +10260,7 @@ GMT_LOCAL struct GMT_RECORD *gmtapi_get_record_vector (struct GMTAPI_CTRL *API,
 		}
 		else {	/* Valid data record */
 			if (V->text)	/* Also have text as part of record */
-				strncpy (GMT->current.io.curr_trailing_text, V->text[S->rec-1], GMT_BUFSIZ-1);
+				gmtlib_set_trailing_text (GMT, V->text[S->rec-1]);
 			record = &GMT->current.io.record;
 			*n_fields = (int)API->current_get_n_columns;
 		}
@@ -10206,7 +10286,7 @@ GMT_LOCAL struct GMT_RECORD * gmtapi_get_record_dataset (struct GMTAPI_CTRL *API
 				GMT->current.io.curr_rec[col_pos_out] = D->table[count[GMT_TBL]]->segment[count[GMT_SEG]]->data[col_pos_in][count[GMT_ROW]];
 			}
 			if (D->table[count[GMT_TBL]]->segment[count[GMT_SEG]]->text && D->table[count[GMT_TBL]]->segment[count[GMT_SEG]]->text[count[GMT_ROW]])
-				strncpy (GMT->current.io.curr_trailing_text, D->table[count[GMT_TBL]]->segment[count[GMT_SEG]]->text[count[GMT_ROW]], GMT_BUFSIZ-1);
+				gmtlib_set_trailing_text (GMT, D->table[count[GMT_TBL]]->segment[count[GMT_SEG]]->text[count[GMT_ROW]]);
 			if (GMT->current.setting.io_lonlat_toggle[GMT_IN] && API->current_get_n_columns >= 2) {
 				gmt_M_double_swap (GMT->current.io.curr_rec[GMT_X], GMT->current.io.curr_rec[GMT_Y]);	/* Got lat/lon instead of lon/lat */
 			}
@@ -10360,6 +10440,77 @@ void * GMT_Get_Record_ (unsigned int *mode, int *status) {	/* FORTRAN version: W
 }
 #endif
 
+/*! . */
+int64_t GMT_Get_Record_Batch (void *V_API, unsigned int mode, int64_t n_max, double *data) {
+	/* Retrieves up to n_max consecutive data records from the virtual input source and places
+	 * their values in the caller-owned column-major array data, so that column col of batch
+	 * record rec goes to data[col*n_max+rec].  Only the numerical columns are passed; any
+	 * trailing text is skipped.  We return the number of records placed in data.  The call
+	 * returns early (possibly with 0 records) when the next item is not a data record; as
+	 * for GMT_Get_Record that item (segment header, table header, file break, or EOF) has
+	 * then been consumed and the reason can be examined via GMT_Get_Status.  On error we
+	 * return GMT_NOTSET and set API->error.  When reading from a GMT_IS_DATASET resource
+	 * (e.g., a virtual file) with no column modifiers in effect we copy whole columns
+	 * segment by segment and bypass the per-record machinery entirely. */
+
+	bool fast;
+	int n_fields = 0;
+	int64_t n_read = 0;
+	uint64_t col;
+	struct GMTAPI_CTRL *API = NULL;
+	struct GMT_CTRL *GMT = NULL;
+	struct GMT_RECORD *record = NULL;
+
+	/* Top level check of active session */
+	if (V_API == NULL) return_value (V_API, GMT_NOT_A_SESSION, GMT_NOTSET);
+	API = gmtapi_get_api_ptr (V_API);
+	API->error = GMT_NOERROR;
+	if (data == NULL) return_value (API, GMT_PTR_IS_NULL, GMT_NOTSET);
+	if (n_max <= 0) return_value (API, GMT_DIM_TOO_SMALL, GMT_NOTSET);
+	GMT = API->GMT;	/* Shorthand for GMT access */
+
+	/* Whole columns can only be copied when reading straight from a dataset with no column selection (-i) or lon/lat swapping */
+	fast = (API->api_get_record == gmtapi_get_record_dataset && !GMT->common.i.col.select && !GMT->current.setting.io_lonlat_toggle[GMT_IN]);
+
+	while (n_read < n_max) {
+		if (fast) {	/* See how much of the current segment remains and copy that much, one column at a time */
+			int64_t *count = GMT->current.io.curr_pos[GMT_IN];	/* Shorthand to current table, segment, row */
+			struct GMT_DATASET *D = API->current_get_D_set;	/* The current dataset */
+			if (count[GMT_TBL] < (int64_t)D->n_tables && count[GMT_SEG] != GMT_NOTSET &&
+			    count[GMT_ROW] < (int64_t)D->table[count[GMT_TBL]]->segment[count[GMT_SEG]]->n_rows) {
+				struct GMT_DATASEGMENT *S = D->table[count[GMT_TBL]]->segment[count[GMT_SEG]];
+				int64_t n_copy = MIN (n_max - n_read, (int64_t)S->n_rows - count[GMT_ROW]);
+				for (col = 0; col < API->current_get_n_columns; col++)
+					gmt_M_memcpy (&data[col*(uint64_t)n_max+n_read], &S->data[col][count[GMT_ROW]], n_copy, double);
+				count[GMT_ROW] += n_copy;	/* Advance to next unread row in this segment */
+				n_read += n_copy;
+				API->current_rec[GMT_IN] += n_copy;	/* Update overall record counter */
+				API->current_get_obj->status = GMT_IS_USING;	/* Mark this resource as currently being read */
+				GMT->common.b.ncol[GMT_IN] = API->current_get_n_columns;
+				GMT->current.io.status = GMT_IO_DATA_RECORD;
+				continue;
+			}
+		}
+		do {	/* Get the next item via the regular machinery; this is the same loop as in GMT_Get_Record */
+			API->get_next_record = false;	/* We expect to read one data record and return */
+			GMT->current.io.status = 0;	/* Initialize status to OK */
+			record = API->api_get_record (API, mode, &n_fields);
+		} while (API->get_next_record);
+		if (record == NULL) break;	/* Not a data record; the caller can examine the reason via GMT_Get_Status */
+		API->current_rec[GMT_IN]++;	/* Increase record count */
+		for (col = 0; col < (uint64_t)n_fields; col++)	/* Scatter this record into the column-major array */
+			data[col*(uint64_t)n_max+n_read] = record->data[col];
+		n_read++;
+	}
+	return (n_read);
+}
+
+#ifdef FORTRAN_API
+int64_t GMT_Get_Record_Batch_ (unsigned int *mode, int64_t *n_max, double *data) {	/* FORTRAN version: We pass the global GMT_FORTRAN structure */
+	return (GMT_Get_Record_Batch (GMT_FORTRAN, *mode, *n_max, data));
+}
+#endif
+
 GMT_LOCAL int gmtapi_put_record_fp (struct GMTAPI_CTRL *API, unsigned int mode, struct GMT_RECORD *record) {
 	/* Function to use for rec-by-rec output to stream */
 	int error = GMT_NOERROR;
@@ -10826,6 +10977,81 @@ int GMT_Put_Record_ (unsigned int *mode, void *record) {
 	/* FORTRAN version: We pass the global GMT_FORTRAN structure */
 	return (GMT_Put_Record (GMT_FORTRAN, *mode, record));
 }
+#endif
+
+/*! . */
+int64_t GMT_Put_Record_Batch (void *V_API, unsigned int mode, int64_t n_records, double *data) {
+	/* Writes n_records consecutive data records to the current destination from the
+	 * caller-owned column-major array data, where column col of batch record rec sits in
+	 * data[col*n_records+rec].  The array must supply the number of output columns declared
+	 * via GMT_Set_Columns.  mode must be GMT_WRITE_DATA; table and segment headers are still
+	 * announced one at a time via GMT_Put_Record.  We return the number of records written,
+	 * or GMT_NOTSET on error (with API->error set).  When writing to a GMT_IS_DATASET
+	 * resource (e.g., a virtual file) with no column modifiers in effect we place whole
+	 * columns directly into the growing segment arrays and bypass the per-record machinery. */
+
+	bool fast;
+	int64_t rec;
+	uint64_t col, n_columns;
+	struct GMTAPI_CTRL *API = NULL;
+	struct GMT_CTRL *GMT = NULL;
+	struct GMT_RECORD Rec;
+
+	/* Top level check of active session */
+	if (V_API == NULL) return_value (V_API, GMT_NOT_A_SESSION, GMT_NOTSET);
+	API = gmtapi_get_api_ptr (V_API);
+	API->error = GMT_NOERROR;
+	if (data == NULL) return_value (API, GMT_PTR_IS_NULL, GMT_NOTSET);
+	if (n_records <= 0) return_value (API, GMT_DIM_TOO_SMALL, GMT_NOTSET);
+	if (mode != GMT_WRITE_DATA) return_value (API, GMT_NOT_A_VALID_IO_MODE, GMT_NOTSET);
+	GMT = API->GMT;	/* Shorthand for GMT access */
+
+	/* Whole columns can only be placed when writing straight to a dataset with no skipping (-s),
+	 * column selection (-o), NaN substitution (-d), or lon/lat swapping in effect */
+	fast = (API->api_put_record == gmtapi_put_record_dataset && !GMT->common.s.active && !GMT->common.o.col.select &&
+	        !GMT->common.d.active[GMT_OUT] && !GMT->current.setting.io_lonlat_toggle[GMT_OUT]);
+
+	if (fast) {	/* Place all the rows into the temporary segment arrays in one go, column by column */
+		struct GMT_DATATABLE *T = API->current_put_D_table;	/* Short hand */
+		int64_t *count = GMT->current.io.curr_pos[GMT_OUT], row0;
+		if (count[GMT_SEG] == GMT_NOTSET) {	/* Most likely a file with one segment but no segment header */
+			GMT_Report (API, GMT_MSG_DEBUG, "GMTAPI: GMT_Put_Record_Batch (double) called before any segments declared\n");
+			count[GMT_SEG] = 0;
+		}
+		row0 = count[GMT_ROW];	/* First row in this batch */
+		gmt_prep_tmp_arrays (GMT, GMT_OUT, row0 + n_records - 1, T->n_columns);	/* Init or reallocate tmp vectors */
+		for (col = 0; col < T->n_columns; col++) {
+			if (GMT->current.io.col_type[GMT_OUT][col] & GMT_IS_LON) {	/* Must adjust longitudes to the chosen range */
+				double value;
+				for (rec = 0; rec < n_records; rec++) {
+					value = data[col*(uint64_t)n_records+rec];
+					gmt_lon_range_adjust (GMT->current.io.geo.range, &value);
+					GMT->hidden.mem_coord[col][row0+rec] = value;
+				}
+			}
+			else	/* Can copy the whole column */
+				gmt_M_memcpy (&GMT->hidden.mem_coord[col][row0], &data[col*(uint64_t)n_records], n_records, double);
+		}
+		count[GMT_ROW] += n_records;	/* Rows now in the current segment */
+	}
+	else {	/* Must pass the records one at a time through the regular machinery */
+		if ((n_columns = (uint64_t)GMT->common.b.ncol[GMT_OUT]) == 0)
+			return_value (API, GMT_N_COLS_NOT_SET, GMT_NOTSET);
+		Rec.data = GMT->current.io.curr_rec;	Rec.text = NULL;
+		for (rec = 0; rec < n_records; rec++) {
+			for (col = 0; col < n_columns; col++)	/* Gather this record from the column-major array */
+				Rec.data[col] = data[col*(uint64_t)n_records+rec];
+			if (API->api_put_record (API, GMT_WRITE_DATA, &Rec))	/* Oh, we failed; API->error has been set */
+				return (GMT_NOTSET);
+		}
+	}
+	return (n_records);
+}
+
+#ifdef FORTRAN_API
+int64_t GMT_Put_Record_Batch_ (unsigned int *mode, int64_t *n_records, double *data) {	/* FORTRAN version: We pass the global GMT_FORTRAN structure */
+	return (GMT_Put_Record_Batch (GMT_FORTRAN, *mode, *n_records, data));
+}
 #endif
 
  /*! . */
@@ -12864,6 +13090,10 @@ int GMT_Call_Module (void *V_API, const char *module, int mode, void *args) {
 			GMT_Report (API, GMT_MSG_DEBUG, "GMT_Call_Command string: gmt %s %s\n", module, text);
 			if (mode == GMT_MODULE_OPT) GMT_Destroy_Cmd (API, &text);
 		}
+		if (API->GMT->hidden.func_level == GMT_CONTROLLER) {	/* Top-level call: reset the progress/cancel handle [nested module calls must not clear a pending cancellation] */
+			API->cancel = 0;
+			API->progress = 0.0;
+		}
 		status = (*p_func) (V_API, mode, args);				/* Call the module in peace */
 	}
 	return (status);
@@ -12875,6 +13105,39 @@ int GMT_Call_Module_ (const char *module, int *mode, void *args, int *length) {
 }
 #endif
 
+int GMT_Cancel_Module (void *V_API) {
+	/* Ask the module currently running in this session (presumably launched via GMT_Call_Module in
+	 * another thread) to stop at its next cancellation point.  Long-running modules poll this flag at
+	 * loop boundaries, wind down cleanly, and return GMT_MODULE_CANCELLED.  Safe to call repeatedly. */
+	struct GMTAPI_CTRL *API = NULL;
+	if (V_API == NULL) return_error (V_API, GMT_NOT_A_SESSION);
+	API = gmtapi_get_api_ptr (V_API);
+	API->cancel = 1;
+	return (GMT_NOERROR);
+}
+
+#ifdef FORTRAN_API
+int GMT_Cancel_Module_ () {
+	return (GMT_Cancel_Module (GMT_FORTRAN));
+}
+#endif
+
+double GMT_Get_Progress (void *V_API) {
+	/* Return the fraction completed [0-1] most recently published by the module running in this
+	 * session, or 0 if no module is running or it has yet to report any progress.  Lock-free: the
+	 * running module just stores the value and pollers in other threads read it. */
+	struct GMTAPI_CTRL *API = NULL;
+	if (V_API == NULL) return (0.0);
+	API = gmtapi_get_api_ptr (V_API);
+	return (API->progress);
+}
+
+#ifdef FORTRAN_API
+double GMT_Get_Progress_ () {
+	return (GMT_Get_Progress (GMT_FORTRAN));
+}
+#endif
+
 /*! . */
 GMT_LOCAL const char *gmtapi_get_shared_module_keys (struct GMTAPI_CTRL *API, char *module, unsigned int lib_no) {
 	/* Function that returns a pointer to the module keys in specified shared library lib_no, or NULL if not found  */
@@ -16123,6 +16386,29 @@ int GMT_Extract_Region (void *V_API, char *file, double wesn[]) {
 			GMT_Report (API, GMT_MSG_ERROR, "No hidden PS file found\n");
 			return_error (V_API, GMT_FILE_NOT_FOUND);
 		}
+		if (gmt_ps_memory_active (API)) {	/* Scan the in-memory PS for the PROJ tag instead */
+			struct GMT_PS_ARENA *A = gmt_ps_arena_get (API, API->GMT->current.ps.figure, false);
+			char *rec = (A) ? A->buffer : NULL;
+			GMT_Report (API, GMT_MSG_DEBUG, "GMT_Extract_Region: Search in-memory PS for figure %d\n", API->GMT->current.ps.figure);
+			while (!found && rec) {	/* Examine each record in the PS buffer */
+				if (rec[0] && rec[1] && !strncmp (&rec[2], "PROJ", 4)) {	/* Search for the PROJ tag in the ps buffer */
+					sscanf (&rec[8], "%*s %s %s %s %s", xx1, xx2, yy1, yy2);
+					wesn[XLO] = atof (xx1);		wesn[XHI] = atof (xx2);
+					wesn[YLO] = atof (yy1);		wesn[YHI] = atof (yy2);
+					if (wesn[XLO] > 180.0 && wesn[XHI] > 180.0) {
+						wesn[XLO] -= 360.0;
+						wesn[XHI] -= 360.0;
+					}
+					found = true;
+				}
+				if ((rec = strchr (rec, '\n'))) rec++;	/* Advance to start of next record */
+			}
+			if (!found) {
+				GMT_Report (API, GMT_MSG_ERROR, "GMT_Extract_Region: Failed to find the PROJ tag with the region\n");
+				return_error (V_API, GMT_VALUE_NOT_SET);
+			}
+			return_error (V_API, GMT_NOERROR);
+		}
 		GMT_Report (API, GMT_MSG_DEBUG, "Hidden PS file %s found\n", API->GMT->current.ps.filename);
 		if ((fp = fopen (API->GMT->current.ps.filename, "r")) == NULL) {
 			GMT_Report (API, GMT_MSG_ERROR, "GMT_Extract_Region: Failed to find/open current PS file %s\n", API->GMT->current.ps.filename);
@@ -72,6 +72,8 @@
  *
  *	gmt_bcr_get_z	   : Get interpolated grid value by convolution
  *	gmt_bcr_get_z_fast : Same, but skips NaN or outside checking
+ *	gmt_bcr_get_z_row  : Evaluate a full output row using precomputed x-stencils
+ *	gmt_bcr_prep_cols  : Precompute stencil columns and x-weights for a set of x-coordinates
  *
  * B) List of exported gmtlib_* functions available to libraries via gmt_internals.h:
  *
@@ -229,6 +231,56 @@ GMT_LOCAL uint64_t gmtbcr_prep (struct GMT_GRID_HEADER *h, double xx, double yy,
 	return (ij);
 }
 
+GMT_LOCAL int gmtbcr_prep_1d (struct GMT_GRID_HEADER *h, double t, double w[]) {
+	/* 1-D version of gmtbcr_prep: given the normalized real index t along one dimension,
+	   return the first node index of the convolution stencil along that dimension and
+	   fill in the bcr_n weights.  The weight formulas match gmtbcr_prep exactly. */
+	int k;
+	double tk, wp, wq, ww;
+	struct GMT_GRID_HEADER_HIDDEN *HH = gmt_get_H_hidden (h);
+
+	if (HH->bcr_interpolant == BCR_NEARNEIGHBOR) {	/* Just the closest node */
+		w[0] = 1.0;
+		return (irint (t));
+	}
+
+	/* Find the index of the node to the upper left, then the offset of t with respect to it */
+	tk = floor (t);
+	k  = irint (tk);
+	t -= tk;
+	/* For 4x4 interpolants, move over one more cell to the upper left corner */
+	if (HH->bcr_n == 4) k--;
+
+	switch (HH->bcr_interpolant) {
+	case BCR_BILINEAR:
+		w[0] = 1.0 - t;
+		w[1] = t;
+		break;
+	case BCR_BSPLINE:
+		wp = t * t;
+		wq = wp * t;
+		w[1] = wq / 2 - wp + 2.0 / 3.0;
+		w[3] = wq / 6;
+		ww = 1.0 - t;
+		wp = ww * ww;
+		wq = wp * ww;
+		w[2] = wq / 2 - wp + 2.0 / 3.0;
+		w[0] = wq / 6;
+		break;
+	default:	/* Cubic convolution kernel with a = -1/2; see gmtbcr_prep for details */
+		ww = 1.0 - t;
+		wp = ww * t;
+		wq = -0.5 * wp;
+		w[0] = wq * ww;
+		w[3] = wq * t;
+		w[1] = 3 * w[3] + ww + wp;
+		w[2] = 3 * w[0] + t + wp;
+		break;
+	}
+
+	return (k);
+}
+
 /*----------------------------------------------------------|
  * Public functions that are part of the GMT Devel library  |
  *----------------------------------------------------------|
@@ -321,6 +373,118 @@ double gmt_bcr_get_z (struct GMT_CTRL *GMT, struct GMT_GRID *G, double xx, doubl
 	return (GMT->session.d_NaN);
 }
 
+unsigned int gmt_bcr_prep_cols (struct GMT_CTRL *GMT, struct GMT_GRID *G, double *xx, unsigned int n, int *col, double *wx) {
+	/* Precompute the stencil start column col[k] and the 4 x-weights wx[4*k..4*k+3] for each
+	   of the n x-coordinates in xx.  Entries that are NaN or fall outside the grid (beyond the
+	   GMT_CONV4_LIMIT slack used by gmt_bcr_get_z) get col[k] = INT_MIN and will be set to NaN
+	   by gmt_bcr_get_z_row.  Since the x-stencils only depend on x, a caller evaluating a
+	   regular lattice (like grdsample) can do this once and reuse it for every output row
+	   instead of recomputing the convolution weights per node.  Returns the number of usable
+	   coordinates. */
+	unsigned int k, n_use = 0;
+	double x;
+	struct GMT_GRID_HEADER *h = G->header;
+	struct GMT_GRID_HEADER_HIDDEN *HH = gmt_get_H_hidden (h);
+	gmt_M_unused (GMT);
+
+	for (k = 0; k < n; k++) {
+		x = xx[k];
+		if (gmt_M_is_dnan (x)) {	/* Cannot evaluate a NaN location */
+			col[k] = INT_MIN;
+			continue;
+		}
+		/* Apply the same edge slack as gmtbcr_reject */
+		if (x < h->wesn[XLO]) {	/* If left of xmin... */
+			if (x < h->wesn[XLO] - GMT_CONV4_LIMIT) {	/* ...by this much then truly outside */
+				col[k] = INT_MIN;
+				continue;
+			}
+			x = h->wesn[XLO];	/* Else we say it is on xmin border */
+		}
+		else if (x > h->wesn[XHI]) {	/* If right of xmax... */
+			if (x > h->wesn[XHI] + GMT_CONV4_LIMIT) {	/* ...by this much then truly outside */
+				col[k] = INT_MIN;
+				continue;
+			}
+			x = h->wesn[XHI];	/* Else we say it is on xmax border */
+		}
+		col[k] = gmtbcr_prep_1d (h, (x - h->wesn[XLO]) * HH->r_inc[GMT_X] - h->xy_off, &wx[4*k]);
+		n_use++;
+	}
+
+	return (n_use);
+}
+
+void gmt_bcr_get_z_row (struct GMT_CTRL *GMT, struct GMT_GRID *G, double yy, unsigned int n, int *col, double *wx, gmt_grdfloat *z) {
+	/* Evaluate one output row at constant yy for the n x-stencils precomputed by
+	   gmt_bcr_prep_cols, placing the n interpolated values in z.  The results are
+	   identical to calling gmt_bcr_get_z per node; the saving is that the x-weights
+	   are computed once per column and the y-weights once per row. */
+	unsigned int i, j, k;
+	int row;
+	uint64_t ij, node;
+	bool outside = false;
+	double retval, wsum, w, wy[4] = {0.0, 0.0, 0.0, 0.0}, *wxk = NULL;
+	struct GMT_GRID_HEADER *h = G->header;
+	struct GMT_GRID_HEADER_HIDDEN *HH = gmt_get_H_hidden (h);
+
+	/* First check that yy is not NaN or outside the domain - if so the whole row is NaN */
+
+	if (gmt_M_is_dnan (yy))
+		outside = true;
+	else if (yy < h->wesn[YLO]) {	/* If below ymin... */
+		if (yy < h->wesn[YLO] - GMT_CONV4_LIMIT) outside = true;	/* ...by this much then truly outside */
+		else yy = h->wesn[YLO];	/* Else we say it is on ymin border */
+	}
+	else if (yy > h->wesn[YHI]) {	/* If above ymax... */
+		if (yy > h->wesn[YHI] + GMT_CONV4_LIMIT) outside = true;	/* ...by this much then truly outside */
+		else yy = h->wesn[YHI];	/* Else we say it is on ymax border */
+	}
+	if (outside) {
+		for (k = 0; k < n; k++) z[k] = (gmt_grdfloat)GMT->session.d_NaN;
+		return;
+	}
+
+	/* Determine stencil row and set the y-weights once for this row */
+
+	row = gmtbcr_prep_1d (h, (h->wesn[YHI] - yy) * HH->r_inc[GMT_Y] - h->xy_off, wy);
+
+	for (k = 0; k < n; k++) {
+		if (col[k] == INT_MIN) {	/* This x was NaN or outside the grid */
+			z[k] = (gmt_grdfloat)GMT->session.d_NaN;
+			continue;
+		}
+		wxk = &wx[4*k];
+		ij = gmt_M_ijp (h, row, col[k]);
+		retval = wsum = 0.0;
+		for (j = 0; j < HH->bcr_n; j++) {
+			for (i = 0; i < HH->bcr_n; i++) {
+				/* assure that index is inside bounds of the array G->data: */
+				node = ij + i;
+				/* node may be outside if xx, yy is exactly at a node and wx, wy is zero except at that point. If so,
+				 * we just skip this node as it does not affect calculation, and calling assert is too draconian */
+				if (node >= h->size) continue;
+				if (!gmt_M_is_fnan (G->data[node])) {
+					w = wxk[i] * wy[j];
+					retval += G->data[node] * w;
+					wsum += w;
+				}
+			}
+			ij += h->mx;
+		}
+		if ((wsum + GMT_CONV8_LIMIT - HH->bcr_threshold) > 0.0) {
+			retval /= wsum;
+			if (GMT->common.n.truncate) {
+				if (retval < h->z_min) retval = h->z_min;
+				else if (retval > h->z_max) retval = h->z_max;
+			}
+			z[k] = (gmt_grdfloat)retval;
+		}
+		else
+			z[k] = (gmt_grdfloat)GMT->session.d_NaN;
+	}
+}
+
 int gmtlib_bcr_get_img (struct GMT_CTRL *GMT, struct GMT_IMAGE *I, double xx, double yy, unsigned char *z) {
 	/* Given xx, yy in user's image file (in non-normalized units)
 	   this routine returns the desired interpolated image value (nearest-neighbor, bilinear
@@ -0,0 +1,200 @@
+/*--------------------------------------------------------------------
+ *
+ *	Copyright (c) 1991-2024 by the GMT Team (https://www.generic-mapping-tools.org/team.html)
+ *	See LICENSE.TXT file for copying and redistribution conditions.
+ *
+ *	This program is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation; version 3 or any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	Contact info: www.generic-mapping-tools.org
+ *--------------------------------------------------------------------*/
+/*
+ * Brief synopsis: gmt_bench runs a set of microbenchmarks over the library
+ * hot paths that have bitten us with silent performance regressions in the
+ * past: ASCII table parsing, map projection, grid write/read, bcr grid
+ * interpolation, and CPT lookups.  All input data are synthetic and created
+ * on the fly, timings are reported as one JSON object on stdout so CI can
+ * diff runs between releases.
+ *
+ * Usage: gmt_bench [<scale>]
+ *
+ * where the optional <scale> [1] multiplies the default problem sizes.
+ * Build with "make gmt_bench"; the target is excluded from the default build.
+ */
+
+#include "gmt_dev.h"
+#include <string.h>
+
+#ifdef WIN32
+#include <windows.h>
+#else
+#include <time.h>
+#endif
+
+#define BENCH_TABLE_FILE	"gmt_bench_table.txt"
+#define BENCH_GRID_FILE		"gmt_bench_grid.nc"
+#define BENCH_N_ROWS		200000		/* Data table rows at scale 1 */
+#define BENCH_N_GRID		1024		/* Grid rows and columns at scale 1 */
+#define BENCH_N_RESULTS		8		/* Max number of benchmark entries */
+
+struct BENCH_RESULT {
+	char name[GMT_LEN32];	/* Short benchmark identifier */
+	uint64_t items;		/* Number of records, nodes or lookups processed */
+	double wall, cpu;	/* Elapsed wall-clock and CPU seconds */
+};
+
+static double bench_wall_time (void) {
+	/* Return monotonic wall-clock time in seconds (arbitrary epoch) */
+#ifdef WIN32
+	LARGE_INTEGER t, f;
+	QueryPerformanceCounter (&t);
+	QueryPerformanceFrequency (&f);
+	return ((double)t.QuadPart / (double)f.QuadPart);
+#else
+	struct timespec ts;
+	clock_gettime (CLOCK_MONOTONIC, &ts);
+	return ((double)ts.tv_sec + 1.0e-9 * (double)ts.tv_nsec);
+#endif
+}
+
+static double bench_cpu_time (void) {
+	/* Return CPU time used by this process in seconds */
+	return ((double)clock () / (double)CLOCKS_PER_SEC);
+}
+
+static double bench_rand (uint64_t *state) {
+	/* Cheap deterministic LCG so runs are comparable across platforms; returns [0,1) */
+	*state = *state * 6364136223846793005ULL + 1442695040888963407ULL;
+	return ((double)(*state >> 11) / 9007199254740992.0);	/* Top 53 bits / 2^53 */
+}
+
+static void bench_log (struct BENCH_RESULT *R, unsigned int *n, char *name, uint64_t items, double wall, double cpu) {
+	/* Record one benchmark result for the final JSON report */
+	strncpy (R[*n].name, name, GMT_LEN32-1);
+	R[*n].items = items;
+	R[*n].wall = wall;
+	R[*n].cpu = cpu;
+	(*n)++;
+}
+
+static void bench_report (struct BENCH_RESULT *R, unsigned int n, double scale) {
+	/* Print all results as a single JSON object on stdout */
+	unsigned int k;
+	printf ("{\n  \"program\": \"gmt_bench\",\n  \"gmt_version\": \"%s\",\n  \"scale\": %g,\n  \"benchmarks\": [\n", GMT_version (), scale);
+	for (k = 0; k < n; k++) {
+		printf ("    {\"name\": \"%s\", \"items\": %" PRIu64 ", \"wall_s\": %.6f, \"cpu_s\": %.6f, \"items_per_s\": %.1f}%s\n",
+			R[k].name, R[k].items, R[k].wall, R[k].cpu, (R[k].wall > 0.0) ? (double)R[k].items / R[k].wall : 0.0, (k < (n-1)) ? "," : "");
+	}
+	printf ("  ]\n}\n");
+}
+
+int main (int argc, char *argv[]) {
+	unsigned int n_results = 0, gdim, k;
+	uint64_t n_rows, n_lookups, row, col, ij, node, seed = 123456789ULL;
+	double scale = 1.0, wall, cpu, inc[2], wesn[4] = {0.0, 10.0, 0.0, 10.0}, rgb[4], z, sum = 0.0;
+	char vin[GMT_VF_LEN] = {""}, vout[GMT_VF_LEN] = {""}, vgrid[GMT_VF_LEN] = {""}, cmd[GMT_LEN256] = {""}, cptname[GMT_LEN16] = {"jet"};
+	FILE *fp = NULL;
+	void *API = NULL;
+	struct GMT_DATASET *D = NULL, *T = NULL;
+	struct GMT_GRID *G = NULL;
+	struct GMT_PALETTE *P = NULL;
+	struct GMTAPI_CTRL *API_ctrl = NULL;
+	struct BENCH_RESULT results[BENCH_N_RESULTS];
+
+	if (argc > 1) scale = atof (argv[1]);
+	if (scale <= 0.0) {
+		fprintf (stderr, "gmt_bench: Scale must be positive\n");
+		exit (EXIT_FAILURE);
+	}
+	n_rows = (uint64_t)lrint (BENCH_N_ROWS * scale);
+	n_lookups = 20 * n_rows;
+	gdim = (unsigned int)lrint (BENCH_N_GRID * sqrt (scale));
+
+	if ((API = GMT_Create_Session (argv[0], 2U, GMT_SESSION_NORMAL, NULL)) == NULL) exit (EXIT_FAILURE);
+	API_ctrl = gmt_get_api_ptr (API);
+
+	/* 1. Table parsing: write a synthetic ASCII table, then time reading it as a dataset */
+
+	if ((fp = fopen (BENCH_TABLE_FILE, "w")) == NULL) exit (EXIT_FAILURE);
+	for (row = 0; row < n_rows; row++)
+		fprintf (fp, "%.6f\t%.6f\t%.6f\n", 10.0 * bench_rand (&seed), 10.0 * bench_rand (&seed), bench_rand (&seed));
+	fclose (fp);
+	wall = bench_wall_time ();	cpu = bench_cpu_time ();
+	if ((D = GMT_Read_Data (API, GMT_IS_DATASET, GMT_IS_FILE, GMT_IS_PLP, GMT_READ_NORMAL, NULL, BENCH_TABLE_FILE, NULL)) == NULL) exit (EXIT_FAILURE);
+	bench_log (results, &n_results, "table_parse", n_rows, bench_wall_time () - wall, bench_cpu_time () - cpu);
+
+	/* 2. Projection: run the dataset through mapproject via virtual files */
+
+	if (GMT_Open_VirtualFile (API, GMT_IS_DATASET, GMT_IS_PLP, GMT_IN|GMT_IS_REFERENCE, D, vin) != GMT_NOERROR) exit (EXIT_FAILURE);
+	if (GMT_Open_VirtualFile (API, GMT_IS_DATASET, GMT_IS_PLP, GMT_OUT|GMT_IS_REFERENCE, NULL, vout) != GMT_NOERROR) exit (EXIT_FAILURE);
+	snprintf (cmd, GMT_LEN256, "%s -R0/10/0/10 -JM15c ->%s", vin, vout);
+	wall = bench_wall_time ();	cpu = bench_cpu_time ();
+	if (GMT_Call_Module (API, "mapproject", GMT_MODULE_CMD, cmd) != GMT_NOERROR) exit (EXIT_FAILURE);
+	bench_log (results, &n_results, "projection", n_rows, bench_wall_time () - wall, bench_cpu_time () - cpu);
+	if ((T = GMT_Read_VirtualFile (API, vout)) == NULL) exit (EXIT_FAILURE);
+	GMT_Close_VirtualFile (API, vin);
+	GMT_Close_VirtualFile (API, vout);
+	if (GMT_Destroy_Data (API, &T) != GMT_NOERROR) exit (EXIT_FAILURE);
+
+	/* 3. Grid write and read: synthesize a grid, write it to netCDF, read it back */
+
+	inc[GMT_X] = (wesn[XHI] - wesn[XLO]) / (gdim - 1);	inc[GMT_Y] = (wesn[YHI] - wesn[YLO]) / (gdim - 1);
+	if ((G = GMT_Create_Data (API, GMT_IS_GRID, GMT_IS_SURFACE, GMT_CONTAINER_AND_DATA, NULL, wesn, inc, GMT_GRID_NODE_REG, GMT_NOTSET, NULL)) == NULL) exit (EXIT_FAILURE);
+	node = 0;
+	for (row = 0; row < G->header->n_rows; row++) for (col = 0; col < G->header->n_columns; col++, node++) {
+		ij = gmt_M_ijp (G->header, row, col);
+		G->data[ij] = (gmt_grdfloat)(sin (0.01 * (double)node) + cos (0.37 * (double)row));
+	}
+	wall = bench_wall_time ();	cpu = bench_cpu_time ();
+	if (GMT_Write_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_CONTAINER_AND_DATA, NULL, BENCH_GRID_FILE, G) != GMT_NOERROR) exit (EXIT_FAILURE);
+	bench_log (results, &n_results, "grid_write", G->header->nm, bench_wall_time () - wall, bench_cpu_time () - cpu);
+	if (GMT_Destroy_Data (API, &G) != GMT_NOERROR) exit (EXIT_FAILURE);
+	wall = bench_wall_time ();	cpu = bench_cpu_time ();
+	if ((G = GMT_Read_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_CONTAINER_AND_DATA, NULL, BENCH_GRID_FILE, NULL)) == NULL) exit (EXIT_FAILURE);
+	bench_log (results, &n_results, "grid_read", G->header->nm, bench_wall_time () - wall, bench_cpu_time () - cpu);
+
+	/* 4. bcr interpolation: sample the grid at the table positions via grdtrack */
+
+	if (GMT_Open_VirtualFile (API, GMT_IS_DATASET, GMT_IS_PLP, GMT_IN|GMT_IS_REFERENCE, D, vin) != GMT_NOERROR) exit (EXIT_FAILURE);
+	if (GMT_Open_VirtualFile (API, GMT_IS_GRID, GMT_IS_SURFACE, GMT_IN|GMT_IS_REFERENCE, G, vgrid) != GMT_NOERROR) exit (EXIT_FAILURE);
+	if (GMT_Open_VirtualFile (API, GMT_IS_DATASET, GMT_IS_PLP, GMT_OUT|GMT_IS_REFERENCE, NULL, vout) != GMT_NOERROR) exit (EXIT_FAILURE);
+	snprintf (cmd, GMT_LEN256, "%s -G%s ->%s", vin, vgrid, vout);
+	wall = bench_wall_time ();	cpu = bench_cpu_time ();
+	if (GMT_Call_Module (API, "grdtrack", GMT_MODULE_CMD, cmd) != GMT_NOERROR) exit (EXIT_FAILURE);
+	bench_log (results, &n_results, "bcr_interp", n_rows, bench_wall_time () - wall, bench_cpu_time () - cpu);
+	if ((T = GMT_Read_VirtualFile (API, vout)) == NULL) exit (EXIT_FAILURE);
+	GMT_Close_VirtualFile (API, vin);
+	GMT_Close_VirtualFile (API, vgrid);
+	GMT_Close_VirtualFile (API, vout);
+	if (GMT_Destroy_Data (API, &T) != GMT_NOERROR) exit (EXIT_FAILURE);
+	if (GMT_Destroy_Data (API, &D) != GMT_NOERROR) exit (EXIT_FAILURE);
+	if (GMT_Destroy_Data (API, &G) != GMT_NOERROR) exit (EXIT_FAILURE);
+
+	/* 5. CPT lookup: read a builtin CPT and time z-to-color conversions */
+
+	if ((P = gmt_get_palette (API_ctrl->GMT, cptname, GMT_CPT_OPTIONAL, 0.0, 1.0, 0.0)) == NULL) exit (EXIT_FAILURE);
+	seed = 123456789ULL;
+	wall = bench_wall_time ();	cpu = bench_cpu_time ();
+	for (row = 0; row < n_lookups; row++) {
+		z = bench_rand (&seed);	/* Builtin CPTs are normalized to 0-1 */
+		(void)gmt_get_rgb_from_z (API_ctrl->GMT, P, z, rgb);
+		sum += rgb[0];	/* Keep the loop from being optimized away */
+	}
+	bench_log (results, &n_results, "cpt_lookup", n_lookups, bench_wall_time () - wall, bench_cpu_time () - cpu);
+
+	/* Clean up scratch files and report */
+
+	remove (BENCH_TABLE_FILE);
+	remove (BENCH_GRID_FILE);
+	bench_report (results, n_results, scale);
+	for (k = 0; k < 4; k++) rgb[k] = sum;	/* Final use of sum to silence set-but-unused warnings */
+
+	if (GMT_Destroy_Session (API)) exit (EXIT_FAILURE);
+	exit (EXIT_SUCCESS);
+}
@@ -163,7 +163,7 @@ struct GMT_CONTOUR {
 	char **f_label;			/* Array for fixed labels */
 	struct GMT_FONT font_label;	/* Which font */
 	struct GMT_DATASET *X;		/* Dataset with list of structures with crossing-line coordinates */
-	struct GMT_XSEGMENT *ylist_XP;	/* Sorted y-segments for crossing-lines */
+	struct GMT_XSEGMENT **ylist_X;	/* Sorted y-segments, one per crossing line, built once and reused for all contours */
 	struct GMT_XSEGMENT *ylist;	/* y-indices sorted in increasing order */
 	struct GMT_XOVER XC;		/* Structure with resulting crossovers */
 	struct GMT_PEN pen;		/* Pen for drawing textbox outline */
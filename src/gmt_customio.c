@@ -59,6 +59,11 @@
 #include "gmt_dev.h"
 #include "gmt_internals.h"
 
+#ifndef _WIN32	/* Memory-mapped read path for the native binary grid formats */
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
+
 /* Defined in gmt_cdf.c */
 int gmt_cdf_read_grd_info (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header);
 int gmt_cdf_update_grd_info (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header);
@@ -935,6 +940,84 @@ int gmt_native_write_grd_info (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *hea
 		return GMT_NOERROR;
 }
 
+GMT_LOCAL void gmtcustomio_decode_row (struct GMT_CTRL *GMT, void *vptr, unsigned int *k, unsigned int width, gmt_grdfloat *row, unsigned int type) {
+	/* Convert one row of native samples (gathered via the k index array) to gmt_grdfloat.
+	 * Same conversions as gmtlib_decode, but with the type switch hoisted out of the sample
+	 * loop so each case is a tight loop the compiler can vectorize. */
+	unsigned int i;
+
+	switch (type) {
+		case 'b': {
+			char *b = vptr;
+			for (i = 0; i < width; i++) row[i] = (gmt_grdfloat)b[k[i]];
+			break;
+		}
+		case 's': {
+			short int *s = vptr;
+			for (i = 0; i < width; i++) row[i] = (gmt_grdfloat)s[k[i]];
+			break;
+		}
+		case 'i':
+		case 'm': {
+			int *v = vptr;
+			for (i = 0; i < width; i++) row[i] = (gmt_grdfloat)v[k[i]];
+			break;
+		}
+		case 'f': {
+			gmt_grdfloat *f = vptr;
+			for (i = 0; i < width; i++) row[i] = f[k[i]];
+			break;
+		}
+		case 'd': {
+			double *d = vptr;
+			for (i = 0; i < width; i++) row[i] = (gmt_grdfloat)d[k[i]];
+			break;
+		}
+		default:
+			GMT_Report (GMT->parent, GMT_MSG_ERROR, "GMT: Bad call to gmtcustomio_decode_row\n");
+			for (i = 0; i < width; i++) row[i] = GMT->session.f_NaN;
+			break;
+	}
+}
+
+GMT_LOCAL void gmtcustomio_encode_row (struct GMT_CTRL *GMT, void *vptr, unsigned int *k, unsigned int width, gmt_grdfloat *row, unsigned int type) {
+	/* Convert one row of gmt_grdfloat values (gathered via the k index array) to native samples.
+	 * Same conversions as gmtlib_encode, but with the type switch hoisted out of the sample loop. */
+	unsigned int i;
+
+	switch (type) {
+		case 'b': {
+			char *b = vptr;
+			for (i = 0; i < width; i++) b[i] = (char)lrintf (row[k[i]]);
+			break;
+		}
+		case 's': {
+			short int *s = vptr;
+			for (i = 0; i < width; i++) s[i] = (short int)lrintf (row[k[i]]);
+			break;
+		}
+		case 'i':
+		case 'm': {
+			int *v = vptr;
+			for (i = 0; i < width; i++) v[i] = (int)lrintf (row[k[i]]);
+			break;
+		}
+		case 'f': {
+			gmt_grdfloat *f = vptr;
+			for (i = 0; i < width; i++) f[i] = row[k[i]];
+			break;
+		}
+		case 'd': {
+			double *d = vptr;
+			for (i = 0; i < width; i++) d[i] = (double)row[k[i]];
+			break;
+		}
+		default:
+			GMT_Report (GMT->parent, GMT_MSG_ERROR, "GMT: Bad call to gmtcustomio_encode_row\n");
+			break;
+	}
+}
+
 int gmt_native_read_grd (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header, gmt_grdfloat *grid, double wesn[], unsigned int *pad, unsigned int complex_mode) {
 	/* header:	grid structure header */
 	/* grid:	array with final grid */
@@ -959,6 +1042,11 @@ int gmt_native_read_grd (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header, g
 	size_t n_expected;		/* Length of row to read */
 	FILE *fp = NULL;		/* File pointer to data or pipe */
 	void *tmp = NULL;		/* Array pointer for reading in rows of data */
+#ifndef _WIN32
+	unsigned char *map = NULL;	/* Start of memory-mapped file, if we could map it */
+	size_t map_size = 0;		/* Total size of the mapping (entire file) */
+	long data_offset = 0;		/* File offset to the start of the data section */
+#endif
 	struct GMT_GRID_HEADER_HIDDEN *HH = gmt_get_H_hidden (header);
 
 	if (!strcmp (HH->name, "=")) {	/* Read from pipe */
@@ -986,13 +1074,36 @@ int gmt_native_read_grd (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header, g
 	if (pad[XLO] > 0) width_out += pad[XLO];
 	if (pad[XHI] > 0) width_out += pad[XHI];
 
-	/* Allocate memory for one row of data (for reading purposes) */
-
 	n_expected = header->n_columns;
+
+#ifndef _WIN32
+	if (!piping) {	/* Try to memory-map the file so rows are decoded straight from the page cache with no fread copy */
+		struct stat sb;
+		data_offset = ftell (fp);
+		if (data_offset >= 0 && fstat (fileno (fp), &sb) == 0 &&
+		    (size_t)sb.st_size >= (size_t)data_offset + ((size_t)header->n_rows * n_expected) * size) {
+			map_size = (size_t)sb.st_size;
+			if ((map = mmap (NULL, map_size, PROT_READ, MAP_PRIVATE, fileno (fp), 0)) == MAP_FAILED)
+				map = NULL;	/* Quietly fall back on the fread path */
+#ifdef POSIX_MADV_SEQUENTIAL
+			else
+				posix_madvise (map, map_size, POSIX_MADV_SEQUENTIAL);
+#endif
+		}
+		if (map) GMT_Report (GMT->parent, GMT_MSG_DEBUG, "gmt_native_read_grd: Reading %s via mmap\n", HH->name);
+	}
+	if (map == NULL)	/* Only the fread path needs a row buffer */
+#endif
+	/* Allocate memory for one row of data (for reading purposes) */
 	if ((tmp = gmt_M_memory (GMT, NULL, n_expected * size, char)) == NULL) return GMT_MEMORY_ERROR;
 
 	/* Now deal with skipping */
 
+#ifndef _WIN32
+	if (map)	/* Nothing to skip; we index the mapped rows directly below */
+		;
+	else
+#endif
 	if (piping) {	/* Skip data by reading it */
 		for (j = 0; j < first_row; j++) if (gmt_M_fread (tmp, size, n_expected, fp) < n_expected) {
 			gmt_M_free (GMT, k);
@@ -1012,6 +1123,11 @@ int gmt_native_read_grd (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header, g
 	header->z_min = DBL_MAX;	header->z_max = -DBL_MAX;
 	HH->has_NaNs = GMT_GRID_NO_NANS;	/* We are about to check for NaNs and if none are found we retain 1, else 2 */
 	for (j = first_row, j2 = 0; j <= last_row; j++, j2++) {
+#ifndef _WIN32
+		if (map)	/* Point directly at this row in the mapped file */
+			tmp = map + (size_t)data_offset + ((size_t)j * n_expected) * size;
+		else
+#endif
 		if (gmt_M_fread (tmp, size, n_expected, fp) < n_expected) {
 			if (!piping) gmt_fclose (GMT, fp);
 			gmt_M_free (GMT, k);
@@ -1019,8 +1135,8 @@ int gmt_native_read_grd (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header, g
 			return (GMT_GRDIO_READ_FAILED);	/* Get one row */
 		}
 		ij = imag_offset + (j2 + pad[YHI]) * width_out + pad[XLO];
+		gmtcustomio_decode_row (GMT, tmp, k, width_in, &grid[ij], type);	/* Convert whatever to gmt_grdfloat */
 		for (i = 0, kk = ij; i < width_in; i++, kk++) {
-			grid[kk] = gmtlib_decode (GMT, tmp, k[i], type);	/* Convert whatever to gmt_grdfloat */
 			if (check && grid[kk] == header->nan_value)
 				grid[kk] = GMT->session.f_NaN;
 			if (gmt_M_is_fnan (grid[kk])) {
@@ -1049,6 +1165,12 @@ int gmt_native_read_grd (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header, g
 
 	if (!piping) gmt_fclose (GMT, fp);
 
+#ifndef _WIN32
+	if (map) {	/* Drop the mapping; tmp pointed into it and must not be freed */
+		munmap (map, map_size);
+		tmp = NULL;
+	}
+#endif
 	gmt_M_free (GMT, k);
 	gmt_M_free (GMT, tmp);
 
@@ -1073,7 +1195,7 @@ int gmt_native_write_grd (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header,
 	int first_row, last_row;	/* First and last row to deal with */
 	unsigned int width_out;		/* Width of row as return (may include padding) */
 	unsigned int height_out;	/* Number of columns in subregion */
-	unsigned int i2, ju, iu;	/* Misc. counters */
+	unsigned int i2, ju;		/* Misc. counters */
 	unsigned int *k = NULL;		/* Array with indices */
 	uint64_t ij, width_in, imag_offset, j2;
 	size_t size;			/* Length of data type */
@@ -1146,7 +1268,7 @@ int gmt_native_write_grd (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header,
 	i2 = first_col + pad[XLO];
 	for (ju = 0, j2 = first_row + pad[YHI]; ju < height_out; ju++, j2++) {
 		ij = imag_offset + j2 * width_in + i2;
-		for (iu = 0; iu < width_out; iu++) gmtlib_encode (GMT, tmp, iu, grid[ij+k[iu]], type);
+		gmtcustomio_encode_row (GMT, tmp, k, width_out, &grid[ij], type);
 		if (gmt_M_fwrite (tmp, size, n_expected, fp) < n_expected) {
 			gmt_M_free (GMT, k);
 			gmt_M_free (GMT, tmp);
@@ -1563,9 +1685,9 @@ int gmt_srf_read_grd (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header, gmt_
 			return (GMT_GRDIO_READ_FAILED);	/* Failed to get one row */
 		}
 		ij = imag_offset + (j2 + pad[YHI]) * width_out + pad[XLO];
+		gmtcustomio_decode_row (GMT, tmp, k, width_in, &grid[ij], type);	/* Convert whatever to gmt_grdfloat */
 		for (i = 0; i < width_in; i++) {
 			kk = ij + i;
-			grid[kk] = gmtlib_decode (GMT, tmp, k[i], type);	/* Convert whatever to gmt_grdfloat */
 			if (grid[kk] >= header->nan_value) {
 				HH->has_NaNs = GMT_GRID_HAS_NANS;
 				grid[kk] = GMT->session.f_NaN;
@@ -1612,7 +1734,7 @@ int gmt_srf_write_grd (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header, gmt
 	int first_row, last_row;	/* First and last row to deal with */
 	unsigned int width_out;		/* Width of row as return (may include padding) */
 	unsigned int height_out;		/* Number of columns in subregion */
-	unsigned int i2, ju, iu;		/* Misc. counters */
+	unsigned int i2, ju;		/* Misc. counters */
 	unsigned int *k = NULL;		/* Array with indices */
 	uint64_t ij, kk, j2, width_in, imag_offset;	/* Number of items in one row of the subregion */
 	size_t size;			/* Length of data type */
@@ -1697,7 +1819,7 @@ int gmt_srf_write_grd (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header, gmt
 	i2 = first_col + pad[XLO];
 	for (ju = 0, j2 = last_row + pad[YHI]; ju < height_out; ju++, j2--) {
 		ij = imag_offset + j2 * width_in + i2;
-		for (iu = 0; iu < width_out; iu++) gmtlib_encode (GMT, tmp, iu, grid[ij+k[iu]], type);
+		gmtcustomio_encode_row (GMT, tmp, k, width_out, &grid[ij], type);
 		if (gmt_M_fwrite (tmp, size, n_expected, fp) < n_expected) {
 			gmt_fclose (GMT, fp);
 			gmt_M_free (GMT, k);
@@ -2178,6 +2300,382 @@ int gmt_gdal_write_grd (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header, gm
 /* 23: ESRI Arc/Info ASCII interchange format */
 #include "gmt_esri_io.c"
 
+/*-----------------------------------------------------------
+ * Format :	zf
+ * Type :	Native binary (float) C file, zstd-compressed
+ * Prefix :	GMT_zstd_
+ * Purpose:	The regular 892-byte native grid header is followed
+ *		by the data compressed as a sequence of independent
+ *		zstd frames, each holding a block of consecutive rows.
+ *		A frame-size index placed after the header makes
+ *		sub-region reads seekable (we only decompress the
+ *		blocks that intersect the region) and, since every
+ *		frame is self-contained, lets us compress and
+ *		decompress the blocks concurrently.
+ *		gmt_native_read_grd_info and gmt_native_write_grd_info
+ *		handle the header since it is the native one.
+ * Functions :	gmt_zstd_read_grd, gmt_zstd_write_grd
+ *-----------------------------------------------------------*/
+
+#ifdef HAVE_ZSTD
+#include <zstd.h>
+
+#define GMT_ZSTD_BLOCK_BYTES 1048576U	/* Target ~1 MiB of uncompressed rows per frame */
+#define GMT_ZSTD_CLEVEL 5		/* zstd compression level used for grid blocks */
+#endif
+
+int gmt_zstd_read_grd (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header, gmt_grdfloat *grid, double wesn[], unsigned int *pad, unsigned int complex_mode) {
+	/* header:	grid structure header */
+	/* grid:	array with final grid */
+	/* wesn:	Sub-region to extract  [Use entire file if 0,0,0,0] */
+	/* padding:	# of empty rows/columns to add on w, e, s, n of grid, respectively */
+	/* complex_mode:	&4 | &8 if complex array is to hold real (4) and imaginary (8) parts (otherwise read as real only) */
+
+#ifdef HAVE_ZSTD
+	openmp_int b;			/* Block (frame) counter */
+	int b0, b1;			/* First and last block that intersect the subregion */
+	int err = GMT_NOERROR;		/* Error encountered while decoding a block, if any */
+	bool piping = false;		/* true if we read input pipe instead of from file */
+	bool check = false;		/* true if nan-proxies are used to signify NaN (for non-floating point types) */
+	int first_col, last_col;	/* First and last column to deal with */
+	int first_row, last_row;	/* First and last row to deal with */
+	unsigned int height_in;		/* Number of rows in subregion */
+	unsigned int width_in;		/* Number of items in one row of the subregion */
+	unsigned int i, t;		/* Misc. counters */
+	unsigned int *k = NULL;		/* Array with indices */
+	unsigned int rpb, n_blocks;	/* Rows per block and number of blocks in the file */
+	unsigned int n_threads = 1;	/* Number of concurrent block decoders */
+	uint32_t meta[2];		/* Rows-per-block and block count as stored in the file */
+	uint64_t kk, ij, j2, width_out, imag_offset;
+	uint64_t *frame_size = NULL;	/* Compressed size of each frame */
+	size_t row_bytes, n_comp;	/* Bytes per uncompressed row; total compressed bytes needed */
+	size_t *frame_off = NULL;	/* Offset of each needed frame within the arena */
+	char *arena = NULL;		/* All needed compressed frames, back to back */
+	gmt_grdfloat **ubuf = NULL;	/* Per-thread uncompressed block buffer */
+	FILE *fp = NULL;		/* File pointer to data or pipe */
+	struct GMT_GRID_HEADER_HIDDEN *HH = gmt_get_H_hidden (header);
+
+	if (!strcmp (HH->name, "=")) {	/* Read from pipe; the header was already consumed by the info reader */
+#ifdef SET_IO_MODE
+		gmt_setmode (GMT, GMT_IN);
+#endif
+		fp = GMT->session.std[GMT_IN];
+		piping = true;
+	}
+	else if ((fp = gmt_fopen (GMT, HH->name, "rb")) != NULL)	{	/* Skip header */
+		gmt_M_err_trap (gmtcustomio_native_skip_grd_header (fp, header));
+	}
+	else
+		return (GMT_GRDIO_OPEN_FAILED);
+
+	if (gmt_M_fread (meta, sizeof (uint32_t), 2U, fp) != 2) {
+		if (!piping) gmt_fclose (GMT, fp);
+		return (GMT_GRDIO_READ_FAILED);
+	}
+	rpb = meta[0];	n_blocks = meta[1];
+	if (rpb == 0 || n_blocks == 0 || (uint64_t)rpb * (n_blocks - 1) >= header->n_rows || (uint64_t)rpb * n_blocks < header->n_rows) {
+		GMT_Report (GMT->parent, GMT_MSG_ERROR, "Bad zstd block layout in grid %s\n", HH->name);
+		if (!piping) gmt_fclose (GMT, fp);
+		return (GMT_GRDIO_READ_FAILED);
+	}
+	frame_size = gmt_M_memory (GMT, NULL, n_blocks, uint64_t);
+	if (gmt_M_fread (frame_size, sizeof (uint64_t), n_blocks, fp) != n_blocks) {
+		gmt_M_free (GMT, frame_size);
+		if (!piping) gmt_fclose (GMT, fp);
+		return (GMT_GRDIO_READ_FAILED);
+	}
+
+	check = !isnan (header->nan_value);
+
+	(void)gmtlib_init_complex (header, complex_mode, &imag_offset);	/* Set offset for imaginary complex component */
+
+	gmt_M_err_pass (GMT, gmt_grd_prep_io (GMT, header, wesn, &width_in, &height_in, &first_col, &last_col, &first_row, &last_row, &k), HH->name);
+
+	width_out = width_in;		/* Width of output array */
+	if (pad[XLO] > 0) width_out += pad[XLO];
+	if (pad[XHI] > 0) width_out += pad[XHI];
+
+	row_bytes = (size_t)header->n_columns * sizeof (gmt_grdfloat);
+
+	/* Now deal with skipping.  Only blocks b0 through b1 intersect the subregion */
+
+	b0 = first_row / (int)rpb;	b1 = last_row / (int)rpb;
+	if (piping) {	/* Skip leading frames by reading them */
+		char *scratch = gmt_M_memory (GMT, NULL, GMT_ZSTD_BLOCK_BYTES, char);
+		for (b = 0; b < b0; b++) {
+			uint64_t left = frame_size[b];
+			while (left) {
+				size_t chunk = (left < GMT_ZSTD_BLOCK_BYTES) ? (size_t)left : GMT_ZSTD_BLOCK_BYTES;
+				if (gmt_M_fread (scratch, 1U, chunk, fp) != chunk) {
+					gmt_M_free (GMT, scratch);	gmt_M_free (GMT, frame_size);	gmt_M_free (GMT, k);
+					return (GMT_GRDIO_READ_FAILED);
+				}
+				left -= chunk;
+			}
+		}
+		gmt_M_free (GMT, scratch);
+	}
+	else {		/* Simply seek over them; the index gives their sizes */
+		off_t skip = 0;
+		for (b = 0; b < b0; b++) skip += (off_t)frame_size[b];
+		if (skip && fseek (fp, skip, SEEK_CUR)) {
+			gmt_fclose (GMT, fp);
+			gmt_M_free (GMT, frame_size);	gmt_M_free (GMT, k);
+			return (GMT_GRDIO_SEEK_FAILED);
+		}
+	}
+
+	/* Slurp the needed frames into one arena so the decompression loop below can run concurrently */
+
+	frame_off = gmt_M_memory (GMT, NULL, b1 - b0 + 1, size_t);
+	for (b = b0, n_comp = 0; b <= b1; b++) {
+		frame_off[b-b0] = n_comp;
+		n_comp += (size_t)frame_size[b];
+	}
+	arena = gmt_M_memory (GMT, NULL, n_comp, char);
+	if (gmt_M_fread (arena, 1U, n_comp, fp) != n_comp) {
+		gmt_M_free (GMT, frame_size);	gmt_M_free (GMT, frame_off);
+		gmt_M_free (GMT, arena);	gmt_M_free (GMT, k);
+		if (!piping) gmt_fclose (GMT, fp);
+		return (GMT_GRDIO_READ_FAILED);
+	}
+	if (piping) {	/* Skip remaining frames by reading them */
+		char *scratch = gmt_M_memory (GMT, NULL, GMT_ZSTD_BLOCK_BYTES, char);
+		for (b = b1 + 1; b < (openmp_int)n_blocks; b++) {
+			uint64_t left = frame_size[b];
+			while (left) {
+				size_t chunk = (left < GMT_ZSTD_BLOCK_BYTES) ? (size_t)left : GMT_ZSTD_BLOCK_BYTES;
+				if (gmt_M_fread (scratch, 1U, chunk, fp) != chunk) {
+					gmt_M_free (GMT, scratch);	gmt_M_free (GMT, frame_size);
+					gmt_M_free (GMT, frame_off);	gmt_M_free (GMT, arena);	gmt_M_free (GMT, k);
+					return (GMT_GRDIO_READ_FAILED);
+				}
+				left -= chunk;
+			}
+		}
+		gmt_M_free (GMT, scratch);
+	}
+	else
+		gmt_fclose (GMT, fp);
+
+#ifdef _OPENMP
+	n_threads = omp_get_max_threads ();
+#endif
+	ubuf = gmt_M_memory (GMT, NULL, n_threads, gmt_grdfloat *);
+	for (t = 0; t < n_threads; t++)
+		ubuf[t] = gmt_M_memory (GMT, NULL, (size_t)rpb * header->n_columns, gmt_grdfloat);
+
+#ifdef _OPENMP
+#pragma omp parallel for private(b) shared(GMT,header,grid,pad,first_row,last_row,b0,b1,rpb,n_blocks,width_in,width_out,imag_offset,row_bytes,frame_size,frame_off,arena,ubuf,k,err)
+#endif
+	for (b = b0; b <= b1; b++) {	/* Every frame is self-contained so the blocks decompress in parallel */
+		int j, r0, r1;
+		size_t got;
+		unsigned int block_rows = ((unsigned int)b == n_blocks - 1) ? header->n_rows - b * rpb : rpb;
+		gmt_grdfloat *u = ubuf[0];
+#ifdef _OPENMP
+		u = ubuf[omp_get_thread_num ()];
+#endif
+		got = ZSTD_decompress (u, (size_t)block_rows * row_bytes, &arena[frame_off[b-b0]], (size_t)frame_size[b]);
+		if (ZSTD_isError (got) || got != (size_t)block_rows * row_bytes)
+			err = GMT_GRDIO_READ_FAILED;
+		else {
+			r0 = MAX (first_row, b * (int)rpb);	r1 = MIN (last_row, b * (int)rpb + (int)block_rows - 1);
+			for (j = r0; j <= r1; j++) {	/* Scatter the rows we want into the grid */
+				uint64_t ijr = imag_offset + ((uint64_t)(j - first_row) + pad[YHI]) * width_out + pad[XLO];
+				gmtcustomio_decode_row (GMT, &u[(size_t)(j - b * (int)rpb) * header->n_columns], k, width_in, &grid[ijr], 'f');
+			}
+		}
+	}
+
+	for (t = 0; t < n_threads; t++) gmt_M_free (GMT, ubuf[t]);
+	gmt_M_free (GMT, ubuf);
+	gmt_M_free (GMT, arena);
+	gmt_M_free (GMT, frame_off);
+	gmt_M_free (GMT, frame_size);
+	if (err) {
+		GMT_Report (GMT->parent, GMT_MSG_ERROR, "Failed to decompress zstd frame in grid %s\n", HH->name);
+		gmt_M_free (GMT, k);
+		return (err);
+	}
+
+	/* Replace any nan-proxies and determine z_min/z_max, as the native reader does */
+
+	header->z_min = DBL_MAX;	header->z_max = -DBL_MAX;
+	HH->has_NaNs = GMT_GRID_NO_NANS;	/* We are about to check for NaNs and if none are found we retain 1, else 2 */
+	for (j2 = 0; j2 < height_in; j2++) {
+		ij = imag_offset + (j2 + pad[YHI]) * width_out + pad[XLO];
+		for (i = 0, kk = ij; i < width_in; i++, kk++) {
+			if (check && grid[kk] == header->nan_value)
+				grid[kk] = GMT->session.f_NaN;
+			if (gmt_M_is_fnan (grid[kk])) {
+				HH->has_NaNs = GMT_GRID_HAS_NANS;
+				continue;
+			}
+			/* Update z_min, z_max */
+			header->z_min = MIN (header->z_min, (double)grid[kk]);
+			header->z_max = MAX (header->z_max, (double)grid[kk]);
+		}
+	}
+
+	header->n_columns = width_in;
+	header->n_rows = height_in;
+	gmt_M_memcpy (header->wesn, wesn, 4, double);
+
+	gmt_M_free (GMT, k);
+
+	return (GMT_NOERROR);
+#else
+	gmt_M_unused(grid); gmt_M_unused(wesn); gmt_M_unused(pad); gmt_M_unused(complex_mode);
+	if (header) GMT_Report (GMT->parent, GMT_MSG_ERROR, "GMT was built without zstd support; cannot read zf grids.\n");
+	return (GMT_GRDIO_UNKNOWN_FORMAT);
+#endif
+}
+
+int gmt_zstd_write_grd (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header, gmt_grdfloat *grid, double wesn[], unsigned int *pad, unsigned int complex_mode) {
+	/* header:	grid structure header */
+	/* grid:	array with final grid */
+	/* wesn:	Sub-region to write out  [Use entire file if 0,0,0,0] */
+	/* padding:	# of empty rows/columns to add on w, e, s, n of grid, respectively */
+	/* complex_mode:	&4 | &8 if complex array holds real (4) and imaginary (8) parts (otherwise write real only) */
+	/*		If 64 is added we write no header */
+
+#ifdef HAVE_ZSTD
+	openmp_int b;			/* Block (frame) counter */
+	int err = GMT_NOERROR;		/* Error code */
+	int i, j;			/* Misc. counters */
+	bool check = false;		/* true if nan-proxies are used to signify NaN (for non-floating point types) */
+	bool piping = false;		/* true if we write to output pipe instead of to file */
+	bool do_header = true;		/* true if we should write the header first */
+	int first_col, last_col;	/* First and last column to deal with */
+	int first_row, last_row;	/* First and last row to deal with */
+	unsigned int width_out;		/* Width of row as return (may include padding) */
+	unsigned int height_out;	/* Number of rows in subregion */
+	unsigned int i2, t;		/* Misc. counters */
+	unsigned int *k = NULL;		/* Array with indices */
+	unsigned int rpb, n_blocks;	/* Rows per block and number of blocks to write */
+	unsigned int n_threads = 1;	/* Number of concurrent block encoders */
+	uint32_t meta[2];		/* Rows-per-block and block count as stored in the file */
+	uint64_t ij, width_in, imag_offset, j2;
+	uint64_t *frame_size = NULL;	/* Compressed size of each frame */
+	size_t row_bytes;		/* Bytes per uncompressed row */
+	char **frames = NULL;		/* One compressed frame per block */
+	gmt_grdfloat **ubuf = NULL;	/* Per-thread uncompressed block buffer */
+	FILE *fp = NULL;		/* File pointer to data or pipe */
+	struct GMT_GRID_HEADER_HIDDEN *HH = gmt_get_H_hidden (header);
+
+	if (!strcmp (HH->name, "=")) {	/* Write to pipe; all output below is sequential so this is fine */
+#ifdef SET_IO_MODE
+		gmt_setmode (GMT, GMT_OUT);
+#endif
+		fp = GMT->session.std[GMT_OUT];
+		piping = true;
+	}
+	else if ((fp = gmt_fopen (GMT, HH->name, "wb")) == NULL)
+		return (GMT_GRDIO_CREATE_FAILED);
+
+	check = !isnan (header->nan_value);
+
+	gmt_M_err_pass (GMT, gmt_grd_prep_io (GMT, header, wesn, &width_out, &height_out, &first_col, &last_col, &first_row, &last_row, &k), HH->name);
+	do_header = gmtlib_init_complex (header, complex_mode, &imag_offset);	/* Set offset for imaginary complex component */
+
+	width_in = width_out;		/* Physical width of input array */
+	if (pad[XLO] > 0) width_in += pad[XLO];
+	if (pad[XHI] > 0) width_in += pad[XHI];
+
+	gmt_M_memcpy (header->wesn, wesn, 4, double);
+
+	/* Find z_min/z_max */
+
+	header->z_min = DBL_MAX;	header->z_max = -DBL_MAX;
+	for (j = first_row, j2 = pad[YHI]; j <= last_row; j++, j2++) {
+		for (i = first_col, i2 = pad[XLO]; i <= last_col; i++, i2++) {
+			ij = imag_offset + (j2 * width_in + i2);
+			if (gmt_M_is_fnan (grid[ij])) {
+				if (check) grid[ij] = header->nan_value;
+			}
+			else {
+				header->z_min = MIN (header->z_min, (double)grid[ij]);
+				header->z_max = MAX (header->z_max, (double)grid[ij]);
+			}
+		}
+	}
+
+	if (header->z_min == DBL_MAX && header->z_max == -DBL_MAX) /* No valid data values in the grid */
+		header->z_min = header->z_max = NAN;
+
+	/* Chop the rows into ~GMT_ZSTD_BLOCK_BYTES blocks, then gather and compress them concurrently */
+
+	row_bytes = (size_t)header->n_columns * sizeof (gmt_grdfloat);
+	rpb = (unsigned int)(GMT_ZSTD_BLOCK_BYTES / row_bytes);
+	if (rpb == 0) rpb = 1;
+	if (rpb > height_out) rpb = height_out;
+	n_blocks = (height_out + rpb - 1) / rpb;
+
+	frames = gmt_M_memory (GMT, NULL, n_blocks, char *);
+	frame_size = gmt_M_memory (GMT, NULL, n_blocks, uint64_t);
+	for (b = 0; b < (openmp_int)n_blocks; b++)	/* Allocate destination frames up front so the compression loop needs no locking */
+		frames[b] = gmt_M_memory (GMT, NULL, ZSTD_compressBound ((size_t)rpb * row_bytes), char);
+#ifdef _OPENMP
+	n_threads = omp_get_max_threads ();
+#endif
+	ubuf = gmt_M_memory (GMT, NULL, n_threads, gmt_grdfloat *);
+	for (t = 0; t < n_threads; t++)
+		ubuf[t] = gmt_M_memory (GMT, NULL, (size_t)rpb * header->n_columns, gmt_grdfloat);
+
+#ifdef _OPENMP
+#pragma omp parallel for private(b) shared(GMT,header,grid,pad,first_col,first_row,height_out,rpb,n_blocks,width_in,width_out,imag_offset,row_bytes,frames,frame_size,ubuf,k,err)
+#endif
+	for (b = 0; b < (openmp_int)n_blocks; b++) {	/* Gather and compress one block of rows per iteration */
+		unsigned int ju, block_rows = MIN (rpb, height_out - b * rpb);
+		size_t ret;
+		gmt_grdfloat *u = ubuf[0];
+#ifdef _OPENMP
+		u = ubuf[omp_get_thread_num ()];
+#endif
+		for (ju = 0; ju < block_rows; ju++) {
+			uint64_t ijr = imag_offset + ((uint64_t)first_row + pad[YHI] + (uint64_t)b * rpb + ju) * width_in + first_col + pad[XLO];
+			gmtcustomio_encode_row (GMT, &u[(size_t)ju * header->n_columns], k, width_out, &grid[ijr], 'f');
+		}
+		ret = ZSTD_compress (frames[b], ZSTD_compressBound ((size_t)rpb * row_bytes), u, (size_t)block_rows * row_bytes, GMT_ZSTD_CLEVEL);
+		if (ZSTD_isError (ret))
+			err = GMT_GRDIO_WRITE_FAILED;
+		else
+			frame_size[b] = ret;
+	}
+
+	for (t = 0; t < n_threads; t++) gmt_M_free (GMT, ubuf[t]);
+	gmt_M_free (GMT, ubuf);
+
+	/* Store header information, block layout, frame-size index and the frames */
+
+	if (!err && do_header)
+		err = gmtcustomio_native_write_grd_header (fp, header);
+	if (!err) {
+		meta[0] = rpb;	meta[1] = n_blocks;
+		if (gmt_M_fwrite (meta, sizeof (uint32_t), 2U, fp) != 2 ||
+		    gmt_M_fwrite (frame_size, sizeof (uint64_t), n_blocks, fp) != n_blocks)
+			err = GMT_GRDIO_WRITE_FAILED;
+	}
+	for (b = 0; !err && b < (openmp_int)n_blocks; b++)
+		if (gmt_M_fwrite (frames[b], 1U, (size_t)frame_size[b], fp) != frame_size[b])
+			err = GMT_GRDIO_WRITE_FAILED;
+
+	for (b = 0; b < (openmp_int)n_blocks; b++) gmt_M_free (GMT, frames[b]);
+	gmt_M_free (GMT, frames);
+	gmt_M_free (GMT, frame_size);
+	gmt_M_free (GMT, k);
+
+	if (!piping) gmt_fclose (GMT, fp);
+
+	return (err);
+#else
+	gmt_M_unused(grid); gmt_M_unused(wesn); gmt_M_unused(pad); gmt_M_unused(complex_mode);
+	if (header) GMT_Report (GMT->parent, GMT_MSG_ERROR, "GMT was built without zstd support; cannot write zf grids.\n");
+	return (GMT_GRDIO_UNKNOWN_FORMAT);
+#endif
+}
+
 void gmtlib_grdio_init (struct GMT_CTRL *GMT) {
 	unsigned int id;
 
@@ -2431,6 +2929,20 @@ void gmtlib_grdio_init (struct GMT_CTRL *GMT) {
 	GMT->session.readgrd[id]    = &gmt_gdal_read_grd;
 	GMT->session.writegrd[id]   = &gmt_gdal_write_grd;
 
+	/* FORMAT: GMT native zstd-compressed (float) grdio */
+
+	id                        = GMT_GRID_IS_ZF;
+#ifdef HAVE_ZSTD
+	GMT->session.grdformat[id]  = "zf = GMT native, zstd-compressed format (32-bit float)";
+#else
+	GMT->session.grdformat[id]  = "zf = GMT native, zstd-compressed format (32-bit float) (not supported)";
+#endif
+	GMT->session.readinfo[id]   = &gmt_native_read_grd_info;
+	GMT->session.updateinfo[id] = &gmt_native_write_grd_info;
+	GMT->session.writeinfo[id]  = &gmt_native_write_grd_info;
+	GMT->session.readgrd[id]    = &gmt_zstd_read_grd;
+	GMT->session.writegrd[id]   = &gmt_zstd_write_grd;
+
 	/* ----------------------------------------------
 	 * ADD CUSTOM FORMATS BELOW AS THEY ARE NEEDED */
 }
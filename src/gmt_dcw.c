@@ -84,6 +84,15 @@ struct GMT_DCW_CHINA_CODES {
 	char code[4];
 };
 
+struct GMT_DCW_LISTCACHE {	/* Session-level cache of the parsed DCW list files */
+	struct GMT_DCW_COUNTRY *country;		/* Countries in file (continent-grouped) order */
+	struct GMT_DCW_COUNTRY *country_sorted;		/* Copy sorted on country code for binary searches */
+	struct GMT_DCW_STATE *state;			/* States in file order */
+	struct GMT_DCW_COUNTRY_STATE *country_state;	/* Countries that have state boundaries */
+	struct GMT_DCW_COLLECTION *collection;		/* Collections and named regions */
+	unsigned int dim[5];				/* Counts as set by gmtdcw_load_lists */
+};
+
 /* Compile in read-only structures and arrays with the information */
 
 static char *GMT_DCW_continents[GMT_DCW_N_CONTINENTS] = {"Africa", "Antarctica", "Asia", "Europe", "Oceania", "North America", "South America", "Miscellaneous"};
@@ -342,6 +351,44 @@ GMT_LOCAL int gmtdcw_comp_countries (const void *p1, const void *p2) {
 	return (strcmp (A->code, B->code));
 }
 
+GMT_LOCAL int gmtdcw_get_lists (struct GMT_CTRL *GMT, struct GMT_DCW_COUNTRY **C, struct GMT_DCW_COUNTRY **C_sorted, struct GMT_DCW_STATE **S, struct GMT_DCW_COUNTRY_STATE **CS, struct GMT_DCW_COLLECTION **U, unsigned int dim[]) {
+	/* Return pointers to the session-cached DCW lists, reading and parsing the list files on
+	 * first use only.  The returned arrays are owned by the session and must not be freed by
+	 * the caller; they are released by gmtlib_dcw_lists_free when the session ends. */
+	struct GMT_DCW_LISTCACHE *cache = GMT->session.dcw_lists;
+	if (cache == NULL) {	/* First DCW request in this session */
+		if ((cache = gmt_M_memory (GMT, NULL, 1, struct GMT_DCW_LISTCACHE)) == NULL) return GMT_NOTSET;
+		if (gmtdcw_load_lists (GMT, &cache->country, &cache->state, &cache->country_state, &cache->collection, cache->dim)) {
+			gmt_M_free (GMT, cache);
+			return GMT_NOTSET;
+		}
+		if ((cache->country_sorted = gmt_M_memory (GMT, NULL, cache->dim[0], struct GMT_DCW_COUNTRY)) == NULL) return GMT_NOTSET;
+		gmt_M_memcpy (cache->country_sorted, cache->country, cache->dim[0], struct GMT_DCW_COUNTRY);
+		qsort ((void *)cache->country_sorted, (size_t)cache->dim[0], sizeof (struct GMT_DCW_COUNTRY), gmtdcw_comp_countries);	/* Sort on country code */
+		GMT->session.dcw_lists = cache;
+	}
+	if (C) *C = cache->country;
+	if (C_sorted) *C_sorted = cache->country_sorted;
+	if (S) *S = cache->state;
+	if (CS) *CS = cache->country_state;
+	if (U) *U = cache->collection;
+	gmt_M_memcpy (dim, cache->dim, 5, unsigned int);
+	return 0;
+}
+
+void gmtlib_dcw_lists_free (struct GMT_CTRL *GMT) {
+	/* Release the session cache of parsed DCW list files, if loaded */
+	struct GMT_DCW_LISTCACHE *cache = GMT->session.dcw_lists;
+	if (cache == NULL) return;
+	gmt_M_free (GMT, cache->country);
+	gmt_M_free (GMT, cache->country_sorted);
+	gmt_M_free (GMT, cache->state);
+	gmt_M_free (GMT, cache->country_state);
+	gmtdcw_freestrings (cache->collection, cache->dim[3]+cache->dim[4]);
+	gmt_M_free (GMT, cache->collection);
+	gmt_M_free (GMT, GMT->session.dcw_lists);
+}
+
 GMT_LOCAL int gmtdcw_find_country (char *code, struct GMT_DCW_COUNTRY *list, int n) {
 	/* Basic binary search for country with given code and an alphabetically sorted list */
 	int low = 0, high = n, mid, last = GMT_NOTSET, way;
@@ -496,14 +543,12 @@ struct GMT_DATASET *gmt_DCW_operation(struct GMT_CTRL *GMT, struct GMT_DCW_SELEC
 		wesn[YLO] = +9999.0;	wesn[YHI] = -9999.0;	/* Initialize so we can shrink it below */
 	}
 
-	if (gmtdcw_load_lists(GMT, &GMT_DCW_country, &GMT_DCW_state, NULL, &GMT_DCW_collection, n_bodies))	/* Something went wrong */
-		return NULL;
+	if (gmtdcw_get_lists(GMT, NULL, &GMT_DCW_country, &GMT_DCW_state, NULL, &GMT_DCW_collection, n_bodies))	/* Something went wrong */
+		return NULL;	/* Use the code-sorted country list so gmtdcw_find_country can do binary searches */
 
 	GMT_DCW_COUNTRIES = n_bodies[0];
 	GMT_DCW_STATES = n_bodies[1];
 
-	qsort ((void *)GMT_DCW_country, (size_t)GMT_DCW_COUNTRIES, sizeof (struct GMT_DCW_COUNTRY), gmtdcw_comp_countries);	/* Sort on country code */
-
 	if ((order = gmt_M_memory(GMT, NULL, n_alloc, unsigned int)) == NULL) return NULL;
 	ALL = (strcmp(F->item[0]->codes, "=WD") == 0);	/* Get the whole world? */
 	for (j = 0; j < F->n_items; j++) {
@@ -567,10 +612,6 @@ struct GMT_DATASET *gmt_DCW_operation(struct GMT_CTRL *GMT, struct GMT_DCW_SELEC
 	else {
 		GMT_Report(GMT->parent, GMT_MSG_DEBUG, "No countries selected\n");
 		gmt_M_free(GMT, order);
-		gmt_M_free(GMT, GMT_DCW_country);
-		gmt_M_free(GMT, GMT_DCW_state);
-		gmtdcw_freestrings(GMT_DCW_collection, dim[3]+dim[4]);
-		gmt_M_free(GMT, GMT_DCW_collection);
 		return NULL;
 	}
 
@@ -914,10 +955,6 @@ struct GMT_DATASET *gmt_DCW_operation(struct GMT_CTRL *GMT, struct GMT_DCW_SELEC
 	}
 
 	gmt_nc_close(GMT, ncid);
-	gmt_M_free(GMT, GMT_DCW_country);
-	gmt_M_free(GMT, GMT_DCW_state);
-	gmtdcw_freestrings(GMT_DCW_collection, n_bodies[3]+n_bodies[4]);
-	gmt_M_free(GMT, GMT_DCW_collection);
 	gmt_M_free(GMT, Out);
 
 	if (mode & GMT_DCW_REGION) {
@@ -994,7 +1031,7 @@ unsigned int gmt_DCW_list (struct GMT_CTRL *GMT, struct GMT_DCW_SELECT *F) {
 
 	list_mode = F->mode;
 	if ((list_mode & GMT_DCW_LIST) == 0) return 0;
-	if (gmtdcw_load_lists (GMT, &GMT_DCW_country, &GMT_DCW_state, &GMT_DCW_country_with_state, &GMT_DCW_collection, n_bodies)) return GMT_NOTSET;	/* Something went wrong */
+	if (gmtdcw_get_lists (GMT, &GMT_DCW_country, NULL, &GMT_DCW_state, &GMT_DCW_country_with_state, &GMT_DCW_collection, n_bodies)) return GMT_NOTSET;	/* Something went wrong */
 	GMT_DCW_COUNTRIES = n_bodies[0];
 	GMT_DCW_STATES = n_bodies[1];
 	GMT_DCW_N_COUNTRIES_WITH_STATES = n_bodies[2];
@@ -1080,11 +1117,6 @@ unsigned int gmt_DCW_list (struct GMT_CTRL *GMT, struct GMT_DCW_SELECT *F) {
 		return (API->error);
 	}
 	gmt_M_free (GMT, Out);
-	gmt_M_free (GMT, GMT_DCW_country);
-	gmt_M_free (GMT, GMT_DCW_state);
-	gmt_M_free (GMT, GMT_DCW_country_with_state);
-	gmtdcw_freestrings (GMT_DCW_collection, n_bodies[3]+n_bodies[4]);
-	gmt_M_free (GMT, GMT_DCW_collection);
 	return ((list_mode & GMT_DCW_LIST));
 }
 
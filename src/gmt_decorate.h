@@ -74,7 +74,7 @@ struct GMT_DECORATE {
 	char symbol_code[GMT_LEN256];	/* The symbol code only as a null-terminated string */
 	char flag;			/* Char for the option key */
 	struct GMT_DATASET *X;		/* Dataset with list of structures with crossing-line coordinates */
-	struct GMT_XSEGMENT *ylist_XP;	/* Sorted y-segments for crossing-lines */
+	struct GMT_XSEGMENT **ylist_X;	/* Sorted y-segments, one per crossing line, built once and reused for all lines */
 	struct GMT_XSEGMENT *ylist;	/* y-indices sorted in increasing order */
 	struct GMT_XOVER XC;		/* Structure with resulting crossovers */
 };
@@ -109,5 +109,6 @@ const char *gmt_api_error_string[] = {
 	/* GMT_SUBSET_NOT_ALLOWED */		"GMT_SUBSET_NOT_ALLOWED",
 	/* GMT_VALUE_NOT_SET */			"GMT_VALUE_NOT_SET",
 	/* GMT_NO_STRINGS_ALLOWED */		"GMT_NO_STRINGS_ALLOWED",
-	/* GMT_WRITTEN_ONCE */			"GMT_WRITTEN_ONCE"
+	/* GMT_WRITTEN_ONCE */			"GMT_WRITTEN_ONCE",
+	/* GMT_MODULE_CANCELLED */		"GMT_MODULE_CANCELLED"
 };
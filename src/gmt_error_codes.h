@@ -121,6 +121,7 @@ enum Gmt_api_error_code {
 	GMT_SUBSET_NOT_ALLOWED,
 	GMT_VALUE_NOT_SET,
 	GMT_NO_STRINGS_ALLOWED,
-	GMT_WRITTEN_ONCE
+	GMT_WRITTEN_ONCE,
+	GMT_MODULE_CANCELLED
 };
 #endif /* GMT_ERROR_CODES_H */
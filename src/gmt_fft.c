@@ -474,6 +474,10 @@ GMT_LOCAL fftwf_plan gmtfft_gmt_fftwf_plan_dft(struct GMT_CTRL *GMT, unsigned n_
 	fftwf_complex *cin, *cout;
 	fftwf_plan plan = NULL;
 
+#ifdef HAVE_FFTW3F_THREADS
+	if (GMT->current.setting.fftwf_threads)	/* Plans honor the common -x thread limit of the calling module [all cores] */
+		fftwf_plan_with_nthreads (MAX (1, MIN (GMT->common.x.n_threads, gmtlib_get_num_processors ())));
+#endif
 	sign = direction == GMT_FFT_FWD ? FFTW_FORWARD : FFTW_BACKWARD;
 	cin  = data;
 	cout = cin; /* in-place transform */
@@ -652,13 +656,18 @@ GMT_LOCAL int gmtfft_2d_vDSP (struct GMT_CTRL *GMT, gmt_grdfloat *data, unsigned
 GMT_LOCAL int gmtfft_1d_kiss (struct GMT_CTRL *GMT, gmt_grdfloat *data, unsigned int n, int direction, unsigned int mode) {
 	kiss_fft_cpx *fin, *fout;
 	kiss_fft_cfg config;
-	gmt_M_unused(GMT); gmt_M_unused(mode);
+	unsigned int k, dir = (direction == GMT_FFT_INV) ? 1 : 0;
+	gmt_M_unused(mode);
 
-	/* Initialize a FFT (or IFFT) config/state data structure */
-	config = kiss_fft_alloc(n, direction == GMT_FFT_INV, NULL, NULL);
+	if (GMT->current.fft.kiss_n_1d != n) {	/* A new length invalidates any cached configs */
+		for (k = 0; k < 2; k++) gmt_M_str_free (GMT->current.fft.kiss_cfg_1d[k]);
+		GMT->current.fft.kiss_n_1d = n;
+	}
+	if (GMT->current.fft.kiss_cfg_1d[dir] == NULL)	/* Initialize a FFT (or IFFT) config/state data structure and keep it for subsequent same-size transforms */
+		GMT->current.fft.kiss_cfg_1d[dir] = kiss_fft_alloc(n, direction == GMT_FFT_INV, NULL, NULL);
+	config = GMT->current.fft.kiss_cfg_1d[dir];
 	fin = fout = (kiss_fft_cpx *)data;
 	kiss_fft (config, fin, fout); /* do transform */
-	gmt_M_str_free (config); /* Free config data structure */
 
 	return GMT_NOERROR;
 }
@@ -668,14 +677,19 @@ GMT_LOCAL int gmtfft_2d_kiss (struct GMT_CTRL *GMT, gmt_grdfloat *data, unsigned
 	const int dimcount = 2;      /* number of dimensions */
 	kiss_fft_cpx *fin, *fout;
 	kiss_fftnd_cfg config;
-	gmt_M_unused(GMT); gmt_M_unused(mode);
+	unsigned int k, dir = (direction == GMT_FFT_INV) ? 1 : 0;
+	gmt_M_unused(mode);
 
-	/* Initialize a FFT (or IFFT) config/state data structure */
-	config = kiss_fftnd_alloc (dim, dimcount, direction == GMT_FFT_INV, NULL, NULL);
+	if (GMT->current.fft.kiss_dim_2d[0] != n_columns || GMT->current.fft.kiss_dim_2d[1] != n_rows) {	/* New dimensions invalidate any cached configs */
+		for (k = 0; k < 2; k++) gmt_M_str_free (GMT->current.fft.kiss_cfg_2d[k]);
+		GMT->current.fft.kiss_dim_2d[0] = n_columns;	GMT->current.fft.kiss_dim_2d[1] = n_rows;
+	}
+	if (GMT->current.fft.kiss_cfg_2d[dir] == NULL)	/* Initialize a FFT (or IFFT) config/state data structure and keep it for subsequent same-size transforms */
+		GMT->current.fft.kiss_cfg_2d[dir] = kiss_fftnd_alloc (dim, dimcount, direction == GMT_FFT_INV, NULL, NULL);
+	config = GMT->current.fft.kiss_cfg_2d[dir];
 
 	fin = fout = (kiss_fft_cpx *)data;
 	kiss_fftnd (config, fin, fout); /* do transform */
-	gmt_M_str_free (config); /* Free config data structure */
 
 	return GMT_NOERROR;
 }
@@ -1696,6 +1710,7 @@ void gmtlib_fft_initialization (struct GMT_CTRL *GMT) {
 		/* one-time initialization required to use FFTW3 threads */
 		if ( fftwf_init_threads() ) {
 			fftwf_plan_with_nthreads(n_cpu);
+			GMT->current.setting.fftwf_threads = true;	/* Flag that threaded planning is available */
 			GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Initialize FFTW with %d threads.\n", n_cpu);
 		}
 	}
@@ -1725,9 +1740,11 @@ void gmtlib_fft_initialization (struct GMT_CTRL *GMT) {
 
 void gmtlib_fft_cleanup (struct GMT_CTRL *GMT) {
 	/* Called by gmt_end */
-#ifndef __APPLE__
-	gmt_M_unused(GMT);
-#endif
+	unsigned int k;
+	for (k = 0; k < 2; k++) {	/* Free any cached Kiss FFT configs */
+		gmt_M_str_free (GMT->current.fft.kiss_cfg_1d[k]);
+		gmt_M_str_free (GMT->current.fft.kiss_cfg_2d[k]);
+	}
 #if defined HAVE_FFTW3F_THREADS
 	fftwf_cleanup_threads(); /* clean resources allocated internally by FFTW */
 #endif
@@ -104,6 +104,10 @@ struct GMT_FFT_SUGGESTION {
 
 struct GMT_FFT_HIDDEN {	/* Items needed by various FFT packages */
 	unsigned int n_1d, n_2d;	/* Bill Gates says: error C2016: C requires that a struct or union has at least one member */
+	void *kiss_cfg_1d[2];		/* Cached Kiss FFT forward and inverse 1-D configs, so repeated same-size transforms skip planning [NULL until first use] */
+	void *kiss_cfg_2d[2];		/* Same, for 2-D configs */
+	unsigned int kiss_n_1d;		/* Length the cached 1-D configs were built for */
+	unsigned int kiss_dim_2d[2];	/* n_columns, n_rows the cached 2-D configs were built for */
 #ifdef __APPLE__ /* Accelerate framework */
 	FFTSetup setup_1d, setup_2d;
 	DSPSplitComplex dsp_split_complex_1d;
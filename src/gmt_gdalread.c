@@ -748,6 +748,7 @@ int gmt_gdalread (struct GMT_CTRL *GMT, char *gdal_filename, struct GMT_GDALREAD
 	int	nPixelSize, nBands, i, nReqBands = 0;
 	int	anSrcWin[4], xOrigin[2] = {0,0}, yOrigin = 0;
 	int	jump = 0, nXSize[2] = {0,0}, nYSize = 0, nX[2] = {0,0}, nY;
+	int	nXSize_src[2] = {0,0}, nYSize_src = 0;	/* The GDAL source window; differs from nXSize/nYSize when decimating */
 	int nBufXSize[2] = {0,0}, nBufYSize, buffy, startRow = 0, endRow;
 	int nRowsPerBlock, nBlocks, nYOff, row_i, row_e;
 	int k, pad_w[2] = {0,0}, pad_e[2] = {0,0}, pad_s = 0, pad_n = 0;    /* Different pads for when sub-regioning near the edges */
@@ -761,7 +762,7 @@ int gmt_gdalread (struct GMT_CTRL *GMT, char *gdal_filename, struct GMT_GDALREAD
 	bool   pixel_reg = false;	/* GDAL decides everything is pixel reg, we make our decisions based on data type */
 	bool   fliplr, got_R = false, got_r = false;
 	bool   topdown = false, rowmajor = true;               /* arrays from GDAL have this order */
-	bool   just_copy = false, copy_flipud = false, UDflip_Y = false;
+	bool   just_copy = false, copy_flipud = false, UDflip_Y = false, single_interleaved_read = false;
 	int	   *whichBands = NULL;
 	int64_t *rowVec = NULL, *colVec = NULL;
 	int64_t  off, i_x_nXYSize, startColPos = 0, indent = 0, nXSize_withPad = 0, nYSize_withPad;
@@ -1043,9 +1044,10 @@ int gmt_gdalread (struct GMT_CTRL *GMT, char *gdal_filename, struct GMT_GDALREAD
 	hBand = GDALGetRasterBand(hDataset, first_layer);
 	nPixelSize = GDALGetDataTypeSize(GDALGetRasterDataType(hBand)) / 8;	/* /8 because return value is in BITS */
 
-	if (jump) {
-		nBufXSize[0] = XDim / jump;
-		nBufYSize = YDim / jump;
+	if (jump) {	/* Preview mode: request a decimated buffer (relative to the -R window, if any) so GDAL can serve it from overview levels */
+		nBufXSize[0] = MAX (1, nXSize[0] / jump);
+		nBufXSize[1] = (nXSize[1]) ? MAX (1, nXSize[1] / jump) : 0;
+		nBufYSize = MAX (1, nYSize / jump);
 	}
 	else {
 		nBufXSize[0] = nXSize[0];
@@ -1143,15 +1145,55 @@ int gmt_gdalread (struct GMT_CTRL *GMT, char *gdal_filename, struct GMT_GDALREAD
 	else
 		nX[0] = nXSize[0],	nX[1] = nXSize[1],	nY = nYSize;
 
+	nXSize_src[0] = nXSize[0];	nXSize_src[1] = nXSize[1];	nYSize_src = nYSize;	/* Remember the GDAL source window */
+	if (jump) {	/* From here on all dimensions and indexing refer to the decimated buffer; only the RasterIO calls need the source window */
+		nXSize[0] = nBufXSize[0];	nXSize[1] = nBufXSize[1];	nYSize = nBufYSize;
+	}
+
 	/* --------------------------------------------------------------------------------- */
 	nXSize_withPad = nXSize[0] + nXSize[1] + pad_w[0] + pad_e[0] + pad_w[1] + pad_e[1];	/* Only one of w and e will be nonzero if padding is on */
 
+	/* Byte images going out pixel-interleaved (the grdimage RGB[A] case) can be read with a single
+	   dataset-level RasterIO call per piece, straight into the final interleaved layout.  GDAL then
+	   decodes each file block only once instead of once per band, which matters a lot for large
+	   multi-band rasters.  The remaining layouts keep the band-by-band path below. */
+	single_interleaved_read = (do_BIP && !fliplr && !UDflip_Y && rowmajor && !topdown &&
+	                           !prhs->mini_hdr.active && GDALGetRasterDataType(hBand) == GDT_Byte && nBands == nRGBA);
+
 	gmt_M_tic (GMT);
 
 	for (piece = 0; piece < n_pieces; piece++) {	/* Mostly doing this loop once, but for subregion straddling periodic boundary we get here twice */
+		if (single_interleaved_read) {	/* One interleaved multi-band read directly into the output array */
+			unsigned char *dest = &Ctrl->UInt8.data[(size_t)nRGBA * (indent + pad_w[piece]) + (size_t)pad_n * nRGBA * nXSize_withPad];
+			if ((gdal_code = GDALDatasetRasterIO (hDataset, GF_Read, xOrigin[piece], yOrigin, nXSize_src[piece], nYSize_src, dest,
+			                 nXSize[piece], nYSize, GDT_Byte, nBands, nReqBands ? whichBands : NULL,
+			                 nRGBA, nRGBA * (int)nXSize_withPad, 1)) != CE_None) {
+				GMT_Report (GMT->parent, GMT_MSG_WARNING, "gmt_gdalread: GDALDatasetRasterIO failed to read bands [err = %d]\n", gdal_code);
+			}
+			Ctrl->UInt8.active = true;
+			pixel_reg = true;	/* Byte data, so same decision as the band-by-band path makes */
+			if (got_R) {	/* Update z_min/z_max as the band-by-band path does */
+				int bGotNoData;
+				double dfNoData = GDALGetRasterNoDataValue (GDALGetRasterBand (hDataset, first_layer), &bGotNoData);
+				for (m = 0; m < nYSize; m++) {
+					unsigned char *p = dest + m * (size_t)nRGBA * nXSize_withPad;
+					for (n = 0; n < (int64_t)nRGBA * nXSize[piece]; n++) {
+						if (bGotNoData && p[n] == dfNoData) continue;
+						z_min = MIN (p[n], z_min);
+						z_max = MAX (p[n], z_max);
+					}
+				}
+			}
+			indent = pad_w[piece] + nXSize[piece];	/* The second time (if there is one) we must step in to pick up western section */
+			continue;
+		}
 		/* 16 Mb worth of rows */
 		nRowsPerBlock = MIN(nYSize, (int)(1024 * 1024 * 16 / (nXSize[piece] * nPixelSize)));
 		nBlocks = (int)ceil((float)nYSize / nRowsPerBlock);
+		if (jump) {	/* Each band is read as one decimated chunk since the blocked reads assume a 1:1 row mapping */
+			nRowsPerBlock = nYSize;
+			nBlocks = 1;
+		}
 
 		if (!(just_copy || copy_flipud)) {	/* Need temp memory to hold return from GDAL */
 			if ((tmp = calloc((size_t)nRowsPerBlock * (size_t)nBufXSize[piece], nPixelSize)) == NULL) {
@@ -1219,7 +1261,7 @@ int gmt_gdalread (struct GMT_CTRL *GMT, char *gdal_filename, struct GMT_GDALREAD
 				if (just_copy || copy_flipud)					/* In this case nBlocks was set to 1 above */
 					tmp = &Ctrl->UInt8.data[i_x_nXYSize];		/* These cases don't need any temporary array */
 
-				if ((gdal_code = GDALRasterIO(hBand, GF_Read, xOrigin[piece], nYOff, nXSize[piece], buffy, tmp,
+				if ((gdal_code = GDALRasterIO(hBand, GF_Read, xOrigin[piece], nYOff, nXSize_src[piece], (jump) ? nYSize_src : buffy, tmp,
 			                 nBufXSize[piece], buffy, GDALGetRasterDataType(hBand), 0, 0)) != CE_None) {
 					GMT_Report (GMT->parent, GMT_MSG_WARNING, "gmt_gdalread: GDALRasterIO failed to open band %d [err = %d]\n", i, gdal_code);
 					continue;
@@ -1231,11 +1273,6 @@ int gmt_gdalread (struct GMT_CTRL *GMT, char *gdal_filename, struct GMT_GDALREAD
 					z_min = adfMinMax[0];	z_max = adfMinMax[1];
 				}
 
-				/* In the "Preview" mode those guys below are different and what we need is the BufSize */
-				if (jump) {
-					nXSize[piece] = nBufXSize[piece];		nYSize = nBufYSize;
-				}
-
 				startColPos = indent + pad_w[piece] + i_x_nXYSize + (complex_mode > 1);	/* Take into account indent (for second piece), nBands, Padding and Complex */
 				nYSize_withPad = nYSize + pad_n + pad_s;
 
@@ -1443,6 +1480,11 @@ int gmt_gdalread (struct GMT_CTRL *GMT, char *gdal_filename, struct GMT_GDALREAD
 
 	gmtgdalread_populate_metadata (GMT, Ctrl, gdal_filename, got_R, nXSize[0]+nXSize[1], nYSize, dfULX, dfULY, dfLRX, dfLRY, z_min, z_max, first_layer);
 
+	if (jump) {	/* Raster was decimated on reading but the GeoTransform refers to the full resolution; recompute the increments */
+		Ctrl->hdr[7] = (Ctrl->hdr[1] - Ctrl->hdr[0]) / (nXSize[0] + nXSize[1]);
+		Ctrl->hdr[8] = (Ctrl->hdr[3] - Ctrl->hdr[2]) / nYSize;
+	}
+
 	gmtlib_GDALDestroyDriverManager(GMT->parent);
 
 	/* Return registration based on data type of the actually read first band.
@@ -52,8 +52,9 @@ int gmt_export_image(struct GMT_CTRL *GMT, char *fname, struct GMT_IMAGE *I) {
 	   The image format is inferred from the image name (in *fname) file extension,
 	   or optionally by appending =<driver> to the file name, where <driver> is a
 	   known GDAL driver. */
-	uint32_t row, col, band;
-	uint64_t k, ijk, b;
+	uint32_t band;
+	openmp_int row, col;
+	uint64_t k, ijk, b, ko;
 	bool     free_data = false;
 	char    *ext = NULL, *c = NULL, *pch = NULL;
 	unsigned char *data = NULL;
@@ -139,20 +140,28 @@ int gmt_export_image(struct GMT_CTRL *GMT, char *fname, struct GMT_IMAGE *I) {
 		to_GDALW->type = strdup("uint8");
 		if ((data = gmt_M_memory (GMT, NULL, I->header->nm * I->header->n_bands, char)) == NULL) return GMT_NOTSET;
 
-		for (k = band = 0; band < I->header->n_bands; band++) {
+		for (band = 0; band < I->header->n_bands; band++) {	/* De-interleave one band at a time, rows in parallel */
 			b = (uint64_t)band * I->header->size;
-			for (row = 0; row < I->header->n_rows; row++) {
-				for (col = 0; col < I->header->n_columns; col++) {
-					ijk = (uint64_t)col * I->header->my + row + I->header->pad[GMT_YHI] + b;
-					data[k++] = I->data[ijk];
-				}
+			ijk = (uint64_t)band * I->header->nm;
+#ifdef _OPENMP
+#pragma omp parallel for private(row,col,ko) shared(I,data,b,ijk)
+#endif
+			for (row = 0; row < (openmp_int)I->header->n_rows; row++) {
+				ko = ijk + (uint64_t)row * I->header->n_columns;
+				for (col = 0; col < (openmp_int)I->header->n_columns; col++)
+					data[ko + col] = I->data[(uint64_t)col * I->header->my + row + I->header->pad[GMT_YHI] + b];
 			}
 		}
 		if (I->alpha) {		/* We have a transparency layer */
 			if ((to_GDALW->alpha = gmt_M_memory(GMT, NULL, I->header->nm, char)) == NULL) return GMT_NOTSET;
-			for (k = row = 0; row < I->header->n_rows; row++)
-				for (col = 0; col < I->header->n_columns; col++)
-					to_GDALW->alpha[k++] = I->alpha[(uint64_t)col * I->header->my + row + I->header->pad[GMT_YHI]];
+#ifdef _OPENMP
+#pragma omp parallel for private(row,col,ko) shared(I,to_GDALW)
+#endif
+			for (row = 0; row < (openmp_int)I->header->n_rows; row++) {
+				ko = (uint64_t)row * I->header->n_columns;
+				for (col = 0; col < (openmp_int)I->header->n_columns; col++)
+					to_GDALW->alpha[ko + col] = I->alpha[(uint64_t)col * I->header->my + row + I->header->pad[GMT_YHI]];
+			}
 		}
 		free_data = true;
 	}
@@ -161,15 +170,21 @@ int gmt_export_image(struct GMT_CTRL *GMT, char *fname, struct GMT_IMAGE *I) {
 		to_GDALW->type = strdup("byte");
 		if (is_padded) {	/* Must remove the pad by */
 			if ((data = gmt_M_memory(GMT, NULL, I->header->nm * I->header->n_bands, char)) == NULL) return GMT_NOTSET;
-			for (row = 0; row < I->header->n_rows; row++) {
-				ijk = (uint64_t)(((row + I->header->pad[GMT_YHI]) * I->header->mx + I->header->pad[GMT_XLO]) * I->header->n_bands);
-				gmt_M_memcpy(&data[row*I->header->n_columns*I->header->n_bands], &(I->data[ijk]), I->header->n_columns*I->header->n_bands, char);
+#ifdef _OPENMP
+#pragma omp parallel for private(row,ijk) shared(I,data)
+#endif
+			for (row = 0; row < (openmp_int)I->header->n_rows; row++) {
+				ijk = (uint64_t)(((uint64_t)(row + I->header->pad[GMT_YHI]) * I->header->mx + I->header->pad[GMT_XLO]) * I->header->n_bands);
+				gmt_M_memcpy(&data[(uint64_t)row*I->header->n_columns*I->header->n_bands], &(I->data[ijk]), I->header->n_columns*I->header->n_bands, char);
 			}
 			if (I->alpha) {		/* We have a transparency layer */
 				if ((to_GDALW->alpha = gmt_M_memory(GMT, NULL, I->header->nm, char)) == NULL) return GMT_NOTSET;
-				for (row = 0; row < I->header->n_rows; row++) {
-					ijk = (uint64_t)((row + I->header->pad[GMT_YHI]) * I->header->mx + I->header->pad[GMT_XLO]);
-					gmt_M_memcpy(&to_GDALW->alpha[row*I->header->n_columns], &(I->alpha[ijk]), I->header->n_columns, char);
+#ifdef _OPENMP
+#pragma omp parallel for private(row,ijk) shared(I,to_GDALW)
+#endif
+				for (row = 0; row < (openmp_int)I->header->n_rows; row++) {
+					ijk = (uint64_t)((uint64_t)(row + I->header->pad[GMT_YHI]) * I->header->mx + I->header->pad[GMT_XLO]);
+					gmt_M_memcpy(&to_GDALW->alpha[(uint64_t)row*I->header->n_columns], &(I->alpha[ijk]), I->header->n_columns, char);
 				}
 			}
 			if (to_GDALW->P.ProjRefPROJ4) {
@@ -236,7 +251,7 @@ int gmt_export_image(struct GMT_CTRL *GMT, char *fname, struct GMT_IMAGE *I) {
 GMT_LOCAL int gmtgdalwrite_write_jp2(struct GMT_CTRL *GMT, struct GMT_GDALWRITE_CTRL *prhs, GDALRasterBandH hBand, void *data, int n_rows, int n_cols) {
 	int error = 0, i, j;
 	float *t = (float *)data;
-	uint64_t k, n, nm = gmt_M_get_nm(GMT, n_rows, n_cols);
+	uint64_t n, nm = gmt_M_get_nm(GMT, n_rows, n_cols);
 	/* In gmt_gdal_write_grd we made the pointer to point to the beginning of the non-padded zone, so to make it
 	   coherent we retrieve pad[XLO]. However, nothing of this is taking into account a -R subregion so all of this
 	   (and not only this case) will probably fail for that case.
@@ -245,10 +260,13 @@ GMT_LOCAL int gmtgdalwrite_write_jp2(struct GMT_CTRL *GMT, struct GMT_GDALWRITE_
 	if (prhs->orig_type == GMT_UCHAR) {
 		char *dataT = gmt_M_memory(GMT, NULL, nm, char);
 		if (dataT == NULL) return GMT_MEMORY_ERROR;
-		for (i = 0, k = 0; i < n_rows; i++) {
+#ifdef _OPENMP
+#pragma omp parallel for private(i,j,n) shared(n_rows,n_cols,prhs,dataT,t)
+#endif
+		for (i = 0; i < n_rows; i++) {
 			n = (uint64_t)i*prhs->nXSizeFull + prhs->pad[XLO];
 			for (j = 0; j < n_cols; j++)
-				dataT[k++] = (char)t[n + j];
+				dataT[(uint64_t)i*n_cols + j] = (char)t[n + j];
 		}
 		error = GDALRasterIO(hBand, GF_Write, 0, 0, n_cols, n_rows, dataT, n_cols, n_rows, GDT_Byte, 0, 0);
 		gmt_M_free(GMT, dataT);
@@ -256,10 +274,13 @@ GMT_LOCAL int gmtgdalwrite_write_jp2(struct GMT_CTRL *GMT, struct GMT_GDALWRITE_
 	else if (prhs->orig_type == GMT_USHORT) {
 		short int *dataT = gmt_M_memory(GMT, NULL, nm, unsigned short int);
 		if (dataT == NULL) return GMT_MEMORY_ERROR;
-		for (i = 0, k = 0; i < n_rows; i++) {
+#ifdef _OPENMP
+#pragma omp parallel for private(i,j,n) shared(n_rows,n_cols,prhs,dataT,t)
+#endif
+		for (i = 0; i < n_rows; i++) {
 			n = (uint64_t)i*prhs->nXSizeFull + prhs->pad[XLO];
 			for (j = 0; j < n_cols; j++)
-				dataT[k++] = (unsigned short int)t[n + j];
+				dataT[(uint64_t)i*n_cols + j] = (unsigned short int)t[n + j];
 		}
 		error = GDALRasterIO(hBand, GF_Write, 0, 0, n_cols, n_rows, dataT, n_cols, n_rows, GDT_UInt16, 0, 0);
 		gmt_M_free(GMT, dataT);
@@ -267,10 +288,13 @@ GMT_LOCAL int gmtgdalwrite_write_jp2(struct GMT_CTRL *GMT, struct GMT_GDALWRITE_
 	else if (prhs->orig_type == GMT_SHORT) {
 		short int *dataT = gmt_M_memory(GMT, NULL, nm, short int);
 		if (dataT == NULL) return GMT_MEMORY_ERROR;
-		for (i = 0, k = 0; i < n_rows; i++) {
+#ifdef _OPENMP
+#pragma omp parallel for private(i,j,n) shared(n_rows,n_cols,prhs,dataT,t)
+#endif
+		for (i = 0; i < n_rows; i++) {
 			n = (uint64_t)i*prhs->nXSizeFull + prhs->pad[XLO];
 			for (j = 0; j < n_cols; j++)
-				dataT[k++] = (short int)t[n + j];
+				dataT[(uint64_t)i*n_cols + j] = (short int)t[n + j];
 		}
 		error = GDALRasterIO(hBand, GF_Write, 0, 0, n_cols, n_rows, dataT, n_cols, n_rows, GDT_Int16, 0, 0);
 		gmt_M_free(GMT, dataT);
@@ -278,10 +302,13 @@ GMT_LOCAL int gmtgdalwrite_write_jp2(struct GMT_CTRL *GMT, struct GMT_GDALWRITE_
 	else if (prhs->orig_type == GMT_UINT) {
 		unsigned int *dataT = gmt_M_memory(GMT, NULL, nm, unsigned int);
 		if (dataT == NULL) return GMT_MEMORY_ERROR;
-		for (i = 0, k = 0; i < n_rows; i++) {
+#ifdef _OPENMP
+#pragma omp parallel for private(i,j,n) shared(n_rows,n_cols,prhs,dataT,t)
+#endif
+		for (i = 0; i < n_rows; i++) {
 			n = (uint64_t)i*prhs->nXSizeFull + prhs->pad[XLO];
 			for (j = 0; j < n_cols; j++)
-				dataT[k++] = (unsigned int)t[n + j];
+				dataT[(uint64_t)i*n_cols + j] = (unsigned int)t[n + j];
 		}
 		error = GDALRasterIO(hBand, GF_Write, 0, 0, n_cols, n_rows, dataT, n_cols, n_rows, GDT_UInt32, 0, 0);
 		gmt_M_free(GMT, dataT);
@@ -289,10 +316,13 @@ GMT_LOCAL int gmtgdalwrite_write_jp2(struct GMT_CTRL *GMT, struct GMT_GDALWRITE_
 	else if (prhs->orig_type == GMT_INT) {
 		int *dataT = gmt_M_memory(GMT, NULL, nm, int);
 		if (dataT == NULL) return GMT_MEMORY_ERROR;
-		for (i = 0, k = 0; i < n_rows; i++) {
+#ifdef _OPENMP
+#pragma omp parallel for private(i,j,n) shared(n_rows,n_cols,prhs,dataT,t)
+#endif
+		for (i = 0; i < n_rows; i++) {
 			n = (uint64_t)i*prhs->nXSizeFull + prhs->pad[XLO];
 			for (j = 0; j < n_cols; j++)
-				dataT[k++] = (int)t[n + j];
+				dataT[(uint64_t)i*n_cols + j] = (int)t[n + j];
 		}
 		error = GDALRasterIO(hBand, GF_Write, 0, 0, n_cols, n_rows, dataT, n_cols, n_rows, GDT_Int32, 0, 0);
 		gmt_M_free(GMT, dataT);
@@ -318,9 +348,9 @@ int gmt_gdalwrite(struct GMT_CTRL *GMT, char *fname, struct GMT_GDALWRITE_CTRL *
 	int  n_cols, n_rows, i, error = GMT_NOERROR;
 	int  typeCLASS, typeCLASS_f, nColors, n_byteOffset, n_bands, registration;
 	int  is_geog = 0, gdal_err = 0;
-	uint64_t nn, ijk = 0;
+	uint64_t ijk = 0;
 	void *data = NULL;
-	unsigned char *outByte = NULL, *img = NULL, *tmpByte = NULL;
+	unsigned char *img = NULL, *tmpByte = NULL;
 	float *ptr = NULL;
 
 	if (prhs->driver) pszFormat = prhs->driver;		/* Otherwise use the default GTiff format */
@@ -338,10 +368,8 @@ int gmt_gdalwrite(struct GMT_CTRL *GMT, char *fname, struct GMT_GDALWRITE_CTRL *
 	/* Find out in which data type was given the input array */
 	/* The two first cases below are messy. Decision should be made by a mem layout code stored in prhs */
 	if (!strcmp(prhs->type,"byte")) {		/* This case arrives here via grdimage */
-		uint64_t imsize = gmt_M_get_nm(GMT, n_cols, n_rows);
 		typeCLASS = GDT_Byte;
 		n_byteOffset = 1;
-		if ((outByte = gmt_M_memory(GMT, NULL, imsize, unsigned char)) == NULL) return GMT_NOTSET;
 	}
 	else if (!strcmp(prhs->type,"uint8")) {
 		typeCLASS = GDT_Byte;
@@ -382,7 +410,6 @@ int gmt_gdalwrite(struct GMT_CTRL *GMT, char *fname, struct GMT_GDALWRITE_CTRL *
 		else if (prhs->orig_type == GMT_INT)    typeCLASS_f = GDT_UInt32;
 		else {
 			GMT_Report(GMT->parent, GMT_MSG_ERROR, "gmt_gdalwrite: The Jpeg2000 driver does not support floats.\n");
-			gmt_M_free(GMT, outByte);
 			return -1;
 		}
 	}
@@ -480,7 +507,6 @@ int gmt_gdalwrite(struct GMT_CTRL *GMT, char *fname, struct GMT_GDALWRITE_CTRL *
 			}
 		}
 		gmtlib_GDALDestroyDriverManager(GMT->parent);
-		gmt_M_free(GMT, outByte);
 		return(-1);
 	}
 
@@ -493,7 +519,6 @@ int gmt_gdalwrite(struct GMT_CTRL *GMT, char *fname, struct GMT_GDALWRITE_CTRL *
 	if (hDstDS == NULL) {
 		GMT_Report(GMT->parent, GMT_MSG_ERROR, "GDALOpen failed - %d\n%s\n", CPLGetLastErrorNo(), CPLGetLastErrorMsg());
 		gmtlib_GDALDestroyDriverManager(GMT->parent);
-		gmt_M_free(GMT, outByte);
 		return (-1);
 	}
 	GDALSetGeoTransform(hDstDS, adfGeoTransform);
@@ -559,13 +584,11 @@ int gmt_gdalwrite(struct GMT_CTRL *GMT, char *fname, struct GMT_GDALWRITE_CTRL *
 					GDALSetRasterNoDataValue(hBand, prhs->nan_value);
 				if (!strcmp(prhs->type, "byte")) {
 					/* This case arrives here from a separate path. It started in grdimage and an originally
-					   data was in uchar but padded and possibly 3D (RGB) */
-					uint64_t imsize = gmt_M_get_nm(GMT, n_cols, n_rows);
+					   data was in uchar but padded and possibly 3D (RGB).  The array is pixel-interleaved so we
+					   pass the pixel and line spacings and let GDALRasterIO pick out this band directly instead
+					   of gathering it into an intermediate band copy first. */
 					tmpByte = (unsigned char *)data;
-					for (nn = 0; nn < imsize; nn++)
-						outByte[nn] = tmpByte[nn*n_bands + i];
-
-					if ((gdal_err = GDALRasterIO(hBand, GF_Write, 0, 0, n_cols, n_rows, outByte, n_cols, n_rows, typeCLASS, 0, 0)) != CE_None)
+					if ((gdal_err = GDALRasterIO(hBand, GF_Write, 0, 0, n_cols, n_rows, &tmpByte[i], n_cols, n_rows, typeCLASS, n_bands, n_bands * n_cols)) != CE_None)
 						GMT_Report(GMT->parent, GMT_MSG_ERROR, "GDALRasterIO failed to write band %d [err = %d]\n", i, gdal_err);
 				}
 				else {
@@ -623,7 +646,6 @@ int gmt_gdalwrite(struct GMT_CTRL *GMT, char *fname, struct GMT_GDALWRITE_CTRL *
 		if (error) GMT_Report(GMT->parent,GMT_MSG_ERROR,"Error adding history: %d\n", error);
 	}
 
-	gmt_M_free(GMT, outByte);
 	if (pszSRS_WKT != NULL) CPLFree(pszSRS_WKT);
 	if (papszOptions != NULL) CSLDestroy(papszOptions);
 	gmtlib_GDALDestroyDriverManager(GMT->parent);
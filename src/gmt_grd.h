@@ -186,6 +186,16 @@ enum gmt_enum_wesnids {
 /* The usage could be:
 	gmt_M_grd_loop (GMT, Grid, row, col, node) fprintf (stderr, "Value at row = %d and col = %d is %g\n", row, col, Grid->data[node]);
 */
+
+/*! As gmt_M_grd_loop, but visits the grid one contiguous row span at a time: zp is set to the first of
+ * the n_columns data nodes in the current row.  Within the row the nodes have unit stride and no pad-aware
+ * index math, so a tight inner loop over zp[0..n_columns-1] addresses a bare array and can be vectorized
+ * by the compiler.  Use it when the work per node needs neither col nor the global node index. */
+#define gmt_M_grd_span_loop(C,G,row,zp) for (row = 0, zp = G->data + gmt_M_ijp (G->header, 0, 0); row < (openmp_int)G->header->n_rows; row++, zp += G->header->mx)
+
+/* The usage could be:
+	gmt_M_grd_span_loop (GMT, Grid, row, zp) for (col = 0; col < (openmp_int)Grid->header->n_columns; col++) zp[col] *= scale;
+*/
 /* The gmt_M_y_is_outside macro returns true if y is outside the given domain.
  * For gmt_x_is_outside, see the function in gmt_support.c since we must also deal with longitude periodicity.
  */
@@ -67,14 +67,22 @@
  *	gmt_grd_mux_demux
  *	gmt_grd_pad_off
  *	gmt_grd_pad_on
+ *	gmt_grd_halve
  *	gmt_grd_pad_status
  *	gmt_grd_pad_zero
  *	gmt_grd_prep_io
+ *	gmt_grd_pyramid_name
+ *	gmt_grd_pyramid_select
+ *	gmt_grd_reduce
+ *	gmt_grd_row_pipeline
  *	gmt_grd_set_cartesian
  *	gmt_grd_set_datapadding
  *	gmt_grd_set_ij_inc
  *	gmt_grd_setregion
  *	gmt_grd_shift
+ *	gmt_grd_sketch
+ *	gmt_grd_sketch_cdf
+ *	gmt_grd_sketch_quantile
  *	gmt_grd_zminmax
  *	gmt_grdcube_info_syntax
  *	gmt_grid_perimeter
@@ -114,6 +122,10 @@
 #include "gmt_dev.h"
 #include "gmt_internals.h"
 
+#ifdef HAVE_ZLIB
+#	include <zlib.h>
+#endif
+
 struct GRD_PAD {	/* Local structure */
 	double wesn[4];
 	unsigned int pad[4];
@@ -1555,6 +1567,273 @@ int gmt_update_grd_info (struct GMT_CTRL *GMT, char *file, struct GMT_GRID_HEADE
 	return ((*GMT->session.updateinfo[header->type]) (GMT, header));
 }
 
+#define GMT_GRDCACHE_DEF_LIMIT 268435456U	/* Default grid cache capacity of 256 Mb unless GMT_GRID_CACHE gives a size in Mb */
+
+GMT_LOCAL struct GMT_GRDCACHE *gmtgrdio_grdcache (struct GMT_CTRL *GMT) {
+	/* Return the session grid cache, checking the environment on the first call.
+	 * Returns NULL when the cache is not enabled. */
+	char *env = NULL;
+	struct GMT_GRDCACHE *C = GMT->session.grdcache;
+	if (C == NULL) {	/* First time here; see if the user requested the cache */
+		C = GMT->session.grdcache = gmt_M_memory (GMT, NULL, 1, struct GMT_GRDCACHE);
+		if ((env = getenv ("GMT_GRID_CACHE")) && strcmp (env, "off")) {
+			double limit_Mb = atof (env);	/* Optionally the cache capacity in Mb */
+			C->limit = (limit_Mb > 0.0) ? (size_t)(limit_Mb * 1048576.0) : GMT_GRDCACHE_DEF_LIMIT;
+			GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Session grid cache enabled with capacity %" PRIuS " bytes\n", C->limit);
+		}
+	}
+	return (C->limit) ? C : NULL;
+}
+
+GMT_LOCAL void gmtgrdio_grdcache_key (struct GMT_GRID_HEADER *header, double *wesn, unsigned int *pad, int complex_mode, char *key) {
+	/* Build the signature identifying one particular read of this file.  By the time we are called,
+	 * gmt_grd_get_format has stripped any =<id> and +s|o|n modifiers from the file name into the
+	 * type and packing fields, so those must be part of the key too: the same file read with
+	 * different packing holds different (packed) values in the array. */
+	struct GMT_GRID_HEADER_HIDDEN *HH = gmt_get_H_hidden (header);
+	snprintf (key, PATH_MAX, "%s|%s|%.12g/%.12g/%.12g/%.12g|%u/%u/%u/%u|%d|%u|%.12g/%.12g/%.12g", HH->name, HH->varname,
+		wesn[XLO], wesn[XHI], wesn[YLO], wesn[YHI], pad[XLO], pad[XHI], pad[YLO], pad[YHI], complex_mode,
+		header->type, header->z_scale_factor, header->z_add_offset, (double)header->nan_value);
+}
+
+GMT_LOCAL void gmtgrdio_grdcache_drop (struct GMT_CTRL *GMT, struct GMT_GRDCACHE *C, unsigned int k) {
+	/* Release one cache slot and its private copies */
+	C->used -= (C->slot[k].n_comp) ? C->slot[k].n_comp : C->slot[k].n_bytes;
+	gmt_M_str_free (C->slot[k].key);
+	gmt_M_free (GMT, C->slot[k].data);
+	gmt_free_header (GMT, &C->slot[k].header);
+	gmt_M_memset (&C->slot[k], 1, struct GMT_GRDCACHE_SLOT);
+}
+
+GMT_LOCAL bool gmtgrdio_grdcache_expand (struct GMT_CTRL *GMT, struct GMT_GRDCACHE *C, unsigned int k, gmt_grdfloat *grid) {
+	/* Restore the padded array held in slot k into grid, inflating it first if it was stored
+	 * deflated.  Returns false (after dropping the slot) if the stream cannot be decoded. */
+	struct GMT_GRDCACHE_SLOT *S = &C->slot[k];
+	if (S->n_comp) {	/* Stored as a deflated stream; inflate straight into the destination array */
+#ifdef HAVE_ZLIB
+		uLongf raw_len = (uLongf)S->n_bytes;
+		if (uncompress ((Bytef *)grid, &raw_len, (const Bytef *)S->data, (uLong)S->n_comp) != Z_OK || (size_t)raw_len != S->n_bytes) {
+			GMT_Report (GMT->parent, GMT_MSG_WARNING, "Failed to inflate cached grid %s; rereading the file\n", S->key);
+			gmtgrdio_grdcache_drop (GMT, C, k);
+			return false;
+		}
+#else		/* Cannot happen since only zlib builds deflate, but a deflated slot is useless without it */
+		gmtgrdio_grdcache_drop (GMT, C, k);
+		return false;
+#endif
+	}
+	else
+		gmt_M_memcpy (grid, S->data, S->header->size, gmt_grdfloat);
+	return true;
+}
+
+GMT_LOCAL bool gmtgrdio_grdcache_fetch (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header, gmt_grdfloat *grid, double *wesn, unsigned int *pad, int complex_mode) {
+	/* If this exact read was cached then replay it from memory: restore the header and the
+	 * padded array exactly as the reader left them and return true.  A stale copy (the file
+	 * changed on disk since it was cached) is dropped and we return false to force a read. */
+	char key[PATH_MAX] = {""};
+	unsigned int k, type;
+	double z_scale_factor, z_add_offset;
+	gmt_grdfloat nan_value;
+	struct stat buf;
+	struct GMT_GRDCACHE *C = NULL;
+	struct GMT_GRDCACHE_SLOT *S = NULL;
+	struct GMT_GRID_HEADER_HIDDEN *HH = gmt_get_H_hidden (header);
+
+	if ((C = gmtgrdio_grdcache (GMT)) == NULL) return false;
+	if (complex_mode || HH->data_offset) return false;	/* Only plain real reads are cached */
+	gmtgrdio_grdcache_key (header, wesn, pad, complex_mode, key);
+	for (k = 0; k < GMT_GRDCACHE_N_SLOTS; k++)
+		if (C->slot[k].key && !strcmp (C->slot[k].key, key)) break;
+	if (k == GMT_GRDCACHE_N_SLOTS) return false;	/* Not cached */
+	S = &C->slot[k];
+	if (stat (HH->name, &buf) || (int64_t)buf.st_mtime != S->mtime) {	/* File has changed on disk */
+		gmtgrdio_grdcache_drop (GMT, C, k);
+		return false;
+	}
+	if (!gmtgrdio_grdcache_expand (GMT, C, k, grid)) return false;	/* Slot was corrupt and has been dropped */
+	type = header->type;	z_scale_factor = header->z_scale_factor;	/* The key already guarantees these match the */
+	z_add_offset = header->z_add_offset;	nan_value = header->nan_value;	/* slot, but the unpack below must use what the */
+	gmt_copy_gridheader (GMT, header, S->header);			/* caller requested, never what the cached read left behind */
+	header->type = type;	header->z_scale_factor = z_scale_factor;
+	header->z_add_offset = z_add_offset;	header->nan_value = nan_value;
+	S->last_use = ++C->counter;
+	GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Grid cache hit for %s\n", HH->name);
+	return true;
+}
+
+GMT_LOCAL void gmtgrdio_grdcache_insert (struct GMT_CTRL *GMT, struct GMT_GRDCACHE *C, char *key, struct GMT_GRID_HEADER *header, gmt_grdfloat *grid, int64_t mtime) {
+	/* Place a private copy of this grid in a free (or evicted least-recently-used) slot under the given key.
+	 * With zlib available the copy is kept deflated (unless incompressible) so the same byte budget
+	 * holds several times more grids; the copy is inflated again on a cache hit. */
+	unsigned int k, j, oldest;
+	size_t n_bytes = header->size * sizeof (gmt_grdfloat), n_comp = 0, n_held;
+	gmt_grdfloat *copy = NULL;
+	struct GMT_GRDCACHE_SLOT *S = NULL;
+
+#ifdef HAVE_ZLIB
+	{	/* Try to deflate the array; fastest level since grids of floats rarely reward higher effort */
+		uLongf comp_len = compressBound ((uLong)n_bytes);
+		copy = gmt_M_memory (GMT, NULL, comp_len, char);
+		if (compress2 ((Bytef *)copy, &comp_len, (const Bytef *)grid, (uLong)n_bytes, Z_BEST_SPEED) == Z_OK && (size_t)comp_len < n_bytes) {
+			copy = gmt_M_memory (GMT, copy, comp_len, char);	/* Shrink the buffer to the deflated size */
+			n_comp = comp_len;
+			GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Deflated grid %s from %" PRIuS " to %" PRIuS " bytes for caching\n", key, n_bytes, n_comp);
+		}
+		else	/* Incompressible (or a zlib error); fall back on caching the raw floats below */
+			gmt_M_free (GMT, copy);
+	}
+#endif
+	if (copy == NULL) {	/* Keep a raw copy of the padded array */
+		copy = gmt_M_memory (GMT, NULL, header->size, gmt_grdfloat);
+		gmt_M_memcpy (copy, grid, header->size, gmt_grdfloat);
+	}
+	n_held = (n_comp) ? n_comp : n_bytes;
+	if (n_held > C->limit) {	/* Would never fit */
+		gmt_M_free (GMT, copy);
+		return;
+	}
+	for (k = 0; k < GMT_GRDCACHE_N_SLOTS && C->slot[k].key; k++);	/* Find first free slot */
+	if (k == GMT_GRDCACHE_N_SLOTS) {	/* All slots taken; evict the least recently used one */
+		for (j = 1, oldest = 0; j < GMT_GRDCACHE_N_SLOTS; j++)
+			if (C->slot[j].last_use < C->slot[oldest].last_use) oldest = j;
+		gmtgrdio_grdcache_drop (GMT, C, oldest);
+		k = oldest;
+	}
+	while (C->used + n_held > C->limit) {	/* Evict least recently used entries until the new grid fits */
+		for (j = 0, oldest = GMT_GRDCACHE_N_SLOTS; j < GMT_GRDCACHE_N_SLOTS; j++)
+			if (C->slot[j].key && (oldest == GMT_GRDCACHE_N_SLOTS || C->slot[j].last_use < C->slot[oldest].last_use)) oldest = j;
+		if (oldest == GMT_GRDCACHE_N_SLOTS) {	/* Should not happen, but avoid spinning */
+			gmt_M_free (GMT, copy);
+			return;
+		}
+		gmtgrdio_grdcache_drop (GMT, C, oldest);
+	}
+	S = &C->slot[k];
+	S->key = strdup (key);
+	S->data = copy;
+	S->header = gmt_get_header (GMT);
+	gmt_copy_gridheader (GMT, S->header, header);
+	S->n_bytes = n_bytes;
+	S->n_comp = n_comp;
+	S->mtime = mtime;
+	S->last_use = ++C->counter;
+	C->used += n_held;
+	GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Cached grid %s [cache now holds %" PRIuS " of %" PRIuS " bytes]\n", key, C->used, C->limit);
+}
+
+GMT_LOCAL void gmtgrdio_grdcache_store (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header, gmt_grdfloat *grid, double *wesn, unsigned int *pad, int complex_mode) {
+	/* Keep a private copy of a completed read so identical later reads can skip the file */
+	char key[PATH_MAX] = {""};
+	struct stat buf;
+	struct GMT_GRDCACHE *C = NULL;
+	struct GMT_GRID_HEADER_HIDDEN *HH = gmt_get_H_hidden (header);
+
+	if ((C = gmtgrdio_grdcache (GMT)) == NULL) return;
+	if (complex_mode || HH->data_offset) return;	/* Only plain real reads are cached */
+	if (stat (HH->name, &buf)) return;	/* Cannot detect later file changes without a time stamp, so skip */
+	gmtgrdio_grdcache_key (header, wesn, pad, complex_mode, key);
+	gmtgrdio_grdcache_insert (GMT, C, key, header, grid, (int64_t)buf.st_mtime);
+}
+
+struct GMT_GRID *gmtlib_grdcache_fetch_derived (struct GMT_CTRL *GMT, const char *source, const char *spec) {
+	/* Return a freshly registered copy of a grid previously derived from the source file (e.g., a
+	 * resampled or gradient grid), or NULL when it was not cached (or the cache is not enabled).
+	 * The spec string must encode everything besides the source contents that went into the
+	 * derivation; staleness of the source is detected via its time stamp as for plain reads. */
+	char key[PATH_MAX] = {""};
+	unsigned int k;
+	struct stat buf;
+	struct GMT_GRDCACHE *C = NULL;
+	struct GMT_GRDCACHE_SLOT *S = NULL;
+	struct GMT_GRID *G = NULL;
+
+	if ((C = gmtgrdio_grdcache (GMT)) == NULL) return NULL;
+	snprintf (key, PATH_MAX, "derived|%s|%s", source, spec);
+	for (k = 0; k < GMT_GRDCACHE_N_SLOTS; k++)
+		if (C->slot[k].key && !strcmp (C->slot[k].key, key)) break;
+	if (k == GMT_GRDCACHE_N_SLOTS) return NULL;	/* Not cached */
+	S = &C->slot[k];
+	if (stat (source, &buf) || (int64_t)buf.st_mtime != S->mtime) {	/* Source file has changed on disk */
+		gmtgrdio_grdcache_drop (GMT, C, k);
+		return NULL;
+	}
+	if ((G = GMT_Create_Data (GMT->parent, GMT_IS_GRID, GMT_IS_SURFACE, GMT_CONTAINER_AND_DATA, NULL, S->header->wesn,
+	                          S->header->inc, S->header->registration, GMT_PAD_DEFAULT, NULL)) == NULL) return NULL;
+	if (G->header->size != S->header->size) {	/* Pad settings have changed since this was cached */
+		GMT_Destroy_Data (GMT->parent, &G);
+		gmtgrdio_grdcache_drop (GMT, C, k);
+		return NULL;
+	}
+	if (!gmtgrdio_grdcache_expand (GMT, C, k, G->data)) {	/* Slot was corrupt and has been dropped */
+		GMT_Destroy_Data (GMT->parent, &G);
+		return NULL;
+	}
+	gmt_copy_gridheader (GMT, G->header, S->header);
+	S->last_use = ++C->counter;
+	GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Grid cache hit for derived grid %s\n", key);
+	return G;
+}
+
+void gmtlib_grdcache_store_derived (struct GMT_CTRL *GMT, const char *source, const char *spec, struct GMT_GRID *G) {
+	/* Keep a private copy of a grid derived from the source file so later identical derivations can be skipped */
+	char key[PATH_MAX] = {""};
+	struct stat buf;
+	struct GMT_GRDCACHE *C = NULL;
+
+	if ((C = gmtgrdio_grdcache (GMT)) == NULL) return;
+	if (stat (source, &buf)) return;	/* Cannot detect later source changes without a time stamp, so skip */
+	snprintf (key, PATH_MAX, "derived|%s|%s", source, spec);
+	gmtgrdio_grdcache_insert (GMT, C, key, G->header, G->data, (int64_t)buf.st_mtime);
+}
+
+GMT_LOCAL void gmtgrdio_grdcache_store_write (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header, gmt_grdfloat *grid, double *wesn, unsigned int *pad, int complex_mode) {
+	/* Write-through caching: after writing a full grid we keep a copy under the key a later
+	 * default read of the same file would use, so a module chain that writes an intermediate
+	 * grid and reads it back in the same session replays it from memory instead of the file.
+	 * The copy is taken while the array still holds the packed (file) values, exactly as a
+	 * reader would see them before unpacking.  We only cache when the replay is identical to
+	 * a real read: full region, no complex layout, the writer's pad equal to the session read
+	 * pad, and a float or double file format (integer formats quantize on output). */
+	char key[PATH_MAX] = {""};
+	unsigned int k;
+	struct stat buf;
+	struct GMT_GRDCACHE *C = NULL;
+	struct GMT_GRID_HEADER_HIDDEN *HH = gmt_get_H_hidden (header);
+
+	if ((C = gmtgrdio_grdcache (GMT)) == NULL) return;
+	if (complex_mode || HH->data_offset) return;	/* Only plain real layouts are cached */
+	if (wesn && !(wesn[XLO] == wesn[XHI] && wesn[YLO] == wesn[YHI])) return;	/* Only full-grid writes */
+	for (k = 0; k < 4; k++) if (pad[k] != GMT->current.io.pad[k]) return;	/* Layout differs from what a default read yields */
+	if (strchr ("fd", GMT->session.grdformat[header->type][1]) == NULL) return;	/* File type does not hold the values losslessly */
+	if (stat (HH->name, &buf)) return;	/* Cannot detect later file changes without a time stamp, so skip */
+	gmtgrdio_grdcache_key (header, header->wesn, pad, complex_mode, key);
+	gmtgrdio_grdcache_insert (GMT, C, key, header, grid, (int64_t)buf.st_mtime);
+}
+
+GMT_LOCAL void gmtgrdio_grdcache_invalidate (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header) {
+	/* Drop any cached reads of a file we are about to overwrite */
+	size_t len;
+	unsigned int k;
+	struct GMT_GRDCACHE *C = GMT->session.grdcache;
+	struct GMT_GRID_HEADER_HIDDEN *HH = gmt_get_H_hidden (header);
+	if (C == NULL || C->limit == 0) return;
+	len = strlen (HH->name);
+	for (k = 0; k < GMT_GRDCACHE_N_SLOTS; k++)
+		if (C->slot[k].key && !strncmp (C->slot[k].key, HH->name, len) && C->slot[k].key[len] == '|')
+			gmtgrdio_grdcache_drop (GMT, C, k);
+}
+
+void gmtlib_grdcache_free (struct GMT_CTRL *GMT) {
+	/* Release the session grid cache, if it was ever looked at */
+	unsigned int k;
+	struct GMT_GRDCACHE *C = GMT->session.grdcache;
+	if (C == NULL) return;
+	for (k = 0; k < GMT_GRDCACHE_N_SLOTS; k++)
+		if (C->slot[k].key) gmtgrdio_grdcache_drop (GMT, C, k);
+	gmt_M_free (GMT, GMT->session.grdcache);
+}
+
 int gmtlib_read_grd (struct GMT_CTRL *GMT, char *file, struct GMT_GRID_HEADER *header, gmt_grdfloat *pgrid, double *wesn, unsigned int *pad, int complex_mode) {
 	/* file:	- IGNORED -
 	 * header:	grid structure header
@@ -1572,6 +1851,7 @@ int gmtlib_read_grd (struct GMT_CTRL *GMT, char *file, struct GMT_GRID_HEADER *h
 	struct GMT_GRID_HEADER_HIDDEN *HH = gmt_get_H_hidden (header);
 	gmt_grdfloat *grid = pgrid + HH->data_offset;	/* This can be nonzero when grdpaste is reading */
 
+	gmt_M_tic (GMT, GMT_TIMING_GRDIO);
 	complex_mode &= GMT_GRID_IS_COMPLEX_MASK;	/* Remove any non-complex flags */
 	/* If we are reading a 2nd grid (e.g., real, then imag) we must update info about the file since it will be a different file */
 	if (header->complex_mode && (header->complex_mode & complex_mode) == 0) gmt_M_err_trap (gmt_grd_get_format (GMT, file, header, true));
@@ -1581,7 +1861,10 @@ int gmtlib_read_grd (struct GMT_CTRL *GMT, char *file, struct GMT_GRID_HEADER *h
 	if ((err = gmt_grd_layout (GMT, header, grid, complex_mode & GMT_GRID_IS_COMPLEX_MASK, GMT_IN)))	/* Deal with complex layout */
 		return err;
 
-	gmt_M_err_trap ((*GMT->session.readgrd[header->type]) (GMT, header, grid, P.wesn, P.pad, complex_mode));
+	if (!gmtgrdio_grdcache_fetch (GMT, header, grid, P.wesn, P.pad, complex_mode)) {	/* Not in the session cache; read the file */
+		gmt_M_err_trap ((*GMT->session.readgrd[header->type]) (GMT, header, grid, P.wesn, P.pad, complex_mode));
+		gmtgrdio_grdcache_store (GMT, header, grid, P.wesn, P.pad, complex_mode);
+	}
 
 	if (header->z_min == DBL_MAX && header->z_max == -DBL_MAX) /* No valid data values in the grid */
 		header->z_min = header->z_max = NAN;
@@ -1592,8 +1875,10 @@ int gmtlib_read_grd (struct GMT_CTRL *GMT, char *file, struct GMT_GRID_HEADER *h
 	HH->grdtype = gmtlib_get_grdtype (GMT, GMT_IN, header);	/* Since may change if a subset */
 	if (expand) gmt_grd_zminmax (GMT, header, grid);	/* Reset min/max since current extrema includes the padded region */
 	gmtgrdio_pack_grid (GMT, header, grid, k_grd_unpack); /* revert scale and offset */
+	HH->data_generation++;	/* Fresh data array contents; see gmt_grd_dirty */
 	gmt_BC_init (GMT, header);	/* Initialize grid interpolation and boundary condition parameters */
 
+	gmt_M_toc (GMT, GMT_TIMING_GRDIO);
 	return (GMT_NOERROR);
 }
 
@@ -1610,6 +1895,7 @@ int gmtlib_write_grd (struct GMT_CTRL *GMT, char *file, struct GMT_GRID_HEADER *
 
 	int err = GMT_OK;	/* Implied by gmt_M_err_trap */
 
+	gmt_M_tic (GMT, GMT_TIMING_GRDIO);
 	gmt_M_err_trap (gmt_grd_get_format (GMT, file, header, false));
 	gmtgrdio_pack_grid (GMT, header, grid, k_grd_pack); /* scale and offset */
 	gmtgrdio_grd_xy_scale (GMT, header, GMT_OUT);	/* Possibly scale wesn,inc */
@@ -1617,8 +1903,11 @@ int gmtlib_write_grd (struct GMT_CTRL *GMT, char *file, struct GMT_GRID_HEADER *
 	if ((err = gmt_grd_layout (GMT, header, grid, complex_mode, GMT_OUT)))	/* Deal with complex layout */
 		return (err);
 	gmtgrdio_grd_check_consistency (GMT, header, grid);			/* Fix east repeating columns and polar values */
+	gmtgrdio_grdcache_invalidate (GMT, header);	/* Any cached reads of this file are about to go stale */
 	err = (*GMT->session.writegrd[header->type]) (GMT, header, grid, wesn, pad, complex_mode);
+	if (err == GMT_NOERROR) gmtgrdio_grdcache_store_write (GMT, header, grid, wesn, pad, complex_mode);	/* Let a later in-session read of this file skip the file */
 	if (GMT->parent->leave_grid_scaled == 0) gmtgrdio_pack_grid (GMT, header, grid, k_grd_unpack); /* revert scale and offset to leave grid as it was before writing unless session originated from gm*/
+	gmt_M_toc (GMT, GMT_TIMING_GRDIO);
 	return (err);
 }
 
@@ -2836,6 +3125,7 @@ void gmt_grd_pad_off (struct GMT_CTRL *GMT, struct GMT_GRID *G) {
 	}
 	gmt_M_memset (G->header->pad, 4, int);	/* Pad is no longer active */
 	gmt_set_grddim (GMT, G->header);		/* Update all dimensions to reflect the padding */
+	gmt_grd_dirty (G);	/* Data moved; any boundary fill is stale */
 }
 
 void gmt_grd_pad_on (struct GMT_CTRL *GMT, struct GMT_GRID *G, unsigned int *pad) {
@@ -2881,6 +3171,7 @@ void gmt_grd_pad_on (struct GMT_CTRL *GMT, struct GMT_GRID *G, unsigned int *pad
 		gmtgrdio_pad_grd_on_sub (GMT, G, h, G->data);	/* Add pad around real component */
 	gmt_M_free (GMT, h->hidden);	/* Done with this header hidden struct */
 	gmt_M_free (GMT, h);	/* Done with this header */
+	gmt_grd_dirty (G);	/* Data moved; any boundary fill is stale */
 }
 
 void gmt_grd_pad_zero (struct GMT_CTRL *GMT, struct GMT_GRID *G) {
@@ -2905,6 +3196,17 @@ void gmt_grd_pad_zero (struct GMT_CTRL *GMT, struct GMT_GRID *G) {
 	if (is_complex && (G->header->complex_mode & GMT_GRID_IS_COMPLEX_IMAG))
 		gmtgrdio_pad_grd_zero_sub (G, &G->data[G->header->size/2]);
 	gmt_M_memset (HH->BC, 4U, int);	/* BCs no longer set for this grid */
+	gmt_grd_dirty (G);	/* Pad content changed; any boundary fill is stale */
+}
+
+void gmt_grd_dirty (struct GMT_GRID *G) {
+	/* Flag that the data array of G has changed since gmt_grd_BC_set last filled the pad.
+	 * BC_set compares this generation counter with the one recorded at its last fill and
+	 * skips the edge traversal when they still match, so code that writes to G->data and
+	 * expects fresh boundary conditions must call this (the central read, pad, and BC
+	 * routines already do). */
+	struct GMT_GRID_HEADER_HIDDEN *HH = gmt_get_H_hidden (G->header);
+	HH->data_generation++;
 }
 
 struct GMT_GRID *gmt_get_grid (struct GMT_CTRL *GMT) {
@@ -2983,6 +3285,7 @@ void gmt_free_header (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER **header) {
 		gmt_M_str_free (h->ProjRefPROJ4);
 	}
 	gmt_M_str_free (HH->pocket);
+	gmt_M_free (GMT, HH->sketch);
 	if (HH->title)   gmt_M_str_free (HH->title);
 	if (HH->command) gmt_M_str_free (HH->command);
 	if (HH->remark)  gmt_M_str_free (HH->remark);
@@ -3111,23 +3414,145 @@ void gmt_cube_vminmax (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *h, gmt_grdf
 	if (n == 0) h->z_min = h->z_max = GMT->session.d_NaN;	/* No non-NaNs in the entire grid */
 }
 
+uint64_t gmt_grd_reduce (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *h, gmt_grdfloat *z, double *z_min, double *z_max, double *z_sum, double *z_sum2) {
+	/* NaN-aware reduction over the interior of the grid: minimum, maximum, sum and sum of squares
+	 * of the non-NaN nodes.  Any of the four output pointers may be NULL if that quantity is not
+	 * wanted (mean is *z_sum divided by the returned count).  The rows are split into bands across
+	 * the available threads, and the extrema updates are written so that a NaN fails both compares;
+	 * only the counted sums need the NaN test, which leaves the inner loop free of control flow a
+	 * vectorizing compiler cannot turn into masked compares.  Returns the number of non-NaN nodes;
+	 * all requested outputs are set to NaN when that count is zero. */
+	openmp_int prow;
+	int t, n_threads = 1;
+	uint64_t n = 0, *p_n = NULL;
+	double vmin = DBL_MAX, vmax = -DBL_MAX, sum = 0.0, sum2 = 0.0;
+	double *p_min = NULL, *p_max = NULL, *p_sum = NULL, *p_sum2 = NULL;
+
+#ifdef _OPENMP
+	n_threads = omp_get_max_threads ();
+#endif
+	p_min  = gmt_M_memory (GMT, NULL, n_threads, double);
+	p_max  = gmt_M_memory (GMT, NULL, n_threads, double);
+	p_sum  = gmt_M_memory (GMT, NULL, n_threads, double);
+	p_sum2 = gmt_M_memory (GMT, NULL, n_threads, double);
+	p_n    = gmt_M_memory (GMT, NULL, n_threads, uint64_t);
+	for (t = 0; t < n_threads; t++) {
+		p_min[t] = DBL_MAX;	p_max[t] = -DBL_MAX;
+	}
+
+#ifdef _OPENMP
+#pragma omp parallel for private(prow) shared(h,z,p_min,p_max,p_sum,p_sum2,p_n)
+#endif
+	for (prow = 0; prow < (openmp_int)h->n_rows; prow++) {
+		unsigned int col;
+		int tid = 0;
+		uint64_t node = gmt_M_ijp (h, prow, 0), m = 0;
+		double v, bmin, bmax, bsum = 0.0, bsum2 = 0.0;
+#ifdef _OPENMP
+		tid = omp_get_thread_num ();
+#endif
+		bmin = p_min[tid];	bmax = p_max[tid];
+		for (col = 0; col < h->n_columns; col++, node++) {
+			v = (double)z[node];
+			if (v < bmin) bmin = v;	/* False when v is NaN so the extrema need no NaN test */
+			if (v > bmax) bmax = v;
+			if (isnan (v)) continue;
+			bsum += v;	bsum2 += v * v;	m++;
+		}
+		p_min[tid] = bmin;	p_max[tid] = bmax;
+		p_sum[tid] += bsum;	p_sum2[tid] += bsum2;	p_n[tid] += m;
+	}
+
+	for (t = 0; t < n_threads; t++) {	/* Combine the per-thread partials */
+		if (p_min[t] < vmin) vmin = p_min[t];
+		if (p_max[t] > vmax) vmax = p_max[t];
+		sum += p_sum[t];	sum2 += p_sum2[t];	n += p_n[t];
+	}
+	gmt_M_free (GMT, p_min);	gmt_M_free (GMT, p_max);
+	gmt_M_free (GMT, p_sum);	gmt_M_free (GMT, p_sum2);
+	gmt_M_free (GMT, p_n);
+
+	if (z_min)  *z_min  = (n) ? vmin : GMT->session.d_NaN;
+	if (z_max)  *z_max  = (n) ? vmax : GMT->session.d_NaN;
+	if (z_sum)  *z_sum  = (n) ? sum  : GMT->session.d_NaN;
+	if (z_sum2) *z_sum2 = (n) ? sum2 : GMT->session.d_NaN;
+
+	return (n);
+}
+
 void gmt_grd_zminmax (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *h, gmt_grdfloat *z) {
 	/* Reset the zmin/zmax values in the header based on the non-NaN values in the grid */
+	gmt_grd_reduce (GMT, h, z, &h->z_min, &h->z_max, NULL, NULL);	/* Sets both to NaN if no non-NaNs in the entire grid */
+}
+
+struct GMT_GRID_SKETCH *gmt_grd_sketch (struct GMT_CTRL *GMT, struct GMT_GRID *G) {
+	/* Return this grid's data sketch, building and caching it with the header on the first call.
+	 * Later calls (also from later modules querying the same in-memory grid) just return the cache,
+	 * so repeated CDF/quantile queries cost a table walk instead of a pass over the data.  Anyone
+	 * who modifies G->data afterwards must free and NULL the cached sketch (see gmt_hidden.h). */
 	unsigned int row, col;
-	uint64_t node, n = 0;
+	uint64_t node;
+	double v, z_min, z_max;
+	struct GMT_GRID_HEADER *h = G->header;
+	struct GMT_GRID_HEADER_HIDDEN *HH = gmt_get_H_hidden (h);
+	struct GMT_GRID_SKETCH *S = HH->sketch;
+
+	if (S) return (S);	/* Built by an earlier query */
+	S = gmt_M_memory (GMT, NULL, 1, struct GMT_GRID_SKETCH);
+	S->n = gmt_grd_reduce (GMT, h, G->data, &z_min, &z_max, NULL, NULL);
+	if (S->n) {	/* Got a range; bin the nodes [else leave the all-NaN sketch empty] */
+		S->z_min = z_min;	S->z_max = z_max;
+		if (z_max > z_min) S->i_bin = GMT_GRID_SKETCH_BINS / (z_max - z_min);
+		for (row = 0; row < h->n_rows; row++) {
+			for (col = 0, node = gmt_M_ijp (h, row, 0); col < h->n_columns; col++, node++) {
+				unsigned int bin;
+				v = (double)G->data[node];
+				if (isnan (v)) continue;
+				bin = (unsigned int)((v - z_min) * S->i_bin);
+				if (bin >= GMT_GRID_SKETCH_BINS) bin = GMT_GRID_SKETCH_BINS - 1;	/* The z_max node */
+				S->count[bin]++;
+			}
+		}
+	}
+	HH->sketch = S;
+	return (S);
+}
 
-	h->z_min = DBL_MAX;	h->z_max = -DBL_MAX;
-	for (row = 0; row < h->n_rows; row++) {
-		for (col = 0, node = gmt_M_ijp (h, row, 0); col < h->n_columns; col++, node++) {
-			if (isnan (z[node]))
-				continue;
-			/* Update z_min, z_max */
-			h->z_min = MIN (h->z_min, (double)z[node]);
-			h->z_max = MAX (h->z_max, (double)z[node]);
-			n++;
+double gmt_grd_sketch_cdf (struct GMT_CTRL *GMT, struct GMT_GRID_SKETCH *S, double z) {
+	/* Approximate fraction of the non-NaN nodes with value <= z, interpolated within the bin */
+	unsigned int k, bin;
+	uint64_t sum = 0;
+	double frac;
+	gmt_M_unused(GMT);
+
+	if (S->n == 0) return (0.0);
+	if (z <= S->z_min) return (0.0);
+	if (z >= S->z_max || S->i_bin == 0.0) return (1.0);
+	frac = (z - S->z_min) * S->i_bin;
+	bin = (unsigned int)frac;
+	if (bin >= GMT_GRID_SKETCH_BINS) bin = GMT_GRID_SKETCH_BINS - 1;
+	frac -= bin;	/* Now the fraction of the bin that lies at or below z */
+	for (k = 0; k < bin; k++) sum += S->count[k];
+	return ((sum + frac * S->count[bin]) / S->n);
+}
+
+double gmt_grd_sketch_quantile (struct GMT_CTRL *GMT, struct GMT_GRID_SKETCH *S, double q) {
+	/* Approximate the q% quantile (q in 0-100) from the binned counts, interpolated within the bin */
+	unsigned int k;
+	uint64_t sum = 0;
+	double target, frac;
+
+	if (S->n == 0) return (GMT->session.d_NaN);
+	if (S->i_bin == 0.0) return (S->z_min);	/* Constant grid */
+	target = 0.01 * q * S->n;
+	for (k = 0; k < GMT_GRID_SKETCH_BINS; k++) {
+		if ((double)sum + (double)S->count[k] >= target) {
+			frac = (S->count[k]) ? (target - (double)sum) / (double)S->count[k] : 0.0;
+			return (S->z_min + (k + frac) / S->i_bin);
 		}
+		sum += S->count[k];
 	}
-	if (n == 0) h->z_min = h->z_max = GMT->session.d_NaN;	/* No non-NaNs in the entire grid */
+	return (S->z_max);
 }
 
 void gmt_grd_minmax (struct GMT_CTRL *GMT, struct GMT_GRID *Grid, double xyz[2][3]) {
@@ -3838,6 +4263,11 @@ int gmtlib_read_image (struct GMT_CTRL *GMT, char *file, struct GMT_IMAGE *I, do
 	}
 	to_gdalread->I.active = true;		/* Means that image in I->data will be BIP interleaved */
 
+	if (GMT->current.gdal_read_in.P.active) {	/* A module requested a decimated (preview) read to match the plot resolution */
+		to_gdalread->P.active = true;
+		to_gdalread->P.jump = GMT->current.gdal_read_in.P.jump;
+	}
+
 	/* Tell gmt_gdalread that we already have the memory allocated and send in the *data pointer */
 	if (I->data) {		/* Otherwise (subregion) memory is allocated in gdalread */
 		if (I->type == GMT_FLOAT || I->type == GMT_DOUBLE) {
@@ -3870,6 +4300,10 @@ int gmtlib_read_image (struct GMT_CTRL *GMT, char *file, struct GMT_IMAGE *I, do
 	I->header->n_bands = from_gdalread->nActualBands;	/* What matters here on is the number of bands actually read */
 
 	gmt_M_memcpy (I->header->wesn, from_gdalread->hdr, 4, double);	/* Set the actual w/e/s/n bounds */
+	if (to_gdalread->P.active) {	/* The raster was decimated on reading; increments must reflect what we actually got */
+		I->header->inc[GMT_X] = from_gdalread->hdr[7];
+		I->header->inc[GMT_Y] = from_gdalread->hdr[8];
+	}
 
 	if (expand)	/* Must undo the region extension and reset n_columns, n_rows */
 		gmt_M_memcpy (I->header->wesn, wesn, 4, double);
@@ -3964,6 +4398,194 @@ bool gmt_grd_domains_match (struct GMT_CTRL *GMT, struct GMT_GRID *A, struct GMT
 	return (true);
 }
 
+GMT_LOCAL bool gmtgrdio_row_by_row_ok (struct GMT_CTRL *GMT, unsigned int type) {
+	/* Return true if this grid format type supports row-by-row i/o; only netCDF and
+	 * native binary do (same list of exceptions as grdblend relies on). */
+	unsigned int i, t;
+	static char *not_supported[] = {"rb", "rf", "sf", "sd", "af", "ei", "ef", "gd", NULL};
+	for (i = 0; not_supported[i]; i++) {
+		if (gmt_grd_format_decoder (GMT, not_supported[i], &t) != GMT_NOERROR) continue;	/* Cannot happen unless the list has a typo */
+		if (type == t) return (false);
+	}
+	return (true);
+}
+
+int gmt_grd_row_pipeline (struct GMT_CTRL *GMT, char *infile, char *outfile, struct GMT_OPTION *options, void (*op) (struct GMT_CTRL *, gmt_grdfloat *, unsigned int, unsigned int, void *), void *arg) {
+	/* Stream a grid from infile to outfile one row at the time, applying op to each row in turn.
+	 * The callback is handed the unpadded row of n_columns nodes, the current row number, and arg.
+	 * Memory use is bounded by a single row regardless of grid size, so per-node transforms can
+	 * process grids far larger than available memory and the OS can overlap our compute with its
+	 * own readahead and writeback.  Only formats with row-by-row i/o (netCDF and native binary)
+	 * qualify; if either file does not then we return GMT_GRDIO_UNKNOWN_FORMAT and the caller
+	 * should quietly fall back on whole-grid processing.  If options is not NULL we add the
+	 * usual command history to the output header. */
+	unsigned int row, col;
+	int error = GMT_NOERROR;
+	gmt_grdfloat *z = NULL;
+	struct GMT_GRID *In = NULL, *Out = NULL;
+	struct GMTAPI_CTRL *API = GMT->parent;
+
+	if (gmt_M_file_is_memory (infile) || gmt_M_file_is_memory (outfile)) return (GMT_GRDIO_UNKNOWN_FORMAT);	/* Memory resources have no rows to stream */
+	if ((In = GMT_Read_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_CONTAINER_ONLY|GMT_GRID_ROW_BY_ROW, NULL, infile, NULL)) == NULL)
+		return (API->error);
+	if (!gmtgrdio_row_by_row_ok (GMT, In->header->type)) {	/* Cannot read this format incrementally */
+		GMT_Destroy_Data (API, &In);
+		return (GMT_GRDIO_UNKNOWN_FORMAT);
+	}
+	if ((Out = GMT_Create_Data (API, GMT_IS_GRID, GMT_IS_SURFACE, GMT_CONTAINER_ONLY, NULL, In->header->wesn, In->header->inc,
+		In->header->registration, GMT_NOTSET, NULL)) == NULL) {
+		GMT_Destroy_Data (API, &In);
+		return (API->error);
+	}
+	if ((error = gmt_grd_get_format (GMT, outfile, Out->header, false)) != GMT_NOERROR) {	/* Determine output format type */
+		GMT_Destroy_Data (API, &In);	GMT_Destroy_Data (API, &Out);
+		return (error);
+	}
+	if (!gmtgrdio_row_by_row_ok (GMT, Out->header->type)) {	/* Cannot write this format incrementally */
+		GMT_Destroy_Data (API, &In);	GMT_Destroy_Data (API, &Out);
+		return (GMT_GRDIO_UNKNOWN_FORMAT);
+	}
+	if (options && GMT_Set_Comment (API, GMT_IS_GRID, GMT_COMMENT_IS_OPTION | GMT_COMMENT_IS_COMMAND, options, Out)) {
+		GMT_Destroy_Data (API, &In);	GMT_Destroy_Data (API, &Out);
+		return (API->error);
+	}
+	/* Write the output header, leaving the file open for incremental row writing */
+	if ((error = GMT_Write_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_CONTAINER_ONLY | GMT_GRID_ROW_BY_ROW, NULL, outfile, Out))) {
+		GMT_Destroy_Data (API, &In);	GMT_Destroy_Data (API, &Out);
+		return (error);
+	}
+	z = gmt_M_memory (GMT, NULL, In->header->n_columns, gmt_grdfloat);
+	Out->header->z_min = DBL_MAX;	Out->header->z_max = -DBL_MAX;	/* These will be updated as the rows are processed */
+	GMT_Report (API, GMT_MSG_INFORMATION, "Streaming %s to %s row-by-row\n", infile, outfile);
+	for (row = 0; row < In->header->n_rows; row++) {
+		if ((error = GMT_Get_Row (API, 0, In, z))) break;	/* Read rows sequentially */
+		op (GMT, z, In->header->n_columns, row, arg);
+		for (col = 0; col < In->header->n_columns; col++) {	/* Update the extrema for the output grid */
+			if (gmt_M_is_fnan (z[col])) continue;
+			if (z[col] < Out->header->z_min) Out->header->z_min = z[col];
+			if (z[col] > Out->header->z_max) Out->header->z_max = z[col];
+		}
+		if ((error = GMT_Put_Row (API, (int)row, Out, z))) break;
+	}
+	gmt_M_free (GMT, z);
+	if (GMT_Destroy_Data (API, &In) != GMT_NOERROR) {	/* Done reading; this also closes the input file */
+		GMT_Destroy_Data (API, &Out);
+		return (API->error);
+	}
+	if (error) {	/* A row transfer failed above */
+		GMT_Destroy_Data (API, &Out);
+		return (error);
+	}
+	/* Update the output header so the final z_min/z_max make it out to the file */
+	if ((error = GMT_Write_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_CONTAINER_ONLY | GMT_GRID_ROW_BY_ROW, NULL, outfile, Out)))
+		return (error);
+	if (GMT_Destroy_Data (API, &Out) != GMT_NOERROR)	/* This also closes the output file */
+		return (API->error);
+	return (GMT_NOERROR);
+}
+
+/*! . */
+void gmt_grd_pyramid_name (struct GMT_CTRL *GMT, const char *file, unsigned int factor, char *name) {
+	/* Build the name of the overview-pyramid sidecar file for the given grid file and
+	 * downsampling factor: <base>_pyr<factor><ext>, or <file>_pyr<factor> if the file
+	 * has no extension.  These sidecars are written by grdpyramid.  name must be able
+	 * to hold PATH_MAX characters. */
+	char *ext = NULL, *slash = NULL;
+	gmt_M_unused (GMT);
+	strncpy (name, file, PATH_MAX-1);
+	slash = strrchr (name, '/');
+	ext = strrchr (name, '.');
+	if (ext && (slash == NULL || ext > slash))	/* Insert _pyr<factor> before the extension */
+		sprintf (ext, "_pyr%u%s", factor, strrchr (file, '.'));
+	else	/* No extension; just append */
+		sprintf (&name[strlen(name)], "_pyr%u", factor);
+}
+
+/*! . */
+struct GMT_GRID * gmt_grd_halve (struct GMT_CTRL *GMT, struct GMT_GRID *P) {
+	/* Build and return the next overview level from parent grid P (same region and
+	 * registration, increments doubled), or NULL if the parent cannot be halved.
+	 * For pixel registration a node is the mean of the four parent cells it covers,
+	 * while for gridline registration we place a 3x3 binomial (1-2-1) window on the
+	 * coincident parent node.  Both schemes skip NaNs.  Used by grdpyramid to write
+	 * overview sidecars and by modules that keep a resident in-memory pyramid. */
+	openmp_int row, col;
+	int ii, jj, p_row, p_col;
+	uint64_t ij, ij_p;
+	double inc[2], value, wt_sum, w;
+	struct GMT_GRID *C = NULL;
+
+	if (P->header->registration == GMT_GRID_PIXEL_REG) {	/* Need an even number of cells in both directions */
+		if (P->header->n_columns % 2 || P->header->n_rows % 2) return (NULL);
+	}
+	else {	/* Gridline registration: need an even number of intervals in both directions */
+		if ((P->header->n_columns - 1) % 2 || (P->header->n_rows - 1) % 2) return (NULL);
+	}
+	inc[GMT_X] = 2.0 * P->header->inc[GMT_X];
+	inc[GMT_Y] = 2.0 * P->header->inc[GMT_Y];
+	if ((C = GMT_Create_Data (GMT->parent, GMT_IS_GRID, GMT_IS_SURFACE, GMT_CONTAINER_AND_DATA, NULL, P->header->wesn, inc, \
+		P->header->registration, GMT_NOTSET, NULL)) == NULL) return (NULL);
+
+	gmt_M_grd_loop (GMT, C, row, col, ij) {
+		value = wt_sum = 0.0;
+		if (C->header->registration == GMT_GRID_PIXEL_REG) {	/* Average the four parent cells this cell covers */
+			for (jj = 0; jj < 2; jj++) {
+				for (ii = 0; ii < 2; ii++) {
+					ij_p = gmt_M_ijp (P->header, 2 * row + jj, 2 * col + ii);
+					if (gmt_M_is_fnan (P->data[ij_p])) continue;
+					value += P->data[ij_p];
+					wt_sum += 1.0;
+				}
+			}
+		}
+		else {	/* Binomial 3x3 window centered on the coincident parent node */
+			for (jj = -1; jj <= 1; jj++) {
+				p_row = 2 * (int)row + jj;
+				if (p_row < 0 || p_row >= (int)P->header->n_rows) continue;
+				for (ii = -1; ii <= 1; ii++) {
+					p_col = 2 * (int)col + ii;
+					if (p_col < 0 || p_col >= (int)P->header->n_columns) continue;
+					ij_p = gmt_M_ijp (P->header, p_row, p_col);
+					if (gmt_M_is_fnan (P->data[ij_p])) continue;
+					w = (2.0 - abs (ii)) * (2.0 - abs (jj));	/* 1-2-1 in each direction */
+					value += P->data[ij_p] * w;
+					wt_sum += w;
+				}
+			}
+		}
+		C->data[ij] = (wt_sum > 0.0) ? (gmt_grdfloat)(value / wt_sum) : GMT->session.f_NaN;
+	}
+	return (C);
+}
+
+/*! . */
+char * gmt_grd_pyramid_select (struct GMT_CTRL *GMT, const char *file, double file_inc[], double inc[]) {
+	/* Given a grid file with increments file_inc and a requested output increment inc, see
+	 * if an overview-pyramid sidecar written by grdpyramid can stand in for the full-resolution
+	 * grid.  We pick the coarsest power-of-two level whose increments do not exceed the request,
+	 * so interpolation still happens from equal or finer spacing.  Returns an allocated file name
+	 * (caller must free) or NULL if no suitable sidecar exists.  Memory references, remote files
+	 * and file names carrying format or modifier suffixes are left alone. */
+	unsigned int factor = 2;
+	char name[PATH_MAX] = {""};
+
+	if (gmt_M_file_is_memory (file) || gmt_M_file_is_remote (file)) return (NULL);
+	if (strchr (file, '=') || strchr (file, '+')) return (NULL);	/* Cannot safely compose sidecar names */
+	while (2.0 * factor * file_inc[GMT_X] <= inc[GMT_X] * (1.0 + GMT_CONV4_LIMIT) && \
+		2.0 * factor * file_inc[GMT_Y] <= inc[GMT_Y] * (1.0 + GMT_CONV4_LIMIT))
+		factor *= 2;	/* A factor twice as coarse would still be fine enough */
+	for (; factor >= 2; factor /= 2) {	/* Take the coarsest level that actually exists */
+		if (factor * file_inc[GMT_X] > inc[GMT_X] * (1.0 + GMT_CONV4_LIMIT) || \
+			factor * file_inc[GMT_Y] > inc[GMT_Y] * (1.0 + GMT_CONV4_LIMIT)) continue;	/* This level is too coarse */
+		gmt_grd_pyramid_name (GMT, file, factor, name);
+		if (!access (name, R_OK)) {
+			GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Selected pyramid level %s (factor %u) for %s\n", name, factor, file);
+			return (strdup (name));
+		}
+	}
+	return (NULL);
+}
+
 struct GMT_GRID * gmt_vertical_cube_cut (struct GMT_CTRL *GMT, struct GMT_CUBE *C, unsigned int dim, double coord) {
 	/* Special case of slicing a cube vertically and along the cube's node structure.  For
 	 * oblique cuts and resampling and for grids with variable spacing/time in the third
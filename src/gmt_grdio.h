@@ -94,9 +94,10 @@ enum Gmt_grid_id {
 	GMT_GRID_IS_AF,         /* Atlantic Geoscience Center format AGC (32-bit float) */
 	GMT_GRID_IS_GD,         /* Import through GDAL */
 	GMT_GRID_IS_EI,         /* ESRI Arc/Info ASCII Grid Interchange format (ASCII integer) */
-	GMT_GRID_IS_EF          /* ESRI Arc/Info ASCII Grid Interchange format (ASCII float, write-only) */
+	GMT_GRID_IS_EF,         /* ESRI Arc/Info ASCII Grid Interchange format (ASCII float, write-only) */
+	GMT_GRID_IS_ZF          /* GMT native zstd-compressed format (32-bit float) */
 };
-#define GMT_N_GRD_FORMATS 25 /* Number of formats above plus 1 */
+#define GMT_N_GRD_FORMATS 26 /* Number of formats above plus 1 */
 
 #define GMT_GRID_IS_GOLDEN7	GMT_GRID_IS_SD
 #define GMT_GRID_IS_GDAL	GMT_GRID_IS_GD
@@ -164,6 +165,27 @@ static inline void scale_and_offset_f (gmt_grdfloat *data, size_t length, gmt_gr
 		#endif
 #else	/* Anything but Apple */
 	size_t n;
+#ifdef _OPENMP
+	if (length >= 262144 && length <= INT_MAX) {	/* Large enough to spread across the threads (signed counter for OpenMP 2.0) */
+		openmp_int nn, nm = (openmp_int)length;
+		if (scale == 1) { /* offset only */
+#pragma omp parallel for private(nn) shared(data,nm,offset)
+			for (nn = 0; nn < nm; ++nn)
+				data[nn] += offset;
+		}
+		else if (offset == 0) { /* scale only */
+#pragma omp parallel for private(nn) shared(data,nm,scale)
+			for (nn = 0; nn < nm; ++nn)
+				data[nn] *= scale;
+		}
+		else { /* scale + offset */
+#pragma omp parallel for private(nn) shared(data,nm,scale,offset)
+			for (nn = 0; nn < nm; ++nn)
+				data[nn] = data[nn] * scale + offset;
+		}
+		return;
+	}
+#endif
 	if (scale == 1) { /* offset only */
 		for (n = 0; n < length; ++n)
 			data[n] += offset;
@@ -81,6 +81,7 @@ struct GMT_DATASEGMENT_HIDDEN {    /* Supporting information hidden from the API
 	struct GMT_DATASEGMENT *next;	/* NULL unless polygon and has holes and pointing to next hole */
 	enum GMT_enum_alloc *alloc_mode;	/* Allocation mode per data column [GMT_ALLOC_INTERNALLY] */
 	enum GMT_enum_alloc alloc_mode_text;	/* Allocation mode for trailing text column [GMT_ALLOC_INTERNALLY] */
+	bool arena;			/* true if the segment structs and coordinate arrays came from the dataset's memory arena */
 	char *file[2];			/* Name of file or source [0 = in, 1 = out] */
 };
 
@@ -92,6 +93,8 @@ struct GMT_DATATABLE_HIDDEN {	/* Supporting information hidden from the API */
 	enum GMT_enum_write mode;	/* 0 = output table, 1 = output header only, 2 = skip table */
 	struct GMT_OGR *ogr;    /* Pointer to struct with all things GMT/OGR (if MULTI-geometry and not MULTIPOINT) */
 	enum GMT_enum_alloc alloc_mode;	/* Allocation mode [GMT_ALLOC_INTERNALLY] */
+	void *map;              /* Columnar table file image that the column arrays point into, or NULL */
+	size_t map_size;        /* Size of the memory map in bytes; 0 means map holds allocated memory and is freed instead */
 	char *file[2];          /* Name of file or source [0 = in, 1 = out] */
 };
 
@@ -107,6 +110,7 @@ struct GMT_DATASET_HIDDEN {	/* Supporting information hidden from the API */
 					 * 2 means use segment->file[GMT_OUT] to write separate segments.
 					 * 3 is same as 2 but with no filenames we create filenames from tbl and seg numbers */
 	enum GMT_enum_alloc alloc_mode;	/* Allocation mode [GMT_ALLOC_INTERNALLY] */
+	struct GMT_MEM_ARENA *arena;	/* Bump arena feeding the segments of a large dataset (or NULL); freed in one shot with the dataset */
 	char *file[2];			/* Name of file or source [0 = in, 1 = out] */
 };
 
@@ -121,6 +125,11 @@ struct GMT_PALETTE_HIDDEN {	/* Supporting information hidden from the API */
 	unsigned int z_adjust[2];	/* 1 if +u<unit> was parsed and scale set, 3 if z has been adjusted, 0 otherwise */
 	unsigned int z_mode[2];	 	/* 1 if +U<unit> was parsed, 0 otherwise */
 	unsigned int z_unit[2];	 	/* Unit enum specified via +u<unit> */
+	unsigned int *z_bin;		/* Dense quantized z-to-slice index used by gmt_get_index, or NULL */
+	unsigned int n_bins;		/* Number of quantization bins in z_bin */
+	unsigned int z_bin_tried;	/* 1 once we have attempted to build z_bin for this version of the palette */
+	double bin_z_min;		/* z value at the start of the first quantization bin */
+	double bin_i_dz;		/* Inverse width of a quantization bin */
 	double z_unit_to_meter[2];	/* Scale, given z_unit, to convert z from <unit> to meters */
 };
 
@@ -148,6 +157,18 @@ struct GMT_MATRIX_HIDDEN {	/* Supporting information hidden from the API */
 	enum GMT_enum_alloc alloc_mode_text;	/* Allocation mode per text [GMT_ALLOC_INTERNALLY] */
 };
 
+#define GMT_GRID_SKETCH_BINS	4096	/* Number of fixed bins in a grid data sketch */
+
+struct GMT_GRID_SKETCH {	/* Fixed-bin histogram of a grid's data, built lazily by gmt_grd_sketch and cached
+				 * with the header so repeated quantile/CDF queries cost a table walk instead of
+				 * a pass over (or sort of) the data.  Queries interpolate within a bin so the
+				 * error is bounded by one bin width of the data range. */
+	uint64_t n;			/* Number of non-NaN nodes binned */
+	double z_min, z_max;		/* Data range the bins span */
+	double i_bin;			/* Bins per z unit, i.e., GMT_GRID_SKETCH_BINS / (z_max - z_min) [0 if constant grid] */
+	uint64_t count[GMT_GRID_SKETCH_BINS];	/* Node count per bin */
+};
+
 struct GMT_GRID_HEADER_HIDDEN {
 	/* ---- Variables "hidden" from the API ----
 	 * This section is flexible.  It is not copied to any grid or image header
@@ -176,6 +197,9 @@ struct GMT_GRID_HEADER_HIDDEN {
 	double nan_rgb[4];                    /* Transparent NaN color in an indexed RGB image, with nan_value as that index */
 	char flags[4];                        /* Flags used for ESRI grids */
 	char *pocket;                         /* GDAL: A working variable handy to transmit info between funcs e.g. +b<band_info> to gdalread */
+	struct GMT_GRID_SKETCH *sketch;       /* Data sketch built lazily by gmt_grd_sketch; anyone modifying the data must free and NULL it [NULL] */
+	uint64_t data_generation;             /* Bumped via gmt_grd_dirty whenever the data array changes [0] */
+	uint64_t bc_generation;               /* data_generation when gmt_grd_BC_set last filled the pad; fills are skipped while they match [0 = never filled] */
 	double bcr_threshold;                 /* sum of cardinals must >= threshold in bilinear; else NaN */
 	unsigned int used_indexed_rgb;        /* 1 if originally an indexed RGB, 0 otherwise */
 	unsigned int has_NaN_rgb;             /* Is 1 if an indexed RGB image had a specific NaN color for transparency */
@@ -481,6 +481,10 @@ static struct GMT_KEYWORD_DICTIONARY gmt_common_kw[] = {
 /* Local variables to gmt_init.c */
 
 static struct GMT_HASH keys_hashnode[GMT_N_KEYS];
+static bool keys_hashnode_ready = false;	/* Goes true once keys_hashnode has been built; the table only depends on the static GMT_keyword list */
+
+static struct GMT_HASH rgb_hashnode_copy[GMT_N_COLOR_NAMES];	/* Process-wide copy of the color-name hash table so later sessions skip rebuilding it */
+static bool rgb_hashnode_ready = false;		/* Goes true once rgb_hashnode_copy has been loaded from the first session's table */
 
 #include "gmt_gsformats.h"
 
@@ -3504,15 +3508,83 @@ void gmt_hierarchy_tag (struct GMTAPI_CTRL *API, const char *kind, unsigned int
 	snprintf (path, PATH_MAX, "%s/%s%s", API->gwf_dir, kind, tag);
 }
 
+/*! Process-lifetime cache of the most recently read or written gmt.history file.  Every modern mode
+ * command re-reads the same shorthand file from the session directory; by remembering its records
+ * (keyed on path, size, and modification time so a single stat call validates the slot, just like
+ * gmt_defaults_cache below) repeated sessions in the same process can skip the open/lock/parse
+ * cycle, and gmt_end can skip rewriting a file whose content would not change. */
+
+static const char gmtinit_hist_ps_code[4] = {'C', 'G', 'L', 'S'};	/* The known @ plot record codes */
+
+struct GMTINIT_HIST_CACHE {
+	char file[PATH_MAX];	/* Path of the file whose records we hold; empty means the slot is unused */
+	time_t mtime;		/* Modification time when the file was read or written */
+	off_t size;		/* File size when the file was read or written */
+	char *value[GMT_N_UNIQUE];	/* Cached shorthand values (NULL if not in the file) */
+	char *ps[4];		/* Cached @C, @G, @L, @S plot records (NULL if not in the file) */
+};
+
+static struct GMTINIT_HIST_CACHE gmt_history_cache;
+
+/*! Empty the history cache slot before it is refilled */
+GMT_LOCAL void gmtinit_hist_cache_reset (struct GMTINIT_HIST_CACHE *C) {
+	unsigned int k;
+	for (k = 0; k < GMT_N_UNIQUE; k++)	/* The cache outlives any session so it uses the standard allocator */
+		free (C->value[k]);
+	for (k = 0; k < 4; k++)
+		free (C->ps[k]);
+	memset (C, 0, sizeof (struct GMTINIT_HIST_CACHE));
+}
+
+/*! Apply one @<code> plot record from gmt.history; shared by the parse and replay paths */
+GMT_LOCAL void gmtinit_hist_process_ps (struct GMT_CTRL *GMT, char code, char *value) {
+	if (code == 'C')	/* Read clip level */
+		GMT->current.ps.clip_level = atoi (value);
+	else if (code == 'G')	/* Read gridline spacings */
+		sscanf (value, "%lg %lg", &GMT->current.plot.gridline_spacing[GMT_X], &GMT->current.plot.gridline_spacing[GMT_Y]);
+	else if (code == 'L')	/* Read PS layer */
+		GMT->current.ps.layer = atoi (value);
+	else if (code == 'S')	/* Read next sequential color IDs */
+		sscanf (value, "%d %d", &GMT->current.plot.color_seq_id[0], &GMT->current.plot.color_seq_id[1]);
+}
+
+/*! Format @ plot record k (0-3 for C,G,L,S) into record the way gmtinit_put_history writes it;
+ * returns NULL if that record would not be written at all */
+GMT_LOCAL char *gmtinit_hist_ps_record (struct GMT_CTRL *GMT, unsigned int k, char *record) {
+	record[0] = '\0';
+	switch (k) {
+		case 0:	/* Clip level, if set */
+			if (GMT->current.ps.clip_level) sprintf (record, "%d", GMT->current.ps.clip_level);
+			break;
+		case 1:	/* Gridline spacings, if set */
+			if (GMT->current.plot.gridline_spacing[GMT_X] > 0.0 || GMT->current.plot.gridline_spacing[GMT_Y] > 0.0)
+				sprintf (record, "%g %g", GMT->current.plot.gridline_spacing[GMT_X], GMT->current.plot.gridline_spacing[GMT_Y]);
+			break;
+		case 2:	/* PS layer, if non-zero */
+			if (GMT->current.ps.layer) sprintf (record, "%d", GMT->current.ps.layer);
+			break;
+		case 3:	/* Next sequential color IDs, if non-zero */
+			if (GMT->current.plot.color_seq_id[0] || GMT->current.plot.color_seq_id[1])
+				sprintf (record, "%d %d", GMT->current.plot.color_seq_id[0], GMT->current.plot.color_seq_id[1]);
+			break;
+	}
+	return (record[0]) ? record : NULL;
+}
+
 /*! . */
 GMT_LOCAL int gmtinit_get_history (struct GMT_CTRL *GMT) {
 	int id;
 	size_t len = strlen ("BEGIN GMT " GMT_PACKAGE_VERSION);
-	bool done = false, process = false;
+	bool done = false, process = false, caching;
+	unsigned int k;
 	char line[GMT_BUFSIZ] = {""}, hfile[PATH_MAX] = {""}, cwd[PATH_MAX] = {""};
 	char option[GMT_LEN64] = {""}, value[GMT_BUFSIZ] = {""};
+	char *code = NULL;
 	FILE *fp = NULL; /* For gmt.history file */
+	struct stat S;
+	struct GMTINIT_HIST_CACHE *C = &gmt_history_cache;
 	static struct GMT_HASH unique_hashnode[GMT_N_UNIQUE];
+	static bool unique_hashnode_ready = false;	/* Goes true once unique_hashnode has been built; the table only depends on the static GMT_unique_option list */
 
 	if (GMT->parent->no_history)
 		return (GMT_NOERROR); /* gmt.history mechanism was disabled by GMT_Create_Session */
@@ -3546,16 +3618,39 @@ GMT_LOCAL int gmtinit_get_history (struct GMT_CTRL *GMT) {
 		GMT_Report (GMT->parent, GMT_MSG_WARNING, "No writable directory found for gmt history - skipping it.\n");
 		return (GMT_NOERROR);
 	}
+	if (C->file[0] && !strcmp (C->file, hfile) && stat (hfile, &S) == 0 && C->mtime == S.st_mtime && C->size == S.st_size) {
+		/* Same file this process read or wrote last time and untouched since - replay the records and skip the file i/o */
+		GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Reusing cached gmt history records from file: %s\n", hfile);
+		for (id = 0; id < GMT_N_UNIQUE; id++) {
+			if (C->value[id] == NULL) continue;
+			if (GMT->init.history[id])
+				gmt_M_str_free (GMT->init.history[id]);
+			GMT->init.history[id] = strdup (C->value[id]);
+		}
+		for (k = 0; k < 4; k++)
+			if (C->ps[k]) gmtinit_hist_process_ps (GMT, gmtinit_hist_ps_code[k], C->ps[k]);
+		return (GMT_NOERROR);
+	}
 	if ((fp = fopen (hfile, "r+")) == NULL) /* In order to place an exclusive lock, fp must be open for writing */
 		return (GMT_NOERROR);	/* OK to be unsuccessful in opening this file */
 
-	if (gmt_hash_init (GMT, unique_hashnode, GMT_unique_option, GMT_N_UNIQUE, GMT_N_UNIQUE)) {
-		fclose (fp);
-		return (GMT_NOERROR); /* Cannot do anything without the hash */
+	if (!unique_hashnode_ready) {	/* First call in this process builds the hash table for the shorthand codes */
+		if (gmt_hash_init (GMT, unique_hashnode, GMT_unique_option, GMT_N_UNIQUE, GMT_N_UNIQUE)) {
+			fclose (fp);
+			return (GMT_NOERROR); /* Cannot do anything without the hash */
+		}
+		unique_hashnode_ready = true;
 	}
 
 	/* When we get here the file exists */
 	gmtlib_file_lock (GMT, fileno(fp));
+	gmtinit_hist_cache_reset (C);	/* Refill the cache slot as we parse */
+	caching = (fstat (fileno (fp), &S) == 0);	/* Without a stat signature we cannot detect later edits, so then we neither use nor fill the cache */
+	if (caching) {
+		strncpy (C->file, hfile, PATH_MAX-1);
+		C->mtime = S.st_mtime;
+		C->size = S.st_size;
+	}
 	/* Format of GMT gmt.history is as follow:
 	 * BEGIN GMT <version>		This is the start of parsable section
 	 * OPT ARG
@@ -3579,20 +3674,24 @@ GMT_LOCAL int gmtinit_get_history (struct GMT_CTRL *GMT) {
 		if (sscanf (line, "%s %[^\n]", option, value) != 2) continue;	/* Quietly skip malformed lines */
 		if (!value[0]) continue;	/* No argument found */
 		if (option[0] == '@') {	/* PostScript plot information */
-			if (option[1] == 'C')	/* Read clip level */
-				GMT->current.ps.clip_level = atoi (value);
-			else if (option[1] == 'G')	/* Read gridline spacings */
-				sscanf (value, "%lg %lg", &GMT->current.plot.gridline_spacing[GMT_X], &GMT->current.plot.gridline_spacing[GMT_Y]);
-			else if (option[1] == 'L')	/* Read PS layer */
-				GMT->current.ps.layer = atoi (value);
-			else if (option[1] == 'S')	/* Read next sequential color IDs */
-				sscanf (value, "%d %d", &GMT->current.plot.color_seq_id[0], &GMT->current.plot.color_seq_id[1]);
+			if ((code = memchr (gmtinit_hist_ps_code, option[1], 4U))) {	/* One of the known plot records */
+				gmtinit_hist_process_ps (GMT, option[1], value);
+				if (caching) {
+					k = (unsigned int)(code - gmtinit_hist_ps_code);
+					if (C->ps[k]) free (C->ps[k]);	/* Last record wins */
+					C->ps[k] = strdup (value);
+				}
+			}
 			continue;
 		}
 		if ((id = gmt_hash_lookup (GMT, option, unique_hashnode, GMT_N_UNIQUE, GMT_N_UNIQUE)) < 0) continue;	/* Quietly skip malformed lines */
 		if (GMT->init.history[id])
 			gmt_M_str_free (GMT->init.history[id]);
 		GMT->init.history[id] = strdup (value);
+		if (caching) {
+			if (C->value[id]) free (C->value[id]);	/* Last record wins */
+			C->value[id] = strdup (value);
+		}
 	}
 
 	/* Close the file */
@@ -3608,8 +3707,12 @@ GMT_LOCAL int gmtinit_get_history (struct GMT_CTRL *GMT) {
 GMT_LOCAL int gmtinit_put_history (struct GMT_CTRL *GMT) {
 	int id;
 	bool empty;
-	char hfile[PATH_MAX] = {""}, cwd[PATH_MAX] = {""};
+	unsigned int k;
+	char hfile[PATH_MAX] = {""}, cwd[PATH_MAX] = {""}, record[GMT_LEN64] = {""};
+	char *ps = NULL;
 	FILE *fp = NULL; /* For gmt.history file */
+	struct stat S;
+	struct GMTINIT_HIST_CACHE *C = &gmt_history_cache;
 
 	if (GMT->parent->no_history)
 		return (GMT_NOERROR); /* gmt.history mechanism was disabled by GMT_Create_Session */
@@ -3649,6 +3752,27 @@ GMT_LOCAL int gmtinit_put_history (struct GMT_CTRL *GMT) {
 		GMT_Report (GMT->parent, GMT_MSG_WARNING, "Unable to determine a writable directory - gmt history not updated.\n");
 		return (GMT_NOERROR);
 	}
+	if (C->file[0] && !strcmp (C->file, hfile) && stat (hfile, &S) == 0 && C->mtime == S.st_mtime && C->size == S.st_size) {
+		/* The file on disk is the one this process last read or wrote; if our records match it we can skip the rewrite */
+		bool same = true;
+		for (id = 0; same && id < GMT_N_UNIQUE; id++) {
+			if ((GMT->init.history[id] == NULL) != (C->value[id] == NULL))
+				same = false;
+			else if (GMT->init.history[id] && strcmp (GMT->init.history[id], C->value[id]))
+				same = false;
+		}
+		for (k = 0; same && k < 4; k++) {
+			ps = gmtinit_hist_ps_record (GMT, k, record);
+			if ((ps == NULL) != (C->ps[k] == NULL))
+				same = false;
+			else if (ps && strcmp (ps, C->ps[k]))
+				same = false;
+		}
+		if (same) {
+			GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Nothing changed - skipping rewrite of gmt history file: %s\n", hfile);
+			return (GMT_NOERROR);
+		}
+	}
 	if ((fp = fopen (hfile, "w")) == NULL) return (GMT_NOTSET);	/* Not OK to be unsuccessful in creating this file */
 
 	/* When we get here the file is open */
@@ -3661,13 +3785,26 @@ GMT_LOCAL int gmtinit_put_history (struct GMT_CTRL *GMT) {
 		if (!GMT->init.history[id]) continue;	/* Not specified */
 		fprintf (fp, "%s\t%s\n", GMT_unique_option[id], GMT->init.history[id]);
 	}
-	if (GMT->current.ps.clip_level) fprintf (fp, "@C\t%d\n", GMT->current.ps.clip_level); /* Write clip level */
-	if (GMT->current.plot.gridline_spacing[GMT_X] > 0.0 || GMT->current.plot.gridline_spacing[GMT_Y] > 0.0)	/* Save gridline spacing in history */
-		fprintf (fp, "@G\t%g %g\n", GMT->current.plot.gridline_spacing[GMT_X], GMT->current.plot.gridline_spacing[GMT_Y]);
-	if (GMT->current.ps.layer) fprintf (fp, "@L\t%d\n", GMT->current.ps.layer); /* Write PS layer, if non-zero */
-	if (GMT->current.plot.color_seq_id[0] || GMT->current.plot.color_seq_id[1]) fprintf (fp, "@S\t%d %d\n", GMT->current.plot.color_seq_id[0], GMT->current.plot.color_seq_id[1]); /* Write next sequential color IDs, if non-zero */
+	for (k = 0; k < 4; k++) {	/* Write clip level, gridline spacings, PS layer, and sequential color IDs, when set */
+		if ((ps = gmtinit_hist_ps_record (GMT, k, record)))
+			fprintf (fp, "@%c\t%s\n", gmtinit_hist_ps_code[k], ps);
+	}
 	fprintf (fp, "END\n");
 
+	/* Refresh the cache slot so the next session in this process can skip re-reading the file */
+	gmtinit_hist_cache_reset (C);
+	for (id = 0; id < GMT_N_UNIQUE; id++)
+		if (GMT->init.history[id]) C->value[id] = strdup (GMT->init.history[id]);
+	for (k = 0; k < 4; k++) {
+		if ((ps = gmtinit_hist_ps_record (GMT, k, record))) C->ps[k] = strdup (ps);
+	}
+	fflush (fp);	/* Get the records to disk so the stat signature taken below is final */
+	if (fstat (fileno (fp), &S) == 0) {	/* Without a signature we cannot detect later edits, so leave the slot unused */
+		strncpy (C->file, hfile, PATH_MAX-1);
+		C->mtime = S.st_mtime;
+		C->size = S.st_size;
+	}
+
 	/* Close the file */
 	gmtlib_file_unlock (GMT, fileno(fp));
 	fclose (fp);
@@ -7305,22 +7442,34 @@ void gmt_conf_SI (struct GMT_CTRL *GMT) {
 	GMT->current.setting.map_annot_oblique_set = false;
 }
 
+/* The font table is identical for every session in the process: the standard PostScript fonts
+ * plus whatever PSL_custom_fonts.txt adds from the share directory.  Since a multithreaded
+ * program may run one session per worker thread we build the table once, share it read-only
+ * across the sessions, and free it when the last session referencing it ends.  The mutex
+ * (a no-op without glib threading, in which case sessions are serial anyway) protects the
+ * reference count and the one-time build.  The table is allocated with plain malloc since
+ * tying it to the memory tracking of whichever session built it would fail if that session
+ * is destroyed before the others are done with the table. */
+
+GMT_declare_gmutex
+static struct GMT_FONTSPEC *gmtinit_font_table = NULL;	/* Process-global font table shared by all sessions */
+static unsigned int gmtinit_font_n = 0;			/* Number of entries in gmtinit_font_table */
+static unsigned int gmtinit_font_refs = 0;		/* Number of sessions holding a reference to it */
+
 /*! . */
-GMT_LOCAL int gmtinit_init_fonts (struct GMT_CTRL *GMT) {
-	unsigned int i = 0, n_GMT_fonts;
-	size_t n_alloc = 0;
+GMT_LOCAL int gmtinit_load_font_table (struct GMT_CTRL *GMT, struct GMT_FONTSPEC **table, unsigned int *n_fonts) {
+	unsigned int i;
+	size_t n_alloc = GMT_N_STANDARD_FONTS;
 	char fullname[GMT_BUFSIZ] = {""};
+	struct GMT_FONTSPEC *font = NULL;
 
 	/* Loads all available fonts for this installation */
 
 	/* First the standard 35 + 4 PostScript fonts from Adobe */
 
-	gmt_set_meminc (GMT, GMT_SMALL_CHUNK);	/* Only allocate a small amount [64] */
-	GMT->session.font = gmt_M_malloc (GMT, GMT->session.font, 0, &n_alloc, struct GMT_FONTSPEC);
-
-	/* First the standard 35 + 4 PostScript fonts from Adobe */
-	gmt_M_memcpy (GMT->session.font, GMT_standard_fonts, GMT_N_STANDARD_FONTS, struct GMT_FONTSPEC);
-	GMT->session.n_fonts = n_GMT_fonts = i = GMT_N_STANDARD_FONTS;
+	if ((font = malloc (n_alloc * sizeof (struct GMT_FONTSPEC))) == NULL) return (GMT_MEMORY_ERROR);
+	gmt_M_memcpy (font, GMT_standard_fonts, GMT_N_STANDARD_FONTS, struct GMT_FONTSPEC);
+	i = GMT_N_STANDARD_FONTS;
 
 	/* Then any custom fonts:
 	   To add additional fonts, create a file called PSL_custom_fonts.txt
@@ -7333,13 +7482,23 @@ GMT_LOCAL int gmtinit_init_fonts (struct GMT_CTRL *GMT) {
 		char buf[GMT_BUFSIZ] = {""};
 		if ((in = fopen (fullname, "r")) == NULL) {
 			GMT_Report (GMT->parent, GMT_MSG_ERROR, "Cannot initialize PostScript fonts because we cannot open %s\n", fullname);
+			free (font);
 			return GMT_ERROR_ON_FOPEN;
 		}
 
 		while (fgets (buf, GMT_BUFSIZ, in)) {
 			if (buf[0] == '#' || buf[0] == '\n' || buf[0] == '\r') continue;
-			if (i == n_alloc) GMT->session.font = gmt_M_malloc (GMT, GMT->session.font, i, &n_alloc, struct GMT_FONTSPEC);
-			if (sscanf (buf, "%s %lf %*d", fullname, &GMT->session.font[i].height) != 2) {
+			if (i == n_alloc) {
+				struct GMT_FONTSPEC *tmp = NULL;
+				n_alloc += GMT_SMALL_CHUNK;
+				if ((tmp = realloc (font, n_alloc * sizeof (struct GMT_FONTSPEC))) == NULL) {
+					fclose (in);
+					free (font);
+					return (GMT_MEMORY_ERROR);
+				}
+				font = tmp;
+			}
+			if (sscanf (buf, "%s %lf %*d", fullname, &font[i].height) != 2) {
 				GMT_Report (GMT->parent, GMT_MSG_WARNING, "Trouble decoding custom font info [%s].  Skipping this font.\n", buf);
 				continue;
 			}
@@ -7347,18 +7506,48 @@ GMT_LOCAL int gmtinit_init_fonts (struct GMT_CTRL *GMT) {
 				GMT_Report (GMT->parent, GMT_MSG_WARNING, "Font %s exceeds %d characters and will be truncated\n", fullname, PSL_FONTNAME_LEN);
 				fullname[PSL_FONTNAME_LEN-1] = '\0';
 			}
-			strncpy (GMT->session.font[i].name, fullname, PSL_FONTNAME_LEN);
+			strncpy (font[i].name, fullname, PSL_FONTNAME_LEN);
 			i++;
 		}
 		fclose (in);
-		GMT->session.n_fonts = i;
 	}
-	n_alloc = i;
-	GMT->session.font = gmt_M_malloc (GMT, GMT->session.font, 0, &n_alloc, struct GMT_FONTSPEC);
-	gmt_reset_meminc (GMT);
+	*table = font;
+	*n_fonts = i;
 	return (GMT_NOERROR);
 }
 
+/*! . */
+GMT_LOCAL int gmtinit_init_fonts (struct GMT_CTRL *GMT) {
+	int error = GMT_NOERROR;
+
+	/* First session to get here builds the process-global table; later sessions take a reference */
+
+	GMT_set_gmutex
+	if (gmtinit_font_refs == 0)
+		error = gmtinit_load_font_table (GMT, &gmtinit_font_table, &gmtinit_font_n);
+	if (error == GMT_NOERROR) {
+		gmtinit_font_refs++;
+		GMT->session.font = gmtinit_font_table;
+		GMT->session.n_fonts = gmtinit_font_n;
+	}
+	GMT_unset_gmutex
+	return (error);
+}
+
+/*! . */
+GMT_LOCAL void gmtinit_release_fonts (struct GMT_CTRL *GMT) {
+	/* Drop this session's reference to the shared font table; the last one out frees it */
+	GMT_set_gmutex
+	if (gmtinit_font_refs && --gmtinit_font_refs == 0) {
+		free (gmtinit_font_table);
+		gmtinit_font_table = NULL;
+		gmtinit_font_n = 0;
+	}
+	GMT_unset_gmutex
+	GMT->session.font = NULL;
+	GMT->session.n_fonts = 0;
+}
+
 /*! Gets the rata die of today */
 GMT_LOCAL void gmtinit_set_today (struct GMT_CTRL *GMT) {
 	time_t right_now = time (NULL);			/* Unix time right now */
@@ -7610,6 +7799,7 @@ GMT_LOCAL struct GMT_CTRL *gmtinit_new_GMT_ctrl (struct GMTAPI_CTRL *API, const
 	gmt_M_make_fnan (GMT->session.f_NaN);
 	gmt_M_make_dnan (GMT->session.d_NaN);
 	for (i = 0; i < 3; i++) GMT->session.no_rgb[i] = -1.0;
+	GMT->session.nc_cached_id = GMT_NOTSET;	/* No netCDF read handle kept open yet */
 
 #ifdef _OPENMP
 	/* Set the default number of threads = number of available cores, but only under OpenMP */
@@ -10503,44 +10693,138 @@ char gmt_set_V (int mode) {
 
 GMT_LOCAL int gmtinit_update_theme (struct GMT_CTRL *GMT);	/* Must set this here since the next two functions call each other */
 
+/*! One keyword = value pair parsed from a settings file */
+struct GMTINIT_DEF_ITEM {
+	char *keyword;
+	char *value;
+};
+
+/*! Process-lifetime cache of the most recently parsed settings file so repeated sessions in the
+ * same process can skip the file i/o and line parsing.  We keep one slot for the regular settings
+ * file and one for a theme file since a GMT_THEME setting makes every session read both.  A slot
+ * is only reused if path, size, and modification time all match what we read last time. */
+struct GMTINIT_DEF_CACHE {
+	char file[PATH_MAX];	/* Path of the file whose records we hold; empty means slot is unused */
+	time_t mtime;		/* Modification time when the file was read */
+	off_t size;		/* File size when the file was read */
+	bool old_gmt4;		/* true if the file was an old GMT4 file that must be skipped entirely */
+	unsigned int ver_warn;	/* 1|2 if one of the version warnings applies to this file, else 0 */
+	unsigned int n;		/* Number of cached keyword = value records */
+	unsigned int n_alloc;	/* Allocated length of the item array */
+	struct GMTINIT_DEF_ITEM *item;	/* The records, in file order */
+};
+
+static struct GMTINIT_DEF_CACHE gmt_defaults_cache[2];	/* Slot 0: settings file, slot 1: theme file */
+
+/*! Empty a cache slot before it is refilled with records from another file */
+GMT_LOCAL void gmtinit_def_cache_reset (struct GMTINIT_DEF_CACHE *C) {
+	unsigned int k;
+	for (k = 0; k < C->n; k++) {	/* The cache outlives any session so it uses the standard allocator */
+		free (C->item[k].keyword);
+		free (C->item[k].value);
+	}
+	free (C->item);
+	memset (C, 0, sizeof (struct GMTINIT_DEF_CACHE));
+}
+
+/*! Pass one keyword = value pair to the defaults machinery; shared by the parse and replay paths */
+GMT_LOCAL unsigned int gmtinit_def_process (struct GMT_CTRL *GMT, char *keyword, char *value) {
+	if (gmtlib_setparameter (GMT, keyword, value, true))
+		return 1;
+	else {
+		int case_val = gmt_hash_lookup (GMT, keyword, keys_hashnode, GMT_N_KEYS, GMT_N_KEYS);
+		if (case_val >= 0) GMT_keyword_updated[case_val] = true;		/* Leave a record that this keyword is no longer a default one */
+	}
+	return 0;
+}
+
 /*! . */
 GMT_LOCAL int gmtinit_loaddefaults (struct GMT_CTRL *GMT, char *file, bool theme) {
 	static int gmt_version_major = GMT_PACKAGE_VERSION_MAJOR;
-	unsigned int error = 0, rec = 0, ver;
+	bool caching;
+	unsigned int error = 0, rec = 0, ver, k;
 	char line[GMT_BUFSIZ] = {""}, keyword[GMT_LEN256] = {""}, value[GMT_BUFSIZ] = {""};
 	FILE *fp = NULL;
-
-	if ((fp = fopen (file, "r")) == NULL) return (GMT_NOTSET);
-	GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Reading GMT Default parameters from file: %s\n", file);
-	while (fgets (line, GMT_BUFSIZ, fp)) {
-		rec++;
-		gmt_chop (line); /* Get rid of [\r]\n */
-		if (rec == 1 && (line[0] == 'S' || line[0] == 'U'))	{	/* An old GMT4 gmt.conf got in the way */
-			fclose (fp);
+	struct stat S;
+	struct GMTINIT_DEF_CACHE *C = &gmt_defaults_cache[theme];	/* Each kind of file has its own slot */
+
+	caching = (stat (file, &S) == 0);	/* Without a stat signature we cannot detect later edits, so then we neither use nor fill the cache */
+	GMT_set_gmutex		/* The cache outlives any one session, so concurrent sessions must take turns looking it up or refilling it */
+	if (caching && C->file[0] && !strcmp (C->file, file) && C->mtime == S.st_mtime && C->size == S.st_size) {
+		/* Same file as last time and untouched since - replay the parsed records and skip the file i/o */
+		GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Reusing %u cached GMT Default parameters from file: %s\n", C->n, file);
+		if (C->old_gmt4) {	/* An old GMT4 gmt.conf got in the way */
+			GMT_unset_gmutex
 			return (GMT_NOERROR);
 		}
+		if (C->ver_warn == 1)
+			GMT_Report (GMT->parent, GMT_MSG_WARNING, "Your %s file (%s) may not be GMT %d compatible\n", GMT_SETTINGS_FILE, file, gmt_version_major);
+		else if (C->ver_warn == 2)
+			GMT_Report (GMT->parent, GMT_MSG_WARNING, "Your %s file (%s) is of version 5.0.0 and may need to be updated. Use \"gmtset -G%s\"\n", GMT_SETTINGS_FILE, file, file);
+		for (k = 0; k < C->n; k++)
+			error += gmtinit_def_process (GMT, C->item[k].keyword, C->item[k].value);
+	}
+	else {	/* Must read and parse the file, refilling the cache slot as we go */
+		if ((fp = fopen (file, "r")) == NULL) {
+			GMT_unset_gmutex
+			return (GMT_NOTSET);
+		}
+		GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Reading GMT Default parameters from file: %s\n", file);
+		gmtinit_def_cache_reset (C);
+		if (caching) {	/* Remember which file and vintage these records will belong to */
+			strncpy (C->file, file, PATH_MAX-1);
+			C->mtime = S.st_mtime;
+			C->size = S.st_size;
+		}
+		while (fgets (line, GMT_BUFSIZ, fp)) {
+			rec++;
+			gmt_chop (line); /* Get rid of [\r]\n */
+			if (rec == 1 && (line[0] == 'S' || line[0] == 'U'))	{	/* An old GMT4 gmt.conf got in the way */
+				fclose (fp);
+				C->old_gmt4 = caching;	/* Also skip it on replay */
+				GMT_unset_gmutex
+				return (GMT_NOERROR);
+			}
 
-		if (!theme) {	/* Must check validity and version */
-			if (rec != 2) { /* Nothing */ }
-			else if (strlen (line) < 7 || (ver = strtol (&line[6], NULL, 10)) < 5 )
-				GMT_Report (GMT->parent, GMT_MSG_WARNING, "Your %s file (%s) may not be GMT %d compatible\n", GMT_SETTINGS_FILE, file, gmt_version_major);
-			else if (!strncmp (&line[6], "5.0.0", 5))
-				GMT_Report (GMT->parent, GMT_MSG_WARNING, "Your %s file (%s) is of version 5.0.0 and may need to be updated. Use \"gmtset -G%s\"\n", GMT_SETTINGS_FILE, file, file);
-		}
-		if (line[0] == '#') continue;	/* Skip comments */
-		if (line[0] == '\0') continue;	/* Skip Blank lines */
+			if (!theme) {	/* Must check validity and version */
+				if (rec != 2) { /* Nothing */ }
+				else if (strlen (line) < 7 || (ver = strtol (&line[6], NULL, 10)) < 5 ) {
+					GMT_Report (GMT->parent, GMT_MSG_WARNING, "Your %s file (%s) may not be GMT %d compatible\n", GMT_SETTINGS_FILE, file, gmt_version_major);
+					C->ver_warn = 1;
+				}
+				else if (!strncmp (&line[6], "5.0.0", 5)) {
+					GMT_Report (GMT->parent, GMT_MSG_WARNING, "Your %s file (%s) is of version 5.0.0 and may need to be updated. Use \"gmtset -G%s\"\n", GMT_SETTINGS_FILE, file, file);
+					C->ver_warn = 2;
+				}
+			}
+			if (line[0] == '#') continue;	/* Skip comments */
+			if (line[0] == '\0') continue;	/* Skip Blank lines */
 
-		keyword[0] = value[0] = '\0';	/* Initialize */
-		sscanf (line, "%s = %[^\n]", keyword, value);
+			keyword[0] = value[0] = '\0';	/* Initialize */
+			sscanf (line, "%s = %[^\n]", keyword, value);
 
-		if (gmtlib_setparameter (GMT, keyword, value, true))
-			error++;
-		else {
-			int case_val = gmt_hash_lookup (GMT, keyword, keys_hashnode, GMT_N_KEYS, GMT_N_KEYS);
-			if (case_val >= 0) GMT_keyword_updated[case_val] = true;		/* Leave a record that this keyword is no longer a default one */
+			if (caching) {	/* Append this pair to the cache slot */
+				if (C->n == C->n_alloc) {
+					struct GMTINIT_DEF_ITEM *tmp = NULL;
+					unsigned int n_alloc = (C->n_alloc) ? C->n_alloc << 1 : GMT_TINY_CHUNK;
+					if ((tmp = realloc (C->item, n_alloc * sizeof (struct GMTINIT_DEF_ITEM))) == NULL) {	/* Just give up on caching this file */
+						gmtinit_def_cache_reset (C);
+						caching = false;
+					}
+					else
+						C->item = tmp, C->n_alloc = n_alloc;
+				}
+				if (caching) {
+					C->item[C->n].keyword = strdup (keyword);
+					C->item[C->n].value = strdup (value);
+					C->n++;
+				}
+			}
+			error += gmtinit_def_process (GMT, keyword, value);
 		}
+		fclose (fp);
 	}
-	fclose (fp);
+	GMT_unset_gmutex
 
 	error += gmtinit_update_theme (GMT);	/* If we got a GMT_THEME setting, take delayed action now */
 
@@ -14327,8 +14611,8 @@ void gmt_end (struct GMT_CTRL *GMT) {
 
 	gmtinit_put_history (GMT);
 
-	/* Remove font structures */
-	gmt_M_free (GMT, GMT->session.font);
+	/* Drop our reference to the shared font table */
+	gmtinit_release_fonts (GMT);
 #ifdef __FreeBSD__
 #ifdef _i386_
 	fpresetsticky (FP_X_DZ | FP_X_INV);
@@ -14359,6 +14643,14 @@ void gmt_end (struct GMT_CTRL *GMT) {
 
 	gmtlib_free_ogr (GMT, &(GMT->current.io.OGR), 1);	/* Free up the GMT/OGR structure, if used */
 	gmtlib_free_tmp_arrays (GMT);			/* Free temp memory for vector io or processing */
+	gmtlib_nc_release_cached (GMT);			/* Close any netCDF read handle kept open for reuse */
+	gmtlib_thread_pool_destroy (GMT);		/* Join and release the session thread pool, if used */
+	gmtlib_grdcache_free (GMT);			/* Release the session grid cache, if used */
+	gmtlib_cptcache_free (GMT);			/* Release the session CPT cache, if used */
+	gmtlib_macrocache_free (GMT);			/* Release the session cache of parsed math macro files, if used */
+	gmtlib_curlshare_free (GMT);			/* Release the session's pooled curl DNS/TLS/connection state, if used */
+	gmtlib_dcw_lists_free (GMT);			/* Release the session cache of parsed DCW lists, if used */
+	gmt_M_str_free (GMT->session.projsnapshot.key);	/* Release the projection-state snapshot key, if set */
 	gmtinit_free_user_media (GMT);
 	/* Terminate PSL machinery (if used) */
 	PSL_endsession (GMT->PSL);
@@ -14539,8 +14831,18 @@ int gmt_set_current_panel (struct GMTAPI_CTRL *API, int fig, int row, int col, d
 	 * and panel tag stuff only happens once. */
 	char file[PATH_MAX] = {""}, *L = NULL;
 	static char *dummy = "@";	/* Signify "use the the auto label" */
+	int prev_row = GMT_NOTSET, prev_col = GMT_NOTSET;
 	FILE *fp = NULL;
 	L = (label && label[0]) ? label : dummy;
+	if (gmtinit_get_current_panel (API, fig, &prev_row, &prev_col, NULL, NULL, NULL) == GMT_NOERROR && (prev_row != row || prev_col != col)) {
+		/* Entering a different (or the first) panel: record where its PS starts so gmt_strip_panel
+		 * can later cut this panel's slice(s) out of the figure for an incremental re-render */
+		snprintf (file, PATH_MAX, "%s/gmt.panelranges.%d", API->gwf_dir, fig);
+		if ((fp = fopen (file, "a"))) {
+			fprintf (fp, "%d %d %" PRIuS "\n", row, col, gmt_ps_current_size (API, fig));
+			fclose (fp);
+		}
+	}
 	snprintf (file, PATH_MAX, "%s/gmt.panel.%d", API->gwf_dir, fig);
 	if ((fp = fopen (file, "w")) == NULL) {
 		GMT_Report (API, GMT_MSG_ERROR, "Unable to create file %s!\n", file);
@@ -16480,7 +16782,35 @@ struct GMT_CTRL * gmt_begin_module (struct GMTAPI_CTRL *API, const char *lib_nam
 	return (gmt_init_module (API, lib_name, mod_name, "", "", NULL, NULL, Ccopy));
 }
 
-/*! . */
+/*! Return monotonic wall-clock seconds (arbitrary epoch); backs the gmt_M_tic/gmt_M_toc macros
+ * and the per-operator cost probes in grdmath/gmtmath, so it is compiled unconditionally */
+double gmtlib_wall_clock (void) {
+#ifdef WIN32
+	LARGE_INTEGER t, f;
+	QueryPerformanceCounter (&t);
+	QueryPerformanceFrequency (&f);
+	return ((double)t.QuadPart / (double)f.QuadPart);
+#else
+	struct timespec ts;
+	clock_gettime (CLOCK_MONOTONIC, &ts);
+	return ((double)ts.tv_sec + 1.0e-9 * (double)ts.tv_nsec);
+#endif
+}
+
+#ifdef GMT_ENABLE_TIMINGS
+/*! Report the hot-path timings accumulated during this module run, then reset them */
+GMT_LOCAL void gmtinit_report_timings (struct GMT_CTRL *GMT) {
+	static char *phase[GMT_TIMING_N_PHASES] = {"data i/o", "map setup", "grid i/o", "ps output"};
+	unsigned int k;
+	for (k = 0; k < GMT_TIMING_N_PHASES; k++) {
+		if (GMT->hidden.timings.count[k] == 0) continue;
+		GMT_Report (GMT->parent, GMT_MSG_NOTICE, "Timings: %-9s: %.6f s over %" PRIu64 " intervals\n",
+			phase[k], GMT->hidden.timings.accum[k], GMT->hidden.timings.count[k]);
+	}
+	gmt_M_memset (&GMT->hidden.timings, 1, struct GMT_TIMINGS);
+}
+#endif
+
 void gmt_end_module (struct GMT_CTRL *GMT, struct GMT_CTRL *Ccopy) {
 	unsigned int i, V_level = GMT->current.setting.verbose;	/* Keep copy of currently selected level */
 	unsigned int func_level_bak = GMT->hidden.func_level;
@@ -16502,6 +16832,7 @@ void gmt_end_module (struct GMT_CTRL *GMT, struct GMT_CTRL *Ccopy) {
 		if (GMT->current.gdal_read_in.hCT_inv)
 			OCTDestroyCoordinateTransformation(GMT->current.gdal_read_in.hCT_inv);
 		GMT->current.gdal_read_in.hCT_fwd = GMT->current.gdal_read_in.hCT_inv = NULL;
+		gmtlib_nc_release_cached (GMT);		/* Close any netCDF read handle kept open for repeated layer reads */
 	}
 
 	if (GMT->hidden.func_level == GMT_TOP_MODULE && GMT->current.ps.oneliner && GMT->current.ps.active) {
@@ -16536,6 +16867,10 @@ void gmt_end_module (struct GMT_CTRL *GMT, struct GMT_CTRL *Ccopy) {
 		           GMT->current.proj.n_geodesic_calls, GMT->current.proj.n_geodesic_approx);
 	}
 
+#ifdef GMT_ENABLE_TIMINGS
+	if (GMT->hidden.func_level == GMT_TOP_MODULE) gmtinit_report_timings (GMT);	/* Only report once per top-level module run */
+#endif
+
 	gmtlib_garbage_collection (GMT->parent, GMT->hidden.func_level);	/* Free up all registered memory for this module level */
 
 	/* At the end of the module we restore all GMT settings as we found them (in Ccopy) */
@@ -19124,16 +19459,28 @@ struct GMT_CTRL *gmt_begin (struct GMTAPI_CTRL *API, const char *session, unsign
 
 	gmtinit_init_unit_conversion (GMT);	/* Set conversion factors from various units to meters */
 
-	if (gmt_hash_init (GMT, keys_hashnode, GMT_keyword, GMT_N_KEYS, GMT_N_KEYS)) {	/* Initialize hash table for GMT defaults */
-		gmtinit_free_GMT_ctrl (GMT);	/* Deallocate control structure */
-		return NULL;
+	GMT_set_gmutex
+	if (!keys_hashnode_ready) {	/* First session in this process builds the hash table for GMT defaults; the keyword list is static so later sessions just reuse it */
+		if (gmt_hash_init (GMT, keys_hashnode, GMT_keyword, GMT_N_KEYS, GMT_N_KEYS)) {	/* Initialize hash table for GMT defaults */
+			GMT_unset_gmutex
+			gmtinit_free_GMT_ctrl (GMT);	/* Deallocate control structure */
+			return NULL;
+		}
+		keys_hashnode_ready = true;
 	}
+	GMT_unset_gmutex
 
 	/* Set up hash table for colornames (used to convert <colorname> to <r/g/b>) */
 
-	if (gmt_hash_init (GMT, GMT->session.rgb_hashnode, gmt_M_color_name, GMT_N_COLOR_NAMES, GMT_N_COLOR_NAMES)) {
-		gmtinit_free_GMT_ctrl (GMT);	/* Deallocate control structure */
-		return NULL;
+	if (rgb_hashnode_ready)	/* Copy the table built by an earlier session in this process; its keys point into the static gmt_M_color_name list */
+		gmt_M_memcpy (GMT->session.rgb_hashnode, rgb_hashnode_copy, GMT_N_COLOR_NAMES, struct GMT_HASH);
+	else {
+		if (gmt_hash_init (GMT, GMT->session.rgb_hashnode, gmt_M_color_name, GMT_N_COLOR_NAMES, GMT_N_COLOR_NAMES)) {
+			gmtinit_free_GMT_ctrl (GMT);	/* Deallocate control structure */
+			return NULL;
+		}
+		gmt_M_memcpy (rgb_hashnode_copy, GMT->session.rgb_hashnode, GMT_N_COLOR_NAMES, struct GMT_HASH);
+		rgb_hashnode_ready = true;
 	}
 
 	GMT_Report (API, GMT_MSG_DEBUG, "Enter: gmt_reload_settings\n");
@@ -19516,6 +19863,15 @@ GMT_LOCAL bool gmtinit_check_if_autosize (struct GMTAPI_CTRL *API, int ID) {
 	 * which we used to enforce automatic cropping to actual size [and possible extra margins] */
 	char file[PATH_MAX] = {""};
 	FILE *fp;
+	struct GMT_PS_ARENA *A = NULL;
+	if ((A = gmt_ps_arena_get (API, ID, false)) && A->buffer) {	/* Examine the in-memory PS instead */
+		char *line = strchr (A->buffer, '\n'), *next = NULL;
+		if (line == NULL || (next = strchr (++line, '\n')) == NULL) return false;
+		next[0] = '\0';	/* Temporarily terminate the second line with the BoundingBox code */
+		snprintf (file, PATH_MAX, "%s", line);
+		next[0] = '\n';
+		return (strstr (file, "32767 32767") != NULL);	/* Max paper size means auto-sized media */
+	}
 	snprintf (file, PATH_MAX, "%s/gmt_%d.ps-", API->gwf_dir, ID);	/* Current half-baked PostScript file */
 	if ((fp = fopen (file, "r")) == NULL) {	/* This is an unmitigated disaster */
 		GMT_Report (API, GMT_MSG_ERROR, "Failed to open half-baked PostScript file %s\n", file);
@@ -19554,9 +19910,11 @@ GMT_LOCAL int gmtinit_process_figures (struct GMTAPI_CTRL *API, char *show) {
 
 	char cmd[GMT_BUFSIZ] = {""}, fmt[GMT_LEN16] = {""}, option[GMT_LEN256] = {""}, p[GMT_LEN256] = {""}, dir[PATH_MAX] = {""}, legend_justification[4] = {""}, mark;
 	char pen[GMT_LEN32] = {""}, fill[GMT_LEN32] = {""}, off[GMT_LEN32] = {""}, device_extra[GMT_LEN8] = {""}, *do_gray[2] = {"", "+m"};
+	char source[PATH_MAX] = {""};
 	char *copy = NULL, *ptr = NULL, *format = NULL, *c = NULL;
 	struct GMT_FIGURE *fig = NULL;
-	bool not_PS, auto_size;
+	struct GMT_PS_ARENA *A = NULL;
+	bool not_PS, auto_size, in_memory;
 	int error, k, f, nf, n_figs, n_orig, gcode[GMT_LEN16], jpeg_quality = GMT_JPEG_DEF_QUALITY, monochrome = 0;
 	unsigned int pos = 0;
 	double legend_width = 0.0, legend_scale = 1.0;
@@ -19597,13 +19955,16 @@ GMT_LOCAL int gmtinit_process_figures (struct GMTAPI_CTRL *API, char *show) {
 			if (fmt[f] == 'j' && jpeg_quality != GMT_JPEG_DEF_QUALITY)
 				sprintf (device_extra, "+q%d", jpeg_quality);	/* Need to pass quality modifier */
 			mark = '-';	/* This is the last char in extension for a half-baked GMT PostScript file */
-			snprintf (cmd, GMT_BUFSIZ, "%s/gmt_%d.ps%c", API->gwf_dir, fig[k].ID, mark);	/* Check if the file exists */
-			if (access (cmd, F_OK)) {	/* No such file, check if the fully baked file is there instead */
-				mark = '+';	/* This is the last char in extension for a fully-baked GMT PostScript file */
+			in_memory = ((A = gmt_ps_arena_get (API, fig[k].ID, false)) && A->n);	/* True if this figure's PS lives in the session arena */
+			if (!in_memory) {
 				snprintf (cmd, GMT_BUFSIZ, "%s/gmt_%d.ps%c", API->gwf_dir, fig[k].ID, mark);	/* Check if the file exists */
-				if (access (cmd, F_OK)) {	/* No such file ether, give up; warn if a fig set via gmt figure (k > 0) and it is not the movie_background case which may not have a plot to go with it */
-					if (k && strcmp (fig[k].prefix, "movie_background")) GMT_Report (API, GMT_MSG_WARNING, "Figure # %d (%s) was registered but no matching PostScript-|+ file found - skipping\n", fig[k].ID, fig[k].prefix);
-					continue;
+				if (access (cmd, F_OK)) {	/* No such file, check if the fully baked file is there instead */
+					mark = '+';	/* This is the last char in extension for a fully-baked GMT PostScript file */
+					snprintf (cmd, GMT_BUFSIZ, "%s/gmt_%d.ps%c", API->gwf_dir, fig[k].ID, mark);	/* Check if the file exists */
+					if (access (cmd, F_OK)) {	/* No such file ether, give up; warn if a fig set via gmt figure (k > 0) and it is not the movie_background case which may not have a plot to go with it */
+						if (k && strcmp (fig[k].prefix, "movie_background")) GMT_Report (API, GMT_MSG_WARNING, "Figure # %d (%s) was registered but no matching PostScript-|+ file found - skipping\n", fig[k].ID, fig[k].prefix);
+						continue;
+					}
 				}
 			}
 			if (gmt_get_legend_info (API, &legend_width, &legend_scale, legend_justification, pen, fill, off)) {	/* Unplaced legend file */
@@ -19620,16 +19981,20 @@ GMT_LOCAL int gmtinit_process_figures (struct GMTAPI_CTRL *API, char *show) {
 				API->GMT->common.l.active = active;
 			}
 
-			/* Here the file exists and we can call psconvert. Note we still pass *.ps- even if *.ps+ was found since psconvert will do the same check */
+			/* Here the file (or arena) exists and we can call psconvert. Note we still pass *.ps- even if *.ps+ was found since psconvert will do the same check */
+			if (in_memory)	/* Hand psconvert the in-memory PS via the special = source */
+				snprintf (source, PATH_MAX, "=");
+			else
+				snprintf (source, PATH_MAX, "'%s/gmt_%d.ps-'", API->gwf_dir, fig[k].ID);
 			gmt_filename_set (fig[k].prefix);
 			if ((c = strrchr (fig[k].prefix, '/'))) {	/* Must pass any leading directory in the file name via -D and file prefix via -F */
 				char *file_only = &c[1];	/* The file name */
 				c[0] = '\0';		/* Temporarily chop off the file to yield directory only */
-				snprintf (cmd, GMT_BUFSIZ, "'%s/gmt_%d.ps-' -T%c%s%s -D%s -F%s", API->gwf_dir, fig[k].ID, fmt[f], device_extra, do_gray[monochrome], fig[k].prefix, file_only);
+				snprintf (cmd, GMT_BUFSIZ, "%s -T%c%s%s -D%s -F%s", source, fmt[f], device_extra, do_gray[monochrome], fig[k].prefix, file_only);
 				c[0] = '/';		/* Restore last slash */
 			}
 			else	/* Place products in current directory */
-				snprintf (cmd, GMT_BUFSIZ, "'%s/gmt_%d.ps-' -T%c%s%s -F%s", API->gwf_dir, fig[k].ID, fmt[f], device_extra, do_gray[monochrome], fig[k].prefix);
+				snprintf (cmd, GMT_BUFSIZ, "%s -T%c%s%s -F%s", source, fmt[f], device_extra, do_gray[monochrome], fig[k].prefix);
 			gmt_filename_get (fig[k].prefix);
 			not_PS = (fmt[f] != 'p');	/* Do not add convert options if plain PS */
 			/* Append psconvert optional settings */
@@ -19667,8 +20032,21 @@ GMT_LOCAL int gmtinit_process_figures (struct GMTAPI_CTRL *API, char *show) {
 			}
 			else if (not_PS && auto_size) /* No specific settings but must always add -A if not PostScript unless when media size is given */
 				strcat (cmd, " -A");
+			if (in_memory) {	/* Lend the arena to PSL so psconvert can rip it straight from memory */
+				A = gmt_ps_arena_get (API, fig[k].ID, false);	/* Re-fetch in case the auto-legend grew the plot */
+				PSL_setplot (API->GMT->PSL, A->buffer, A->n, A->n_alloc, A->pmode);
+				A->buffer = NULL;	A->n = A->n_alloc = 0;
+				if (API->GMT->PSL->internal.pmode != 3) {	/* Half-baked, so finalize the trailer in memory */
+					API->GMT->PSL->internal.call_level++;	/* Must increment here since PSL_beginplot not called, and PSL_endplot will decrement */
+					PSL_endplot (API->GMT->PSL, 1);
+					GMT_Report (API, GMT_MSG_DEBUG, "Fattened up in-memory PS for figure %d\n", fig[k].ID);
+				}
+			}
 			GMT_Report (API, GMT_MSG_DEBUG, "psconvert: %s\n", cmd);
-			if ((error = GMT_Call_Module (API, "psconvert", GMT_MODULE_CMD, cmd))) {
+			error = GMT_Call_Module (API, "psconvert", GMT_MODULE_CMD, cmd);
+			if (in_memory && (A = gmt_ps_arena_get (API, fig[k].ID, false)))	/* Reclaim the completed PS from PSL for any further formats */
+				A->buffer = PSL_detachplot (API->GMT->PSL, &A->n, &A->n_alloc, &A->pmode);
+			if (error) {
 				GMT_Report (API, GMT_MSG_ERROR, "Failed to call psconvert\n");
 				gmt_M_free (API->GMT, fig);
 				gmt_M_str_free (copy);
@@ -20383,6 +20761,7 @@ int gmt_manage_workflow (struct GMTAPI_CTRL *API, unsigned int mode, char *text)
 			GMT_Report (API, GMT_MSG_DEBUG, "%s Workflow.  Session ID = %s. Directory %s %s.\n", smode[mode], API->session_name, API->gwf_dir, fstatus[3]);
 			if ((error = gmtinit_process_figures (API, text)))
 				GMT_Report (API, GMT_MSG_ERROR, "gmtinit_process_figures returned error %d\n", error);
+			gmt_free_ps_arenas (API);	/* Free any in-memory PostScript now that the figures are done */
 			GMT_Report (API, GMT_MSG_INFORMATION, "Destroying the current workflow directory %s\n", API->gwf_dir);
 			if (gmt_remove_dir (API, dir, false))
 				GMT_Report (API, GMT_MSG_WARNING, "Unable to remove directory %s [permissions?]\n", dir);
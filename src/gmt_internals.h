@@ -143,6 +143,14 @@ EXTERN_MSC char * gmtlib_getparameter (struct GMT_CTRL *GMT, const char *keyword
 EXTERN_MSC unsigned int gmtlib_setparameter (struct GMT_CTRL *GMT, const char *keyword, char *value, bool core);
 EXTERN_MSC int gmtlib_report_func (struct GMT_CTRL *GMT, unsigned int level, const char *source_line, const char *format, ...);
 EXTERN_MSC int gmtlib_get_num_processors ();
+EXTERN_MSC void gmtlib_thread_pool_destroy (struct GMT_CTRL *GMT);
+EXTERN_MSC void gmtlib_grdcache_free (struct GMT_CTRL *GMT);
+EXTERN_MSC void gmtlib_cptcache_free (struct GMT_CTRL *GMT);
+EXTERN_MSC void gmtlib_macrocache_free (struct GMT_CTRL *GMT);
+EXTERN_MSC void gmtlib_curlshare_free (struct GMT_CTRL *GMT);
+EXTERN_MSC void gmtlib_dcw_lists_free (struct GMT_CTRL *GMT);
+EXTERN_MSC struct GMT_GRID *gmtlib_grdcache_fetch_derived (struct GMT_CTRL *GMT, const char *source, const char *spec);
+EXTERN_MSC void gmtlib_grdcache_store_derived (struct GMT_CTRL *GMT, const char *source, const char *spec, struct GMT_GRID *G);
 EXTERN_MSC int gmtlib_bcr_get_img (struct GMT_CTRL *GMT, struct GMT_IMAGE *I, double xx, double yy, unsigned char *z);		/* Compute z(x,y) from bcr structure and image */
 EXTERN_MSC void gmtlib_suggest_fft_dim (struct GMT_CTRL *GMT, unsigned int nx, unsigned int ny, struct GMT_FFT_SUGGESTION *fft_sug, bool do_print);
 EXTERN_MSC int gmtlib_read_grd_info (struct GMT_CTRL *GMT, char *file, struct GMT_GRID_HEADER *header);
@@ -168,13 +176,16 @@ EXTERN_MSC int gmtlib_plot_C_format (struct GMT_CTRL *GMT);
 EXTERN_MSC int gmtlib_clock_C_format (struct GMT_CTRL *GMT, char *form, struct GMT_CLOCK_IO *S, unsigned int mode);
 EXTERN_MSC int gmtlib_date_C_format (struct GMT_CTRL *GMT, char *form, struct GMT_DATE_IO *S, unsigned int mode);
 EXTERN_MSC void * gmtlib_ascii_textinput (struct GMT_CTRL *GMT, FILE *fp, uint64_t *ncol, int *status);
+EXTERN_MSC void gmtlib_set_trailing_text (struct GMT_CTRL *GMT, const char *text);
 EXTERN_MSC double gmtlib_get_map_interval (struct GMT_CTRL *GMT, unsigned int type, struct GMT_PLOT_AXIS_ITEM *T);
 EXTERN_MSC unsigned int gmtlib_log_array (struct GMT_CTRL *GMT, double min, double max, double delta, double **array);
+EXTERN_MSC void gmtlib_nc_release_cached (struct GMT_CTRL *GMT);
 EXTERN_MSC int gmtlib_nc_get_att_text (struct GMT_CTRL *GMT, int ncid, int varid, char *name, char *text, size_t textlen);
 EXTERN_MSC int gmtlib_nc_get_att_vtext (struct GMT_CTRL *GMT, int ncid, int varid, char *name, struct GMT_GRID_HEADER *h, char *text, size_t textlen);
 EXTERN_MSC int gmtlib_nc_put_att_vtext (struct GMT_CTRL *GMT, int ncid, char *name, struct GMT_GRID_HEADER *h);
 EXTERN_MSC int gmtlib_akima (struct GMT_CTRL *GMT, double *x, double *y, uint64_t nx, double *c);
 EXTERN_MSC int gmtlib_cspline (struct GMT_CTRL *GMT, double *x, double *y, uint64_t n, double *c);
+EXTERN_MSC int gmtlib_intpol_many (struct GMT_CTRL *GMT, double *x, double **y, double *w, uint64_t n_cols, uint64_t n, uint64_t m, double *u, double **v, double p, int mode);
 EXTERN_MSC bool gmtlib_annot_pos (struct GMT_CTRL *GMT, double min, double max, struct GMT_PLOT_AXIS_ITEM *T, double coord[], double *pos);
 EXTERN_MSC gmt_grdfloat gmtlib_decode (struct GMT_CTRL *GMT, void *vptr, uint64_t k, unsigned int type);
 EXTERN_MSC void gmtlib_encode (struct GMT_CTRL *GMT, void *vptr, uint64_t k, gmt_grdfloat z, unsigned int type);
@@ -268,6 +279,9 @@ EXTERN_MSC char ** gmtlib_get_dirs (struct GMT_CTRL *GMT, char *path);
 EXTERN_MSC void gmtlib_assign_segment (struct GMT_CTRL *GMT, unsigned int direction, struct GMT_DATASEGMENT *S, uint64_t n_rows, uint64_t n_columns);
 EXTERN_MSC double * gmtlib_assign_vector (struct GMT_CTRL *GMT, uint64_t n_rows, uint64_t col);
 EXTERN_MSC void gmtlib_free_tmp_arrays (struct GMT_CTRL *GMT);
+EXTERN_MSC struct GMT_MEM_ARENA * gmtlib_mem_arena_create (struct GMT_CTRL *GMT, size_t n_bytes);
+EXTERN_MSC void * gmtlib_mem_arena_alloc (struct GMT_CTRL *GMT, struct GMT_MEM_ARENA *A, size_t n_bytes);
+EXTERN_MSC void gmtlib_mem_arena_free (struct GMT_CTRL *GMT, struct GMT_MEM_ARENA **A);
 EXTERN_MSC unsigned int gmtlib_split_line_at_dateline (struct GMT_CTRL *GMT, struct GMT_DATASEGMENT *S, struct GMT_DATASEGMENT ***Lout);
 EXTERN_MSC int gmtlib_detrend (struct GMT_CTRL *GMT, double *x, double *y, uint64_t n, double increment, double *intercept, double *slope, int mode);
 EXTERN_MSC double gmtlib_conv_distance (struct GMT_CTRL *GMT, double value, char in_unit, char out_unit);
@@ -300,6 +314,8 @@ int gmtlib_read_image_info (struct GMT_CTRL *GMT, char *file, bool must_be_image
 EXTERN_MSC int gmtlib_is_gdal_grid (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header);
 EXTERN_MSC void gmtlib_GDALDestroyDriverManager (struct GMTAPI_CTRL *API);
 
+EXTERN_MSC double gmtlib_wall_clock (void);	/* Monotonic clock backing the gmt_M_tic/gmt_M_toc macros and operator cost probes */
+
 /* LOCAL MACROS USED BY GMT_*.C ONLY - NOT PART OF GMT_DEV.H DISTRIBUTION */
 
 /* Definition for an error trap */
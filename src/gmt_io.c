@@ -221,6 +221,14 @@
 #include <windows.h>
 #endif
 
+#ifndef _WIN32	/* Memory-mapped read path for the native columnar table format */
+#include <sys/mman.h>
+#endif
+
+#ifdef HAVE_FCNTL_H_	/* For posix_fadvise readahead hints on sequential table reads */
+#	include <fcntl.h>
+#endif
+
 #define return_null(GMT,err) { GMT->parent->error = err; return (NULL);}
 
 static const char *GMT_type[GMT_N_TYPES] = {"byte", "byte", "integer", "integer", "integer", "integer",
@@ -1109,9 +1117,13 @@ GMT_LOCAL int gmtio_bin_output (struct GMT_CTRL *GMT, FILE *fp, uint64_t n, doub
 
 /*! . */
 int gmt_ascii_output_no_text (struct GMT_CTRL *GMT, FILE *fp, uint64_t n, double *ptr, char *txt) {
+	/* We used to make one locked stdio call per field plus one per separator; for many-column
+	 * tables with hundreds of millions of records those calls dominated the formatting itself.
+	 * Instead we assemble the whole record in a buffer and hand it to fwrite once. */
 	uint64_t i, col, last, n_out;
-	int e = 0;
+	size_t len = 0, flen, sep_len = strlen (GMT->current.setting.io_col_separator);
 	double val;
+	char record[GMT_BUFSIZ] = {""}, text[GMT_LEN256] = {""};
 	gmt_M_unused (txt);
 
 	if (gmt_skip_output (GMT, ptr, n)) return (GMT_NOTSET);	/* Record was skipped via -s[a|r] */
@@ -1119,7 +1131,7 @@ int gmt_ascii_output_no_text (struct GMT_CTRL *GMT, FILE *fp, uint64_t n, double
 
 	last = n_out - 1;				/* Last filed, need to output linefeed instead of delimiter */
 
-	for (i = 0; i < n_out && e >= 0; i++) {		/* Keep writing all fields unless there is a read error (e == -1) */
+	for (i = 0; i < n_out; i++) {		/* Format all fields into the record buffer */
 		if (GMT->common.o.col.select)	/* Which data column to pick */
 			col = GMT->current.io.col[GMT_OUT][i].col;
 		else if (GMT->current.setting.io_lonlat_toggle[GMT_OUT] && i < 2)
@@ -1131,14 +1143,21 @@ int gmt_ascii_output_no_text (struct GMT_CTRL *GMT, FILE *fp, uint64_t n, double
 		if (GMT->common.d.active[GMT_OUT] && gmt_M_is_dnan (val))	/* Write this value instead of NaNs */
 			val = GMT->common.d.nan_proxy[GMT_OUT];
 
-		e = gmt_ascii_output_col (GMT, fp, val, col);	/* Write one item without any separator at the end */
-
+		gmt_ascii_format_col (GMT, text, val, GMT_OUT, col);	/* Format one item without any separator at the end */
+		flen = strlen (text);
+		if (len + flen + sep_len + 1 > GMT_BUFSIZ) {	/* No room for this field; flush what we have so far */
+			if (fwrite (record, 1U, len, fp) != len) return (GMT_NOTSET);
+			len = 0;
+		}
+		memcpy (&record[len], text, flen);	len += flen;
 		if (i == last)					/* This is the last field, must add newline */
-			putc ('\n', fp);
-		else if (GMT->current.setting.io_col_separator[0])		/* Not last field, and a separator is required */
-			fprintf (fp, "%s", GMT->current.setting.io_col_separator);
+			record[len++] = '\n';
+		else if (sep_len) {				/* Not last field, and a separator is required */
+			memcpy (&record[len], GMT->current.setting.io_col_separator, sep_len);
+			len += sep_len;
+		}
 	}
-	return ((e < 0) ? GMT_NOTSET : 0);
+	return ((fwrite (record, 1U, len, fp) == len) ? 0 : GMT_NOTSET);
 }
 
 GMT_LOCAL void gmtio_output_trailing_text (struct GMT_CTRL *GMT, FILE *fp, bool separator, char *txt) {
@@ -1173,14 +1192,17 @@ int gmtlib_ascii_output_trailing_text (struct GMT_CTRL *GMT, FILE *fp, uint64_t
 
 /*! . */
 GMT_LOCAL int gmtio_ascii_output_with_text (struct GMT_CTRL *GMT, FILE *fp, uint64_t n, double *ptr, char *txt) {
+	/* As gmt_ascii_output_no_text, the numerical fields are assembled in a buffer and written
+	 * in one fwrite call; only the trailing text still goes through its own formatter. */
 	uint64_t i, col, n_out;
-	int e = 0;
+	size_t len = 0, flen, sep_len = strlen (GMT->current.setting.io_col_separator);
 	double val;
+	char record[GMT_BUFSIZ] = {""}, text[GMT_LEN256] = {""};
 
 	if (gmt_skip_output (GMT, ptr, n)) return (GMT_NOTSET);	/* Record was skipped via -s[a|r] */
 	n_out = (GMT->common.o.col.select) ? GMT->common.o.col.n_cols : n;
 
-	for (i = 0; i < n_out && e >= 0; i++) {		/* Keep writing all fields unless there is a read error (e == -1) */
+	for (i = 0; i < n_out; i++) {		/* Format all fields into the record buffer */
 		if (GMT->common.o.col.select)	/* Which data column to pick */
 			col = GMT->current.io.col[GMT_OUT][i].col;
 		else if (GMT->current.setting.io_lonlat_toggle[GMT_OUT] && i < 2)
@@ -1191,14 +1213,22 @@ GMT_LOCAL int gmtio_ascii_output_with_text (struct GMT_CTRL *GMT, FILE *fp, uint
 		if (GMT->common.d.active[GMT_OUT] && gmt_M_is_dnan (val))	/* Write this value instead of NaNs */
 			val = GMT->common.d.nan_proxy[GMT_OUT];
 
-		e = gmt_ascii_output_col (GMT, fp, val, col);	/* Write one item without any separator at the end */
-
-		if (i < (n_out-1) && GMT->current.setting.io_col_separator[0])		/* Not last field, and a separator is required */
-			fprintf (fp, "%s", GMT->current.setting.io_col_separator);
+		gmt_ascii_format_col (GMT, text, val, GMT_OUT, col);	/* Format one item without any separator at the end */
+		flen = strlen (text);
+		if (len + flen + sep_len > GMT_BUFSIZ) {	/* No room for this field; flush what we have so far */
+			if (fwrite (record, 1U, len, fp) != len) return (GMT_NOTSET);
+			len = 0;
+		}
+		memcpy (&record[len], text, flen);	len += flen;
+		if (i < (n_out-1) && sep_len) {		/* Not last field, and a separator is required */
+			memcpy (&record[len], GMT->current.setting.io_col_separator, sep_len);
+			len += sep_len;
+		}
 	}
+	if (fwrite (record, 1U, len, fp) != len) return (GMT_NOTSET);
 	gmtio_output_trailing_text (GMT, fp, true, txt);
 
-	return ((e < 0) ? GMT_NOTSET : 0);
+	return (0);
 }
 
 GMT_LOCAL int gmtio_ascii_output (struct GMT_CTRL *GMT, FILE *fp, uint64_t n, double *ptr, char *txt) {
@@ -3630,22 +3660,40 @@ GMT_LOCAL unsigned int gmtio_examine_current_record (struct GMT_CTRL *GMT, char
 	return (ret_val);
 }
 
+void gmtlib_set_trailing_text (struct GMT_CTRL *GMT, const char *text) {
+	/* Copy text into the session's trailing-text scratch buffer.  Unlike strncpy we only touch
+	 * the bytes actually present, so short records do not pay for zero-filling all GMT_BUFSIZ
+	 * bytes on every call - that fill dominates when streaming billions of records. */
+	size_t len = strlen (text);
+	if (len >= GMT_BUFSIZ) len = GMT_BUFSIZ - 1;
+	memcpy (GMT->current.io.curr_trailing_text, text, len);
+	GMT->current.io.curr_trailing_text[len] = '\0';
+}
+
 GMT_LOCAL void gmtio_extract_trailing_text (struct GMT_CTRL *GMT, size_t start_of_text) {
 	if (GMT->common.i.col.word) {	/* Need to extract a specific column from the trailing text */
-		char *word = NULL, *orig = strdup (&GMT->current.io.curr_text[start_of_text]), *trail = orig;
+		/* Walk the words in place instead of tokenizing a per-record strdup scratch copy */
+		char *p = &GMT->current.io.curr_text[start_of_text], *word = NULL;
 		uint64_t col = 0;
-		while (col != GMT->common.i.col.w_col && (word = strsep (&trail, GMT_TOKEN_SEPARATORS)) != NULL) {
-			if (*word != '\0')	/* Skip empty strings */
-				col++;
+		size_t len = 0;
+		while (col != GMT->common.i.col.w_col && *p) {
+			p += strspn (p, GMT_TOKEN_SEPARATORS);	/* Skip any leading separators */
+			if (*p == '\0') break;	/* Only separators remained */
+			len = strcspn (p, GMT_TOKEN_SEPARATORS);	/* Length of this word */
+			word = p;
+			col++;
+			p += len;
+		}
+		if (word && col == GMT->common.i.col.w_col) {
+			if (len >= GMT_BUFSIZ) len = GMT_BUFSIZ - 1;
+			memcpy (GMT->current.io.curr_trailing_text, word, len);
+			GMT->current.io.curr_trailing_text[len] = '\0';
 		}
-		if (word)
-			strncpy (GMT->current.io.curr_trailing_text, word, GMT_BUFSIZ-1);
 		else
 			GMT_Report (GMT->parent, GMT_MSG_WARNING, "Trailing text did not have %" PRIu64 " words - no trailing word read\n", GMT->common.i.col.w_col);
-		gmt_M_str_free (orig);
 	}
 	else	/* Get the whole enchilada */
-		strncpy (GMT->current.io.curr_trailing_text, &GMT->current.io.curr_text[start_of_text], GMT_BUFSIZ-1);
+		gmtlib_set_trailing_text (GMT, &GMT->current.io.curr_text[start_of_text]);
 }
 
 GMT_LOCAL inline int gmtio_reached_EOF (struct GMT_CTRL *GMT) {
@@ -3664,13 +3712,71 @@ GMT_LOCAL inline int gmtio_reached_EOF (struct GMT_CTRL *GMT) {
 
 /*! This is the lowest-most input function in GMT.  All ASCII table data are read via
  * gmt_ascii_input.  Changes here affect all programs that read such data. */
+/*! . */
+GMT_LOCAL unsigned int gmtio_fast_scan_cols (struct GMT_CTRL *GMT, uint64_t n_cols) {
+	/* Determine if records from the current source may be decoded by the bulk record
+	 * scanner below, bypassing the per-field strsepz + gmt_scanf machinery.  This
+	 * requires simple columns only: no -i column selection, no trailing text, no
+	 * OGR/aspatial additions, no periodic time column, and every expected input
+	 * column of type GMT_IS_FLOAT, GMT_IS_LON or GMT_IS_LAT.  Geographic columns are
+	 * included because in practice they nearly always hold plain decimal degrees; a
+	 * field that actually uses DMS or hemisphere notation makes the scanner reject
+	 * that record so it gets the full gmt_scanf treatment instead.  Time, dimension
+	 * and other formatted types always take the general path since their decoding
+	 * needs the full calendar/unit machinery.
+	 * Returns the number of such leading columns, or 0 if the fast path cannot be used. */
+	uint64_t col;
+	unsigned int type;
+	if (GMT->common.i.col.select || GMT->current.io.trailing_text[GMT_IN] || GMT->current.io.variable_in_columns) return 0;
+	if (GMT->current.io.ogr != GMT_OGR_FALSE || GMT->current.io.cycle_col >= 0) return 0;
+	if (GMT->current.setting.io_lonlat_toggle[GMT_IN] || GMT->current.proj.inv_coordinates) return 0;
+	if (n_cols == 0 || n_cols >= GMT_MAX_COLUMNS) return 0;
+	for (col = 0; col < n_cols; col++) {
+		type = gmt_M_type (GMT, GMT_IN, col);
+		if (!(type == GMT_IS_FLOAT || type == GMT_IS_LON || type == GMT_IS_LAT)) return 0;
+	}
+	return ((unsigned int)n_cols);
+}
+
+/*! . */
+GMT_LOCAL int gmtio_scan_plain_record (struct GMT_CTRL *GMT, char *line, uint64_t n_use) {
+	/* Bulk decoder for simple numeric records: scan all fields in a single pass over
+	 * the record buffer with no tokenizing copies and no per-field format dispatch.
+	 * Geographic columns accept plain decimal degrees only (with the usual longitude
+	 * periodicity adjustment); anything fancier in any field makes us return -1 so
+	 * the caller falls back on the regular token loop for this record.  On success
+	 * we return the number of columns decoded into GMT->current.io.curr_rec. */
+	char *p = line, *endp = NULL;
+	uint64_t col = 0;
+	unsigned int type;
+	double val;
+	while (col < n_use) {
+		while (*p && strchr (GMT->current.io.scan_separators, *p)) p++;	/* Skip any leading separators */
+		if (*p == '\0' || *p == '\n' || *p == '\r') break;	/* Reached end of record */
+		if (!(isdigit ((unsigned char)*p) || *p == '+' || *p == '-' || *p == '.')) return (-1);	/* Not a plain number (could be NaN, time, unit, text) */
+		val = strtod (p, &endp);
+		if (endp == p) return (-1);	/* Failed to decode a number */
+		if (*endp && *endp != '\n' && *endp != '\r' && strchr (GMT->current.io.scan_separators, *endp) == NULL) return (-1);	/* Trailing junk in field (e.g., 12:30:00 or 30W) */
+		if (gmt_input_col_is_nan_proxy (GMT, val, (unsigned int)col)) return (-1);	/* Let the regular path do the NaN bookkeeping */
+		type = gmt_M_type (GMT, GMT_IN, col);
+		if (type == GMT_IS_LAT && fabs (val) > 90.0) return (-1);	/* Let the regular path issue the range complaint */
+		GMT->current.io.curr_rec[col] = gmt_M_convert_col (GMT->current.io.col[GMT_IN][col], val);
+		if (col == GMT_X && (type & GMT_IS_LON))	/* Must account for periodicity in 360 as per current rule */
+			gmtio_adjust_periodic_lon (GMT, &GMT->current.io.curr_rec[col]);
+		col++;	p = endp;
+	}
+	while (*p && (*p == '\n' || *p == '\r' || strchr (GMT->current.io.scan_separators, *p))) p++;	/* Wind past trailing separators */
+	if (*p) return (-1);	/* Leftover characters means trailing text we did not expect */
+	return ((int)col);
+}
+
 GMT_LOCAL void *gmtio_ascii_input (struct GMT_CTRL *GMT, FILE *fp, uint64_t *n, int *status) {
 	unsigned int decode_type, decode_type2;
 	uint64_t pos, col_no = 0, col_pos, n_convert, n_ok = 0, kind, add, n_use = 0;
 	uint64_t n_cols_this_record = GMT_MAX_COLUMNS;
 	int64_t in_col;
 	size_t start_of_text;
-	bool done = false, bad_record, set_nan_flag = false, add_aspatial_to_expected = false;
+	bool done = false, bad_record, set_nan_flag = false, add_aspatial_to_expected = false, fast_record = false;
 	char line[GMT_BUFSIZ] = {""}, *p = NULL, *token = NULL, *stringp = NULL;
 	double val;
 	static char * (*strscan) (char **, const char *, size_t *);	/* Pointer to strsepz or strsepzp */
@@ -3833,6 +3939,7 @@ GMT_LOCAL void *gmtio_ascii_input (struct GMT_CTRL *GMT, FILE *fp, uint64_t *n,
 					strscan = (GMT->current.io.record_type[GMT_IN] & GMT_READ_TEXT) ? &strsepzp : &strsepz;	/* Need zp scanner to detect trailing text */
 					add_aspatial_to_expected = true;	/* Since counts does not include any aspatial additions */
 				}
+				GMT->current.io.fast_float_scan = gmtio_fast_scan_cols (GMT, *n);	/* See if records can use the bulk record scanner */
 			}
 		}
 
@@ -3847,8 +3954,17 @@ GMT_LOCAL void *gmtio_ascii_input (struct GMT_CTRL *GMT, FILE *fp, uint64_t *n,
 		start_of_text = 0;			/* Position in current string record */
 		GMT->current.io.curr_trailing_text[0] = '\0';	/* Start with nuthin. */
 
+		fast_record = false;
+		if (GMT->current.io.fast_float_scan && n_use <= GMT->current.io.fast_float_scan) {	/* Try decoding the whole record in one tight pass */
+			int n_fast = gmtio_scan_plain_record (GMT, line, n_use);
+			if (n_fast >= 0) {	/* Success; skip the token loop below [a negative return means this record needs the full machinery] */
+				col_no = n_ok = (uint64_t)n_fast;
+				fast_record = true;
+			}
+		}
+
 		stringp = line;
-		while (!bad_record && col_no < n_use && (token = strscan (&stringp, GMT->current.io.scan_separators, &start_of_text)) != NULL) {	/* Get one field at the time until we run out or have issues */
+		while (!fast_record && !bad_record && col_no < n_use && (token = strscan (&stringp, GMT->current.io.scan_separators, &start_of_text)) != NULL) {	/* Get one field at the time until we run out or have issues */
 			++in_col;	/* This is the actual column number in the input file */
 			if (GMT->common.i.col.select) {	/* Must do special column-based processing since the -i option was set */
 				if (GMT->current.io.col_skip[in_col]) continue;		/* Just skip and not even count this column */
@@ -3963,6 +4079,213 @@ void gmt_set_column_types (struct GMT_CTRL *GMT, unsigned int n_cols_start, bool
 }
 
 /*! . */
+/* Native columnar table format.  The layout is, in order:
+ *   char magic[8]			"GMTCOL01"
+ *   uint64_t n_segments, n_columns, n_records
+ *   uint64_t rows[n_segments]		Number of rows per segment; they sum to n_records
+ *   double data[n_columns][n_records]	One contiguous array per column, all segments in order
+ * All items are in native byte order and every column starts on an 8-byte boundary, so a
+ * read-only memory map of the file can serve directly as the column arrays of a GMT_DATATABLE:
+ * segment s points into each column at its cumulative record offset and nothing is decoded or
+ * copied.  Modules that walk whole columns (gmtmath, trend1d, fitcircle, ...) then get purely
+ * sequential access.  Trailing text, segment headers, and OGR information have no representation
+ * in this format.  Reading is triggered by the magic; writing by the .gmtcol file extension. */
+
+#define GMT_COLUMNAR_MAGIC	"GMTCOL01"
+#define GMT_COLUMNAR_MAGIC_LEN	8U
+#define GMT_COLUMNAR_EXT	".gmtcol"
+#define GMT_COLUMNAR_HDR_SIZE	(GMT_COLUMNAR_MAGIC_LEN + 3U * sizeof (uint64_t))
+
+/*! Return true (and the full path) if file exists locally and starts with the columnar table magic */
+GMT_LOCAL bool gmtio_is_columnar (struct GMT_CTRL *GMT, const char *file, char *path) {
+	bool columnar;
+	char magic[GMT_COLUMNAR_MAGIC_LEN];
+	FILE *fp = NULL;
+	if (gmt_getdatapath (GMT, file, path, R_OK) == NULL) return (false);	/* Not a plain local file */
+	if ((fp = fopen (path, "rb")) == NULL) return (false);
+	columnar = (fread (magic, 1U, GMT_COLUMNAR_MAGIC_LEN, fp) == GMT_COLUMNAR_MAGIC_LEN && !memcmp (magic, GMT_COLUMNAR_MAGIC, GMT_COLUMNAR_MAGIC_LEN));
+	fclose (fp);
+	return (columnar);
+}
+
+/*! Read a native columnar table file into a table whose column vectors point into the file image */
+GMT_LOCAL struct GMT_DATATABLE * gmtio_read_columnar (struct GMT_CTRL *GMT, char *path, unsigned int *geometry, unsigned int *data_type) {
+	/* Where mmap is available the columns are served straight from the page cache with no copy;
+	 * otherwise (Windows, pipes-free fallback) we read the entire file image into memory once. */
+	bool mapped = false;
+	uint64_t dim[3], n_segments, n_columns, n_records, seg, col, offset;
+	uint64_t *rows = NULL;
+	size_t n_bytes = 0;
+	long len;
+	char *base = NULL;
+	double *data = NULL;
+	FILE *fp = NULL;
+	struct GMT_DATATABLE *T = NULL;
+	struct GMT_DATATABLE_HIDDEN *TH = NULL;
+	struct GMT_DATASEGMENT *S = NULL;
+	struct GMT_DATASEGMENT_HIDDEN *SH = NULL;
+
+	if ((fp = fopen (path, "rb")) == NULL) {
+		GMT_Report (GMT->parent, GMT_MSG_ERROR, "Cannot open file %s\n", path);
+		return (NULL);
+	}
+	if (fseek (fp, 0L, SEEK_END) || (len = ftell (fp)) < (long)GMT_COLUMNAR_HDR_SIZE) {
+		GMT_Report (GMT->parent, GMT_MSG_ERROR, "Columnar table file %s is truncated\n", path);
+		fclose (fp);
+		return (NULL);
+	}
+	n_bytes = (size_t)len;
+	if (fseek (fp, (long)GMT_COLUMNAR_MAGIC_LEN, SEEK_SET) || fread (dim, sizeof (uint64_t), 3U, fp) != 3U) {
+		GMT_Report (GMT->parent, GMT_MSG_ERROR, "Failure while reading header of columnar table file %s\n", path);
+		fclose (fp);
+		return (NULL);
+	}
+	n_segments = dim[0];	n_columns = dim[1];	n_records = dim[2];
+	if (n_segments == 0 || n_columns == 0 || n_records < n_segments ||
+	    (uint64_t)n_bytes < GMT_COLUMNAR_HDR_SIZE + n_segments * sizeof (uint64_t) + n_columns * n_records * sizeof (double)) {
+		GMT_Report (GMT->parent, GMT_MSG_ERROR, "Columnar table file %s has inconsistent dimensions\n", path);
+		fclose (fp);
+		return (NULL);
+	}
+#ifndef _WIN32
+	if ((base = mmap (NULL, n_bytes, PROT_READ, MAP_PRIVATE, fileno (fp), 0)) == MAP_FAILED)
+		base = NULL;	/* Quietly fall back on reading the file image */
+	else
+		mapped = true;
+#endif
+	if (base == NULL) {	/* No mmap; read the entire file image into memory once instead */
+		rewind (fp);
+		if ((base = gmt_M_memory (GMT, NULL, n_bytes, char)) == NULL || fread (base, 1U, n_bytes, fp) != n_bytes) {
+			GMT_Report (GMT->parent, GMT_MSG_ERROR, "Failure while reading columnar table file %s\n", path);
+			gmt_M_free (GMT, base);
+			fclose (fp);
+			return (NULL);
+		}
+	}
+	fclose (fp);	/* A memory map remains valid after the stream is closed */
+
+	rows = (uint64_t *)(base + GMT_COLUMNAR_HDR_SIZE);
+	data = (double *)(base + GMT_COLUMNAR_HDR_SIZE + n_segments * sizeof (uint64_t));
+	for (seg = offset = 0; seg < n_segments; seg++) offset += rows[seg];	/* Verify the segment index */
+	if (offset != n_records) {
+		GMT_Report (GMT->parent, GMT_MSG_ERROR, "Segment rows in columnar table file %s do not sum to its record count\n", path);
+#ifndef _WIN32
+		if (mapped) munmap (base, n_bytes); else
+#endif
+		gmt_M_free (GMT, base);
+		return (NULL);
+	}
+
+	T = gmt_create_table (GMT, n_segments, 0U, n_columns, 0U, false);
+	TH = gmt_get_DT_hidden (T);
+	TH->file[GMT_IN] = strdup (path);
+	TH->map = base;			/* So gmt_free_table can release the file image with the table */
+	TH->map_size = (mapped) ? n_bytes : 0;	/* Zero signals allocated memory rather than a memory map */
+	for (seg = offset = 0; seg < n_segments; seg++) {
+		S = T->segment[seg];
+		SH = gmt_get_DS_hidden (S);
+		S->n_rows = rows[seg];
+		for (col = 0; col < n_columns; col++) {
+			S->data[col] = data + col * n_records + offset;
+			SH->alloc_mode[col] = GMT_ALLOC_EXTERNALLY;	/* The arrays belong to the file image */
+		}
+		offset += rows[seg];
+	}
+	gmt_set_tbl_minmax (GMT, *geometry, T);	/* Also sets T->n_records */
+	*data_type = GMT_READ_DATA;
+	GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "Read %" PRIu64 " records from columnar table file %s via %s\n", n_records, path, (mapped) ? "mmap" : "read");
+	return (T);
+}
+
+/*! Write a table to a native columnar table file (see layout above) */
+GMT_LOCAL int gmtio_write_columnar (struct GMT_CTRL *GMT, char *file, struct GMT_DATATABLE *table) {
+	bool has_text = false;
+	uint64_t dim[3], seg, col;
+	FILE *fp = NULL;
+	struct GMT_DATASEGMENT *S = NULL;
+
+	if (table->n_columns == 0) {
+		GMT_Report (GMT->parent, GMT_MSG_ERROR, "Cannot write a table without data columns to columnar table file %s\n", file);
+		return (GMT_RUNTIME_ERROR);
+	}
+	if ((fp = fopen (file, "wb")) == NULL) {
+		GMT_Report (GMT->parent, GMT_MSG_ERROR, "Cannot create file %s\n", file);
+		return (GMT_ERROR_ON_FOPEN);
+	}
+	dim[0] = table->n_segments;	dim[1] = table->n_columns;
+	for (seg = dim[2] = 0; seg < table->n_segments; seg++) dim[2] += table->segment[seg]->n_rows;
+	if (fwrite (GMT_COLUMNAR_MAGIC, 1U, GMT_COLUMNAR_MAGIC_LEN, fp) != GMT_COLUMNAR_MAGIC_LEN || fwrite (dim, sizeof (uint64_t), 3U, fp) != 3U) {
+		fclose (fp);
+		return (GMT_DATA_WRITE_ERROR);
+	}
+	for (seg = 0; seg < table->n_segments; seg++) {	/* The segment index */
+		if (fwrite (&table->segment[seg]->n_rows, sizeof (uint64_t), 1U, fp) != 1U) {
+			fclose (fp);
+			return (GMT_DATA_WRITE_ERROR);
+		}
+	}
+	for (col = 0; col < table->n_columns; col++) {	/* One contiguous array per column */
+		for (seg = 0; seg < table->n_segments; seg++) {
+			S = table->segment[seg];
+			if (S->text) has_text = true;
+			if (S->n_rows && fwrite (S->data[col], sizeof (double), S->n_rows, fp) != S->n_rows) {
+				fclose (fp);
+				return (GMT_DATA_WRITE_ERROR);
+			}
+		}
+	}
+	fclose (fp);
+	if (has_text)
+		GMT_Report (GMT->parent, GMT_MSG_WARNING, "Trailing text cannot be stored in columnar table file %s and was skipped\n", file);
+	GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "Wrote %" PRIu64 " records to columnar table file %s\n", dim[2], file);
+	return (GMT_NOERROR);
+}
+
+#if defined (HAVE_OPEN_MEMSTREAM) && defined (HAVE_GLIB_GTHREAD)
+#define GMTIO_SEGMENT_FANOUT		/* Can overlap per-segment file writing with formatting of the next segment */
+#define GMTIO_FANOUT_BATCH	64	/* Segments buffered in memory before we drain the pool */
+
+struct GMTIO_SEGMENT_JOB {	/* One formatted segment waiting for a pool worker to write its file */
+	char file[PATH_MAX];	/* The destination file */
+	char mode[4];		/* The fopen mode */
+	char *buffer;		/* The formatted bytes from open_memstream */
+	size_t size;		/* Number of bytes to write */
+	int status;		/* GMT_NOERROR or the error code set by the worker */
+};
+
+GMT_LOCAL void gmtio_segment_write_worker (void *arg) {
+	/* Runs on a pool thread: write one formatted segment to its own file.  We use plain
+	 * fopen/free off the main thread since gmt_fopen and gmt_M_free are not thread-safe;
+	 * the names are local files built from the segment-number template so no data-path
+	 * searching is lost. */
+	struct GMTIO_SEGMENT_JOB *job = arg;
+	FILE *fp = fopen (job->file, job->mode);
+	if (fp == NULL)
+		job->status = GMT_ERROR_ON_FOPEN;
+	else {
+		if (job->size && fwrite (job->buffer, 1U, job->size, fp) != job->size)
+			job->status = GMT_DATA_WRITE_ERROR;
+		fclose (fp);
+	}
+	free (job->buffer);	/* Allocated by open_memstream, hence plain free */
+	job->buffer = NULL;
+}
+
+GMT_LOCAL int gmtio_fanout_drain (struct GMT_CTRL *GMT, struct GMTIO_SEGMENT_JOB *jobs, unsigned int *n_jobs) {
+	/* Wait for all outstanding segment writers and report the first failure, if any */
+	unsigned int j;
+	int error = GMT_NOERROR;
+	gmt_thread_pool_wait (GMT);
+	for (j = 0; j < *n_jobs; j++) {
+		if (jobs[j].status == GMT_NOERROR) continue;
+		GMT_Report (GMT->parent, GMT_MSG_ERROR, "Cannot write file %s\n", jobs[j].file);
+		if (error == GMT_NOERROR) error = jobs[j].status;
+	}
+	*n_jobs = 0;
+	return (error);
+}
+#endif
+
 GMT_LOCAL int gmtio_write_table (struct GMT_CTRL *GMT, void *dest, unsigned int dest_type, struct GMT_DATATABLE *table, bool use_GMT_io, unsigned int io_mode, unsigned int n_seg) {
 	/* Writes an entire segment data set to file or wherever.
 	 * Specify io_mode == GMT_WRITE_SEGMENT or GMT_WRITE_TABLE_SEGMENT to write segments to individual files.
@@ -3980,7 +4303,12 @@ GMT_LOCAL int gmtio_write_table (struct GMT_CTRL *GMT, void *dest, unsigned int
 	struct GMT_DATASEGMENT_HIDDEN *SH = NULL;
 	struct GMT_DATATABLE_HIDDEN *TH = gmt_get_DT_hidden (table);
 	int (*psave) (struct GMT_CTRL *, FILE *, uint64_t, double *, char *) = NULL;	/* Pointer to function writing tables */
-
+#ifdef GMTIO_SEGMENT_FANOUT
+	bool use_pool = false;
+	unsigned int n_jobs = 0;
+	int pool_error = GMT_NOERROR;
+	struct GMTIO_SEGMENT_JOB *job = NULL, *jobs = NULL;
+#endif
 
 	if (TH->mode == GMT_WRITE_SKIP) return (0);	/* Skip this table */
 
@@ -4005,6 +4333,15 @@ GMT_LOCAL int gmtio_write_table (struct GMT_CTRL *GMT, void *dest, unsigned int
 			}
 			strncpy (file, dest, PATH_MAX-1);
 			if (io_mode < GMT_WRITE_SEGMENT) {	/* Only require one destination */
+				size_t flen = strlen (&file[append]);
+				if (flen > strlen (GMT_COLUMNAR_EXT) && !strcmp (&file[append+flen-strlen(GMT_COLUMNAR_EXT)], GMT_COLUMNAR_EXT)) {
+					/* Native columnar table output selected via the file extension */
+					if (append) {
+						GMT_Report (GMT->parent, GMT_MSG_ERROR, "Cannot append to columnar table file %s\n", &file[append]);
+						return GMT_RUNTIME_ERROR;
+					}
+					return (gmtio_write_columnar (GMT, file, table));
+				}
 				if ((fp = gmt_fopen (GMT, &file[append], open_mode)) == NULL) {
 					GMT_Report (GMT->parent, GMT_MSG_ERROR, "Cannot open file %s\n", &file[append]);
 					return GMT_ERROR_ON_FOPEN;
@@ -4074,8 +4411,24 @@ GMT_LOCAL int gmtio_write_table (struct GMT_CTRL *GMT, void *dest, unsigned int
 				snprintf (tmpfile, PATH_MAX, file, SH->id);
 
 			if (close_file) gmt_fclose (GMT, fp);	/* Close the file since we opened it */
+#ifdef GMTIO_SEGMENT_FANOUT
+			use_pool = (io_mode == GMT_WRITE_SEGMENT && dest_type == GMT_IS_FILE && SH->file[GMT_OUT] == NULL);	/* Template names are unique so distinct files can be written concurrently */
+			if (use_pool) {	/* Format into memory; a pool worker opens, writes, and closes the actual file */
+				if (jobs == NULL) jobs = gmt_M_memory (GMT, NULL, GMTIO_FANOUT_BATCH, struct GMTIO_SEGMENT_JOB);
+				job = &jobs[n_jobs];
+				strncpy (job->file, out_file, PATH_MAX-1);
+				strncpy (job->mode, open_mode, 3U);
+				job->status = GMT_NOERROR;
+				if ((fp = open_memstream (&job->buffer, &job->size)) == NULL)
+					use_pool = false;	/* Fall back on writing the file right here */
+			}
+			if (!use_pool)
+#endif
 			if ((fp = gmt_fopen (GMT, out_file, open_mode)) == NULL) {
 				gmt_M_free (GMT, out);
+#ifdef GMTIO_SEGMENT_FANOUT
+				if (jobs) { gmt_thread_pool_wait (GMT); gmt_M_free (GMT, jobs); }
+#endif
 				GMT_Report (GMT->parent, GMT_MSG_ERROR, "Cannot open file %s\n", out_file);
 				return GMT_ERROR_ON_FOPEN;
 			}
@@ -4095,7 +4448,19 @@ GMT_LOCAL int gmtio_write_table (struct GMT_CTRL *GMT, void *dest, unsigned int
 			gmt_write_segmentheader (GMT, fp, S->n_columns);
 			if (SH->ogr && GMT->common.a.output) gmtio_write_ogr_segheader (GMT, fp, S);
 		}
-		if (SH->mode == GMT_WRITE_HEADER) continue;	/* Skip after writing segment header */
+		if (SH->mode == GMT_WRITE_HEADER) {	/* Skip after writing segment header */
+#ifdef GMTIO_SEGMENT_FANOUT
+			if (use_pool) {	/* Must still hand the header-only buffer to a worker */
+				fclose (fp);
+				gmt_thread_pool_submit (GMT, gmtio_segment_write_worker, job);
+				if (++n_jobs == GMTIO_FANOUT_BATCH) {
+					int err = gmtio_fanout_drain (GMT, jobs, &n_jobs);
+					if (err != GMT_NOERROR && pool_error == GMT_NOERROR) pool_error = err;
+				}
+			}
+#endif
+			continue;
+		}
 		if (SH->range && SH->range != GMT->current.io.geo.range) {	/* Segment-specific formatting for longitudes */
 			GMT_Report (GMT->parent, GMT_MSG_DEBUG, "File %s Segment %d changed io.geo.range from %d to %d\n",
 						out_file, (int)seg, GMT->current.io.geo.range, SH->range);
@@ -4107,6 +4472,17 @@ GMT_LOCAL int gmtio_write_table (struct GMT_CTRL *GMT, void *dest, unsigned int
 			GMT->current.io.output (GMT, fp, S->n_columns, out, txt);
 		}
 		if (SH->range) GMT->current.io.geo.range = save; 	/* Restore formatting */
+#ifdef GMTIO_SEGMENT_FANOUT
+		if (use_pool) {	/* Finalize the memory buffer and hand it to a pool worker */
+			fclose (fp);	/* Plain fclose since this is the memory stream, not a registered file */
+			gmt_thread_pool_submit (GMT, gmtio_segment_write_worker, job);
+			if (++n_jobs == GMTIO_FANOUT_BATCH) {	/* Drain the pool so buffered memory stays bounded */
+				int err = gmtio_fanout_drain (GMT, jobs, &n_jobs);
+				if (err != GMT_NOERROR && pool_error == GMT_NOERROR) pool_error = err;
+			}
+		}
+		else
+#endif
 		if (io_mode == GMT_WRITE_SEGMENT) gmt_fclose (GMT, fp);	/* Close the segment file */
 		if (ASCII && S->text)
 			GMT->current.io.output = psave;	/* Override and use ASCII mode */
@@ -4117,6 +4493,14 @@ GMT_LOCAL int gmtio_write_table (struct GMT_CTRL *GMT, void *dest, unsigned int
 	if (!use_GMT_io) GMT->current.io.output = psave;	/* Restore former pointers and values */
 	GMT->current.io.multi_segments[GMT_OUT] = was;
 
+#ifdef GMTIO_SEGMENT_FANOUT
+	if (jobs) {	/* Wait for the last batch of segment writers and surface any failure */
+		int err = gmtio_fanout_drain (GMT, jobs, &n_jobs);
+		if (err != GMT_NOERROR && pool_error == GMT_NOERROR) pool_error = err;
+		gmt_M_free (GMT, jobs);
+	}
+	if (pool_error) return (pool_error);
+#endif
 	return (0);	/* OK status */
 }
 
@@ -5184,6 +5568,27 @@ int gmtlib_write_dataset (struct GMT_CTRL *GMT, void *dest, unsigned int dest_ty
 	return (0);	/* OK status */
 }
 
+#define GMTIO_READ_BUFFER_SIZE 1048576	/* 1 MiB stdio buffer for sequential table reading */
+
+/*! Open a table file for sequential reading with a large stdio buffer and kernel readahead hints */
+GMT_LOCAL FILE *gmtio_fopen_sequential (struct GMT_CTRL *GMT, const char *path, const char *mode) {
+	/* The record parsers read tables strictly front to back, so we (a) enlarge the stdio buffer
+	 * well beyond the default block size and (b) tell the kernel about the access pattern.  With
+	 * the SEQUENTIAL|WILLNEED hints the kernel widens its readahead window and keeps fetching the
+	 * next stretch of the file while we parse the current buffer, which is what keeps cold reads
+	 * from slow (e.g., network-mounted) files streaming at link speed.  Both steps are best-effort
+	 * and must happen before the first read from the stream. */
+	FILE *fd = fopen (path, mode);
+	if (fd == NULL) return (NULL);
+	if (setvbuf (fd, NULL, _IOFBF, GMTIO_READ_BUFFER_SIZE))
+		GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Unable to enlarge the input buffer for %s\n", path);
+#if defined (HAVE_FCNTL_H_) && defined (POSIX_FADV_SEQUENTIAL)
+	posix_fadvise (fileno (fd), 0, 0, POSIX_FADV_SEQUENTIAL);
+	posix_fadvise (fileno (fd), 0, 0, POSIX_FADV_WILLNEED);
+#endif
+	return (fd);
+}
+
 /*! . */
 FILE * gmt_fopen (struct GMT_CTRL *GMT, const char *filename, const char *mode) {
 	char path[PATH_MAX], *c = NULL;
@@ -5197,7 +5602,7 @@ FILE * gmt_fopen (struct GMT_CTRL *GMT, const char *filename, const char *mode)
 		return (fopen (&filename[first], mode));
 	else if (GMT->common.b.active[GMT_IN]) {	/* Definitely not netCDF */
 		if ((c = gmt_getdatapath (GMT, &filename[first], path, R_OK)) == NULL) return NULL;
-		return (fopen (c, mode));
+		return (gmtio_fopen_sequential (GMT, c, mode));
 	}
 	else if (gmt_M_compat_check (GMT, 4) && GMT->common.b.varnames[0])	/* Definitely netCDF */
 		return (gmtio_nc_fopen (GMT, &filename[first], mode));
@@ -5239,7 +5644,7 @@ FILE * gmt_fopen (struct GMT_CTRL *GMT, const char *filename, const char *mode)
 					sprintf (GMT->current.io.filename[GMT_IN], "%s <converted from %s via ogr2ogr>", GMT->current.io.tempfile, c);
 					c = GMT->current.io.tempfile;	/* Open this temporary instead */
 				}
-				fd = fopen (c, mode);
+				fd = gmtio_fopen_sequential (GMT, c, mode);
 			}
 		}
 		return (fd);
@@ -7964,7 +8369,7 @@ int gmt_alloc_segment (struct GMT_CTRL *GMT, struct GMT_DATASEGMENT *S, uint64_t
 	/* (re)allocates memory for a segment of given dimensions.
 	 * If first is true then the segment arrays for data/text are allocated and min/max arrays set
 	 */
-	uint64_t col;
+	uint64_t col, n_prev_rows;
 	struct GMT_DATASEGMENT_HIDDEN *SH = gmt_get_DS_hidden (S);
 	if (first && n_columns) {	/* First time we allocate the number of columns needed */
 		S->data = gmt_M_memory (GMT, S->data, n_columns, double *);
@@ -7981,10 +8386,34 @@ int gmt_alloc_segment (struct GMT_CTRL *GMT, struct GMT_DATASEGMENT *S, uint64_t
 		GMT_Report (GMT->parent, GMT_MSG_ERROR, "gmt_alloc_segment: Cannot reallocate the number of columns in an existing segment");
 		return 1;
 	}
+	n_prev_rows = (SH->n_alloc) ? SH->n_alloc : S->n_rows;	/* In case we must copy from an array we cannot reallocate */
 	S->n_rows  = n_rows;
 	if (n_rows) {	/* Allocate or reallocate column arrays */
-		for (col = 0; col < n_columns; col++) {
-			if ((S->data[col] = gmt_M_memory (GMT, S->data[col], n_rows, double)) == NULL) {
+		double *block = NULL;
+		if (SH->arena && GMT->hidden.mem_arena && n_columns && S->data) {
+			/* Segment fed from the dataset arena: draw all the columns as a single contiguous block and
+			 * slice it into the column pointers.  Each column remains contiguous (so column-wise access
+			 * is unchanged) but the entire segment now occupies one linear stretch of memory, which is
+			 * what row-streaming modules want.  The arena owns the block and frees it with the dataset. */
+			for (col = 0; col < n_columns && S->data[col] == NULL; col++);	/* All must be unassigned (first allocation) */
+			if (col == n_columns && (block = gmtlib_mem_arena_alloc (GMT, GMT->hidden.mem_arena, n_columns * n_rows * sizeof (double)))) {
+				for (col = 0; col < n_columns; col++) {
+					S->data[col] = &block[col*n_rows];
+					SH->alloc_mode[col] = GMT_ALLOC_EXTERNALLY;
+				}
+			}
+		}
+		for (col = 0; block == NULL && col < n_columns; col++) {
+			if (S->data[col] && SH->alloc_mode[col] == GMT_ALLOC_EXTERNALLY) {	/* Growing an array we do not own (e.g., arena memory): allocate a fresh array and copy */
+				double *data = gmt_M_memory (GMT, NULL, n_rows, double);
+				if (data == NULL) {
+					GMT_Report (GMT->parent, GMT_MSG_ERROR, "gmt_alloc_segment: Unable to reallocate data column %" PRIu64 " to new length %" PRIu64 "\n", col, n_rows);
+					return 1;
+				}
+				gmt_M_memcpy (data, S->data[col], MIN (n_prev_rows, n_rows), double);
+				S->data[col] = data;
+			}
+			else if ((S->data[col] = gmt_M_memory (GMT, S->data[col], n_rows, double)) == NULL) {
 				GMT_Report (GMT->parent, GMT_MSG_ERROR, "gmt_alloc_segment: Unable to reallocate data column %" PRIu64 " to new length %" PRIu64 "\n", col, n_rows);
 				return 1;
 			}
@@ -8101,8 +8530,18 @@ struct GMT_DATASEGMENT * gmt_get_segment (struct GMT_CTRL *GMT, uint64_t n_colum
 	uint64_t col;
 	struct GMT_DATASEGMENT *S = NULL;
 	struct GMT_DATASEGMENT_HIDDEN *SH = NULL;
-	S = gmt_M_memory (GMT, NULL, 1, struct GMT_DATASEGMENT);
-	S->hidden = SH = gmt_M_memory (GMT, NULL, 1, struct GMT_DATASEGMENT_HIDDEN);
+	if (GMT->hidden.mem_arena) {	/* Building a large dataset: try to draw the structs from its arena */
+		S  = gmtlib_mem_arena_alloc (GMT, GMT->hidden.mem_arena, sizeof (struct GMT_DATASEGMENT));
+		SH = gmtlib_mem_arena_alloc (GMT, GMT->hidden.mem_arena, sizeof (struct GMT_DATASEGMENT_HIDDEN));
+	}
+	if (S && SH) {	/* Got arena memory for both structs */
+		S->hidden = SH;
+		SH->arena = true;	/* So gmt_free_segment knows to leave these structs for the arena to free in one shot */
+	}
+	else {	/* Regular allocation of each struct */
+		S = gmt_M_memory (GMT, NULL, 1, struct GMT_DATASEGMENT);
+		S->hidden = SH = gmt_M_memory (GMT, NULL, 1, struct GMT_DATASEGMENT_HIDDEN);
+	}
 	if (n_columns)
 		SH->alloc_mode = gmt_M_memory (GMT, NULL, n_columns, enum GMT_enum_alloc);
 	for (col = 0; col < n_columns; col++)
@@ -8167,9 +8606,19 @@ struct GMT_DATASET * gmtlib_create_dataset (struct GMT_CTRL *GMT, uint64_t n_tab
 	DH->n_alloc = D->n_tables = n_tables;
 	if (!alloc_only) D->n_segments = D->n_tables * n_segments;
 	if (!alloc_only) D->n_records = D->n_segments * n_rows;
+	if (n_tables && n_segments && n_rows && n_columns && n_tables * n_segments >= GMT_ARENA_MIN_SEGMENTS) {
+		/* Large dataset of known dimensions: feed all the segments from a single bump arena owned by
+		 * the dataset (and freed in one shot with it) instead of several small allocations per segment */
+		DH->arena = gmtlib_mem_arena_create (GMT, n_tables * n_segments * (sizeof (struct GMT_DATASEGMENT) +
+			sizeof (struct GMT_DATASEGMENT_HIDDEN) + n_columns * n_rows * sizeof (double)));
+		GMT->hidden.mem_arena = DH->arena;	/* Seen by gmt_get_segment and gmt_alloc_segment during construction */
+	}
 	for (tbl = 0; tbl < n_tables; tbl++)
-		if ((D->table[tbl] = gmt_create_table (GMT, n_segments, n_rows, n_columns, mode, alloc_only)) == NULL)
+		if ((D->table[tbl] = gmt_create_table (GMT, n_segments, n_rows, n_columns, mode, alloc_only)) == NULL) {
+			GMT->hidden.mem_arena = NULL;
 			return (NULL);
+		}
+	GMT->hidden.mem_arena = NULL;	/* Back to regular allocations */
 	DH->id = GMT->parent->unique_var_ID++;		/* Give unique identifier */
 
 	return (D);
@@ -8185,7 +8634,7 @@ struct GMT_DATATABLE *gmtlib_read_table(struct GMT_CTRL *GMT, void *source, unsi
 	uint64_t n_expected_fields, n_returned = 0;
 	uint64_t n_read = 0, row = 0, seg = 0, col, n_poly_seg = 0, k;
 	size_t n_head_alloc = GMT_TINY_CHUNK;
-	char open_mode[4] = {""}, file[PATH_MAX] = {""}, line[GMT_LEN64] = {""};
+	char open_mode[4] = {""}, file[PATH_MAX] = {""}, path[PATH_MAX] = {""}, line[GMT_LEN64] = {""};
 	double d;
 	struct GMT_RECORD *In = NULL;
 	FILE *fp = NULL;
@@ -8227,6 +8676,10 @@ struct GMT_DATATABLE *gmtlib_read_table(struct GMT_CTRL *GMT, void *source, unsi
 
 	if (source_type == GMT_IS_FILE) {	/* source is a file name */
 		strncpy (file, source, PATH_MAX-1);
+		if (gmtio_is_columnar (GMT, file, path)) {	/* A native columnar table file: map the columns directly and skip the record machinery */
+			if (psave) GMT->current.io.input = psave;	/* Restore previous setting */
+			return (gmtio_read_columnar (GMT, path, geometry, data_type));
+		}
 		if ((fp = gmt_fopen (GMT, file, open_mode)) == NULL) {
 			GMT_Report (GMT->parent, GMT_MSG_ERROR, "Cannot open file %s\n", file);
 			if (!use_GMT_io) GMT->current.io.input = psave;	/* Restore previous setting */
@@ -8915,8 +9368,10 @@ void gmt_free_segment (struct GMT_CTRL *GMT, struct GMT_DATASEGMENT **S) {
 	if (SH->ogr) gmtio_free_ogr_seg (GMT, segment);	/* OGR metadata */
 	gmtio_free_segment_text (GMT, segment, SH);
 	gmt_M_free (GMT, SH->alloc_mode);
-	gmt_M_free (GMT, segment->hidden);
-	gmt_M_free (GMT, segment);
+	if (!SH->arena) {	/* Arena-backed structs are freed in one shot with their dataset instead */
+		gmt_M_free (GMT, segment->hidden);
+		gmt_M_free (GMT, segment);
+	}
 	*S = NULL;
 }
 
@@ -8940,6 +9395,14 @@ void gmt_free_table (struct GMT_CTRL *GMT, struct GMT_DATATABLE *table) {
 		for (seg = 0; seg < table->n_segments; seg++) gmt_free_segment (GMT, &(table->segment[seg]));
 		gmt_M_free (GMT, table->segment);
 	}
+	if (TH->map) {	/* The column arrays pointed into this columnar table file image */
+#ifndef _WIN32
+		if (TH->map_size)
+			munmap (TH->map, TH->map_size);
+		else
+#endif
+		gmt_M_free (GMT, TH->map);
+	}
 	gmt_M_free (GMT, table->hidden);
 	gmt_M_free (GMT, table);
 }
@@ -8954,6 +9417,7 @@ void gmtlib_free_dataset_misc (struct GMT_CTRL *GMT, struct GMT_DATASET *data) {
 	gmt_M_free (GMT, data->max);
 	gmt_M_free (GMT, data->table);
 	for (k = 0; k < 2; k++) gmt_M_str_free (DH->file[k]);
+	if (DH->arena) gmtlib_mem_arena_free (GMT, &DH->arena);	/* Release all the segment memory in one shot */
 	gmt_M_free (GMT, data->hidden);
 }
 
@@ -251,6 +251,7 @@ struct GMT_IO {				/* Used to process input data records */
 	bool give_report;		/* true if functions should report how many bad records were skipped */
 	bool skip_duplicates;	/* true if we should ignore duplicate x,y records */
 	bool variable_in_columns;	/* true if we are reading ASCII records with variable numbers of columns */
+	unsigned int fast_float_scan;	/* If > 0, the first fast_float_scan input columns are plain floats or decimal-degree lon/lat and records may bypass per-field gmt_scanf [0] */
 	bool need_previous;		/* true if when parsing a record we need access to previous record values (e.g., for gap or duplicate checking) */
 	bool has_previous_rec;		/* true if we have the previous record for this segment */
 	bool warn_geo_as_cartesion;	/* true if we should warn if we read a record with geographic data while the expected format has not been set (i.e., no -J or -fg) */
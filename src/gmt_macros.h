@@ -232,4 +232,15 @@
 /*! Set the correct column mode (trailing vs no trailing text) based on the given string is NULL or not */
 #define gmt_M_colmode(text) ((text == NULL) ? GMT_COL_FIX_NO_TEXT : GMT_COL_FIX)
 
+/*! Scoped wall-clock timing of library phases (see GMT_enum_timing in gmt_types.h); both macros
+ * expand to nothing unless GMT_ENABLE_TIMINGS was defined at compile time so there is zero
+ * overhead in regular builds.  Phases may nest with each other but not with themselves. */
+#ifdef GMT_ENABLE_TIMINGS
+#define gmt_M_tic(C,phase) ((C)->hidden.timings.t0[phase] = gmtlib_wall_clock ())
+#define gmt_M_toc(C,phase) ((C)->hidden.timings.accum[phase] += gmtlib_wall_clock () - (C)->hidden.timings.t0[phase], (C)->hidden.timings.count[phase]++)
+#else
+#define gmt_M_tic(C,phase)
+#define gmt_M_toc(C,phase)
+#endif
+
 #endif  /* GMT_MACROS_H */
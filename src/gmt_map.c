@@ -63,6 +63,8 @@
  *	gmt_dist_array
  *	gmt_dist_array_2
  *	gmt_distance
+ *	gmt_distance_from
+ *	gmt_distance_from_prep
  *	gmt_geo_to_xy
  *	gmt_geo_to_xy_line
  *	gmt_geo_to_xy_noshift
@@ -649,8 +651,12 @@ GMT_LOCAL void gmtmap_lat_swap_init (struct GMT_CTRL *GMT) {
  */
 
 /*! . */
-GMT_LOCAL bool gmtmap_wesn_outside (struct GMT_CTRL *GMT, double lon, double lat) {
-	/* Determine if a point (lon,lat) is outside or on the rectangular lon/lat boundaries
+GMT_LOCAL void gmtmap_wesn_status (struct GMT_CTRL *GMT, double lon, double lat, int *x_status, int *y_status) {
+	/* Classify a point (lon,lat) against the rectangular lon/lat boundaries and return the
+	 * x|y status codes via the two pointers instead of setting GMT->current.map.this_x|y_status.
+	 * Since no session state is touched this function is safe to call from parallel loops
+	 * [e.g., the triage pass in gmt_clip_to_map]; gmtmap_wesn_outside wraps it for the
+	 * regular one-point-at-a-time machinery.
 	 * The check GMT->current.map.lon_wrap is include since we need to consider the 360
 	 * degree periodicity of the longitude coordinate.
 	 * When we are making basemaps and may want to ensure that a point is
@@ -669,26 +675,33 @@ GMT_LOCAL bool gmtmap_wesn_outside (struct GMT_CTRL *GMT, double lon, double lat
 
 	/* Note PW: 8-20-2014: Was GMT_CONV4_LIMIT instead of GMT_CONV8_LIMIT.  Trying the latter */
 	if (GMT->current.map.on_border_is_outside && fabs (lon - GMT->common.R.wesn[XLO]) < GMT_CONV8_LIMIT)
-		GMT->current.map.this_x_status = -1;
+		*x_status = -1;
 	else if (GMT->current.map.on_border_is_outside && fabs (lon - GMT->common.R.wesn[XHI]) < GMT_CONV8_LIMIT)
-		GMT->current.map.this_x_status = 1;
+		*x_status = 1;
 	else if (lon < GMT->common.R.wesn[XLO])
-		GMT->current.map.this_x_status = -2;
+		*x_status = -2;
 	else if (lon > GMT->common.R.wesn[XHI])
-		GMT->current.map.this_x_status = 2;
+		*x_status = 2;
 	else
-		GMT->current.map.this_x_status = 0;
+		*x_status = 0;
 
 	if (GMT->current.map.on_border_is_outside && fabs (lat - GMT->common.R.wesn[YLO]) < GMT_CONV8_LIMIT)
-		GMT->current.map.this_y_status = -1;
+		*y_status = -1;
 	else if (GMT->current.map.on_border_is_outside && fabs (lat - GMT->common.R.wesn[YHI]) < GMT_CONV8_LIMIT)
-		GMT->current.map.this_y_status = 1;
+		*y_status = 1;
 	else if (lat < GMT->common.R.wesn[YLO])
-		GMT->current.map.this_y_status = -2;
+		*y_status = -2;
 	else if (lat > GMT->common.R.wesn[YHI])
-		GMT->current.map.this_y_status = 2;
+		*y_status = 2;
 	else
-		GMT->current.map.this_y_status = 0;
+		*y_status = 0;
+}
+
+/*! . */
+GMT_LOCAL bool gmtmap_wesn_outside (struct GMT_CTRL *GMT, double lon, double lat) {
+	/* Determine if a point (lon,lat) is outside or on the rectangular lon/lat boundaries */
+
+	gmtmap_wesn_status (GMT, lon, lat, &GMT->current.map.this_x_status, &GMT->current.map.this_y_status);
 
 	return (GMT->current.map.this_x_status != 0 || GMT->current.map.this_y_status != 0);
 
@@ -1548,7 +1561,8 @@ GMT_LOCAL uint64_t gmtmap_rect_clip (struct GMT_CTRL *GMT, double *lon, double *
 
 	/* Get Cartesian map coordinates */
 
-	for (m = 0; m < n; m++) gmt_geo_to_xy (GMT, lon[m], lat[m], &xtmp[0][m], &ytmp[0][m]);
+	gmt_geo_to_xy_batch (GMT, lon, lat, xtmp[0], ytmp[0], n);
+	m = n;
 
 #ifdef DEBUG
 	if (dump) {
@@ -1940,7 +1954,7 @@ uint64_t gmt_map_wesn_clip (struct GMT_CTRL *GMT, double *lon, double *lat, uint
 		n_alloc = m;
 		gmt_M_malloc2 (GMT, xtmp[0], ytmp[0], 0U, &n_alloc, double);
 		/* Convert to map coordinates */
-		for (i = 0; i < m; i++) gmt_geo_to_xy (GMT, xtmp[0][i], ytmp[0][i], &xtmp[0][i], &ytmp[0][i]);
+		gmt_geo_to_xy_batch (GMT, xtmp[0], ytmp[0], xtmp[0], ytmp[0], m);
 
 		*x = xtmp[0];
 		*y = ytmp[0];
@@ -3987,8 +4001,14 @@ GMT_LOCAL int gmtmap_init_lambeq (struct GMT_CTRL *GMT, bool *search) {
 	GMT->current.proj.iDx = 1.0 / GMT->current.proj.Dx;
 	GMT->current.proj.iDy = 1.0 / GMT->current.proj.Dy;
 
-	GMT->current.proj.fwd = &gmtproj_lambeq;
-	GMT->current.proj.inv = &gmtproj_ilambeq;
+	if (GMT->current.proj.polar) {	/* Polar aspect; use streamlined polar versions */
+		GMT->current.proj.fwd = &gmtproj_plambeq;
+		GMT->current.proj.inv = &gmtproj_iplambeq;
+	}
+	else {
+		GMT->current.proj.fwd = &gmtproj_lambeq;
+		GMT->current.proj.inv = &gmtproj_ilambeq;
+	}
 	if (GMT->current.proj.units_pr_degree) {
 		gmtproj_vlambeq (GMT, 0.0, 90.0, GMT->current.proj.pars[2]);
 		gmtproj_lambeq (GMT, 0.0, fabs (GMT->current.proj.pars[4]), &dummy, &radius);
@@ -4409,8 +4429,14 @@ GMT_LOCAL int gmtmap_init_azeqdist (struct GMT_CTRL *GMT, bool *search) {
 		GMT->current.proj.scale[GMT_X] = GMT->current.proj.scale[GMT_Y] = GMT->current.proj.pars[3];
 
 	gmtproj_vazeqdist (GMT, GMT->current.proj.pars[0], GMT->current.proj.pars[1], GMT->current.proj.pars[2]);
-	GMT->current.proj.fwd = &gmtproj_azeqdist;
-	GMT->current.proj.inv = &gmtproj_iazeqdist;
+	if (GMT->current.proj.polar) {	/* Polar aspect; use streamlined polar versions */
+		GMT->current.proj.fwd = &gmtproj_pazeqdist;
+		GMT->current.proj.inv = &gmtproj_ipazeqdist;
+	}
+	else {
+		GMT->current.proj.fwd = &gmtproj_azeqdist;
+		GMT->current.proj.inv = &gmtproj_iazeqdist;
+	}
 
 	if (GMT->common.R.oblique) {	/* Rectangular box given */
 		(*GMT->current.proj.fwd) (GMT, GMT->common.R.wesn[XLO], GMT->common.R.wesn[YLO], &xmin, &ymin);
@@ -5821,6 +5847,71 @@ GMT_LOCAL double gmtmap_vincenty_dist_meter (struct GMT_CTRL *GMT, double lonS,
 	return (s * GMT->current.proj.EQ_RAD);
 }
 
+/*! . */
+GMT_LOCAL double gmtmap_vincenty_dist_meter_from (struct GMT_CTRL *GMT, struct GMT_DIST_FROM *D, double lonE, double latE) {
+	/* Same algorithm as gmtmap_vincenty_dist_meter, but the terms that only depend on the
+	 * fixed origin come precomputed in D, and the terms of the target latitude are memoized
+	 * there since grid scanlines revisit the same latitude for every column. */
+	double s, c, d, e, r, f, d_lon, dx, x, y, sa, cx, cy, cz, sx, sy, c2a, cu1, cu2, su1, tu1, tu2, ts, baz, faz;
+	int n_iter = 0;
+
+	f = D->f;
+	r = D->r;
+	tu1 = D->tu1;
+	su1 = D->su1;
+	cu1 = D->cu1;
+	if (latE != D->last_lat) {	/* New target latitude so must refresh its terms */
+		D->tu2 = r * tand (latE);
+		D->cu2 = 1.0 / sqrt (D->tu2 * D->tu2 + 1.0);
+		D->last_lat = latE;
+	}
+	tu2 = D->tu2;
+	cu2 = D->cu2;
+	ts  = cu1 * cu2;
+	baz = ts * tu2;
+	faz = baz * tu1;
+	gmt_M_set_delta_lon (D->lon0, lonE, d_lon);
+	if (gmt_M_is_zero (d_lon) && doubleAlmostEqualZero (D->lat0, latE)) return 0.0;
+	x = dx = D2R * d_lon;
+	do {
+		n_iter++;
+		sincos (x, &sx, &cx);
+		tu1 = cu2 * sx;
+		tu2 = baz - su1 * cu2 * cx;
+		sy = sqrt (tu1 * tu1 + tu2 * tu2);
+		cy = ts * cx + faz;
+		y = atan2 (sy, cy);
+		sa = ts * sx / sy;
+		c2a = -sa * sa + 1.0;
+		cz = faz + faz;
+		if (c2a > 0.0) cz = -cz / c2a + cy;
+		e = cz * cz * 2.0 - 1.0;
+		c = ((c2a * -3.0 + 4.0) * f + 4.0) * c2a * f / 16.0;
+		d = x;
+		x = ((e * cy * c + cz) * sy * c + y) * sa;
+		x = (1.0 - c) * x * f + dx;
+	} while (fabs (d - x) > VINCENTY_EPS && n_iter <= 50);
+	if (n_iter > VINCENTY_MAX_ITER) {
+		GMT->current.proj.n_geodesic_approx++;	/* Count inaccurate results */
+		if (GMT->current.proj.n_geodesic_approx == 1) GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "At least one near- or actual antipodal points encountered. Precision may be reduced slightly.\n");
+		s = M_PI;
+	}
+	else {
+		x = sqrt ((1.0 / r / r - 1.0) * c2a + 1.0) + 1.0;
+		x = (x - 2.0) / x;
+		c = (x * x / 4.0 + 1.0) / (1.0 - x);
+		d = (x * 0.375 * x - 1.0) * x;
+		s = ((((sy * sy * 4.0 - 3.0) * (1.0 - e - e) * cz * d / 6.0 - e * cy) * d / 4.0 + cz) * sy * d + y) * c * r;
+		if (s > M_PI) {
+			GMT->current.proj.n_geodesic_approx++;	/* Count inaccurate results */
+			if (GMT->current.proj.n_geodesic_approx == 1) GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "At least one near- or actual antipodal points encountered. Precision may be reduced slightly.\n");
+			s = M_PI;
+		}
+	}
+	GMT->current.proj.n_geodesic_calls++;
+	return (s * GMT->current.proj.EQ_RAD);
+}
+
 /*! . */
 GMT_LOCAL double gmtmap_rudoe_dist_meter (struct GMT_CTRL *GMT, double lonS, double latS, double lonE, double latE) {
 	/* Compute length of geodesic between locations in meters
@@ -5956,14 +6047,12 @@ GMT_LOCAL double gmtmap_az_backaz_loxodrome (struct GMT_CTRL *GMT, double lonE,
 GMT_LOCAL bool gmtmap_near_a_point_spherical (struct GMT_CTRL *GMT, double x, double y, struct GMT_DATATABLE *T, double dist) {
 	uint64_t row, seg;
 	bool each_point_has_distance;
-	double d;
 
 	each_point_has_distance = (dist <= 0.0 && T->segment[0]->n_columns > 2);
 	for (seg = 0; seg < T->n_segments; seg++) {
 		for (row = 0; row < T->segment[seg]->n_rows; row++) {
-			d = gmt_distance (GMT, x, y, T->segment[seg]->data[GMT_X][row], T->segment[seg]->data[GMT_Y][row]);
 			if (each_point_has_distance) dist = T->segment[seg]->data[GMT_Z][row];
-			if (d <= dist) return (true);
+			if (!gmt_distance_exceeds (GMT, x, y, T->segment[seg]->data[GMT_X][row], T->segment[seg]->data[GMT_Y][row], dist)) return (true);
 		}
 	}
 	return (false);
@@ -6727,7 +6816,28 @@ uint64_t gmt_clip_to_map (struct GMT_CTRL *GMT, double *lon, double *lat, uint64
 
 	/* First check for trivial cases:  All points outside or all points inside */
 
-	for (i = out = out_x = out_y = 0; i < np; i++)  {
+	out = 0;	out_x = out_y = 0;
+	if (GMT->current.map.outside == &gmtmap_wesn_outside) {
+		/* Most projections check against a rectangular lon/lat region; classify the points with the
+		 * thread-safe gmtmap_wesn_status so this triage pass can run in parallel without touching
+		 * the this|prev_x|y_status session state.  For long coastline polylines this pass is where
+		 * much of the clipping time goes. */
+		openmp_int k;
+#ifdef _OPENMP
+#pragma omp parallel for private(k) shared(GMT,np,lon,lat) reduction(+:out,out_x,out_y)
+#endif
+		for (k = 0; k < (openmp_int)np; k++) {
+			int x_status, y_status;
+			gmtmap_wesn_status (GMT, lon[k], lat[k], &x_status, &y_status);
+			out_x += x_status;	/* Completely left of west gives -2 * np, right of east gives + 2 * np */
+			out_y += y_status;	/* Completely below south gives -2 * np, above north gives + 2 * np */
+			out += (abs (x_status) == 2 || abs (y_status) == 2);
+		}
+		/* Leave the this|prev point statuses as the serial loop below would have */
+		for (i = (np > 1) ? np - 2 : 0; i < np; i++)
+			(void) gmt_map_outside (GMT, lon[i], lat[i]);
+	}
+	else for (i = 0; i < np; i++)  {
 		(void) gmt_map_outside (GMT, lon[i], lat[i]);
 		out_x += GMT->current.map.this_x_status;	/* Completely left of west gives -2 * np, right of east gives + 2 * np */
 		out_y += GMT->current.map.this_y_status;	/* Completely below south gives -2 * np, above north gives + 2 * np */
@@ -6735,7 +6845,7 @@ uint64_t gmt_clip_to_map (struct GMT_CTRL *GMT, double *lon, double *lat, uint64
 	}
 	if (out == 0) {		/* All points are inside map boundary; no clipping required */
 		gmt_M_malloc2 (GMT, xx, yy, np, NULL, double);
-		for (i = 0; i < np; i++) gmt_geo_to_xy (GMT, lon[i], lat[i], &xx[i], &yy[i]);
+		gmt_geo_to_xy_batch (GMT, lon, lat, xx, yy, np);
 		*x = xx;	*y = yy;	n = np;
 	}
 	else if (out == np) {	/* All points are outside map boundary */
@@ -7238,6 +7348,38 @@ bool gmt_geo_to_xy (struct GMT_CTRL *GMT, double lon, double lat, double *x, dou
 	return false;
 }
 
+/*! . */
+void gmt_geo_to_xy_batch (struct GMT_CTRL *GMT, double *lon, double *lat, double *x, double *y, uint64_t n) {
+	/* Converts n lon/lat points to x/y using the current projection.  Functionally identical to
+	 * calling gmt_geo_to_xy per point but hoists the scale/origin loads out of the loop, and for
+	 * plain spherical Mercator we run a specialized loop with the projection inlined so the only
+	 * call left per point is the log.  In-place conversion (x == lon, y == lat) is allowed. */
+	uint64_t k;
+	double xs = GMT->current.proj.scale[GMT_X], ys = GMT->current.proj.scale[GMT_Y];
+	double x0 = GMT->current.proj.origin[GMT_X], y0 = GMT->current.proj.origin[GMT_Y];
+
+	if (GMT->current.proj.projection == GMT_MERCATOR && !GMT->current.proj.GMT_convert_latitudes) {
+		/* Same expressions as gmtproj_merc_sph, with the scale and shift folded in */
+		double jx = GMT->current.proj.j_x, cm = GMT->current.proj.central_meridian, plon, plat;
+		for (k = 0; k < n; k++) {
+			plon = lon[k];	plat = lat[k];
+			if (gmt_M_is_dnan (plon) || gmt_M_is_dnan (plat)) { x[k] = y[k] = GMT->session.d_NaN; continue; }
+			plon -= cm;	/* Remove central meridian and place lon in -180/+180 range */
+			while (plon < -GMT_180) plon += 360.0;
+			while (plon > +GMT_180) plon -= 360.0;
+			x[k] = jx * D2R * plon * xs + x0;
+			y[k] = ((fabs (plat) < 90.0) ? jx * d_log (GMT, tand (45.0 + 0.5 * plat)) : copysign (DBL_MAX, plat)) * ys + y0;
+		}
+		return;
+	}
+	for (k = 0; k < n; k++) {	/* General path: still one indirect call per point */
+		if (gmt_M_is_dnan (lon[k]) || gmt_M_is_dnan (lat[k])) { x[k] = y[k] = GMT->session.d_NaN; continue; }
+		(*GMT->current.proj.fwd) (GMT, lon[k], lat[k], &x[k], &y[k]);
+		x[k] = x[k] * xs + x0;
+		y[k] = y[k] * ys + y0;
+	}
+}
+
 /*! . */
 bool gmt_geo_to_xy_noshift (struct GMT_CTRL *GMT, double lon, double lat, double *x, double *y) {
 	/* Converts lon/lat to x/y using the current projection but applies no shift */
@@ -7475,6 +7617,104 @@ double gmt_distance (struct GMT_CTRL *GMT, double lonS, double latS, double lonE
 	return (gmtlib_distance_type (GMT, lonS, latS, lonE, latE, 0));
 }
 
+/*! . */
+void gmt_distance_from_prep (struct GMT_CTRL *GMT, double lon0, double lat0, struct GMT_DIST_FROM *D) {
+	/* Precompute the origin-dependent terms needed by gmt_distance_from so that repeated
+	 * distances from the same origin (e.g., filter windows, sphdistance polygons) do not
+	 * recompute them per point pair.  Works for any distance setting; flavors without a
+	 * fast path simply fall back on gmt_distance. */
+	gmt_M_memset (D, 1, struct GMT_DIST_FROM);
+	D->lon0 = lon0;	D->lat0 = lat0;
+	D->last_lat = GMT->session.d_NaN;	/* Force refresh of latitude terms on first use */
+	if (GMT->current.map.dist[GMT_MAP_DIST].func == &gmt_great_circle_dist_meter ||
+	    GMT->current.map.dist[GMT_MAP_DIST].func == &gmtlib_great_circle_dist_degree ||
+	    GMT->current.map.dist[GMT_MAP_DIST].func == &gmtlib_great_circle_dist_cos) {
+		if (GMT->current.map.dist[GMT_MAP_DIST].func == &gmt_great_circle_dist_meter)
+			D->mode = GMT_DIST_FROM_GC_METER;
+		else if (GMT->current.map.dist[GMT_MAP_DIST].func == &gmtlib_great_circle_dist_degree)
+			D->mode = GMT_DIST_FROM_GC_DEG;
+		else
+			D->mode = GMT_DIST_FROM_GC_COS;
+		D->lat0_aux = (GMT->current.setting.proj_aux_latitude != GMT_LATSWAP_NONE) ? gmt_lat_swap (GMT, lat0, GMT->current.setting.proj_aux_latitude) : lat0;
+		D->cos_lat0 = cosd (D->lat0_aux);
+	}
+	else if (GMT->current.map.dist[GMT_MAP_DIST].func == &gmtmap_vincenty_dist_meter) {
+		D->mode = GMT_DIST_FROM_VINCENTY;
+		D->f = GMT->current.setting.ref_ellipsoid[GMT->current.setting.proj_ellipsoid].flattening;
+		D->r = 1.0 - D->f;
+		D->tu1 = D->r * tand (lat0);
+		D->cu1 = 1.0 / sqrt (D->tu1 * D->tu1 + 1.0);
+		D->su1 = D->cu1 * D->tu1;
+	}
+	else	/* Cartesian, flat Earth, loxodrome, or another geodesic: no origin terms worth caching */
+		D->mode = GMT_DIST_FROM_GENERIC;
+}
+
+/*! . */
+double gmt_distance_from (struct GMT_CTRL *GMT, struct GMT_DIST_FROM *D, double lon, double lat) {
+	/* Distance from the fixed origin given to gmt_distance_from_prep to (lon, lat), in the
+	 * current map distance unit.  Matches gmt_distance (GMT, D->lon0, D->lat0, lon, lat)
+	 * exactly, but reuses the cached origin terms and the terms of the previous latitude. */
+	double sx, sin_half_squared, d;
+
+	switch (D->mode) {
+		case GMT_DIST_FROM_GC_DEG: case GMT_DIST_FROM_GC_METER: case GMT_DIST_FROM_GC_COS:
+			if (lat != D->last_lat) {	/* New target latitude so must refresh its terms */
+				double lat2 = (GMT->current.setting.proj_aux_latitude != GMT_LATSWAP_NONE) ? gmt_lat_swap (GMT, lat, GMT->current.setting.proj_aux_latitude) : lat;
+				double sy = sind (0.5 * (lat2 - D->lat0_aux));
+				D->sy2 = sy * sy;
+				D->coscos = cosd (lat2) * D->cos_lat0;
+				D->last_lat = lat;
+			}
+			sx = sind (0.5 * (lon - D->lon0));	/* If there is a 360 wrap here then the sign of sx is wrong but we only use sx^2 */
+			sin_half_squared = D->sy2 + D->coscos * sx * sx;
+			if (D->mode == GMT_DIST_FROM_GC_COS)
+				d = 1.0 - 2.0 * sin_half_squared;	/* Convert sin^2 (half-angle) to cos (angle) */
+			else {
+				d = 2.0 * d_asind (d_sqrt (sin_half_squared));
+				if (D->mode == GMT_DIST_FROM_GC_METER) d *= GMT->current.proj.DIST_M_PR_DEG;
+			}
+			break;
+		case GMT_DIST_FROM_VINCENTY:
+			d = gmtmap_vincenty_dist_meter_from (GMT, D, lon, lat);
+			break;
+		default:	/* No fast path for this distance flavor */
+			return (gmt_distance (GMT, D->lon0, D->lat0, lon, lat));
+	}
+	return (GMT->current.map.dist[GMT_MAP_DIST].scale * d);
+}
+
+/*! . */
+bool gmt_distance_exceeds (struct GMT_CTRL *GMT, double lonS, double latS, double lonE, double latE, double limit) {
+	/* True if gmt_distance (GMT, lonS, latS, lonE, latE) > limit, with limit in the current map
+	 * distance unit.  For the spherical great circle flavors we first try cheap latitude and
+	 * longitude bounds that settle most comparisons with at most one cosine; only point pairs
+	 * near the threshold pay for the exact haversine evaluation.  All bounds follow from the
+	 * spherical triangle inequality so the answer always matches the exact comparison. */
+	if ((GMT->current.map.dist[GMT_MAP_DIST].func == &gmt_great_circle_dist_meter ||
+	     GMT->current.map.dist[GMT_MAP_DIST].func == &gmtlib_great_circle_dist_degree) &&
+	    GMT->current.setting.proj_aux_latitude == GMT_LATSWAP_NONE && limit >= 0.0) {
+		double scale = GMT->current.map.dist[GMT_MAP_DIST].scale;	/* From degrees of arc to the output unit */
+		double limit_deg, dlat, dlon, phi, phi_far;
+		if (GMT->current.map.dist[GMT_MAP_DIST].func == &gmt_great_circle_dist_meter)
+			scale *= GMT->current.proj.DIST_M_PR_DEG;
+		limit_deg = limit / scale;
+		if (limit_deg >= 180.0) return (false);	/* No two points are further apart than 180 degrees */
+		dlat = fabs (latE - latS);
+		if (dlat > limit_deg) return (true);	/* Meridional separation alone exceeds the limit */
+		dlon = fabs (lonE - lonS);
+		if (dlon > 360.0) dlon = fmod (dlon, 360.0);
+		if (dlon > 180.0) dlon = 360.0 - dlon;
+		phi = MAX (fabs (latS), fabs (latE));
+		if (dlat + dlon * cosd (phi) <= limit_deg) return (false);	/* Meridian plus parallel detour is already within the limit */
+		/* If the true distance were within the limit then no point on the path could be more than
+		 * limit_deg poleward of the endpoints, bounding the cosine shrink of its longitude sweep */
+		phi_far = phi + limit_deg;
+		if (phi_far < 90.0 && dlon * cosd (phi_far) > limit_deg) return (true);
+	}
+	return (gmt_distance (GMT, lonS, latS, lonE, latE) > limit);
+}
+
 /*! . */
 bool gmt_near_a_point (struct GMT_CTRL *GMT, double lon, double lat, struct GMT_DATATABLE *T, double dist) {
 	/* Compute distance to nearest point in T from (lon, lat) */
@@ -8014,10 +8254,9 @@ uint64_t gmt_cart_to_xy_line (struct GMT_CTRL *GMT, double *x, double *y, uint64
 
 	while (n > GMT->current.plot.n_alloc) gmt_get_plot_array (GMT);
 
-	for (k = 0; k < n; k++) {
-		gmt_geo_to_xy (GMT, x[k], y[k], &GMT->current.plot.x[k], &GMT->current.plot.y[k]);
+	gmt_geo_to_xy_batch (GMT, x, y, GMT->current.plot.x, GMT->current.plot.y, n);
+	for (k = 0; k < n; k++)
 		GMT->current.plot.pen[k] = PSL_DRAW;
-	}
 	GMT->current.plot.pen[0] = PSL_MOVE;
 	return (n);
 }
@@ -8410,14 +8649,15 @@ int gmt_grd_project (struct GMT_CTRL *GMT, struct GMT_GRID *I, struct GMT_GRID *
 
 /* PART 2: Create weighted average of interpolated and observed points */
 
-/* Open MP does not work yet */
-
-/* The OpenMP loop below fails and yields nodes still set to NaN.  I cannot see any errors but obviously
- * there is something that is not quite correct. */
+/* The per-point projection functions are stateless for all projections except GMT_GENPER, whose
+ * forward/inverse routines update GMT->current.proj.g_outside, so for the other projections the
+ * rows can safely be farmed out to threads: each node only reads shared data (or, for rectangular
+ * graticules, the projected coordinates precomputed per row and column above) and writes its own
+ * output node. */
 
-//#ifdef _OPENMP
-//#pragma omp parallel for private(row_out,y_proj,col_out,ij_out,x_proj,z_int,inv_nz) shared(O,GMT,y_out_proj,x_out_proj,inverse,x_out,y_out,I,nz)
-//#endif
+#ifdef _OPENMP
+#pragma omp parallel for if (GMT->current.proj.projection_GMT != GMT_GENPER) private(row_out,y_proj,col_out,ij_out,x_proj,z_int,inv_nz) shared(O,GMT,y_out_proj,x_out_proj,inverse,x_out,y_out,I,nz)
+#endif
 	for (row_out = 0; row_out < (openmp_int)O->header->n_rows; row_out++) {	/* Loop over the output grid row coordinates */
 		if (gmt_M_is_rect_graticule (GMT)) y_proj = y_out_proj[row_out];
 		gmt_M_col_loop (GMT, O, row_out, col_out, ij_out) {	/* Loop over the output grid col coordinates */
@@ -9823,6 +10063,16 @@ int gmt_proj_setup (struct GMT_CTRL *GMT, double wesn[]) {
 	return (error);
 }
 
+GMT_LOCAL bool gmtmap_projsnapshot_key (struct GMT_CTRL *GMT, double wesn[], char *key) {
+	/* Build the signature for the session projection snapshot from the canonical -R -J option
+	 * strings plus the actual region passed to gmt_map_setup (modules may pass a subset).
+	 * Return false when we have no option strings to key on so the setup cannot be cached. */
+	if (GMT->common.R.string[0] == '\0' || GMT->common.J.string[0] == '\0') return (false);
+	snprintf (key, GMT_LEN256, "%s %s %.16g/%.16g/%.16g/%.16g", GMT->common.R.string, GMT->common.J.string,
+		wesn[XLO], wesn[XHI], wesn[YLO], wesn[YHI]);
+	return (true);
+}
+
 int gmt_map_perimeter_search (struct GMT_CTRL *GMT, double *wesn, bool add_pad) {
 	/* Loop around rectangular perimeter and determine min/max lon/lat extent.
 	 * If add_pad is true then we extend by 0.1 degrees (as per GMT historical settings) */
@@ -9850,6 +10100,7 @@ int gmt_map_setup (struct GMT_CTRL *GMT, double wesn[]) {
 	bool test_pole[2] = {true, true}, separate_intervals = false;
 	double scale, i_scale;
 
+	gmt_M_tic (GMT, GMT_TIMING_PROJ);
 	if ((error = gmt_proj_setup (GMT, wesn)) != GMT_NOERROR) goto gmt_map_setup_end;
 
 	gmt_set_undefined_defaults (GMT, sqrt (GMT->current.map.width * GMT->current.map.height), false);	/* We must change any undefined defaults given max plot dimension */
@@ -9905,8 +10156,24 @@ int gmt_map_setup (struct GMT_CTRL *GMT, double wesn[]) {
 	}
 
 	if (search) {	/* Loop around rectangular perimeter and determine min/max lon/lat extent */
-		if ((error = gmt_map_perimeter_search (GMT, wesn, true)))
-			goto gmt_map_setup_end;
+		char key[GMT_LEN256] = {""};
+		bool cacheable = gmtmap_projsnapshot_key (GMT, wesn, key);
+		struct GMT_PROJSNAPSHOT *snap = &GMT->session.projsnapshot;
+		if (cacheable && snap->key && !strcmp (snap->key, key)) {	/* Same -R -J setup as an earlier call in this session */
+			gmt_M_memcpy (GMT->common.R.wesn, snap->wesn, 4, double);
+			GMT->current.map.dlon = (GMT->common.R.wesn[XHI] - GMT->common.R.wesn[XLO]) / GMT->current.map.n_lon_nodes;
+			GMT->current.map.dlat = (GMT->common.R.wesn[YHI] - GMT->common.R.wesn[YLO]) / GMT->current.map.n_lat_nodes;
+			GMT_Report (GMT->parent, GMT_MSG_DEBUG, "gmt_map_setup: Restored perimeter search region from session snapshot.\n");
+		}
+		else {
+			if ((error = gmt_map_perimeter_search (GMT, wesn, true)))
+				goto gmt_map_setup_end;
+			if (cacheable) {	/* Remember the derived region so identical later setups can skip the search */
+				gmt_M_str_free (snap->key);
+				snap->key = strdup (key);
+				gmt_M_memcpy (snap->wesn, GMT->common.R.wesn, 4, double);
+			}
+		}
 	}
 
 	/* Maximum step size (in degrees) used for interpolation of line segments along great circles (or meridians/parallels)  before they are plotted */
@@ -9919,6 +10186,7 @@ int gmt_map_setup (struct GMT_CTRL *GMT, double wesn[]) {
 
 gmt_map_setup_end:
 
+	gmt_M_toc (GMT, GMT_TIMING_PROJ);
 	if (error) GMT_Report(GMT->parent, GMT_MSG_ERROR, "General map projection error\n");
 	return (error);
 }
@@ -40,6 +40,9 @@
  * B) List of exported gmtlib_* functions available to libraries via gmt_internals.h:
  *
  *	gmtlib_free_tmp_arrays
+ *	gmtlib_mem_arena_alloc
+ *	gmtlib_mem_arena_create
+ *	gmtlib_mem_arena_free
  */
 
 #include "gmt_dev.h"
@@ -465,6 +468,59 @@ void gmtlib_free_tmp_arrays (struct GMT_CTRL *GMT) {
 	GMT->hidden.mem_set = false;	/* Back to where we started */
 }
 
+struct GMT_MEM_ARENA * gmtlib_mem_arena_create (struct GMT_CTRL *GMT, size_t n_bytes) {
+	/* Start a memory arena expected to hand out ~n_bytes in total.  The first block is allocated
+	 * here; if the estimate turns out to be too low then gmtlib_mem_arena_alloc chains on more
+	 * blocks as needed.  Returns NULL if memory is tight, in which case the caller must simply
+	 * stay with regular allocations. */
+	struct GMT_MEM_ARENA *A = gmt_M_memory (GMT, NULL, 1, struct GMT_MEM_ARENA);
+	if (A == NULL) return (NULL);
+	A->chunk = MIN (MAX (n_bytes, GMT_ARENA_CHUNK_MIN), GMT_ARENA_CHUNK_MAX);
+	if ((A->block = gmt_M_memory (GMT, NULL, A->chunk, unsigned char)) == NULL) {
+		gmt_M_free (GMT, A);
+		return (NULL);
+	}
+	A->n_alloc = A->chunk;
+	GMT_Report (GMT->parent, GMT_MSG_DEBUG, "gmtlib_mem_arena_create: Started memory arena with a %" PRIuS " byte block\n", A->n_alloc);
+	return (A);
+}
+
+void * gmtlib_mem_arena_alloc (struct GMT_CTRL *GMT, struct GMT_MEM_ARENA *A, size_t n_bytes) {
+	/* Hand out the next n_bytes from the arena.  Like gmt_M_memory, the memory returned is
+	 * initialized to zero; it is also aligned to 16 bytes.  There is no per-item free: the
+	 * entire arena is released in one shot by gmtlib_mem_arena_free. */
+	void *ptr = NULL;
+	n_bytes = ((n_bytes + 15U) / 16U) * 16U;	/* Round up so consecutive assignments stay aligned */
+	if (A->n_used + n_bytes > A->n_alloc) {	/* Current block is full so we must chain on a new one */
+		size_t n_alloc = MAX (n_bytes, A->chunk);
+		struct GMT_MEM_ARENA *retired = NULL;
+		unsigned char *block = gmt_M_memory (GMT, NULL, n_alloc, unsigned char);
+		if (block == NULL) return (NULL);	/* The arena is still valid; only this request failed */
+		if ((retired = gmt_M_memory (GMT, NULL, 1, struct GMT_MEM_ARENA)) == NULL) {
+			gmt_M_free (GMT, block);
+			return (NULL);
+		}
+		*retired = *A;	/* The full block (and any earlier ones it links to) moves to the old list */
+		A->block = block;	A->n_alloc = n_alloc;	A->n_used = 0;	A->old = retired;
+		GMT_Report (GMT->parent, GMT_MSG_DEBUG, "gmtlib_mem_arena_alloc: Chained on another %" PRIuS " byte block\n", n_alloc);
+	}
+	ptr = A->block + A->n_used;
+	A->n_used += n_bytes;
+	return (ptr);
+}
+
+void gmtlib_mem_arena_free (struct GMT_CTRL *GMT, struct GMT_MEM_ARENA **A) {
+	/* Release everything this arena ever handed out, in one shot */
+	struct GMT_MEM_ARENA *current = *A, *old = NULL;
+	while (current) {
+		old = current->old;
+		gmt_M_free (GMT, current->block);
+		gmt_M_free (GMT, current);
+		current = old;
+	}
+	*A = NULL;
+}
+
 void gmt_prep_tmp_arrays (struct GMT_CTRL *GMT, int direction, size_t row, size_t n_cols) {
 	size_t col;
 
@@ -496,6 +552,39 @@ void gmt_prep_tmp_arrays (struct GMT_CTRL *GMT, int direction, size_t row, size_
 	/* Note: Any additions to these arrays are not guaranteed to be set to zero */
 }
 
+#ifdef _OPENMP
+#define GMT_FIRST_TOUCH_LIMIT 16777216U	/* Use parallel first-touch zeroing for fresh allocations of at least 16 Mb */
+
+GMT_LOCAL void *gmtmemory_first_touch_calloc (size_t nelem, size_t size) {
+	/* calloc zeroes lazily: each page faults in on the thread that first writes it, which for
+	 * grid arrays is the single allocating thread, so on multi-socket machines the whole array
+	 * lands on one memory node and the later OpenMP loops stream across the socket link.  For
+	 * large allocations we instead malloc and zero the array in parallel with the same static
+	 * thread decomposition the row loops use, so each page is faulted in - and hence placed -
+	 * on the node of the thread that will process it.  Setting GMT_FIRST_TOUCH=off in the
+	 * environment disables this; a numeric value overrides the size threshold in Mb.
+	 * Returns NULL when not applicable so the caller falls back on plain calloc. */
+	size_t n_bytes = nelem * size, limit = GMT_FIRST_TOUCH_LIMIT, chunk;
+	char *env = NULL, *tmp = NULL;
+	openmp_int t, n_chunks;
+
+	if ((env = getenv ("GMT_FIRST_TOUCH"))) {
+		if (!strcmp (env, "off")) return NULL;
+		if (atof (env) > 0.0) limit = (size_t)(atof (env) * 1048576.0);
+	}
+	if (n_bytes < limit) return NULL;
+	if ((tmp = malloc (n_bytes)) == NULL) return NULL;
+	n_chunks = (openmp_int)omp_get_max_threads ();
+	chunk = (n_bytes + (size_t)n_chunks - 1) / (size_t)n_chunks;
+#pragma omp parallel for private(t) shared(tmp,n_bytes,chunk,n_chunks)
+	for (t = 0; t < n_chunks; t++) {
+		size_t start = (size_t)t * chunk, stop = MIN (start + chunk, n_bytes);
+		if (start < n_bytes) memset (&tmp[start], 0, stop - start);
+	}
+	return tmp;
+}
+#endif
+
 void *gmt_memory_func (struct GMT_CTRL *GMT, void *prev_addr, size_t nelem, size_t size, bool align, const char *where) {
 	/* Multi-functional memory allocation subroutine.
 	   If prev_addr is NULL, allocate new memory of nelem elements of size bytes.
@@ -561,8 +650,12 @@ void *gmt_memory_func (struct GMT_CTRL *GMT, void *prev_addr, size_t nelem, size
 			if (tmp != NULL)
 				tmp = memset (tmp, 0, nelem * size);
 		}
-		else
+		else {
+#ifdef _OPENMP
+			if ((tmp = gmtmemory_first_touch_calloc (nelem, size)) == NULL)	/* Too small for (or opted out of) parallel first-touch zeroing */
+#endif
 			tmp = calloc (nelem, size);
+		}
 		if (tmp == NULL) {
 			gmtmemory_die_if_memfail (GMT, nelem, size, where);
 			return (NULL);
@@ -60,6 +60,20 @@ enum GMT_enum_mem_alloc {	/* Initial memory for 2 double columns is 32 Mb */
 /*! Convenience macro for free that explicitly sets freed pointer to NULL */
 #define gmt_M_str_free(ptr) (free((void *)(ptr)),(ptr)=NULL)
 
+/* Settings for the memory arena used when building large datasets (see gmtlib_mem_arena_create) */
+
+#define GMT_ARENA_CHUNK_MIN	     65536U	/* Smallest block (64 Kb) we will allocate for an arena */
+#define GMT_ARENA_CHUNK_MAX	 268435456U	/* Largest block (256 Mb) we will allocate for an arena; larger arenas chain several blocks */
+#define GMT_ARENA_MIN_SEGMENTS	       512U	/* Datasets with fewer segments than this are not worth an arena */
+
+struct GMT_MEM_ARENA {	/* Bump allocator: memory is handed out sequentially from large blocks and all freed in one shot */
+	size_t n_alloc;			/* Usable size of the current block in bytes */
+	size_t n_used;			/* Bytes handed out from the current block so far */
+	size_t chunk;			/* Size to use when another block must be chained on */
+	unsigned char *block;		/* The current block we are handing out memory from */
+	struct GMT_MEM_ARENA *old;	/* Linked list of earlier, exhausted blocks, if any */
+};
+
 #ifdef MEMDEBUG
 
 struct MEMORY_ITEM {
@@ -49,6 +49,7 @@
  * B) List of exported gmtlib_* functions available to libraries via gmt_internals.h:
  *
  *	gmtlib_is_nc_grid
+ *	gmtlib_nc_release_cached
  * - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - - -*/
 
 #include "gmt_dev.h"
@@ -151,6 +152,155 @@ GMT_LOCAL int gmtnc_n_chunked_rows_in_cache (struct GMT_CTRL *GMT, struct GMT_GR
 	return GMT_NOERROR;
 }
 
+#ifdef _OPENMP
+#define NC_PARALLEL_MIN_CELLS 16777216U	/* Do not spin up workers for grids smaller than 16M cells */
+
+GMT_LOCAL int gmtnc_io_nc_grid_parallel (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header, unsigned width, unsigned height, unsigned origin[], gmt_grdfloat *grid) {
+	/* Chunk-parallel read of a deflate-compressed netCDF-4 grid.  The netCDF library
+	 * serializes inflate through a single handle, so each worker opens a private
+	 * handle on the file and reads a contiguous band of chunk rows into its slice of
+	 * the output array.  Bands are aligned on chunk boundaries so no chunk is
+	 * inflated by more than one worker.  Returns NC_NOERR on success; any other
+	 * return means the caller must fall back on the serial path. */
+	int status = NC_NOERR, storage = NC_CONTIGUOUS, shuffle = 0, deflate = 0, deflate_level = 0, band, n_bands;
+	unsigned yx_dim[2];	/* because xy_dim is not row major! */
+	size_t chunksize[5] = {0,0,0,0,0}, rows_per_band, height_t = (size_t)height;
+	char z_name[NC_MAX_NAME+1] = {""};
+	struct GMT_GRID_HEADER_HIDDEN *HH = gmt_get_H_hidden (header);
+
+	if (strstr (HH->name, "://")) return NC_EINVAL;	/* Only plain local files can be reopened per worker */
+	yx_dim[0] = HH->xy_dim[1], yx_dim[1] = HH->xy_dim[0];
+	if (nc_inq_var_deflate (HH->ncid, HH->z_id, &shuffle, &deflate, &deflate_level) != NC_NOERR || !deflate)
+		return NC_EINVAL;	/* Uncompressed grids gain nothing; inflate is what we parallelize over */
+	if (nc_inq_var_chunking (HH->ncid, HH->z_id, &storage, chunksize) != NC_NOERR || storage != NC_CHUNKED)
+		return NC_EINVAL;
+	if (nc_inq_varname (HH->ncid, HH->z_id, z_name) != NC_NOERR) return NC_EINVAL;
+
+	n_bands = MIN (omp_get_max_threads (), (int)ceil ((double)height_t / chunksize[yx_dim[0]]));
+	if (n_bands < 2) return NC_EINVAL;	/* Nothing to gain */
+	/* Whole multiple of chunk rows per band so workers never share a chunk */
+	rows_per_band = ((height_t + n_bands - 1) / n_bands + chunksize[yx_dim[0]] - 1) / chunksize[yx_dim[0]] * chunksize[yx_dim[0]];
+	n_bands = (int)((height_t + rows_per_band - 1) / rows_per_band);
+
+	GMT_Report (GMT->parent, GMT_MSG_DEBUG, "gmtnc_io_nc_grid_parallel: Reading %s with %d workers (%" PRIuS " rows per band)\n", HH->name, n_bands, rows_per_band);
+
+#pragma omp parallel for private(band) shared(GMT,HH,header,grid,z_name,yx_dim,rows_per_band,height_t,origin,width,n_bands,status)
+	for (band = 0; band < n_bands; band++) {
+		int ncid, z_id, err;
+		size_t start[5] = {0,0,0,0,0}, count[5] = {1,1,1,1,1};
+		size_t first_row = (size_t)band * rows_per_band;
+		if ((err = nc_open (HH->name, NC_NOWRITE, &ncid)) == NC_NOERR) {
+			if ((err = nc_inq_varid (ncid, z_name, &z_id)) == NC_NOERR) {
+				memcpy (start, HH->t_index, 3 * sizeof(size_t));	/* Set lower dimensions first (e.g. layer) */
+				start[yx_dim[0]] = origin[0] + first_row;
+				start[yx_dim[1]] = origin[1];
+				count[yx_dim[0]] = MIN (rows_per_band, height_t - first_row);
+				count[yx_dim[1]] = (size_t)width;
+				err = gmtnc_vara_grdfloat (ncid, z_id, start, count, grid + first_row * width, k_get_netcdf);
+			}
+			nc_close (ncid);
+		}
+		if (err != NC_NOERR) {	/* Record one of the failures (whichever worker gets here last) */
+#pragma omp critical
+			status = err;
+		}
+	}
+	return status;
+}
+#endif	/* _OPENMP */
+
+#ifdef HAVE_GLIB_GTHREAD
+#define NC_PIPELINE_MIN_CELLS 16777216U	/* Do not pipeline writes of grids smaller than 16M cells */
+#define NC_PIPELINE_DONE -1	/* Queue sentinel telling the writer thread to finish up */
+
+struct NC_WRITEJOB {	/* What the background writer needs to put one band of chunk rows */
+	int ncid, z_id;		/* Open handles; the writer is the only thread touching them until joined */
+	int status;		/* First netCDF error encountered by the writer */
+	unsigned yx_dim[2];	/* y,x dimensions in row-major order */
+	size_t t_start[3];	/* Start indices of lower dimensions (e.g. layer) */
+	size_t rows_per_band;	/* Band height in rows (a whole number of chunks) */
+	size_t width, height;	/* Dimensions of the array being written */
+	gmt_grdfloat *grid;	/* Start of the (unpadded) array */
+	GAsyncQueue *queue;	/* Main thread posts band numbers here once they are conditioned */
+};
+
+GMT_LOCAL gpointer gmtnc_write_band_worker (gpointer arg) {
+	/* Pop conditioned bands off the queue and put them.  Deflate happens inside the
+	 * nc put call, overlapping the conditioning of the next band on the main thread. */
+	struct NC_WRITEJOB *job = arg;
+	gpointer p;
+	while (GPOINTER_TO_INT (p = g_async_queue_pop (job->queue)) != NC_PIPELINE_DONE) {
+		int err, band = GPOINTER_TO_INT (p) - 1;	/* Bands are posted as band + 1 since 0 is not a valid queue item */
+		size_t start[5] = {0,0,0,0,0}, count[5] = {1,1,1,1,1};
+		size_t first_row = (size_t)band * job->rows_per_band;
+		memcpy (start, job->t_start, 3 * sizeof(size_t));
+		start[job->yx_dim[0]] = first_row;
+		count[job->yx_dim[0]] = MIN (job->rows_per_band, job->height - first_row);
+		count[job->yx_dim[1]] = job->width;
+		err = gmtnc_vara_grdfloat (job->ncid, job->z_id, start, count, job->grid + first_row * job->width, k_put_netcdf);
+		if (err != NC_NOERR && job->status == NC_NOERR) job->status = err;
+	}
+	return NULL;
+}
+
+GMT_LOCAL int gmtnc_write_grd_pipeline (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header, unsigned width, unsigned height, gmt_grdfloat *grid, bool adj_nan_value, bool do_round) {
+	/* Write-behind for large deflated grids: a background writer thread compresses and puts
+	 * one chunk-aligned band while this thread conditions (NaN substitution, rounding, z-range
+	 * update) the next one, so deflate overlaps the conditioning pass instead of following it.
+	 * Bands hold whole chunks so every chunk is compressed and written exactly once, and only
+	 * one thread ever issues netCDF calls on the handle.  Returns NC_EINVAL if the file does
+	 * not qualify; the caller must then fall back on the serial path. */
+	int storage = NC_CONTIGUOUS, shuffle = 0, deflate = 0, deflate_level = 0, band, n_bands;
+	size_t chunksize[5] = {0,0,0,0,0}, rows_per_band, height_t = (size_t)height, width_t = (size_t)width, n, band_stop;
+	GThread *writer = NULL;
+	struct NC_WRITEJOB job;
+	struct GMT_GRID_HEADER_HIDDEN *HH = gmt_get_H_hidden (header);
+
+	if (nc_inq_var_deflate (HH->ncid, HH->z_id, &shuffle, &deflate, &deflate_level) != NC_NOERR || !deflate)
+		return NC_EINVAL;	/* Without deflate the put is i/o-bound and overlapping buys nothing */
+	if (nc_inq_var_chunking (HH->ncid, HH->z_id, &storage, chunksize) != NC_NOERR || storage != NC_CHUNKED)
+		return NC_EINVAL;
+
+	gmt_M_memset (&job, 1, struct NC_WRITEJOB);
+	/* Bands are one chunk of rows tall; grow them until a band holds at least the cache size */
+	rows_per_band = chunksize[HH->xy_dim[1]];
+	while (rows_per_band * width_t * sizeof (gmt_grdfloat) < NC_CACHE_SIZE && rows_per_band < height_t)
+		rows_per_band += chunksize[HH->xy_dim[1]];
+	n_bands = (int)((height_t + rows_per_band - 1) / rows_per_band);
+	if (n_bands < 2) return NC_EINVAL;	/* A single band means nothing to overlap */
+
+	GMT_Report (GMT->parent, GMT_MSG_DEBUG, "gmtnc_write_grd_pipeline: Writing %s behind conditioning in %d bands (%" PRIuS " rows per band)\n", HH->name, n_bands, rows_per_band);
+
+	job.ncid = HH->ncid;	job.z_id = HH->z_id;	job.status = NC_NOERR;
+	job.yx_dim[0] = HH->xy_dim[1];	job.yx_dim[1] = HH->xy_dim[0];	/* because xy_dim is not row major! */
+	memcpy (job.t_start, HH->t_index, 3 * sizeof(size_t));
+	job.rows_per_band = rows_per_band;
+	job.width = width_t;	job.height = height_t;
+	job.grid = grid;
+	job.queue = g_async_queue_new ();
+	writer = g_thread_new ("gmtncwriter", gmtnc_write_band_worker, &job);
+
+	for (band = 0; band < n_bands; band++) {	/* Condition one band, then hand it to the writer */
+		band_stop = MIN (((size_t)band + 1) * rows_per_band, height_t) * width_t;
+		for (n = (size_t)band * rows_per_band * width_t; n < band_stop; n++) {
+			if (adj_nan_value && isnan (grid[n]))
+				grid[n] = header->nan_value;
+			else if (!isnan (grid[n])) {
+				if (do_round)
+					grid[n] = rintf (grid[n]); /* round to int */
+				header->z_min = MIN (header->z_min, grid[n]);
+				header->z_max = MAX (header->z_max, grid[n]);
+			}
+		}
+		g_async_queue_push (job.queue, GINT_TO_POINTER (band + 1));
+	}
+	g_async_queue_push (job.queue, GINT_TO_POINTER (NC_PIPELINE_DONE));
+	g_thread_join (writer);	/* After this the handle is ours again */
+	g_async_queue_unref (job.queue);
+	return job.status;
+}
+#endif	/* HAVE_GLIB_GTHREAD */
+
 /* Read and write classic or chunked netcdf files */
 GMT_LOCAL int gmtnc_io_nc_grid (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header, unsigned dim[], unsigned origin[], size_t stride, unsigned io_mode, gmt_grdfloat* grid, bool cube) {
 	/* io_mode = k_get_netcdf: read a netcdf file to grid
@@ -189,6 +339,14 @@ GMT_LOCAL int gmtnc_io_nc_grid (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *he
 	imap[yx_dim[1]] = 1;                              /* distance between values in a row */
 	if (cube) imap[0] = header->nm;                   /* distance between values in a layer (?) */
 
+#ifdef _OPENMP
+	if (io_mode == k_get_netcdf && !cube && stride == 0 && (size_t)width * height_t >= NC_PARALLEL_MIN_CELLS) {
+		/* Big compressed grids inflate across a worker pool; failures quietly fall through to the serial path */
+		if (gmtnc_io_nc_grid_parallel (GMT, header, width, height, origin, grid) == NC_NOERR)
+			return NC_NOERR;
+	}
+#endif
+
 	/* determine how many chunks to process at once */
 	gmtnc_n_chunked_rows_in_cache (GMT, header, width, height, &n_contiguous_chunk_rows, chunksize);
 
@@ -1530,20 +1688,61 @@ GMT_LOCAL int gmtnc_grd_prep_io (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *h
 	return GMT_NOERROR;
 }
 
+void gmtlib_nc_release_cached (struct GMT_CTRL *GMT) {
+	/* Actually close the read-only handle kept open by gmt_nc_open, if any */
+	if (GMT->session.nc_cached_name == NULL) return;
+	GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Closing cached ncid %d for %s\n", GMT->session.nc_cached_id, GMT->session.nc_cached_name);
+	nc_close (GMT->session.nc_cached_id);
+	gmt_M_str_free (GMT->session.nc_cached_name);
+	GMT->session.nc_cached_id = GMT_NOTSET;
+	GMT->session.nc_cached_busy = false;
+}
+
 int gmt_nc_create (struct GMT_CTRL *GMT, char *path, int mode, int *id) {
-	int err = nc_create (path, mode, id);
+	int err;
+	if (GMT->session.nc_cached_name && !GMT->session.nc_cached_busy && !strcmp (path, GMT->session.nc_cached_name))
+		gmtlib_nc_release_cached (GMT);	/* About to replace this file; the stale read handle must go */
+	err = nc_create (path, mode, id);
 	GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Calling nc_create on %s, ncid = %d, err = %d\n", path, *id, err);
 	return (err);
 }
 
 int gmt_nc_open (struct GMT_CTRL *GMT, char *path, int mode, int *id) {
-	int err = nc_open (path, mode, id);	/* Open the file, return error code */
+	/* Open a netCDF file, reusing the handle we kept open if the same file is read again.
+	 * Reading one layer after another from a 3-D cube re-opens the file once per layer;
+	 * handing back the open handle skips nc_open's repeated header parse and lets the
+	 * HDF5 layer keep its chunk cache warm across the layer reads. */
+	int err;
+	if (mode == NC_NOWRITE && !GMT->session.nc_cached_busy && GMT->session.nc_cached_name && !strcmp (path, GMT->session.nc_cached_name)) {
+		*id = GMT->session.nc_cached_id;
+		GMT->session.nc_cached_busy = true;
+		GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Reusing open ncid = %d for %s\n", *id, path);
+		return NC_NOERR;
+	}
+	if (mode != NC_NOWRITE && GMT->session.nc_cached_name && !GMT->session.nc_cached_busy && !strcmp (path, GMT->session.nc_cached_name))
+		gmtlib_nc_release_cached (GMT);	/* About to write to this file; the stale read handle must go */
+	err = nc_open (path, mode, id);	/* Open the file, return error code */
 	GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Calling nc_open on %s, ncid = %d, err = %d\n", path, *id, err);
+	if (err == NC_NOERR && mode == NC_NOWRITE) {	/* Keep this read handle for potential reuse */
+		if (GMT->session.nc_cached_name && !GMT->session.nc_cached_busy)
+			gmtlib_nc_release_cached (GMT);	/* Evict the previous handle */
+		if (GMT->session.nc_cached_name == NULL) {	/* Slot is free (it is not if the old handle is still checked out) */
+			GMT->session.nc_cached_id = *id;
+			GMT->session.nc_cached_busy = true;
+			GMT->session.nc_cached_name = strdup (path);
+		}
+	}
 	return err;	/* Open the file, return error code */
 }
 
 int gmt_nc_close (struct GMT_CTRL *GMT, int id) {
-	int err = nc_close (id);
+	int err;
+	if (GMT->session.nc_cached_name && id == GMT->session.nc_cached_id) {	/* Keep the handle open in case this file is read again */
+		GMT->session.nc_cached_busy = false;
+		GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Keeping ncid %d open for reuse\n", id);
+		return NC_NOERR;
+	}
+	err = nc_close (id);
 	GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Calling nc_close on ncid %d, err = %d\n", id, err);
 	return err;
 }
@@ -1876,26 +2075,37 @@ int gmt_nc_write_grd (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header, gmt_
 	header->z_min = DBL_MAX;
 	header->z_max = -DBL_MAX;
 	adj_nan_value = !isnan (header->nan_value);
-	n = 0;
 	width_t  = (size_t)width;
 	height_t = (size_t)height;
 	nm = width_t * height_t;
-	while (n < nm) {
-		if (adj_nan_value && isnan (pgrid[n]))
-			pgrid[n] = header->nan_value;
-		else if (!isnan (pgrid[n])) {
-			if (do_round)
-				pgrid[n] = rintf (pgrid[n]); /* round to int */
-			header->z_min = MIN (header->z_min, pgrid[n]);
-			header->z_max = MAX (header->z_max, pgrid[n]);
-		}
-		n++;
-	}
-
-	/* Write grid */
 	dim[0]    = height,    dim[1]    = width;
 	origin[0] = first_row, origin[1] = first_col;
-	status = gmtnc_io_nc_grid (GMT, header, dim, origin, 0, k_put_netcdf, pgrid, false);
+
+#ifdef HAVE_GLIB_GTHREAD
+	if (nm >= NC_PIPELINE_MIN_CELLS && first_row == 0 && first_col == 0)
+		/* Big whole-grid writes overlap deflate with the conditioning pass below; ineligible files return NC_EINVAL */
+		status = gmtnc_write_grd_pipeline (GMT, header, width, height, pgrid, adj_nan_value, do_round);
+	else
+		status = NC_EINVAL;
+	if (status == NC_EINVAL)	/* Did not qualify for the pipelined write; condition and write serially */
+#endif
+	{
+		n = 0;
+		while (n < nm) {
+			if (adj_nan_value && isnan (pgrid[n]))
+				pgrid[n] = header->nan_value;
+			else if (!isnan (pgrid[n])) {
+				if (do_round)
+					pgrid[n] = rintf (pgrid[n]); /* round to int */
+				header->z_min = MIN (header->z_min, pgrid[n]);
+				header->z_max = MAX (header->z_max, pgrid[n]);
+			}
+			n++;
+		}
+
+		/* Write grid */
+		status = gmtnc_io_nc_grid (GMT, header, dim, origin, 0, k_put_netcdf, pgrid, false);
+	}
 	if (status != NC_NOERR)
 		goto nc_err;
 
@@ -9001,11 +9001,22 @@ struct PSL_CTRL *gmt_plotinit (struct GMT_CTRL *GMT, struct GMT_OPTION *options)
 			GMT->parent->error = GMT_ERROR_ON_FOPEN;
 			return NULL;
 		}
-		GMT_Report (GMT->parent, GMT_MSG_DEBUG, "%s hidden PS file %s\n", verb[k], GMT->current.ps.filename);
-		if ((fp = PSL_fopen (PSL, GMT->current.ps.filename, mode[k])) == NULL) {	/* Must open inside PSL DLL */
-			GMT_Report (GMT->parent, GMT_MSG_ERROR, "Cannot open %s with mode %s\n", GMT->current.ps.filename, mode[k]);
-			GMT->parent->error = GMT_ERROR_ON_FOPEN;
-			return NULL;
+		if (gmt_ps_memory_active (GMT->parent)) {	/* Session PS accumulates in a memory arena; no hidden file is touched */
+			struct GMT_PS_ARENA *A = gmt_ps_arena_get (GMT->parent, GMT->current.ps.figure, true);
+			write_to_mem = 2;	/* Instruct PSL_beginplot to write the PS to memory */
+			if (k) {	/* Overlay: hand the arena back to PSL so this layer appends to it */
+				PSL_setplot (PSL, A->buffer, A->n, A->n_alloc, A->pmode);
+				A->buffer = NULL;	A->n = A->n_alloc = 0;	/* PSL owns the bytes until gmt_plotend reclaims them */
+			}
+			GMT_Report (GMT->parent, GMT_MSG_DEBUG, "%s in-memory PS arena for figure %d\n", verb[k], GMT->current.ps.figure);
+		}
+		else {
+			GMT_Report (GMT->parent, GMT_MSG_DEBUG, "%s hidden PS file %s\n", verb[k], GMT->current.ps.filename);
+			if ((fp = PSL_fopen (PSL, GMT->current.ps.filename, mode[k])) == NULL) {	/* Must open inside PSL DLL */
+				GMT_Report (GMT->parent, GMT_MSG_ERROR, "Cannot open %s with mode %s\n", GMT->current.ps.filename, mode[k]);
+				GMT->parent->error = GMT_ERROR_ON_FOPEN;
+				return NULL;
+			}
 		}
 		O_active = (k) ? true : false;	/* -O is determined by presence or absence of hidden PS file */
 		/* Determine paper size */
@@ -9494,11 +9505,18 @@ int gmt_strip_layer (struct GMTAPI_CTRL *API, int nlayers) {
 	/* Get the name of the corresponding gmt.layers.<fig> file */
 	snprintf (file, PATH_MAX, "%s/gmt.layers.%d", API->gwf_dir, fig);
 	if (nlayers == GMT_NOTSET) {	/* Reset to nothing, but still remain at current figure */
+		struct GMT_PS_ARENA *A = NULL;
 		if (gmt_remove_file (API->GMT, file))	/* Remove the layers file */
 			GMT_Report (API, GMT_MSG_WARNING, "Failed to delete file: %s\n", file);
-		snprintf (file, PATH_MAX, "%s/gmt_%d.ps-", API->gwf_dir, fig);
-		if (gmt_remove_file (API->GMT, file))	/* Wipe the PS file */
-			GMT_Report (API, GMT_MSG_WARNING, "Failed to delete file: %s\n", file);
+		if ((A = gmt_ps_arena_get (API, fig, false))) {	/* Wipe the in-memory PS instead of any file */
+			gmt_M_str_free (A->buffer);
+			A->n = A->n_alloc = 0;	A->pmode = 0;
+		}
+		else {
+			snprintf (file, PATH_MAX, "%s/gmt_%d.ps-", API->gwf_dir, fig);
+			if (gmt_remove_file (API->GMT, file))	/* Wipe the PS file */
+				GMT_Report (API, GMT_MSG_WARNING, "Failed to delete file: %s\n", file);
+		}
 		return GMT_NOERROR;
 	}
 	/* See if there is a layers file to read for this figure */
@@ -9528,11 +9546,23 @@ int gmt_strip_layer (struct GMTAPI_CTRL *API, int nlayers) {
 		return GMT_RUNTIME_ERROR;
 	}
 
-	snprintf (file, PATH_MAX, "%s/gmt_%d.ps-", API->gwf_dir, fig);
-	if (gmt_truncate_file (API, file, layer[k-nlayers-1].size)) {
-		GMT_Report (API, GMT_MSG_ERROR, "Could not truncate file %s!\n", file);
-		gmt_M_free (API->GMT, layer);
-		return GMT_RUNTIME_ERROR;
+	if (gmt_ps_memory_active (API)) {	/* Truncate the in-memory PS arena instead of the hidden file */
+		struct GMT_PS_ARENA *A = gmt_ps_arena_get (API, fig, false);
+		if (A == NULL || layer[k-nlayers-1].size > A->n) {
+			GMT_Report (API, GMT_MSG_ERROR, "Could not truncate in-memory PS for figure %d!\n", fig);
+			gmt_M_free (API->GMT, layer);
+			return GMT_RUNTIME_ERROR;
+		}
+		A->n = layer[k-nlayers-1].size;
+		A->buffer[A->n] = '\0';
+	}
+	else {
+		snprintf (file, PATH_MAX, "%s/gmt_%d.ps-", API->gwf_dir, fig);
+		if (gmt_truncate_file (API, file, layer[k-nlayers-1].size)) {
+			GMT_Report (API, GMT_MSG_ERROR, "Could not truncate file %s!\n", file);
+			gmt_M_free (API->GMT, layer);
+			return GMT_RUNTIME_ERROR;
+		}
 	}
 	/* Finally, rewrite the layers file to skip the reverted layers */
 	snprintf (file, PATH_MAX, "%s/gmt.layers.%d", API->gwf_dir, fig);
@@ -9549,10 +9579,170 @@ int gmt_strip_layer (struct GMTAPI_CTRL *API, int nlayers) {
 	return GMT_NOERROR;
 }
 
+GMT_LOCAL size_t gmtplot_removed_below (size_t *cut_start, size_t *cut_stop, unsigned int n_cuts, size_t offset) {
+	/* Return how many of the removed PS bytes were located below the given original offset */
+	unsigned int i;
+	size_t removed = 0;
+	for (i = 0; i < n_cuts; i++) {
+		if (offset >= cut_stop[i]) removed += cut_stop[i] - cut_start[i];
+		else if (offset > cut_start[i]) removed += offset - cut_start[i];
+	}
+	return removed;
+}
+
+int gmt_strip_panel (struct GMTAPI_CTRL *API, int fig, int row, int col) {
+	/* Cut all PS belonging to the given subplot panel out of the current figure's half-baked
+	 * PS so that just this panel can be redrawn while every other panel's PS is reused as is.
+	 * We rely on the per-panel offsets recorded in gmt.panelranges.<fig> by gmt_set_current_panel;
+	 * since panels plot via absolute -Xa/-Ya origins their PS slices are position-independent
+	 * and can be removed without affecting the remaining layers.  The panel-range and layer
+	 * bookkeeping files are rewritten with offsets shifted accordingly. */
+	char file[PATH_MAX] = {""}, buffer[GMT_LEN64] = {""}, *ps = NULL;
+	int k = 0, j;
+	unsigned int n_cuts = 0;
+	size_t n_alloc = GMT_SMALL_CHUNK, ps_size, new_size, shift;
+	size_t *cut_start = NULL, *cut_stop = NULL;
+	FILE *fp = NULL;
+	struct GMT_PSRANGE {	/* Used to hold the panel range info locally */
+		int row, col;
+		size_t start, stop;
+	} *range = NULL;
+	struct GMT_PS_ARENA *A = NULL;
+
+	/* See if there is a panel-ranges file to read for this figure */
+	snprintf (file, PATH_MAX, "%s/gmt.panelranges.%d", API->gwf_dir, fig);
+	if (access (file, R_OK)) return GMT_NOERROR;	/* Nothing plotted to any panel yet, so nothing to strip */
+	if ((fp = fopen (file, "r")) == NULL) {
+		GMT_Report (API, GMT_MSG_ERROR, "Could not open file %s\n", file);
+		return GMT_ERROR_ON_FOPEN;
+	}
+	/* Ingest the panel range information */
+	range = gmt_M_memory (API->GMT, NULL, n_alloc, struct GMT_PSRANGE);
+	while (fgets (buffer, GMT_LEN64, fp)) {
+		sscanf (buffer, "%d %d %" PRIuS, &range[k].row, &range[k].col, &range[k].start);
+		if (++k == (int)n_alloc) {	/* Need more memory */
+			n_alloc <<= 1;
+			range = gmt_M_memory (API->GMT, range, n_alloc, struct GMT_PSRANGE);
+		}
+	}
+	fclose (fp);
+	ps_size = gmt_ps_current_size (API, fig);
+	for (j = 0; j < k; j++)	/* Each slice ends where the next one starts; the last runs to the current end of PS */
+		range[j].stop = (j < k-1) ? range[j+1].start : ps_size;
+	cut_start = gmt_M_memory (API->GMT, NULL, k, size_t);
+	cut_stop  = gmt_M_memory (API->GMT, NULL, k, size_t);
+	for (j = 0; j < k; j++) {	/* Find the slices belonging to this panel */
+		if (range[j].row != row || range[j].col != col) continue;
+		if (range[j].stop > range[j].start) {
+			cut_start[n_cuts] = range[j].start;
+			cut_stop[n_cuts] = range[j].stop;
+			n_cuts++;
+		}
+	}
+	if (n_cuts == 0) {	/* Panel was never plotted (or left no PS) so nothing to do */
+		gmt_M_free (API->GMT, range);	gmt_M_free (API->GMT, cut_start);	gmt_M_free (API->GMT, cut_stop);
+		return GMT_NOERROR;
+	}
+
+	/* Get hold of the PS bytes: either the in-memory arena or the hidden file read into memory */
+	if ((A = gmt_ps_arena_get (API, fig, false)))
+		ps = A->buffer;
+	else {
+		snprintf (file, PATH_MAX, "%s/gmt_%d.ps-", API->gwf_dir, fig);
+		if ((fp = fopen (file, "rb")) == NULL) {
+			GMT_Report (API, GMT_MSG_ERROR, "Could not open file %s\n", file);
+			gmt_M_free (API->GMT, range);	gmt_M_free (API->GMT, cut_start);	gmt_M_free (API->GMT, cut_stop);
+			return GMT_ERROR_ON_FOPEN;
+		}
+		ps = gmt_M_memory (API->GMT, NULL, ps_size, char);
+		if (fread (ps, 1U, ps_size, fp) != ps_size) {
+			GMT_Report (API, GMT_MSG_ERROR, "Could not read %s\n", file);
+			fclose (fp);	gmt_M_free (API->GMT, ps);
+			gmt_M_free (API->GMT, range);	gmt_M_free (API->GMT, cut_start);	gmt_M_free (API->GMT, cut_stop);
+			return GMT_RUNTIME_ERROR;
+		}
+		fclose (fp);
+	}
+
+	/* Splice out the slices from the end so earlier offsets remain valid while we work */
+	new_size = ps_size;
+	for (j = (int)n_cuts - 1; j >= 0; j--) {
+		memmove (&ps[cut_start[j]], &ps[cut_stop[j]], new_size - cut_stop[j]);
+		new_size -= (cut_stop[j] - cut_start[j]);
+	}
+	GMT_Report (API, GMT_MSG_DEBUG, "Stripped %" PRIuS " bytes of PS for panel (%d, %d) from figure %d\n", ps_size - new_size, row, col, fig);
+
+	if (A) {	/* Just shrink the arena */
+		A->n = new_size;
+		A->buffer[A->n] = '\0';
+	}
+	else {	/* Rewrite the hidden PS file */
+		if ((fp = fopen (file, "wb")) == NULL) {
+			GMT_Report (API, GMT_MSG_ERROR, "Could not rewrite file %s\n", file);
+			gmt_M_free (API->GMT, ps);
+			gmt_M_free (API->GMT, range);	gmt_M_free (API->GMT, cut_start);	gmt_M_free (API->GMT, cut_stop);
+			return GMT_RUNTIME_ERROR;
+		}
+		if (fwrite (ps, 1U, new_size, fp) != new_size) {
+			GMT_Report (API, GMT_MSG_ERROR, "Could not write %s\n", file);
+			fclose (fp);	gmt_M_free (API->GMT, ps);
+			gmt_M_free (API->GMT, range);	gmt_M_free (API->GMT, cut_start);	gmt_M_free (API->GMT, cut_stop);
+			return GMT_RUNTIME_ERROR;
+		}
+		fclose (fp);
+		gmt_M_free (API->GMT, ps);
+	}
+
+	/* Rewrite the panel-ranges file without this panel and with shifted offsets */
+	snprintf (file, PATH_MAX, "%s/gmt.panelranges.%d", API->gwf_dir, fig);
+	if ((fp = fopen (file, "w")) == NULL) {
+		GMT_Report (API, GMT_MSG_ERROR, "Could not create new file %s\n", file);
+		gmt_M_free (API->GMT, range);	gmt_M_free (API->GMT, cut_start);	gmt_M_free (API->GMT, cut_stop);
+		return GMT_ERROR_ON_FOPEN;
+	}
+	for (j = 0; j < k; j++) {
+		if (range[j].row == row && range[j].col == col) continue;	/* Dropped */
+		fprintf (fp, "%d %d %" PRIuS "\n", range[j].row, range[j].col,
+		         range[j].start - gmtplot_removed_below (cut_start, cut_stop, n_cuts, range[j].start));
+	}
+	fclose (fp);
+
+	/* Shift the per-layer sizes in gmt.layers.<fig> so revert keeps working on the spliced PS */
+	snprintf (file, PATH_MAX, "%s/gmt.layers.%d", API->gwf_dir, fig);
+	if (!access (file, R_OK) && (fp = fopen (file, "r"))) {
+		int id, n = 0;
+		size_t size, m_alloc = GMT_SMALL_CHUNK;
+		struct GMT_PSLAYER {	/* Used to hold the layer info locally */
+			unsigned int id;
+			size_t size;
+		} *layer = gmt_M_memory (API->GMT, NULL, m_alloc, struct GMT_PSLAYER);
+		while (fgets (buffer, GMT_LEN64, fp)) {
+			sscanf (buffer, "%d %" PRIuS, &id, &size);
+			layer[n].id = id;
+			layer[n].size = size - gmtplot_removed_below (cut_start, cut_stop, n_cuts, size);
+			if (++n == (int)m_alloc) {	/* Need more memory */
+				m_alloc <<= 1;
+				layer = gmt_M_memory (API->GMT, layer, m_alloc, struct GMT_PSLAYER);
+			}
+		}
+		fclose (fp);
+		if ((fp = fopen (file, "w"))) {
+			for (j = 0; j < n; j++)
+				fprintf (fp, "%d %" PRIuS "\n", layer[j].id, layer[j].size);
+			fclose (fp);
+		}
+		gmt_M_free (API->GMT, layer);
+	}
+
+	gmt_M_free (API->GMT, range);	gmt_M_free (API->GMT, cut_start);	gmt_M_free (API->GMT, cut_stop);
+	return GMT_NOERROR;
+}
+
 void gmt_plotend (struct GMT_CTRL *GMT) {
 	unsigned int i;
 	bool K_active = (GMT->current.setting.run_mode == GMT_MODERN) ? true : GMT->common.K.active;
 	struct PSL_CTRL *PSL= GMT->PSL;
+	gmt_M_tic (GMT, GMT_TIMING_PSL);
 	PSL_endlayer (GMT->PSL);
 	if (GMT->common.t.active) PSL_command (PSL, "1 1 /Normal PSL_transp\n"); /* Reset transparency to fully opaque, if required */
 
@@ -9598,19 +9788,29 @@ void gmt_plotend (struct GMT_CTRL *GMT) {
 		struct stat buf;
 		char file[PATH_MAX] = {""};
 		FILE *fp = NULL;
-		if (stat (GMT->current.ps.filename, &buf))
+		size_t ps_size = 0;
+		if (PSL->internal.memory) {	/* Session PS lives in a memory arena; reclaim the buffer from PSL */
+			struct GMT_PS_ARENA *A = gmt_ps_arena_get (GMT->parent, GMT->current.ps.figure, true);
+			A->buffer = PSL_detachplot (PSL, &A->n, &A->n_alloc, &A->pmode);
+			ps_size = A->n;
+			GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Current size of half-baked PS arena for figure %d = %" PRIuS ".\n", GMT->current.ps.figure, ps_size);
+		}
+		else if (stat (GMT->current.ps.filename, &buf))
 			GMT_Report (GMT->parent, GMT_MSG_WARNING, "Could not determine size of file %s\n", GMT->current.ps.filename);
-		else
-			GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Current size of half-baked PS file %s = %" PRIuS ".\n", GMT->current.ps.filename, buf.st_size);
+		else {
+			ps_size = (size_t)buf.st_size;
+			GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Current size of half-baked PS file %s = %" PRIuS ".\n", GMT->current.ps.filename, ps_size);
+		}
 		GMT->current.ps.fp = NULL;
 		GMT->current.ps.filename[0] = '\0';
 		/* Write layer size to gmt.layers.<fig> in case of revert calls */
 		snprintf (file, PATH_MAX, "%s/gmt.layers.%d", GMT->parent->gwf_dir, GMT->current.ps.figure);
 		if ((fp = fopen (file, "a")) == NULL) {
 			GMT_Report (GMT->parent, GMT_MSG_ERROR, "Could not open/create file %s\n", file);
+			gmt_M_toc (GMT, GMT_TIMING_PSL);
 			return;
 		}
-		fprintf (fp, "%d\t%" PRIuS "\n", GMT->current.ps.layer, (size_t)buf.st_size);
+		fprintf (fp, "%d\t%" PRIuS "\n", GMT->current.ps.layer, ps_size);
 		fclose (fp);
 	}
 	else if (PSL->internal.memory) {    /* Time to write out buffer regardless of mode */
@@ -9634,6 +9834,7 @@ void gmt_plotend (struct GMT_CTRL *GMT) {
 	if (GMT->current.ps.oneliner) GMT->current.ps.active = true;	/* Since we are plotting we reset this here in case other modules have turned it off */
 
 	if (!K_active) GMT->current.plot.gridline_spacing[GMT_X] = GMT->current.plot.gridline_spacing[GMT_Y] = 0.0;	/* Done, if they ever were used */
+	gmt_M_toc (GMT, GMT_TIMING_PSL);
 #if 0
 	if (GMT->current.setting.run_mode == GMT_CLASSIC) {	/* Remove any gridline file we may have made in /tmp */
 		char file[PATH_MAX] = {""};
@@ -10558,6 +10759,56 @@ void gmt_plane_perspective (struct GMT_CTRL *GMT, int plane, double level) {
 
 /* Creation of hidden PS0 filename used under modern GMT mode */
 
+/*! . */
+bool gmt_ps_memory_active (struct GMTAPI_CTRL *API) {
+	/* Return true if this modern mode session keeps its PostScript in per-figure memory arenas
+	 * instead of the hidden gmt_#.ps- files.  Since the buffers cannot outlive the one-shot
+	 * processes of command-line modern mode this requires a persistent (external) session;
+	 * within one, users opt in by setting GMT_PS_MEMORY in the environment (to anything but off). */
+	char *env = NULL;
+	if (!API->external) return false;	/* Each CLI module runs in its own process so memory cannot carry over */
+	if (API->gwf_dir == NULL) return false;	/* Not in a workflow */
+	if ((env = getenv ("GMT_PS_MEMORY")) == NULL) return false;
+	return (strcmp (env, "off") != 0);
+}
+
+/*! . */
+struct GMT_PS_ARENA * gmt_ps_arena_get (struct GMTAPI_CTRL *API, int fig, bool create) {
+	/* Return pointer to the in-memory PostScript arena for this figure, optionally creating an empty one.
+	 * Note: The returned pointer is only valid until the next arena is created. */
+	unsigned int k;
+	for (k = 0; k < API->n_ps_arena; k++)
+		if (API->ps_arena[k].fig == fig) return (&API->ps_arena[k]);
+	if (!create) return NULL;
+	API->ps_arena = gmt_M_memory (API->GMT, API->ps_arena, API->n_ps_arena + 1, struct GMT_PS_ARENA);
+	gmt_M_memset (&API->ps_arena[API->n_ps_arena], 1, struct GMT_PS_ARENA);
+	API->ps_arena[API->n_ps_arena].fig = fig;
+	return (&API->ps_arena[API->n_ps_arena++]);
+}
+
+/*! . */
+size_t gmt_ps_current_size (struct GMTAPI_CTRL *API, int fig) {
+	/* Return the current length in bytes of this figure's half-baked PostScript,
+	 * whether it lives in a memory arena or in the hidden gmt_#.ps- file. */
+	char file[PATH_MAX] = {""};
+	struct stat buf;
+	struct GMT_PS_ARENA *A = NULL;
+	if ((A = gmt_ps_arena_get (API, fig, false))) return (A->n);
+	snprintf (file, PATH_MAX, "%s/gmt_%d.ps-", API->gwf_dir, fig);
+	if (stat (file, &buf)) return 0;	/* No PS yet */
+	return ((size_t)buf.st_size);
+}
+
+/*! . */
+void gmt_free_ps_arenas (struct GMTAPI_CTRL *API) {
+	/* Release any in-memory PostScript held by the session [called at end of workflow or session] */
+	unsigned int k;
+	for (k = 0; k < API->n_ps_arena; k++)
+		gmt_M_str_free (API->ps_arena[k].buffer);	/* Buffers were allocated by PSL via malloc/realloc */
+	gmt_M_free (API->GMT, API->ps_arena);
+	API->n_ps_arena = 0;
+}
+
 /*! . */
 int gmt_set_psfilename (struct GMT_CTRL *GMT) {
 	int k;
@@ -10571,7 +10822,12 @@ int gmt_set_psfilename (struct GMT_CTRL *GMT) {
 	else
 		snprintf (GMT->current.ps.filename, GMT_LEN256, "%s/gmt_%d.ps-", GMT->parent->gwf_dir, GMT->current.ps.figure);
 	GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Use PS filename %s\n", GMT->current.ps.filename);
-	k = 1 + access (GMT->current.ps.filename, W_OK);	/* 1 = File exists (must append) or 0 (must create) */
+	if (gmt_ps_memory_active (GMT->parent)) {	/* PS accumulates in a memory arena so overlay status comes from it, not the file */
+		struct GMT_PS_ARENA *A = gmt_ps_arena_get (GMT->parent, GMT->current.ps.figure, false);
+		k = (A && A->n) ? 1 : 0;	/* 1 = Arena has content (must append) or 0 (must create) */
+	}
+	else
+		k = 1 + access (GMT->current.ps.filename, W_OK);	/* 1 = File exists (must append) or 0 (must create) */
 	GMT->current.ps.initialize = (k == 0);	/* False means it is an overlay and -R -J may come from history */
 	return k;
 }
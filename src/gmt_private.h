@@ -124,6 +124,14 @@ struct API_META {	/* Items related to passing or not passing certain meta data f
 	bool ignore_remote_cpt;			/* true if we should not store the remote CPT associated with the origin of this grid */
 };
 
+struct GMT_PS_ARENA {	/* In-memory modern mode PostScript for one figure [activated via GMT_PS_MEMORY in persistent sessions] */
+	int fig;		/* Figure ID this PostScript belongs to */
+	int pmode;		/* Plot mode: 1 = half-baked (header only), 3 = complete plot with trailer */
+	size_t n;		/* Length of PostScript currently in buffer */
+	size_t n_alloc;		/* Allocated length of buffer */
+	char *buffer;		/* The PostScript, or NULL while the bytes are lent to PSL */
+};
+
 struct GMT_JULIA_POCKET {
 	/* Hold some variables stored in the API struct that may be needed to be known in GMT.jl
 	   Ideally one would wrap the GMTAPI_CTRL struct but this gal is huge and there is no contract
@@ -172,6 +180,10 @@ struct GMTAPI_CTRL {
 	int error;				/* Error code from latest API call [GMT_OK] */
 	int last_error;				/* Error code from previous API call [GMT_OK] */
 	int shelf;				/* Place to pass hidden values within API */
+	volatile int cancel;			/* Set via GMT_Cancel_Module (e.g., from another thread) to ask the running module to stop */
+	volatile double progress;		/* Fraction completed [0-1] published by long-running modules for GMT_Get_Progress pollers */
+	struct GMT_PS_ARENA *ps_arena;	/* Per-figure in-memory PostScript under modern mode [NULL unless GMT_PS_MEMORY is in effect] */
+	unsigned int n_ps_arena;		/* Number of such arenas in use */
 	unsigned int log_level;			/* 0 = stderr, 1 = just this module, 2 = set until unset */
 	unsigned int io_mode[2];		/* 1 if access as set, 0 if record-by-record */
 	double tile_wesn[GMTAPI_N_GRID_ARGS];	/* Original region used when getting tiles (perhaps result of -Roblique -J) */
@@ -1436,6 +1436,60 @@ GMT_LOCAL void gmtproj_ilambeq (struct GMT_CTRL *GMT, double *lon, double *lat,
 	if (GMT->current.proj.GMT_convert_latitudes) *lat = gmt_M_lata_to_latg (GMT, *lat);
 }
 
+GMT_LOCAL void gmtproj_plambeq (struct GMT_CTRL *GMT, double lon, double lat, double *x, double *y) {
+	/* Convert lon/lat to Spherical Lambert Azimuthal Equal-Area x/y for the polar aspect.
+	 * With the pole at the projection center rho only depends on latitude, so we need
+	 * a single sincosd per point instead of the two in the oblique formula. */
+	double rho, slon, clon;
+
+	if (GMT->current.proj.GMT_convert_latitudes) lat = gmt_M_latg_to_lata (GMT, lat);
+	gmt_M_wind_lon (GMT, lon)	/* Remove central meridian and place lon in -180/+180 range */
+
+	sincosd (lon, &slon, &clon);
+	if (GMT->current.proj.north_pole) {
+		rho = 2.0 * GMT->current.proj.EQ_RAD * sind (45.0 - 0.5 * lat);
+		*y = -rho * clon;
+		*x =  rho * slon;
+	}
+	else {
+		rho = 2.0 * GMT->current.proj.EQ_RAD * sind (45.0 + 0.5 * lat);
+		*y = rho * clon;
+		*x = rho * slon;
+	}
+	if (GMT->current.proj.GMT_convert_latitudes) {	/* Gotta fudge abit */
+		(*x) *= GMT->current.proj.Dx;
+		(*y) *= GMT->current.proj.Dy;
+	}
+}
+
+GMT_LOCAL void gmtproj_iplambeq (struct GMT_CTRL *GMT, double *lon, double *lat, double x, double y) {
+	/* Convert Lambert Azimuthal Equal-Area x/y to lon/lat for the polar aspect */
+	double rho, a, cos_c;
+
+	if (GMT->current.proj.GMT_convert_latitudes) {	/* Undo effect of fudge factors */
+		x *= GMT->current.proj.iDx;
+		y *= GMT->current.proj.iDy;
+	}
+
+	rho = hypot (x, y);
+	if (rho > GMT->current.proj.rho_max) {			/* Horizon		*/
+		*lat = *lon = GMT->session.d_NaN;
+		return;
+	}
+	a = 0.5 * rho * GMT->current.proj.i_EQ_RAD;			/* a = sin(c/2)		*/
+	a *= a;							/* a = sin(c/2)**2	*/
+	cos_c = 1.0 - 2.0 * a;					/* cos_c = cos(c)	*/
+	if (GMT->current.proj.north_pole) {
+		*lat = d_asind (cos_c);
+		*lon = GMT->current.proj.central_meridian + d_atan2d (x, -y);
+	}
+	else {
+		*lat = d_asind (-cos_c);
+		*lon = GMT->current.proj.central_meridian + d_atan2d (x, y);
+	}
+	if (GMT->current.proj.GMT_convert_latitudes) *lat = gmt_M_lata_to_latg (GMT, *lat);
+}
+
 /* -JG GENERAL PERSPECTIVE PROJECTION */
 
 /* Set up General Perspective projection */
@@ -2047,6 +2101,47 @@ GMT_LOCAL void gmtproj_iazeqdist (struct GMT_CTRL *GMT, double *lon, double *lat
 	*lon = d_atan2d (x * sin_c, cos_c * GMT->current.proj.cosp - y * sin_c * GMT->current.proj.sinp) + GMT->current.proj.central_meridian;
 }
 
+GMT_LOCAL void gmtproj_pazeqdist (struct GMT_CTRL *GMT, double lon, double lat, double *x, double *y) {
+	/* Convert lon/lat to azimuthal equidistant x/y for the polar aspect.
+	 * Here rho is simply the radius times the colatitude in radians, so the
+	 * acos/sin of the oblique formula drop out and one sincosd per point remains. */
+	double rho, colat, slon, clon;
+
+	gmt_M_wind_lon (GMT, lon)	/* Remove central meridian and place lon in -180/+180 range */
+
+	colat = (GMT->current.proj.north_pole) ? 90.0 - lat : 90.0 + lat;
+	if (colat >= 180.0) {	/* Antipode is a circle, so flag x,y as NaN */
+		*x = *y = GMT->session.d_NaN;
+		GMT->current.proj.n_antipoles++;
+		return;
+	}
+	sincosd (lon, &slon, &clon);
+	rho = GMT->current.proj.EQ_RAD * colat * D2R;
+	*x = rho * slon;
+	*y = (GMT->current.proj.north_pole) ? -rho * clon : rho * clon;
+}
+
+GMT_LOCAL void gmtproj_ipazeqdist (struct GMT_CTRL *GMT, double *lon, double *lat, double x, double y) {
+	/* Convert azimuthal equidistant x/y to lon/lat for the polar aspect */
+	double rho;
+
+	x *= GMT->current.proj.i_EQ_RAD;
+	y *= GMT->current.proj.i_EQ_RAD;
+	rho = hypot (x, y);
+	if (rho > GMT->current.proj.rho_max) {	/* Horizon */
+		*lat = *lon = GMT->session.d_NaN;
+		return;
+	}
+	if (GMT->current.proj.north_pole) {
+		*lat = 90.0 - rho * R2D;
+		*lon = GMT->current.proj.central_meridian + d_atan2d (x, -y);
+	}
+	else {
+		*lat = rho * R2D - 90.0;
+		*lon = GMT->current.proj.central_meridian + d_atan2d (x, y);
+	}
+}
+
 /* -JW MOLLWEIDE EQUAL AREA PROJECTION */
 
 GMT_LOCAL void gmtproj_vmollweide (struct GMT_CTRL *GMT, double lon0, double scale) {
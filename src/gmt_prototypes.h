@@ -171,6 +171,8 @@ EXTERN_MSC void gmt_setmode (struct GMT_CTRL *GMT, int direction);
 /* gmt_bcr.c: */
 EXTERN_MSC double gmt_bcr_get_z (struct GMT_CTRL *GMT, struct GMT_GRID *G, double xx, double yy);		/* Compute z(x,y) from bcr structure and grid */
 EXTERN_MSC double gmt_bcr_get_z_fast (struct GMT_CTRL *GMT, struct GMT_GRID *G, double xx, double yy);		/* Same but without region and nan checks */
+EXTERN_MSC void gmt_bcr_get_z_row (struct GMT_CTRL *GMT, struct GMT_GRID *G, double yy, unsigned int n, int *col, double *wx, gmt_grdfloat *z);	/* Evaluate one output row via precomputed x-stencils */
+EXTERN_MSC unsigned int gmt_bcr_prep_cols (struct GMT_CTRL *GMT, struct GMT_GRID *G, double *xx, unsigned int n, int *col, double *wx);	/* Precompute stencil columns and x-weights */
 EXTERN_MSC int gmt_parse_j_option (struct GMT_CTRL *GMT, char *arg);
 
 /* gmt_customio.c: */
@@ -257,11 +259,20 @@ EXTERN_MSC void gmt_grd_pad_on (struct GMT_CTRL *GMT, struct GMT_GRID *G, unsign
 EXTERN_MSC void gmt_grd_pad_off (struct GMT_CTRL *GMT, struct GMT_GRID *G);
 EXTERN_MSC void gmt_cube_pad_off (struct GMT_CTRL *GMT, struct GMT_CUBE *U);
 EXTERN_MSC void gmt_grd_pad_zero (struct GMT_CTRL *GMT, struct GMT_GRID *G);
+EXTERN_MSC void gmt_grd_dirty (struct GMT_GRID *G);
+EXTERN_MSC uint64_t gmt_grd_reduce (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *h, gmt_grdfloat *z, double *z_min, double *z_max, double *z_sum, double *z_sum2);
+EXTERN_MSC struct GMT_GRID_SKETCH *gmt_grd_sketch (struct GMT_CTRL *GMT, struct GMT_GRID *G);
+EXTERN_MSC double gmt_grd_sketch_cdf (struct GMT_CTRL *GMT, struct GMT_GRID_SKETCH *S, double z);
+EXTERN_MSC double gmt_grd_sketch_quantile (struct GMT_CTRL *GMT, struct GMT_GRID_SKETCH *S, double q);
 EXTERN_MSC void gmt_grd_zminmax (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *h, gmt_grdfloat *z);
 EXTERN_MSC void gmt_cube_vminmax (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *h, gmt_grdfloat *w);
 EXTERN_MSC int gmt_adjust_loose_wesn (struct GMT_CTRL *GMT, double wesn[], struct GMT_GRID_HEADER *header);
 EXTERN_MSC int gmt_grd_setregion (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *h, double *wesn, unsigned int interpolant);
 EXTERN_MSC int gmt_grd_RI_verify (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *h, unsigned int mode);
+EXTERN_MSC int gmt_grd_row_pipeline (struct GMT_CTRL *GMT, char *infile, char *outfile, struct GMT_OPTION *options, void (*op) (struct GMT_CTRL *, gmt_grdfloat *, unsigned int, unsigned int, void *), void *arg);
+EXTERN_MSC struct GMT_GRID * gmt_grd_halve (struct GMT_CTRL *GMT, struct GMT_GRID *P);
+EXTERN_MSC void gmt_grd_pyramid_name (struct GMT_CTRL *GMT, const char *file, unsigned int factor, char *name);
+EXTERN_MSC char * gmt_grd_pyramid_select (struct GMT_CTRL *GMT, const char *file, double file_inc[], double inc[]);
 EXTERN_MSC void gmt_increment_adjust (struct GMT_CTRL *GMT, double *wesn, double *inc, enum GMT_enum_reg registration);
 EXTERN_MSC int gmt_read_img (struct GMT_CTRL *GMT, char *imgfile, struct GMT_GRID *G, double *wesn, double scale, unsigned int mode, double lat, bool init);
 EXTERN_MSC bool gmt_grd_pad_status (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header, unsigned int *pad);
@@ -324,6 +335,11 @@ EXTERN_MSC void gmt_plotend (struct GMT_CTRL *GMT);
 EXTERN_MSC struct PSL_CTRL * gmt_plotinit (struct GMT_CTRL *GMT, struct GMT_OPTION *options);
 EXTERN_MSC uint64_t gmt_geo_polarcap_segment (struct GMT_CTRL *GMT, struct GMT_DATASEGMENT *S, double **lon, double **lat);
 EXTERN_MSC int gmt_set_psfilename (struct GMT_CTRL *GMT);
+EXTERN_MSC bool gmt_ps_memory_active (struct GMTAPI_CTRL *API);
+EXTERN_MSC struct GMT_PS_ARENA * gmt_ps_arena_get (struct GMTAPI_CTRL *API, int fig, bool create);
+EXTERN_MSC void gmt_free_ps_arenas (struct GMTAPI_CTRL *API);
+EXTERN_MSC size_t gmt_ps_current_size (struct GMTAPI_CTRL *API, int fig);
+EXTERN_MSC int gmt_strip_panel (struct GMTAPI_CTRL *API, int fig, int row, int col);
 
 #endif /* _POSTSCRIPTLIGHT_H */
 
@@ -604,12 +620,16 @@ EXTERN_MSC char * gmt_make_filename (struct GMT_CTRL *GMT, char *template, unsig
 EXTERN_MSC void gmt_str_setcase (struct GMT_CTRL *GMT, char *value, int mode);
 EXTERN_MSC char * gmt_putusername (struct GMT_CTRL *GMT);
 EXTERN_MSC openmp_int * gmt_prep_nodesearch (struct GMT_CTRL *GMT, struct GMT_GRID *G, double radius, unsigned int mode, openmp_int *d_row, openmp_int *actual_max_d_col);
+EXTERN_MSC struct GMT_POINT_BIN * gmt_point_bin_create (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *h, const double *x, const double *y, uint64_t n, openmp_int halo_row, openmp_int halo_col);
+EXTERN_MSC void gmt_point_bin_free (struct GMT_CTRL *GMT, struct GMT_POINT_BIN **B);
 EXTERN_MSC struct GMT_PALETTE * gmt_get_palette (struct GMT_CTRL *GMT, char *file, enum GMT_enum_cpt mode, double zmin, double zmax, double dz);
 EXTERN_MSC unsigned int gmt_gcd_euclid (unsigned int a, unsigned int b);
 EXTERN_MSC unsigned int gmt_optimal_dim_for_surface (struct GMT_CTRL *GMT, unsigned int factors[], unsigned int n_columns, unsigned int n_rows, struct GMT_SURFACE_SUGGESTION **S);
 EXTERN_MSC int gmt_best_dim_choice (struct GMT_CTRL *GMT, unsigned int mode, unsigned int in_dim[], unsigned int out_dim[]);
 EXTERN_MSC void gmt_sprintf_float (struct GMT_CTRL *GMT, char *string, char *format, double x);
 EXTERN_MSC void gmt_enable_threads (struct GMT_CTRL *GMT);
+EXTERN_MSC int gmt_thread_pool_submit (struct GMT_CTRL *GMT, void (*func) (void *), void *arg);
+EXTERN_MSC void gmt_thread_pool_wait (struct GMT_CTRL *GMT);
 EXTERN_MSC unsigned int gmt_validate_modifiers (struct GMT_CTRL *GMT, const char *string, const char option, const char *valid_modifiers, unsigned int verbosity);
 EXTERN_MSC double gmt_pol_area (double x[], double y[], uint64_t n);
 EXTERN_MSC void gmt_adjust_refpoint (struct GMT_CTRL *GMT, struct GMT_REFPOINT *ref, double dim[], double off[], int justify, int anchor);
@@ -642,6 +662,9 @@ EXTERN_MSC bool gmt_cart_outside (struct GMT_CTRL *GMT, double x, double y);
 EXTERN_MSC void gmt_auto_frame_interval (struct GMT_CTRL *GMT, unsigned int axis, unsigned int item);
 EXTERN_MSC double gmt_az_backaz (struct GMT_CTRL *GMT, double lonE, double latE, double lonS, double latS, bool baz);
 EXTERN_MSC double gmt_distance (struct GMT_CTRL *GMT, double lonS, double latS, double lonE, double latE);
+EXTERN_MSC void gmt_distance_from_prep (struct GMT_CTRL *GMT, double lon0, double lat0, struct GMT_DIST_FROM *D);
+EXTERN_MSC double gmt_distance_from (struct GMT_CTRL *GMT, struct GMT_DIST_FROM *D, double lon, double lat);
+EXTERN_MSC bool gmt_distance_exceeds (struct GMT_CTRL *GMT, double lonS, double latS, double lonE, double latE, double limit);
 EXTERN_MSC double gmt_azim_to_angle (struct GMT_CTRL *GMT, double lon, double lat, double c, double azim);
 EXTERN_MSC uint64_t gmt_clip_to_map (struct GMT_CTRL *GMT, double *lon, double *lat, uint64_t np, double **x, double **y);
 EXTERN_MSC uint64_t gmt_compact_line (struct GMT_CTRL *GMT, double *x, double *y, uint64_t n, int pen_flag, int *pen);
@@ -653,6 +676,7 @@ EXTERN_MSC int gmt_img_project (struct GMT_CTRL *GMT, struct GMT_IMAGE *I, struc
 EXTERN_MSC uint64_t gmt_map_clip_path (struct GMT_CTRL *GMT, double **x, double **y, bool *donut);
 EXTERN_MSC bool gmt_map_outside (struct GMT_CTRL *GMT, double lon, double lat);
 EXTERN_MSC bool gmt_geo_to_xy (struct GMT_CTRL *GMT, double lon, double lat, double *x, double *y);
+EXTERN_MSC void gmt_geo_to_xy_batch (struct GMT_CTRL *GMT, double *lon, double *lat, double *x, double *y, uint64_t n);
 EXTERN_MSC bool gmt_geo_to_xy_noshift (struct GMT_CTRL *GMT, double lon, double lat, double *x, double *y);
 EXTERN_MSC bool gmt_geo_to_xy_noshiftscale (struct GMT_CTRL *GMT, double lon, double lat, double *x, double *y);
 EXTERN_MSC void gmt_geoz_to_xy (struct GMT_CTRL *GMT, double x, double y, double z, double *x_out, double *y_out);
@@ -715,12 +739,14 @@ EXTERN_MSC void gmt_free_macros (struct GMT_CTRL *GMT, unsigned int n_macros, st
 EXTERN_MSC char * gmt_cpt_default (struct GMTAPI_CTRL *API, char *cpt, char *file, struct GMT_GRID_HEADER *h);
 EXTERN_MSC void gmt_sort_array (struct GMT_CTRL *GMT, void *base, uint64_t n, unsigned int type);
 EXTERN_MSC bool gmt_polygon_is_open (struct GMT_CTRL *GMT, double x[], double y[], uint64_t n);
+EXTERN_MSC void gmt_dp_tolerance_tree (struct GMT_CTRL *GMT, double x_source[], double y_source[], uint64_t n_source, bool geo, double tol[]);
 EXTERN_MSC int gmt_polygon_centroid (struct GMT_CTRL *GMT, double *x, double *y, uint64_t n, double *Cx, double *Cy);
 EXTERN_MSC int gmt_get_distance (struct GMT_CTRL *GMT, char *line, double *dist, char *unit);
 EXTERN_MSC unsigned int *gmt_contour_edge_init (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *header, unsigned int *n_edges);
 EXTERN_MSC int64_t gmt_contours (struct GMT_CTRL *GMT, struct GMT_GRID *Grid, unsigned int smooth_factor, unsigned int int_scheme, int orient, unsigned int *edge, bool *first, double **x, double **y);
 EXTERN_MSC int gmt_get_format (struct GMT_CTRL *GMT, double interval, char *unit, char *prefix, char *format);
 EXTERN_MSC int gmt_get_index (struct GMT_CTRL *GMT, struct GMT_PALETTE *P, double *value);
+EXTERN_MSC void gmt_cpt_prep_index (struct GMT_CTRL *GMT, struct GMT_PALETTE *P);
 EXTERN_MSC int gmt_get_rgb_from_z (struct GMT_CTRL *GMT, struct GMT_PALETTE *P, double value, double *rgb);
 EXTERN_MSC int gmt_get_fill_from_z (struct GMT_CTRL *GMT, struct GMT_PALETTE *P, double value, struct GMT_FILL *fill);
 EXTERN_MSC int gmt_get_fill_from_key (struct GMT_CTRL *GMT, struct GMT_PALETTE *P, char *key, struct GMT_FILL *fill);
@@ -742,6 +768,10 @@ EXTERN_MSC char * gmt_putpen (struct GMT_CTRL *GMT, struct GMT_PEN *pen);
 EXTERN_MSC int gmt_just_decode (struct GMT_CTRL *GMT, char *key, int def);
 EXTERN_MSC unsigned int gmt_minmaxinc_verify (struct GMT_CTRL *GMT, double min, double max, double inc, double slop);
 EXTERN_MSC unsigned int gmt_non_zero_winding (struct GMT_CTRL *GMT, double xp, double yp, double *x, double *y, uint64_t n_path);
+EXTERN_MSC struct GMT_SCANLINE * gmt_scanline_init (struct GMT_CTRL *GMT);
+EXTERN_MSC void gmt_scanline_free (struct GMT_CTRL *GMT, struct GMT_SCANLINE **SL_ptr);
+EXTERN_MSC void gmt_scanline_build (struct GMT_CTRL *GMT, struct GMT_SCANLINE *SL, double *x, double *y, uint64_t n, double yp);
+EXTERN_MSC bool gmt_scanline_side (struct GMT_SCANLINE *SL, double xp, unsigned int *side);
 EXTERN_MSC unsigned int gmt_verify_expectations (struct GMT_CTRL *GMT, unsigned int wanted, unsigned int got, char *item);
 EXTERN_MSC void gmt_RI_prepare (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *h);
 EXTERN_MSC struct GMT_DATASEGMENT * gmt_prepare_contour (struct GMT_CTRL *GMT, double *x, double *y, uint64_t n, double z);
@@ -758,6 +788,11 @@ EXTERN_MSC struct GMT_DATASET * gmt_segmentize_data (struct GMT_CTRL *GMT, struc
 EXTERN_MSC int gmt_err_func (struct GMT_CTRL *GMT, int err, bool fail, char *file, const char *where);
 EXTERN_MSC int64_t gmt_delaunay (struct GMT_CTRL *GMT, double *x_in, double *y_in, uint64_t n, int **link);
 EXTERN_MSC void gmt_delaunay_free (struct GMT_CTRL *GMT, int **link);
+struct GMT_TIN;		/* Opaque incremental triangulation handle; defined in gmt_support.c */
+EXTERN_MSC struct GMT_TIN * gmt_tin_create (struct GMT_CTRL *GMT, double wesn[], uint64_t n_expected);
+EXTERN_MSC int gmt_tin_insert (struct GMT_CTRL *GMT, struct GMT_TIN *T, double *x_in, double *y_in, uint64_t n);
+EXTERN_MSC int64_t gmt_tin_triangles (struct GMT_CTRL *GMT, struct GMT_TIN *T, int **link);
+EXTERN_MSC void gmt_tin_free (struct GMT_CTRL *GMT, struct GMT_TIN **T);
 EXTERN_MSC unsigned int gmt_get_prime_factors (struct GMT_CTRL *GMT, uint64_t n, unsigned int *f);
 EXTERN_MSC struct GMT_DATASET * gmt_voronoi (struct GMT_CTRL *GMT, double *x_in, double *y_in, uint64_t n, double *wesn, unsigned int mode);
 
@@ -807,7 +842,9 @@ EXTERN_MSC const char *gmt_get_module_group (void *V_API, char *module);
 
 /* From gmt_stat.c */
 EXTERN_MSC double gmt_bei (struct GMT_CTRL *GMT, double x);
+EXTERN_MSC void gmt_bei_f_n (struct GMT_CTRL *GMT, gmt_grdfloat *x, uint64_t n);
 EXTERN_MSC double gmt_ber (struct GMT_CTRL *GMT, double x);
+EXTERN_MSC void gmt_ber_f_n (struct GMT_CTRL *GMT, gmt_grdfloat *x, uint64_t n);
 EXTERN_MSC double gmt_kei (struct GMT_CTRL *GMT, double x);
 EXTERN_MSC double gmt_ker (struct GMT_CTRL *GMT, double x);
 EXTERN_MSC double gmt_plm (struct GMT_CTRL *GMT, int l, int m, double x);
@@ -869,6 +906,9 @@ EXTERN_MSC double gmt_psi (struct GMT_CTRL *GMT, double z[], double p[]);
 EXTERN_MSC void gmt_PvQv (struct GMT_CTRL *GMT, double x, double v_ri[], double pq[], unsigned int *iter);
 EXTERN_MSC double gmt_quantile (struct GMT_CTRL *GMT, double *x, double q, uint64_t n);
 EXTERN_MSC double gmt_quantile_f (struct GMT_CTRL *GMT, gmt_grdfloat *x, double q, uint64_t n);
+EXTERN_MSC double gmt_quantile_inplace (struct GMT_CTRL *GMT, double *x, double q, uint64_t n);
+EXTERN_MSC double gmt_quantile_f_inplace (struct GMT_CTRL *GMT, gmt_grdfloat *x, double q, uint64_t n);
+EXTERN_MSC void gmt_order_statistics_f (struct GMT_CTRL *GMT, gmt_grdfloat *x, uint64_t n, uint64_t *k, uint64_t nk);
 EXTERN_MSC double gmt_grd_mean (struct GMT_CTRL *GMT, struct GMT_GRID *G, struct GMT_GRID *W);
 EXTERN_MSC double gmt_grd_median (struct GMT_CTRL *GMT, struct GMT_GRID *G, struct GMT_GRID *W, bool overwrite);
 EXTERN_MSC double gmt_grd_mode (struct GMT_CTRL *GMT, struct GMT_GRID *G, struct GMT_GRID *W, bool overwrite);
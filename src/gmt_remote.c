@@ -163,6 +163,14 @@ GMT_LOCAL int gmtremote_compare_names (const void *item_1, const void *item_2) {
 	return (strcmp (name_1, name_2));
 }
 
+GMT_LOCAL int gmtremote_compare_hashes (const void *item_1, const void *item_2) {
+	/* Compare function used to sort (and then binary search) the GMT_DATA_HASH array of structures on file name */
+	const char *name_1 = ((struct GMT_DATA_HASH *)item_1)->name;
+	const char *name_2 = ((struct GMT_DATA_HASH *)item_2)->name;
+
+	return (strcmp (name_1, name_2));
+}
+
 GMT_LOCAL int gmtremote_parse_version (char *line) {
 	/* Parse a line like "# 6.1.0 or later GMT version required" and we will make no
 	 * assumptions about how much space before the version. */
@@ -205,11 +213,22 @@ GMT_LOCAL int gmtremote_remove_item (struct GMTAPI_CTRL *API, char *path, bool d
 	return error;
 }
 
+/* Process-wide snapshot of the parsed data server catalog.  Parsing and sorting the text
+ * listing takes a noticeable slice of session startup, yet the parsed array only changes
+ * when the listing file itself is replaced.  We therefore keep one parsed copy (keyed on
+ * the listing file's modification time) for the life of the process so that subsequent
+ * sessions just duplicate the snapshot instead of re-reading the text file. */
+static struct GMT_DATA_INFO *gmtremote_info_snapshot = NULL;
+static int gmtremote_info_snapshot_n = 0;
+static time_t gmtremote_info_snapshot_mtime = 0;
+
 GMT_LOCAL struct GMT_DATA_INFO *gmtremote_data_load (struct GMTAPI_CTRL *API, int *n) {
 	/* Read contents of the info file into an array of structs */
 	bool parse_extra_data = false;
 	int k = 0, nr, start_here = 0;
+	time_t info_mtime = 0;
 	FILE *fp = NULL;
+	struct stat sbuf;
 	struct GMT_DATA_INFO *I = NULL;
 	char unit, line[GMT_LEN512] = {""}, file[PATH_MAX] = {""}, *c = NULL;
 
@@ -217,6 +236,22 @@ GMT_LOCAL struct GMT_DATA_INFO *gmtremote_data_load (struct GMTAPI_CTRL *API, in
 
 	snprintf (file, PATH_MAX, "%s/%s", GMT->session.USERDIR, GMT_INFO_SERVER_FILE);
 
+	if (stat (file, &sbuf) == 0) {	/* Get listing modification time so we can validate any process snapshot */
+#ifdef __APPLE__
+		info_mtime = sbuf.st_mtimespec.tv_sec;	/* Apple even has tv_nsec for nano-seconds... */
+#else
+		info_mtime = sbuf.st_mtime;
+#endif
+	}
+	if (gmtremote_info_snapshot && info_mtime == gmtremote_info_snapshot_mtime && !GMT->current.io.new_data_list) {
+		/* Same listing file as when the snapshot was taken - just hand out a duplicate of the parsed array */
+		GMT_Report (API, GMT_MSG_DEBUG, "Reuse process snapshot of %s\n", file);
+		if ((I = gmt_M_memory (GMT, NULL, gmtremote_info_snapshot_n, struct GMT_DATA_INFO)) == NULL) return NULL;
+		gmt_M_memcpy (I, gmtremote_info_snapshot, gmtremote_info_snapshot_n, struct GMT_DATA_INFO);
+		*n = gmtremote_info_snapshot_n;
+		return (I);
+	}
+
 	GMT_Report (API, GMT_MSG_DEBUG, "Load contents from %s\n", file);
 	*n = 0;
 	if ((fp = fopen (file, "r")) == NULL) {
@@ -357,6 +392,14 @@ GMT_LOCAL struct GMT_DATA_INFO *gmtremote_data_load (struct GMTAPI_CTRL *API, in
 	}
 
 out_of_here:
+	if (*n) {	/* Refresh the process snapshot so later sessions can skip the text parsing */
+		if (gmtremote_info_snapshot) free (gmtremote_info_snapshot);
+		if ((gmtremote_info_snapshot = malloc ((size_t)(*n) * sizeof (struct GMT_DATA_INFO)))) {
+			memcpy (gmtremote_info_snapshot, I, (size_t)(*n) * sizeof (struct GMT_DATA_INFO));
+			gmtremote_info_snapshot_n = *n;
+			gmtremote_info_snapshot_mtime = info_mtime;
+		}
+	}
 	return (I);
 };
 
@@ -644,6 +687,35 @@ GMT_LOCAL char *gmtremote_lockfile (struct GMT_CTRL *GMT, char *file) {
 	return (strdup (Lfile));
 }
 
+/* All transfers in a session attach to a single libcurl share handle so that resolved host
+ * names, negotiated TLS sessions and (recent libcurl) idle kept-alive connections are pooled
+ * across easy handles.  Repeated downloads within one process - such as the per-tile calls a
+ * region assembly makes - then pay the DNS lookup and TLS handshake once instead of once per
+ * file.  All GMT curl use is single-threaded (the concurrent fetcher drives one multi stack
+ * from one thread) so no share lock callbacks are required. */
+
+GMT_LOCAL CURLSH *gmtremote_curl_share (struct GMT_CTRL *GMT) {
+	/* Return the session's share handle, creating it on the first transfer */
+	CURLSH *share = GMT->session.curlshare;
+	if (share == NULL) {
+		if ((share = curl_share_init ()) == NULL) return NULL;	/* Transfers simply proceed unpooled */
+		curl_share_setopt (share, CURLSHOPT_SHARE, CURL_LOCK_DATA_DNS);
+		curl_share_setopt (share, CURLSHOPT_SHARE, CURL_LOCK_DATA_SSL_SESSION);
+#if LIBCURL_VERSION_NUM >= 0x073900	/* 7.57.0 and later can also share the connection cache */
+		curl_share_setopt (share, CURLSHOPT_SHARE, CURL_LOCK_DATA_CONNECT);
+#endif
+		GMT->session.curlshare = share;
+	}
+	return share;
+}
+
+void gmtlib_curlshare_free (struct GMT_CTRL *GMT) {
+	/* Release the session's libcurl share handle, if any transfer created one */
+	if (GMT->session.curlshare == NULL) return;
+	curl_share_cleanup (GMT->session.curlshare);
+	GMT->session.curlshare = NULL;
+}
+
 GMT_LOCAL size_t gmtremote_skip_large_files (struct GMT_CTRL *GMT, char * URL, size_t limit) {
 	/* Get the remote file's size and if too large we refuse to download */
 	CURL *curl = NULL;
@@ -673,6 +745,8 @@ GMT_LOCAL size_t gmtremote_skip_large_files (struct GMT_CTRL *GMT, char * URL, s
 		curl_easy_setopt (curl, CURLOPT_HEADER, 0L);
 		/* Complete connection within 10 seconds */
 		curl_easy_setopt (curl, CURLOPT_CONNECTTIMEOUT, GMT_CONNECT_TIME_OUT);
+		/* Reuse the session's pooled DNS/TLS/connection state */
+		curl_easy_setopt (curl, CURLOPT_SHARE, gmtremote_curl_share (GMT));
 
 		res = curl_easy_perform (curl);
 
@@ -728,6 +802,15 @@ CURL * gmtremote_setup_curl (struct GMTAPI_CTRL *API, char *url, char *local_fil
 		GMT_Report (API, GMT_MSG_ERROR, "Failed to set curl option to limit connection timeout to %lds\n", GMT_CONNECT_TIME_OUT);
 		return NULL;
 	}
+	if (curl_easy_setopt (Curl, CURLOPT_SHARE, gmtremote_curl_share (API->GMT)))	/* Reuse the session's pooled DNS/TLS/connection state */
+		GMT_Report (API, GMT_MSG_DEBUG, "Failed to attach curl share handle; connection state will not be pooled\n");
+#if LIBCURL_VERSION_NUM >= 0x074100	/* 7.65.0: keep an on-disk alt-svc cache so later processes go straight to the server's HTTP/2+ endpoint */
+	if (API->GMT->session.CACHEDIR) {
+		char altsvc[PATH_MAX] = {""};
+		snprintf (altsvc, PATH_MAX, "%s/gmt_altsvc.txt", API->GMT->session.CACHEDIR);
+		curl_easy_setopt (Curl, CURLOPT_ALTSVC, altsvc);
+	}
+#endif
 	if (time_out) {	/* Set a timeout limit */
 		if (curl_easy_setopt (Curl, CURLOPT_TIMEOUT, time_out)) {
 			GMT_Report (API, GMT_MSG_ERROR, "Failed to set curl option to time out after %d seconds\n", time_out);
@@ -926,8 +1009,8 @@ GMT_LOCAL int gmtremote_refresh (struct GMTAPI_CTRL *API, unsigned int index) {
 	 * days old we are done.
 	 * If the file is older we rename it to *.old and download the latest hash file.
 	 * This is the same for both values of index (hash and info).  For hash, we do more:
-	 * Next, we load the contents of both files and do a double loop to find the
-	 * entries for each old file in the new list, for all files.  If the old file
+	 * Next, we load the contents of both files, sort the new list on file names, and
+	 * binary search for each old entry in the new list, for all files.  If the old file
 	 * is no longer in the list then we delete the data file.  If the hash code for
 	 * a file has changed then we delete the local file so that the new versions
 	 * will be downloaded from the server.  Otherwise we do nothing.
@@ -1029,9 +1112,8 @@ GMT_LOCAL int gmtremote_refresh (struct GMTAPI_CTRL *API, unsigned int index) {
 		}
 
 		if (index == GMT_HASH_INDEX) {	/* Special processing to upgrade or remove deprecated files */
-			bool found;
-			int nO, nN, n, o;
-			struct GMT_DATA_HASH *O = NULL, *N = NULL;
+			int nO, nN, o;
+			struct GMT_DATA_HASH *O = NULL, *N = NULL, *H = NULL;
 
 			if ((N = gmtremote_hash_load (GMT, indexpath, &nN)) == 0) {	/* Read in the new array of hash structs, will return 0 if mismatch of entries */
 				gmt_remove_file (GMT, indexpath);	/* Remove corrupted index file */
@@ -1040,33 +1122,31 @@ GMT_LOCAL int gmtremote_refresh (struct GMTAPI_CTRL *API, unsigned int index) {
 			}
 
 			O = gmtremote_hash_load (GMT, old_indexpath, &nO);	/* Read in the old array of hash structs */
+			/* Sort the new list on file names so each old entry can be found via binary search in the batch pass below */
+			qsort (N, nN, sizeof (struct GMT_DATA_HASH), gmtremote_compare_hashes);
 			for (o = 0; o < nO; o++) {	/* Loop over items in old file */
 				if (gmt_getdatapath (GMT, O[o].name, url, R_OK) == NULL) continue;	/* Don't have this file downloaded yet */
 				/* Here the file was found locally and the full path is in the url */
-				found = false;	/* Not found this file in the new list yet */
-				for (n = 0; !found && n < nN; n++) {	/* Loop over items in new file */
-					if (!strcmp (N[n].name, O[o].name)) {	/* File is in the current hash table */
-						found = true;	/* We will exit this loop regardless of what happens next below */
-						if (strcmp (N[n].hash, O[o].hash)) {	/* New hash differs from entry in hash old file */
-							GMT_Report (API, GMT_MSG_DEBUG, "Server and cache versions of %s have different hash codes - must download new copy.\n", N[n].name);
-							gmt_remove_file (GMT, url);	/* Need to re-download so be gone with it */
+				if ((H = bsearch (&O[o], N, nN, sizeof (struct GMT_DATA_HASH), gmtremote_compare_hashes))) {	/* File is in the current hash table */
+					if (strcmp (H->hash, O[o].hash)) {	/* New hash differs from entry in hash old file */
+						GMT_Report (API, GMT_MSG_DEBUG, "Server and cache versions of %s have different hash codes - must download new copy.\n", H->name);
+						gmt_remove_file (GMT, url);	/* Need to re-download so be gone with it */
+					}
+					else {	/* Do size check */
+						struct stat buf;
+						if (stat (url, &buf)) {
+							GMT_Report (API, GMT_MSG_WARNING, "Could not determine size of file %s.\n", url);
+							continue;
 						}
-						else {	/* Do size check */
-							struct stat buf;
-							if (stat (url, &buf)) {
-								GMT_Report (API, GMT_MSG_WARNING, "Could not determine size of file %s.\n", url);
-								continue;
-							}
-							if (N[n].size != (size_t)buf.st_size) {	/* Downloaded file size differ - need to re-download */
-								GMT_Report (API, GMT_MSG_DEBUG, "Server and cache versions of %s have different byte sizes (%" PRIuS " versus %" PRIuS ") - must download new copy.\n", N[n].name, N[n].size, (size_t)buf.st_size);
-								gmt_remove_file (GMT, url);	/* Need to re-download so be gone with it */
-							}
-							else
-								GMT_Report (API, GMT_MSG_DEBUG, "Server and cache versions of %s are identical - no need to download new file.\n", N[n].name);
+						if (H->size != (size_t)buf.st_size) {	/* Downloaded file size differ - need to re-download */
+							GMT_Report (API, GMT_MSG_DEBUG, "Server and cache versions of %s have different byte sizes (%" PRIuS " versus %" PRIuS ") - must download new copy.\n", H->name, H->size, (size_t)buf.st_size);
+							gmt_remove_file (GMT, url);	/* Need to re-download so be gone with it */
 						}
+						else
+							GMT_Report (API, GMT_MSG_DEBUG, "Server and cache versions of %s are identical - no need to download new file.\n", H->name);
 					}
 				}
-				if (!found) {	/* This file was present locally but is no longer part of files on the server and should be removed */
+				else {	/* This file was present locally but is no longer part of files on the server and should be removed */
 					GMT_Report (API, GMT_MSG_DEBUG, "File %s no longer supported on server - deleting local copy.\n", O[o].name);
 					gmt_remove_file (GMT, url);
 				}
@@ -1541,6 +1621,178 @@ unlocking2:
 	return (error);
 }
 
+/* Concurrent download of many remote files (e.g., the tiles needed to cover a region).
+ * Instead of serializing one round trip per file over a single easy handle we keep
+ * several transfers in flight on a curl multi stack and let each write to its local
+ * path as data arrive.  The number of simultaneous connections defaults to
+ * GMT_DOWNLOAD_CONNECTIONS but can be overridden via the environmental parameter
+ * GMT_DATA_SERVER_CONNECTIONS (clipped to a sane maximum). */
+
+#define GMT_DOWNLOAD_CONNECTIONS	6	/* Default number of simultaneous connections to the data server */
+#define GMT_DOWNLOAD_CONNECTIONS_MAX	16	/* Upper limit on the same, regardless of user request */
+
+struct GMTREMOTE_TRANSFER {	/* State of one file in a concurrent download */
+	char *name;			/* Remote file name as given (e.g., @N42E126.earth_relief_01s_g.nc) */
+	char remote_path[PATH_MAX];	/* Full URL to the file on the server */
+	char local_path[PATH_MAX];	/* Where the file will be written locally */
+	CURL *easy;			/* The easy handle while this transfer is active, else NULL */
+	struct FtpFile urlfile;		/* Write-callback state (local file is opened on first write) */
+	struct LOCFILE_FP *LF;		/* Lock held while we download this file */
+};
+
+GMT_LOCAL unsigned int gmtremote_n_connections (unsigned int n_files) {
+	/* Number of simultaneous connections to use; GMT_DATA_SERVER_CONNECTIONS may override the default */
+	unsigned int n_conn = GMT_DOWNLOAD_CONNECTIONS;
+	char *string = NULL;
+	if ((string = getenv ("GMT_DATA_SERVER_CONNECTIONS")) != NULL && atoi (string) > 0)
+		n_conn = MIN ((unsigned int)atoi (string), GMT_DOWNLOAD_CONNECTIONS_MAX);
+	return (MIN (n_conn, n_files));
+}
+
+GMT_LOCAL int gmtremote_start_transfer (struct GMTAPI_CTRL *API, CURLM *Mult, struct GMTREMOTE_TRANSFER *T) {
+	/* Obtain the file lock, then add this file's easy handle to the multi stack.
+	 * Returns +1 if there is nothing to transfer (file appeared while we waited for
+	 * the lock, or it exceeds the size limit), 0 if the transfer was started, and
+	 * -1 if we failed to set up the transfer. */
+	size_t fsize;
+	struct GMT_CTRL *GMT = API->GMT;
+
+	if ((T->LF = gmtremote_lock_on (GMT, T->name)) == NULL) return -1;
+
+	/* If file locking held us up as another process was downloading the same file,
+	 * then that file should now be available and there is nothing for us to do */
+
+	if (!access (T->local_path, F_OK)) {	/* Yes it was! Undo lock and return no error */
+		gmtremote_lock_off (GMT, &T->LF);
+		return +1;
+	}
+	if ((fsize = gmtremote_skip_large_files (GMT, T->remote_path, GMT->current.setting.url_size_limit))) {
+		char *S = strdup (gmt_memory_use (fsize, 3));
+		GMT_Report (API, GMT_MSG_WARNING, "File %s skipped as size [%s] exceeds limit set by GMT_DATA_SERVER_LIMIT [%s]\n", T->name, S, gmt_memory_use (GMT->current.setting.url_size_limit, 0));
+		gmt_M_str_free (S);
+		gmtremote_lock_off (GMT, &T->LF);
+		return +1;
+	}
+	if ((T->easy = gmtremote_setup_curl (API, T->remote_path, T->local_path, &T->urlfile, 0)) == NULL) {
+		gmtremote_lock_off (GMT, &T->LF);
+		return -1;
+	}
+	gmtremote_find_and_give_data_attribution (API, T->name);
+	GMT_Report (API, GMT_MSG_INFORMATION, "Downloading file %s ...\n", T->remote_path);
+	curl_multi_add_handle (Mult, T->easy);
+	return 0;
+}
+
+GMT_LOCAL int gmtremote_end_transfer (struct GMTAPI_CTRL *API, CURLM *Mult, struct GMTREMOTE_TRANSFER *T, CURLcode curl_err, bool be_fussy) {
+	/* Wrap up a completed (or failed) transfer: release handle, lock, and file pointer,
+	 * delete any partial local file on failure, then convert any JP2 tile to netCDF */
+	int error = GMT_NOERROR;
+	struct GMT_CTRL *GMT = API->GMT;
+
+	curl_multi_remove_handle (Mult, T->easy);
+	curl_easy_cleanup (T->easy);
+	T->easy = NULL;
+	if (T->urlfile.fp) {	/* Close the local file */
+		fclose (T->urlfile.fp);
+		T->urlfile.fp = NULL;
+	}
+	if (curl_err != CURLE_OK) {	/* Failed, give error message */
+		if (be_fussy || !(curl_err == CURLE_REMOTE_FILE_NOT_FOUND || curl_err == CURLE_HTTP_RETURNED_ERROR)) {	/* Unexpected failure - want to bitch about it */
+			GMT_Report (API, GMT_MSG_ERROR, "Libcurl Error: %s\n", curl_easy_strerror (curl_err));
+			if (curl_err == CURLE_HTTP_RETURNED_ERROR)
+				GMT_Report (API, GMT_MSG_ERROR, "Probably means %s does not exist on the remote server\n", T->name);
+			error = curl_err;
+			if (!access (T->local_path, F_OK) && gmt_remove_file (GMT, T->local_path))	/* Failed to clean up as well */
+				GMT_Report (API, GMT_MSG_WARNING, "Could not even remove file %s\n", T->local_path);
+		}
+		else if (curl_err == CURLE_COULDNT_CONNECT)
+			GMT->current.io.internet_error = true;	/* Prevent GMT from trying again in this session */
+	}
+	gmtremote_lock_off (GMT, &T->LF);
+	if (error == GMT_NOERROR) error = gmtremote_convert_jp2_to_nc (API, T->local_path);
+	return (error);
+}
+
+GMT_LOCAL int gmtremote_fetch_files (struct GMTAPI_CTRL *API, char **file, unsigned int n_files, unsigned int mode) {
+	/* Download the files in the given list that are not already stored locally, keeping
+	 * several simultaneous connections to the server busy until all have arrived.
+	 * Mode values are as for gmt_download_file_if_not_found, including the optional 4. */
+	bool be_fussy;
+	int still_running = 0, n_queued = 0, status, n_errors = 0;
+	unsigned int k, n_fetch = 0, n_active = 0, n_conn, next;
+	CURLM *Mult = NULL;
+	CURLMsg *msg = NULL;
+	struct GMTREMOTE_TRANSFER *T = NULL, *Tk = NULL;
+	struct GMT_CTRL *GMT = API->GMT;
+
+	if (GMT->current.setting.auto_download == GMT_NO_DOWNLOAD) {  /* Not allowed to use remote copying */
+		GMT_Report (API, GMT_MSG_ERROR, "Remote download is currently deactivated\n");
+		return 1;
+	}
+	if (GMT->current.io.internet_error) return 1;   /* Not able to use remote copying in this session */
+
+	be_fussy = ((mode & 4) == 0);	if (!be_fussy) mode -= 4;	/* Handle the optional 4 value */
+
+	if ((T = gmt_M_memory (GMT, NULL, n_files, struct GMTREMOTE_TRANSFER)) == NULL) return 1;
+	for (k = 0; k < n_files; k++) {	/* Determine which of the files we actually must download */
+		char local_path[PATH_MAX] = {""}, remote_path[PATH_MAX] = {""};
+		if (gmt_set_remote_and_local_filenames (GMT, file[k], local_path, remote_path, mode)) continue;	/* Unrecognized file - deal with it when the file is read */
+		if (remote_path[0] == '\0') continue;	/* Already stored locally */
+		T[n_fetch].name = file[k];
+		strncpy (T[n_fetch].remote_path, remote_path, PATH_MAX-1);
+		strncpy (T[n_fetch].local_path,  local_path,  PATH_MAX-1);
+		n_fetch++;
+	}
+	if (n_fetch == 0) {	/* All files already stored locally - nothing to do */
+		gmt_M_free (GMT, T);
+		return GMT_NOERROR;
+	}
+	if (n_fetch == 1) {	/* No concurrency to be had - use the single-file path with its Ctrl-C protection */
+		status = gmt_download_file (GMT, T[0].name, T[0].remote_path, T[0].local_path, be_fussy);
+		gmt_M_free (GMT, T);
+		return (status);
+	}
+	if ((Mult = curl_multi_init ()) == NULL) {
+		GMT_Report (API, GMT_MSG_ERROR, "Failed to initiate curl multi stack - cannot download files\n");
+		gmt_M_free (GMT, T);
+		return 1;
+	}
+	n_conn = gmtremote_n_connections (n_fetch);
+	GMT_Report (API, GMT_MSG_INFORMATION, "Downloading %u files using %u simultaneous connections\n", n_fetch, n_conn);
+	for (next = 0; next < n_fetch && n_active < n_conn; next++) {	/* Fill the pipeline */
+		if ((status = gmtremote_start_transfer (API, Mult, &T[next])) < 0) n_errors++;
+		else if (status == 0) n_active++;
+	}
+	while (n_active) {	/* Keep transfers going until all files have arrived (or failed) */
+		if (curl_multi_perform (Mult, &still_running) != CURLM_OK) {
+			GMT_Report (API, GMT_MSG_ERROR, "Failure while performing the curl multi downloads\n");
+			n_errors++;
+			break;
+		}
+		while ((msg = curl_multi_info_read (Mult, &n_queued)) != NULL) {	/* Process any completed transfers */
+			if (msg->msg != CURLMSG_DONE) continue;
+			for (k = 0, Tk = NULL; Tk == NULL && k < n_fetch; k++)
+				if (T[k].easy == msg->easy_handle) Tk = &T[k];
+			if (Tk == NULL) continue;	/* Cannot happen, but keep static analyzers happy */
+			if (gmtremote_end_transfer (API, Mult, Tk, msg->data.result, be_fussy)) n_errors++;
+			n_active--;
+			while (next < n_fetch && n_active < n_conn && !GMT->current.io.internet_error) {	/* Start the next transfer(s) in the queue */
+				if ((status = gmtremote_start_transfer (API, Mult, &T[next])) < 0) n_errors++;
+				else if (status == 0) n_active++;
+				next++;
+			}
+		}
+		if (n_active && curl_multi_wait (Mult, NULL, 0, 1000, NULL) != CURLM_OK) {	/* Sleep until data arrive [at most 1s] */
+			GMT_Report (API, GMT_MSG_ERROR, "Failure while waiting on the curl multi downloads\n");
+			n_errors++;
+			break;
+		}
+	}
+	curl_multi_cleanup (Mult);
+	gmt_M_free (GMT, T);
+	return ((n_errors) ? GMT_RUNTIME_ERROR : GMT_NOERROR);
+}
+
 unsigned int gmt_download_file_if_not_found (struct GMT_CTRL *GMT, const char *file, unsigned int mode) {
 	/* Downloads a file if not found locally.  Returns the position in file_name of the
  	 * start of the actual file (e.g., if given an URL). Values for mode:
@@ -1857,9 +2109,10 @@ struct GMT_GRID *gmtlib_assemble_tiles (struct GMTAPI_CTRL *API, double *region,
 	 * Set up a grdblend command and return the assembled grid
 	 */
 	int k_data, v_level = API->verbose;
+	uint64_t n_tiles;
 	struct GMT_GRID *G = NULL;
 	double *wesn = (region) ? region : API->tile_wesn;	/* Default to -R */
-	char grid[GMT_VF_LEN] = {""}, cmd[GMT_LEN256] = {""}, code = 0;
+	char grid[GMT_VF_LEN] = {""}, cmd[GMT_LEN256] = {""}, code = 0, **tile = NULL;
 	struct GMT_GRID_HEADER_HIDDEN *HH = NULL;
 
 	(void) gmt_file_is_tiled_list (API, file, NULL, &code, NULL);	/* Just get the code*/
@@ -1869,6 +2122,13 @@ struct GMT_GRID *gmtlib_assemble_tiles (struct GMTAPI_CTRL *API, double *region,
 		return NULL;
 	}
 
+	/* Obtain any missing tiles first, several at a time, so that grdblend finds them all locally.
+	 * If any transfer failed we say nothing here - grdblend will report on whatever is still missing */
+	if ((n_tiles = gmt_read_list (API->GMT, file, &tile))) {
+		(void) gmtremote_fetch_files (API, tile, (unsigned int)n_tiles, GMT_AUTO_DIR);
+		gmt_free_list (API->GMT, tile, n_tiles);
+	}
+
 	if (API->verbose == GMT_MSG_WARNING) API->verbose = GMT_MSG_ERROR;	/* Drop from warnings to errors only when calling grdblend to avoid annoying messages about phase/shift from SRTM01|3 and 15s */
 	GMT_Open_VirtualFile (API, GMT_IS_GRID, GMT_IS_SURFACE, GMT_OUT|GMT_IS_REFERENCE, NULL, grid);
 	/* Pass -N0 so that missing tiles (oceans) yield z = 0 and not NaN, and -Co+n to override using negative earth_relief_15s values */
@@ -1893,16 +2153,15 @@ struct GMT_GRID *gmtlib_assemble_tiles (struct GMTAPI_CTRL *API, double *region,
 
 int gmt_download_tiles (struct GMTAPI_CTRL *API, char *list, unsigned int mode) {
 	/* Download all tiles not already here given by the list */
-	uint64_t n, k;
+	int error;
+	uint64_t n;
 	char **file = NULL;
 
 	if (!gmt_file_is_tiled_list (API, list, NULL, NULL, NULL)) return GMT_RUNTIME_ERROR;
 	if ((n = gmt_read_list (API->GMT, list, &file)) == 0) return GMT_RUNTIME_ERROR;
-	for (k = 0; k < n; k++) {
-		gmt_download_file_if_not_found (API->GMT, file[k], mode);
-	}
+	error = gmtremote_fetch_files (API, file, (unsigned int)n, mode);
 	gmt_free_list (API->GMT, file, n);
-	return GMT_NOERROR;
+	return (error);
 }
 
 char *gmt_dataserver_url (struct GMTAPI_CTRL *API) {
@@ -34,6 +34,11 @@
 #include "gmt_dev.h"
 #include "gmt_internals.h"
 #include "gshhg_version.h"
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#endif
 /*
  * These functions simplifies the access to the GMT shoreline, border, and river
  * databases.
@@ -91,6 +96,56 @@ GMT_LOCAL void gmtshore_br_to_degree (struct GMT_BR *c, short int dx, short int
 	*lat = c->lat_sw + ((unsigned short)dy) * c->scale;
 }
 
+GMT_LOCAL void gmtshore_decimate_segment (struct GMT_SHORE_SEGMENT *seg, int tol) {
+	/* Collapse runs of consecutive points that stay within tol bin units (L1 norm) of the last
+	 * point kept; tol is chosen by gmt_init_shore so the deviation stays below the device
+	 * resolution of the plot.  The two end points always survive so the entry/exit positions on
+	 * the bin borders are unchanged, and a closed ring is left alone if thinning would degenerate it. */
+	int i, last, m, n = (int)seg->n;
+	short int *x = seg->dx, *y = seg->dy;
+
+	for (i = 1, last = 0, m = 1; i < n - 1; i++) {	/* First pass: count the survivors */
+		if ((abs ((int)(unsigned short)x[i] - (int)(unsigned short)x[last]) + abs ((int)(unsigned short)y[i] - (int)(unsigned short)y[last])) < tol) continue;
+		last = i;	m++;
+	}
+	m++;	/* The final point is always kept */
+	if (m == n) return;	/* Nothing was collapsed */
+	if (m < 4 && x[0] == x[n-1] && y[0] == y[n-1]) return;	/* Thinning would degenerate this closed ring */
+	for (i = 1, last = 0, m = 1; i < n - 1; i++) {	/* Second pass: compress the arrays in place */
+		if ((abs ((int)(unsigned short)x[i] - (int)(unsigned short)x[last]) + abs ((int)(unsigned short)y[i] - (int)(unsigned short)y[last])) < tol) continue;
+		x[m] = x[i];	y[m] = y[i];	last = i;	m++;
+	}
+	x[m] = x[n-1];	y[m] = y[n-1];	m++;
+	seg->n = (unsigned short)m;
+}
+
+GMT_LOCAL bool gmtshore_br_outside (struct GMT_BR *c, short int *dx, short int *dy, unsigned short n) {
+	/* True if the segment falls entirely outside the region that was passed to gmt_init_br.
+	 * The bounding box is found by integer min/max over the raw bin units so no degree conversion
+	 * or projection work is spent on segments that cannot appear on the map; testing against the
+	 * same rectangle that selected the bins keeps the two culls consistent. */
+	int i, ix, iy, xmin = GSHHS_MAX_DELTA, xmax = 0, ymin = GSHHS_MAX_DELTA, ymax = 0;
+	double west, east, south, north;
+
+	for (i = 0; i < (int)n; i++) {
+		ix = (int)(unsigned short)dx[i];	iy = (int)(unsigned short)dy[i];
+		if (ix < xmin) xmin = ix;
+		if (ix > xmax) xmax = ix;
+		if (iy < ymin) ymin = iy;
+		if (iy > ymax) ymax = iy;
+	}
+	south = c->lat_sw + ymin * c->scale;
+	north = c->lat_sw + ymax * c->scale;
+	if (north < c->wesn[YLO] || south > c->wesn[YHI]) return (true);
+	west = c->lon_sw + xmin * c->scale - 360.0;	/* Start one period down, then shift up as the bin search does */
+	east = c->lon_sw + xmax * c->scale - 360.0;
+	while (east < c->wesn[XLO]) {
+		west += 360.0;
+		east += 360.0;
+	}
+	return (west > c->wesn[XHI]);
+}
+
 GMT_LOCAL int gmtshore_copy_to_shore_path (double *lon, double *lat, struct GMT_SHORE *s, int id) {
 	/* Convert a shore segment to degrees and add to array */
 	int i;
@@ -428,6 +483,197 @@ GMT_LOCAL int gmtshore_res_to_int (char res) {
 	return (i);
 }
 
+/* On-disk spatial index for the binned GSHHG files.  Repeated small-region jobs (e.g., tiled
+ * pscoast or grdlandmask runs) spend much of their shoreline time re-decoding the per-bin and
+ * per-segment netCDF arrays.  We therefore build, once per GSHHG file version, a flat binary
+ * image of those tables in the users cache directory.  Later sessions memory-map that file so
+ * bin lookups become pointer dereferences; the bulk point arrays (dx, dy) stay in the netCDF
+ * file and are only read for the selected bins.  The index is purely an accelerator: on any
+ * inconsistency we quietly fall back on the netCDF reads. */
+
+#define GSHHG_INDEX_MAGIC	"GSHHGIDX"
+#define GSHHG_INDEX_VERSION	1
+
+struct GSHHG_INDEX_HEADER {	/* Leads the index file; the arrays follow, 8-byte aligned */
+	char magic[8];		/* GSHHG_INDEX_MAGIC (not null-terminated) */
+	int index_version;	/* GSHHG_INDEX_VERSION */
+	int two_Antarcticas;	/* 1 if the source file holds both Antarctica solutions */
+	int n_bin;		/* Array dimensions; must match the netCDF file */
+	int n_seg;
+	int n_poly;
+	int n_nodes;
+	char version[GMT_LEN8];	/* GSHHG version string of the source file */
+};
+
+GMT_LOCAL size_t gmtshore_index_filesize (struct GSHHG_INDEX_HEADER *h) {
+	/* Expected total size of an index file with these dimensions */
+	return (sizeof (struct GSHHG_INDEX_HEADER) + (size_t)h->n_poly * sizeof (double) +
+		((size_t)h->n_bin + 3 * (size_t)h->n_seg + 2 * (size_t)h->n_poly + (size_t)h->n_nodes) * sizeof (int) +
+		3 * (size_t)h->n_bin * sizeof (short int) + (size_t)h->n_seg);
+}
+
+GMT_LOCAL char *gmtshore_index_name (struct GMT_CTRL *GMT, struct GMT_SHORE *c, char *path) {
+	/* Compose the full path to the index for this resolution and GSHHG version [NULL if no cache directory] */
+	if (GMT->session.CACHEDIR == NULL) return (NULL);
+	snprintf (path, PATH_MAX, "%s/binned_GSHHS_%c_%s.idx", GMT->session.CACHEDIR, c->res, c->version);
+	return (path);
+}
+
+GMT_LOCAL int gmtshore_index_attach (struct GMT_CTRL *GMT, struct GMT_SHORE *c) {
+	/* Map the on-disk index, if present and consistent with the open netCDF file, and set
+	 * the index array pointers.  Any failure simply means the caller must use the netCDF
+	 * arrays, so we return nonzero without reporting an error. */
+	char path[PATH_MAX] = {""};
+	unsigned char *base = NULL, *p = NULL;
+	size_t n_bytes;
+	struct GSHHG_INDEX_HEADER *h = NULL;
+#ifdef _WIN32
+	FILE *fp = NULL;
+	struct GSHHG_INDEX_HEADER hdr;
+#else
+	int fd;
+	struct stat buf;
+#endif
+
+	if (gmtshore_index_name (GMT, c, path) == NULL) return (GMT_RUNTIME_ERROR);
+#ifdef _WIN32
+	/* No mmap on Windows so read the entire index into memory instead */
+	if ((fp = fopen (path, "rb")) == NULL) return (GMT_RUNTIME_ERROR);
+	if (fread (&hdr, sizeof (struct GSHHG_INDEX_HEADER), 1U, fp) != 1) { fclose (fp); return (GMT_RUNTIME_ERROR); }
+	n_bytes = gmtshore_index_filesize (&hdr);
+	if ((base = gmt_M_memory (GMT, NULL, n_bytes, unsigned char)) == NULL) { fclose (fp); return (GMT_MEMORY_ERROR); }
+	rewind (fp);
+	if (fread (base, 1U, n_bytes, fp) != n_bytes) { gmt_M_free (GMT, base); fclose (fp); return (GMT_RUNTIME_ERROR); }
+	fclose (fp);
+#else
+	if ((fd = open (path, O_RDONLY)) == -1) return (GMT_RUNTIME_ERROR);
+	if (fstat (fd, &buf) || (size_t)buf.st_size < sizeof (struct GSHHG_INDEX_HEADER)) { close (fd); return (GMT_RUNTIME_ERROR); }
+	n_bytes = (size_t)buf.st_size;
+	base = mmap (NULL, n_bytes, PROT_READ, MAP_PRIVATE, fd, 0);
+	close (fd);	/* The mapping remains valid after closing the descriptor */
+	if (base == MAP_FAILED) return (GMT_RUNTIME_ERROR);
+#endif
+	h = (struct GSHHG_INDEX_HEADER *)base;
+	if (memcmp (h->magic, GSHHG_INDEX_MAGIC, 8U) || h->index_version != GSHHG_INDEX_VERSION ||
+	    strncmp (h->version, c->version, GMT_LEN8) || h->two_Antarcticas != c->two_Antarcticas ||
+	    h->n_bin != c->n_bin || h->n_seg != c->n_seg || h->n_poly != c->n_poly ||
+	    gmtshore_index_filesize (h) != n_bytes) {	/* Stale or foreign index; ignore it */
+#ifdef _WIN32
+		gmt_M_free (GMT, base);
+#else
+		munmap (base, n_bytes);
+#endif
+		return (GMT_RUNTIME_ERROR);
+	}
+	p = base + sizeof (struct GSHHG_INDEX_HEADER);
+	c->index_area = (double *)p;		p += (size_t)h->n_poly * sizeof (double);
+	c->index_firstseg = (int *)p;		p += (size_t)h->n_bin * sizeof (int);
+	c->index_seg_info = (int *)p;		p += (size_t)h->n_seg * sizeof (int);
+	c->index_seg_start = (int *)p;		p += (size_t)h->n_seg * sizeof (int);
+	c->index_seg_ID = (int *)p;		p += (size_t)h->n_seg * sizeof (int);
+	c->index_parent = (int *)p;		p += (size_t)h->n_poly * sizeof (int);
+	c->index_areafrac = (int *)p;		p += (size_t)h->n_poly * sizeof (int);
+	c->index_node = (int *)p;		p += (size_t)h->n_nodes * sizeof (int);
+	c->index_bin_info = (short int *)p;	p += (size_t)h->n_bin * sizeof (short int);
+	c->index_bin_info_ant = (short int *)p;	p += (size_t)h->n_bin * sizeof (short int);
+	c->index_bin_nseg = (short int *)p;	p += (size_t)h->n_bin * sizeof (short int);
+	c->index_seg_ant = (signed char *)p;
+	c->index_n_nodes = h->n_nodes;
+	c->index_base = base;
+	c->index_size = n_bytes;
+	GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Using GSHHG spatial index %s\n", path);
+	return (GMT_NOERROR);
+}
+
+GMT_LOCAL void gmtshore_index_detach (struct GMT_CTRL *GMT, struct GMT_SHORE *c) {
+	/* Release the mapped (or read-in) index, if any */
+	if (c->index_base == NULL) return;
+#ifdef _WIN32
+	gmt_M_free (GMT, c->index_base);
+#else
+	gmt_M_unused(GMT);
+	munmap (c->index_base, c->index_size);
+#endif
+	c->index_base = NULL;
+}
+
+GMT_LOCAL void gmtshore_index_build (struct GMT_CTRL *GMT, struct GMT_SHORE *c, bool int_areas) {
+	/* One-time construction of the binary index from the already-open netCDF file.  We write
+	 * to a temporary name and rename so concurrent jobs never see a partial index.  Failure
+	 * here (e.g., read-only cache directory) is never an error - there just won't be one. */
+	char path[PATH_MAX] = {""}, tmp_path[PATH_MAX] = {""};
+	int i, k, err = 0, ids[7];
+	size_t start[1] = {0}, count[1], n[7];
+	FILE *fp = NULL;
+	double *darray = NULL;
+	int *iarray = NULL;
+	short int *sarray = NULL;
+	signed char *carray = NULL;
+	struct GSHHG_INDEX_HEADER h;
+
+	if (gmtshore_index_name (GMT, c, path) == NULL) return;	/* No cache directory */
+	if (!access (path, F_OK)) return;	/* Already built (possibly by a concurrent job) */
+	gmt_M_memset (&h, 1, struct GSHHG_INDEX_HEADER);
+	memcpy (h.magic, GSHHG_INDEX_MAGIC, 8U);
+	h.index_version = GSHHG_INDEX_VERSION;
+	h.two_Antarcticas = c->two_Antarcticas;
+	h.n_bin = c->n_bin;	h.n_seg = c->n_seg;	h.n_poly = c->n_poly;
+	if (nc_get_var1_int (c->cdfid, c->n_node_id, start, &h.n_nodes)) return;
+	gmt_M_memcpy (h.version, c->version, GMT_LEN8, char);
+	snprintf (tmp_path, PATH_MAX, "%s.%d", path, (int)getpid ());
+	if ((fp = fopen (tmp_path, "wb")) == NULL) return;	/* Cache directory not writable */
+	if (fwrite (&h, sizeof (struct GSHHG_INDEX_HEADER), 1U, fp) != 1) err = 1;
+	/* Double array: polygon areas, converted to km^2 here if an old integer-area file */
+	darray = gmt_M_memory (GMT, NULL, h.n_poly, double);
+	count[0] = h.n_poly;
+	if (!err) err = nc_get_vara_double (c->cdfid, c->GSHHS_area_id, start, count, darray);
+	if (!err && int_areas) for (i = 0; i < h.n_poly; i++) darray[i] *= 0.1;
+	if (!err && fwrite (darray, sizeof (double), (size_t)h.n_poly, fp) != (size_t)h.n_poly) err = 1;
+	gmt_M_free (GMT, darray);
+	/* Int arrays, in index order */
+	ids[0] = c->bin_firstseg_id;	n[0] = h.n_bin;
+	ids[1] = c->seg_info_id;	n[1] = h.n_seg;
+	ids[2] = c->seg_start_id;	n[2] = h.n_seg;
+	ids[3] = c->seg_GSHHS_ID_id;	n[3] = h.n_seg;
+	ids[4] = c->GSHHS_parent_id;	n[4] = h.n_poly;
+	ids[5] = c->GSHHS_areafrac_id;	n[5] = h.n_poly;
+	ids[6] = c->GSHHS_node_id;	n[6] = h.n_nodes;
+	iarray = gmt_M_memory (GMT, NULL, MAX (h.n_bin, MAX (h.n_seg, MAX (h.n_poly, h.n_nodes))), int);
+	for (k = 0; k < 7 && !err; k++) {
+		count[0] = n[k];
+		if ((err = nc_get_vara_int (c->cdfid, ids[k], start, count, iarray)) == 0 &&
+		    fwrite (iarray, sizeof (int), n[k], fp) != n[k]) err = 1;
+	}
+	gmt_M_free (GMT, iarray);
+	/* Short arrays: node levels (ice), node levels (grounding line; zeros for old files), segment counts */
+	sarray = gmt_M_memory (GMT, NULL, h.n_bin, short int);
+	count[0] = h.n_bin;
+	if (!err && (err = nc_get_vara_short (c->cdfid, c->bin_info_id, start, count, sarray)) == 0 &&
+	    fwrite (sarray, sizeof (short int), (size_t)h.n_bin, fp) != (size_t)h.n_bin) err = 1;
+	if (!err && c->two_Antarcticas)
+		err = nc_get_vara_short (c->cdfid, c->bin_info_id_ANT, start, count, sarray);
+	else
+		gmt_M_memset (sarray, h.n_bin, short int);
+	if (!err && fwrite (sarray, sizeof (short int), (size_t)h.n_bin, fp) != (size_t)h.n_bin) err = 1;
+	if (!err && (err = nc_get_vara_short (c->cdfid, c->bin_nseg_id, start, count, sarray)) == 0 &&
+	    fwrite (sarray, sizeof (short int), (size_t)h.n_bin, fp) != (size_t)h.n_bin) err = 1;
+	gmt_M_free (GMT, sarray);
+	/* Signed char array: per-segment Antarctica flags (zeros for old files) */
+	carray = gmt_M_memory (GMT, NULL, h.n_seg, signed char);
+	count[0] = h.n_seg;
+	if (!err && c->two_Antarcticas)
+		err = nc_get_vara_schar (c->cdfid, c->seg_info_id_ANT, start, count, carray);
+	if (!err && fwrite (carray, sizeof (signed char), (size_t)h.n_seg, fp) != (size_t)h.n_seg) err = 1;
+	gmt_M_free (GMT, carray);
+	fclose (fp);
+	if (err)	/* Incomplete index is worse than none */
+		remove (tmp_path);
+	else if (rename (tmp_path, path))	/* Likely lost the race to a concurrent job; their index is just as good */
+		remove (tmp_path);
+	else
+		GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "Built GSHHG spatial index %s\n", path);
+}
+
 /* Main Public GMT shore functions */
 
 int gmt_shore_version (struct GMTAPI_CTRL *API, char *version) {
@@ -686,6 +932,21 @@ int gmt_init_shore (struct GMT_CTRL *GMT, char res, struct GMT_SHORE *c, double
 	c->bsize = c->bin_size / 60.0;
 	info->bin_size = c->bsize;	/* To make bin size in degrees accessible elsewhere */
 
+	/* At reduced map scales much of the shoreline detail falls below the resolution of the output
+	 * device, so when pscoast is plotting we determine how many dx/dy units correspond to half a
+	 * device dot and let gmt_get_shore_bin collapse point runs within that tolerance.  Segment end
+	 * points are always retained so the bin stitching is unaffected.  Analysis modules that borrow
+	 * the shoreline data (e.g., grdlandmask, gmtselect) must get the full point set. */
+	c->decimate_tol = 0;
+	if (!strncmp (GMT->init.module_name, "pscoast", 7U) && GMT->current.proj.projection_GMT != GMT_NO_PROJ && GMT->current.map.width > 0.0 && wesn[XHI] > wesn[XLO]) {
+		double deg_per_dot = (wesn[XHI] - wesn[XLO]) / (GMT->current.map.width * PSL_DOTS_PER_INCH);	/* Average degrees per device dot across the map */
+		c->decimate_tol = irint (0.5 * deg_per_dot / c->scale);
+		if (c->decimate_tol < 2)	/* Data resolution is already commensurate with the plot scale */
+			c->decimate_tol = 0;
+		else
+			GMT_Report (GMT->parent, GMT_MSG_DEBUG, "gmt_init_shore: Thinning %c shoreline segments with tolerance %d units (%g degrees)\n", res, c->decimate_tol, c->decimate_tol * c->scale);
+	}
+
 	if ((c->bins = gmt_M_memory (GMT, NULL, c->n_bin, int)) == NULL) return 0;
 
 	/* Round off area to nearest multiple of block-dimension */
@@ -718,6 +979,33 @@ int gmt_init_shore (struct GMT_CTRL *GMT, char res, struct GMT_SHORE *c, double
 		gmt_shore_cleanup (GMT, c);	/* Free what we have so far and bail */
 		return (err);
 	}
+
+	if ((two_Antarcticas || (c->ant_mode & GSHHS_ANTARCTICA_ICE)) && gmtshore_index_attach (GMT, c) == GMT_NOERROR) {
+		/* Mapped the spatial index, so copy out what this run needs and skip the netCDF decoding entirely */
+		if ((c->GSHHS_parent = gmt_M_memory (GMT, NULL, c->n_poly, int)) == NULL) return GMT_MEMORY_ERROR;
+		gmt_M_memcpy (c->GSHHS_parent, c->index_parent, c->n_poly, int);
+		if ((c->GSHHS_area = gmt_M_memory (GMT, NULL, c->n_poly, double)) == NULL) return GMT_MEMORY_ERROR;
+		gmt_M_memcpy (c->GSHHS_area, c->index_area, c->n_poly, double);	/* Areas were converted to km^2 when the index was built */
+		if ((c->GSHHS_area_fraction = gmt_M_memory (GMT, NULL, c->n_poly, int)) == NULL) return GMT_MEMORY_ERROR;
+		gmt_M_memcpy (c->GSHHS_area_fraction, c->index_areafrac, c->n_poly, int);
+		if (c->min_area > 0.0 || (info->flag & GSHHS_NO_RIVERLAKES) || (info->flag & GSHHS_NO_LAKES)) {	/* Need the node polygon ids as well */
+			c->n_nodes = c->index_n_nodes;
+			if ((c->GSHHS_node = gmt_M_memory (GMT, NULL, c->n_nodes, int)) == NULL) return GMT_MEMORY_ERROR;
+			gmt_M_memcpy (c->GSHHS_node, c->index_node, c->n_nodes, int);
+		}
+		c->bin_info_g   = gmt_M_memory (GMT, NULL, nb, short);
+		c->bin_info     = gmt_M_memory (GMT, NULL, nb, short);
+		c->bin_nseg     = gmt_M_memory (GMT, NULL, nb, short);
+		c->bin_firstseg = gmt_M_memory (GMT, NULL, nb, int);
+		for (i = 0; i < c->nb; i++) {	/* Scatter the bin information for the selected bins */
+			c->bin_info_g[i]   = c->index_bin_info_ant[c->bins[i]];
+			c->bin_info[i]     = (c->ant_mode & GSHHS_ANTARCTICA_ICE) ? c->index_bin_info[c->bins[i]] : c->index_bin_info_ant[c->bins[i]];
+			c->bin_nseg[i]     = c->index_bin_nseg[c->bins[i]];
+			c->bin_firstseg[i] = c->index_firstseg[c->bins[i]];
+		}
+		return (GMT_NOERROR);
+	}
+
 	count[0] = c->n_poly;
 	if ((c->GSHHS_parent = gmt_M_memory (GMT, NULL, c->n_poly, int)) == NULL) return GMT_MEMORY_ERROR;
 	if ((err = nc_get_vara_int (c->cdfid, c->GSHHS_parent_id, start, count, c->GSHHS_parent))) {
@@ -795,6 +1083,8 @@ int gmt_init_shore (struct GMT_CTRL *GMT, char res, struct GMT_SHORE *c, double
 
 	gmt_M_free (GMT, itmp);
 
+	gmtshore_index_build (GMT, c, int_areas);	/* Try to build the spatial index so later runs can map it */
+
 	return (GMT_NOERROR);
 }
 
@@ -874,18 +1164,24 @@ int gmt_get_shore_bin (struct GMT_CTRL *GMT, unsigned int b, struct GMT_SHORE *c
 	count[0] = c->bin_nseg[b];
 
 	seg_info = gmt_M_memory (GMT, NULL, c->bin_nseg[b], int);
-	if ((err = nc_get_vara_int (c->cdfid, c->seg_info_id, start, count, seg_info))) {
+	if (c->index_base)	/* Segment records are a direct lookup in the mapped index */
+		gmt_M_memcpy (seg_info, &c->index_seg_info[c->bin_firstseg[b]], c->bin_nseg[b], int);
+	else if ((err = nc_get_vara_int (c->cdfid, c->seg_info_id, start, count, seg_info))) {
 		gmt_M_free (GMT, seg_info);
 		return (err);
 	}
 	seg_start = gmt_M_memory (GMT, NULL, c->bin_nseg[b], int);
-	if ((err = nc_get_vara_int (c->cdfid, c->seg_start_id, start, count, seg_start))) {
+	if (c->index_base)
+		gmt_M_memcpy (seg_start, &c->index_seg_start[c->bin_firstseg[b]], c->bin_nseg[b], int);
+	else if ((err = nc_get_vara_int (c->cdfid, c->seg_start_id, start, count, seg_start))) {
 		gmt_M_free (GMT, seg_info);
 		gmt_M_free (GMT, seg_start);
 		return (err);
 	}
 	seg_ID = gmt_M_memory (GMT, NULL, c->bin_nseg[b], int);
-	if ((err = nc_get_vara_int (c->cdfid, c->seg_GSHHS_ID_id, start, count, seg_ID))) {
+	if (c->index_base)
+		gmt_M_memcpy (seg_ID, &c->index_seg_ID[c->bin_firstseg[b]], c->bin_nseg[b], int);
+	else if ((err = nc_get_vara_int (c->cdfid, c->seg_GSHHS_ID_id, start, count, seg_ID))) {
 		gmt_M_free (GMT, seg_info);
 		gmt_M_free (GMT, seg_start);
 		gmt_M_free (GMT, seg_ID);
@@ -894,7 +1190,9 @@ int gmt_get_shore_bin (struct GMT_CTRL *GMT, unsigned int b, struct GMT_SHORE *c
 
 	if (c->two_Antarcticas) {	/* Read the flag that identifies Antarctica polygons */
 		seg_info_ANT = gmt_M_memory (GMT, NULL, c->bin_nseg[b], signed char);
-		if ((err = nc_get_vara_schar (c->cdfid, c->seg_info_id_ANT, start, count, seg_info_ANT))) {
+		if (c->index_base)
+			gmt_M_memcpy (seg_info_ANT, &c->index_seg_ant[c->bin_firstseg[b]], c->bin_nseg[b], signed char);
+		else if ((err = nc_get_vara_schar (c->cdfid, c->seg_info_id_ANT, start, count, seg_info_ANT))) {
 			gmt_M_free (GMT, seg_info);
 			gmt_M_free (GMT, seg_start);
 			gmt_M_free (GMT, seg_ID);
@@ -998,6 +1296,8 @@ int gmt_get_shore_bin (struct GMT_CTRL *GMT, unsigned int b, struct GMT_SHORE *c
 			if (c->two_Antarcticas) gmt_M_free (GMT, seg_info_ANT);
 			return (err);
 		}
+		if (c->decimate_tol && c->seg[s].n > 8)	/* Thin dense segments to match the plot scale */
+			gmtshore_decimate_segment (&c->seg[s], c->decimate_tol);
 	}
 
 	gmt_M_free (GMT, seg_skip);
@@ -1069,6 +1369,7 @@ int gmt_init_br (struct GMT_CTRL *GMT, char which, char res, struct GMT_BR *c, d
 
 	c->scale = (c->bin_size / 60.0) / 65535.0;
 	c->bsize = c->bin_size / 60.0;
+	gmt_M_memcpy (c->wesn, wesn, 4, double);	/* Keep the region so gmt_get_br_bin can cull out-of-region segments */
 
 	c->bins = gmt_M_memory (GMT, NULL, c->n_bin, int);
 
@@ -1184,10 +1485,17 @@ int gmt_get_br_bin (struct GMT_CTRL *GMT, unsigned int b, struct GMT_BR *c, unsi
 				return err;
 			}
 
+		if (gmtshore_br_outside (c, c->seg[s].dx, c->seg[s].dy, c->seg[s].n)) {	/* Entirely outside the region; drop it before any conversion or projection */
+			gmt_M_free (GMT, c->seg[s].dx);
+			gmt_M_free (GMT, c->seg[s].dy);
+			continue;
+		}
+
 		s++;
 	}
 
 	c->ns = s;
+	if (s == 0) gmt_M_free (GMT, c->seg);	/* All segments culled; gmt_free_br only frees seg when ns > 0 */
 
 	gmt_M_free (GMT, seg_n);
 	gmt_M_free (GMT, seg_level);
@@ -1532,6 +1840,7 @@ void gmt_free_br (struct GMT_CTRL *GMT, struct GMT_BR *c) {
 }
 
 void gmt_shore_cleanup (struct GMT_CTRL *GMT, struct GMT_SHORE *c) {
+	gmtshore_index_detach (GMT, c);
 	gmt_M_free (GMT, c->bins);
 	gmt_M_free (GMT, c->bin_info);
 	gmt_M_free (GMT, c->bin_info_g);
@@ -86,6 +86,7 @@ struct GMT_SHORE {	/* Struct used by pscoast and others */
 	int flag;		/* If riverlakes or lakes are to be excluded */
 	int two_Antarcticas;	/* 1 if this GSHHG file contains two Antarctica solutions [v 2.2.x has one] */
 	int fraction;	/* If not 0, the microfraction limit on a polygons area vs the full resolution version */
+	int decimate_tol;	/* If > 1, collapse segment points closer than this many dx/dy units to the plot scale [0 = keep all points] */
 	double min_area;	/* Smallest feature to include in km^2 */
 	double scale;		/* Multiplier to convert dx, dy back to dlon, dlat in degrees */
 
@@ -129,6 +130,17 @@ struct GMT_SHORE {	/* Struct used by pscoast and others */
 	double *GSHHS_area;		/* Array with areas in km^2 of the GSHHS polygons */
 	int *GSHHS_area_fraction;	/* Array with micro-fraction fractions of area relative to full res area  */
 
+	/* Optional memory-mapped spatial index of the file's bin, segment, and polygon tables [index_base is NULL if not in use] */
+
+	unsigned char *index_base;	/* Start of the mapped index file */
+	size_t index_size;		/* Size of the mapped index in bytes */
+	int index_n_nodes;		/* Number of grid nodes according to the index header */
+	double *index_area;		/* The individual arrays inside the mapped index */
+	int *index_firstseg, *index_seg_info, *index_seg_start, *index_seg_ID;
+	int *index_parent, *index_areafrac, *index_node;
+	short int *index_bin_info, *index_bin_info_ant, *index_bin_nseg;
+	signed char *index_seg_ant;
+
 	char units[80];		/* Units of lon/lat */
 	char title[80];		/* Title of data set */
 	char source[80];	/* Source of data set */
@@ -188,6 +200,7 @@ struct GMT_BR {	/* Structure for Borders and Rivers */
 	int nb;		/* Number of bins to use */
 	int *bins;		/* Array with the nb bin numbers to use */
 	double scale;		/* Multiplier to convert dx, dy back to dlon, dlat in degrees */
+	double wesn[4];		/* Region used to select the bins; also used to cull out-of-region segments */
 
 	/* Variables associated with the current bin */
 
@@ -197,11 +197,37 @@ double gmt_stripack_areas (double *V1, double *V2, double *V3) {
 
 /* Functions for spherical surface interpolation */
 
+GMT_LOCAL int64_t gmtsph_unif (struct GMT_CTRL *GMT, int64_t n, double *x, double *y, double *z, double *w, struct STRIPACK_INTERPOLATE *I, int64_t iflgs, double *sigma, double *grad, int64_t n_rows, int64_t n_columns, double *plat, double *plon, double *f) {
+	/* Threaded stand-in for the SSRFPACK UNIF grid loop for the case we always use:
+	 * gradients already estimated at the nodes (IFLGG = 1), so each INTRC1 call only
+	 * reads the triangulation and the evaluations are independent.  Each output column
+	 * goes to one thread and the search hint ist is carried down the column so each
+	 * triangle walk starts from the previous node's triangle.  Returns the number of
+	 * extrapolated nodes, or the first negative INTRC1 error code encountered. */
+	int64_t col, plus = 1, nxp = 0, err = 0;
+#ifdef _OPENMP
+#pragma omp parallel for private(col) shared(GMT,n,x,y,z,w,I,iflgs,sigma,grad,n_rows,n_columns,plat,plon,f,plus,err) reduction(+:nxp)
+#endif
+	for (col = 0; col < n_columns; col++) {
+		int64_t row, ij, ist = 1, ierr;
+		for (row = 0; row < n_rows; row++) {
+			ij = col * n_rows + row;	/* FORTRAN (column-major) order as in UNIF */
+			intrc1_ (&n, &plat[row], &plon[col], x, y, z, w, I->list, I->lptr, I->lend, &iflgs, sigma, &plus, grad, &ist, &f[ij], &ierr);
+			if (ierr > 0) nxp++;
+			if (ierr < 0 && err == 0) {	/* Report the first failure but must finish the loop */
+				GMT_Report (GMT->parent, GMT_MSG_ERROR, "Failure in INTRC1: I = %" PRId64 ", J = %" PRId64 ", IER = %" PRId64 "\n", row, col, ierr);
+				err = ierr;
+			}
+		}
+	}
+	return ((err < 0) ? err : nxp);
+}
+
 int gmt_ssrfpack_grid (struct GMT_CTRL *GMT, double *x, double *y, double *z, double *w, uint64_t n_in, unsigned int mode, double *par, bool vartens, struct GMT_GRID_HEADER *h, double *f) {
 	int error = GMT_NOERROR;
-	int64_t ierror, plus = 1, minus = -1, ij, nxp, k, n = n_in;
+	int64_t ierror, minus = -1, ij, nxp, k, n = n_in;
 	int64_t nm, n_sig, ist, iflgs, iter, itgs, n_columns = h->n_columns, n_rows = h->n_rows;
-	unsigned int row, col;
+	openmp_int row, col;
 	double *sigma = NULL, *grad = NULL, *plon = NULL, *plat = NULL, *wt = NULL, tol = 0.01, dsm, dgmx;
 	struct STRIPACK P;
 
@@ -217,8 +243,8 @@ int gmt_ssrfpack_grid (struct GMT_CTRL *GMT, double *x, double *y, double *z, do
 
 	if ((plon = gmt_M_memory (GMT, NULL, h->n_columns, double)) == NULL) return GMT_MEMORY_ERROR;
 	if ((plat = gmt_M_memory (GMT, NULL, h->n_rows, double)) == NULL) return GMT_MEMORY_ERROR;
-	for (col = 0; col < h->n_columns; col++) plon[col] = D2R * gmt_M_grd_col_to_x (GMT, col, h);
-	for (row = 0; row < h->n_rows; row++) plat[row] = D2R * gmt_M_grd_row_to_y (GMT, row, h);
+	for (col = 0; col < (openmp_int)h->n_columns; col++) plon[col] = D2R * gmt_M_grd_col_to_x (GMT, col, h);
+	for (row = 0; row < (openmp_int)h->n_rows; row++) plat[row] = D2R * gmt_M_grd_row_to_y (GMT, row, h);
 	nm = h->n_columns * h->n_rows;
 
 	/* Time to work on the interpolation */
@@ -226,21 +252,26 @@ int gmt_ssrfpack_grid (struct GMT_CTRL *GMT, double *x, double *y, double *z, do
 	if ((sigma = gmt_M_memory (GMT, NULL, n_sig, double)) == NULL) return GMT_MEMORY_ERROR;
 	if (mode && (grad = gmt_M_memory (GMT, NULL, 3*n, double)) == NULL) return GMT_MEMORY_ERROR;
 
-	if (mode == 0) {	 /* C-0 interpolation (INTRC0). */
+	if (mode == 0) {	 /* C-0 interpolation (INTRC0).  Each output node is evaluated independently
+		 * from the read-only triangulation so the rows can be farmed out to threads; each
+		 * row restarts its own search hint ist so the triangle walks stay local. */
 		nxp = 0;
-		ist = 1;
-		for (row = 0; row < h->n_rows; row++) {
-			for (col = 0; col < h->n_columns; col++) {
+#ifdef _OPENMP
+#pragma omp parallel for private(row,col,ij,ist,ierror) shared(GMT,h,n,plat,plon,x,y,z,w,P,f,error) reduction(+:nxp)
+#endif
+		for (row = 0; row < (openmp_int)h->n_rows; row++) {
+			ist = 1;
+			for (col = 0; col < (openmp_int)h->n_columns; col++) {
 				ij = (uint64_t)col * (uint64_t)h->n_rows + (uint64_t)row; /* Use FORTRAN indexing since calling program will transpose to GMT order */
 				intrc0_ (&n, &plat[row], &plon[col], x, y, z, w, P.I.list, P.I.lptr, P.I.lend, &ist, &f[ij], &ierror);
 				if (ierror > 0) nxp++;
-				if (ierror < 0) {
+				if (ierror < 0 && error == GMT_NOERROR) {	/* Report the first failure but must finish the loop */
 					GMT_Report (GMT->parent, GMT_MSG_ERROR, "Failure in INTRC0: I = %d, J = %d, IER = %" PRId64 "\n", row, col, ierror);
 					error = GMT_RUNTIME_ERROR;
-					goto free_mem;
 				}
 			}
 		}
+		if (error) goto free_mem;
 		GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "INTRC0: Number of evaluations = %" PRId64 ", number of extrapolations = %" PRId64 "\n", nm, nxp);
 	}
 	else if (mode == 1) {	/* C-1 interpolation (INTRC1) with local gradients GRADL. */
@@ -273,7 +304,7 @@ int gmt_ssrfpack_grid (struct GMT_CTRL *GMT, double *x, double *y, double *z, do
 
 		iflgs = 0;
 		if (vartens) iflgs = 1;
-		unif_ (&n, x, y, z, w, P.I.list, P.I.lptr, P.I.lend, &iflgs, sigma, &n_rows, &n_rows, &n_columns, plat, plon, &plus, grad, f, &ierror);
+		ierror = gmtsph_unif (GMT, n, x, y, z, w, &P.I, iflgs, sigma, grad, n_rows, n_columns, plat, plon, f);
 		if (ierror < 0) {
 			GMT_Report (GMT->parent, GMT_MSG_ERROR, "Failure in UNIF: IER = %" PRId64 "\n", ierror);
 			error = GMT_RUNTIME_ERROR;
@@ -321,7 +352,7 @@ int gmt_ssrfpack_grid (struct GMT_CTRL *GMT, double *x, double *y, double *z, do
 		}
 		/* compute interpolated values on the uniform grid (unif). */
 
-		unif_ (&n, x, y, z, w, P.I.list, P.I.lptr, P.I.lend, &iflgs, sigma, &n_rows, &n_rows, &n_columns, plat, plon, &plus, grad, f, &ierror);
+		ierror = gmtsph_unif (GMT, n, x, y, z, w, &P.I, iflgs, sigma, grad, n_rows, n_columns, plat, plon, f);
 		if (ierror < 0) {
 			GMT_Report (GMT->parent, GMT_MSG_ERROR, "Failure in UNIF: IER = %" PRId64 "\n", ierror);
 			error = GMT_RUNTIME_ERROR;
@@ -371,7 +402,7 @@ int gmt_ssrfpack_grid (struct GMT_CTRL *GMT, double *x, double *y, double *z, do
 			}
 		}
 		/* compute interpolated values on the uniform grid (unif). */
-		unif_ (&n, x, y, z, w, P.I.list, P.I.lptr, P.I.lend, &iflgs, sigma, &n_rows, &n_rows, &n_columns, plat, plon, &plus, grad, f, &ierror);
+		ierror = gmtsph_unif (GMT, n, x, y, z, w, &P.I, iflgs, sigma, grad, n_rows, n_columns, plat, plon, f);
 		gmt_M_free (GMT, wt);
 		if (ierror < 0) {
 			GMT_Report (GMT->parent, GMT_MSG_ERROR, "Failure in UNIF: ier = %" PRId64 "\n", ierror);
@@ -26,7 +26,9 @@
  *	gmt_Fcrit
  *	gmt_PvQv
  *	gmt_bei
+ *	gmt_bei_f_n
  *	gmt_ber
+ *	gmt_ber_f_n
  *	gmt_binom_cdf
  *	gmt_binom_pdf
  *	gmt_chebyshev
@@ -70,6 +72,7 @@
  *	gmt_mode_f
  *	gmt_mode_weighted
  *	gmt_nrand
+ *	gmt_order_statistics_f
  *	gmt_permutation
  *	gmt_plm
  *	gmt_plm_bar
@@ -79,6 +82,8 @@
  *	gmt_psi
  *	gmt_quantile
  *	gmt_quantile_f
+ *	gmt_quantile_f_inplace
+ *	gmt_quantile_inplace
  *	gmt_quantile_weighted
  *	gmt_rand
  *	gmt_sig_f
@@ -756,6 +761,48 @@ double gmt_bei (struct GMT_CTRL *GMT, double x) {
 	}
 }
 
+#define GMT_STAT_BATCH_CHUNK 128	/* Nodes handled per batch pass; small enough to keep the scratch array in L1 */
+
+void gmt_ber_f_n (struct GMT_CTRL *GMT, gmt_grdfloat *x, uint64_t n) {
+	/* Evaluate ber in place for n grid nodes.  The telescoped Abramowitz & Stegun
+	 * series (|x| <= 8, absolute error < 1e-8 per A&S 9.11.9) is computed for every
+	 * node in a branch-free inner loop that compilers can auto-vectorize; the nodes
+	 * that fall in the asymptotic range are then fixed up via the scalar gmt_ber.
+	 * NaNs fail the fix-up test and propagate through the series unchanged. */
+	uint64_t k0, j, m;
+	double t, ax[GMT_STAT_BATCH_CHUNK];
+
+	for (k0 = 0; k0 < n; k0 += m) {
+		m = MIN (n - k0, GMT_STAT_BATCH_CHUNK);
+		for (j = 0; j < m; j++) ax[j] = fabs ((double)x[k0+j]);	/* ber is an even function of x */
+		for (j = 0; j < m; j++) {	/* Vectorizable series pass */
+			t = ax[j] * 0.125;
+			t *= t;
+			t *= t;	/* t = pow(x/8, 4)  */
+			x[k0+j] = (gmt_grdfloat)(1.0 + t*(-64.0 + t*(113.77777774 + t*(-32.36345652 + t*(2.64191397 + t*(-0.08349609 + t*(0.00122552 - 0.00000901 * t)))))));
+		}
+		for (j = 0; j < m; j++) if (ax[j] > 8.0) x[k0+j] = (gmt_grdfloat)gmt_ber (GMT, ax[j]);
+	}
+}
+
+void gmt_bei_f_n (struct GMT_CTRL *GMT, gmt_grdfloat *x, uint64_t n) {
+	/* Evaluate bei in place for n grid nodes; see gmt_ber_f_n for the scheme and accuracy. */
+	uint64_t k0, j, m;
+	double t, s, ax[GMT_STAT_BATCH_CHUNK];
+
+	for (k0 = 0; k0 < n; k0 += m) {
+		m = MIN (n - k0, GMT_STAT_BATCH_CHUNK);
+		for (j = 0; j < m; j++) ax[j] = fabs ((double)x[k0+j]);	/* bei is an even function of x */
+		for (j = 0; j < m; j++) {	/* Vectorizable series pass */
+			t = ax[j] * 0.125;
+			s = t * t;
+			t = s * s;	/* t = pow(x/8, 4)  */
+			x[k0+j] = (gmt_grdfloat)(s * (16.0 + t*(-113.77777774 + t*(72.81777742 + t*(-10.56765779 + t*(0.52185615 + t*(-0.01103667 + t*(0.00011346))))))));
+		}
+		for (j = 0; j < m; j++) if (ax[j] > 8.0) x[k0+j] = (gmt_grdfloat)gmt_bei (GMT, ax[j]);
+	}
+}
+
 double gmt_ker (struct GMT_CTRL *GMT, double x) {
 	double t, rxsq, alpha, beta;
 
@@ -2285,6 +2332,226 @@ double gmt_quantile_f (struct GMT_CTRL *GMT, gmt_grdfloat *x, double q, uint64_t
 	return (p);
 }
 
+#define GMTSTAT_SELECT_CUTOFF	24	/* Ranges this small are finished off by insertion sort */
+
+GMT_LOCAL void gmtstat_isort (double *x, uint64_t lo, uint64_t hi) {
+	/* Insertion sort of x[lo..hi], used for the small ranges in the selection below */
+	uint64_t i, j;
+	double v;
+	for (i = lo + 1; i <= hi; i++) {
+		v = x[i];
+		for (j = i; j > lo && x[j-1] > v; j--) x[j] = x[j-1];
+		x[j] = v;
+	}
+}
+
+GMT_LOCAL double gmtstat_mom_pivot (double *x, uint64_t lo, uint64_t hi) {
+	/* Median-of-medians pivot: sort each group of 5, gather the group medians at the
+	 * front of the range, then recurse on those.  Guarantees a pivot with a fixed
+	 * fraction of the range on either side so the selection cannot go quadratic. */
+	uint64_t i, sub_hi, m = lo;
+	for (i = lo; i <= hi; i += 5) {
+		sub_hi = MIN (i + 4, hi);
+		gmtstat_isort (x, i, sub_hi);
+		gmt_M_double_swap (x[m], x[(i + sub_hi) / 2]);
+		m++;
+	}
+	if (m - lo <= 5) {	/* Few enough medians to finish directly */
+		gmtstat_isort (x, lo, m - 1);
+		return (x[lo+(m-lo-1)/2]);
+	}
+	return (gmtstat_mom_pivot (x, lo, m - 1));
+}
+
+GMT_LOCAL void gmtstat_selection (double *x, uint64_t n, uint64_t k) {
+	/* Introselect: rearrange x so that x[k] holds the value it would have after a full
+	 * sort, with smaller values before it and larger values after it.  We use quickselect
+	 * with median-of-three pivots and switch to the median-of-medians pivot if the
+	 * recursion depth budget is exhausted (pathological inputs). */
+	uint64_t lo = 0, hi = n - 1, mid, i, lt, gt;
+	unsigned int depth = 0;
+	double v;
+	for (i = n; i; i >>= 1) depth += 2;	/* Depth budget of ~2 log2(n) partitions */
+	while (hi > lo) {
+		if (hi - lo < GMTSTAT_SELECT_CUTOFF) {	/* Just sort this little bit */
+			gmtstat_isort (x, lo, hi);
+			return;
+		}
+		if (depth) {	/* Median-of-three of the ends and middle as pivot */
+			mid = lo + (hi - lo) / 2;
+			if (x[mid] < x[lo]) gmt_M_double_swap (x[mid], x[lo]);
+			if (x[hi]  < x[lo]) gmt_M_double_swap (x[hi],  x[lo]);
+			if (x[hi]  < x[mid]) gmt_M_double_swap (x[hi], x[mid]);
+			v = x[mid];
+			depth--;
+		}
+		else	/* Too many bad partitions; get a guaranteed-good pivot instead */
+			v = gmtstat_mom_pivot (x, lo, hi);
+		/* Three-way partition around the pivot value v */
+		lt = i = lo;	gt = hi;
+		while (i <= gt) {
+			if (x[i] < v) {
+				gmt_M_double_swap (x[lt], x[i]);
+				lt++;	i++;
+			}
+			else if (x[i] > v) {
+				gmt_M_double_swap (x[i], x[gt]);
+				gt--;
+			}
+			else
+				i++;
+		}
+		if (k < lt)	/* The k'th value sits among the smaller ones */
+			hi = lt - 1;
+		else if (k > gt)	/* Among the larger ones */
+			lo = gt + 1;
+		else	/* x[k] now equals the pivot; we are done */
+			return;
+	}
+}
+
+double gmt_quantile_inplace (struct GMT_CTRL *GMT, double *x, double q, uint64_t n) {
+	/* Returns the q'th (q in percent) quantile of x without requiring a pre-sorted array;
+	 * q is expected to be 0 <= q <= 100.  Any NaNs are swept out first, then the value is
+	 * found by selection in O(n) rather than by a full O(n log n) sort.  The array is
+	 * partially reordered in the process, hence only pass scratch arrays here.  Results
+	 * match gmt_quantile on the sorted version of the same array. */
+	uint64_t i, m, i_f;
+	double f, df, hi;
+
+	for (i = m = 0; i < n; i++) {	/* Sweep away any NaNs */
+		if (gmt_M_is_dnan (x[i])) continue;
+		if (m < i) x[m] = x[i];
+		m++;
+	}
+	if (m == 0) return (GMT->session.d_NaN);	/* No data, so no defined quantile */
+	else if (m == 1) return (x[0]);			/* Single point so is also any quantile */
+	f = (m - 1) * q / 100.0;
+	i_f = (uint64_t)floor (f);
+	gmtstat_selection (x, m, i_f);
+	if ((df = (f - (double)i_f)) > 0.0) {		/* Must interpolate between the two neighbors */
+		for (hi = x[i_f+1], i = i_f + 2; i < m; i++) if (x[i] < hi) hi = x[i];	/* Smallest value above the k'th */
+		return (hi * df + x[i_f] * (1.0 - df));
+	}
+	return (x[i_f]);	/* Exactly on a node */
+}
+
+GMT_LOCAL void gmtstat_isort_f (gmt_grdfloat *x, uint64_t lo, uint64_t hi) {
+	/* Float version of gmtstat_isort */
+	uint64_t i, j;
+	gmt_grdfloat v;
+	for (i = lo + 1; i <= hi; i++) {
+		v = x[i];
+		for (j = i; j > lo && x[j-1] > v; j--) x[j] = x[j-1];
+		x[j] = v;
+	}
+}
+
+GMT_LOCAL gmt_grdfloat gmtstat_mom_pivot_f (gmt_grdfloat *x, uint64_t lo, uint64_t hi) {
+	/* Float version of gmtstat_mom_pivot */
+	uint64_t i, sub_hi, m = lo;
+	for (i = lo; i <= hi; i += 5) {
+		sub_hi = MIN (i + 4, hi);
+		gmtstat_isort_f (x, i, sub_hi);
+		gmt_M_grdfloat_swap (x[m], x[(i + sub_hi) / 2]);
+		m++;
+	}
+	if (m - lo <= 5) {	/* Few enough medians to finish directly */
+		gmtstat_isort_f (x, lo, m - 1);
+		return (x[lo+(m-lo-1)/2]);
+	}
+	return (gmtstat_mom_pivot_f (x, lo, m - 1));
+}
+
+GMT_LOCAL void gmtstat_selection_f (gmt_grdfloat *x, uint64_t n, uint64_t k) {
+	/* Float version of gmtstat_selection; see that function for the algorithm */
+	uint64_t lo = 0, hi = n - 1, mid, i, lt, gt;
+	unsigned int depth = 0;
+	gmt_grdfloat v;
+	for (i = n; i; i >>= 1) depth += 2;	/* Depth budget of ~2 log2(n) partitions */
+	while (hi > lo) {
+		if (hi - lo < GMTSTAT_SELECT_CUTOFF) {	/* Just sort this little bit */
+			gmtstat_isort_f (x, lo, hi);
+			return;
+		}
+		if (depth) {	/* Median-of-three of the ends and middle as pivot */
+			mid = lo + (hi - lo) / 2;
+			if (x[mid] < x[lo]) gmt_M_grdfloat_swap (x[mid], x[lo]);
+			if (x[hi]  < x[lo]) gmt_M_grdfloat_swap (x[hi],  x[lo]);
+			if (x[hi]  < x[mid]) gmt_M_grdfloat_swap (x[hi], x[mid]);
+			v = x[mid];
+			depth--;
+		}
+		else	/* Too many bad partitions; get a guaranteed-good pivot instead */
+			v = gmtstat_mom_pivot_f (x, lo, hi);
+		/* Three-way partition around the pivot value v */
+		lt = i = lo;	gt = hi;
+		while (i <= gt) {
+			if (x[i] < v) {
+				gmt_M_grdfloat_swap (x[lt], x[i]);
+				lt++;	i++;
+			}
+			else if (x[i] > v) {
+				gmt_M_grdfloat_swap (x[i], x[gt]);
+				gt--;
+			}
+			else
+				i++;
+		}
+		if (k < lt)	/* The k'th value sits among the smaller ones */
+			hi = lt - 1;
+		else if (k > gt)	/* Among the larger ones */
+			lo = gt + 1;
+		else	/* x[k] now equals the pivot; we are done */
+			return;
+	}
+}
+
+double gmt_quantile_f_inplace (struct GMT_CTRL *GMT, gmt_grdfloat *x, double q, uint64_t n) {
+	/* Float version of gmt_quantile_inplace; see that function for the details */
+	uint64_t i, m, i_f;
+	double f, df, hi;
+
+	for (i = m = 0; i < n; i++) {	/* Sweep away any NaNs */
+		if (gmt_M_is_fnan (x[i])) continue;
+		if (m < i) x[m] = x[i];
+		m++;
+	}
+	if (m == 0) return (GMT->session.d_NaN);	/* No data, so no defined quantile */
+	else if (m == 1) return ((double)x[0]);		/* Single point so is also any quantile */
+	f = (m - 1) * q / 100.0;
+	i_f = (uint64_t)floor (f);
+	gmtstat_selection_f (x, m, i_f);
+	if ((df = (f - (double)i_f)) > 0.0) {		/* Must interpolate between the two neighbors */
+		for (hi = x[i_f+1], i = i_f + 2; i < m; i++) if (x[i] < hi) hi = x[i];	/* Smallest value above the k'th */
+		return (hi * df + (double)x[i_f] * (1.0 - df));
+	}
+	return ((double)x[i_f]);	/* Exactly on a node */
+}
+
+GMT_LOCAL void gmtstat_multi_selection_f (gmt_grdfloat *x, uint64_t lo, uint64_t hi, uint64_t *k, uint64_t k_lo, uint64_t k_hi) {
+	/* Place each requested rank k[k_lo..k_hi] (ascending, unique, within lo..hi) at its sorted
+	 * position in x[lo..hi].  Selecting the middle rank first partitions the range so the lower
+	 * and higher ranks can then be found independently in the two halves. */
+	uint64_t k_mid = k_lo + (k_hi - k_lo) / 2, kk = k[k_mid];
+	gmtstat_selection_f (&x[lo], hi - lo + 1, kk - lo);
+	if (k_mid > k_lo && kk > lo)
+		gmtstat_multi_selection_f (x, lo, kk - 1, k, k_lo, k_mid - 1);
+	if (k_mid < k_hi && kk < hi)
+		gmtstat_multi_selection_f (x, kk + 1, hi, k, k_mid + 1, k_hi);
+}
+
+void gmt_order_statistics_f (struct GMT_CTRL *GMT, gmt_grdfloat *x, uint64_t n, uint64_t *k, uint64_t nk) {
+	/* Rearrange x (which must have no NaNs) so that each entry x[k[i]] holds the value a full
+	 * ascending sort would place there; the nk ranks in k must be ascending, unique and < n.
+	 * Like gmt_quantile_f_inplace this partially reorders x, so only pass scratch arrays here.
+	 * The average cost is O(n log nk) versus O(n log n) for a full sort, which is a large
+	 * saving when only a few ranks are needed (e.g., the cell boundaries in grdhisteq). */
+	gmt_M_unused (GMT);
+	if (n == 0 || nk == 0) return;
+	gmtstat_multi_selection_f (x, 0, n - 1, k, 0, nk - 1);
+}
+
 double gmt_psi (struct GMT_CTRL *P, double zz[], double p[]) {
 /* Psi     Psi (or Digamma) function for complex arguments z.
 *
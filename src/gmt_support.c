@@ -200,6 +200,10 @@
  *	gmt_save_current_cpt
  *	gmt_scale_cpt
  *	gmt_scale_pen
+ *	gmt_scanline_build
+ *	gmt_scanline_free
+ *	gmt_scanline_init
+ *	gmt_scanline_side
  *	gmt_script_is_classic
  *	gmt_segmentize_data
  *	gmt_set_comment
@@ -228,6 +232,12 @@
  *	gmt_substitute_macros
  *	gmt_symbol_free
  *	gmt_testing
+ *	gmt_thread_pool_submit
+ *	gmt_thread_pool_wait
+ *	gmt_tin_create
+ *	gmt_tin_free
+ *	gmt_tin_insert
+ *	gmt_tin_triangles
  *	gmt_token_check
  *	gmt_trim_line
  *	gmt_trim_requested
@@ -276,6 +286,7 @@
  *	gmtlib_init_cpt
  *	gmtlib_init_rot_matrix
  *	gmtlib_inplace_transpose
+ *	gmtlib_intpol_many
  *	gmtlib_invalid_symbolname
  *	gmtlib_is_color
  *	gmtlib_last_valid_file_modifier
@@ -293,6 +304,7 @@
  *	gmtlib_set_current_item_file
  *	gmtlib_smooth_spline
  *	gmtlib_split_line_at_dateline
+ *	gmtlib_thread_pool_destroy
  *	gmtlib_time_array
  *	gmtlib_var_inc
  *	gmtlib_write_cpt
@@ -2045,6 +2057,48 @@ GMT_LOCAL void gmtsupport_intpol_reverse (double *x, double *u, uint64_t n, uint
 	for (i = 0; i < m; i++) u[i] = -u[i];
 }
 
+/*! . */
+GMT_LOCAL int gmtsupport_intpol_one (struct GMT_CTRL *GMT, double *x, double *y, double *w, uint64_t n, uint64_t m, double *u, double *v, double p, int mode, bool clean) {
+	/* Interpolate a single data column whose x is known to be monotonically increasing.
+	 * If clean is true there are no NaNs in y; otherwise we interpolate section by section. */
+	uint64_t i, this_n, this_m, start_i, start_j, stop_i, stop_j;
+	int err_flag = 0;
+	double *wp = NULL;
+
+	if (clean)	/* No NaNs to worry about */
+		return (gmtsupport_intpol_sub (GMT, x, y, w, n, m, u, v, p, mode));
+
+	/* Here input has NaNs so we need to treat it section by section */
+
+	for (i = 0; i < m; i++) v[i] = GMT->session.d_NaN;	/* Initialize all output to NaN */
+	start_i = start_j = 0;
+	while (start_i < n && gmt_M_is_dnan (y[start_i])) start_i++;	/* First non-NaN data point */
+	while (start_i < n && start_j < m) {
+		stop_i = start_i + 1;
+		while (stop_i < n && !gmt_M_is_dnan (y[stop_i])) stop_i++;	/* Wind to next NaN point (or past end of array) */
+		this_n = stop_i - start_i;	/* Number of clean points to interpolate from */
+		stop_i--;			/* Now stop_i is the ID of the last usable point */
+		if (this_n == 1) {		/* Not enough to interpolate, just skip this single point */
+			start_i++;	/* Skip to next point (which is NaN) */
+			while (start_i < n && gmt_M_is_dnan (y[start_i])) start_i++;	/* Wind to next non-NaN data point */
+			continue;
+		}
+		/* OK, have enough points to interpolate; find corresponding output section */
+		while (start_j < m && u[start_j] < x[start_i]) start_j++;
+		if (start_j == m) continue;	/* Ran out of points */
+		stop_j = start_j;
+		while (stop_j < m && u[stop_j] <= x[stop_i]) stop_j++;
+		this_m = stop_j - start_j;	/* Number of output points to interpolate to */
+		wp = (w) ? &w[start_j] : NULL;
+		err_flag = gmtsupport_intpol_sub (GMT, &x[start_i], &y[start_i], wp, this_n, this_m, &u[start_j], &v[start_j], p, mode);
+		if (err_flag != GMT_NOERROR) return (err_flag);
+		start_i = stop_i + 1;	/* Move to point after last usable point in current section */
+		while (start_i < n && gmt_M_is_dnan (y[start_i])) start_i++;	/* Next section's first non-NaN data point */
+	}
+
+	return (GMT_NOERROR);
+}
+
 /*! Non-square matrix transpose of matrix of size r x c and base address A */
 GMT_LOCAL unsigned int gmtsupport_is_set (unsigned int *mark, uint64_t k, unsigned int *bits) {
 	/* Return nonzero if this bit is set */
@@ -2065,6 +2119,12 @@ GMT_LOCAL void gmtsupport_set_bit (unsigned int *mark, uint64_t k, unsigned int
 GMT_LOCAL void gmtsupport_decorate_free (struct GMT_CTRL *GMT, struct GMT_DECORATE *G) {
 	/* Free memory used by decorate */
 
+	if (G->ylist_X) {	/* Free the cached y-sorted indexes for the crossing lines */
+		uint64_t line_no;
+		for (line_no = 0; line_no < G->X->n_segments; line_no++)
+			gmt_M_free (GMT, G->ylist_X[line_no]);
+		gmt_M_free (GMT, G->ylist_X);
+	}
 	GMT_Destroy_Data (GMT->parent, &(G->X));
 	if (G->f_n) {	/* Array for fixed points */
 		gmt_M_free (GMT, G->f_xy[GMT_X]);
@@ -3105,7 +3165,7 @@ GMT_LOCAL void gmtsupport_hold_contour_sub (struct GMT_CTRL *GMT, double **xxx,
 	uint64_t i, j, start = 0;
 	size_t n_alloc = GMT_SMALL_CHUNK;
 	double *track_dist = NULL, *map_dist = NULL, *value_dist = NULL, *radii = NULL, *xx = NULL, *yy = NULL;
-	double dx, dy, width, f, this_dist, step, stept, this_value_dist, lon[2], lat[2];
+	double dx, dy, width, f, this_dist, step, stept, this_value_dist, *lon = NULL, *lat = NULL;
 	struct GMT_LABEL *new_label = NULL;
 	char this_label[GMT_BUFSIZ] = {""};
 
@@ -3120,7 +3180,16 @@ GMT_LOCAL void gmtsupport_hold_contour_sub (struct GMT_CTRL *GMT, double **xxx,
 
 		/* Calculate distance along contour and store in track_dist array */
 
-		if (G->dist_kind == 1) gmt_xy_to_geo (GMT, &lon[1], &lat[1], xx[0], yy[0]);
+		if (G->dist_kind == 1 || G->label_type == GMT_LABEL_IS_MDIST) {	/* Precompute lon,lat at all vertices since the inverse projections are independent */
+			int64_t k;	/* Must be signed due to OpenMP indexing */
+			if ((lon = gmt_M_memory (GMT, NULL, nn, double)) == NULL) return;
+			if ((lat = gmt_M_memory (GMT, NULL, nn, double)) == NULL) return;
+#ifdef _OPENMP
+#pragma omp parallel for private(k) shared(GMT,lon,lat,xx,yy,nn)
+#endif
+			for (k = 0; k < (int64_t)nn; k++)
+				gmt_xy_to_geo (GMT, &lon[k], &lat[k], xx[k], yy[k]);
+		}
 		if ((map_dist = gmt_M_memory (GMT, NULL, nn, double)) == NULL) return;	/* Distances on map in inches */
 		if ((track_dist = gmt_M_memory (GMT, NULL, nn, double)) == NULL) return;	/* May be km ,degrees or whatever */
 		if ((value_dist = gmt_M_memory (GMT, NULL, nn, double)) == NULL) return;	/* May be km ,degrees or whatever */
@@ -3155,16 +3224,16 @@ GMT_LOCAL void gmtsupport_hold_contour_sub (struct GMT_CTRL *GMT, double **xxx,
 			step = stept = hypot (dx, dy);
 			map_dist[i] = map_dist[i-1] + step;
 			if (G->dist_kind == 1 || G->label_type == GMT_LABEL_IS_MDIST) {
-				lon[0] = lon[1];	lat[0] = lat[1];
-				gmt_xy_to_geo (GMT, &lon[1], &lat[1], xx[i], yy[i]);
-				if (G->dist_kind == 1) step = gmtlib_distance_type (GMT, lon[0], lat[0], lon[1], lat[1], GMT_CONT_DIST);
-				if (G->label_type == GMT_LABEL_IS_MDIST) stept = gmtlib_distance_type (GMT, lon[0], lat[0], lon[1], lat[1], GMT_LABEL_DIST);
+				if (G->dist_kind == 1) step = gmtlib_distance_type (GMT, lon[i-1], lat[i-1], lon[i], lat[i], GMT_CONT_DIST);
+				if (G->label_type == GMT_LABEL_IS_MDIST) stept = gmtlib_distance_type (GMT, lon[i-1], lat[i-1], lon[i], lat[i], GMT_LABEL_DIST);
 			}
 			if (radii[i] < G->min_radius) step = stept = 0.0;	/* If curvature is too great we simply don't add up distances */
 			track_dist[i] = track_dist[i-1] + step;
 			value_dist[i] = value_dist[i-1] + stept;
 		}
 		gmt_M_free (GMT, radii);
+		if (lon) gmt_M_free (GMT, lon);
+		if (lat) gmt_M_free (GMT, lat);
 
 		/* G->L array is only used so we can later sort labels based on distance along track.  Once
 		 * GMT_contlabel_draw has been called we will free up the memory as the labels are kept in
@@ -3298,11 +3367,16 @@ GMT_LOCAL void gmtsupport_hold_contour_sub (struct GMT_CTRL *GMT, double **xxx,
 			uint64_t left, right, line_no;
 			struct GMT_DATASEGMENT *S = NULL;
 			gmt_init_track (GMT, yy, nn, &(G->ylist));
+			if (G->ylist_X == NULL && G->X->n_segments) {	/* First time; build the y-sorted segment indexes for the crossing lines and reuse them for all contours */
+				if ((G->ylist_X = gmt_M_memory (GMT, NULL, G->X->n_segments, struct GMT_XSEGMENT *)) == NULL) return;
+				for (line_no = 0; line_no < G->X->n_segments; line_no++) {
+					S = G->X->table[0]->segment[line_no];
+					gmt_init_track (GMT, S->data[GMT_Y], S->n_rows, &(G->ylist_X[line_no]));
+				}
+			}
 			for (line_no = 0; line_no < G->X->n_segments; line_no++) {	/* For each of the crossing lines */
 				S = G->X->table[0]->segment[line_no];	/* Current segment */
-				gmt_init_track (GMT, S->data[GMT_Y], S->n_rows, &(G->ylist_XP));
-				G->nx = (unsigned int)gmt_crossover (GMT, S->data[GMT_X], S->data[GMT_Y], NULL, G->ylist_XP, S->n_rows, xx, yy, NULL, G->ylist, nn, false, gmt_M_x_is_lon (GMT, GMT_IN), &G->XC);
-				gmt_M_free (GMT, G->ylist_XP);
+				G->nx = (unsigned int)gmt_crossover (GMT, S->data[GMT_X], S->data[GMT_Y], NULL, G->ylist_X[line_no], S->n_rows, xx, yy, NULL, G->ylist, nn, false, gmt_M_x_is_lon (GMT, GMT_IN), &G->XC);
 				if (G->nx == 0) continue;
 
 				/* OK, we found intersections for labels */
@@ -3551,11 +3625,16 @@ GMT_LOCAL void gmtsupport_decorated_line_sub (struct GMT_CTRL *GMT, double *xx,
 		uint64_t left, right, line_no;
 		struct GMT_DATASEGMENT *Sd = NULL;
 		gmt_init_track (GMT, yy, nn, &(G->ylist));
+		if (G->ylist_X == NULL && G->X->n_segments) {	/* First time; build the y-sorted segment indexes for the crossing lines and reuse them for all lines */
+			if ((G->ylist_X = gmt_M_memory (GMT, NULL, G->X->n_segments, struct GMT_XSEGMENT *)) == NULL) return;
+			for (line_no = 0; line_no < G->X->n_segments; line_no++) {
+				Sd = G->X->table[0]->segment[line_no];
+				gmt_init_track (GMT, Sd->data[GMT_Y], Sd->n_rows, &(G->ylist_X[line_no]));
+			}
+		}
 		for (line_no = 0; line_no < G->X->n_segments; line_no++) {	/* For each of the crossing lines */
 			Sd = G->X->table[0]->segment[line_no];	/* Current segment */
-			gmt_init_track (GMT, Sd->data[GMT_Y], Sd->n_rows, &(G->ylist_XP));
-			G->nx = (unsigned int)gmt_crossover (GMT, Sd->data[GMT_X], Sd->data[GMT_Y], NULL, G->ylist_XP, Sd->n_rows, xx, yy, NULL, G->ylist, nn, false, gmt_M_x_is_lon (GMT, GMT_IN), &G->XC);
-			gmt_M_free (GMT, G->ylist_XP);
+			G->nx = (unsigned int)gmt_crossover (GMT, Sd->data[GMT_X], Sd->data[GMT_Y], NULL, G->ylist_X[line_no], Sd->n_rows, xx, yy, NULL, G->ylist, nn, false, gmt_M_x_is_lon (GMT, GMT_IN), &G->XC);
 			if (G->nx == 0) continue;
 
 			/* OK, we found intersections for labels */
@@ -4356,102 +4435,105 @@ GMT_LOCAL int gmtsupport_sort_pair (const void *p_1, const void *p_2) {
 	return 0;
 }
 
-/* Leave link as int**, not int** */
-/*! . */
-GMT_LOCAL uint64_t gmtsupport_delaunay_watson (struct GMT_CTRL *GMT, double *x_in, double *y_in, uint64_t n, int **link) {
-	/* Input point x coordinates */
-	/* Input point y coordinates */
-	/* Number of input points */
-	/* pointer to List of point ids per triangle.  Vertices for triangle no i
-	   is in link[i*3], link[i*3+1], link[i*3+2] */
+struct GMT_TIN {	/* Opaque state for an incremental Watson triangulation; see gmt_tin_create */
+	uint64_t n;		/* Number of vertices so far, including the 3 supertriangle corners */
+	uint64_t n_alloc;	/* Allocated length of the x, y arrays */
+	uint64_t size;		/* Allocated number of triangle slots */
+	uint64_t isp, id;	/* Watson bookkeeping: triangle slots in use and free-stack position */
+	double xmin, ymin, i_scale;	/* Normalization mapping the domain onto the 0-1 square */
+	double *x, *y;		/* Normalized coordinates; the first 3 are the supertriangle */
+	int *index;		/* 3 vertex ids per triangle slot */
+	int64_t *istack, *x_tmp, *y_tmp;	/* Free-slot stack and scratch edge lists */
+	double *x_circum, *y_circum, *r2_circum;	/* Circumcircle centers and radii squared */
+};
 
-	int *index = NULL;	/* Must be int not uint64_t */
-	int ix[3], iy[3];
+/*! . */
+struct GMT_TIN * gmt_tin_create (struct GMT_CTRL *GMT, double wesn[], uint64_t n_expected) {
+	/* Start an incremental Delaunay triangulation using Watson's ACORD insertion algorithm
+	 * [Computers & Geosciences, 8, 97-101, 1982].  All points inserted later must fall inside
+	 * the wesn domain given here since it anchors the supertriangle and the normalization.
+	 * n_expected is just an allocation hint; the structure grows as batches are inserted.
+	 * The returned handle lives until gmt_tin_free so acquisition-style workflows can append
+	 * batches of points and re-extract triangles without rebuilding from scratch. */
+	uint64_t i;
+	struct GMT_TIN *T = gmt_M_memory (GMT, NULL, 1, struct GMT_TIN);
+
+	if (T == NULL) return (NULL);
+	if (n_expected < GMT_CHUNK) n_expected = GMT_CHUNK;
+	T->n_alloc = n_expected + 3;	/* Room for the supertriangle as well */
+	T->size = 10 * n_expected + 1;
+	T->x = gmt_M_memory (GMT, NULL, T->n_alloc, double);
+	T->y = gmt_M_memory (GMT, NULL, T->n_alloc, double);
+	T->index = gmt_M_memory (GMT, NULL, 3 * T->size, int);
+	T->istack = gmt_M_memory (GMT, NULL, T->size, int64_t);
+	T->x_tmp = gmt_M_memory (GMT, NULL, T->size, int64_t);
+	T->y_tmp = gmt_M_memory (GMT, NULL, T->size, int64_t);
+	T->x_circum = gmt_M_memory (GMT, NULL, T->size, double);
+	T->y_circum = gmt_M_memory (GMT, NULL, T->size, double);
+	T->r2_circum = gmt_M_memory (GMT, NULL, T->size, double);
+	if (T->x == NULL || T->y == NULL || T->index == NULL || T->istack == NULL || T->x_tmp == NULL \
+		|| T->y_tmp == NULL || T->x_circum == NULL || T->y_circum == NULL || T->r2_circum == NULL) {
+		gmt_tin_free (GMT, &T);
+		return (NULL);
+	}
+	/* Place the supertriangle, which covers the entire normalized 0-1 square */
+	T->x[0] = T->x[1] = -1.0;	T->x[2] = 5.0;
+	T->y[0] = T->y[2] = -1.0;	T->y[1] = 5.0;
+	T->x_circum[0] = T->y_circum[0] = 2.0;	T->r2_circum[0] = 18.0;
+	for (i = 0; i < 3; i++) T->index[i] = (int)i;
+	for (i = 0; i < T->size; i++) T->istack[i] = i;
+	T->isp = T->id = 1;
+	T->n = 3;
+	T->xmin = wesn[XLO];	T->ymin = wesn[YLO];
+	T->i_scale = 1.0 / MAX (wesn[XHI] - wesn[XLO], wesn[YHI] - wesn[YLO]);
+	return (T);
+}
+
+/*! . */
+int gmt_tin_insert (struct GMT_CTRL *GMT, struct GMT_TIN *T, double *x_in, double *y_in, uint64_t n) {
+	/* Insert a batch of n points into the live triangulation.  This is the insertion loop from
+	 * Watson's algorithm operating on the persistent state, so appending a small batch only
+	 * costs the insertions, not a rebuild of everything triangulated earlier. */
+	int ix[3] = {0, 0, 1}, iy[3] = {1, 2, 2};
 	bool done;
-	uint64_t i, j, nuc, ij, jt, km, id, isp, l1, l2, k, k1, jz, i2, kmt, kt, size;
-	int64_t *istack = NULL, *x_tmp = NULL, *y_tmp = NULL;
-	double det[2][3], *x_circum = NULL, *y_circum = NULL, *r2_circum = NULL, *x = NULL, *y = NULL;
-	double xmin, xmax, ymin, ymax, datax, dx, dy, dsq, dd;
-
-	GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "Delaunay triangulation calculated by Dave Watson's ACORD [Computers & Geosciences, 8, 97-101, 1982]\n");
-
-	{
-		/* Note 2019/01/07: We were notified via https://github.com/GenericMappingTools/gmt/issues/279
-		 * that the Watson algorithm may give junk if there are duplicate entries in the input, and if so we issue
-		 * a stern warning to users so they can clean up the file first before calling gmtsupport_delaunay_watson */
-
-		struct GMT_PAIR *P = gmt_M_memory (GMT, NULL, n, struct GMT_PAIR);
-		uint64_t n_duplicates = 0;
-		if (P == NULL) return (0);
-		for (i = 0; i < n; i++) {
-			P[i].x = x_in[i];
-			P[i].y = y_in[i];
-			P[i].rec = i + 1;
-		}
-		qsort (P, n, sizeof (struct GMT_PAIR), gmtsupport_sort_pair);
-		for (i = 1; i < n; i++) {
-			if (doubleAlmostEqualZero (P[i].x, P[i-1].x) && doubleAlmostEqualZero (P[i].y, P[i-1].y)) {
-				GMT_Report (GMT->parent, GMT_MSG_WARNING, "Records %" PRIu64 " and %" PRIu64 " are duplicates!\n", P[i-1].rec, P[i].rec);
-				n_duplicates++;
-			}
-		}
-		if (n_duplicates) {	/* Clearly not monotonically increasing or decreasing in x */
-			GMT_Report (GMT->parent, GMT_MSG_WARNING, "Bug Report Advice for Watson ACORD External Code:\n");
-			GMT_Report (GMT->parent, GMT_MSG_WARNING, "The Watson algorithm can fail if there are duplicate (x,y) records.\n");
-			GMT_Report (GMT->parent, GMT_MSG_WARNING, "We found %" PRIu64 " duplicate records in your data set.\n", n_duplicates);
-			GMT_Report (GMT->parent, GMT_MSG_WARNING, "Please remove duplicates and redo your analysis if the results are corrupted.\n");
+	uint64_t p, i, j, nuc, ij, jt, km, isp, l1, l2, k, k1, jz, i2, kmt, kt, need;
+	double det[2][3], dx, dy, dsq, dd, xn, yn;
+
+	need = 10 * (T->n - 3 + n) + 1;
+	if (need > T->size) {	/* Must grow the triangle slot arrays first */
+		uint64_t old_size = T->size;
+		while (T->size < need) T->size <<= 1;
+		T->index = gmt_M_memory (GMT, T->index, 3 * T->size, int);
+		T->istack = gmt_M_memory (GMT, T->istack, T->size, int64_t);
+		T->x_tmp = gmt_M_memory (GMT, T->x_tmp, T->size, int64_t);
+		T->y_tmp = gmt_M_memory (GMT, T->y_tmp, T->size, int64_t);
+		T->x_circum = gmt_M_memory (GMT, T->x_circum, T->size, double);
+		T->y_circum = gmt_M_memory (GMT, T->y_circum, T->size, double);
+		T->r2_circum = gmt_M_memory (GMT, T->r2_circum, T->size, double);
+		if (T->index == NULL || T->istack == NULL || T->x_tmp == NULL || T->y_tmp == NULL \
+			|| T->x_circum == NULL || T->y_circum == NULL || T->r2_circum == NULL)
+			return (GMT_MEMORY_ERROR);
+		for (i = old_size; i < T->size; i++) T->istack[i] = i;	/* New free slots */
+	}
+	if (T->n + n > T->n_alloc) {	/* Must also grow the vertex arrays */
+		while (T->n_alloc < T->n + n) T->n_alloc <<= 1;
+		T->x = gmt_M_memory (GMT, T->x, T->n_alloc, double);
+		T->y = gmt_M_memory (GMT, T->y, T->n_alloc, double);
+		if (T->x == NULL || T->y == NULL) return (GMT_MEMORY_ERROR);
+	}
+
+	for (p = 0; p < n; p++) {	/* Insert the points one at the time */
+		xn = (x_in[p] - T->xmin) * T->i_scale;
+		yn = (y_in[p] - T->ymin) * T->i_scale;
+		if (xn < 0.0 || xn > 1.0 || yn < 0.0 || yn > 1.0) {
+			GMT_Report (GMT->parent, GMT_MSG_ERROR, "gmt_tin_insert: Point (%g, %g) is outside the domain set in gmt_tin_create\n", x_in[p], y_in[p]);
+			return (GMT_RUNTIME_ERROR);
 		}
-		gmt_M_free (GMT, P);
-	}
-
-	size = 10 * n + 1;
-	n += 3;
-	index = gmt_M_memory (GMT, NULL, 3 * size, int);
-	istack = gmt_M_memory (GMT, NULL, size, int64_t);
-	x_tmp = gmt_M_memory (GMT, NULL, size, int64_t);
-	y_tmp = gmt_M_memory (GMT, NULL, size, int64_t);
-	x_circum = gmt_M_memory (GMT, NULL, size, double);
-	y_circum = gmt_M_memory (GMT, NULL, size, double);
-	r2_circum = gmt_M_memory (GMT, NULL, size, double);
-	x = gmt_M_memory (GMT, NULL, n, double);
-	y = gmt_M_memory (GMT, NULL, n, double);
-	if (index == NULL || istack == NULL || x_tmp == NULL || y_tmp == NULL || x_circum == NULL || y_circum == NULL \
-		|| r2_circum == NULL || x == NULL || y == NULL)
-		return (0);
-	x[0] = x[1] = -1.0;	x[2] = 5.0;
-	y[0] = y[2] = -1.0;	y[1] = 5.0;
-	x_circum[0] = y_circum[0] = 2.0;	r2_circum[0] = 18.0;
-
-	ix[0] = ix[1] = 0;	ix[2] = 1;
-	iy[0] = 1;	iy[1] = iy[2] = 2;
-
-	for (i = 0; i < 3; i++) index[i] = (int)i;
-	for (i = 0; i < size; i++) istack[i] = i;
-
-	xmin = ymin = 1.0e100;	xmax = ymax = -1.0e100;
-
-	for (i = 3, j = 0; i < n; i++, j++) {	/* Copy data and get extremas */
-		x[i] = x_in[j];
-		y[i] = y_in[j];
-		if (x[i] > xmax) xmax = x[i];
-		if (x[i] < xmin) xmin = x[i];
-		if (y[i] > ymax) ymax = y[i];
-		if (y[i] < ymin) ymin = y[i];
-	}
-
-	/* Normalize data */
-
-	datax = 1.0 / MAX (xmax - xmin, ymax - ymin);
-
-	for (i = 3; i < n; i++) {
-		x[i] = (x[i] - xmin) * datax;
-		y[i] = (y[i] - ymin) * datax;
-	}
-
-	isp = id = 1;
-	for (nuc = 3; nuc < n; nuc++) {
+		nuc = T->n++;
+		T->x[nuc] = xn;	T->y[nuc] = yn;
 
 		km = 0;
+		isp = T->isp;
 
 		for (jt = 0; jt < isp; jt++) {	/* loop through established 3-tuples */
 
@@ -4459,15 +4541,15 @@ GMT_LOCAL uint64_t gmtsupport_delaunay_watson (struct GMT_CTRL *GMT, double *x_i
 
 			/* Test if new data is within the jt circumcircle */
 
-			dx = x[nuc] - x_circum[jt];
-			if ((dsq = r2_circum[jt] - dx * dx) < 0.0) continue;
-			dy = y[nuc] - y_circum[jt];
+			dx = T->x[nuc] - T->x_circum[jt];
+			if ((dsq = T->r2_circum[jt] - dx * dx) < 0.0) continue;
+			dy = T->y[nuc] - T->y_circum[jt];
 			if ((dsq -= dy * dy) < 0.0) continue;
 
 			/* Delete this 3-tuple but save its edges */
 
-			id--;
-			istack[id] = jt;
+			T->id--;
+			T->istack[T->id] = jt;
 
 			/* Add edges to x/y_tmp but delete if already listed */
 
@@ -4477,8 +4559,8 @@ GMT_LOCAL uint64_t gmtsupport_delaunay_watson (struct GMT_CTRL *GMT, double *x_i
 				if (km > 0) {
 					kmt = km;
 					for (j = 0, done = false; !done && j < kmt; j++) {
-						if (index[ij+l1] != x_tmp[j]) continue;
-						if (index[ij+l2] != y_tmp[j]) continue;
+						if (T->index[ij+l1] != T->x_tmp[j]) continue;
+						if (T->index[ij+l2] != T->y_tmp[j]) continue;
 						km--;
 						if (j >= km) {
 							done = true;
@@ -4486,8 +4568,8 @@ GMT_LOCAL uint64_t gmtsupport_delaunay_watson (struct GMT_CTRL *GMT, double *x_i
 						}
 						for (k = j; k < km; k++) {
 							k1 = k + 1;
-							x_tmp[k] = x_tmp[k1];
-							y_tmp[k] = y_tmp[k1];
+							T->x_tmp[k] = T->x_tmp[k1];
+							T->y_tmp[k] = T->y_tmp[k1];
 							done = true;
 						}
 					}
@@ -4495,8 +4577,8 @@ GMT_LOCAL uint64_t gmtsupport_delaunay_watson (struct GMT_CTRL *GMT, double *x_i
 				else
 					done = false;
 				if (!done) {
-					x_tmp[km] = index[ij+l1];
-					y_tmp[km] = index[ij+l2];
+					T->x_tmp[km] = T->index[ij+l1];
+					T->y_tmp[km] = T->index[ij+l2];
 					km++;
 				}
 			}
@@ -4505,53 +4587,133 @@ GMT_LOCAL uint64_t gmtsupport_delaunay_watson (struct GMT_CTRL *GMT, double *x_i
 		/* Form new 3-tuples */
 
 		for (i = 0; i < km; i++) {
-			kt = istack[id];
+			kt = T->istack[T->id];
 			ij = 3 * kt;
-			id++;
+			T->id++;
 
 			/* Calculate the circumcircle center and radius
 			 * squared of points ktetr[i,*] and place in tetr[kt,*] */
 
 			for (jz = 0; jz < 2; jz++) {
-				i2 = (jz == 0) ? x_tmp[i] : y_tmp[i];
-				det[jz][0] = x[i2] - x[nuc];
-				det[jz][1] = y[i2] - y[nuc];
-				det[jz][2] = 0.5 * (det[jz][0] * (x[i2] + x[nuc]) + det[jz][1] * (y[i2] + y[nuc]));
+				i2 = (jz == 0) ? T->x_tmp[i] : T->y_tmp[i];
+				det[jz][0] = T->x[i2] - T->x[nuc];
+				det[jz][1] = T->y[i2] - T->y[nuc];
+				det[jz][2] = 0.5 * (det[jz][0] * (T->x[i2] + T->x[nuc]) + det[jz][1] * (T->y[i2] + T->y[nuc]));
 			}
 			dd = 1.0 / (det[0][0] * det[1][1] - det[0][1] * det[1][0]);
-			x_circum[kt] = (det[0][2] * det[1][1] - det[1][2] * det[0][1]) * dd;
-			y_circum[kt] = (det[0][0] * det[1][2] - det[1][0] * det[0][2]) * dd;
-			dx = x[nuc] - x_circum[kt];
-			dy = y[nuc] - y_circum[kt];
-			r2_circum[kt] = dx * dx + dy * dy;
-			index[ij++] = (int)x_tmp[i];
-			index[ij++] = (int)y_tmp[i];
-			index[ij] = (int)nuc;
+			T->x_circum[kt] = (det[0][2] * det[1][1] - det[1][2] * det[0][1]) * dd;
+			T->y_circum[kt] = (det[0][0] * det[1][2] - det[1][0] * det[0][2]) * dd;
+			dx = T->x[nuc] - T->x_circum[kt];
+			dy = T->y[nuc] - T->y_circum[kt];
+			T->r2_circum[kt] = dx * dx + dy * dy;
+			T->index[ij++] = (int)T->x_tmp[i];
+			T->index[ij++] = (int)T->y_tmp[i];
+			T->index[ij] = (int)nuc;
 		}
-		isp += 2;
+		T->isp += 2;
 	}
+	return (GMT_NOERROR);
+}
+
+/*! . */
+int64_t gmt_tin_triangles (struct GMT_CTRL *GMT, struct GMT_TIN *T, int **link) {
+	/* Extract the current list of triangles from the live triangulation, skipping any that
+	 * involve the supertriangle corners.  The state is left untouched so more batches can be
+	 * inserted afterwards.  Free the returned list with gmt_delaunay_free when done. */
+	uint64_t jt, ij, i;
+	int *index = gmt_M_memory (GMT, NULL, 3 * T->isp, int);
 
-	for (jt = i = 0; jt < isp; jt++) {
+	if (index == NULL) return (-1);
+	for (jt = i = 0; jt < T->isp; jt++) {
 		ij = 3 * jt;
-		if (index[ij] < 3 || r2_circum[jt] > 1.0) continue;
-		index[i++] = index[ij++] - 3;
-		index[i++] = index[ij++] - 3;
-		index[i++] = index[ij++] - 3;
+		if (T->index[ij] < 3 || T->r2_circum[jt] > 1.0) continue;
+		index[i++] = T->index[ij++] - 3;
+		index[i++] = T->index[ij++] - 3;
+		index[i++] = T->index[ij++] - 3;
 	}
-
 	index = gmt_M_memory (GMT, index, i, int);
 	*link = index;
+	return ((int64_t)(i/3));
+}
 
-	gmt_M_free (GMT, istack);
-	gmt_M_free (GMT, x_tmp);
-	gmt_M_free (GMT, y_tmp);
-	gmt_M_free (GMT, x_circum);
-	gmt_M_free (GMT, y_circum);
-	gmt_M_free (GMT, r2_circum);
-	gmt_M_free (GMT, x);
-	gmt_M_free (GMT, y);
+/*! . */
+void gmt_tin_free (struct GMT_CTRL *GMT, struct GMT_TIN **T) {
+	/* Release an incremental triangulation handle and all its state */
+	if (T == NULL || *T == NULL) return;
+	gmt_M_free (GMT, (*T)->x);
+	gmt_M_free (GMT, (*T)->y);
+	gmt_M_free (GMT, (*T)->index);
+	gmt_M_free (GMT, (*T)->istack);
+	gmt_M_free (GMT, (*T)->x_tmp);
+	gmt_M_free (GMT, (*T)->y_tmp);
+	gmt_M_free (GMT, (*T)->x_circum);
+	gmt_M_free (GMT, (*T)->y_circum);
+	gmt_M_free (GMT, (*T)->r2_circum);
+	gmt_M_free (GMT, *T);
+}
+
+/* Leave link as int**, not int** */
+/*! . */
+GMT_LOCAL uint64_t gmtsupport_delaunay_watson (struct GMT_CTRL *GMT, double *x_in, double *y_in, uint64_t n, int **link) {
+	/* Input point x coordinates */
+	/* Input point y coordinates */
+	/* Number of input points */
+	/* pointer to List of point ids per triangle.  Vertices for triangle no i
+	   is in link[i*3], link[i*3+1], link[i*3+2] */
+
+	int64_t n_triangles;
+	uint64_t i;
+	double wesn[4];
+	struct GMT_TIN *T = NULL;
+
+	GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "Delaunay triangulation calculated by Dave Watson's ACORD [Computers & Geosciences, 8, 97-101, 1982]\n");
+
+	{
+		/* Note 2019/01/07: We were notified via https://github.com/GenericMappingTools/gmt/issues/279
+		 * that the Watson algorithm may give junk if there are duplicate entries in the input, and if so we issue
+		 * a stern warning to users so they can clean up the file first before calling gmtsupport_delaunay_watson */
+
+		struct GMT_PAIR *P = gmt_M_memory (GMT, NULL, n, struct GMT_PAIR);
+		uint64_t n_duplicates = 0;
+		if (P == NULL) return (0);
+		for (i = 0; i < n; i++) {
+			P[i].x = x_in[i];
+			P[i].y = y_in[i];
+			P[i].rec = i + 1;
+		}
+		qsort (P, n, sizeof (struct GMT_PAIR), gmtsupport_sort_pair);
+		for (i = 1; i < n; i++) {
+			if (doubleAlmostEqualZero (P[i].x, P[i-1].x) && doubleAlmostEqualZero (P[i].y, P[i-1].y)) {
+				GMT_Report (GMT->parent, GMT_MSG_WARNING, "Records %" PRIu64 " and %" PRIu64 " are duplicates!\n", P[i-1].rec, P[i].rec);
+				n_duplicates++;
+			}
+		}
+		if (n_duplicates) {	/* Clearly not monotonically increasing or decreasing in x */
+			GMT_Report (GMT->parent, GMT_MSG_WARNING, "Bug Report Advice for Watson ACORD External Code:\n");
+			GMT_Report (GMT->parent, GMT_MSG_WARNING, "The Watson algorithm can fail if there are duplicate (x,y) records.\n");
+			GMT_Report (GMT->parent, GMT_MSG_WARNING, "We found %" PRIu64 " duplicate records in your data set.\n", n_duplicates);
+			GMT_Report (GMT->parent, GMT_MSG_WARNING, "Please remove duplicates and redo your analysis if the results are corrupted.\n");
+		}
+		gmt_M_free (GMT, P);
+	}
 
-	return (i/3);
+	wesn[XLO] = wesn[YLO] = 1.0e100;	wesn[XHI] = wesn[YHI] = -1.0e100;
+	for (i = 0; i < n; i++) {	/* Get extremas to anchor the normalization */
+		if (x_in[i] > wesn[XHI]) wesn[XHI] = x_in[i];
+		if (x_in[i] < wesn[XLO]) wesn[XLO] = x_in[i];
+		if (y_in[i] > wesn[YHI]) wesn[YHI] = y_in[i];
+		if (y_in[i] < wesn[YLO]) wesn[YLO] = y_in[i];
+	}
+
+	if ((T = gmt_tin_create (GMT, wesn, n)) == NULL) return (0);
+	if (gmt_tin_insert (GMT, T, x_in, y_in, n) != GMT_NOERROR) {
+		gmt_tin_free (GMT, &T);
+		return (0);
+	}
+	n_triangles = gmt_tin_triangles (GMT, T, link);
+	gmt_tin_free (GMT, &T);
+
+	return ((n_triangles < 0) ? 0 : (uint64_t)n_triangles);
 }
 
 /*! . */
@@ -8085,12 +8247,21 @@ struct GMT_PALETTE * gmtlib_create_palette (struct GMT_CTRL *GMT, uint64_t n_col
 }
 
 /*! . */
+/*! Free the quantized bin index for this palette; called when its z slices change or the palette is freed */
+GMT_LOCAL void gmtsupport_cpt_bin_free (struct GMT_CTRL *GMT, struct GMT_PALETTE *P) {
+	struct GMT_PALETTE_HIDDEN *PH = gmt_get_C_hidden (P);
+	gmt_M_free (GMT, PH->z_bin);
+	PH->n_bins = 0;
+	PH->z_bin_tried = false;
+}
+
 void gmtlib_free_cpt_ptr (struct GMT_CTRL *GMT, struct GMT_PALETTE *P) {
 	unsigned int i;
 	struct GMT_PALETTE_HIDDEN *PH = NULL;
 	if (!P) return;
 	/* Frees all memory used by this palette but does not free the palette itself */
 	PH = gmt_get_C_hidden (P);
+	gmtsupport_cpt_bin_free (GMT, P);
 	for (i = 0; i < P->n_colors; i++) {
 		gmtsupport_free_range (GMT, PH, &P->data[i]);
 	}
@@ -8127,7 +8298,12 @@ void gmtlib_copy_palette (struct GMT_CTRL *GMT, struct GMT_PALETTE *P_to, struct
 	P_to->wrap_length = P_from->wrap_length;	/* z-length of active CPT */
 	gmt_M_memcpy (P_to->minmax, P_from->minmax, 2, double);	/* Min/max z-value for a default range, if given */
 
+	gmtsupport_cpt_bin_free (GMT, P_to);	/* Free any quantized index before its pointer is overwritten below */
 	gmt_M_memcpy (P_to->hidden, P_from->hidden, 1, struct GMT_PALETTE_HIDDEN);
+	{	/* Reset junk pointer from the memcopy; the quantized index belongs to P_from */
+		struct GMT_PALETTE_HIDDEN *PH = gmt_get_C_hidden (P_to);
+		PH->z_bin = NULL;	PH->n_bins = 0;	PH->z_bin_tried = false;
+	}
 	gmt_M_memcpy (P_to->data, P_from->data, P_to->n_colors, struct GMT_LUT);
 	gmt_M_memcpy (P_to->bfn, P_from->bfn, 3, struct GMT_BFN);
 	for (i = 0; i < 3; i++) {
@@ -8339,6 +8515,111 @@ char ** gmt_cat_cpt_strings (struct GMT_CTRL *GMT, char *in_label, unsigned int
 	return Clabel;
 }
 
+GMT_LOCAL struct GMT_CPTCACHE *gmtsupport_cptcache (struct GMT_CTRL *GMT) {
+	/* Return the session CPT cache, checking the environment on the first call.
+	 * Returns NULL when the cache is not enabled. */
+	char *env = NULL;
+	struct GMT_CPTCACHE *C = GMT->session.cptcache;
+	if (C == NULL) {	/* First time here; see if the user requested the cache */
+		C = GMT->session.cptcache = gmt_M_memory (GMT, NULL, 1, struct GMT_CPTCACHE);
+		if ((env = getenv ("GMT_CPT_CACHE")) && strcmp (env, "off")) {
+			int n = atoi (env);	/* Optionally the number of palettes to keep */
+			C->n_slots = (n > 0 && n < GMT_CPTCACHE_N_SLOTS) ? (unsigned int)n : GMT_CPTCACHE_N_SLOTS;
+			GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Session CPT cache enabled with %u slots\n", C->n_slots);
+		}
+	}
+	return (C->n_slots) ? C : NULL;
+}
+
+GMT_LOCAL void gmtsupport_cptcache_key (struct GMT_CTRL *GMT, const char *source, unsigned int cpt_flags, char *key) {
+	/* Build the signature identifying one particular parse of this CPT argument.  The color model
+	 * and BFN color defaults in effect must be part of the signature since they seed the palette. */
+	double *p = &GMT->current.setting.color_patch[0][0];
+	snprintf (key, PATH_MAX, "%s|%u|%u|%g/%g/%g/%g/%g/%g/%g/%g/%g", source, cpt_flags,
+		GMT->current.setting.color_model, p[0], p[1], p[2], p[4], p[5], p[6], p[8], p[9], p[10]);
+}
+
+GMT_LOCAL void gmtsupport_cptcache_drop (struct GMT_CTRL *GMT, struct GMT_CPTCACHE *C, unsigned int k) {
+	/* Release one cache slot and its pristine palette */
+	gmt_M_str_free (C->slot[k].key);
+	gmtlib_free_palette (GMT, &C->slot[k].P);
+	gmt_M_memset (&C->slot[k], 1, struct GMT_CPTCACHE_SLOT);
+}
+
+GMT_LOCAL struct GMT_PALETTE *gmtsupport_cptcache_fetch (struct GMT_CTRL *GMT, const char *source, const char *cpt_file, unsigned int cpt_flags) {
+	/* If this exact CPT parse was cached then replay it from memory: return a fresh duplicate of the
+	 * pristine palette and restore the color model setting the parse left behind.  A stale copy (the
+	 * file changed on disk since it was cached) is dropped and we return NULL to force a re-parse. */
+	char key[PATH_MAX] = {""};
+	unsigned int k;
+	struct stat buf;
+	struct GMT_CPTCACHE *C = NULL;
+	struct GMT_CPTCACHE_SLOT *S = NULL;
+	struct GMT_PALETTE *P = NULL;
+	struct GMT_PALETTE_HIDDEN *PH = NULL;
+
+	if ((C = gmtsupport_cptcache (GMT)) == NULL) return NULL;
+	if (cpt_flags & GMT_CPT_TEMPORARY) return NULL;	/* Throw-away color list files are never cached */
+	gmtsupport_cptcache_key (GMT, source, cpt_flags, key);
+	for (k = 0; k < C->n_slots; k++)
+		if (C->slot[k].key && !strcmp (C->slot[k].key, key)) break;
+	if (k == C->n_slots) return NULL;	/* Not cached */
+	S = &C->slot[k];
+	if (stat (cpt_file, &buf) || (int64_t)buf.st_mtime != S->mtime) {	/* File has changed on disk */
+		gmtsupport_cptcache_drop (GMT, C, k);
+		return NULL;
+	}
+	P = gmtlib_duplicate_palette (GMT, S->P, 0);
+	PH = gmt_get_C_hidden (P);	/* The duplication copied the bookkeeping of the cached copy so restore ownership */
+	PH->alloc_level = GMT->hidden.func_level;
+	PH->id = GMT->parent->unique_var_ID++;
+	GMT->current.setting.color_model = S->color_model;	/* As the original parse left it */
+	S->last_use = ++C->counter;
+	GMT_Report (GMT->parent, GMT_MSG_DEBUG, "CPT cache hit for %s\n", cpt_file);
+	return P;
+}
+
+GMT_LOCAL void gmtsupport_cptcache_store (struct GMT_CTRL *GMT, const char *source, const char *cpt_file, unsigned int cpt_flags, struct GMT_PALETTE *P) {
+	/* Keep a pristine duplicate of a completed parse in a free (or evicted least-recently-used) slot
+	 * so identical later reads of the same file can skip the parsing */
+	char key[PATH_MAX] = {""};
+	unsigned int k, j, oldest, color_model = GMT->current.setting.color_model;
+	struct stat buf;
+	struct GMT_CPTCACHE *C = NULL;
+	struct GMT_CPTCACHE_SLOT *S = NULL;
+
+	if ((C = gmtsupport_cptcache (GMT)) == NULL) return;
+	if (cpt_flags & GMT_CPT_TEMPORARY) return;	/* Built from a throw-away file that is removed after this read */
+	if (!strncmp (cpt_file, "/dev/fd/", 8U)) return;	/* Process substitution files have no stable identity to key on */
+	if (stat (cpt_file, &buf)) return;	/* Cannot detect later file changes without a time stamp, so skip */
+	gmtsupport_cptcache_key (GMT, source, cpt_flags, key);
+	for (k = 0; k < C->n_slots && C->slot[k].key; k++);	/* Find first free slot */
+	if (k == C->n_slots) {	/* All slots taken; evict the least recently used one */
+		for (j = 1, oldest = 0; j < C->n_slots; j++)
+			if (C->slot[j].last_use < C->slot[oldest].last_use) oldest = j;
+		gmtsupport_cptcache_drop (GMT, C, oldest);
+		k = oldest;
+	}
+	S = &C->slot[k];
+	S->key = strdup (key);
+	S->P = gmtlib_duplicate_palette (GMT, P, 0);
+	GMT->current.setting.color_model = color_model;	/* Undo the side effect of duplicating the palette */
+	S->mtime = (int64_t)buf.st_mtime;
+	S->color_model = color_model;	/* A cache hit must leave the setting as the original parse did */
+	S->last_use = ++C->counter;
+	GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Cached CPT %s\n", cpt_file);
+}
+
+void gmtlib_cptcache_free (struct GMT_CTRL *GMT) {
+	/* Release the session CPT cache, if it was ever looked at */
+	unsigned int k;
+	struct GMT_CPTCACHE *C = GMT->session.cptcache;
+	if (C == NULL) return;
+	for (k = 0; k < C->n_slots; k++)
+		if (C->slot[k].key) gmtsupport_cptcache_drop (GMT, C, k);
+	gmt_M_free (GMT, GMT->session.cptcache);
+}
+
 /*! . */
 struct GMT_PALETTE * gmtlib_read_cpt (struct GMT_CTRL *GMT, void *source, unsigned int source_type, unsigned int cpt_flags) {
 	/* Opens and reads a color palette file in RGB, HSV, or CMYK of arbitrary length.
@@ -8369,6 +8650,10 @@ struct GMT_PALETTE * gmtlib_read_cpt (struct GMT_CTRL *GMT, void *source, unsign
 		struct stat S;
 		strncpy (cpt_file, source, PATH_MAX-1);
 		Z = gmtsupport_cpt_parse (GMT, cpt_file, GMT_IN, &hinge_mode, &z_hinge);
+		if ((X = gmtsupport_cptcache_fetch (GMT, source, cpt_file, cpt_flags)) != NULL) {	/* Replay an identical earlier parse of this file */
+			gmt_M_free (GMT, Z);
+			return (X);
+		}
 		if (strncmp (cpt_file, "/dev/fd/", 8U) && stat (cpt_file, &S) == 0 && S.st_size == 0) {	/* Exclude process substitution files in /dev/fd */
 			GMT_Report (GMT->parent, GMT_MSG_ERROR, "Color palette table %s is empty\n", cpt_file);
 			gmt_M_free (GMT, Z);
@@ -8851,6 +9136,9 @@ struct GMT_PALETTE * gmtlib_read_cpt (struct GMT_CTRL *GMT, void *source, unsign
 		gmt_M_free (GMT, Z);
 	}
 
+	if (source_type == GMT_IS_FILE)	/* Worth remembering in case the same file is requested again */
+		gmtsupport_cptcache_store (GMT, source, cpt_file, cpt_flags, X);
+
 	return (X);
 }
 
@@ -9170,6 +9458,44 @@ GMT_LOCAL int gmtsupport_validate_cpt (struct GMT_CTRL *GMT, struct GMT_PALETTE
 }
 
 /*! . */
+/*! Build a dense quantized z-to-slice index so gmt_get_index can skip the binary search */
+GMT_LOCAL void gmtsupport_cpt_bin_index (struct GMT_CTRL *GMT, struct GMT_PALETTE *P) {
+	/* Each bin holds the lowest slice whose z_high exceeds the z at the bin start; a lookup
+	 * starts at that slice and advances past at most a few slices using the exact z_high
+	 * comparisons, so the index found is identical to what the binary search returns.
+	 * CPTs whose slices are not in increasing order are left to the fallback searches. */
+	unsigned int k, slice, n_bins, *z_bin = NULL;
+	double z_min, z_max, dz;
+	struct GMT_PALETTE_HIDDEN *PH = gmt_get_C_hidden (P);
+
+	PH->z_bin_tried = true;	/* Only attempt this once per version of the palette */
+	for (k = 1; k < P->n_colors; k++)
+		if (P->data[k].z_high < P->data[k-1].z_high) return;	/* Not sorted; leave z_bin NULL */
+	z_min = P->data[0].z_low;	z_max = P->data[P->n_colors-1].z_high;
+	if (!(z_max > z_min)) return;	/* Degenerate or reversed z range */
+	n_bins = MAX (256U, 4U * P->n_colors);	/* Enough bins that most lookups advance zero or one slice */
+	if (n_bins > 65536U) n_bins = 65536U;	/* No point in chasing giant tables beyond this */
+	if ((z_bin = gmt_M_memory (GMT, NULL, n_bins, unsigned int)) == NULL) return;
+	dz = (z_max - z_min) / n_bins;
+	for (k = slice = 0; k < n_bins; k++) {
+		double z = z_min + k * dz;	/* The z value where this bin starts */
+		while (slice < P->n_colors - 1 && z >= P->data[slice].z_high) slice++;
+		z_bin[k] = slice;
+	}
+	PH->n_bins = n_bins;
+	PH->bin_z_min = z_min;
+	PH->bin_i_dz = n_bins / (z_max - z_min);
+	PH->z_bin = z_bin;	/* Publish the pointer last so a concurrent reader never sees a half-built index */
+}
+
+void gmt_cpt_prep_index (struct GMT_CTRL *GMT, struct GMT_PALETTE *P) {
+	/* Build the quantized z-to-slice index for this palette now, if one can be built.  Modules
+	 * that call gmt_get_index (or the color lookups above it) from parallel loops must call this
+	 * first so the lazy build does not race; a lookup only consults the index once it exists. */
+	struct GMT_PALETTE_HIDDEN *PH = gmt_get_C_hidden (P);
+	if (PH->z_bin == NULL && !PH->z_bin_tried) gmtsupport_cpt_bin_index (GMT, P);
+}
+
 unsigned int gmt_stretch_cpt (struct GMT_CTRL *GMT, struct GMT_PALETTE *P, double z_low, double z_high) {
 	/* Replace CPT z-values with new ones linearly scaled from z_low to z_high.  If these are
 	 * zero then we substitute the CPT's default range instead (if available).
@@ -9207,6 +9533,7 @@ unsigned int gmt_stretch_cpt (struct GMT_CTRL *GMT, struct GMT_PALETTE *P, doubl
 		P->data[is].z_high = z_start + (P->data[is].z_high - z_min) * scale;
 		P->data[is].i_dz /= scale;
 	}
+	gmtsupport_cpt_bin_free (GMT, P);	/* The z slices changed so any quantized index is stale */
 	return (GMT_NOERROR);
 }
 
@@ -9234,7 +9561,6 @@ void gmt_scale_cpt (struct GMT_CTRL *GMT, struct GMT_PALETTE *P, double scale) {
 	/* Scale all z-related variables in the CPT by scale */
 	unsigned int i;
 	bool flip = (scale < 0.0);	/* More work to do if a negative scale is given */
-	gmt_M_unused(GMT);
 	for (i = 0; i < P->n_colors; i++) {
 		P->data[i].z_low  *= scale;
 		P->data[i].z_high *= scale;
@@ -9252,6 +9578,7 @@ void gmt_scale_cpt (struct GMT_CTRL *GMT, struct GMT_PALETTE *P, double scale) {
 	}
 	if (flip)	/* Must also reverse the order of slices */
 		qsort (P->data, P->n_colors, sizeof (struct GMT_LUT), gmtsupport_lutsort);
+	gmtsupport_cpt_bin_free (GMT, P);	/* The z slices changed so any quantized index is stale */
 }
 
 #define gmt_M_fill_swap(x, y) {struct GMT_FILL *F_tmp; F_tmp = x, x = y, y = F_tmp;}
@@ -9284,12 +9611,12 @@ void gmt_invert_cpt (struct GMT_CTRL *GMT, struct GMT_PALETTE *P) {
 
 void gmt_undo_log10 (struct GMT_CTRL *GMT, struct GMT_PALETTE *P) {
 	unsigned int i;
-	gmt_M_unused(GMT);
 	/* Turn z into 10^z */
 	for (i = 0; i < P->n_colors; i++) {
 		P->data[i].z_low  = pow (10.0, P->data[i].z_low);
 		P->data[i].z_high = pow (10.0, P->data[i].z_high);
 	}
+	gmtsupport_cpt_bin_free (GMT, P);	/* The z slices changed so any quantized index is stale */
 }
 
 /*! . */
@@ -9837,6 +10164,7 @@ struct GMT_PALETTE * gmt_truncate_cpt (struct GMT_CTRL *GMT, struct GMT_PALETTE
 	P->data = gmt_M_memory (GMT, P->data, P->n_colors, struct GMT_LUT);	/* Truncate */
 	/* Check if anything has changed regarding continuous, gray scale, or B/W */
 	gmtsupport_reset_cpt (GMT, P);
+	gmtsupport_cpt_bin_free (GMT, P);	/* The z slices changed so any quantized index is stale */
 	return (P);
 }
 
@@ -9859,6 +10187,7 @@ void gmtlib_init_cpt (struct GMT_CTRL *GMT, struct GMT_PALETTE *P) {
 	}
 	P->wrap_length = P->data[P->n_colors-1].z_high - P->data[0].z_low;
 	GMT->current.setting.color_model = (P->model | GMT_COLORINT);	/* So color interpolation will happen in the color system */
+	gmtsupport_cpt_bin_free (GMT, P);	/* The z slices may have changed so any quantized index is stale */
 
 	/* We leave BNF as we got them from the external API */
 }
@@ -9866,7 +10195,7 @@ void gmtlib_init_cpt (struct GMT_CTRL *GMT, struct GMT_PALETTE *P) {
 /*! . */
 int gmt_get_index (struct GMT_CTRL *GMT, struct GMT_PALETTE *P, double *value) {
 	unsigned int index, lo, hi, mid;
-	gmt_M_unused(GMT);
+	struct GMT_PALETTE_HIDDEN *PH = gmt_get_C_hidden (P);
 
 	if (gmt_M_is_dnan (*value)) return (GMT_NAN - 3);	/* Set to NaN color */
 	if (P->is_wrapping)	/* Wrap to fit CPT range - we can never return back- or fore-ground colors */
@@ -9888,25 +10217,41 @@ int gmt_get_index (struct GMT_CTRL *GMT, struct GMT_PALETTE *P, double *value) {
 
 	/* Must search for correct index */
 
-	/* Speedup by Mika Heiskanen. This works if the colortable
-	 * has been is sorted into increasing order. Careful when
-	 * modifying the tests in the loop, the test and the mid+1
-	 * parts are especially designed to make sure the loop
-	 * converges to a single index.
-	 */
+	if (PH->z_bin == NULL && !PH->z_bin_tried) {	/* First lookup on this palette */
+#ifdef _OPENMP
+#pragma omp critical (gmtsupport_cpt_bin_index)
+#endif
+		if (PH->z_bin == NULL && !PH->z_bin_tried)	/* Re-test; another thread may have built it while we waited */
+			gmtsupport_cpt_bin_index (GMT, P);
+	}
 
-	lo = 0;
-	hi = P->n_colors - 1;
-	while (lo != hi)
-	{
-		mid = (lo + hi) / 2;
-		if (*value >= P->data[mid].z_high)
-			lo = mid + 1;
-		else
-			hi = mid;
+	if (PH->z_bin) {	/* O(1): Quantize z to a bin and advance past at most a few slices; same index as the search below */
+		index = (unsigned int)((*value - PH->bin_z_min) * PH->bin_i_dz);
+		if (index >= PH->n_bins) index = PH->n_bins - 1;	/* Happens when *value equals the top of the CPT range */
+		index = PH->z_bin[index];
+		while (index < P->n_colors - 1 && *value >= P->data[index].z_high) index++;
 	}
-	index = lo;
-	
+	else {
+		/* Speedup by Mika Heiskanen. This works if the colortable
+		 * has been is sorted into increasing order. Careful when
+		 * modifying the tests in the loop, the test and the mid+1
+		 * parts are especially designed to make sure the loop
+		 * converges to a single index.
+		 */
+
+		lo = 0;
+		hi = P->n_colors - 1;
+		while (lo != hi)
+		{
+			mid = (lo + hi) / 2;
+			if (*value >= P->data[mid].z_high)
+				lo = mid + 1;
+			else
+				hi = mid;
+		}
+		index = lo;
+	}
+
 	if (*value >= P->data[index].z_low && *value < P->data[index].z_high) {
 		if (P->categorical && !doubleAlmostEqualZero (P->data[index].z_low, *value)) {
 			GMT_Report (GMT->parent, GMT_MSG_WARNING, "Requested color lookup for z = %.12lg is not a categorical value - returning NaN color\n", *value);
@@ -10210,10 +10555,10 @@ int gmtlib_cspline (struct GMT_CTRL *GMT, double *x, double *y, uint64_t n, doub
 
 /*! . */
 int gmt_intpol (struct GMT_CTRL *GMT, double *x, double *y, double *w, uint64_t n, uint64_t m, double *u, double *v, double p, int mode) {
-	uint64_t i, this_n, this_m, start_i, start_j, stop_i, stop_j;
+	uint64_t i;
 	int err_flag = 0, smode, deriv;
 	bool down = false, check = true, clean = true;
-	double dx, *wp = NULL;
+	double dx;
 
 	if (mode < 0) {	/* No need to check for sanity */
 		check = false;
@@ -10256,44 +10601,74 @@ int gmt_intpol (struct GMT_CTRL *GMT, double *x, double *y, double *w, uint64_t
 
 	if (down) gmtsupport_intpol_reverse (x, u, n, m);	/* Must flip directions temporarily */
 
-	if (clean) {	/* No NaNs to worry about */
-		err_flag = gmtsupport_intpol_sub (GMT, x, y, w, n, m, u, v, p, mode);
-		if (err_flag != GMT_NOERROR) return (err_flag);
-		if (down) gmtsupport_intpol_reverse (x, u, n, m);	/* Must flip directions back */
-		return (GMT_NOERROR);
+	err_flag = gmtsupport_intpol_one (GMT, x, y, w, n, m, u, v, p, mode, clean);
+
+	if (down) gmtsupport_intpol_reverse (x, u, n, m);	/* Must flip directions back */
+
+	return (err_flag);
+}
+
+/*! . */
+int gmtlib_intpol_many (struct GMT_CTRL *GMT, double *x, double **y, double *w, uint64_t n_cols, uint64_t n, uint64_t m, double *u, double **v, double p, int mode) {
+	/* As gmt_intpol, but interpolates the n_cols data columns y[0..n_cols-1], which all share the
+	 * same abscissae x (and optional weights w), onto the same output abscissae u, storing results
+	 * in the corresponding v columns.  The monotonicity check and any direction reversal are done
+	 * once for the shared x rather than once per column, and since the columns are independent
+	 * they are evaluated concurrently when OpenMP is enabled.  Note: The spline coefficients
+	 * depend on the ordinates so each column still computes its own set [an O(n) task]. */
+	uint64_t col, i;
+	int err_flag = 0, smode, deriv, *col_err = NULL;
+	bool down = false;
+	double dx;
+	openmp_int k;
+
+	smode = mode % GMT_SPLINE_SLOPE;	/* Get spline method first */
+	deriv = mode / GMT_SPLINE_SLOPE;	/* Get spline derivative order [0-2] */
+	if (smode > GMT_SPLINE_STEP) smode = GMT_SPLINE_LINEAR;	/* Default to linear */
+	if (smode != GMT_SPLINE_STEP && n < 4) smode = GMT_SPLINE_LINEAR;	/* Default to linear if 3 or fewer points, unless when nearest neighbor */
+	if (n < 2) {
+		GMT_Report (GMT->parent, GMT_MSG_ERROR, "Need at least 2 x-values\n");
+		return (GMT_DIM_TOO_SMALL);
 	}
+	mode = smode + GMT_SPLINE_SLOPE * deriv;	/* Reassemble the possibly new mode */
 
-	/* Here input has NaNs so we need to treat it section by section */
+	/* Check once to see if the shared x-values are monotonically increasing/decreasing */
 
-	for (i = 0; i < m; i++) v[i] = GMT->session.d_NaN;	/* Initialize all output to NaN */
-	start_i = start_j = 0;
-	while (start_i < n && gmt_M_is_dnan (y[start_i])) start_i++;	/* First non-NaN data point */
-	while (start_i < n && start_j < m) {
-		stop_i = start_i + 1;
-		while (stop_i < n && !gmt_M_is_dnan (y[stop_i])) stop_i++;	/* Wind to next NaN point (or past end of array) */
-		this_n = stop_i - start_i;	/* Number of clean points to interpolate from */
-		stop_i--;			/* Now stop_i is the ID of the last usable point */
-		if (this_n == 1) {		/* Not enough to interpolate, just skip this single point */
-			start_i++;	/* Skip to next point (which is NaN) */
-			while (start_i < n && gmt_M_is_dnan (y[start_i])) start_i++;	/* Wind to next non-NaN data point */
-			continue;
-		}
-		/* OK, have enough points to interpolate; find corresponding output section */
-		while (start_j < m && u[start_j] < x[start_i]) start_j++;
-		if (start_j == m) continue;	/* Ran out of points */
-		stop_j = start_j;
-		while (stop_j < m && u[stop_j] <= x[stop_i]) stop_j++;
-		this_m = stop_j - start_j;	/* Number of output points to interpolate to */
-		wp = (w) ? &w[start_j] : NULL;
-		err_flag = gmtsupport_intpol_sub (GMT, &x[start_i], &y[start_i], wp, this_n, this_m, &u[start_j], &v[start_j], p, mode);
-		if (err_flag != GMT_NOERROR) return (err_flag);
-		start_i = stop_i + 1;	/* Move to point after last usable point in current section */
-		while (start_i < n && gmt_M_is_dnan (y[start_i])) start_i++;	/* Next section's first non-NaN data point */
+	dx = x[1] - x[0];
+	if (dx > 0.0) {
+		for (i = 2; i < n && err_flag == 0; i++)
+			if ((x[i] - x[i-1]) <= 0.0) err_flag = (int)i;
+	}
+	else {
+		down = true;
+		for (i = 2; i < n && err_flag == 0; i++)
+			if ((x[i] - x[i-1]) >= 0.0) err_flag = (int)i;
+	}
+	if (err_flag) {
+		GMT_Report (GMT->parent, GMT_MSG_ERROR, "x-values are not monotonically increasing/decreasing (at zero-based record %d)!\n", err_flag);
+		return (err_flag);
+	}
+
+	if (down) gmtsupport_intpol_reverse (x, u, n, m);	/* Must flip directions temporarily */
+
+	col_err = gmt_M_memory (GMT, NULL, n_cols, int);
+#ifdef _OPENMP
+#pragma omp parallel for private(k) shared(GMT,x,y,w,u,v,n,m,n_cols,p,mode,col_err) schedule(dynamic)
+#endif
+	for (k = 0; k < (openmp_int)n_cols; k++) {
+		uint64_t row;
+		bool clean = true;
+		for (row = 0; clean && row < n; row++)
+			if (gmt_M_is_dnan (y[k][row])) clean = false;
+		col_err[k] = gmtsupport_intpol_one (GMT, x, y[k], w, n, m, u, v[k], p, mode, clean);
 	}
 
 	if (down) gmtsupport_intpol_reverse (x, u, n, m);	/* Must flip directions back */
 
-	return (GMT_NOERROR);
+	for (col = 0; col < n_cols && err_flag == 0; col++) err_flag = col_err[col];	/* Pass back the first error, if any */
+	gmt_M_free (GMT, col_err);
+
+	return (err_flag);
 }
 
 /*! . */
@@ -11814,6 +12189,11 @@ void gmt_contlabel_free (struct GMT_CTRL *GMT, struct GMT_CONTOUR *G) {
 		gmt_M_free (GMT, L);
 	}
 	gmt_M_free (GMT, G->segment);
+	if (G->ylist_X) {	/* Free the cached y-sorted indexes for the crossing lines */
+		for (seg = 0; seg < G->X->n_segments; seg++)
+			gmt_M_free (GMT, G->ylist_X[seg]);
+		gmt_M_free (GMT, G->ylist_X);
+	}
 	GMT_Destroy_Data (GMT->parent, &(G->X));
 	if (G->f_n) {	/* Array for fixed points */
 		gmt_M_free (GMT, G->f_xy[GMT_X]);
@@ -12545,6 +12925,114 @@ on_edge_case:
 	return (GMT_ONEDGE);
 }
 
+/*! . */
+GMT_LOCAL int gmtsupport_comp_scanline_cross (const void *p1, const void *p2) {
+	/* Sort scanline crossings on increasing x-coordinate */
+	const struct GMT_SCANLINE_CROSS *a = p1, *b = p2;
+	if (a->x < b->x) return (-1);
+	if (a->x > b->x) return (+1);
+	return (0);
+}
+
+/*! . */
+GMT_LOCAL void gmtsupport_scanline_add (struct GMT_CTRL *GMT, struct GMT_SCANLINE *SL, double x, double guard, int dir) {
+	/* Append one crossing to the workspace, growing the arrays as needed */
+	if (SL->n_x == SL->n_alloc) {
+		SL->n_alloc <<= 1;
+		SL->C = gmt_M_memory (GMT, SL->C, SL->n_alloc, struct GMT_SCANLINE_CROSS);
+		SL->wind = gmt_M_memory (GMT, SL->wind, SL->n_alloc + 1, int);
+		SL->lmost = gmt_M_memory (GMT, SL->lmost, SL->n_alloc, double);
+		SL->rmost = gmt_M_memory (GMT, SL->rmost, SL->n_alloc, double);
+	}
+	SL->C[SL->n_x].x = x;
+	SL->C[SL->n_x].guard = guard;
+	SL->C[SL->n_x].dir = dir;
+	SL->n_x++;
+}
+
+/*! . */
+struct GMT_SCANLINE *gmt_scanline_init (struct GMT_CTRL *GMT) {
+	/* Allocate a reusable workspace for scanline polygon rasterization */
+	struct GMT_SCANLINE *SL = gmt_M_memory (GMT, NULL, 1, struct GMT_SCANLINE);
+	SL->n_alloc = GMT_SMALL_CHUNK;
+	SL->C = gmt_M_memory (GMT, NULL, SL->n_alloc, struct GMT_SCANLINE_CROSS);
+	SL->wind = gmt_M_memory (GMT, NULL, SL->n_alloc + 1, int);
+	SL->lmost = gmt_M_memory (GMT, NULL, SL->n_alloc, double);
+	SL->rmost = gmt_M_memory (GMT, NULL, SL->n_alloc, double);
+	return (SL);
+}
+
+/*! . */
+void gmt_scanline_free (struct GMT_CTRL *GMT, struct GMT_SCANLINE **SL_ptr) {
+	/* Release a scanline workspace and set the pointer to NULL */
+	struct GMT_SCANLINE *SL = *SL_ptr;
+	if (SL == NULL) return;
+	gmt_M_free (GMT, SL->C);
+	gmt_M_free (GMT, SL->wind);
+	gmt_M_free (GMT, SL->lmost);
+	gmt_M_free (GMT, SL->rmost);
+	gmt_M_free (GMT, *SL_ptr);
+}
+
+/*! . */
+void gmt_scanline_build (struct GMT_CTRL *GMT, struct GMT_SCANLINE *SL, double *x, double *y, uint64_t n, double yp) {
+	/* Record where the polygon boundary x[n],y[n] meets the horizontal line y = yp, so that
+	 * gmt_scanline_side can classify every node along this line from the sorted crossing list
+	 * instead of running one full winding test per node.  Edges crossing the line are counted
+	 * with the half-open rule (an edge claims its lower endpoint only) so that the signed
+	 * crossings right of any point off the boundary sum to its winding number.  Vertices and
+	 * horizontal edges lying exactly on the line add zero-direction entries so nodes on the
+	 * boundary itself are never classified from the list but sent back to the exact test via
+	 * the guard zones.  Works for open as well as closed versions of the polygon. */
+	uint64_t i, j, k;
+	double x1, y1, x2, y2, slope;
+
+	SL->n_x = 0;
+	for (i = 0; i < n; i++) {
+		j = (i == n - 1) ? 0 : i + 1;	/* The implicit closure edge is degenerate (and harmless) for closed polygons */
+		x1 = x[i];	y1 = y[i];	x2 = x[j];	y2 = y[j];
+		if (y1 == yp && y2 == yp) {	/* Horizontal edge lying along the scanline; its entire span is boundary */
+			gmtsupport_scanline_add (GMT, SL, 0.5 * (x1 + x2), 0.5 * fabs (x2 - x1) + GMT_CONV8_LIMIT, 0);
+			continue;
+		}
+		if (y1 == yp)	/* Vertex exactly on the scanline is a boundary point even if neither edge crosses */
+			gmtsupport_scanline_add (GMT, SL, x1, GMT_CONV8_LIMIT, 0);
+		if ((y1 <= yp && y2 > yp) || (y2 <= yp && y1 > yp)) {	/* Edge crosses the scanline */
+			slope = (x2 - x1) / (y2 - y1);
+			/* Nearly flat edges pin the crossing poorly so the guard zone scales with the inverse slope */
+			gmtsupport_scanline_add (GMT, SL, x1 + (yp - y1) * slope, GMT_CONV8_LIMIT * (1.0 + fabs (slope)), (y2 > y1) ? +1 : -1);
+		}
+	}
+	qsort (SL->C, SL->n_x, sizeof (struct GMT_SCANLINE_CROSS), gmtsupport_comp_scanline_cross);
+	SL->wind[SL->n_x] = 0;	/* A closed boundary crosses the full line equally often up and down so winding is zero right of all crossings */
+	for (k = SL->n_x; k > 0; k--) {	/* Accumulate winding numbers and leftmost guard limits from the right */
+		SL->wind[k-1] = SL->wind[k] + SL->C[k-1].dir;
+		SL->lmost[k-1] = SL->C[k-1].x - SL->C[k-1].guard;
+		if (k < SL->n_x && SL->lmost[k] < SL->lmost[k-1]) SL->lmost[k-1] = SL->lmost[k];
+	}
+	for (k = 0; k < SL->n_x; k++) {	/* Accumulate rightmost guard limits from the left */
+		SL->rmost[k] = SL->C[k].x + SL->C[k].guard;
+		if (k && SL->rmost[k-1] > SL->rmost[k]) SL->rmost[k] = SL->rmost[k-1];
+	}
+}
+
+/*! . */
+bool gmt_scanline_side (struct GMT_SCANLINE *SL, double xp, unsigned int *side) {
+	/* Classify the point (xp, yp) against the crossings recorded by gmt_scanline_build for the
+	 * line y = yp.  Returns true with side set to GMT_INSIDE or GMT_OUTSIDE when the point is
+	 * safely away from the boundary, and false when it falls inside a guard zone so the caller
+	 * must classify it with the exact per-node test instead. */
+	uint64_t lo = 0, hi = SL->n_x, mid;
+	while (lo < hi) {	/* Find the first crossing with x > xp */
+		mid = (lo + hi) / 2;
+		if (SL->C[mid].x > xp) hi = mid; else lo = mid + 1;
+	}
+	if (lo > 0 && SL->rmost[lo-1] >= xp) return (false);	/* Inside the guard zone of a crossing at or left of xp */
+	if (lo < SL->n_x && SL->lmost[lo] <= xp) return (false);	/* Inside the guard zone of a crossing right of xp */
+	*side = (SL->wind[lo]) ? GMT_INSIDE : GMT_OUTSIDE;
+	return (true);
+}
+
 /*! . */
 unsigned int gmt_inonout (struct GMT_CTRL *GMT, double x, double y, struct GMT_DATASEGMENT *S) {
 	/* Front end for both spherical and Cartesian in-on-out functions.
@@ -12680,11 +13168,14 @@ void gmt_delaunay_free (struct GMT_CTRL *GMT, int **link) {
 int gmt_BC_init (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *h) {
 	int i = 0, type;
 	bool same;
+	unsigned int old_BC[4];
 	char *kind[5] = {"not set", "natural", "periodic", "geographic", "extended data"};
 	struct GMT_GRID_HEADER_HIDDEN *HH = gmt_get_H_hidden (h);
 
 	if (HH->no_BC) return (GMT_NOERROR);	/* Told not to deal with BC stuff */
 
+	gmt_M_memcpy (old_BC, HH->BC, 4, unsigned int);	/* So we can detect changed conditions below */
+
 	if (GMT->common.n.bc_set) {	/* Override BCs via -n+<BC> */
 		while (GMT->common.n.BC[i]) {
 			switch (GMT->common.n.BC[i]) {
@@ -12781,6 +13272,8 @@ int gmt_BC_init (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *h) {
 			GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Chosen boundary condition for top    edge: %s\n", kind[HH->BC[YHI]]);
 		}
 	}
+	for (i = 0; i < 4; i++) if (HH->BC[i] != old_BC[i]) HH->bc_generation = 0;	/* Changed conditions void any earlier pad fill */
+
 	/* Set this grid's interpolation parameters */
 
 	HH->bcr_interpolant = GMT->common.n.interpolant;
@@ -12818,6 +13311,7 @@ int gmt_grd_BC_set (struct GMT_CTRL *GMT, struct GMT_GRID *G, unsigned int direc
 	uint64_t j1p, j2p;	/* j_o1 and j_o2 pole constraint rows  */
 	unsigned int n_skip, n_set;
 	unsigned int bok;		/* bok used to test that things are OK  */
+	openmp_int kk;		/* Edge fill loop counter when threaded */
 	bool set[4] = {true, true, true, true};
 	struct GMT_GRID_HEADER_HIDDEN *HH = gmt_get_H_hidden (G->header);
 
@@ -12828,11 +13322,17 @@ int gmt_grd_BC_set (struct GMT_CTRL *GMT, struct GMT_GRID *G, unsigned int direc
 	if (HH->no_BC) return (GMT_NOERROR);	/* Told not to deal with BC stuff */
 	if (G->data == NULL) return (GMT_NOERROR);	/* Premature call; no grid data yet */
 
+	if (HH->bc_generation && HH->bc_generation == HH->data_generation) {	/* Pad already reflects the current data; see gmt_grd_dirty */
+		GMT_Report (GMT->parent, GMT_MSG_DEBUG, "gmt_grd_BC_set: Boundary conditions still current; edge fill skipped.\n");
+		return (GMT_NOERROR);
+	}
+
 	for (i = n_skip = 0; i < 4; i++) {
 		if (HH->BC[i] == GMT_BC_IS_DATA) {set[i] = false; n_skip++;}	/* No need to set since there is data in the pad area */
 	}
 	if (n_skip == 4) {	/* No need to set anything since there is data in the pad area on all sides */
 		GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "gmt_grd_BC_set: All boundaries set via extended data.\n");
+		HH->bc_generation = HH->data_generation;	/* The pad remains valid until the data change */
 		return (GMT_NOERROR);
 	}
 
@@ -12928,7 +13428,12 @@ int gmt_grd_BC_set (struct GMT_CTRL *GMT, struct GMT_GRID *G, unsigned int direc
 
 		if (HH->nyp > 0) {	/* y is periodic  */
 
-			for (i = iw, bok = 0; i <= ie; ++i) {
+			bok = 0;
+#ifdef _OPENMP
+#pragma omp parallel for private(kk,i) shared(G,set,iw,jn,js,jno1,jno2,jso1,jso2,jno1k,jno2k,jso1k,jso2k) reduction(+:bok)
+#endif
+			for (kk = 0; kk < (openmp_int)G->header->n_columns; ++kk) {
+				i = iw + kk;
 				if (G->header->registration == GMT_GRID_NODE_REG && !doubleAlmostEqualZero (G->data[jn+i], G->data[js+i]))
 					++bok;
 				if (set[YHI]) {
@@ -12983,6 +13488,7 @@ int gmt_grd_BC_set (struct GMT_CTRL *GMT, struct GMT_GRID *G, unsigned int direc
 			}
 
 			/* DONE with X not periodic, Y periodic case.  Fully loaded.  */
+			HH->bc_generation = HH->data_generation;	/* The pad remains valid until the data change */
 			if (set[YLO] && set[YHI]) {
 				HH->BC[YLO] = HH->BC[YHI] = GMT_BC_IS_PERIODIC;
 				GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "gmt_grd_BC_set: Set boundary condition for bottom and top edges: %s\n", kind[HH->BC[YLO]]);
@@ -13045,6 +13551,7 @@ int gmt_grd_BC_set (struct GMT_CTRL *GMT, struct GMT_GRID *G, unsigned int direc
 					+ (G->data[ie + jmx - mx] - G->data[ieo1 + jmx - mx]) + (G->data[ie + jmx + mx] - G->data[ieo1 + jmx + mx]);
 			}
 			/* DONE with X not periodic, Y not periodic case.  Loaded all but three corner-most points at each corner.  */
+			HH->bc_generation = HH->data_generation;	/* The pad remains valid until the data change */
 
 			for (i = n_set = 0; i < 4; i++) if (set[i]) {
 				n_set++;
@@ -13064,7 +13571,12 @@ int gmt_grd_BC_set (struct GMT_CTRL *GMT, struct GMT_GRID *G, unsigned int direc
 		bool check_repeat = (G->header->registration == GMT_GRID_NODE_REG && HH->grdtype == GMT_GRID_GEOGRAPHIC_EXACT360_REPEAT);
 		if (set[XLO]) HH->BC[XLO] = GMT_BC_IS_PERIODIC;
 		if (set[XHI]) HH->BC[XHI] = GMT_BC_IS_PERIODIC;
-		for (jmx = jn, bok = 0; jmx <= js; jmx += mx) {
+		bok = 0;
+#ifdef _OPENMP
+#pragma omp parallel for private(kk,jmx) shared(G,set,check_repeat,jn,mx,iw,ie,iwo1,iwo2,ieo1,ieo2,iwo1k,iwo2k,ieo1k,ieo2k) reduction(+:bok)
+#endif
+		for (kk = 0; kk < (openmp_int)G->header->n_rows; ++kk) {
+			jmx = jn + (uint64_t)kk * mx;
 			if (check_repeat && !doubleAlmostEqualZero (G->data[jmx+iw], G->data[jmx+ie]))
 				++bok;
 			if (set[XLO]) {
@@ -13079,7 +13591,12 @@ int gmt_grd_BC_set (struct GMT_CTRL *GMT, struct GMT_GRID *G, unsigned int direc
 		if (bok > 0) GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "gmt_grd_BC_set: %d (of %d) inconsistent grid values at West and East boundaries for repeated nodes.\n", bok, G->header->n_rows);
 
 		if (HH->nyp > 0) {	/* Y is periodic.  copy all, including boundary cols:  */
-			for (i = iwo2, bok = 0; i <= ieo2; ++i) {
+			bok = 0;
+#ifdef _OPENMP
+#pragma omp parallel for private(kk,i) shared(G,set,iwo2,ieo2,jn,js,jno1,jno2,jso1,jso2,jno1k,jno2k,jso1k,jso2k) reduction(+:bok)
+#endif
+			for (kk = 0; kk < (openmp_int)(ieo2 - iwo2 + 1); ++kk) {
+				i = iwo2 + kk;
 				if (G->header->registration == GMT_GRID_NODE_REG && !doubleAlmostEqualZero (G->data[jn+i], G->data[js+i]))
 					++bok;
 				if (set[YHI]) {
@@ -13093,6 +13610,7 @@ int gmt_grd_BC_set (struct GMT_CTRL *GMT, struct GMT_GRID *G, unsigned int direc
 			}
 			if (bok > 0) GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "gmt_grd_BC_set: %d (of %d) inconsistent grid values at South and North boundaries for repeated nodes.\n", bok, G->header->n_columns);
 			/* DONE with X and Y both periodic.  Fully loaded.  */
+			HH->bc_generation = HH->data_generation;	/* The pad remains valid until the data change */
 
 			if (set[YLO] && set[YHI]) {
 				HH->BC[YLO] = HH->BC[YHI] = GMT_BC_IS_PERIODIC;
@@ -13210,6 +13728,7 @@ int gmt_grd_BC_set (struct GMT_CTRL *GMT, struct GMT_GRID *G, unsigned int direc
 		}
 
 		/* Done with X is periodic cases.  */
+		HH->bc_generation = HH->data_generation;	/* The pad remains valid until the data change */
 
 		return (GMT_NOERROR);
 	}
@@ -16241,6 +16760,94 @@ bool gmt_polygon_is_open (struct GMT_CTRL *GMT, double x[], double y[], uint64_t
 	return false;	/* Passed the tests so polygon is CLOSED */
 }
 
+/*! . */
+void gmt_dp_tolerance_tree (struct GMT_CTRL *GMT, double x_source[], double y_source[], uint64_t n_source, bool geo, double tol[]) {
+	/* Compute, for each vertex, the Douglas-Peucker tolerance below which that vertex survives
+	 * simplification (the classic DP tree).  Simplifying the line at any tolerance t then reduces
+	 * to keeping the vertices whose tol >= t, so a line that will be generalized at several
+	 * tolerances only needs this single pass.  Each deviation is capped by the parent segment's
+	 * value so the tolerances decrease down the tree and the filter selects the same vertices a
+	 * direct Douglas-Peucker pass at that tolerance would keep.  End points get DBL_MAX since
+	 * they are always retained.  Distances are Cartesian in the data units, or Flat Earth in
+	 * degrees when geo is true, exactly as in the gmtsimplify module (whose deviation test this
+	 * replicates; see the credits in gmtsimplify.c). */
+
+	uint64_t n_stack, start, end, i, sig;
+	uint64_t *sig_start = NULL, *sig_end = NULL;	/* Indices of start & end of working section */
+	double *cap = NULL;	/* Tolerance assigned to the parent vertex of the working section */
+	double dev, dev_sqr, max_dev_sqr;
+	double x12, y12, d12, x13, y13, d13, x23, y23, d23;
+
+	if (n_source == 0) return;
+	tol[0] = tol[n_source-1] = DBL_MAX;	/* The two end points never get eliminated */
+	if (n_source < 3) return;	/* Nothing in between */
+
+	sig_start = gmt_M_memory (GMT, NULL, n_source, uint64_t);
+	sig_end   = gmt_M_memory (GMT, NULL, n_source, uint64_t);
+	cap       = gmt_M_memory (GMT, NULL, n_source, double);
+
+	sig_start[0] = 0;	sig_end[0] = n_source - 1;	cap[0] = DBL_MAX;
+	n_stack = 1;
+
+	while (n_stack > 0) {	/* While the stack is not empty, pop the top-most section */
+		n_stack--;
+		start = sig_start[n_stack];
+		end   = sig_end[n_stack];
+		if ((end - start) < 2) continue;	/* No intermediate points */
+
+		/* Find the most deviant intermediate point from the line joining start & end points */
+
+		x12 = x_source[end] - x_source[start];
+		if (geo && fabs (x12) > 180.0) x12 = 360.0 - fabs (x12);
+		y12 = y_source[end] - y_source[start];
+		if (geo) x12 *= cosd (0.5 * (y_source[end] + y_source[start]));
+		d12 = x12 * x12 + y12 * y12;
+
+		for (i = start + 1, sig = start, max_dev_sqr = -1.0; i < end; i++) {
+			x13 = x_source[i] - x_source[start];
+			if (geo && fabs (x13) > 180.0) x13 = 360.0 - fabs (x13);
+			y13 = y_source[i] - y_source[start];
+
+			x23 = x_source[i] - x_source[end];
+			if (geo && fabs (x23) > 180.0) x23 = 360.0 - fabs (x23);
+			y23 = y_source[i] - y_source[end];
+
+			if (geo) {	/* Do the Flat Earth thingy */
+				x13 *= cosd (0.5 * (y_source[i] + y_source[start]));
+				x23 *= cosd (0.5 * (y_source[i] + y_source[end]));
+			}
+
+			d13 = x13 * x13 + y13 * y13;
+			d23 = x23 * x23 + y23 * y23;
+
+			if (d13 >= (d12 + d23))
+				dev_sqr = d23;
+			else if (d23 >= (d12 + d13))
+				dev_sqr = d13;
+			else
+				dev_sqr = (x13 * y12 - y13 * x12) * (x13 * y12 - y13 * x12) / d12;
+
+			if (dev_sqr > max_dev_sqr) {
+				sig = i;
+				max_dev_sqr = dev_sqr;
+			}
+		}
+
+		dev = sqrt (max_dev_sqr);
+		if (dev > cap[n_stack]) dev = cap[n_stack];	/* Never exceed the parent vertex tolerance */
+		tol[sig] = dev;
+
+		/* Unlike plain Douglas-Peucker we always recurse into both sub-sections since every vertex needs its tolerance */
+
+		sig_start[n_stack] = start;	sig_end[n_stack] = sig;	cap[n_stack] = dev;	n_stack++;
+		sig_start[n_stack] = sig;	sig_end[n_stack] = end;	cap[n_stack] = dev;	n_stack++;
+	}
+
+	gmt_M_free (GMT, sig_start);
+	gmt_M_free (GMT, sig_end);
+	gmt_M_free (GMT, cap);
+}
+
 /*! . */
 int gmt_polygon_centroid (struct GMT_CTRL *GMT, double *x, double *y, uint64_t n, double *Cx, double *Cy) {
 	/* Compute polygon centroid location. */
@@ -16305,25 +16912,127 @@ openmp_int * gmt_prep_nodesearch (struct GMT_CTRL *GMT, struct GMT_GRID *G, doub
 	return (d_col);		/* The (possibly variable) half-width of nodes in x-direction as function of y */
 }
 
+/*! . */
+GMT_LOCAL uint64_t gmtsupport_point_bin_no (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *h, struct GMT_POINT_BIN *B, double x, double y) {
+	/* Return the bin number for point (x,y), clamping points beyond the halo to the outermost ring */
+	int64_t row = (int64_t)gmt_M_grd_y_to_row (GMT, y, h) + B->halo_row;
+	int64_t col = (int64_t)gmt_M_grd_x_to_col (GMT, x, h) + B->halo_col;
+	if (row < 0) row = 0; else if (row >= (int64_t)B->n_bin_rows) row = B->n_bin_rows - 1;
+	if (col < 0) col = 0; else if (col >= (int64_t)B->n_bin_cols) col = B->n_bin_cols - 1;
+	return ((uint64_t)row * B->n_bin_cols + col);
+}
+
+/*! . */
+struct GMT_POINT_BIN * gmt_point_bin_create (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *h, const double *x, const double *y, uint64_t n, openmp_int halo_row, openmp_int halo_col) {
+	/* Build a bin index over the n points (x[k],y[k]) so that modules gridding scattered data can visit
+	 * the points near any grid node directly instead of scanning the entire table once per point or node.
+	 * Each bin coincides with one grid node's cell; halo_row/halo_col extra rings of bins on each side hold
+	 * points that fall outside the grid domain yet lie within a search radius of nodes near the edges.
+	 * Points beyond the halo are clamped to the outermost ring; since callers must apply their own distance
+	 * test to each candidate anyway this at most costs a few wasted comparisons.  We use a two-pass counting
+	 * sort so ids preserves input order within each bin.  Returns NULL if n is zero. */
+	uint64_t k, b, n_bins;
+	uint64_t *next = NULL;
+	struct GMT_POINT_BIN *B = NULL;
+
+	if (n == 0) return (NULL);	/* Nothing to index */
+	B = gmt_M_memory (GMT, NULL, 1, struct GMT_POINT_BIN);
+	B->halo_row = halo_row;	B->halo_col = halo_col;
+	B->n_bin_rows = h->n_rows    + 2 * halo_row;
+	B->n_bin_cols = h->n_columns + 2 * halo_col;
+	n_bins = (uint64_t)B->n_bin_rows * B->n_bin_cols;
+	B->start = gmt_M_memory (GMT, NULL, n_bins + 1, uint64_t);
+	B->ids   = gmt_M_memory (GMT, NULL, n, uint64_t);
+	for (k = 0; k < n; k++)	/* First pass: count the number of points per bin */
+		B->start[gmtsupport_point_bin_no (GMT, h, B, x[k], y[k]) + 1]++;
+	for (b = 0; b < n_bins; b++) B->start[b+1] += B->start[b];	/* Convert the counts to running offsets */
+	next = gmt_M_memory (GMT, NULL, n_bins, uint64_t);
+	gmt_M_memcpy (next, B->start, n_bins, uint64_t);
+	for (k = 0; k < n; k++) {	/* Second pass: place the point ids in their bins, keeping input order */
+		b = gmtsupport_point_bin_no (GMT, h, B, x[k], y[k]);
+		B->ids[next[b]++] = k;
+	}
+	gmt_M_free (GMT, next);
+	return (B);
+}
+
+/*! . */
+void gmt_point_bin_free (struct GMT_CTRL *GMT, struct GMT_POINT_BIN **B) {
+	/* Free a point bin index created by gmt_point_bin_create */
+	if (*B == NULL) return;
+	gmt_M_free (GMT, (*B)->start);
+	gmt_M_free (GMT, (*B)->ids);
+	gmt_M_free (GMT, *B);
+}
+
 /* These three functions are used by grdmath and gmtmath only */
 
+GMT_LOCAL struct GMT_MATH_MACRO *gmtsupport_macrocache_dup (struct GMT_CTRL *GMT, struct GMT_MATH_MACRO *M, unsigned int n_macros) {
+	/* Return a deep copy of a parsed macro table so callers can free their copy as usual */
+	unsigned int n, k;
+	struct GMT_MATH_MACRO *D = gmt_M_memory (GMT, NULL, n_macros, struct GMT_MATH_MACRO);
+
+	for (n = 0; n < n_macros; n++) {
+		D[n].name = strdup (M[n].name);
+		D[n].n_arg = M[n].n_arg;
+		D[n].arg = gmt_M_memory (GMT, NULL, M[n].n_arg, char *);
+		for (k = 0; k < M[n].n_arg; k++) D[n].arg[k] = strdup (M[n].arg[k]);
+	}
+	return (D);
+}
+
+GMT_LOCAL void gmtsupport_macrocache_drop (struct GMT_CTRL *GMT, struct GMT_MACROCACHE_SLOT *S) {
+	/* Release one slot of the session macro cache */
+	gmt_M_str_free (S->path);
+	gmt_free_macros (GMT, S->n_macros, &S->M);
+	gmt_M_memset (S, 1, struct GMT_MACROCACHE_SLOT);
+}
+
+void gmtlib_macrocache_free (struct GMT_CTRL *GMT) {
+	/* Release any macro file parses kept for the session */
+	unsigned int k;
+	for (k = 0; k < GMT_MACROCACHE_N_SLOTS; k++)
+		if (GMT->session.macrocache.slot[k].path) gmtsupport_macrocache_drop (GMT, &GMT->session.macrocache.slot[k]);
+}
+
 /*! . */
 int gmt_load_macros (struct GMT_CTRL *GMT, char *mtype, struct GMT_MATH_MACRO **M) {
 	/* Load in any gmt/grdmath macros.  These records are of the format
 	 * MACRO = ARG1 ARG2 ... ARGN [ : comments on what they do]
 	 * The comments, if present, must be preceded by :<space> to distinguish
-	 * the flag from any dd:mm:ss or hh:mm:ss constants used in the macro. */
+	 * the flag from any dd:mm:ss or hh:mm:ss constants used in the macro.
+	 * A parsed file is kept in the session macro cache so the many calls of
+	 * a batch loop only tokenize it once; a change in the file's time stamp
+	 * or size voids the cached parse. */
 
 	unsigned int n = 0, k = 0, pos = 0;
 	size_t n_alloc = 0;
 	char line[GMT_BUFSIZ] = {""}, name[GMT_LEN64] = {""}, item[GMT_LEN64] = {""}, args[GMT_BUFSIZ] = {""}, *c = NULL;
+	char path[PATH_MAX] = {""};
 	struct GMT_MATH_MACRO *macro = NULL;
+	struct GMT_MACROCACHE_SLOT *S = NULL;
+	struct stat sbuf;
+	bool have_stat;
 	FILE *fp = NULL;
 
-	if (!gmtlib_getuserpath (GMT, mtype, line)) return (0);
+	if (!gmtlib_getuserpath (GMT, mtype, path)) return (0);
 
-	if ((fp = fopen (line, "r")) == NULL) {
-		GMT_Report (GMT->parent, GMT_MSG_ERROR, "Unable to open %s macro file\n", line);
+	have_stat = (stat (path, &sbuf) == 0);
+	if (have_stat) {	/* See if this file was already parsed in this session */
+		for (k = 0; k < GMT_MACROCACHE_N_SLOTS; k++) {
+			if ((S = &GMT->session.macrocache.slot[k])->path == NULL || strcmp (S->path, path)) continue;
+			if (S->mtime == (int64_t)sbuf.st_mtime && S->fsize == (int64_t)sbuf.st_size) {	/* Still current; hand out a copy */
+				GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Macro cache hit for %s\n", path);
+				*M = gmtsupport_macrocache_dup (GMT, S->M, S->n_macros);
+				return (S->n_macros);
+			}
+			gmtsupport_macrocache_drop (GMT, S);	/* The file changed on disk; re-parse below */
+			break;
+		}
+	}
+
+	if ((fp = fopen (path, "r")) == NULL) {
+		GMT_Report (GMT->parent, GMT_MSG_ERROR, "Unable to open %s macro file\n", path);
 		return -1;
 	}
 
@@ -16347,6 +17056,19 @@ int gmt_load_macros (struct GMT_CTRL *GMT, char *mtype, struct GMT_MATH_MACRO **
 	fclose (fp);
 	if (n < n_alloc) macro = gmt_M_memory (GMT, macro, n, struct GMT_MATH_MACRO);
 
+	if (have_stat && n) {	/* Keep a pristine copy for later calls in this session */
+		for (k = 0; k < GMT_MACROCACHE_N_SLOTS && GMT->session.macrocache.slot[k].path; k++);	/* Find first free slot */
+		if (k < GMT_MACROCACHE_N_SLOTS) {	/* Otherwise both math flavors plus something else competed; just skip caching */
+			S = &GMT->session.macrocache.slot[k];
+			S->path = strdup (path);
+			S->mtime = (int64_t)sbuf.st_mtime;
+			S->fsize = (int64_t)sbuf.st_size;
+			S->n_macros = n;
+			S->M = gmtsupport_macrocache_dup (GMT, macro, n);
+			GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Cached %d macros from %s\n", n, path);
+		}
+	}
+
 	*M = macro;
 	return (n);
 }
@@ -17503,6 +18225,98 @@ void gmt_enable_threads (struct GMT_CTRL *GMT) {
 #endif
 }
 
+#ifdef HAVE_GLIB_GTHREAD
+struct GMTSUPPORT_POOL_TASK {	/* One submitted unit of work for the session thread pool */
+	void (*func) (void *);	/* The function to call on a worker thread */
+	void *arg;		/* Its argument */
+};
+
+struct GMTSUPPORT_THREAD_POOL {	/* Persistent session-wide pool of worker threads; see gmt_thread_pool_submit */
+	GThreadPool *pool;	/* The underlying GLIB thread pool */
+	GMutex mutex;		/* Protects the pending counter */
+	GCond cond;		/* Signaled whenever a task completes */
+	unsigned int pending;	/* Number of submitted tasks not yet completed */
+};
+
+GMT_LOCAL void gmtsupport_pool_dispatch (gpointer data, gpointer user_data) {
+	/* Runs on a worker thread: execute one task, then flag its completion */
+	struct GMTSUPPORT_POOL_TASK *task = data;
+	struct GMTSUPPORT_THREAD_POOL *P = user_data;
+	task->func (task->arg);
+	free (task);	/* Plain free since gmt_M_free is not safe off the main thread */
+	g_mutex_lock (&P->mutex);
+	P->pending--;
+	g_cond_signal (&P->cond);
+	g_mutex_unlock (&P->mutex);
+}
+#endif
+
+/*! . */
+int gmt_thread_pool_submit (struct GMT_CTRL *GMT, void (*func) (void *), void *arg) {
+	/* Submit one task to the persistent session thread pool, spinning up the workers the
+	 * first time we get here; they stay around until gmt_end so repeated calls stop paying
+	 * the thread launch cost.  Tasks start in submission order on the next free worker and
+	 * the caller must issue gmt_thread_pool_wait before touching any shared results.  When
+	 * GMT was built without GLIB threading we simply run the task right here instead. */
+#ifdef HAVE_GLIB_GTHREAD
+	struct GMTSUPPORT_THREAD_POOL *P = GMT->session.thread_pool;
+	struct GMTSUPPORT_POOL_TASK *task = NULL;
+	if (P == NULL) {	/* First submission in this session */
+		P = gmt_M_memory (GMT, NULL, 1, struct GMTSUPPORT_THREAD_POOL);
+		g_mutex_init (&P->mutex);
+		g_cond_init (&P->cond);
+		if ((P->pool = g_thread_pool_new (gmtsupport_pool_dispatch, P, gmtlib_get_num_processors (), FALSE, NULL)) == NULL) {
+			gmt_M_free (GMT, P);
+			return (GMT_RUNTIME_ERROR);
+		}
+		GMT->session.thread_pool = P;
+		GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Created session thread pool with up to %d workers\n", gmtlib_get_num_processors ());
+	}
+	if ((task = malloc (sizeof (struct GMTSUPPORT_POOL_TASK))) == NULL)	/* Freed by the worker, hence no gmt_M_memory */
+		return (GMT_MEMORY_ERROR);
+	task->func = func;	task->arg = arg;
+	g_mutex_lock (&P->mutex);
+	P->pending++;
+	g_mutex_unlock (&P->mutex);
+	g_thread_pool_push (P->pool, task, NULL);
+#else
+	gmt_M_unused(GMT);
+	func (arg);	/* No thread support; do the work right away */
+#endif
+	return (GMT_NOERROR);
+}
+
+/*! . */
+void gmt_thread_pool_wait (struct GMT_CTRL *GMT) {
+	/* Block until every task submitted via gmt_thread_pool_submit has completed */
+#ifdef HAVE_GLIB_GTHREAD
+	struct GMTSUPPORT_THREAD_POOL *P = GMT->session.thread_pool;
+	if (P == NULL) return;	/* No tasks were ever submitted */
+	g_mutex_lock (&P->mutex);
+	while (P->pending)
+		g_cond_wait (&P->cond, &P->mutex);
+	g_mutex_unlock (&P->mutex);
+#else
+	gmt_M_unused(GMT);
+#endif
+}
+
+/*! . */
+void gmtlib_thread_pool_destroy (struct GMT_CTRL *GMT) {
+	/* Called from gmt_end: finish any queued tasks, then join and release the workers */
+#ifdef HAVE_GLIB_GTHREAD
+	struct GMTSUPPORT_THREAD_POOL *P = GMT->session.thread_pool;
+	if (P == NULL) return;	/* Pool was never created */
+	g_thread_pool_free (P->pool, FALSE, TRUE);	/* FALSE, TRUE means run remaining tasks and wait for them */
+	g_mutex_clear (&P->mutex);
+	g_cond_clear (&P->cond);
+	gmt_M_free (GMT, P);
+	GMT->session.thread_pool = NULL;
+#else
+	gmt_M_unused(GMT);
+#endif
+}
+
 /*! . */
 unsigned int gmt_validate_modifiers (struct GMT_CTRL *GMT, const char *string, const char option, const char *valid_modifiers, unsigned int verbosity) {
 	/* Looks for modifiers +<mod> in string and making sure <mod> is
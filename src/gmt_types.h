@@ -89,6 +89,16 @@ struct GMT_SURFACE_SUGGESTION {	/* Used to find top ten list of faster grid dime
 	double factor;	/* Speed up by a factor of factor  */
 };
 
+/*! Definition of structure used for binning scattered data points for node-centered neighbor searches */
+struct GMT_POINT_BIN {	/* Created by gmt_point_bin_create and freed by gmt_point_bin_free */
+	openmp_int n_bin_rows;	/* Number of bin rows (the grid's n_rows plus 2 * halo_row) */
+	openmp_int n_bin_cols;	/* Number of bin columns (the grid's n_columns plus 2 * halo_col) */
+	openmp_int halo_row;	/* Extra rings of bins above and below the grid domain */
+	openmp_int halo_col;	/* Extra rings of bins on either side of the grid domain */
+	uint64_t *start;	/* Entry b is the first element in ids belonging to bin b [n_bin_rows * n_bin_cols + 1 terms] */
+	uint64_t *ids;		/* Point indices sorted on bin number, keeping input order within each bin */
+};
+
 /*! Definition of structure used for holding information of integer items to be selected */
 struct GMT_INT_SELECTION {	/* Used to hold array with items (0-n) that have been selected */
 	uint64_t *item;		/* Array with item numbers given (0 is first), sorted into ascending order */
@@ -250,6 +260,25 @@ struct GMT_DIST {	/* Holds info for a particular distance calculation */
 	double scale;	/* Scale to convert function output to desired unit */
 };
 
+enum GMT_enum_dist_from {	/* Fast-path flavors recognized by gmt_distance_from */
+	GMT_DIST_FROM_GENERIC = 0,	/* No fast path; fall back on gmt_distance */
+	GMT_DIST_FROM_GC_DEG,		/* Great circle distance in degrees */
+	GMT_DIST_FROM_GC_METER,		/* Great circle distance in meters */
+	GMT_DIST_FROM_GC_COS,		/* Cosine of great circle distance */
+	GMT_DIST_FROM_VINCENTY};	/* Vincenty geodesic distance in meters */
+
+struct GMT_DIST_FROM {	/* Precomputed state for repeated distance calculations from a fixed origin; see gmt_distance_from_prep */
+	unsigned int mode;	/* One of GMT_enum_dist_from, selected from the current distance settings */
+	double lon0, lat0;	/* The origin as given */
+	double lat0_aux;	/* Origin latitude after any auxiliary latitude conversion */
+	double cos_lat0;	/* Cosine of (auxiliary) origin latitude */
+	double f, r;		/* Ellipsoid flattening and 1 - flattening */
+	double tu1, su1, cu1;	/* Vincenty terms of the origin latitude */
+	double last_lat;	/* Target latitude that the cached terms below refer to */
+	double sy2, coscos;	/* Great circle terms of last_lat */
+	double tu2, cu2;	/* Vincenty terms of last_lat */
+};
+
 struct GMT_MAP {		/* Holds all map-related parameters */
 	struct GMT_PLOT_FRAME frame;		/* Everything about the frame parameters */
 	int this_x_status;			/* Tells us what quadrant old and new points are in (-4/4) */
@@ -399,6 +428,22 @@ struct GMT_CURRENT {
 	struct GMT_GDALWRITE_CTRL    gdal_write;    /* Hold parameters related to options transmitted to gdalwrite */
 };
 
+#ifdef GMT_ENABLE_TIMINGS
+/*! Library phases instrumented via the gmt_M_tic/gmt_M_toc macros (see gmt_macros.h) */
+enum GMT_enum_timing {
+	GMT_TIMING_IO = 0,	/* Data import and export through the API funnels */
+	GMT_TIMING_PROJ,	/* Projection initialization in gmt_map_setup */
+	GMT_TIMING_GRDIO,	/* Grid data read and write */
+	GMT_TIMING_PSL,		/* PostScript finalization in gmt_plotend */
+	GMT_TIMING_N_PHASES};
+
+struct GMT_TIMINGS {	/* Wall-clock time accumulated per instrumented phase */
+	double t0[GMT_TIMING_N_PHASES];		/* Start of the currently open interval [set by gmt_M_tic] */
+	double accum[GMT_TIMING_N_PHASES];	/* Total seconds accumulated [updated by gmt_M_toc] */
+	uint64_t count[GMT_TIMING_N_PHASES];	/* Number of completed intervals */
+};
+#endif
+
 struct GMT_INTERNAL {
 	/* These are internal parameters that need to be passed around between
 	 * many GMT functions.  These may change during execution but are not
@@ -412,7 +457,11 @@ struct GMT_INTERNAL {
 	size_t mem_txt_dup;
 	double **mem_coord;		/* Columns of temp memory */
 	char **mem_txt;			/* For temp text */
+	struct GMT_MEM_ARENA *mem_arena;	/* If set, gmt_get_segment and gmt_alloc_segment draw their memory from this arena */
 	struct MEMORY_TRACKER *mem_keeper;	/* Only filled when #ifdef MEMDEBUG  */
+#ifdef GMT_ENABLE_TIMINGS
+	struct GMT_TIMINGS timings;	/* Accumulated hot-path timings, reported and reset by gmt_end_module */
+#endif
 #ifdef DEBUG
 	bool gridline_debug;
 	char gridline_kind;
@@ -425,6 +474,75 @@ struct GMT_SHORTHAND {	/* Holds information for each grid extension shorthand re
 	char *format; /* format: ff/scale/offset/invalid */
 };
 
+struct GMT_SCANLINE_CROSS {	/* One meeting point between a polygon boundary and a horizontal scanline */
+	double x;		/* x-coordinate where the boundary meets the scanline */
+	double guard;		/* Half-width about x where classification must fall back on the exact per-node test */
+	int dir;		/* +1|-1 for edges crossing upward|downward, 0 for boundary points that do not cross */
+};
+
+struct GMT_SCANLINE {	/* Reusable workspace for scanline polygon rasterization (see gmt_scanline_build) */
+	uint64_t n_alloc;	/* Current allocation length of the arrays below */
+	uint64_t n_x;		/* Number of crossings recorded for the current scanline */
+	struct GMT_SCANLINE_CROSS *C;	/* The crossings, sorted on x */
+	int *wind;		/* wind[k] is the winding number between crossings k-1 and k [n_x+1 entries] */
+	double *lmost;		/* lmost[k] is the leftmost guard-zone limit among crossings k and higher */
+	double *rmost;		/* rmost[k] is the rightmost guard-zone limit among crossings k and lower */
+};
+
+#define GMT_GRDCACHE_N_SLOTS 8	/* Max number of grid (sub)reads kept in the session grid cache */
+
+struct GMT_GRDCACHE_SLOT {	/* One cached grid (subregion) read */
+	char *key;			/* Signature of file name, variable, subregion, pad, and complex mode */
+	int64_t mtime;			/* Modification time of the source file when it was cached */
+	size_t n_bytes;			/* Size of the cached padded array in bytes, uncompressed */
+	size_t n_comp;			/* Bytes actually held when the copy is deflated [0 means stored raw] */
+	uint64_t last_use;		/* Access counter driving LRU eviction */
+	gmt_grdfloat *data;		/* Private copy of the padded array [possibly a deflated stream; see n_comp] */
+	struct GMT_GRID_HEADER *header;	/* Snapshot of the header as the reader left it */
+};
+
+struct GMT_GRDCACHE {	/* Session-level LRU cache of recent grid reads [enabled via the GMT_GRID_CACHE environment variable] */
+	uint64_t counter;		/* Running access counter */
+	size_t limit;			/* Max total bytes the cache may hold [0 means disabled] */
+	size_t used;			/* Current total bytes held */
+	struct GMT_GRDCACHE_SLOT slot[GMT_GRDCACHE_N_SLOTS];
+};
+
+#define GMT_CPTCACHE_N_SLOTS 16	/* Max number of parsed CPT files kept in the session CPT cache */
+
+struct GMT_CPTCACHE_SLOT {	/* One cached CPT file parse */
+	char *key;			/* Signature of the CPT argument, flags, and the color defaults in effect */
+	int64_t mtime;			/* Modification time of the CPT file when it was cached */
+	uint64_t last_use;		/* Access counter driving LRU eviction */
+	unsigned int color_model;	/* The COLOR_MODEL setting as the parse left it */
+	struct GMT_PALETTE *P;		/* Pristine duplicate of the parsed palette */
+};
+
+struct GMT_CPTCACHE {	/* Session-level LRU cache of parsed CPT files [enabled via the GMT_CPT_CACHE environment variable] */
+	uint64_t counter;		/* Running access counter */
+	unsigned int n_slots;		/* Number of slots in use [0 means disabled] */
+	struct GMT_CPTCACHE_SLOT slot[GMT_CPTCACHE_N_SLOTS];
+};
+
+struct GMT_PROJSNAPSHOT {	/* Session-level snapshot of the region derived by the last map perimeter search */
+	char *key;		/* Signature of the -R -J setup that produced it [NULL means no snapshot held] */
+	double wesn[4];		/* The lon/lat region that gmt_map_perimeter_search derived for that setup */
+};
+
+#define GMT_MACROCACHE_N_SLOTS 2	/* One each for the gmtmath and grdmath macro files */
+
+struct GMT_MACROCACHE_SLOT {	/* One parsed math macro file kept for the session */
+	char *path;		/* Resolved path of the macro file [NULL means slot free] */
+	int64_t mtime;		/* Modification time of the file when it was parsed */
+	int64_t fsize;		/* Size of the file when it was parsed */
+	unsigned int n_macros;	/* Number of macros the file defined */
+	struct GMT_MATH_MACRO *M;	/* The pristine parsed macro table */
+};
+
+struct GMT_MACROCACHE {	/* Session cache of parsed gmtmath/grdmath operator macro files */
+	struct GMT_MACROCACHE_SLOT slot[GMT_MACROCACHE_N_SLOTS];
+};
+
 struct GMT_SESSION {
 	/* These are parameters that is set once at the start of a GMT session and
 	 * are essentially read-only constants for the duration of the session */
@@ -466,6 +584,16 @@ struct GMT_SESSION {
 	struct GMT_FONTSPEC *font;		/* Array with font names and height specification */
 	struct GMT_MEDIA *user_media;		/* Array with custom media dimensions */
 	struct GMT_SHORTHAND *shorthand;	/* Array with info about shorthand file extension magic */
+	void *thread_pool;		/* Opaque handle to the persistent thread pool; NULL until first task is submitted */
+	struct GMT_GRDCACHE *grdcache;	/* LRU cache of recent grid reads; allocated on first read, stays empty unless GMT_GRID_CACHE is set */
+	struct GMT_CPTCACHE *cptcache;	/* LRU cache of parsed CPT files; allocated on first read, stays empty unless GMT_CPT_CACHE is set */
+	void *dcw_lists;		/* Opaque cache of the parsed DCW country/state/collection lists; NULL until the first DCW request */
+	int nc_cached_id;		/* Read-only netCDF handle kept open across repeated reads of the same file (e.g., cube layers) [GMT_NOTSET] */
+	bool nc_cached_busy;		/* true while the cached netCDF handle is checked out via gmt_nc_open */
+	char *nc_cached_name;		/* Path of the cached netCDF handle [NULL] */
+	struct GMT_PROJSNAPSHOT projsnapshot;	/* Region derived by the last map perimeter search so identical -R -J setups can skip it */
+	struct GMT_MACROCACHE macrocache;	/* Parsed gmtmath/grdmath macro files so repeated calls skip the re-tokenization */
+	void *curlshare;		/* Opaque libcurl share handle pooling DNS/TLS/connection state across the session's transfers [NULL until first use] */
 };
 
 struct GMT_CTRL {
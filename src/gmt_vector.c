@@ -1045,7 +1045,28 @@ int gmt_gauss (struct GMT_CTRL *GMT, double *a, double *vec, unsigned int n, uns
 	return (iet + ieb);   /* Return final error flag */
 }
 
+#ifdef HAVE_LAPACK
+#ifndef __APPLE__	/* Since they are already declared in Accelerate.h */
+extern int dgetrf_ (int* m, int* n, double* a, int* lda, int* ipiv, int* info);
+extern int dgetrs_ (char* trans, int* n, int* nrhs, double* a, int* lda, int* ipiv, double* b, int* ldb, int* info);
+#endif
+#endif
+
 int gmt_gaussjordan (struct GMT_CTRL *GMT, double *a, unsigned int nu, double *b) {
+#ifdef HAVE_LAPACK
+	/* Use Lapack's blocked LU factorization instead of the scalar elimination below.
+	 * Our matrix is row-major while Lapack is column-major, so what we hand dgetrf is
+	 * effectively A-transpose; we then tell dgetrs to solve the transposed system and
+	 * thus never have to transpose the matrix ourselves. */
+	int n = (int)nu, one = 1, info, *ipiv = NULL;
+	GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "gmt_gaussjordan: Using Lapack dgetrf/dgetrs\n");
+	if ((ipiv = gmt_M_memory (GMT, NULL, nu, int)) == NULL) return (GMT_MEMORY_ERROR);
+	dgetrf_ (&n, &n, a, &n, ipiv, &info);	/* Compute the pivoted LU factorization */
+	if (info == 0) dgetrs_ ("T", &n, &one, a, &n, ipiv, b, &n, &info);	/* Solve A x = b, returning x via b */
+	gmt_M_free (GMT, ipiv);
+	if (info) GMT_Report (GMT->parent, GMT_MSG_ERROR, "gmt_gaussjordan given a singular matrix\n");
+	return (info != 0);
+#else
     int i, j, k, bad = 0, n = (int)nu;	/* Doing signed ints due to restriction from OpenMP on unsigned loop variables */
     double c, d;
 
@@ -1078,6 +1099,7 @@ int gmt_gaussjordan (struct GMT_CTRL *GMT, double *a, unsigned int nu, double *b
 	}
 
 	return (bad);
+#endif
 }
 
 #ifndef __APPLE__	/* Since it is already declared in Accelerate.h */
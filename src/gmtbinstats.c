@@ -787,8 +787,7 @@ EXTERN_MSC int GMT_gmtbinstats (void *V_API, int mode, void *args) {
 		case GMTBINSTATS_QUANT:	/* Compute plain quantile */
 			gmt_M_grd_loop (GMT, Grid, rowu, colu, ij) {
 				if ((k = n_in_circle[kk])) {
-					gmt_sort_array (GMT, zp[kk], k, GMT_FLOAT);
-					Grid->data[ij] = (gmt_grdfloat) gmt_quantile_f (GMT, zp[kk], Ctrl->C.quant, k);
+					Grid->data[ij] = (gmt_grdfloat) gmt_quantile_f_inplace (GMT, zp[kk], Ctrl->C.quant, k);
 					gmt_M_free (GMT, zp[kk]);
 					n++;
 				}
@@ -808,7 +807,7 @@ EXTERN_MSC int GMT_gmtbinstats (void *V_API, int mode, void *args) {
 		case GMTBINSTATS_IRANGE:	/* Compute plain inter quartile range */
 			gmt_M_grd_loop (GMT, Grid, rowu, colu, ij) {
 				if ((k = n_in_circle[kk])) {
-					Grid->data[ij] = (gmt_grdfloat) (gmt_quantile_f (GMT, zp[kk], 75.0, k) - gmt_quantile_f (GMT, zp[kk], 25.0, k));
+					Grid->data[ij] = (gmt_grdfloat) (gmt_quantile_f_inplace (GMT, zp[kk], 75.0, k) - gmt_quantile_f_inplace (GMT, zp[kk], 25.0, k));
 					gmt_M_free (GMT, zp[kk]);
 					n++;
 				}
@@ -250,6 +250,154 @@ GMT_LOCAL int gmtconnect_found_a_near_segment (struct GMTCONNECT_LINK *S, uint64
 	return (false);							/* Failed the next nearest neighbor distance test */
 }
 
+struct GMTCONNECT_BIN {	/* One segment endpoint keyed on its cell in the snap-tolerance lattice */
+	uint64_t key;		/* Cell number (lattice row * n_cols + lattice col) */
+	uint64_t item;		/* Endpoint number (2 * segment id + end) */
+};
+
+GMT_LOCAL int gmtconnect_compare_bins (const void *p1, const void *p2) {
+	const struct GMTCONNECT_BIN *a = p1, *b = p2;
+	if (a->key != b->key) return ((a->key < b->key) ? -1 : +1);
+	return ((a->item < b->item) ? -1 : ((a->item > b->item) ? +1 : 0));
+}
+
+GMT_LOCAL uint64_t gmtconnect_first_bin (struct GMTCONNECT_BIN *E, uint64_t n, uint64_t key) {
+	/* Return the index of the first entry in the key-sorted array E with this key (or where it would be) */
+	uint64_t lo = 0, hi = n, mid;
+	while (lo < hi) {
+		mid = (lo + hi) / 2;
+		if (E[mid].key < key) lo = mid + 1;
+		else hi = mid;
+	}
+	return (lo);
+}
+
+#define GMTCONNECT_MAX_LATTICE	1048576.0	/* Limit lattice rows and columns so cell keys cannot overflow */
+
+GMT_LOCAL void gmtconnect_rank_separations_via_bins (struct GMT_CTRL *GMT, struct GMTCONNECT_LINK *segment, uint64_t ns, double cutoff, double sdist, bool geo) {
+	/* Fill the nearest structures for all open segments just like the exhaustive all-pairs pass in the
+	 * main loop, except we first hash the 2*ns endpoints onto a lattice whose cell size matches the
+	 * search radius R = MAX (cutoff, sdist).  Each endpoint then only examines the endpoints found in
+	 * its own and the adjacent cells.  Any candidate segment whose nearer end lies beyond R is skipped,
+	 * but such segments can neither pass the cutoff test nor fail the next-nearest test, so the set of
+	 * connections made is the same as for the all-pairs pass.  For each candidate segment we rank the
+	 * minimum of its two end distances, keep (nearest, next-nearest) and break exact ties by the lower
+	 * segment id, which is what the ordered all-pairs sweep arrives at.  For geographic data the lattice
+	 * is laid out in degrees: the cell height comes from the length of one degree of latitude, the cell
+	 * width is padded by the cos(lat) shrinking at the most polar latitude present, and the columns wrap
+	 * around when the data span all longitudes. */
+	bool wrap = false;
+	int64_t n_cols, n_rows, iy, ix, iyq, t;
+	uint64_t i, k, q, first, key, jseg, item, n_end = 2 * ns;
+	int jend;
+	double R, R_deg, cell_x, cell_y, xmin = DBL_MAX, xmax = -DBL_MAX, ymin = DBL_MAX, ymax = -DBL_MAX;
+	double d, d_A, d_B, phi, *ex = NULL, *ey = NULL;
+	struct GMTCONNECT_BIN *E = NULL;
+
+	ex = gmt_M_memory (GMT, NULL, n_end, double);
+	ey = gmt_M_memory (GMT, NULL, n_end, double);
+	E  = gmt_M_memory (GMT, NULL, n_end, struct GMTCONNECT_BIN);
+	for (i = 0; i < n_end; i++) {	/* Gather all endpoint coordinates and their bounds */
+		ex[i] = segment[i/2].x_end[i%2];	ey[i] = segment[i/2].y_end[i%2];
+		if (geo) {	/* Normalize longitudes to 0-360 so all endpoints share one branch */
+			while (ex[i] < 0.0) ex[i] += 360.0;
+			while (ex[i] >= 360.0) ex[i] -= 360.0;
+		}
+		if (ex[i] < xmin) xmin = ex[i];	if (ex[i] > xmax) xmax = ex[i];
+		if (ey[i] < ymin) ymin = ey[i];	if (ey[i] > ymax) ymax = ey[i];
+	}
+	R = MAX (cutoff, sdist);	/* Candidates beyond this distance cannot affect any connection decision */
+	if (geo) {	/* Convert the radius to a safe cell size in degrees of latitude and longitude */
+		R_deg = 1.05 * R / gmt_distance (GMT, 0.0, 0.0, 0.0, 1.0);	/* Radius over length of one degree of latitude */
+		cell_y = R_deg;
+		phi = MAX (fabs (ymin), fabs (ymax)) + R_deg;	/* Most polar latitude a candidate pair can involve */
+		cell_x = (phi >= 89.0) ? 360.0 : 1.2 * R_deg / cosd (phi);	/* Widen cells for the cos(lat) shrinking */
+		if (cell_x > 120.0) cell_x = 360.0;	/* So near the pole that longitude no longer separates points */
+	}
+	else {	/* Cartesian lattice with square cells */
+		cell_x = cell_y = R;
+	}
+	/* Guard against degenerate (exact matching, R = 0) or extreme cell sizes; growing a cell just adds candidates */
+	if (cell_x <= 0.0) cell_x = (xmax > xmin) ? (xmax - xmin) / MAX (1.0, sqrt ((double)ns)) : 1.0;
+	if (cell_y <= 0.0) cell_y = (ymax > ymin) ? (ymax - ymin) / MAX (1.0, sqrt ((double)ns)) : 1.0;
+	if ((xmax - xmin) / cell_x > GMTCONNECT_MAX_LATTICE) cell_x = (xmax - xmin) / GMTCONNECT_MAX_LATTICE;
+	if ((ymax - ymin) / cell_y > GMTCONNECT_MAX_LATTICE) cell_y = (ymax - ymin) / GMTCONNECT_MAX_LATTICE;
+	if (geo && (xmax - xmin) > (360.0 - 2.0 * cell_x)) {	/* Longitudes go all the way around so the columns must wrap */
+		wrap = true;
+		xmin = 0.0;
+		n_cols = MAX (1, (int64_t)(360.0 / cell_x));
+		cell_x = 360.0 / n_cols;	/* Adjust so the cells tile the full circle exactly */
+	}
+	else
+		n_cols = (int64_t)((xmax - xmin) / cell_x) + 1;
+	n_rows = (int64_t)((ymax - ymin) / cell_y) + 1;
+	for (i = 0; i < n_end; i++) {	/* Assign each endpoint to its lattice cell */
+		ix = (int64_t)((ex[i] - xmin) / cell_x);
+		iy = (int64_t)((ey[i] - ymin) / cell_y);
+		if (ix >= n_cols) ix = n_cols - 1;
+		if (iy >= n_rows) iy = n_rows - 1;
+		E[i].key = (uint64_t)iy * n_cols + ix;
+		E[i].item = i;
+	}
+	qsort (E, n_end, sizeof (struct GMTCONNECT_BIN), gmtconnect_compare_bins);
+
+	for (i = 0; i < ns; i++) {	/* Seed both ends with the self-closure candidate, as the all-pairs sweep does */
+		/* A 2-point line cannot connect back on itself as it would make a polygon with zero area */
+		d = (segment[i].n < 3) ? DBL_MAX : gmt_distance (GMT, segment[i].x_end[END_A], segment[i].y_end[END_A], segment[i].x_end[END_B], segment[i].y_end[END_B]);
+		for (jend = 0; jend < 2; jend++) {
+			segment[i].nearest[jend].id = i;
+			segment[i].nearest[jend].orig_id = segment[i].orig_id;
+			segment[i].nearest[jend].end_order = 1 - jend;
+			/* The self-pair feeds both branches of the all-pairs update so it seeds both distances */
+			segment[i].nearest[jend].dist = segment[i].nearest[jend].next_dist = d;
+		}
+	}
+
+	for (i = 0; i < n_end; i++) {	/* For each endpoint, examine the endpoints in its own and the adjacent cells */
+		uint64_t iseg = i / 2;
+		int ii = (int)(i % 2);
+		struct GMTCONNECT_NEAREST *N = &segment[iseg].nearest[ii];
+		ix = (int64_t)((ex[i] - xmin) / cell_x);
+		iy = (int64_t)((ey[i] - ymin) / cell_y);
+		if (ix >= n_cols) ix = n_cols - 1;
+		if (iy >= n_rows) iy = n_rows - 1;
+		for (iyq = iy - 1; iyq <= iy + 1; iyq++) {
+			if (iyq < 0 || iyq >= n_rows) continue;
+			for (t = -1; t <= 1; t++) {
+				int64_t ixq = ix + t;
+				if (wrap)	/* Columns are periodic */
+					ixq = (ixq + n_cols) % n_cols;
+				else if (ixq < 0 || ixq >= n_cols)
+					continue;
+				if (wrap && n_cols < 3 && t > (n_cols - 2)) continue;	/* Avoid revisiting the same wrapped column */
+				key = (uint64_t)iyq * n_cols + ixq;
+				first = gmtconnect_first_bin (E, n_end, key);
+				for (q = first; q < n_end && E[q].key == key; q++) {
+					item = E[q].item;
+					jseg = item / 2;
+					if (jseg == iseg) continue;		/* Cannot connect to itself this way; self-closure was seeded above */
+					if (jseg == N->id) continue;		/* Already ranked this candidate segment (its other end shares a cell) */
+					/* Rank the nearer of the candidate segment's two ends, as the all-pairs sweep does */
+					d_A = gmt_distance (GMT, ex[i], ey[i], segment[jseg].x_end[END_A], segment[jseg].y_end[END_A]);
+					d_B = gmt_distance (GMT, ex[i], ey[i], segment[jseg].x_end[END_B], segment[jseg].y_end[END_B]);
+					if (d_A <= d_B) { d = d_A; jend = END_A; }
+					else { d = d_B; jend = END_B; }
+					if (d < N->dist || (d == N->dist && jseg < N->id)) {	/* New nearest; the old one becomes next-nearest */
+						N->next_dist = N->dist;
+						N->orig_id = segment[jseg].orig_id;
+						N->id = jseg;
+						N->dist = d;
+						N->end_order = jend;
+					}
+					else if (d < N->next_dist)	/* Update the next nearest distance only */
+						N->next_dist = d;
+				}
+			}
+		}
+	}
+	gmt_M_free (GMT, ex);	gmt_M_free (GMT, ey);	gmt_M_free (GMT, E);
+}
+
 GMT_LOCAL uint64_t gmtconnect_copy_this_segment (struct GMT_DATASEGMENT *in, struct GMT_DATASEGMENT *out, uint64_t out_start, uint64_t in_start, uint64_t in_end) {
 	uint64_t row_in, row_out, col;
 	int64_t inc;
@@ -586,54 +734,58 @@ EXTERN_MSC int GMT_gmtconnect (void *V_API, int mode, void *args) {
 	 * Below dd[segment][end] is a 2x2 array with the four distances for one pair of segments SEG_I and SEG_J.
 	 */
 
-	for (iseg = 0; iseg < ns; iseg++) {	/* Loop over all open line segments and their two endpoints... */
-		for (jseg = iseg; jseg < ns; jseg++) {	/* ...and compare distances to all other open line segments' two endpoints  */
-			/* nearest_end indicates which end is closest to this end */
-			if (iseg == jseg) {	/* Store offset between the endpoints of a single segment (would be 0 if closed but those polygons have already been dealt with) */
-				dd[SEG_I][END_A] = dd[SEG_J][END_B] = DBL_MAX;	/* Flag as single line segment so two ends are not used to connect them */
-				/* Only compute a distance for this single segment if it has more than 2 points.  2 point cannot connect back on itself as it would make a polygon with zero area */
-				dd[SEG_I][END_B] = dd[SEG_J][END_A] = (segment[iseg].n < 3) ? DBL_MAX : gmt_distance (GMT, segment[iseg].x_end[END_A], segment[iseg].y_end[END_A], segment[iseg].x_end[END_B], segment[iseg].y_end[END_B]);
-				nearest_end[SEG_I][END_A] = nearest_end[SEG_J][END_A] = END_B;	/* Duplicate the nearest ID info since it is a single line segment compared to itself */
-				nearest_end[SEG_J][END_B] = nearest_end[SEG_I][END_B] = END_A;
-			}
-			else {	/* Store the distances between the 4 possible end-to-end configurations */
-				dd[SEG_I][END_A] = gmt_distance (GMT, segment[iseg].x_end[END_A], segment[iseg].y_end[END_A], segment[jseg].x_end[END_A], segment[jseg].y_end[END_A]);
-				dd[SEG_I][END_B] = gmt_distance (GMT, segment[iseg].x_end[END_A], segment[iseg].y_end[END_A], segment[jseg].x_end[END_B], segment[jseg].y_end[END_B]);
-				dd[SEG_J][END_A] = gmt_distance (GMT, segment[iseg].x_end[END_B], segment[iseg].y_end[END_B], segment[jseg].x_end[END_A], segment[jseg].y_end[END_A]);
-				dd[SEG_J][END_B] = gmt_distance (GMT, segment[iseg].x_end[END_B], segment[iseg].y_end[END_B], segment[jseg].x_end[END_B], segment[jseg].y_end[END_B]);
-				/* Determine which end is nearest */
-				for (end = 0; end < 2; end++) nearest_end[SEG_I][end] = (dd[end][END_A] <= dd[end][END_B]) ? END_A : END_B;
-				for (end = 0; end < 2; end++) nearest_end[SEG_J][end] = (dd[END_A][end] <= dd[END_B][end]) ? END_A : END_B;
-			}
-			sprintf (msg, "Pair %d - %d, dd[i][j] = %g, %g, %g, %g\n", (int)iseg, (int)jseg, dd[0][0], dd[0][1], dd[1][0], dd[1][1]);
-			GMT_Report (API, GMT_MSG_DEBUG, msg);
-			/* Update list of closest matches for both ends */
-			for (ii = 0; ii < 2; ii++) {	/* For each end of the segments */
-				end = nearest_end[SEG_I][ii];	/* The end of segment jseg that so far is closest to segment iseg's end ii */
-				if (dd[ii][end] < segment[iseg].nearest[ii].dist) {	/* This distance is shorter than the previous shortest distance, so time to update it */
-					segment[iseg].nearest[ii].next_dist = segment[iseg].nearest[ii].dist;	/* Previous closest distance becomes the next-nearest distance */
-					segment[iseg].nearest[ii].orig_id = segment[jseg].orig_id;
-					segment[iseg].nearest[ii].id = jseg;
-					segment[iseg].nearest[ii].dist = dd[ii][end];
-					segment[iseg].nearest[ii].end_order = end;
+	if (!Ctrl->L.active && Ctrl->T.dist[0] < DBL_MAX)	/* Endpoint hashing finds the same connections without the all-pairs sweep; -L needs the true separations for its report */
+		gmtconnect_rank_separations_via_bins (GMT, segment, ns, Ctrl->T.dist[0], Ctrl->T.active[1] ? Ctrl->T.dist[1] : 0.0, Ctrl->T.unit != 'X');
+	else {
+		for (iseg = 0; iseg < ns; iseg++) {	/* Loop over all open line segments and their two endpoints... */
+			for (jseg = iseg; jseg < ns; jseg++) {	/* ...and compare distances to all other open line segments' two endpoints  */
+				/* nearest_end indicates which end is closest to this end */
+				if (iseg == jseg) {	/* Store offset between the endpoints of a single segment (would be 0 if closed but those polygons have already been dealt with) */
+					dd[SEG_I][END_A] = dd[SEG_J][END_B] = DBL_MAX;	/* Flag as single line segment so two ends are not used to connect them */
+					/* Only compute a distance for this single segment if it has more than 2 points.  2 point cannot connect back on itself as it would make a polygon with zero area */
+					dd[SEG_I][END_B] = dd[SEG_J][END_A] = (segment[iseg].n < 3) ? DBL_MAX : gmt_distance (GMT, segment[iseg].x_end[END_A], segment[iseg].y_end[END_A], segment[iseg].x_end[END_B], segment[iseg].y_end[END_B]);
+					nearest_end[SEG_I][END_A] = nearest_end[SEG_J][END_A] = END_B;	/* Duplicate the nearest ID info since it is a single line segment compared to itself */
+					nearest_end[SEG_J][END_B] = nearest_end[SEG_I][END_B] = END_A;
 				}
-				else if (dd[ii][end] < segment[iseg].nearest[ii].next_dist)	/* Update the next nearest distance only (no need to know what segment this is) */
-					segment[iseg].nearest[ii].next_dist = dd[ii][end];
-				end = nearest_end[SEG_J][ii];	/* The end of segment iseg that was closest to segment jseg's end ii */
-				if (dd[end][ii] < segment[jseg].nearest[ii].dist) {	/* This distance is shorter than the previous shortest distance, so time to update it */
-					segment[jseg].nearest[ii].next_dist = segment[jseg].nearest[ii].dist;	/* Previous closest distance becomes the next-nearest distance */
-					segment[jseg].nearest[ii].orig_id = segment[iseg].orig_id;
-					segment[jseg].nearest[ii].id = iseg;
-					segment[jseg].nearest[ii].dist = dd[end][ii];
-					segment[jseg].nearest[ii].end_order = end;
+				else {	/* Store the distances between the 4 possible end-to-end configurations */
+					dd[SEG_I][END_A] = gmt_distance (GMT, segment[iseg].x_end[END_A], segment[iseg].y_end[END_A], segment[jseg].x_end[END_A], segment[jseg].y_end[END_A]);
+					dd[SEG_I][END_B] = gmt_distance (GMT, segment[iseg].x_end[END_A], segment[iseg].y_end[END_A], segment[jseg].x_end[END_B], segment[jseg].y_end[END_B]);
+					dd[SEG_J][END_A] = gmt_distance (GMT, segment[iseg].x_end[END_B], segment[iseg].y_end[END_B], segment[jseg].x_end[END_A], segment[jseg].y_end[END_A]);
+					dd[SEG_J][END_B] = gmt_distance (GMT, segment[iseg].x_end[END_B], segment[iseg].y_end[END_B], segment[jseg].x_end[END_B], segment[jseg].y_end[END_B]);
+					/* Determine which end is nearest */
+					for (end = 0; end < 2; end++) nearest_end[SEG_I][end] = (dd[end][END_A] <= dd[end][END_B]) ? END_A : END_B;
+					for (end = 0; end < 2; end++) nearest_end[SEG_J][end] = (dd[END_A][end] <= dd[END_B][end]) ? END_A : END_B;
+				}
+				sprintf (msg, "Pair %d - %d, dd[i][j] = %g, %g, %g, %g\n", (int)iseg, (int)jseg, dd[0][0], dd[0][1], dd[1][0], dd[1][1]);
+				GMT_Report (API, GMT_MSG_DEBUG, msg);
+				/* Update list of closest matches for both ends */
+				for (ii = 0; ii < 2; ii++) {	/* For each end of the segments */
+					end = nearest_end[SEG_I][ii];	/* The end of segment jseg that so far is closest to segment iseg's end ii */
+					if (dd[ii][end] < segment[iseg].nearest[ii].dist) {	/* This distance is shorter than the previous shortest distance, so time to update it */
+						segment[iseg].nearest[ii].next_dist = segment[iseg].nearest[ii].dist;	/* Previous closest distance becomes the next-nearest distance */
+						segment[iseg].nearest[ii].orig_id = segment[jseg].orig_id;
+						segment[iseg].nearest[ii].id = jseg;
+						segment[iseg].nearest[ii].dist = dd[ii][end];
+						segment[iseg].nearest[ii].end_order = end;
+					}
+					else if (dd[ii][end] < segment[iseg].nearest[ii].next_dist)	/* Update the next nearest distance only (no need to know what segment this is) */
+						segment[iseg].nearest[ii].next_dist = dd[ii][end];
+					end = nearest_end[SEG_J][ii];	/* The end of segment iseg that was closest to segment jseg's end ii */
+					if (dd[end][ii] < segment[jseg].nearest[ii].dist) {	/* This distance is shorter than the previous shortest distance, so time to update it */
+						segment[jseg].nearest[ii].next_dist = segment[jseg].nearest[ii].dist;	/* Previous closest distance becomes the next-nearest distance */
+						segment[jseg].nearest[ii].orig_id = segment[iseg].orig_id;
+						segment[jseg].nearest[ii].id = iseg;
+						segment[jseg].nearest[ii].dist = dd[end][ii];
+						segment[jseg].nearest[ii].end_order = end;
+					}
+					else if (dd[end][ii] < segment[jseg].nearest[ii].next_dist)	/* Update the next nearest distance only (no need to know what segment this is) */
+						segment[jseg].nearest[ii].next_dist = dd[end][ii];
 				}
-				else if (dd[end][ii] < segment[jseg].nearest[ii].next_dist)	/* Update the next nearest distance only (no need to know what segment this is) */
-					segment[jseg].nearest[ii].next_dist = dd[end][ii];
 			}
+			/* Final information for segment iseg */
+			sprintf (msg, "Seg %d dist[0], next_dist[0], dist[1], next_dist[1] = %g, %g, %g, %g\n", (int)iseg, segment[iseg].nearest[0].dist, segment[iseg].nearest[0].next_dist, segment[iseg].nearest[1].dist, segment[iseg].nearest[1].next_dist);
+			GMT_Report (API, GMT_MSG_DEBUG, msg);
 		}
-		/* Final information for segment iseg */
-		sprintf (msg, "Seg %d dist[0], next_dist[0], dist[1], next_dist[1] = %g, %g, %g, %g\n", (int)iseg, segment[iseg].nearest[0].dist, segment[iseg].nearest[0].next_dist, segment[iseg].nearest[1].dist, segment[iseg].nearest[1].next_dist);
-		GMT_Report (API, GMT_MSG_DEBUG, msg);
 	}
 
 	/* Done determining distances from endpoints to nearest endpoints for all line segments */
@@ -515,6 +515,20 @@ GMT_LOCAL bool gmtconvert_is_duplicate_row (struct GMT_DATASEGMENT *S, struct GM
 #define bailout(code) {gmt_M_free_options (mode); return (code);}
 #define Return(code) {Free_Ctrl (GMT, Ctrl); gmt_end_module (GMT, GMT_cpy); bailout (code);}
 
+GMT_LOCAL bool gmtconvert_streamable (struct GMT_CTRL *GMT, struct GMTCONVERT_CTRL *Ctrl) {
+	/* Return true if no selected option requires access to the entire dataset in memory.
+	 * Plain conversions (column selection and scaling via -i/-o, ASCII <-> binary, -s,
+	 * suppressing headers via -Th) are applied record-by-record in the i/o machinery, so
+	 * such runs can stream arbitrarily large tables through in constant memory. */
+	if (Ctrl->A.active || Ctrl->C.active || Ctrl->D.active || Ctrl->E.active) return (false);
+	if (Ctrl->F.active || Ctrl->I.active || Ctrl->L.active || Ctrl->N.active) return (false);
+	if (Ctrl->Q.active || Ctrl->S.active || Ctrl->W.active || Ctrl->Z.active) return (false);
+	if (Ctrl->T.active[EXCLUDE_DUPLICATES]) return (false);	/* Must compare consecutive records in the stored segments */
+	if (Ctrl->debug.active) return (false);		/* Debug mode examines the in-memory dataset */
+	if (GMT->common.a.active) return (false);	/* OGR/aspatial handling requires the dataset reader */
+	return (true);
+}
+
 EXTERN_MSC int GMT_gmtconvert (void *V_API, int mode, void *args) {
 	bool match = false, prevent_seg_headers = false;
 	int error = 0;
@@ -572,6 +586,65 @@ EXTERN_MSC int GMT_gmtconvert (void *V_API, int mode, void *args) {
 		}
 	}
 
+	if (gmtconvert_streamable (GMT, Ctrl)) {
+		/* Only record-local, order-preserving operations were requested, so we stream the records
+		 * through one at a time rather than materializing the whole dataset in memory.  This lets
+		 * arbitrarily large archives pass through with just a single record buffer held. */
+		int n_fields;
+		uint64_t n_streamed = 0;
+		struct GMT_RECORD *In = NULL;
+
+		GMT_Report (API, GMT_MSG_INFORMATION, "Streaming records through without storing the dataset\n");
+		if (Ctrl->T.active[EXCLUDE_HEADERS] && !gmt_M_file_is_memory (Ctrl->Out.file))
+			GMT->current.io.skip_headers_on_outout = true;
+		if ((error = GMT_Set_Columns (API, GMT_IN, 0, GMT_COL_FIX)) != GMT_NOERROR) Return (error);
+		if (GMT_Init_IO (API, GMT_IS_DATASET, GMT_IS_POINT, GMT_IN,  GMT_ADD_DEFAULT, 0, options) != GMT_NOERROR) {	/* Establishes data input */
+			Return (API->error);
+		}
+		if (GMT_Init_IO (API, GMT_IS_DATASET, GMT_IS_POINT, GMT_OUT, GMT_ADD_DEFAULT, 0, options) != GMT_NOERROR) {	/* Establishes data output */
+			Return (API->error);
+		}
+		if (GMT_Begin_IO (API, GMT_IS_DATASET, GMT_IN, GMT_HEADER_ON) != GMT_NOERROR) {	/* Enables data input and sets access mode */
+			Return (API->error);
+		}
+		if (GMT_Begin_IO (API, GMT_IS_DATASET, GMT_OUT, GMT_HEADER_ON) != GMT_NOERROR) {	/* Enables data output and sets access mode */
+			Return (API->error);
+		}
+		GMT->common.b.ncol[GMT_OUT] = UINT_MAX;	/* Flag to have it reset to GMT->common.b.ncol[GMT_IN] when writing */
+
+		do {	/* Keep returning records until we reach EOF */
+			if ((In = GMT_Get_Record (API, GMT_READ_DATA, &n_fields)) == NULL) {	/* Read next record, get NULL if special case */
+				if (gmt_M_rec_is_error (GMT)) 		/* Bail if there are any read errors */
+					Return (GMT_RUNTIME_ERROR);
+				if (gmt_M_rec_is_table_header (GMT))	/* Echo table headers */
+					GMT_Put_Record (API, GMT_WRITE_TABLE_HEADER, NULL);
+				else if (gmt_M_rec_is_new_segment (GMT))	/* Echo segment headers */
+					GMT_Put_Record (API, GMT_WRITE_SEGMENT_HEADER, NULL);
+				else if (gmt_M_rec_is_eof (GMT)) 	/* Reached end of file */
+					break;
+				continue;
+			}
+			if (In->data == NULL) {
+				gmt_quit_bad_record (API, In);
+				Return (API->error);
+			}
+			if (n_streamed == 0)	/* Establish output columns from the first data record */
+				GMT_Set_Columns (API, GMT_OUT, (unsigned int)gmt_get_cols (GMT, GMT_IN), (In->text) ? GMT_COL_FIX : GMT_COL_FIX_NO_TEXT);
+			GMT_Put_Record (API, GMT_WRITE_DATA, In);	/* Pass the record through */
+			n_streamed++;
+		} while (true);
+
+		if (GMT_End_IO (API, GMT_IN,  0) != GMT_NOERROR) {	/* Disables further data input */
+			Return (API->error);
+		}
+		if (GMT_End_IO (API, GMT_OUT, 0) != GMT_NOERROR) {	/* Disables further data output */
+			Return (API->error);
+		}
+		GMT->current.io.skip_headers_on_outout = false;	/* Restore to default if it was changed */
+		GMT_Report (API, GMT_MSG_INFORMATION, "Streamed %" PRIu64 " data records\n", n_streamed);
+		Return (GMT_NOERROR);	/* We are done! */
+	}
+
 	if (GMT_Init_IO (API, GMT_IS_DATASET, GMT_IS_POINT, GMT_IN, GMT_ADD_DEFAULT, 0, options) != GMT_NOERROR) {
 		Return (API->error);	/* Establishes data files or stdin */
 	}
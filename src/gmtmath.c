@@ -30,6 +30,7 @@
  */
 
 #include "gmt_dev.h"
+#include "gmt_internals.h"
 #include "longopt/gmtmath_inc.h"
 
 #define THIS_MODULE_CLASSIC_NAME	"gmtmath"
@@ -948,6 +949,81 @@ GMT_LOCAL unsigned int gmtmath_assign_ptrs (struct GMT_CTRL *GMT, unsigned int l
 	return prev;
 }
 
+GMT_LOCAL bool gmtmath_op_is_elementwise (char *name) {
+	/* True for purely element-wise operators: they consume 1-2 operands, produce one result,
+	 * only touch their own column, and issue at most debug-level messages.  These are safe to
+	 * evaluate per column independently and to reduce to a scalar when all operands are
+	 * constants. */
+	static char *elementwise[] = {"ABS", "ADD", "CEIL", "COS", "COSD", "EXP", "FLOOR", "HYPOT",
+		"MAX", "MIN", "MUL", "NEG", "POW", "RINT", "SIN", "SIND", "SQR", "SUB", "TAN", "TAND", NULL};
+	unsigned int k;
+	for (k = 0; elementwise[k]; k++)
+		if (!strcmp (name, elementwise[k])) return true;
+	return false;
+}
+
+#define GMTMATH_PAR_MIN_SECS	50.0e-6	/* Mean measured per-call cost above which threading an operator pays off */
+#define GMTMATH_PAR_MIN_RECORDS	4096	/* Fallback work size used before any calls of the operator have been timed */
+
+GMT_LOCAL bool gmtmath_auto_parallel (struct GMT_CTRL *GMT, char *name, uint64_t n_columns, uint64_t n_records, double op_time, uint64_t op_count) {
+	/* Decide if an element-wise operator should have its columns evaluated concurrently.
+	 * Cheap calls lose more to thread startup than they gain, so once earlier calls of the
+	 * same operator have been timed we require a mean cost above GMTMATH_PAR_MIN_SECS before
+	 * threading; the first call of each operator falls back on the table size.  Debug runs
+	 * stay serial to keep messages ordered. */
+	if (n_columns < 2) return false;
+	if (!gmtmath_op_is_elementwise (name)) return false;
+	if (GMT->current.setting.verbose >= GMT_MSG_DEBUG) return false;
+	if (op_count) return ((op_time / (double)op_count) >= GMTMATH_PAR_MIN_SECS);
+	return (n_records >= GMTMATH_PAR_MIN_RECORDS);
+}
+
+GMT_LOCAL bool gmtmath_fold_constants (struct GMT_CTRL *GMT, char *name, struct GMTMATH_STACK *stack[], unsigned int nstack, unsigned int n_in, unsigned int n_out) {
+	/* If an element-wise operator only consumes constants then every row of every column would
+	 * receive the same scalar, so there is no need to allocate a stack table and fill it: we
+	 * evaluate the operator once here and leave the scalar on the stack as a constant.  The
+	 * table allocation is deferred until a constant is finally combined with real table data.
+	 * Operators with domain warnings or special column handling take the normal path.
+	 * Returns true if the operation was folded. */
+	unsigned int k;
+	double a, b = 0.0, value;
+
+	if (n_out != 1 || n_in < 1 || n_in > 2) return false;	/* Only unary|binary operators with a single result can fold */
+	for (k = 1; k <= n_in; k++)
+		if (!stack[nstack-k]->constant) return false;
+	a = stack[nstack-n_in]->factor;
+	if (n_in == 2) b = stack[nstack-1]->factor;
+	if (n_in == 1) {	/* The eligible unary operators */
+		if (!strcmp (name, "ABS"))	value = fabs (a);
+		else if (!strcmp (name, "CEIL"))	value = ceil (a);
+		else if (!strcmp (name, "COS"))	value = cos (a);
+		else if (!strcmp (name, "COSD"))	value = cosd (a);
+		else if (!strcmp (name, "EXP"))	value = exp (a);
+		else if (!strcmp (name, "FLOOR"))	value = floor (a);
+		else if (!strcmp (name, "NEG"))	value = -a;
+		else if (!strcmp (name, "RINT"))	value = rint (a);
+		else if (!strcmp (name, "SIN"))	value = sin (a);
+		else if (!strcmp (name, "SIND"))	value = sind (a);
+		else if (!strcmp (name, "SQR"))	value = a * a;
+		else if (!strcmp (name, "TAN"))	value = tan (a);
+		else if (!strcmp (name, "TAND"))	value = tand (a);
+		else return false;
+	}
+	else {	/* The eligible binary operators */
+		if (!strcmp (name, "ADD"))	value = a + b;
+		else if (!strcmp (name, "HYPOT"))	value = hypot (a, b);
+		else if (!strcmp (name, "MAX"))	value = (gmt_M_is_dnan (a) || gmt_M_is_dnan (b)) ? GMT->session.d_NaN : MAX (a, b);
+		else if (!strcmp (name, "MIN"))	value = (gmt_M_is_dnan (a) || gmt_M_is_dnan (b)) ? GMT->session.d_NaN : MIN (a, b);
+		else if (!strcmp (name, "MUL"))	value = a * b;
+		else if (!strcmp (name, "POW"))	value = pow (a, b);
+		else if (!strcmp (name, "SUB"))	value = a - b;
+		else return false;
+	}
+	stack[nstack-n_in]->factor = value;	/* The scalar result replaces the operand(s) and remains a constant */
+	GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Constant operands of %s reduced to %g\n", name, value);
+	return true;
+}
+
 /* -----------------------------------------------------------------
  *              Definitions of all operator functions
  * -----------------------------------------------------------------*/
@@ -6233,8 +6309,10 @@ EXTERN_MSC int GMT_gmtmath (void *V_API, int mode, void *args) {
 	uint64_t use_t_col = 0, row, n_records, n_rows = 0, n_columns = 0, seg;
 
 	uint64_t dim[GMT_DIM_SIZE] = {1, 1, 0, 0};
+	uint64_t op_count[GMTMATH_N_OPERATORS];
 
 	double t_noise = 0.0, value, off, scale, special_symbol[GMTMATH_ARG_IS_PI-GMTMATH_ARG_IS_N+1];
+	double op_clock, op_time[GMTMATH_N_OPERATORS];
 
 	char *label = NULL;
 
@@ -6707,6 +6785,8 @@ EXTERN_MSC int GMT_gmtmath (void *V_API, int mode, void *args) {
 	special_symbol[GMTMATH_ARG_IS_PI-GMTMATH_ARG_IS_N]      = (double)n_records;
 
 	gmtmath_init (call_operator, consumed_operands, produced_operands);
+	gmt_M_memset (op_time,  GMTMATH_N_OPERATORS, double);	/* Start of the per-operator cost accounting */
+	gmt_M_memset (op_count, GMTMATH_N_OPERATORS, uint64_t);
 	op = gmtmath_decode_argument (GMT, "EXCH", &value, &dimension, localhashnode);
 	if (op == GMTMATH_ARG_IS_BAD) {
 		GMT_Report (API, GMT_MSG_ERROR, "Bad input argument!\n");
@@ -6928,6 +7008,12 @@ EXTERN_MSC int GMT_gmtmath (void *V_API, int mode, void *args) {
 
 		if (gmt_M_is_verbose (GMT, GMT_MSG_INFORMATION)) GMT_Message (API, GMT_TIME_NONE, "%s ", operator[op]);
 
+		if (gmtmath_fold_constants (GMT, operator[op], stack, nstack, eaten, created)) {
+			/* Element-wise operator with all-constant operands; the scalar result is already on the stack */
+			nstack = new_stack;
+			continue;
+		}
+
 		for (i = created - eaten; i > 0; i--) {
 			if (stack[nstack+i-1]->D) continue;
 
@@ -6944,6 +7030,7 @@ EXTERN_MSC int GMT_gmtmath (void *V_API, int mode, void *args) {
 			}
 		}
 
+		op_clock = gmtlib_wall_clock ();	/* Time this operator call for the cost statistics */
 		if (!strcmp (operator[op], "LSQFIT")) {	/* Special case, solve LSQ system and return */
 			gmtmath_solve_LSQFIT (GMT, &info, stack[nstack-1], n_columns, Ctrl->C.cols, Ctrl->E.eigen, Ctrl->Out.file, options, A_in);
 			Return (GMT_NOERROR);
@@ -6956,6 +7043,25 @@ EXTERN_MSC int GMT_gmtmath (void *V_API, int mode, void *args) {
 			status = (*call_operator[op]) (GMT, &info, stack, nstack - 1, 0);	/* Do it for all columns, the col = 0 is not used inside function */
 		}
 		else {
+#ifdef _OPENMP
+			if (gmtmath_auto_parallel (GMT, operator[op], n_columns, n_records, op_time[op], op_count[op])) {
+				/* Element-wise operators only touch their own column so the columns can be
+				 * processed concurrently when the measured cost warrants it */
+				openmp_int jc;
+				status = 0;
+#pragma omp parallel for private(jc) shared(GMT,info,stack,nstack,n_columns,Ctrl,call_operator,op,status)
+				for (jc = 0; jc < (openmp_int)n_columns; jc++) {
+					if (Ctrl->C.cols[jc]) continue;
+					if ((*call_operator[op]) (GMT, &info, stack, nstack - 1, (unsigned int)jc) == -1)
+						status = -1;	/* Benign race: only ever set to the same error value */
+				}
+				if (status == -1) {	/* Serious problem, need to bail */
+					GMT_Report (API, GMT_MSG_ERROR, "Operand %s returned status = %d. Must give up.\n", operator[op], status);
+					Return (GMT_RUNTIME_ERROR);
+				}
+			}
+			else
+#endif
 			for (j = 0; j < n_columns; j++) {
 				if (Ctrl->C.cols[j]) continue;
 				status = (*call_operator[op]) (GMT, &info, stack, nstack - 1, j);	/* Do it */
@@ -6965,6 +7071,8 @@ EXTERN_MSC int GMT_gmtmath (void *V_API, int mode, void *args) {
 				}
 			}
 		}
+		op_time[op] += gmtlib_wall_clock () - op_clock;	/* Accumulate cost of this operator */
+		op_count[op]++;
 		gmtmath_free_sort_list (GMT, &info);	/* Frees helper array if SORT was called */
 
 		nstack = new_stack;
@@ -6972,6 +7080,14 @@ EXTERN_MSC int GMT_gmtmath (void *V_API, int mode, void *args) {
 		for (kk = 1; kk <= created; kk++) if (stack[nstack-kk]->D) stack[nstack-kk]->constant = false;	/* Now filled with table */
 	}
 
+#ifdef GMT_ENABLE_TIMINGS
+	for (op = 0; op < GMTMATH_N_OPERATORS; op++) {	/* Report per-operator cost statistics */
+		if (op_count[op] == 0) continue;
+		GMT_Report (API, GMT_MSG_NOTICE, "Timings: Operator %s: %" PRIu64 " call(s), total %.6f s, mean %.6f s\n",
+			operator[op], op_count[op], op_time[op], op_time[op] / (double)op_count[op]);
+	}
+#endif
+
 	if (gmt_M_is_verbose (GMT, GMT_MSG_INFORMATION)) {
 		(Ctrl->Out.file) ? GMT_Message (API, GMT_TIME_NONE, "= %s", Ctrl->Out.file) : GMT_Message (API, GMT_TIME_NONE,  "= <stdout>");
 	}
@@ -905,16 +905,31 @@ GMT_LOCAL void gmtregress_gmtregress_regress1D_sub (struct GMT_CTRL *GMT, double
 #define N_ANGLE_SELECTIONS	90	/* Fixed number of slope angles to try between min/max slope limits */
 
 GMT_LOCAL double gmtregress_regress1D (struct GMT_CTRL *GMT, double *x, double *y, double *w[], uint64_t n, unsigned int regression, unsigned int norm, double *range, double *par) {
-	/* Solve the linear regression problem for chosen misfit and norm by an iterative approach */
+	/* Solve the linear regression problem for chosen misfit and norm by an iterative approach.
+	 * The N_ANGLE_SELECTIONS+1 candidate slopes per iteration are independent so we evaluate
+	 * them across cores (each thread gets its own residual scratch; for orthogonal regression
+	 * also its own U, V, W since those depend on the slope) and then pick the winner in k-order
+	 * so the result is identical to the serial scan. */
 	uint64_t k;
+	openmp_int kk;
 	unsigned int n_iter = 0;
+	size_t n_threads = 1;
 	bool done = false, weighted = false;
 	char buffer[GMT_LEN256] = {""};
 	double a_min = range[0], a_max = range[1], angle, r_a, d_a, f, last_E = DBL_MAX, scale, tpar[GMTREGRESS_NPAR];
-	double *U = gmt_M_memory (GMT, NULL, n, double), *V = gmt_M_memory (GMT, NULL, n, double);
-	double *W = gmt_M_memory (GMT, NULL, n, double), *e = gmt_M_memory (GMT, NULL, n, double);
+	double *U = NULL, *V = NULL, *W = NULL, *e = NULL;
+	double apar[(N_ANGLE_SELECTIONS+1)*GMTREGRESS_NPAR];	/* Full parameter vector for each candidate slope */
 	double (*scl_func) (struct GMT_CTRL *GMT, double *ey, double *W, uint64_t n, double *par);
 
+#ifdef _OPENMP
+	n_threads = (size_t)omp_get_max_threads ();
+#endif
+	/* Residual scratch is per thread; U, V, W only vary with the thread for orthogonal regression */
+	U = gmt_M_memory (GMT, NULL, (regression == GMTREGRESS_XY) ? n_threads * n : n, double);
+	V = gmt_M_memory (GMT, NULL, (regression == GMTREGRESS_XY) ? n_threads * n : n, double);
+	W = gmt_M_memory (GMT, NULL, (regression == GMTREGRESS_XY) ? n_threads * n : n, double);
+	e = gmt_M_memory (GMT, NULL, n_threads * n, double);
+
 	switch (norm) {	/* Set regression residual scale function pointer */
 		case GMTREGRESS_NORM_L1:  scl_func = gmtregress_L1_scale;  break;
 		case GMTREGRESS_NORM_L2:  scl_func = gmtregress_L2_scale;  break;
@@ -933,16 +948,36 @@ GMT_LOCAL double gmtregress_regress1D (struct GMT_CTRL *GMT, double *x, double *
 	while (!done) {	/* Keep iterating and zooming in on smaller angle-ranges until misfit is very small */
 		r_a = a_max - a_min;	/* Range of angles */
 		d_a = r_a / (double)N_ANGLE_SELECTIONS;	/* Angle increment */
-		for (k = 0; k <= N_ANGLE_SELECTIONS; k++) {	/* Try all slopes in current angle range */
-			angle = a_min + d_a * k;		/* This is the current slope angle */
-			if (regression == GMTREGRESS_XY) {	/* Since W depends on slope we must recompute W each time in this loop */
-				tpar[GMTREGRESS_SLOPE] = tand (angle);
-				(void)gmtregress_demeaning (GMT, x, y, w, n, tpar, U, V, W, NULL, NULL);
+#ifdef _OPENMP
+#pragma omp parallel for private(kk) shared(GMT,x,y,w,n,regression,norm,weighted,a_min,d_a,tpar,apar,U,V,W,e)
+#endif
+		for (kk = 0; kk <= N_ANGLE_SELECTIONS; kk++) {	/* Try all slopes in current angle range */
+			size_t t = 0;
+			double this_angle = a_min + d_a * kk;	/* This is the current slope angle */
+			double *qpar = &apar[kk*GMTREGRESS_NPAR], *Ut = U, *Vt = V, *Wt = W, *et = e;
+#ifdef _OPENMP
+			t = (size_t)omp_get_thread_num ();
+			et = &e[t*n];
+#endif
+			gmt_M_memcpy (qpar, tpar, GMTREGRESS_NPAR, double);	/* Initialize from the demeaning done before the loop */
+			if (regression == GMTREGRESS_XY) {	/* Since W depends on slope we must recompute U, V, W for each angle */
+				Ut = &U[t*n];	Vt = &V[t*n];	Wt = &W[t*n];
+				qpar[GMTREGRESS_SLOPE] = tand (this_angle);
+				(void)gmtregress_demeaning (GMT, x, y, w, n, qpar, Ut, Vt, Wt, NULL, NULL);
 			}
-			gmtregress_gmtregress_regress1D_sub (GMT, U, V, W, e, n, regression, norm, weighted, angle, tpar);	/* Solve for best intercept given this slope */
-			if (tpar[GMTREGRESS_MISFT] < par[GMTREGRESS_MISFT])
-				gmt_M_memcpy (par, tpar, GMTREGRESS_NPAR, double);	/* Update best fit so far without stepping on the means and sigmas */
+			gmtregress_gmtregress_regress1D_sub (GMT, Ut, Vt, Wt, et, n, regression, norm, weighted, this_angle, qpar);	/* Solve for best intercept given this slope */
+		}
+		for (k = 0; k <= N_ANGLE_SELECTIONS; k++) {	/* Now pick the winner in the same order as a serial scan would */
+			if (apar[k*GMTREGRESS_NPAR+GMTREGRESS_MISFT] < par[GMTREGRESS_MISFT])
+				gmt_M_memcpy (par, &apar[k*GMTREGRESS_NPAR], GMTREGRESS_NPAR, double);	/* Update best fit so far without stepping on the means and sigmas */
 		}
+		/* Leave tpar, e [and U, V, W if orthogonal] reflecting the last angle tried, as after a serial scan */
+		angle = a_min + d_a * N_ANGLE_SELECTIONS;
+		if (regression == GMTREGRESS_XY) {
+			tpar[GMTREGRESS_SLOPE] = tand (angle);
+			(void)gmtregress_demeaning (GMT, x, y, w, n, tpar, U, V, W, NULL, NULL);
+		}
+		gmtregress_gmtregress_regress1D_sub (GMT, U, V, W, e, n, regression, norm, weighted, angle, tpar);
 		if (d_a < 0.05 && par[GMTREGRESS_MISFT] <= last_E && (f = (last_E - par[GMTREGRESS_MISFT])/par[GMTREGRESS_MISFT]) < GMT_CONV15_LIMIT)
 			done = true;	/* Change is tiny so we are done, or d_a is too big to make a decision for yet */
 		else {	/* Gradually zoom in on the angles with smallest misfit but allow some slack */
@@ -1144,11 +1179,14 @@ GMT_LOCAL double * gmtregress_do_regression (struct GMT_CTRL *GMT, double *x_in,
 		par[GMTREGRESS_SIGIC] = par[GMTREGRESS_SIGIC] / par[GMTREGRESS_SLOPE];
 	}
 	if (mode == 0) {	/* Normal mode is to compute normalized residuals (aka z-scores) */
-		double e_k;
+		openmp_int kr;
 		z = gmt_M_memory (GMT, NULL, n, double);	/* Array with z-scores */
-		for (k = 0; k < n; k++) {
-			e_k = y[k] - gmtregress_model (x[k], par);	/* Get y-residual */
-			z[k] = e_k / scale;		/* Compute z-scores */
+#ifdef _OPENMP
+#pragma omp parallel for private(kr) shared(n,x,y,par,scale,z)
+#endif
+		for (kr = 0; kr < (openmp_int)n; kr++) {
+			double e_k = y[kr] - gmtregress_model (x[kr], par);	/* Get y-residual */
+			z[kr] = e_k / scale;		/* Compute z-scores */
 		}
 	}
 	if (reweighted_ls) {	/* Must identify outliers, give those points zero weight and redo the regression, but pass back the initial RLS z-scores */
@@ -82,6 +82,14 @@ struct GMTSELECT_ZLIMIT {	/* Used to hold info for each -Z option given */
 	double max;	/* Largest z-value to pass through, for this column */
 };
 
+struct GMTSELECT_BANDS {	/* Horizontal-band edge buckets for one -F polygon segment */
+	unsigned int n_bands;	/* Number of equal-height y-bands covering the segment [0 means no buckets] */
+	double y0;		/* y-value at the bottom of band 0 */
+	double i_dy;		/* Inverse band height, so band = (y - y0) * i_dy */
+	uint64_t *start;	/* n_bands+1 offsets into the edge array */
+	uint64_t *edge;		/* Indices of the edges (edge k joins vertices k and k+1) sorted into bands */
+};
+
 struct GMTSELECT_CTRL {	/* All control options for this program (except common args) */
 	/* active is true if the option has been activated */
 	struct GMTSELECT_A {	/* -A<min_area>[/<min_level>/<max_level>] */
@@ -182,6 +190,159 @@ GMT_LOCAL int gmtselect_compare_x (const void *point_1, const void *point_2) {
 	return (0);
 }
 
+#define GMTSELECT_MIN_BAND_ROWS	32	/* Segments with fewer vertices are tested fast enough without buckets */
+#define GMTSELECT_MAX_BANDS	4096U	/* Cap on the number of y-bands per segment */
+
+GMT_LOCAL struct GMTSELECT_BANDS * gmtselect_prepare_bands (struct GMT_CTRL *GMT, struct GMT_DATATABLE *T) {
+	/* Build per-segment edge buckets keyed on horizontal bands (latitude bands for geographic data)
+	 * so that the in-on-out test for a point only has to examine the edges whose y-range overlaps
+	 * the band containing the point, instead of scanning every polygon vertex.  Segments that are
+	 * too small to benefit, or that are not closed, are left without buckets (n_bands == 0) and
+	 * fall back to the standard full scan. */
+	uint64_t seg, k, n_edges, n_in_bands;
+	unsigned int band, b0, b1;
+	double ymin, ymax;
+	struct GMT_DATASEGMENT *S = NULL;
+	struct GMTSELECT_BANDS *B = gmt_M_memory (GMT, NULL, T->n_segments, struct GMTSELECT_BANDS);
+
+	if (B == NULL) return (NULL);
+	for (seg = 0; seg < T->n_segments; seg++) {
+		S = T->segment[seg];
+		if (S->n_rows < GMTSELECT_MIN_BAND_ROWS) continue;	/* Not worth the bookkeeping */
+		if (gmt_polygon_is_open (GMT, S->data[GMT_X], S->data[GMT_Y], S->n_rows)) continue;	/* Leave unclosed polygons to gmt_inonout */
+		n_edges = S->n_rows - 1;	/* Since the repeated closure point adds no edge */
+		ymin = ymax = S->data[GMT_Y][0];	/* Get the actual y-range of the vertices */
+		for (k = 1; k < S->n_rows; k++) {
+			if (S->data[GMT_Y][k] < ymin) ymin = S->data[GMT_Y][k];
+			if (S->data[GMT_Y][k] > ymax) ymax = S->data[GMT_Y][k];
+		}
+		if (ymax <= ymin) continue;	/* Degenerate (horizontal) polygon; leave to gmt_inonout */
+		B[seg].n_bands = (unsigned int)MIN (n_edges, GMTSELECT_MAX_BANDS);
+		B[seg].y0 = ymin;
+		B[seg].i_dy = B[seg].n_bands / (ymax - ymin);
+		B[seg].start = gmt_M_memory (GMT, NULL, B[seg].n_bands + 1, uint64_t);
+		/* First pass: count how many edges overlap each band */
+		for (k = 0; k < n_edges; k++) {
+			ymin = MIN (S->data[GMT_Y][k], S->data[GMT_Y][k+1]);
+			ymax = MAX (S->data[GMT_Y][k], S->data[GMT_Y][k+1]);
+			b0 = (unsigned int)((ymin - B[seg].y0) * B[seg].i_dy);
+			b1 = (unsigned int)((ymax - B[seg].y0) * B[seg].i_dy);
+			if (b0 >= B[seg].n_bands) b0 = B[seg].n_bands - 1;
+			if (b1 >= B[seg].n_bands) b1 = B[seg].n_bands - 1;
+			for (band = b0; band <= b1; band++) B[seg].start[band+1]++;
+		}
+		for (band = 0; band < B[seg].n_bands; band++) B[seg].start[band+1] += B[seg].start[band];	/* Convert counts to offsets */
+		n_in_bands = B[seg].start[B[seg].n_bands];
+		B[seg].edge = gmt_M_memory (GMT, NULL, n_in_bands, uint64_t);
+		/* Second pass: drop each edge into the bands it overlaps, using start[band] as a cursor */
+		for (k = 0; k < n_edges; k++) {
+			ymin = MIN (S->data[GMT_Y][k], S->data[GMT_Y][k+1]);
+			ymax = MAX (S->data[GMT_Y][k], S->data[GMT_Y][k+1]);
+			b0 = (unsigned int)((ymin - B[seg].y0) * B[seg].i_dy);
+			b1 = (unsigned int)((ymax - B[seg].y0) * B[seg].i_dy);
+			if (b0 >= B[seg].n_bands) b0 = B[seg].n_bands - 1;
+			if (b1 >= B[seg].n_bands) b1 = B[seg].n_bands - 1;
+			for (band = b0; band <= b1; band++) B[seg].edge[B[seg].start[band]++] = k;
+		}
+		for (band = B[seg].n_bands; band > 0; band--) B[seg].start[band] = B[seg].start[band-1];	/* Shift cursors back to offsets */
+		B[seg].start[0] = 0;
+	}
+	return (B);
+}
+
+GMT_LOCAL void gmtselect_free_bands (struct GMT_CTRL *GMT, struct GMT_DATATABLE *T, struct GMTSELECT_BANDS **B) {
+	/* Free the edge buckets built by gmtselect_prepare_bands */
+	uint64_t seg;
+	if (*B == NULL) return;
+	for (seg = 0; seg < T->n_segments; seg++) {
+		gmt_M_free (GMT, (*B)[seg].start);
+		gmt_M_free (GMT, (*B)[seg].edge);
+	}
+	gmt_M_free (GMT, *B);
+}
+
+GMT_LOCAL unsigned int gmtselect_inonout_banded_sub (struct GMT_CTRL *GMT, double x, double y, struct GMT_DATASEGMENT *S, struct GMTSELECT_BANDS *B) {
+	/* Cartesian in-on-out test for a single segment.  Same bounding-box and longitude-periodicity
+	 * front-end as the standard test, but the non-zero winding number is computed from a horizontal
+	 * ray (x' >= x, y' = y) so that only the edges bucketed into the point's y-band need checking. */
+	uint64_t k, e;
+	unsigned int band;
+	int winding = 0;
+	double x0, y0, x1, y1, x_sect;
+
+	if (y < S->min[GMT_Y] || y > S->max[GMT_Y])
+		return (GMT_OUTSIDE);	/* Point outside, no need to assign value */
+	if (gmt_M_x_is_lon (GMT, GMT_IN)) {	/* Deal with longitude periodicity */
+		if (x < S->min[GMT_X]) {
+			x += 360.0;
+			if (x > S->max[GMT_X])
+				return (GMT_OUTSIDE);	/* Point outside, no need to assign value */
+		}
+		else if (x > S->max[GMT_X]) {
+			x -= 360.0;
+			if (x < S->min[GMT_X])
+				return (GMT_OUTSIDE);	/* Point outside, no need to assign value */
+		}
+	}
+	else if (x < S->min[GMT_X] || x > S->max[GMT_X])
+		return (GMT_OUTSIDE);	/* Point outside, no need to assign value */
+
+	if (B == NULL || B->n_bands == 0)	/* No buckets for this segment; do the full scan */
+		return (gmt_non_zero_winding (GMT, x, y, S->data[GMT_X], S->data[GMT_Y], S->n_rows));
+
+	band = (unsigned int)((y - B->y0) * B->i_dy);
+	if (band >= B->n_bands) band = B->n_bands - 1;
+	for (k = B->start[band]; k < B->start[band+1]; k++) {
+		e = B->edge[k];
+		x0 = S->data[GMT_X][e];	y0 = S->data[GMT_Y][e];
+		x1 = S->data[GMT_X][e+1];	y1 = S->data[GMT_Y][e+1];
+		if (y0 == y1) {	/* Horizontal edge can only mean on-edge, never a crossing */
+			if (y == y0 && x >= MIN (x0, x1) && x <= MAX (x0, x1)) return (GMT_ONEDGE);
+			continue;
+		}
+		if ((y0 <= y && y1 > y) || (y1 <= y && y0 > y)) {	/* Edge straddles the ray; half-open rule so shared vertices count once */
+			x_sect = x0 + (x1 - x0) * ((y - y0) / (y1 - y0));
+			if (x_sect == x) return (GMT_ONEDGE);	/* Point is exactly on this edge */
+			if (x_sect > x) winding += (y1 > y0) ? 1 : -1;	/* Edge crosses the ray; sign by direction */
+		}
+		else if (y == y0 && x == x0)	/* Point coincides with a vertex excluded by the half-open rule (local extremum) */
+			return (GMT_ONEDGE);
+		else if (y == y1 && x == x1)
+			return (GMT_ONEDGE);
+	}
+	return ((winding) ? GMT_INSIDE : GMT_OUTSIDE);
+}
+
+GMT_LOCAL unsigned int gmtselect_inonout_banded (struct GMT_CTRL *GMT, double x, double y, struct GMT_DATATABLE *T, uint64_t seg, struct GMTSELECT_BANDS *B) {
+	/* As gmt_inonout, but using the precomputed edge buckets.  Knows to check for holes as well. */
+	unsigned int side, side_h;
+	uint64_t k, h_seg;
+	struct GMT_DATASEGMENT *S = T->segment[seg], *H = NULL;
+	struct GMT_DATASEGMENT_HIDDEN *SH = gmt_get_DS_hidden (S), *SHnext = NULL;
+
+	if ((side = gmtselect_inonout_banded_sub (GMT, x, y, S, &B[seg])) <= GMT_ONEDGE) return (side);	/* Outside polygon or on perimeter, we are done */
+
+	/* Here, point is inside the polygon perimeter. See if there are holes */
+
+	if ((H = SH->next)) {	/* Must check for and skip if inside a hole */
+		side_h = GMT_OUTSIDE;	/* We are outside a hole until we are found to be inside it */
+		SHnext = gmt_get_DS_hidden (H);
+		while (side_h == GMT_OUTSIDE && H && gmt_polygon_is_hole (GMT, H)) {	/* Found a hole */
+			/* Locate the hole in the table so we can use its buckets; holes follow their perimeter */
+			for (k = seg + 1, h_seg = T->n_segments; h_seg == T->n_segments && k < T->n_segments; k++)
+				if (T->segment[k] == H) h_seg = k;
+			side_h = gmtselect_inonout_banded_sub (GMT, x, y, H, (h_seg < T->n_segments) ? &B[h_seg] : NULL);
+			H = SHnext->next;	/* Move to next polygon hole */
+			if (H) SHnext = gmt_get_DS_hidden (H);
+		}
+		if (side_h == GMT_INSIDE) side = GMT_OUTSIDE;	/* Inside one of the holes, hence outside polygon; go to next perimeter polygon */
+		if (side_h == GMT_ONEDGE) side = GMT_ONEDGE;	/* On path of one of the holes, hence on polygon path; update side */
+	}
+
+	/* Here, point is inside or on edge, we return the value */
+	return (side);
+}
+
 static int usage (struct GMTAPI_CTRL *API, int level) {
 	const char *name = gmt_show_name_and_purpose (API, THIS_MODULE_LIB, THIS_MODULE_CLASSIC_NAME, THIS_MODULE_PURPOSE);
 	if (level == GMT_MODULE_PURPOSE) return (GMT_NOERROR);
@@ -583,6 +744,7 @@ EXTERN_MSC int GMT_gmtselect (void *V_API, int mode, void *args) {
 	char *shore_resolution[5] = {"full", "high", "intermediate", "low", "crude"};
 
 	struct GMT_DATATABLE *pol = NULL, *line = NULL, *point = NULL;
+	struct GMTSELECT_BANDS *Fbands = NULL;
 	struct GMT_GSHHS_POL *p[2] = {NULL, NULL};
 	struct GMT_SHORE c;
 	struct GMT_DATASET *Cin = NULL, *Lin = NULL, *Fin = NULL;
@@ -789,6 +951,8 @@ EXTERN_MSC int GMT_gmtselect (void *V_API, int mode, void *args) {
 		}
 		else
 			gmt_set_inside_mode (GMT, Fin, GMT_IOO_UNKNOWN);
+		if (!GMT->current.proj.sph_inside)	/* Cartesian in-on-out: bucket the polygon edges into y-bands to speed up the tests */
+			Fbands = gmtselect_prepare_bands (GMT, pol);
 	}
 
 	if (Ctrl->G.active) {	/* Grid mask */
@@ -931,7 +1095,10 @@ EXTERN_MSC int GMT_gmtselect (void *V_API, int mode, void *args) {
 			inside = 0;
 			for (seg = 0; seg < pol->n_segments && !inside; seg++) {	/* Check each polygon until we find that our point is inside */
 				if (gmt_polygon_is_hole (GMT, pol->segment[seg])) continue;	/* Holes are handled within gmt_inonout */
-				inside = (gmt_inonout (GMT, xx, yy, pol->segment[seg]) >= Ctrl->E.inside[F_ITEM]);
+				if (Fbands)	/* Use the banded edge buckets to limit the scan to the point's y-band */
+					inside = (gmtselect_inonout_banded (GMT, xx, yy, pol, seg, Fbands) >= Ctrl->E.inside[F_ITEM]);
+				else
+					inside = (gmt_inonout (GMT, xx, yy, pol->segment[seg]) >= Ctrl->E.inside[F_ITEM]);
 			}
 			if (do_project)	/* Reset input type for gmt_inonout to do Cartesian mode */
 				gmt_set_geographic (GMT, GMT_IN);
@@ -1042,6 +1209,8 @@ EXTERN_MSC int GMT_gmtselect (void *V_API, int mode, void *args) {
 
 	GMT_Report (API, GMT_MSG_INFORMATION, "Read %" PRIu64 " records, passed %" PRIu64" records\n", n_read, n_pass);
 
+	if (Fbands) gmtselect_free_bands (GMT, pol, &Fbands);
+
 	if (Ctrl->N.active) {
 		gmt_free_shore (GMT, &c);
 		gmt_shore_cleanup (GMT, &c);
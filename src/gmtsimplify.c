@@ -55,6 +55,10 @@ struct GMTSIMPLIFY_CTRL {
 		bool active;
 		char *file;
 	} Out;
+	struct GMTSIMPLIFY_D {	/* 	-D[<col>] */
+		bool active;
+		int64_t col;	/* Column with precomputed tolerances when filtering [-1 means last column] */
+	} D;
 	struct GMTSIMPLIFY_T {	/* 	-T[-|=|+]<tolerance>[d|s|m|e|f|k|M|n] */
 		bool active;
 		int mode;	/* Can be negative */
@@ -81,7 +85,7 @@ static int usage (struct GMTAPI_CTRL *API, int level) {
 	const char *name = gmt_show_name_and_purpose (API, THIS_MODULE_LIB, THIS_MODULE_CLASSIC_NAME, THIS_MODULE_PURPOSE);
 	if (level == GMT_MODULE_PURPOSE) return (GMT_NOERROR);
 
-	GMT_Usage (API, 0, "usage: %s [<table>] -T<tolerance>[<unit>] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s]\n",
+	GMT_Usage (API, 0, "usage: %s [<table>] -T<tolerance>[<unit>] [-D[<col>]] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s]\n",
 		name, GMT_V_OPT, GMT_b_OPT, GMT_d_OPT, GMT_e_OPT, GMT_f_OPT, GMT_g_OPT, GMT_h_OPT, GMT_i_OPT, GMT_o_OPT, GMT_q_OPT,
 		GMT_colon_OPT, GMT_PAR_OPT);
 
@@ -91,6 +95,12 @@ static int usage (struct GMTAPI_CTRL *API, int level) {
 	GMT_Usage (API, -2, "If no units are appended we will do a Cartesian calculation instead.");
 	GMT_Message (API, GMT_TIME_NONE, "\n  OPTIONAL ARGUMENTS:\n");
 	GMT_Option (API, "<");
+	GMT_Usage (API, 1, "\n-D[<col>]");
+	GMT_Usage (API, -2, "Work with precomputed per-vertex tolerances instead of simplifying from scratch. "
+		"Without -T, we keep all points and append each vertex's Douglas-Peucker elimination tolerance as a trailing column; "
+		"this single pass covers simplification at any later tolerance. "
+		"With -T, we skip the algorithm and simply keep the vertices whose precomputed tolerance in column <col> [last column] "
+		"equals or exceeds the -T tolerance (the tolerances must have been made with the same distance units).");
 	GMT_Option (API, "V,bi2,bo,d,e,f,g,h,i,o,q,:,.");
 
 	return (GMT_MODULE_USAGE);
@@ -120,6 +130,10 @@ static int parse (struct GMT_CTRL *GMT, struct GMTSIMPLIFY_CTRL *Ctrl, struct GM
 
 			/* Processes program-specific parameters */
 
+			case 'D':	/* Precompute or reuse per-vertex tolerances */
+				n_errors += gmt_M_repeated_module_option (API, Ctrl->D.active);
+				Ctrl->D.col = (opt->arg[0]) ? atol (opt->arg) : -1;
+				break;
 			case 'T':	/* Set tolerance distance */
 				n_errors += gmt_M_repeated_module_option (API, Ctrl->T.active);
 				Ctrl->T.mode = gmt_get_distance (GMT, opt->arg, &(Ctrl->T.tolerance), &(Ctrl->T.unit));
@@ -131,6 +145,7 @@ static int parse (struct GMT_CTRL *GMT, struct GMTSIMPLIFY_CTRL *Ctrl, struct GM
 		}
 	}
 
+	n_errors += gmt_M_check_condition (GMT, !Ctrl->T.active && !Ctrl->D.active, "Option -T is required (unless -D precomputes the tolerances).\n");
 	n_errors += gmt_M_check_condition (GMT, Ctrl->T.mode == -1, "Option -T: Unrecognized unit.\n");
 	n_errors += gmt_M_check_condition (GMT, Ctrl->T.mode == -2, "Option -T: Unable to decode tolerance distance.\n");
 	n_errors += gmt_M_check_condition (GMT, Ctrl->T.mode == -3, "Option -T: Tolerance is negative.\n");
@@ -332,6 +347,14 @@ EXTERN_MSC int GMT_gmtsimplify (void *V_API, int mode, void *args) {
 	geo = gmt_M_is_geographic (GMT, GMT_IN);					/* true for lon/lat coordinates */
 	if (!geo && strchr (GMT_LEN_UNITS, (int)Ctrl->T.unit)) geo = true;	/* Used units but did not set -fg; implicitly set -fg via geo */
 
+	if (Ctrl->D.active && Ctrl->T.active) {	/* Will filter on a precomputed tolerance column */
+		if (Ctrl->D.col == -1) Ctrl->D.col = (int64_t)D[GMT_IN]->n_columns - 1;	/* Default to the last column */
+		if (Ctrl->D.col < 2 || Ctrl->D.col >= (int64_t)D[GMT_IN]->n_columns) {
+			GMT_Report (API, GMT_MSG_ERROR, "Option -D: Column %" PRId64 " is not a valid tolerance column\n", Ctrl->D.col);
+			Return (GMT_RUNTIME_ERROR);
+		}
+	}
+
 	if (gmt_init_distaz (GMT, Ctrl->T.unit, Ctrl->T.mode, GMT_MAP_DIST) == GMT_NOT_A_VALID_TYPE)	/* Initialize distance scalings according to unit selected */
 		Return (GMT_NOT_A_VALID_TYPE);
 
@@ -361,6 +384,7 @@ EXTERN_MSC int GMT_gmtsimplify (void *V_API, int mode, void *args) {
 
 	dim_out[GMT_TBL] = D[GMT_IN]->n_tables;		/* Allocate at least as many tables as the input source */
 	dim_out[GMT_COL] = D[GMT_IN]->n_columns;	/* Allocate same number of columns tables as the input source */
+	if (Ctrl->D.active && !Ctrl->T.active) dim_out[GMT_COL]++;	/* One extra column to hold the per-vertex tolerances */
 	if ((D[GMT_OUT] = GMT_Create_Data (API, GMT_IS_DATASET, D[GMT_IN]->geometry, 0, dim_out, NULL, NULL, 0, 0, NULL)) == NULL) {
 		GMT_Report (API, GMT_MSG_ERROR, "Unable to create a data set for output segments\n");
 		Return (API->error);
@@ -371,10 +395,34 @@ EXTERN_MSC int GMT_gmtsimplify (void *V_API, int mode, void *args) {
 		D[GMT_OUT]->table[tbl]->segment = gmt_M_memory (GMT, NULL, D[GMT_IN]->table[tbl]->n_segments, struct GMT_DATASEGMENT *);	/* Initial (and max) allocation of segments */
 		for (seg_in = seg_out = 0; seg_in < D[GMT_IN]->table[tbl]->n_segments; seg_in++) {
 			S[GMT_IN]  = D[GMT_IN]->table[tbl]->segment[seg_in];
+			if (Ctrl->D.active && !Ctrl->T.active) {	/* One-pass mode: keep all points but append their elimination tolerances */
+				smode = (S[GMT_IN]->text) ? GMT_WITH_STRINGS : GMT_NO_STRINGS;
+				np_out = S[GMT_IN]->n_rows;
+				S[GMT_OUT] = GMT_Alloc_Segment (GMT->parent, smode, np_out, S[GMT_IN]->n_columns + 1, NULL, NULL);
+				S[GMT_OUT]->n_rows = np_out;
+				D[GMT_OUT]->table[tbl]->segment[seg_out] = S[GMT_OUT];
+				for (row = 0; row < np_out; row++) {
+					for (col = 0; col < S[GMT_IN]->n_columns; col++)
+						S[GMT_OUT]->data[col][row] = S[GMT_IN]->data[col][row];
+					if (smode) S[GMT_OUT]->text[row] = strdup (S[GMT_IN]->text[row]);
+				}
+				gmt_dp_tolerance_tree (GMT, S[GMT_IN]->data[GMT_X], S[GMT_IN]->data[GMT_Y], np_out, geo, S[GMT_OUT]->data[S[GMT_IN]->n_columns]);
+				if (S[GMT_IN]->header) S[GMT_OUT]->header = strdup (S[GMT_IN]->header);
+				seg_out++;	ns_in++;	ns_out++;
+				n_in_tbl += np_out;
+				continue;
+			}
 			/* If input segment is a closed polygon then the simplified segment must have at least 4 points, else 3 is enough */
 			poly = (S[GMT_IN]->n_rows > 2 && !gmt_polygon_is_open (GMT, S[GMT_IN]->data[GMT_X], S[GMT_IN]->data[GMT_Y], S[GMT_IN]->n_rows));
 			index = gmt_M_memory (GMT, NULL, S[GMT_IN]->n_rows, uint64_t);
-			np_out = gmtsimplify_douglas_peucker_geog (GMT, S[GMT_IN]->data[GMT_X], S[GMT_IN]->data[GMT_Y], S[GMT_IN]->n_rows, tolerance, geo, index);
+			if (Ctrl->D.active) {	/* Filter pass on the precomputed tolerance column; no Douglas-Peucker needed */
+				uint64_t last = S[GMT_IN]->n_rows - 1;
+				double *dp_tol = S[GMT_IN]->data[Ctrl->D.col];
+				for (row = np_out = 0; row <= last; row++)
+					if (row == 0 || row == last || dp_tol[row] >= tolerance) index[np_out++] = row;
+			}
+			else
+				np_out = gmtsimplify_douglas_peucker_geog (GMT, S[GMT_IN]->data[GMT_X], S[GMT_IN]->data[GMT_Y], S[GMT_IN]->n_rows, tolerance, geo, index);
 			skip = ((poly && np_out < 4) || (np_out == 2 && S[GMT_IN]->data[GMT_X][index[0]] == S[GMT_IN]->data[GMT_X][index[1]] && S[GMT_IN]->data[GMT_Y][index[0]] == S[GMT_IN]->data[GMT_Y][index[1]]));
 			if (!skip) {	/* Must allocate one segment for output */
 				smode = (S[GMT_IN]->text) ? GMT_WITH_STRINGS : GMT_NO_STRINGS;
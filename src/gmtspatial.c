@@ -64,6 +64,7 @@
 int geos_methods(struct GMT_CTRL *GMT, struct GMT_DATASET *D, char *fname, double buf_dist, char *method);
 int geos_method_polygon(struct GMT_CTRL *GMT, struct GMT_DATASET *Din, struct GMT_DATASET *Dout, char *method);
 int geos_method_linestring(struct GMT_CTRL *GMT, struct GMT_DATASET *Din, struct GMT_DATASET *Dout, double buf_dist, char *method);
+int geos_method_union(struct GMT_CTRL *GMT, struct GMT_DATASET *Din, struct GMT_DATASET *Dout);
 #endif
 
 struct GMTSPATIAL_DUP {	/* Holds information on which single segment is closest to the current test segment */
@@ -846,7 +847,9 @@ static int usage (struct GMTAPI_CTRL *API, int level) {
 	//GMT_Usage (API, 3, "i: Find intersection [Not implemented yet].");
 	//GMT_Usage (API, 3, "j: Join polygons that were split by the Dateline [Not implemented yet].");
 	GMT_Usage (API, 3, "s: Split polygons that straddle the Dateline.");
-	//GMT_Usage (API, 3, "u: Find union [Not implemented yet].");
+#ifdef HAVE_GEOS
+	GMT_Usage (API, 3, "u: Dissolve all polygons into their union.");
+#endif
 	GMT_Usage (API, 1, "\n-T[<cpol>]");
 	GMT_Usage (API, -2, "Truncate polygons against the clip polygon <cpol>; if <cpol> is not given we require -R "
 		"and clip against a polygon derived from the region border.");
@@ -1094,11 +1097,9 @@ static int parse (struct GMT_CTRL *GMT, struct GMTSPATIAL_CTRL *Ctrl, struct GMT
 				break;
 			case 'S':	/* Spatial polygon operations */
 				n_errors += gmt_M_repeated_module_option (API, Ctrl->S.active);
-				if (opt->arg[0] == 'u') {
-					Ctrl->S.mode = POL_UNION;
-					GMT_Report (API, GMT_MSG_ERROR, "Option -Su not implemented yet\n");
-				}
 #ifdef HAVE_GEOS
+				if (opt->arg[0] == 'u')
+					Ctrl->S.mode = POL_UNION;
 				else if (opt->arg[0] == 'b') {
 					Ctrl->S.mode = POL_BUFFER;
 					Ctrl->S.width = atof (&opt->arg[1]);
@@ -1109,6 +1110,12 @@ static int parse (struct GMT_CTRL *GMT, struct GMTSPATIAL_CTRL *Ctrl, struct GMT
 				}
 				else if (opt->arg[0] == 'c')
 					Ctrl->S.mode = POL_CENTROID;
+#else
+				if (opt->arg[0] == 'u') {
+					Ctrl->S.mode = POL_UNION;
+					GMT_Report (API, GMT_MSG_ERROR, "Option -Su requires GMT to be built with GEOS support\n");
+					n_errors++;
+				}
 #endif
 				else if (opt->arg[0] == 'i') {
 					Ctrl->S.mode = POL_INTERSECTION;
@@ -1175,6 +1182,190 @@ static int parse (struct GMT_CTRL *GMT, struct GMTSPATIAL_CTRL *Ctrl, struct GMT
 	return (n_errors ? GMT_PARSE_ERROR : GMT_NOERROR);
 }
 
+/* STR-packed bounding-box tree over the segments of a dataset.  The all-pairs loops
+ * under -I (crossings) and -N (containment) spend most of their time on segment pairs
+ * whose bounding boxes do not even overlap.  When enough segments are involved we pack
+ * their boxes into a static R-tree (Sort-Tile-Recursive bulk load) so each segment or
+ * polygon only needs one logarithmic query to flag the candidates it can interact with;
+ * all other pairs are skipped without any point-level work. */
+
+#define GMTSPATIAL_STR_M	16	/* Node capacity of the STR tree */
+#define GMTSPATIAL_STR_MIN	64	/* Only build the tree when at least this many segments are involved */
+
+struct GMTSPATIAL_BOX {	/* Bounding box of a segment or a tree node */
+	double xmin, xmax, ymin, ymax;
+};
+
+struct GMTSPATIAL_STR_KEY {	/* Used to sort boxes into STR packing order */
+	double key;
+	uint64_t id;
+};
+
+struct GMTSPATIAL_STR_NODE {	/* One node in the flat tree array */
+	struct GMTSPATIAL_BOX box;	/* Union of all boxes below this node */
+	uint64_t first, last;		/* Child range [first,last): items for leaves, else nodes */
+};
+
+struct GMTSPATIAL_STR {	/* The packed tree */
+	uint64_t n_items;	/* Number of segment boxes indexed */
+	uint64_t n_leaves;	/* Nodes [0,n_leaves) are leaves whose ranges refer to perm */
+	uint64_t n_nodes;	/* Total number of nodes; the root is the last node */
+	uint64_t *perm;		/* The items in packed leaf order */
+	struct GMTSPATIAL_BOX *ibox;	/* Pointer to the item boxes (borrowed, not owned) */
+	struct GMTSPATIAL_STR_NODE *node;
+};
+
+GMT_LOCAL int gmtspatial_str_cmp (const void *a, const void *b) {
+	/* Sort the STR keys into ascending order */
+	const struct GMTSPATIAL_STR_KEY *ka = a, *kb = b;
+	if (ka->key < kb->key) return (-1);
+	if (ka->key > kb->key) return (+1);
+	return (0);
+}
+
+GMT_LOCAL void gmtspatial_box_expand (struct GMTSPATIAL_BOX *B, struct GMTSPATIAL_BOX *A) {
+	/* Grow box B to also contain box A */
+	if (A->xmin < B->xmin) B->xmin = A->xmin;
+	if (A->xmax > B->xmax) B->xmax = A->xmax;
+	if (A->ymin < B->ymin) B->ymin = A->ymin;
+	if (A->ymax > B->ymax) B->ymax = A->ymax;
+}
+
+GMT_LOCAL bool gmtspatial_box_overlap (struct GMTSPATIAL_BOX *A, struct GMTSPATIAL_BOX *B) {
+	/* Return true if the two closed boxes share at least one point */
+	return (A->xmin <= B->xmax && A->xmax >= B->xmin && A->ymin <= B->ymax && A->ymax >= B->ymin);
+}
+
+GMT_LOCAL void gmtspatial_segment_box (struct GMT_DATASEGMENT *S, struct GMTSPATIAL_BOX *B) {
+	/* Compute the bounding box of a single segment */
+	uint64_t row;
+	B->xmin = B->ymin = DBL_MAX;	B->xmax = B->ymax = -DBL_MAX;
+	for (row = 0; row < S->n_rows; row++) {
+		if (S->data[GMT_X][row] < B->xmin) B->xmin = S->data[GMT_X][row];
+		if (S->data[GMT_X][row] > B->xmax) B->xmax = S->data[GMT_X][row];
+		if (S->data[GMT_Y][row] < B->ymin) B->ymin = S->data[GMT_Y][row];
+		if (S->data[GMT_Y][row] > B->ymax) B->ymax = S->data[GMT_Y][row];
+	}
+}
+
+GMT_LOCAL struct GMTSPATIAL_BOX *gmtspatial_dataset_boxes (struct GMT_CTRL *GMT, struct GMT_DATASET *D) {
+	/* Compute the bounding box of every segment in D, in (table,segment) order */
+	uint64_t tbl, seg, p = 0;
+	struct GMTSPATIAL_BOX *box = gmt_M_memory (GMT, NULL, D->n_segments, struct GMTSPATIAL_BOX);
+	if (box == NULL) return NULL;
+	for (tbl = 0; tbl < D->n_tables; tbl++)
+		for (seg = 0; seg < D->table[tbl]->n_segments; seg++)
+			gmtspatial_segment_box (D->table[tbl]->segment[seg], &box[p++]);
+	return (box);
+}
+
+GMT_LOCAL void gmtspatial_str_sort (struct GMT_CTRL *GMT, struct GMTSPATIAL_BOX *box, uint64_t *order, uint64_t n) {
+	/* Rearrange the n entries in order into STR packing order: sort on x-center, chop
+	 * into vertical slices of sqrt(n/M) leaves each, then sort each slice on y-center */
+	uint64_t k, start, len, slice_len, n_leaves;
+	struct GMTSPATIAL_STR_KEY *K = gmt_M_memory (GMT, NULL, n, struct GMTSPATIAL_STR_KEY);
+	if (K == NULL) return;	/* Packing order is just a quality matter so carry on as is */
+	for (k = 0; k < n; k++) {
+		K[k].id = order[k];
+		K[k].key = box[order[k]].xmin + box[order[k]].xmax;	/* Twice the x-center */
+	}
+	qsort (K, n, sizeof (struct GMTSPATIAL_STR_KEY), gmtspatial_str_cmp);
+	n_leaves = (n + GMTSPATIAL_STR_M - 1) / GMTSPATIAL_STR_M;
+	slice_len = GMTSPATIAL_STR_M * urint (ceil (sqrt ((double)n_leaves)));
+	for (start = 0; start < n; start += slice_len) {	/* Sort each vertical slice on y-center */
+		len = MIN (slice_len, n - start);
+		for (k = 0; k < len; k++)
+			K[start+k].key = box[K[start+k].id].ymin + box[K[start+k].id].ymax;	/* Twice the y-center */
+		qsort (&K[start], len, sizeof (struct GMTSPATIAL_STR_KEY), gmtspatial_str_cmp);
+	}
+	for (k = 0; k < n; k++) order[k] = K[k].id;
+	gmt_M_free (GMT, K);
+}
+
+GMT_LOCAL void gmtspatial_str_free (struct GMT_CTRL *GMT, struct GMTSPATIAL_STR **X) {
+	/* Free the tree [but not the item boxes which the caller owns] */
+	if (*X == NULL) return;
+	gmt_M_free (GMT, (*X)->perm);
+	gmt_M_free (GMT, (*X)->node);
+	gmt_M_free (GMT, *X);
+}
+
+GMT_LOCAL struct GMTSPATIAL_STR *gmtspatial_str_build (struct GMT_CTRL *GMT, struct GMTSPATIAL_BOX *ibox, uint64_t n_items) {
+	/* Bulk-load the n_items boxes into an STR tree built bottom-up over consecutive packed runs */
+	uint64_t k, j, n, n_level, n_alloc, level_start, prev_start;
+	struct GMTSPATIAL_STR_NODE *N = NULL;
+	struct GMTSPATIAL_STR *X = gmt_M_memory (GMT, NULL, 1, struct GMTSPATIAL_STR);
+
+	if (X == NULL) return NULL;
+	X->n_items = n_items;	X->ibox = ibox;
+	if ((X->perm = gmt_M_memory (GMT, NULL, n_items, uint64_t)) == NULL) {
+		gmt_M_free (GMT, X);
+		return NULL;
+	}
+	for (k = 0; k < n_items; k++) X->perm[k] = k;
+	gmtspatial_str_sort (GMT, ibox, X->perm, n_items);
+	for (n = n_items, n_alloc = 0; n > 1; n = (n + GMTSPATIAL_STR_M - 1) / GMTSPATIAL_STR_M)
+		n_alloc += (n + GMTSPATIAL_STR_M - 1) / GMTSPATIAL_STR_M;	/* Count the nodes on all levels */
+	if (n_alloc == 0) n_alloc = 1;	/* Happens when n_items == 1 */
+	if ((X->node = gmt_M_memory (GMT, NULL, n_alloc, struct GMTSPATIAL_STR_NODE)) == NULL) {
+		gmtspatial_str_free (GMT, &X);
+		return NULL;
+	}
+	X->n_leaves = (n_items + GMTSPATIAL_STR_M - 1) / GMTSPATIAL_STR_M;
+	for (k = 0; k < X->n_leaves; k++) {	/* Create the leaves over consecutive runs of perm */
+		N = &X->node[k];
+		N->first = k * GMTSPATIAL_STR_M;
+		N->last  = MIN (N->first + GMTSPATIAL_STR_M, n_items);
+		N->box = ibox[X->perm[N->first]];
+		for (j = N->first + 1; j < N->last; j++)
+			gmtspatial_box_expand (&N->box, &ibox[X->perm[j]]);
+	}
+	X->n_nodes = n = X->n_leaves;	prev_start = 0;
+	while (n > 1) {	/* Build internal levels over consecutive runs of the level below until a single root remains */
+		n_level = (n + GMTSPATIAL_STR_M - 1) / GMTSPATIAL_STR_M;
+		level_start = X->n_nodes;
+		for (k = 0; k < n_level; k++) {
+			N = &X->node[level_start+k];
+			N->first = prev_start + k * GMTSPATIAL_STR_M;
+			N->last  = MIN (N->first + GMTSPATIAL_STR_M, prev_start + n);
+			N->box = X->node[N->first].box;
+			for (j = N->first + 1; j < N->last; j++)
+				gmtspatial_box_expand (&N->box, &X->node[j].box);
+		}
+		X->n_nodes += n_level;
+		prev_start = level_start;	n = n_level;
+	}
+	return (X);
+}
+
+GMT_LOCAL void gmtspatial_str_visit (struct GMTSPATIAL_STR *X, uint64_t node, struct GMTSPATIAL_BOX *Q, char *hit) {
+	/* Recursively descend into nodes that overlap Q and flag the overlapping items */
+	uint64_t k;
+	if (!gmtspatial_box_overlap (&X->node[node].box, Q)) return;
+	if (node < X->n_leaves) {	/* A leaf: check the individual items */
+		for (k = X->node[node].first; k < X->node[node].last; k++)
+			if (gmtspatial_box_overlap (&X->ibox[X->perm[k]], Q)) hit[X->perm[k]] = 1;
+	}
+	else {	/* Internal node: visit the children */
+		for (k = X->node[node].first; k < X->node[node].last; k++)
+			gmtspatial_str_visit (X, k, Q, hit);
+	}
+}
+
+GMT_LOCAL void gmtspatial_str_query (struct GMT_CTRL *GMT, struct GMTSPATIAL_STR *X, struct GMTSPATIAL_BOX *Q, char *hit) {
+	/* Set hit[item] = 1 for all items whose bounding box overlaps query box Q.  The caller
+	 * must zero out hit first.  For geographic data we also run the query shifted by +/- 360
+	 * since the longitude conventions of the two data sets may differ. */
+	gmtspatial_str_visit (X, X->n_nodes - 1, Q, hit);
+	if (gmt_M_is_geographic (GMT, GMT_IN)) {
+		struct GMTSPATIAL_BOX Qs = *Q;
+		Qs.xmin -= 360.0;	Qs.xmax -= 360.0;
+		gmtspatial_str_visit (X, X->n_nodes - 1, &Qs, hit);
+		Qs.xmin += 720.0;	Qs.xmax += 720.0;
+		gmtspatial_str_visit (X, X->n_nodes - 1, &Qs, hit);
+	}
+}
+
 GMT_LOCAL double gmtspatial_dist_to_degree (struct GMT_CTRL *GMT, double d_in) {
 	double d_out = d_in / GMT->current.map.dist[GMT_MAP_DIST].scale;	/* Now in degrees or meters */
 	if (!GMT->current.map.dist[GMT_MAP_DIST].arc)	/* Got unit distance measure */
@@ -1275,7 +1466,7 @@ EXTERN_MSC int GMT_gmtspatial (void *V_API, int mode, void *args) {
 		Return (GMT_NOERROR);
 	}
 
-	if (Ctrl->S.active && !(Ctrl->S.mode == POL_SPLIT || Ctrl->S.mode == POL_HOLE || Ctrl->S.mode == POL_BUFFER || Ctrl->S.mode == POL_CENTROID))
+	if (Ctrl->S.active && !(Ctrl->S.mode == POL_SPLIT || Ctrl->S.mode == POL_HOLE || Ctrl->S.mode == POL_BUFFER || Ctrl->S.mode == POL_CENTROID || Ctrl->S.mode == POL_UNION))
 		external = 1;
 
 	if (gmt_init_distaz (GMT, 'X', 0, GMT_MAP_DIST) == GMT_NOT_A_VALID_TYPE)	/* Use Cartesian calculations and user units */
@@ -1634,12 +1825,14 @@ EXTERN_MSC int GMT_gmtspatial (void *V_API, int mode, void *args) {
 	if (Ctrl->I.active || external) {	/* Crossovers between polygons */
 		bool same_feature;
 		unsigned int in, wtype, n_columns;
-		uint64_t tbl1, tbl2, col, nx, row, seg1, seg2;
+		uint64_t tbl1, tbl2, col, nx, row, seg1, seg2, *off = NULL;
 		struct GMT_XSEGMENT *ylist1 = NULL, *ylist2 = NULL;
 		struct GMT_XOVER XC;
-		char record[GMT_BUFSIZ] = {""}, fmt[GMT_BUFSIZ] = {""};
+		char record[GMT_BUFSIZ] = {""}, fmt[GMT_BUFSIZ] = {""}, *hit = NULL;
 		struct GMT_DATASET *C = NULL;
 		struct GMT_DATASEGMENT *S1 = NULL, *S2 = NULL;
+		struct GMTSPATIAL_BOX *box = NULL, Q;
+		struct GMTSPATIAL_STR *Tree = NULL;
 
 		if (Ctrl->S.mode == POL_CLIP) {	/* Need to set up a separate table with the clip polygon */
 			if (Ctrl->T.file) {
@@ -1687,15 +1880,30 @@ EXTERN_MSC int GMT_gmtspatial (void *V_API, int mode, void *args) {
 			GMT->current.setting.io_col_separator, GMT->current.setting.format_float_out, GMT->current.setting.io_col_separator, GMT->current.setting.format_float_out, \
 			GMT->current.setting.io_col_separator, GMT->current.setting.io_col_separator);
 		Out.data = out;	Out.text = NULL;
+		if (D->n_segments >= GMTSPATIAL_STR_MIN && (box = gmtspatial_dataset_boxes (GMT, D)) != NULL) {	/* Worth building a spatial index over the segments */
+			if ((Tree = gmtspatial_str_build (GMT, box, D->n_segments)) == NULL)	/* Ran out of memory - fall back on the all-pairs loops */
+				gmt_M_free (GMT, box);
+			else {
+				hit = gmt_M_memory (GMT, NULL, D->n_segments, char);
+				off = gmt_M_memory (GMT, NULL, D->n_tables, uint64_t);	/* Start of each table's segments in the running segment count */
+				for (tbl2 = 1; tbl2 < D->n_tables; tbl2++) off[tbl2] = off[tbl2-1] + D->table[tbl2-1]->n_segments;
+			}
+		}
 		for (tbl1 = 0; tbl1 < C->n_tables; tbl1++) {
 			for (seg1 = 0; seg1 < C->table[tbl1]->n_segments; seg1++) {
 				S1 = C->table[tbl1]->segment[seg1];
 				if (S1->n_rows == 0) continue;
+				if (Tree) {	/* Flag the segments whose bounding boxes overlap S1's box */
+					gmtspatial_segment_box (S1, &Q);
+					gmt_M_memset (hit, D->n_segments, char);
+					gmtspatial_str_query (GMT, Tree, &Q, hit);
+				}
 				gmt_init_track (GMT, S1->data[GMT_Y], S1->n_rows, &ylist1);
 				for (tbl2 = (Ctrl->S.mode == POL_CLIP) ? 0 : tbl1; tbl2 < D->n_tables; tbl2++) {
 					for (seg2 = 0; seg2 < D->table[tbl2]->n_segments; seg2++) {
 						S2 = D->table[tbl2]->segment[seg2];
 						if (S2->n_rows == 0) continue;
+						if (Tree && !hit[off[tbl2]+seg2]) continue;	/* Bounding boxes do not overlap so no crossings (or containment) are possible */
 						if (Ctrl->S.mode != POL_CLIP) {	/* So there is only one dataset being compared with itself */
 							same_feature = (external == 2 || internal == 2) ? (tbl1 == tbl2) : (tbl1 == tbl2 && seg1 == seg2);	/* What constitutes the same feature */
 							if (!internal && same_feature) continue;	/* Do not do internal crossings */
@@ -1809,9 +2017,6 @@ EXTERN_MSC int GMT_gmtspatial (void *V_API, int mode, void *args) {
 							}
 						}
 						gmt_M_free (GMT, ylist2);
-						if (Ctrl->S.mode == POL_UNION) {
-							GMT_Report (API, GMT_MSG_ERROR, "Computing polygon union not implemented yet\n");
-						}
 						if (Ctrl->S.mode == POL_INTERSECTION) {
 							GMT_Report (API, GMT_MSG_ERROR, "Computing polygon intersection not implemented yet\n");
 						}
@@ -1820,6 +2025,12 @@ EXTERN_MSC int GMT_gmtspatial (void *V_API, int mode, void *args) {
 				gmt_M_free (GMT, ylist1);
 			}
 		}
+		if (Tree) {	/* Free the spatial index */
+			gmtspatial_str_free (GMT, &Tree);
+			gmt_M_free (GMT, box);
+			gmt_M_free (GMT, hit);
+			gmt_M_free (GMT, off);
+		}
 		if (GMT_End_IO (API, GMT_OUT, 0) != GMT_NOERROR) {	/* Disables further data output */
 			Return (API->error);
 		}
@@ -1994,12 +2205,14 @@ EXTERN_MSC int GMT_gmtspatial (void *V_API, int mode, void *args) {
 		int64_t kk;
 		unsigned int *count = NULL, nmode;
 		int ID = -1;
-		char seg_label[GMT_LEN64] = {""}, record[GMT_BUFSIZ] = {""}, *used = NULL;
+		char seg_label[GMT_LEN64] = {""}, record[GMT_BUFSIZ] = {""}, *used = NULL, *hit = NULL;
 		double *out = NULL;
 		struct GMT_DATASET *C = NULL;
 		struct GMT_DATATABLE *T = NULL;
 		struct GMT_DATASEGMENT *S = NULL, *S2 = NULL;
 		struct GMT_DATASEGMENT_HIDDEN *SH = NULL;
+		struct GMTSPATIAL_BOX *box = NULL, Q;
+		struct GMTSPATIAL_STR *Tree = NULL;
 
 		gmt_disable_bghio_opts (GMT);	/* Do not want any -b -g -h -i -o to affect the reading from -CN files */
 		if ((C = GMT_Read_Data (API, GMT_IS_DATASET, GMT_IS_FILE, GMT_IS_POLY, GMT_READ_NORMAL, NULL, Ctrl->N.file, NULL)) == NULL) {
@@ -2037,6 +2250,12 @@ EXTERN_MSC int GMT_gmtspatial (void *V_API, int mode, void *args) {
 		T = C->table[0];	/* Only one input file so only one table */
 		count = gmt_M_memory (GMT, NULL, D->n_segments, unsigned int);
 		ID = Ctrl->N.ID - 1;	/* May be overridden below by header info, otherwise will be incremented to 0 (or whatever +p set) */
+		if (D->n_segments >= GMTSPATIAL_STR_MIN && (box = gmtspatial_dataset_boxes (GMT, D)) != NULL) {	/* Worth building a spatial index over the features */
+			if ((Tree = gmtspatial_str_build (GMT, box, D->n_segments)) == NULL)	/* Ran out of memory - fall back on the all-pairs loops */
+				gmt_M_free (GMT, box);
+			else
+				hit = gmt_M_memory (GMT, NULL, D->n_segments, char);
+		}
 		for (seg2 = 0; seg2 < T->n_segments; seg2++) {	/* For all polygons */
 			S2 = T->segment[seg2];
 			SH = gmt_get_DS_hidden (S2);
@@ -2055,12 +2274,21 @@ EXTERN_MSC int GMT_gmtspatial (void *V_API, int mode, void *args) {
 			else	/* Increment running polygon ID */
 				ID++;
 
+			if (Tree) {	/* Flag the features whose bounding boxes overlap this polygon's box */
+				gmtspatial_segment_box (S2, &Q);
+				gmt_M_memset (hit, D->n_segments, char);
+				gmtspatial_str_query (GMT, Tree, &Q, hit);
+			}
 			kk = -1;	/* Start at first point when first incremented (for -N+i) */
 			for (tbl = p = 0; tbl < D->n_tables; tbl++) {
 				for (seg = 0; seg < D->table[tbl]->n_segments; seg++, p++) {
 					S = D->table[tbl]->segment[seg];
 					if (S->n_rows == 0) continue;
 					if (Ctrl->N.mode == GMT_N_MODE_CLOUD) {	/* Find polygon containing this point */
+						if (Tree && !hit[p]) {	/* Bounding boxes do not overlap so no point can be inside; keep point count in sync */
+							kk += (int64_t)S->n_rows;
+							continue;
+						}
 						for (row = 0; row < S->n_rows; row++) {	/* Check all points if they are inside */
 							kk++;
 							if (used[kk]) continue;	/* Already found it is inside another polygon */
@@ -2074,7 +2302,9 @@ EXTERN_MSC int GMT_gmtspatial (void *V_API, int mode, void *args) {
 						continue;	/* All done for this point & polygon combination */
 					}
 
-					for (row = n = 0, check_next = true; check_next && row < S->n_rows; row++) {	/* Check one or all points if they are inside */
+					if (Tree && !hit[p])	/* Bounding boxes do not overlap so no point can be inside this polygon */
+						n = 0;
+					else for (row = n = 0, check_next = true; check_next && row < S->n_rows; row++) {	/* Check one or all points if they are inside */
 						if (Ctrl->N.all && n < row)	/* At least one point has been found outside so with +a we stop checking for more */
 							check_next = false;
 						else	/* Need to see if next point is inside (which always takes place for the first point row = 0) */
@@ -2141,6 +2371,11 @@ EXTERN_MSC int GMT_gmtspatial (void *V_API, int mode, void *args) {
 			Return (API->error);
 		}
 		gmt_M_free (GMT, count);
+		if (Tree) {	/* Free the spatial index */
+			gmtspatial_str_free (GMT, &Tree);
+			gmt_M_free (GMT, box);
+			gmt_M_free (GMT, hit);
+		}
 		if (Ctrl->N.mode == GMT_N_MODE_CLOUD) {
 			gmt_M_free (GMT, used);
 			gmt_M_free (GMT, out);
@@ -2331,6 +2566,12 @@ EXTERN_MSC int GMT_gmtspatial (void *V_API, int mode, void *args) {
 		if (error)
 			Return (error);
 	}
+	if (Ctrl->S.active && Ctrl->S.mode == POL_UNION) {	/* Dissolve all polygons into their union */
+		error = geos_methods(GMT, D, Ctrl->Out.file, 0, "union");
+		finishGEOS();
+		if (error)
+			Return (error);
+	}
 #endif
 
 	if (Ctrl->W.active) {	/* Extend all segments by specified amount in one or both directions */
@@ -2434,7 +2675,7 @@ int geos_methods(struct GMT_CTRL *GMT, struct GMT_DATASET *D, char *fname, doubl
 		return -1;
 	}
 
-	dim[GMT_TBL] = D->n_tables;
+	dim[GMT_TBL] = (!strcmp(method, "union")) ? 1 : D->n_tables;	/* The union dissolves all tables into one */
 	dim[GMT_COL] = (D->n_columns == 2) ? 2 : 3;
 	if ((Dout = GMT_Create_Data (GMT->parent, GMT_IS_DATASET, GMT_IS_PLP, 0, dim, NULL, NULL, 0, 0, NULL)) == NULL) {
 		GMT_Report (GMT->parent, GMT_MSG_NORMAL, "Failed to create output dataset.\n");
@@ -2446,6 +2687,8 @@ int geos_methods(struct GMT_CTRL *GMT, struct GMT_DATASET *D, char *fname, doubl
 		geos_method_polygon(GMT, D, Dout, "");
 	else if (!strcmp(method, "buffer"))
 		geos_method_linestring(GMT, D, Dout, buf_dist, "");
+	else if (!strcmp(method, "union"))
+		geos_method_union(GMT, D, Dout);
 
 	if (GMT_Write_Data (GMT->parent, GMT_IS_DATASET, GMT_IS_FILE, GMT_IS_PLP, GMT_WRITE_SET, NULL, fname, Dout) != GMT_NOERROR) {
 		GMT_Report (GMT->parent, GMT_MSG_NORMAL, "Failed to write output dataset.\n");
@@ -2600,4 +2843,93 @@ int geos_method_linestring(struct GMT_CTRL *GMT, struct GMT_DATASET *Din, struct
 	return 0;
 }
 
+int geos_method_union(struct GMT_CTRL *GMT, struct GMT_DATASET *Din, struct GMT_DATASET *Dout) {
+	/* Dissolve all input polygons into their union.  We hand the whole set to GEOS as a single
+	 * collection and let GEOSUnaryUnion do a cascaded union: it indexes the members in an
+	 * STR-tree and merges spatial neighbors bottom-up, so the cost grows as n log n with the
+	 * polygon count instead of the n^2 of repeated pairwise unions.  Any third input column
+	 * is not carried through since the union mixes data from different sources. */
+	unsigned int nt, ns, nr, n_pts, k, nu, ng = 0, n_out = 0;
+	int nir, ir;
+	uint64_t row;
+	GEOSCoordSequence *seq_in = NULL;
+	const GEOSCoordSequence *seq_out = NULL;
+	GEOSGeometry **geoms = NULL, *coll = NULL, *geom_out = NULL, *geom = NULL, *shell = NULL;
+	const GEOSGeometry *poly = NULL, *ring = NULL;
+	GEOSContextHandle_t handle = NULL;
+	struct GMT_DATASEGMENT *S = NULL;
+
+	handle = initGEOS_r(NULL, NULL);
+
+	geoms = gmt_M_memory (GMT, NULL, Din->n_segments, GEOSGeometry *);
+	for (nt = 0; nt < Din->n_tables; nt++) {
+		for (ns = 0; ns < Din->table[nt]->n_segments; ns++) {
+			seq_in = GEOSCoordSeq_create_r(handle, (unsigned int)Din->table[nt]->segment[ns]->n_rows, 2);
+			if (!seq_in) {
+				GMT_Report (GMT->parent, GMT_MSG_NORMAL, "Failed to create input GEOS sequence for table %d, segment %d\n", nt, ns);
+				continue;
+			}
+			for (nr = 0; nr < Din->table[nt]->segment[ns]->n_rows; nr++) {
+				GEOSCoordSeq_setX_r(handle, seq_in, nr, Din->table[nt]->segment[ns]->data[0][nr]);
+				GEOSCoordSeq_setY_r(handle, seq_in, nr, Din->table[nt]->segment[ns]->data[1][nr]);
+			}
+			if ((shell = GEOSGeom_createLinearRing_r(handle, seq_in)) == NULL) {
+				GMT_Report (GMT->parent, GMT_MSG_NORMAL, "Failed to create GEOS ring for table %d, segment %d (open polygon?)\n", nt, ns);
+				continue;
+			}
+			if ((geom = GEOSGeom_createPolygon_r(handle, shell, NULL, 0)) == NULL) {
+				GMT_Report (GMT->parent, GMT_MSG_NORMAL, "Failed to create GEOS polygon for table %d, segment %d\n", nt, ns);
+				continue;
+			}
+			geoms[ng++] = geom;
+		}
+	}
+
+	coll = GEOSGeom_createCollection_r(handle, GEOS_GEOMETRYCOLLECTION, geoms, ng);	/* Takes ownership of the members */
+	gmt_M_free (GMT, geoms);
+	if (!coll) {
+		GMT_Report (GMT->parent, GMT_MSG_NORMAL, "Failed to create GEOS collection of %d polygons\n", ng);
+		return -1;
+	}
+	geom_out = GEOSUnaryUnion_r(handle, coll);
+	GEOSGeom_destroy_r(handle, coll);
+	if (!geom_out) {
+		GMT_Report (GMT->parent, GMT_MSG_NORMAL, "GEOS polygon union failed\n");
+		return -1;
+	}
+
+	/* One output segment per ring: each exterior ring plus any holes the union created */
+	nu = (unsigned int)GEOSGetNumGeometries_r(handle, geom_out);
+	for (k = 0; k < nu; k++) {
+		poly = GEOSGetGeometryN_r(handle, geom_out, k);
+		if (GEOSGeomTypeId_r(handle, poly) != GEOS_POLYGON) continue;	/* Degenerate pieces (points, lines) are dropped */
+		n_out += 1 + GEOSGetNumInteriorRings_r(handle, poly);
+	}
+	Dout->table[0]->segment = gmt_M_memory (GMT, NULL, n_out, struct GMT_DATASEGMENT *);
+	Dout->table[0]->n_segments = 0;
+	for (k = 0; k < nu; k++) {
+		poly = GEOSGetGeometryN_r(handle, geom_out, k);
+		if (GEOSGeomTypeId_r(handle, poly) != GEOS_POLYGON) continue;
+		nir = GEOSGetNumInteriorRings_r(handle, poly);
+		for (ir = -1; ir < nir; ir++) {	/* -1 is the exterior ring, the rest are holes */
+			ring = (ir == -1) ? GEOSGetExteriorRing_r(handle, poly) : GEOSGetInteriorRingN_r(handle, poly, ir);
+			if ((seq_out = GEOSGeom_getCoordSeq_r(handle, ring)) == NULL) continue;
+			if (GEOSCoordSeq_getSize_r(handle, seq_out, &n_pts) == 0) continue;
+			S = GMT_Alloc_Segment (GMT->parent, GMT_NO_STRINGS, (uint64_t)n_pts, Dout->n_columns, (ir == -1) ? NULL : "-Ph", NULL);
+			for (row = 0; row < (uint64_t)n_pts; row++) {
+				GEOSCoordSeq_getX_r(handle, seq_out, (unsigned int)row, &S->data[GMT_X][row]);
+				GEOSCoordSeq_getY_r(handle, seq_out, (unsigned int)row, &S->data[GMT_Y][row]);
+			}
+			S->n_rows = n_pts;
+			Dout->table[0]->segment[Dout->table[0]->n_segments++] = S;
+			Dout->table[0]->n_records += n_pts;
+		}
+	}
+	GEOSGeom_destroy_r(handle, geom_out);
+	Dout->n_segments = Dout->table[0]->n_segments;
+	Dout->n_records = Dout->table[0]->n_records;
+	GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "Union of %d input polygons yielded %d polygons\n", ng, nu);
+	return 0;
+}
+
 #endif
@@ -652,26 +652,33 @@ EXTERN_MSC int GMT_grd2cpt (void *V_API, int mode, void *args) {
 		if (!Ctrl->L.minimum_given) G[0]->header->z_min = Ctrl->L.min;
 		if (!Ctrl->L.maximum_given) G[0]->header->z_max = Ctrl->L.max;
 	}
-	else {
-		Ctrl->L.min = G[0]->header->z_max;	/* This is just to double check G[k]->header->z_min, G[k]->header->z_max  */
-		Ctrl->L.max = G[0]->header->z_min;
+	else if (Ctrl->E.cdf) {
 		for (k = 0; k < ngrd; k++) {	/* For each grid */
 			gmt_M_grd_loop (GMT, G[k], row, col, ij) {
 				if (gmt_M_is_fnan (G[k]->data[ij]))
 					nfound++;
-				else if (Ctrl->E.cdf) {
+				else {
 					pair[nxy].value    = G[k]->data[ij];
 					pair[nxy++].weight = W->data[ij];
 					wsum += W->data[ij];
 				}
-				else {
-					if (G[k]->data[ij] < Ctrl->L.min) Ctrl->L.min = G[k]->data[ij];
-					if (G[k]->data[ij] > Ctrl->L.max) Ctrl->L.max = G[k]->data[ij];
-					mean += G[k]->data[ij];
-					sd += G[k]->data[ij] * G[k]->data[ij];
-				}
 			}
 		}
+	}
+	else {
+		double zmin, zmax, zsum, zsum2;
+		uint64_t n_ok;
+		Ctrl->L.min = G[0]->header->z_max;	/* This is just to double check G[k]->header->z_min, G[k]->header->z_max  */
+		Ctrl->L.max = G[0]->header->z_min;
+		for (k = 0; k < ngrd; k++) {	/* For each grid; pure range and moment scan so use the banded reduction */
+			n_ok = gmt_grd_reduce (GMT, G[k]->header, G[k]->data, &zmin, &zmax, &zsum, &zsum2);
+			nfound += G[k]->header->nm - n_ok;
+			if (n_ok == 0) continue;	/* All NaN in this grid */
+			if (zmin < Ctrl->L.min) Ctrl->L.min = zmin;
+			if (zmax > Ctrl->L.max) Ctrl->L.max = zmax;
+			mean += zsum;
+			sd += zsum2;
+		}
 		G[0]->header->z_min = Ctrl->L.min;
 		G[0]->header->z_max = Ctrl->L.max;
 	}
@@ -850,14 +857,13 @@ EXTERN_MSC int GMT_grd2cpt (void *V_API, int mode, void *args) {
 			cdf_cpt[j].f = 0.0;
 		else if (cdf_cpt[j].z >= G[0]->header->z_max)
 			cdf_cpt[j].f = 1.0;
-		else {
-			nfound = 0;
+		else {	/* Evaluate the CDF from the cached per-grid sketches; each slice costs a table walk instead of a pass over every grid */
+			double n_below = 0.0;
 			for (k = 0; k < ngrd; k++) {	/* For each grid */
-				gmt_M_grd_loop (GMT, G[k], row, col, ij) {
-					if (!gmt_M_is_fnan (G[k]->data[ij]) && G[k]->data[ij] <= cdf_cpt[j].z) nfound++;
-				}
+				struct GMT_GRID_SKETCH *S = gmt_grd_sketch (GMT, G[k]);
+				n_below += gmt_grd_sketch_cdf (GMT, S, cdf_cpt[j].z) * (double)S->n;
 			}
-			cdf_cpt[j].f = (double)(nfound-1)/(double)(ngood-1);
+			cdf_cpt[j].f = (n_below - 1.0)/(double)(ngood-1);
 		}
 		GMT_Report (API, GMT_MSG_INFORMATION, format, cdf_cpt[j].z, cdf_cpt[j].f);
 	}
@@ -433,7 +433,7 @@ void place_base_triangles (struct GMT_CTRL *GMT, FILE *fp, struct GMT_GRID *G, b
 #define Return(code) {Free_Ctrl (GMT, Ctrl); gmt_end_module (GMT, GMT_cpy); bailout (code);}
 
 EXTERN_MSC int GMT_grd2xyz (void *V_API, int mode, void *args) {
-	bool first = true, first_geo = true, first_grd = true;
+	bool first = true, first_geo = true, first_grd = true, bulk_skip = false;
 	openmp_int row, col;
 	unsigned int n_output, w_col = 3, orig_mode;
 	int error = 0, write_error = 0;
@@ -820,7 +820,21 @@ EXTERN_MSC int GMT_grd2xyz (void *V_API, int mode, void *args) {
 				first = false;
 			}
 
+			/* If plain -s just suppresses records whose z is NaN then we can skip entire runs of NaN nodes
+			 * in bulk without formatting each record; masked grids are often dominated by such runs.  Must
+			 * pass on this if -L, -do or -qo change how individual records are treated or counted. */
+			bulk_skip = (GMT->common.s.active && GMT->current.setting.io_nan_mode == GMT_IO_NAN_SKIP
+				&& GMT->current.io.io_nan_ncols == 1 && GMT->current.io.io_nan_col[0] == ((Ctrl->F.mode == 2) ? GMT_Y : GMT_Z)
+				&& !GMT->common.d.active[GMT_OUT] && !Ctrl->L.active && !GMT->common.q.active[GMT_OUT]);
+
 			gmt_M_grd_loop (GMT, G, row, col, ij) {
+				if (bulk_skip && gmt_M_is_fnan (G->data[ij])) {	/* Start of a NaN run; -s will suppress every one of these nodes */
+					openmp_int last = col;
+					while (last < (openmp_int)(G->header->n_columns - 1) && gmt_M_is_fnan (G->data[ij+1])) last++, ij++;
+					n_suppressed += last - col + 1;
+					col = last;	/* Resume the loop after the run ends */
+					continue;
+				}
 				if (Ctrl->L.active) {	/* Limit output to one row or column */
 					if (Ctrl->L.mode == GRD2XYZ_ROW && (int)row != Ctrl->L.item) continue;	/* Skip these rows */
 					if (Ctrl->L.mode == GRD2XYZ_COL && (int)col != Ctrl->L.item) continue;	/* Skip these columns */
@@ -104,6 +104,19 @@ struct GRDBLEND_INFO {	/* Structure with info about each input grid file */
 	gmt_grdfloat *z;					/* Row vector holding the current row from this file */
 };
 
+struct GRDBLEND_ORDER {	/* Entry in the streaming schedule set up by grdblend_build_schedule */
+	int start_row;		/* First output row this grid contributes to (its out_j0) */
+	unsigned int k;		/* Index into the array of GRDBLEND_INFO structures */
+};
+
+struct GRDBLEND_SCHED {	/* Streaming scheduler so each output row only visits the grids whose row range overlaps it */
+	unsigned int next;	/* Next entry in order[] that has not yet been admitted to the active set */
+	unsigned int n_order;	/* Number of entries in order[] (i.e., grids not flagged as ignore) */
+	unsigned int n_active;	/* Current number of entries in active[] */
+	unsigned int *active;	/* Indices of the grids overlapping the current output row, kept in input order */
+	struct GRDBLEND_ORDER *order;	/* All scheduled grids sorted by first contributing output row */
+};
+
 #define N_NOT_SUPPORTED	8
 
 GMT_LOCAL int grdblend_found_unsupported_format (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *h, char *file) {
@@ -573,14 +586,54 @@ GMT_LOCAL int grdblend_init_blend_job(struct GMT_CTRL *GMT, char **files, unsign
 	return (n_files);
 }
 
-GMT_LOCAL int grdblend_sync_input_rows (struct GMT_CTRL *GMT, int row, struct GRDBLEND_INFO *B, unsigned int n_blend, double half) {
-	unsigned int k;
+GMT_LOCAL int grdblend_order_cmp (const void *p1, const void *p2) {
+	/* Sort the schedule on first contributing output row, with ties broken by input order */
+	const struct GRDBLEND_ORDER *a = p1, *b = p2;
+	if (a->start_row != b->start_row) return ((a->start_row < b->start_row) ? -1 : +1);
+	return ((a->k < b->k) ? -1 : ((a->k > b->k) ? +1 : 0));
+}
+
+GMT_LOCAL struct GRDBLEND_SCHED *grdblend_build_schedule (struct GMT_CTRL *GMT, struct GRDBLEND_INFO *B, unsigned int n_blend) {
+	/* Sort the input grids by their first contributing output row so that grdblend_sync_input_rows
+	 * can admit each grid to the active set exactly when the streaming pass reaches it, and retire
+	 * it (closing the file) once the pass moves below it.  Thus each row only examines the grids
+	 * actually overlapping it, which matters when blending hundreds of tiles into one mosaic. */
+	unsigned int k, n = 0;
+	struct GRDBLEND_SCHED *S = gmt_M_memory (GMT, NULL, 1, struct GRDBLEND_SCHED);
+	S->order  = gmt_M_memory (GMT, NULL, n_blend, struct GRDBLEND_ORDER);
+	S->active = gmt_M_memory (GMT, NULL, n_blend, unsigned int);
+	for (k = 0; k < n_blend; k++) {
+		if (B[k].ignore) continue;	/* This grid is entirely outside the region and is never scheduled */
+		B[k].outside = true;		/* Not contributing until admitted to the active set */
+		S->order[n].start_row = B[k].out_j0;
+		S->order[n].k = k;
+		n++;
+	}
+	S->n_order = n;
+	qsort (S->order, n, sizeof (struct GRDBLEND_ORDER), grdblend_order_cmp);
+	return (S);
+}
+
+GMT_LOCAL void grdblend_free_schedule (struct GMT_CTRL *GMT, struct GRDBLEND_SCHED **S) {
+	gmt_M_free (GMT, (*S)->order);
+	gmt_M_free (GMT, (*S)->active);
+	gmt_M_free (GMT, *S);
+}
+
+GMT_LOCAL int grdblend_sync_input_rows (struct GMT_CTRL *GMT, int row, struct GRDBLEND_INFO *B, struct GRDBLEND_SCHED *S, double half) {
+	unsigned int i, j, k;
 	int G_row;
 	uint64_t node;
 
-	for (k = 0; k < n_blend; k++) {	/* Get every input grid ready for the new row */
-		if (B[k].ignore) continue;	/* This grid is not even inside our area */
-		if (row < B[k].out_j0 || row > B[k].out_j1) {	/* Either done with grid or haven't gotten to this range yet */
+	while (S->next < S->n_order && S->order[S->next].start_row <= row) {	/* Admit grids whose row range has now been reached */
+		k = S->order[S->next++].k;
+		for (i = S->n_active; i && S->active[i-1] > k; i--) S->active[i] = S->active[i-1];	/* Keep the active set in input order */
+		S->active[i] = k;
+		S->n_active++;
+	}
+	for (i = 0; i < S->n_active; i++) {	/* Get each active input grid ready for the new row */
+		k = S->active[i];
+		if (row > B[k].out_j1) {	/* Done with this grid; close it and retire it from the active set */
 			B[k].outside = true;
 			if (B[k].open) {	/* If an open file then we wipe */
 				gmtlib_close_grd (GMT, B[k].G);	/* Close the grid file */
@@ -591,6 +644,9 @@ GMT_LOCAL int grdblend_sync_input_rows (struct GMT_CTRL *GMT, int row, struct GR
 				if (B[k].delete && gmt_remove_file (GMT, B[k].file))	/* Delete the temporary resampled file, but it failed */
 					GMT_Report (GMT->parent, GMT_MSG_ERROR, "Failed to delete file %s\n", B[k].file);
 			}
+			S->n_active--;
+			for (j = i; j < S->n_active; j++) S->active[j] = S->active[j+1];
+			i--;
 			continue;
 		}
 		B[k].outside = false;		/* Here we know the row is inside this grid */
@@ -833,7 +889,7 @@ GMT_LOCAL bool grdblend_got_plot_domain (struct GMTAPI_CTRL *API, const char *fi
 #define Return(code) {Free_Ctrl (GMT, Ctrl); gmt_end_module (GMT, GMT_cpy); bailout (code);}
 
 EXTERN_MSC int GMT_grdblend (void *V_API, int mode, void *args) {
-	unsigned int col, row, nx_360 = 0, k, kk, m, n_blend, nx_final, ny_final, out_case;
+	unsigned int col, row, nx_360 = 0, k, kk, m, q, n_blend, nx_final, ny_final, out_case;
 	int status, pcol, err, error;
 	bool reformat, wrap_x, write_all_at_once = false, first_grid, delayed = true, not_nan;
 
@@ -845,6 +901,7 @@ EXTERN_MSC int GMT_grdblend (void *V_API, int mode, void *args) {
 	char *outfile = NULL, outtemp[PATH_MAX];
 
 	struct GRDBLEND_INFO *blend = NULL;
+	struct GRDBLEND_SCHED *sched = NULL;
 	struct GMT_GRID *Grid = NULL;
 	struct GMT_GRID_HEADER_HIDDEN *HH = NULL;
 	struct GMT_GRID_HEADER *h_region = NULL;
@@ -1000,11 +1057,13 @@ EXTERN_MSC int GMT_grdblend (void *V_API, int mode, void *args) {
 	wrap_x = (gmt_M_x_is_lon (GMT, GMT_OUT));	/* Periodic geographic grid */
 	if (wrap_x) nx_360 = urint (360.0 * HH->r_inc[GMT_X]);
 
+	sched = grdblend_build_schedule (GMT, blend, n_blend);	/* Sort the grids by first contributing row for the streaming pass */
+
 	for (row = 0; row < Grid->header->n_rows; row++) {	/* For every output row */
 
 		gmt_M_memset (z, Grid->header->n_columns, gmt_grdfloat);	/* Start from scratch */
 
-		status = grdblend_sync_input_rows (GMT, row, blend, n_blend, Grid->header->xy_off);	/* Wind each input file to current record and read each of the overlapping rows */
+		status = grdblend_sync_input_rows (GMT, row, blend, sched, Grid->header->xy_off);	/* Wind each input file to current record and read each of the overlapping rows */
 		if (status) {
 			gmt_M_free (GMT, z);
 			Return (status);
@@ -1015,9 +1074,8 @@ EXTERN_MSC int GMT_grdblend (void *V_API, int mode, void *args) {
 			w = 0.0;	/* Reset weight */
 			first_grid = true;	/* Since some grids do not contain this (row,col) we want to know when we are processing the first grid inside */
 			not_nan = false;	/* Will be true once the first grid that has a non-NaN node is encountered for this (row,col); */
-			for (k = m = 0; k < n_blend; k++) {	/* Loop over every input grid; m will be the number of contributing grids to this node  */
-				if (blend[k].ignore) continue;					/* This grid is entirely outside the s/n range */
-				if (blend[k].outside) continue;					/* This grid is currently outside the s/n range */
+			for (q = m = 0; q < sched->n_active; q++) {	/* Loop over the grids overlapping this row; m will be the number of contributing grids to this node  */
+				k = sched->active[q];					/* Current grid, in input order so -Cf|l pick the same grid as before */
 				if (wrap_x) {	/* Special testing for periodic x coordinates */
 					pcol = col + nx_360;
 					while (pcol > blend[k].out_i1) pcol -= nx_360;
@@ -1148,6 +1206,7 @@ EXTERN_MSC int GMT_grdblend (void *V_API, int mode, void *args) {
 		}
 	}
 
+	grdblend_free_schedule (GMT, &sched);
 	gmt_M_free (GMT, blend);
 
 	if (reformat) {	/* Must reformat the output grid to the non-supported format */
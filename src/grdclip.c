@@ -129,6 +129,49 @@ GMT_LOCAL int grdclip_compare_classes (const void *point_1v, const void *point_2
 	return (0);
 }
 
+struct GRDCLIP_ROW_JOB {	/* Carries the clip settings and counters through gmt_grd_row_pipeline */
+	struct GRDCLIP_CTRL *Ctrl;
+	uint64_t n_above, n_below;
+};
+
+GMT_LOCAL void grdclip_clip_row (struct GMT_CTRL *GMT, gmt_grdfloat *z, unsigned int n_columns, unsigned int row_no, void *arg) {
+	/* Apply the -S selections to one grid row; mirrors the in-core loop in GMT_grdclip below */
+	unsigned int col, k;
+	bool go;
+	struct GRDCLIP_ROW_JOB *job = arg;
+	struct GRDCLIP_CTRL *Ctrl = job->Ctrl;
+	gmt_M_unused (GMT);	gmt_M_unused (row_no);
+	for (col = 0; col < n_columns; col++) {
+		/* Checking if extremes are exceeded (need not check NaN) */
+		if (Ctrl->S.mode & GRDCLIP_ABOVE && z[col] > Ctrl->S.high) {
+			z[col] = Ctrl->S.above;
+			job->n_above++;
+		}
+		else if (Ctrl->S.mode & GRDCLIP_ABOVE_OR_EQUAL && z[col] >= Ctrl->S.high) {
+			z[col] = Ctrl->S.above;
+			job->n_above++;
+		}
+		else if (Ctrl->S.mode & GRDCLIP_BELOW && z[col] < Ctrl->S.low) {
+			z[col] = Ctrl->S.below;
+			job->n_below++;
+		}
+		else if (Ctrl->S.mode & GRDCLIP_BELOW_OR_EQUAL && z[col] <= Ctrl->S.low) {
+			z[col] = Ctrl->S.below;
+			job->n_below++;
+		}
+		else if (Ctrl->S.mode & GRDCLIP_BETWEEN) {	/* Intervals */
+			for (k = 0, go = true; go && k < Ctrl->S.n_class; k++) {
+				if ((Ctrl->S.class[k].replace && gmt_M_is_fnan (Ctrl->S.class[k].low) && gmt_M_is_fnan (z[col])) || \
+				   (z[col] >= Ctrl->S.class[k].low && z[col] <= Ctrl->S.class[k].high)) {
+					z[col] = Ctrl->S.class[k].between;
+					Ctrl->S.class[k].n_between++;
+					go = false;
+				}
+			}
+		}
+	}
+}
+
 static int parse (struct GMT_CTRL *GMT, struct GRDCLIP_CTRL *Ctrl, struct GMT_OPTION *options) {
 	/* This parses the options provided to grdcut and sets parameters in CTRL.
 	 * Any GMT common options will override values set previously by other commands.
@@ -299,9 +342,11 @@ EXTERN_MSC int GMT_grdclip (void *V_API, int mode, void *args) {
 	openmp_int row, col;
 	unsigned int k;
 	int error = 0;
-	bool new_grid, go = false;
+	bool new_grid, go = false, streamed = false;
+
+	uint64_t n_above = 0, n_below = 0;
 
-	uint64_t ij, n_above = 0, n_below = 0;
+	gmt_grdfloat *zp = NULL, *zo = NULL;
 
 	double wesn[4];
 
@@ -331,54 +376,74 @@ EXTERN_MSC int GMT_grdclip (void *V_API, int mode, void *args) {
 	GMT_Report (API, GMT_MSG_INFORMATION, "Processing input grid\n");
 	gmt_M_memcpy (wesn, GMT->common.R.wesn, 4, double);	/* Current -R setting, if any */
 
-	if ((G = GMT_Read_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_CONTAINER_ONLY, NULL, Ctrl->In.file, NULL)) == NULL) {
-		Return (API->error);
-	}
-	if (gmt_M_is_subset (GMT, G->header, wesn)) {	/* Subset requested; make sure wesn matches header spacing */
-		if ((error = gmt_M_err_fail (GMT, gmt_adjust_loose_wesn (GMT, wesn, G->header), "")))
+	if (!GMT->common.R.active[RSET] && !gmt_M_file_is_remote (Ctrl->In.file)) {	/* Full-grid transform of a local file; try to stream it row-by-row */
+		struct GRDCLIP_ROW_JOB job;
+		gmt_M_memset (&job, 1, struct GRDCLIP_ROW_JOB);
+		job.Ctrl = Ctrl;
+		if ((error = gmt_grd_row_pipeline (GMT, Ctrl->In.file, Ctrl->G.file, options, grdclip_clip_row, &job)) == GMT_NOERROR) {
+			streamed = true;
+			n_above = job.n_above;	n_below = job.n_below;
+		}
+		else if (error != GMT_GRDIO_UNKNOWN_FORMAT) {	/* Streaming was attempted but failed for real */
 			Return (error);
+		}
+		else	/* No row-by-row i/o for one of the grid formats involved */
+			GMT_Report (API, GMT_MSG_DEBUG, "Row-by-row i/o not available here; reading entire grid instead\n");
 	}
-	if (GMT_Read_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_DATA_ONLY, wesn, Ctrl->In.file, G) == NULL) {
-		Return (API->error);	/* Get subset */
-	}
-
-	new_grid = gmt_set_outgrid (GMT, Ctrl->In.file, false, 0, G, &Out);	/* true if input is a read-only array */
 
-	gmt_M_grd_loop (GMT, G, row, col, ij) {
-		/* Checking if extremes are exceeded (need not check NaN) */
-		if (Ctrl->S.mode & GRDCLIP_ABOVE && G->data[ij] > Ctrl->S.high) {
-			Out->data[ij] = Ctrl->S.above;
-			n_above++;
-		}
-		else if (Ctrl->S.mode & GRDCLIP_ABOVE_OR_EQUAL && G->data[ij] >= Ctrl->S.high) {
-			Out->data[ij] = Ctrl->S.above;
-			n_above++;
+	if (!streamed) {	/* Must read the entire grid, clip in memory, then write the result */
+		if ((G = GMT_Read_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_CONTAINER_ONLY, NULL, Ctrl->In.file, NULL)) == NULL) {
+			Return (API->error);
 		}
-		else if (Ctrl->S.mode & GRDCLIP_BELOW && G->data[ij] < Ctrl->S.low) {
-			Out->data[ij] = Ctrl->S.below;
-			n_below++;
+		if (gmt_M_is_subset (GMT, G->header, wesn)) {	/* Subset requested; make sure wesn matches header spacing */
+			if ((error = gmt_M_err_fail (GMT, gmt_adjust_loose_wesn (GMT, wesn, G->header), "")))
+				Return (error);
 		}
-		else if (Ctrl->S.mode & GRDCLIP_BELOW_OR_EQUAL && G->data[ij] <= Ctrl->S.low) {
-			Out->data[ij] = Ctrl->S.below;
-			n_below++;
+		if (GMT_Read_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_DATA_ONLY, wesn, Ctrl->In.file, G) == NULL) {
+			Return (API->error);	/* Get subset */
 		}
-		else if (Ctrl->S.mode & GRDCLIP_BETWEEN) {	/* Intervals */
-			for (k = 0, go = true; go && k < Ctrl->S.n_class; k++) {
-				if ((Ctrl->S.class[k].replace && gmt_M_is_fnan (Ctrl->S.class[k].low) && gmt_M_is_fnan (G->data[ij])) || \
-				   (G->data[ij] >= Ctrl->S.class[k].low && G->data[ij] <= Ctrl->S.class[k].high)) {
-					Out->data[ij] = Ctrl->S.class[k].between;
-					Ctrl->S.class[k].n_between++;
-					go = false;
+
+		new_grid = gmt_set_outgrid (GMT, Ctrl->In.file, false, 0, G, &Out);	/* true if input is a read-only array */
+
+		gmt_M_grd_span_loop (GMT, G, row, zp) {	/* Process one contiguous row span at a time */
+			zo = Out->data + (zp - G->data);	/* Out shares G's layout so the offset carries over */
+			for (col = 0; col < (openmp_int)G->header->n_columns; col++) {
+				/* Checking if extremes are exceeded (need not check NaN) */
+				if (Ctrl->S.mode & GRDCLIP_ABOVE && zp[col] > Ctrl->S.high) {
+					zo[col] = Ctrl->S.above;
+					n_above++;
+				}
+				else if (Ctrl->S.mode & GRDCLIP_ABOVE_OR_EQUAL && zp[col] >= Ctrl->S.high) {
+					zo[col] = Ctrl->S.above;
+					n_above++;
+				}
+				else if (Ctrl->S.mode & GRDCLIP_BELOW && zp[col] < Ctrl->S.low) {
+					zo[col] = Ctrl->S.below;
+					n_below++;
 				}
+				else if (Ctrl->S.mode & GRDCLIP_BELOW_OR_EQUAL && zp[col] <= Ctrl->S.low) {
+					zo[col] = Ctrl->S.below;
+					n_below++;
+				}
+				else if (Ctrl->S.mode & GRDCLIP_BETWEEN) {	/* Intervals */
+					for (k = 0, go = true; go && k < Ctrl->S.n_class; k++) {
+						if ((Ctrl->S.class[k].replace && gmt_M_is_fnan (Ctrl->S.class[k].low) && gmt_M_is_fnan (zp[col])) || \
+						   (zp[col] >= Ctrl->S.class[k].low && zp[col] <= Ctrl->S.class[k].high)) {
+							zo[col] = Ctrl->S.class[k].between;
+							Ctrl->S.class[k].n_between++;
+							go = false;
+						}
+					}
+				}
+				else if (new_grid)
+					zo[col] = zp[col];
 			}
 		}
-		else if (new_grid)
-			Out->data[ij] = G->data[ij];
-	}
 
-	if (GMT_Set_Comment (API, GMT_IS_GRID, GMT_COMMENT_IS_OPTION | GMT_COMMENT_IS_COMMAND, options, Out)) Return (API->error);
-	if (GMT_Write_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_CONTAINER_AND_DATA, NULL, Ctrl->G.file, Out) != GMT_NOERROR) {
-		Return (API->error);
+		if (GMT_Set_Comment (API, GMT_IS_GRID, GMT_COMMENT_IS_OPTION | GMT_COMMENT_IS_COMMAND, options, Out)) Return (API->error);
+		if (GMT_Write_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_CONTAINER_AND_DATA, NULL, Ctrl->G.file, Out) != GMT_NOERROR) {
+			Return (API->error);
+		}
 	}
 
 	if (gmt_M_is_verbose (GMT, GMT_MSG_WARNING)) {
@@ -857,6 +857,8 @@ EXTERN_MSC int GMT_grdcontour (void *V_API, int mode, void *args) {
 	unsigned int id, n_contours, n_edges, tbl_scl = 1, io_mode = 0, uc, tbl, label_mode = 0, n_cont_attempts = 0;
 	unsigned int cont_counts[2] = {0, 0}, i, n, nn, *edge = NULL, n_tables = 1, fmt[3] = {0, 0, 0};
 
+	openmp_int row, col;
+
 	uint64_t ij, *n_seg = NULL;
 	int64_t ns;
 
@@ -1476,9 +1478,15 @@ EXTERN_MSC int GMT_grdcontour (void *V_API, int mode, void *args) {
 
 		/* New approach to avoid round-off */
 
-		for (ij = 0; ij < G->header->size; ij++) {
-			G->data[ij] = G_orig->data[ij] - (gmt_grdfloat)cval;		/* If there are NaNs they will remain NaNs */
-			if (G->data[ij] == 0.0) G->data[ij] += (gmt_grdfloat)small;	  /* There will be no actual zero-values, just -ve and +ve values */
+#ifdef _OPENMP
+#pragma omp parallel for private(row,col,ij) shared(G,G_orig,cval,small)
+#endif
+		for (row = 0; row < (openmp_int)G->header->my; row++) {	/* Also process the pad since the tracer expects it to be set */
+			ij = (uint64_t)row * G->header->mx;
+			for (col = 0; col < (openmp_int)G->header->mx; col++, ij++) {
+				G->data[ij] = G_orig->data[ij] - (gmt_grdfloat)cval;		/* If there are NaNs they will remain NaNs */
+				if (G->data[ij] == 0.0) G->data[ij] += (gmt_grdfloat)small;	  /* There will be no actual zero-values, just -ve and +ve values */
+			}
 		}
 
 		if (Ctrl->W.cpt_effect) {
@@ -333,7 +333,7 @@ EXTERN_MSC int GMT_grdconvert (void *V_API, int mode, void *args) {
 		strcpy (Grid->header->x_units, "x_units");
 		strcpy (Grid->header->y_units, "y_units");
 	}
-	if (Ctrl->Z.active) {	/* Apply given scale/offset before writing */
+	if (Ctrl->Z.active && !(Ctrl->Z.scale == 1.0 && Ctrl->Z.offset == 0.0)) {	/* Apply given scale/offset before writing; skip the pass if it is a no-op */
 		/* Since gmt_scale_and_offset_f applies z' = z * scale + offset we must adjust Z.offset first: */
 		Ctrl->Z.offset *= Ctrl->Z.scale;
 		gmt_scale_and_offset_f (GMT, Grid->data, Grid->header->size, Ctrl->Z.scale, -Ctrl->Z.offset);
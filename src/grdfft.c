@@ -363,6 +363,56 @@ GMT_LOCAL int grdfft_do_spectrum (struct GMT_CTRL *GMT, struct GMT_GRID *GridX,
 
 	r_delta_k = 1.0 / delta_k;
 
+#ifdef _OPENMP
+	{	/* Several wavenumbers fall in the same bin, so each thread sums into its own scratch bins which are then merged */
+		int tid, n_threads = omp_get_max_threads ();
+		int64_t kj;
+		uint64_t b, base;
+		double *X_pow_t = gmt_M_memory (GMT, NULL, (uint64_t)n_threads * nk, double);
+		double *Y_pow_t = NULL, *co_spec_t = NULL, *quad_spec_t = NULL;
+		uint64_t *nused_t = gmt_M_memory (GMT, NULL, (uint64_t)n_threads * nk, uint64_t);
+		if (GridY) {
+			Y_pow_t     = gmt_M_memory (GMT, NULL, (uint64_t)n_threads * nk, double);
+			co_spec_t   = gmt_M_memory (GMT, NULL, (uint64_t)n_threads * nk, double);
+			quad_spec_t = gmt_M_memory (GMT, NULL, (uint64_t)n_threads * nk, double);
+		}
+#pragma omp parallel for private(kj,k,freq,ifreq,base) shared(GridX,GridY,K,X,Y,r_delta_k,nk,X_pow_t,nused_t,Y_pow_t,co_spec_t,quad_spec_t)
+		for (kj = 2; kj < (int64_t)GridX->header->size; kj += 2) {
+			k = (uint64_t)kj;
+			freq = gmt_fft_get_wave (k, K);
+			ifreq = lrint (fabs (freq) * r_delta_k);	/* Smallest value returned might be 0 when doing r spectrum*/
+			if (ifreq > 0) --ifreq;
+			if (ifreq >= nk) continue;	/* Might happen when doing r spectrum  */
+			base = (uint64_t)omp_get_thread_num () * nk + ifreq;
+			X_pow_t[base]     += (X[k]   * X[k] + X[k+1] * X[k+1]);	/* X x X* = Power of grid X */
+			nused_t[base]++;
+			if (GridY) {	/* For cross-spectral estimates */
+				Y_pow_t[base]     += (Y[k]   * Y[k] + Y[k+1] * Y[k+1]);	/* Y x Y* = Power of grid Y */
+				co_spec_t[base]   += (Y[k]   * X[k] + Y[k+1] * X[k+1]);	/* Real part of Y x X* */
+				quad_spec_t[base] += (X[k+1] * Y[k] - Y[k+1] * X[k]);	/* Imag part of Y x X* */
+			}
+		}
+		for (tid = 0; tid < n_threads; tid++) {	/* Merge the per-thread bins */
+			base = (uint64_t)tid * nk;
+			for (b = 0; b < nk; b++) {
+				X_pow[b] += X_pow_t[base+b];
+				nused[b] += nused_t[base+b];
+				if (GridY) {
+					Y_pow[b]     += Y_pow_t[base+b];
+					co_spec[b]   += co_spec_t[base+b];
+					quad_spec[b] += quad_spec_t[base+b];
+				}
+			}
+		}
+		gmt_M_free (GMT, X_pow_t);
+		gmt_M_free (GMT, nused_t);
+		if (GridY) {
+			gmt_M_free (GMT, Y_pow_t);
+			gmt_M_free (GMT, co_spec_t);
+			gmt_M_free (GMT, quad_spec_t);
+		}
+	}
+#else
 	for (k = 2; k < GridX->header->size; k += 2) {
 		freq = gmt_fft_get_wave (k, K);
 		ifreq = lrint (fabs (freq) * r_delta_k);	/* Smallest value returned might be 0 when doing r spectrum*/
@@ -376,6 +426,7 @@ GMT_LOCAL int grdfft_do_spectrum (struct GMT_CTRL *GMT, struct GMT_GRID *GridX,
 			quad_spec[ifreq] += (X[k+1] * Y[k] - Y[k+1] * X[k]);	/* Imag part of Y x X* */
 		}
 	}
+#endif
 
 	gmt_set_cartesian (GMT, GMT_OUT);	/* To counter-act any -fg setting */
 
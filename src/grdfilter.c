@@ -177,6 +177,8 @@ enum Grdfilter_mode {
 #define NAN_REPLACE	1
 #define NAN_PRESERVE	2
 
+#define GRDFILTER_FFT_MIN_WINDOW	10000	/* Switch convolution filters to the FFT backend when the weight matrix has at least this many nodes */
+
 
 struct FILTER_INFO {
 	unsigned int filter_type;
@@ -244,9 +246,9 @@ static void Free_Ctrl (struct GMT_CTRL *GMT, struct GRDFILTER_CTRL *C) {	/* Deal
 
 #ifdef HAVE_GLIB_GTHREAD
 /* -----------------------------------------------------------------------------------*/
-GMT_LOCAL void *grdfilter_thread_function (void *args) {
+GMT_LOCAL void grdfilter_thread_function (void *args) {
+	/* Task entry point when rows are farmed out via the session thread pool */
 	grdfilter_threaded_function ((struct THREAD_STRUCT *)args);
-	return NULL;
 }
 #endif
 
@@ -374,6 +376,170 @@ GMT_LOCAL double grdfilter_histmode_weighted (struct GMT_CTRL *GMT, struct GMT_O
 	return (value);
 }
 
+GMT_LOCAL double grdfilter_histmode_counts (unsigned int *count, struct GRDFILTER_BIN_MODE_INFO *B) {
+	/* Pick the mode from an already filled bin count array, using the same
+	 * multi-mode bookkeeping and tie-breaking as grdfilter_histmode so that the
+	 * incremental sliding-window path below returns identical estimates. */
+
+	double value = 0.0;
+	unsigned int n_modes = 0, mode_count = 0, ubin;
+	int mode_bin = 0;
+	bool done;
+
+	for (ubin = 0; ubin < B->n_bins; ubin++) {	/* Find the maximum count and how many bins reach it */
+		if (count[ubin] > mode_count) {	/* New max count value; make a note */
+			mode_count = count[ubin];	/* Highest count so far... */
+			mode_bin = (int)ubin;		/* ...occurring for this bin */
+			n_modes = 1;			/* Only one of these so far */
+		}
+		else if (mode_count && count[ubin] == mode_count) n_modes++;	/* Bin has same peak as previous best mode; increase mode count */
+	}
+	if (n_modes == 1) {	/* Single mode; we are done */
+		value = ((mode_bin + B->min) + B->o_offset) * B->width;
+		return (value);
+	}
+
+	/* Here we found more than one mode and must choose according to settings */
+
+	for (ubin = 0, done = false; !done && ubin < B->n_bins; ubin++) {	/* Loop over bin counts */
+		if (count[ubin] < mode_count) continue;	/* Not one of the modes */
+		switch (B->mode_choice) {
+			case GRDFILTER_MODE_KIND_LOW:	/* Pick lowest mode; we are done */
+				value = ((ubin + B->min) + B->o_offset) * B->width;
+				done = true;
+				break;
+			case GRDFILTER_MODE_KIND_AVE:		/* Get the average of the modes */
+				value += ((ubin + B->min) + B->o_offset) * B->width;
+				break;
+			case GRDFILTER_MODE_KIND_HIGH:	/* Update highest mode so far, when loop exits we have the highest mode */
+			 	value = ((ubin + B->min) + B->o_offset) * B->width;
+				break;
+		}
+	}
+	if (B->mode_choice == GRDFILTER_MODE_KIND_AVE && n_modes > 0) value /= n_modes;	/* The average of the multiple modes */
+
+	return (value);
+}
+
+GMT_LOCAL void grdfilter_hist_update (struct GMT_GRID *Gin, struct GRDFILTER_BIN_MODE_INFO *B, unsigned int *count, int row_in, int col_lo, int col_hi, int dir, unsigned int *n_in_win, unsigned int *n_nan_win) {
+	/* Enter (dir = +1) or remove (dir = -1) input columns col_lo through col_hi of input row
+	 * row_in from the running window histogram.  Unsigned wrap-around on dir = -1 is fine
+	 * since no count can logically go negative. */
+
+	int col_in, bin;
+	uint64_t ij_in;
+
+	for (col_in = col_lo; col_in <= col_hi; col_in++) {
+		ij_in = gmt_M_ijp (Gin->header, row_in, col_in);
+		if (gmt_M_is_fnan (Gin->data[ij_in])) {	/* NaNs are not binned but -Np needs to know about them */
+			*n_nan_win += dir;
+			continue;
+		}
+		bin = irint (floor ((Gin->data[ij_in] * B->i_width) + B->i_offset)) - B->min;
+		count[bin] += dir;
+		*n_in_win += dir;
+	}
+}
+
+GMT_LOCAL bool grdfilter_hist_sliding (struct THREAD_STRUCT *t, double *weight) {
+	/* Incremental sliding-window histogram for the -Fp filter (the classic fast median/mode
+	 * trick): instead of rebuilding the histogram from all points inside the filter footprint
+	 * for every output node we maintain running bin counts for the window and, as the window
+	 * slides one output column to the right, subtract the input columns that leave on the west
+	 * side and add those that enter on the east side.  Per-node cost drops from O(window area)
+	 * to O(window height).  This requires that the footprint is fixed for the entire grid
+	 * (effort_level 1), does not wrap around the globe, and that the window origin advances by
+	 * a constant number of input columns per output column; the positive-weight region on each
+	 * filter row must also be a contiguous span symmetric about the center column.  Returns
+	 * false (before any output is touched) if any requirement fails so that the caller can
+	 * fall back on the general engine.  Since binning a point is order-independent and the
+	 * mode extraction matches grdfilter_histmode, the result is identical to the slow path. */
+
+	unsigned int row_out, col_out, n_in_win, n_nan_win, n_nan = 0, *count = NULL;
+	int ii, jj, s, stride = 0, row_origin, row_in, o_new, o_prev, lo, hi, last_col, last_row, *span = NULL;
+	uint64_t ij_out;
+	double y_out;
+	struct GMT_CTRL *GMT        = t->GMT;
+	struct GRDFILTER_CTRL *Ctrl = t->Ctrl;
+	struct GMT_GRID *Gin        = t->Gin;
+	struct GMT_GRID *Gout       = t->Gout;
+	struct FILTER_INFO F        = t->F;
+	struct GRDFILTER_BIN_MODE_INFO *B = t->B;
+	int *col_origin             = t->col_origin;
+
+#ifdef DEBUG
+	if (Ctrl->A.active) return (false);	/* Debugging single nodes requires the general engine */
+#endif
+	if (Gout->header->n_columns > 1) {	/* Window origin must advance uniformly along the row */
+		stride = col_origin[1] - col_origin[0];
+		if (stride < 1) return (false);
+		for (col_out = 2; col_out < Gout->header->n_columns; col_out++)
+			if (col_origin[col_out] - col_origin[col_out-1] != stride) return (false);
+	}
+	span = gmt_M_memory (GMT, NULL, 2 * F.y_half_width + 1, int);
+	for (jj = -F.y_half_width; jj <= F.y_half_width; jj++) {	/* Find the half-span of positive weights on each filter row */
+		for (s = -1, ii = 0; ii <= F.x_half_width; ii++)
+			if (weight[WT_IJ (F, jj, ii)] > 0.0) s = ii;
+		for (ii = -F.x_half_width; ii <= F.x_half_width; ii++) {	/* Must be a contiguous span symmetric about ii = 0 */
+			if ((weight[WT_IJ (F, jj, ii)] > 0.0) != (abs (ii) <= s)) {
+				gmt_M_free (GMT, span);
+				return (false);
+			}
+		}
+		span[jj+F.y_half_width] = s;	/* Row takes part via columns origin - s through origin + s [-1 means no part] */
+	}
+
+	count = gmt_M_memory (GMT, NULL, B->n_bins, unsigned int);	/* Private bin counts so threads do not share B->icount */
+	last_col = (int)Gin->header->n_columns - 1;	last_row = (int)Gin->header->n_rows - 1;
+
+	for (row_out = t->r_start; row_out < t->r_stop; row_out++) {
+
+		if (GMT->parent->cancel) break;	/* The embedder has asked us to stop; unfinished rows are discarded by main() */
+		if (t->thread_num == 0)	/* The strips are equal so thread 0's fraction approximates the whole run */
+			GMT->parent->progress = (double)(row_out - t->r_start) / (t->r_stop - t->r_start);
+		GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "Processing output line %d\n", row_out);
+		y_out = gmt_M_grd_row_to_y (GMT, row_out, Gout->header);		/* Current output y [or latitude] */
+		row_origin = (int)gmt_M_grd_y_to_row (GMT, y_out, Gin->header);		/* Closest row in input grid */
+		gmt_M_memset (count, B->n_bins, unsigned int);	/* Fresh histogram for the first window on this row */
+		n_in_win = n_nan_win = 0;
+
+		for (col_out = 0; col_out < Gout->header->n_columns; col_out++) {
+			o_new = col_origin[col_out];
+			for (jj = -F.y_half_width; jj <= F.y_half_width; jj++) {	/* Update the window, one input row at a time */
+				if ((s = span[jj+F.y_half_width]) < 0) continue;	/* No positive weights on this filter row */
+				row_in = row_origin + jj;		/* Current input data row number */
+				if (row_in < 0 || row_in > last_row) continue;	/* Outside input y-range */
+				if (col_out == 0)	/* Enter the entire initial window */
+					grdfilter_hist_update (Gin, B, count, row_in, MAX (0, o_new - s), MIN (last_col, o_new + s), +1, &n_in_win, &n_nan_win);
+				else {	/* Slide: remove what leaves on the west side, add what enters on the east side */
+					o_prev = o_new - stride;
+					lo = MAX (0, o_prev - s);	hi = MIN (last_col, MIN (o_prev + s, o_new - s - 1));
+					if (lo <= hi) grdfilter_hist_update (Gin, B, count, row_in, lo, hi, -1, &n_in_win, &n_nan_win);
+					lo = MAX (0, MAX (o_new - s, o_prev + s + 1));	hi = MIN (last_col, o_new + s);
+					if (lo <= hi) grdfilter_hist_update (Gin, B, count, row_in, lo, hi, +1, &n_in_win, &n_nan_win);
+				}
+			}
+			ij_out = gmt_M_ijp (Gout->header, row_out, col_out);	/* Node of current output point */
+			if (Ctrl->N.mode == NAN_REPLACE && gmt_M_is_fnan (Gin->data[ij_out])) {
+				/* [Here we know ij_out == ij_in]. Since output will be NaN we bypass the mode estimate */
+				Gout->data[ij_out] = GMT->session.f_NaN;
+				n_nan++;
+			}
+			else if ((Ctrl->N.mode == NAN_PRESERVE && n_nan_win) || n_in_win == 0) {	/* -Np and NaNs inside the circle, or nothing found */
+				Gout->data[ij_out] = GMT->session.f_NaN;
+				n_nan++;
+			}
+			else
+				Gout->data[ij_out] = (gmt_grdfloat)grdfilter_histmode_counts (count, B);
+		}
+	}
+
+	GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Found %d NaNs\n", n_nan);
+	gmt_M_free (GMT, span);
+	gmt_M_free (GMT, count);
+	return (true);
+}
+
 GMT_LOCAL void grdfilter_reset_F_parameters (struct FILTER_INFO *F, double width, double par[]) {
 	/* Parameters computed from width and other settings */
 	double x_width, y_width;
@@ -592,6 +758,214 @@ GMT_LOCAL struct GMT_GRID *init_area_weights (struct GMT_CTRL *GMT, struct GMT_G
 	return (A);
 }
 
+GMT_LOCAL bool grdfilter_separable_filter (struct GMT_CTRL *GMT, struct GMT_GRID *Gin, struct GMT_GRID *Gout, struct FILTER_INFO *F, double par[]) {
+	/* Fast path for rectangular boxcar/Gaussian filtering of co-registered Cartesian grids.
+	 * In rect mode the 2-D weight is the product of two 1-D weights (see set_weight_matrix),
+	 * and the Cartesian area weights likewise factor into a row part and a column part (see
+	 * init_area_weights), so the filter separates exactly into an x-pass followed by a y-pass:
+	 * O(n_columns + n_rows) work per output node instead of O(n_columns * n_rows).
+	 * Returns false if the grid contains NaNs since the per-node NaN screening does not
+	 * separate; the caller must then fall back on the general engine. */
+	bool node_reg = (Gin->header->registration == GMT_GRID_NODE_REG);
+	openmp_int row, col;
+	int ii, jj, k, col_in, row_in, last_col, last_row;
+	uint64_t ij, node;
+	double *wx = NULL, *wy = NULL, *tmp = NULL, value, wt_sum, w;
+
+	gmt_M_grd_loop (GMT, Gin, row, col, ij)
+		if (gmt_M_is_fnan (Gin->data[ij])) return (false);	/* Found a NaN; must use the general engine */
+
+	wx = gmt_M_memory (GMT, NULL, 2 * F->x_half_width + 1, double);
+	wy = gmt_M_memory (GMT, NULL, 2 * F->y_half_width + 1, double);
+	tmp = gmt_M_memory (GMT, NULL, (size_t)Gin->header->n_rows * (size_t)Gin->header->n_columns, double);
+	/* Same 1-D weights as the rect branch in set_weight_matrix */
+	for (k = 0; k <= 2 * F->x_half_width; k++) wx[k] = F->weight_func ((double)(k - F->x_half_width) / F->x_half_width, par);
+	for (k = 0; k <= 2 * F->y_half_width; k++) wy[k] = F->weight_func ((double)(k - F->y_half_width) / F->y_half_width, par);
+	last_col = (int)Gin->header->n_columns - 1;	last_row = (int)Gin->header->n_rows - 1;
+
+	/* First pass: filter each row along x into the (unpadded) tmp array */
+
+#ifdef _OPENMP
+#pragma omp parallel for private(row,col,node,ii,col_in,value,wt_sum,w) shared(GMT,Gin,F,wx,tmp,last_col,node_reg)
+#endif
+	for (row = 0; row < (openmp_int)Gin->header->n_rows; row++) {
+		node = (uint64_t)row * (uint64_t)Gin->header->n_columns;
+		for (col = 0; col < (openmp_int)Gin->header->n_columns; col++) {
+			value = wt_sum = 0.0;
+			for (ii = -F->x_half_width; ii <= F->x_half_width; ii++) {
+				col_in = (int)col + ii;
+				if (col_in < 0 || col_in > last_col) continue;	/* Outside input x-range */
+				w = wx[ii + F->x_half_width];
+				if (node_reg && (col_in == 0 || col_in == last_col)) w *= 0.5;	/* Boundary column only covers half a cell */
+				value += Gin->data[gmt_M_ijp (Gin->header, row, col_in)] * w;
+				wt_sum += w;
+			}
+			tmp[node+col] = value / wt_sum;
+		}
+	}
+
+	/* Second pass: filter each column of tmp along y into the output grid */
+
+#ifdef _OPENMP
+#pragma omp parallel for private(row,col,jj,row_in,value,wt_sum,w) shared(GMT,Gin,Gout,F,wy,tmp,last_row,node_reg)
+#endif
+	for (row = 0; row < (openmp_int)Gout->header->n_rows; row++) {
+		for (col = 0; col < (openmp_int)Gout->header->n_columns; col++) {
+			value = wt_sum = 0.0;
+			for (jj = -F->y_half_width; jj <= F->y_half_width; jj++) {
+				row_in = (int)row + jj;
+				if (row_in < 0 || row_in > last_row) continue;	/* Outside input y-range */
+				w = wy[jj + F->y_half_width];
+				if (node_reg && (row_in == 0 || row_in == last_row)) w *= 0.5;	/* Boundary row only covers half a cell */
+				value += tmp[(uint64_t)row_in * (uint64_t)Gin->header->n_columns + col] * w;
+				wt_sum += w;
+			}
+			Gout->data[gmt_M_ijp (Gout->header, row, col)] = (gmt_grdfloat)(value / wt_sum);
+		}
+	}
+
+	gmt_M_free (GMT, wx);
+	gmt_M_free (GMT, wy);
+	gmt_M_free (GMT, tmp);
+	return (true);
+}
+
+GMT_LOCAL bool grdfilter_fft_filter (struct GMT_CTRL *GMT, struct GRDFILTER_CTRL *Ctrl, struct GMT_GRID *Gin, struct GMT_GRID *Gout, struct GMT_GRID *A, struct FILTER_INFO *F, double par[], double x_fix, double y_fix) {
+	/* FFT-convolution backend for the isotropic boxcar/cosine/Gaussian filters on co-registered
+	 * Cartesian grids with very large filter windows.  The weighted average computed by the
+	 * general engine at each output node is the ratio of two correlations with the fixed weight
+	 * matrix: one of area-weight times data (with NaNs zeroed) and one of area-weight alone
+	 * (zeroed where data is NaN), so both numerator and denominator can be evaluated spectrally
+	 * and the per-node renormalization over the valid nodes falls out of the division.  The
+	 * kernel is transformed once and the grid is processed in overlapping tiles (overlap-save):
+	 * each tile loads a halo of one filter half-width around its interior, outputs within the
+	 * halo are discarded, and contributions from beyond the grid edge are zero just as the
+	 * spatial loops skip them.  Per-node cost drops from O(window area) to O(log window area).
+	 * The transforms run in single precision like the rest of the FFT machinery so results match
+	 * the direct engine to float roundoff.  Returns false (before any output is touched) if the
+	 * runtime requirements fail so that the caller can fall back on the general engine. */
+	unsigned int fx, fy, interior_x, interior_y, row0, col0, r, c, n_nan = 0;
+	int ii, jj, row_in, col_in, last_col, last_row;
+	uint64_t k, node, nm;
+	double *wt = NULL, w, wt_total = 0.0, a_max = 0.0, den_eps, num, den;
+	gmt_grdfloat *K = NULL, *P = NULL, *Q = NULL;
+	struct GMT_FFT_SUGGESTION fft_sug[GMT_FFT_N_SUGGEST];
+
+	last_col = (int)Gin->header->n_columns - 1;	last_row = (int)Gin->header->n_rows - 1;
+
+	if (Ctrl->N.mode == NAN_PRESERVE) {	/* -Np needs to know exactly which windows saw a NaN; only doable spectrally if there are none */
+		openmp_int row, col;
+		uint64_t ij;
+		gmt_M_grd_loop (GMT, Gin, row, col, ij)
+			if (gmt_M_is_fnan (Gin->data[ij])) return (false);
+	}
+
+	/* Compute the fixed weight matrix once, as the effort_level 1 engine would */
+
+	wt = gmt_M_memory (GMT, NULL, (size_t)F->n_columns * (size_t)F->n_rows, double);
+	set_weight_matrix (GMT, F, wt, 0.0, par, x_fix, y_fix, 0, false);
+	for (jj = -F->y_half_width; jj <= F->y_half_width; jj++)
+		for (ii = -F->x_half_width; ii <= F->x_half_width; ii++)
+			if ((w = wt[WT_IJ ((*F), jj, ii)]) > 0.0) wt_total += w;
+	for (k = 0; k < (uint64_t)A->header->size; k++)
+		if (A->data[k] > a_max) a_max = A->data[k];
+	den_eps = GMT_CONV6_LIMIT * wt_total * a_max;	/* Smaller weight sums than this are float-roundoff zeros */
+
+	/* Pick FFT dimensions: aim for an interior comparable to the kernel but never beyond one full-grid tile */
+
+	gmtlib_suggest_fft_dim (GMT, MIN (Gin->header->n_columns + 2 * (unsigned int)F->x_half_width, 2 * F->n_columns),
+		MIN (Gin->header->n_rows + 2 * (unsigned int)F->y_half_width, 2 * F->n_rows), fft_sug, false);
+	fx = fft_sug[GMT_FFT_FAST].n_columns;	fy = fft_sug[GMT_FFT_FAST].n_rows;
+	interior_x = fx - 2 * F->x_half_width;	interior_y = fy - 2 * F->y_half_width;
+	nm = (uint64_t)fx * (uint64_t)fy;
+
+	K = gmt_M_memory (GMT, NULL, 2 * nm, gmt_grdfloat);
+	P = gmt_M_memory (GMT, NULL, 2 * nm, gmt_grdfloat);
+	Q = gmt_M_memory (GMT, NULL, 2 * nm, gmt_grdfloat);
+
+	/* Transform the kernel once, stored wrapped about the origin so the spectral product is the correlation the engine computes */
+
+	for (jj = -F->y_half_width; jj <= F->y_half_width; jj++) {
+		r = (jj <= 0) ? (unsigned int)(-jj) : fy - (unsigned int)jj;
+		for (ii = -F->x_half_width; ii <= F->x_half_width; ii++) {
+			if ((w = wt[WT_IJ ((*F), jj, ii)]) <= 0.0) continue;	/* Outside the filter circle */
+			c = (ii <= 0) ? (unsigned int)(-ii) : fx - (unsigned int)ii;
+			K[2 * ((uint64_t)r * fx + c)] = (gmt_grdfloat)w;
+		}
+	}
+	gmt_M_free (GMT, wt);
+	if (GMT_FFT_2D (GMT->parent, K, fx, fy, GMT_FFT_FWD, GMT_FFT_COMPLEX)) {
+		gmt_M_free (GMT, K);	gmt_M_free (GMT, P);	gmt_M_free (GMT, Q);
+		return (false);
+	}
+
+	GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "FFT tiles are %d x %d with %d x %d interiors\n", fx, fy, interior_x, interior_y);
+
+	for (row0 = 0; row0 < Gout->header->n_rows && !GMT->parent->cancel; row0 += interior_y) {
+		for (col0 = 0; col0 < Gout->header->n_columns; col0 += interior_x) {
+			GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "Processing tile starting at row %d, column %d\n", row0, col0);
+			gmt_M_memset (P, 2 * nm, gmt_grdfloat);
+			gmt_M_memset (Q, 2 * nm, gmt_grdfloat);
+			for (r = 0; r < fy; r++) {	/* Load the tile plus its halo; beyond-edge nodes stay zero */
+				row_in = (int)(row0 + r) - F->y_half_width;
+				if (row_in < 0 || row_in > last_row) continue;
+				for (c = 0; c < fx; c++) {
+					col_in = (int)(col0 + c) - F->x_half_width;
+					if (col_in < 0 || col_in > last_col) continue;
+					node = gmt_M_ijp (Gin->header, row_in, col_in);
+					if (gmt_M_is_fnan (Gin->data[node])) continue;	/* NaNs contribute to neither sum */
+					k = gmt_M_ijp (A->header, row_in, 1);	/* The inside point weight node at this latitude */
+					if (col_in == 0) k--;	/* Needed the left-side/west weight at this latitude */
+					else if (col_in == last_col) k++;	/* Need the right-side/east weight at this latitude */
+					Q[2 * ((uint64_t)r * fx + c)] = A->data[k];
+					P[2 * ((uint64_t)r * fx + c)] = Gin->data[node] * A->data[k];
+				}
+			}
+			if (GMT_FFT_2D (GMT->parent, P, fx, fy, GMT_FFT_FWD, GMT_FFT_COMPLEX) ||
+			    GMT_FFT_2D (GMT->parent, Q, fx, fy, GMT_FFT_FWD, GMT_FFT_COMPLEX)) goto fft_failed;
+			for (k = 0; k < nm; k++) {	/* Spectral products with the kernel */
+				gmt_grdfloat pr = P[2*k], pi = P[2*k+1], qr = Q[2*k], qi = Q[2*k+1], kr = K[2*k], ki = K[2*k+1];
+				P[2*k] = pr * kr - pi * ki;	P[2*k+1] = pr * ki + pi * kr;
+				Q[2*k] = qr * kr - qi * ki;	Q[2*k+1] = qr * ki + qi * kr;
+			}
+			if (GMT_FFT_2D (GMT->parent, P, fx, fy, GMT_FFT_INV, GMT_FFT_COMPLEX) ||
+			    GMT_FFT_2D (GMT->parent, Q, fx, fy, GMT_FFT_INV, GMT_FFT_COMPLEX)) goto fft_failed;
+			for (r = 0; r < interior_y && (row0 + r) < Gout->header->n_rows; r++) {	/* Keep the interior outputs; the halo is contaminated by wrap-around */
+				for (c = 0; c < interior_x && (col0 + c) < Gout->header->n_columns; c++) {
+					node = gmt_M_ijp (Gout->header, row0 + r, col0 + c);
+					if (Ctrl->N.mode == NAN_REPLACE && gmt_M_is_fnan (Gin->data[node])) {
+						/* [Here we know the node is co-registered in the input]. Since output will be NaN we bypass the division */
+						Gout->data[node] = GMT->session.f_NaN;
+						n_nan++;
+						continue;
+					}
+					k = 2 * (((uint64_t)r + F->y_half_width) * fx + (uint64_t)c + F->x_half_width);
+					num = P[k];	den = Q[k];
+					if (den <= den_eps) {	/* Nothing found inside circle, assign value = GMT->session.f_NaN */
+						Gout->data[node] = GMT->session.f_NaN;
+						n_nan++;
+					}
+					else	/* Safe to compute weighted average */
+						Gout->data[node] = (gmt_grdfloat)(num / den);
+				}
+			}
+		}
+	}
+
+	GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Found %d NaNs\n", n_nan);
+	gmt_M_free (GMT, K);
+	gmt_M_free (GMT, P);
+	gmt_M_free (GMT, Q);
+	return (true);
+
+fft_failed:	/* A transform failed mid-stream; the output is part-written so we cannot fall back */
+	GMT_Report (GMT->parent, GMT_MSG_ERROR, "2-D FFT failed; output grid is incomplete\n");
+	gmt_M_free (GMT, K);
+	gmt_M_free (GMT, P);
+	gmt_M_free (GMT, Q);
+	return (true);
+}
+
 static int usage (struct GMTAPI_CTRL *API, int level) {
 	const char *name = gmt_show_name_and_purpose (API, THIS_MODULE_LIB, THIS_MODULE_CLASSIC_NAME, THIS_MODULE_PURPOSE);
 	if (level == GMT_MODULE_PURPOSE) return (GMT_NOERROR);
@@ -966,9 +1340,6 @@ EXTERN_MSC int GMT_grdfilter (void *V_API, int mode, void *args) {
 	struct GMTAPI_CTRL *API = gmt_get_api_ptr (V_API);	/* Cast from void to GMTAPI_CTRL pointer */
 
 	struct THREAD_STRUCT *threadArg = NULL;
-#ifdef HAVE_GLIB_GTHREAD
-	GThread **threads = NULL;
-#endif
 
 	/*----------------------- Standard module initialization and parsing ----------------------*/
 
@@ -1312,10 +1683,18 @@ EXTERN_MSC int GMT_grdfilter (void *V_API, int mode, void *args) {
 
 	gmt_M_tic(GMT);
 
-#ifdef HAVE_GLIB_GTHREAD
-	if (GMT->common.x.n_threads > 1)
-		threads = gmt_M_memory (GMT, NULL, GMT->common.x.n_threads, GThread *);
-#endif
+	if (!Ctrl->F.custom && !Ctrl->F.varwidth && !slow && F.rect && same_grid && !Ctrl->A.active && \
+		(filter_type == GRDFILTER_BOXCAR || filter_type == GRDFILTER_GAUSSIAN) && \
+		grdfilter_separable_filter (GMT, Gin, Gout, &F, par)) {	/* Kernel separated exactly; already done via two 1-D passes */
+		GMT_Report (API, GMT_MSG_INFORMATION, "Rectangular %s filter is separable; filtered via two 1-D passes.\n", filter_name[filter_type]);
+	}
+	else if (!Ctrl->F.custom && !Ctrl->F.varwidth && !slow && !F.rect && same_grid && !Ctrl->A.active && \
+		Ctrl->D.mode == GRDFILTER_XY_CARTESIAN && (uint64_t)F.n_columns * (uint64_t)F.n_rows >= GRDFILTER_FFT_MIN_WINDOW && \
+		(filter_type == GRDFILTER_BOXCAR || filter_type == GRDFILTER_COSINE || filter_type == GRDFILTER_GAUSSIAN) && \
+		grdfilter_fft_filter (GMT, Ctrl, Gin, Gout, A, &F, par, x_fix, y_fix)) {	/* Large fixed kernel; already done spectrally in overlapping tiles */
+		GMT_Report (API, GMT_MSG_INFORMATION, "Large %s filter window; filtered via FFT convolution over tiles.\n", filter_name[filter_type]);
+	}
+	else {	/* Use the general 2-D engine */
 
 	threadArg = gmt_M_memory (GMT, NULL, GMT->common.x.n_threads, struct THREAD_STRUCT);
 
@@ -1355,20 +1734,17 @@ EXTERN_MSC int GMT_grdfilter (void *V_API, int mode, void *args) {
 #else
    		threadArg[i].r_stop = (i + 1) * irint((Gout->header->n_rows) / GMT->common.x.n_threads);
    		if (i == GMT->common.x.n_threads - 1) threadArg[i].r_stop = Gout->header->n_rows;	/* Make sure last row is not left behind */
-		threads[i] = g_thread_new(NULL, grdfilter_thread_function, (void*)&(threadArg[i]));
+		gmt_thread_pool_submit (GMT, grdfilter_thread_function, &threadArg[i]);
 	}
 
-	if (GMT->common.x.n_threads > 1) {		/* Otherwise g_thread_new was never called aand so no need to "join" */
-		for (i = 0; i < GMT->common.x.n_threads; i++)
-			g_thread_join(threads[i]);
-	}
-
-	if (GMT->common.x.n_threads > 1)
-		gmt_M_free (GMT, threads);
+	if (GMT->common.x.n_threads > 1)	/* Otherwise nothing was submitted to the pool above */
+		gmt_thread_pool_wait (GMT);
 #endif
 
 	gmt_M_free (GMT, threadArg);
 
+	}	/* End of general 2-D engine */
+
 	gmt_M_toc(GMT,"");		/* Print total run time, but only if -Vt was set */
 
 	if (!Ctrl->F.custom) gmt_M_free (GMT, weight);
@@ -1383,6 +1759,11 @@ EXTERN_MSC int GMT_grdfilter (void *V_API, int mode, void *args) {
 		GMT_Report (API, GMT_MSG_ERROR, "Failed to free A\n");
 	}
 
+	if (API->cancel) {	/* Cancellation was requested: discard the partially filtered grid and wind down cleanly */
+		GMT_Report (API, GMT_MSG_INFORMATION, "grdfilter stopped: cancellation requested via GMT_Cancel_Module\n");
+		Return (GMT_MODULE_CANCELLED);
+	}
+
 	if (n_nan) GMT_Report (API, GMT_MSG_WARNING, "Unable to estimate value at %" PRIu64 " nodes, set to NaN\n", n_nan);
 	if (GMT_n_multiples > 0) GMT_Report (API, GMT_MSG_INFORMATION, "%d separate modes found by the mode filter\n", GMT_n_multiples);
 
@@ -1508,6 +1889,13 @@ GMT_LOCAL void grdfilter_threaded_function (struct THREAD_STRUCT *t) {
 
 	if (effort_level == 1) set_weight_matrix (GMT, &F, weight, 0.0, par, x_fix, y_fix, 0, false);
 
+	if (filter_type == GRDFILTER_HIST && effort_level == 1 && !spherical && grdfilter_hist_sliding (t, weight)) {
+		/* Entire strip was done via the incremental sliding-window histogram */
+		gmt_M_free (GMT, visit);
+		gmt_M_free (GMT, weight);
+		return;
+	}
+
 	if (slow) {
 		if (slower)		/* Spherical (weighted) median/modes requires even more work */
 			work_data = gmt_M_memory (GMT, NULL, F.n_columns*F.n_rows, struct GMT_OBSERVATION);
@@ -1518,6 +1906,9 @@ GMT_LOCAL void grdfilter_threaded_function (struct THREAD_STRUCT *t) {
 
 	for (row_out = r_start; row_out < r_stop; row_out++) {
 
+		if (GMT->parent->cancel) break;	/* The embedder has asked us to stop; main() returns the cancellation code */
+		if (t->thread_num == 0)	/* The strips are equal so thread 0's fraction approximates the whole run */
+			GMT->parent->progress = (double)(row_out - r_start) / (r_stop - r_start);
 		GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "Processing output line %d\n", row_out);
 #ifdef DEBUG
 		if (Ctrl->A.active && row_out != Ctrl->A.ROW) continue;		/* Not at our selected row for testing */
@@ -433,6 +433,13 @@ EXTERN_MSC int GMT_grdgradient (void *V_API, int mode, void *args) {
 	double k_ads = 0.0, diffuse, spec, r_min = DBL_MAX, r_max = -DBL_MAX, scale, sin_Az[2] = {0.0, 0.0};
 	double def_offset = 0.0, def_sigma = 0.0;
 
+	gmt_grdfloat *zp = NULL, *wgrid = NULL;
+#ifdef _OPENMP
+	gmt_grdfloat *out = NULL;
+#endif
+
+	double *row_sum = NULL, *row_min = NULL, *row_max = NULL;
+
 	struct GMT_GRID *In = NULL, *Slope = NULL, *Grid = NULL, *A = NULL;
 	struct GRDGRADIENT_CTRL *Ctrl = NULL;
 	struct GMT_CTRL *GMT = NULL, *GMT_cpy = NULL;
@@ -573,11 +580,9 @@ EXTERN_MSC int GMT_grdgradient (void *V_API, int mode, void *args) {
 		}
 	}
 
-#ifdef OPENMP
-#if 0
-	separate = true;	/* Cannot use input grid to hold output grid when doing things in parallel */
-#endif
-#endif
+	/* Note: When OpenMP is active the gradient loop below writes into a separate scratch array instead of the
+	 * unpadded start of Grid->data, since threads working on later rows would otherwise overwrite nodes that
+	 * threads working on earlier rows still need to read.  Hence separate remains false here. */
 	new_grid = gmt_set_outgrid (GMT, Ctrl->In.file, separate, 2, In, &Grid);	/* true if input is a read-only array */
 	if (new_grid) GMT_Report (API, GMT_MSG_DEBUG, "Input grid duplicated as it was read-only\n");
 
@@ -628,14 +633,29 @@ EXTERN_MSC int GMT_grdgradient (void *V_API, int mode, void *args) {
 		x_factor_set = -dy_grid / (2.0 * lim_z);	y_factor = -dx_grid / (2.0 * lim_z);
 	}
 
-#if 0	/* Not active since we have no way to do min/max via OpenMP in C.  So rethink this part */
+	/* Each row accumulates its statistics into its own slots of row_sum|min|max; these partials are folded in
+	 * fixed row order after the loop so that mean, min and max do not depend on the number of threads used */
+	row_sum = gmt_M_memory (GMT, NULL, Grid->header->n_rows, double);
+	row_min = gmt_M_memory (GMT, NULL, Grid->header->n_rows, double);
+	row_max = gmt_M_memory (GMT, NULL, Grid->header->n_rows, double);
+
+	wgrid = Grid->data;	/* The serial pass writes results straight into the unpadded start of the input array */
 #ifdef _OPENMP
-#pragma omp parallel for private(row,ij0,lat,dx_grid,col,ij,n,bad,index,dzdx,dzdy,dzdx2,dzdy2,dzds1,dzds2,output,azim,norm_z,mag,diffuse,spec) \
-	shared(In,GMT,Ctrl,x_factor_set,x_factor2_set,sin_Az,new_grid,Grid,Slope,y_factor,y_factor2,p0,q0,p0q0_cte,k_ads,s) \
-	reduction(+:ave_gradient)
+	if (omp_get_max_threads () > 1) {	/* Threads must write elsewhere since rows still to be read would be overwritten */
+		out = gmt_M_memory (GMT, NULL, Grid->header->nm, gmt_grdfloat);
+		wgrid = out;
+	}
 #endif
+
+#ifdef _OPENMP
+#pragma omp parallel for private(row,ij0,lat,col,ij,n,bad,dzdx,dzdy,dzdx2,dzdy2,dzds1,dzds2,output,azim,norm_z,mag,diffuse,spec) \
+	firstprivate(dx_grid,x_factor,x_factor2,x_factor_set,y_factor) \
+	shared(GMT,Ctrl,x_factor2_set,sin_Az,Grid,Slope,A,wgrid,y_factor_set,y_factor2,dy_grid,one,p,p0,q0,p0q0_cte,k_ads,s,row_sum,row_min,row_max) \
+	reduction(+:n_used) schedule(static)
 #endif
-	for (row = 0, ij0 = 0ULL; row < (openmp_int)Grid->header->n_rows; row++) {	/* ij0 is the index in a non-padded grid */
+	for (row = 0; row < (openmp_int)Grid->header->n_rows; row++) {
+		ij0 = gmt_M_ij0 (Grid->header, row, 0);	/* ij0 is the index of the first node in this row in a non-padded grid */
+		row_sum[row] = 0.0;	row_min[row] = DBL_MAX;	row_max[row] = -DBL_MAX;
 		if (gmt_M_is_geographic (GMT, GMT_IN) && !Ctrl->E.active) {	/* Evaluate latitude-dependent factors */
 			lat = gmt_M_grd_row_to_y (GMT, row, Grid->header);
 			dx_grid = GMT->current.proj.DIST_M_PR_DEG * Grid->header->inc[GMT_X] * cosd (lat);
@@ -649,26 +669,26 @@ EXTERN_MSC int GMT_grdgradient (void *V_API, int mode, void *args) {
 			x_factor = x_factor_set;
 			if (Ctrl->A.mode == GRDGRADIENT_FIX && Ctrl->A.two) x_factor2 = x_factor2_set;
 		}
-		for (col = 0; col < (openmp_int)Grid->header->n_columns; col++, ij0++) {
-			ij = gmt_M_ijp (Grid->header, row, col);	/* Index into padded grid (with at least 1 row/col padding) */
+		ij = gmt_M_ijp (Grid->header, row, 0);	/* Index into padded grid (with at least 1 row/col padding); unit stride along the row */
+		for (col = 0; col < (openmp_int)Grid->header->n_columns; col++, ij0++, ij++) {
 			for (n = 0, bad = false; !bad && n < 4; n++) if (gmt_M_is_fnan (Grid->data[ij+p[n]])) bad = true;
 			if (bad) {	/* One of the 4-star corners = NaN; assign NaN answer and skip to next node */
-				Grid->data[ij0] = GMT->session.f_NaN;
+				wgrid[ij0] = GMT->session.f_NaN;
 				if (Ctrl->S.active) Slope->data[ij] = GMT->session.f_NaN;
 				continue;
 			}
-			if (Ctrl->A.mode == GRDGRADIENT_VAR) {	/* Must update azimuth for every node */
-				Ctrl->A.azimuth[0] = A->data[ij] * D2R;
-				x_factor = x_factor_set * sin (Ctrl->A.azimuth[0]);
-				y_factor = y_factor_set * cos (Ctrl->A.azimuth[0]);
+			if (Ctrl->A.mode == GRDGRADIENT_VAR) {	/* Must update azimuth for every node; keep it local so threads do not clobber Ctrl */
+				azim = A->data[ij] * D2R;
+				x_factor = x_factor_set * sin (azim);
+				y_factor = y_factor_set * cos (azim);
 			}
 
 			/* We can now evaluate the central finite differences */
-			dzdx = (Grid->data[ij+1] - Grid->data[ij-1]) * x_factor;
-			dzdy = (Grid->data[ij-Grid->header->mx] - Grid->data[ij+Grid->header->mx]) * y_factor;
+			dzdx = (Grid->data[ij+p[0]] - Grid->data[ij+p[1]]) * x_factor;
+			dzdy = (Grid->data[ij+p[3]] - Grid->data[ij+p[2]]) * y_factor;
 			if (Ctrl->A.two) {
-				dzdx2 = (Grid->data[ij+1] - Grid->data[ij-1]) * x_factor2;
-				dzdy2 = (Grid->data[ij-Grid->header->mx] - Grid->data[ij+Grid->header->mx]) * y_factor2;
+				dzdx2 = (Grid->data[ij+p[0]] - Grid->data[ij+p[1]]) * x_factor2;
+				dzdy2 = (Grid->data[ij+p[3]] - Grid->data[ij+p[2]]) * y_factor2;
 			}
 
 			/* Write output to unused NW corner */
@@ -681,9 +701,9 @@ EXTERN_MSC int GMT_grdgradient (void *V_API, int mode, void *args) {
 				}
 				else
 					output = dzdx + dzdy;
-				ave_gradient += output;
-				min_gradient = MIN (min_gradient, output);
-				max_gradient = MAX (max_gradient, output);
+				row_sum[row] += output;
+				row_min[row] = MIN (row_min[row], output);
+				row_max[row] = MAX (row_max[row], output);
 			}
 			else if (Ctrl->D.active) {
 				if (dzdx == 0.0 && dzdy == 0.0)	/* Flat, so no preferred direction */
@@ -715,14 +735,33 @@ EXTERN_MSC int GMT_grdgradient (void *V_API, int mode, void *args) {
 					output = (dzdy*s[0] + dzdx*s[1] + 2*s[2]) / (sqrt(dzdy * dzdy + dzdx * dzdx + 4));
 				else	/* Peucker method */
 					output = -0.4285 * (dzdx - dzdy) - 0.0844 * fabs (dzdx  + dzdy) + 0.6599;
-				r_min = MIN (r_min, output);
-				r_max = MAX (r_max, output);
+				row_min[row] = MIN (row_min[row], output);
+				row_max[row] = MAX (row_max[row], output);
 			}
-			Grid->data[ij0] = (gmt_grdfloat)output;
+			wgrid[ij0] = (gmt_grdfloat)output;
 			n_used++;
 		}
 	}
 
+	for (row = 0; row < (openmp_int)Grid->header->n_rows; row++) {	/* Fold per-row statistics in fixed row order */
+		ave_gradient += row_sum[row];
+		if (Ctrl->A.active) {
+			min_gradient = MIN (min_gradient, row_min[row]);
+			max_gradient = MAX (max_gradient, row_max[row]);
+		}
+		else if (Ctrl->E.active) {
+			r_min = MIN (r_min, row_min[row]);
+			r_max = MAX (r_max, row_max[row]);
+		}
+	}
+	gmt_M_free (GMT, row_sum);	gmt_M_free (GMT, row_min);	gmt_M_free (GMT, row_max);
+#ifdef _OPENMP
+	if (out) {	/* Move the threaded result into the unpadded start of Grid->data, where the serial pass leaves it */
+		gmt_M_memcpy (Grid->data, out, Grid->header->nm, gmt_grdfloat);
+		gmt_M_free (GMT, out);
+	}
+#endif
+
 	/* Now deal with the fact that the result is unpadded in a padded array */
 	gmt_M_memcpy (orig_pad, Grid->header->pad, 4, unsigned int);	/* This can be either 1/1/1/1/ or 2/2/2/2, depending on circumstances */
 	Grid->header->mx = Grid->header->n_columns;	Grid->header->my = Grid->header->n_rows;	/* Since there is no pad as far as the computed grid is concerned */
@@ -746,9 +785,15 @@ EXTERN_MSC int GMT_grdgradient (void *V_API, int mode, void *args) {
 
 	if (Ctrl->E.active) {	/* data must be scaled to the [-1,1] interval, but we'll do it into [-.95, .95] to not get too bright */
 		scale = 1.0 / (r_max - r_min);
-		gmt_M_grd_loop (GMT, Grid, row, col, ij) {
-			if (gmt_M_is_fnan (Grid->data[ij])) continue;
-			Grid->data[ij] = (gmt_grdfloat)((-1.0 + 2.0 * ((Grid->data[ij] - r_min) * scale)) * 0.95);
+#ifdef _OPENMP
+#pragma omp parallel for private(row,col,zp) shared(GMT,Grid,r_min,scale)
+#endif
+		for (row = 0; row < (openmp_int)Grid->header->n_rows; row++) {
+			zp = Grid->data + gmt_M_ijp (Grid->header, row, 0);
+			for (col = 0; col < (openmp_int)Grid->header->n_columns; col++) {
+				if (gmt_M_is_fnan (zp[col])) continue;
+				zp[col] = (gmt_grdfloat)((-1.0 + 2.0 * ((zp[col] - r_min) * scale)) * 0.95);
+			}
 		}
 	}
 
@@ -763,41 +808,53 @@ EXTERN_MSC int GMT_grdgradient (void *V_API, int mode, void *args) {
 			if (Ctrl->N.mode == 1) {	/* atan transformation */
 				if (Ctrl->N.set[2])
 					denom = 1.0 / Ctrl->N.sigma;
-				else {
+				else {	/* Summation kept serial so the variance estimate does not depend on the number of threads */
 					denom = 0.0;
-					gmt_M_grd_loop (GMT, Grid, row, col, ij) {
-						if (!gmt_M_is_fnan (Grid->data[ij])) denom += pow (Grid->data[ij] - ave_gradient, 2.0);
+					gmt_M_grd_span_loop (GMT, Grid, row, zp) for (col = 0; col < (openmp_int)Grid->header->n_columns; col++) {
+						if (!gmt_M_is_fnan (zp[col])) denom += pow (zp[col] - ave_gradient, 2.0);
 					}
 					denom = sqrt ((n_used - 1) / denom);
 					Ctrl->N.sigma = 1.0 / denom;
 				}
 				rpi = 2.0 * Ctrl->N.norm / M_PI;
-				gmt_M_grd_loop (GMT, Grid, row, col, ij) {
-					if (!gmt_M_is_fnan (Grid->data[ij])) Grid->data[ij] = (gmt_grdfloat)(rpi * atan ((Grid->data[ij] - ave_gradient) * denom) + Ctrl->N.ambient);
+#ifdef _OPENMP
+#pragma omp parallel for private(row,col,zp) shared(GMT,Grid,Ctrl,rpi,ave_gradient,denom)
+#endif
+				for (row = 0; row < (openmp_int)Grid->header->n_rows; row++) {
+					zp = Grid->data + gmt_M_ijp (Grid->header, row, 0);
+					for (col = 0; col < (openmp_int)Grid->header->n_columns; col++) {
+						if (!gmt_M_is_fnan (zp[col])) zp[col] = (gmt_grdfloat)(rpi * atan ((zp[col] - ave_gradient) * denom) + Ctrl->N.ambient);
+					}
 				}
 				Grid->header->z_max = rpi * atan ((max_gradient - ave_gradient) * denom) + Ctrl->N.ambient;
 				Grid->header->z_min = rpi * atan ((min_gradient - ave_gradient) * denom) + Ctrl->N.ambient;
 			}
 			else if (Ctrl->N.mode == 2) {	/* Exp transformation */
-				if (!Ctrl->N.set[2]) {
+				if (!Ctrl->N.set[2]) {	/* Summation kept serial so sigma does not depend on the number of threads */
 					Ctrl->N.sigma = 0.0;
-					gmt_M_grd_loop (GMT, Grid, row, col, ij) {
+					gmt_M_grd_span_loop (GMT, Grid, row, zp) for (col = 0; col < (openmp_int)Grid->header->n_columns; col++) {
 #ifdef DOUBLE_PRECISION_GRID
-						if (!gmt_M_is_fnan (Grid->data[ij])) Ctrl->N.sigma += fabs (Grid->data[ij]);
+						if (!gmt_M_is_fnan (zp[col])) Ctrl->N.sigma += fabs (zp[col]);
 #else
-						if (!gmt_M_is_fnan (Grid->data[ij])) Ctrl->N.sigma += fabsf (Grid->data[ij]);
+						if (!gmt_M_is_fnan (zp[col])) Ctrl->N.sigma += fabsf (zp[col]);
 #endif
 					}
 					Ctrl->N.sigma = M_SQRT2 * Ctrl->N.sigma / n_used;
 				}
 				denom = M_SQRT2 / Ctrl->N.sigma;
-				gmt_M_grd_loop (GMT, Grid, row, col, ij) {
-					if (gmt_M_is_fnan (Grid->data[ij])) continue;
-					if (Grid->data[ij] < ave_gradient) {
-						Grid->data[ij] = (gmt_grdfloat)(-Ctrl->N.norm * (1.0 - exp ( (Grid->data[ij] - ave_gradient) * denom)) + Ctrl->N.ambient);
-					}
-					else {
-						Grid->data[ij] = (gmt_grdfloat)( Ctrl->N.norm * (1.0 - exp (-(Grid->data[ij] - ave_gradient) * denom)) + Ctrl->N.ambient);
+#ifdef _OPENMP
+#pragma omp parallel for private(row,col,zp) shared(GMT,Grid,Ctrl,ave_gradient,denom)
+#endif
+				for (row = 0; row < (openmp_int)Grid->header->n_rows; row++) {
+					zp = Grid->data + gmt_M_ijp (Grid->header, row, 0);
+					for (col = 0; col < (openmp_int)Grid->header->n_columns; col++) {
+						if (gmt_M_is_fnan (zp[col])) continue;
+						if (zp[col] < ave_gradient) {
+							zp[col] = (gmt_grdfloat)(-Ctrl->N.norm * (1.0 - exp ( (zp[col] - ave_gradient) * denom)) + Ctrl->N.ambient);
+						}
+						else {
+							zp[col] = (gmt_grdfloat)( Ctrl->N.norm * (1.0 - exp (-(zp[col] - ave_gradient) * denom)) + Ctrl->N.ambient);
+						}
 					}
 				}
 				Grid->header->z_max =  Ctrl->N.norm * (1.0 - exp (-(max_gradient - ave_gradient) * denom)) + Ctrl->N.ambient;
@@ -808,8 +865,14 @@ EXTERN_MSC int GMT_grdgradient (void *V_API, int mode, void *args) {
 					denom = Ctrl->N.norm / (max_gradient - ave_gradient);
 				else
 					denom = Ctrl->N.norm / (ave_gradient - min_gradient);
-				gmt_M_grd_loop (GMT, Grid, row, col, ij) {
-					if (!gmt_M_is_fnan (Grid->data[ij])) Grid->data[ij] = (gmt_grdfloat)((Grid->data[ij] - ave_gradient) * denom) + Ctrl->N.ambient;
+#ifdef _OPENMP
+#pragma omp parallel for private(row,col,zp) shared(GMT,Grid,Ctrl,ave_gradient,denom)
+#endif
+				for (row = 0; row < (openmp_int)Grid->header->n_rows; row++) {
+					zp = Grid->data + gmt_M_ijp (Grid->header, row, 0);
+					for (col = 0; col < (openmp_int)Grid->header->n_columns; col++) {
+						if (!gmt_M_is_fnan (zp[col])) zp[col] = (gmt_grdfloat)((zp[col] - ave_gradient) * denom) + Ctrl->N.ambient;
+					}
 				}
 				Grid->header->z_max = (max_gradient - ave_gradient) * denom + Ctrl->N.ambient;
 				Grid->header->z_min = (min_gradient - ave_gradient) * denom + Ctrl->N.ambient;
@@ -210,7 +210,7 @@ GMT_LOCAL gmt_grdfloat grdhisteq_get_cell (gmt_grdfloat x, struct GRDHISTEQ_CELL
 
 GMT_LOCAL struct GRDHISTEQ_CELL *grdhisteq_do_hist_equalization_cart (struct GMT_CTRL *GMT, struct GMT_GRID *Grid, char *outfile, unsigned int n_cells, bool quadratic) {
 	/* Do basic Cartesian histogram equalization */
-	uint64_t i, j, nxy;
+	uint64_t i, j, nxy, *rank = NULL, n_ranks = 0;
 	unsigned int n_cells_m1 = 0, current_cell, pad[4];
 	double delta_cell, target;
 	struct GRDHISTEQ_CELL *cell = NULL;
@@ -218,24 +218,44 @@ GMT_LOCAL struct GRDHISTEQ_CELL *grdhisteq_do_hist_equalization_cart (struct GMT
 
 	cell = gmt_M_memory (GMT, NULL, n_cells, struct GRDHISTEQ_CELL);
 
-	/* Sort the data and find the division points */
+	/* Find the division points via order statistics */
 
 	gmt_M_memcpy (pad, Grid->header->pad, 4, int);	/* Save the original pad */
-	gmt_grd_pad_off (GMT, Grid);	/* Undo pad if one existed so we can sort the entire grid */
+	gmt_grd_pad_off (GMT, Grid);	/* Undo pad if one existed so we can rearrange the entire grid */
 	if (outfile && (Orig = GMT_Duplicate_Data (GMT->parent, GMT_IS_GRID, GMT_DUPLICATE_DATA, Grid)) == NULL) {	/* Must keep original if readonly */
 		GMT_Report (GMT->parent, GMT_MSG_ERROR, "Grid duplication failed - memory error?\n");
 		gmt_M_free (GMT, cell);
 		return (NULL);
 	}
-	gmt_sort_array (GMT, Grid->data, Grid->header->nm, GMT_FLOAT);
-
-	nxy = Grid->header->nm;
-	while (nxy > 0 && gmt_M_is_fnan (Grid->data[nxy-1])) nxy--;	/* Only deal with real numbers since NaNs will be at end */
+	for (i = nxy = 0; i < Grid->header->nm; i++) {	/* Sweep away any NaNs so the first nxy values are the real data */
+		if (gmt_M_is_fnan (Grid->data[i])) continue;
+		if (nxy < i) Grid->data[nxy] = Grid->data[i];
+		nxy++;
+	}
 
 	n_cells_m1 = n_cells - 1;
+	delta_cell = ((double)nxy) / ((double)n_cells);
+
+	/* Only the values at the cell boundaries are needed, so instead of sorting the entire grid we
+	 * determine which ranks the loop below will look up and place just those by selection */
+	rank = gmt_M_memory (GMT, NULL, n_cells + 1, uint64_t);
+	rank[n_ranks++] = 0;	/* The first cell starts at the minimum */
+	for (current_cell = 0; current_cell < n_cells; current_cell++) {
+		if (current_cell == n_cells_m1)
+			j = nxy - 1;
+		else if (quadratic) {	/* Use y = 2x - x**2 scaling  */
+			target = (current_cell + 1.0) / n_cells;
+			j = lrint (floor (nxy * (1.0 - sqrt (1.0 - target))));
+		}
+		else	/* Use simple linear scale  */
+			j = lrint (floor ((current_cell + 1) * delta_cell)) - 1;
+		if (j > rank[n_ranks-1] && j < nxy) rank[n_ranks++] = j;	/* Keep ascending, unique ranks only */
+	}
+	gmt_order_statistics_f (GMT, Grid->data, nxy, rank, n_ranks);
+	gmt_M_free (GMT, rank);
+
 	current_cell = 0;
 	i = 0;
-	delta_cell = ((double)nxy) / ((double)n_cells);
 
 	while (current_cell < n_cells) {
 
@@ -41,6 +41,8 @@
 static char *gdal_ext[N_IMG_EXTENSIONS] = {"tiff", "tif", "gif", "png", "jpg", "jpeg", "bmp"};
 
 #define GRDIMAGE_NAN_INDEX	(GMT_NAN - 3)
+#define GRDIMAGE_LUT_N		4096		/* Number of z bins in the dense z -> CPT slice lookup table */
+#define GRDIMAGE_LUT_AMBIGUOUS	INT_MAX		/* Flags a bin that straddles a CPT slice boundary */
 
 /* Control structure for grdimage */
 
@@ -136,6 +138,9 @@ struct GRDIMAGE_CONF {
 	double orig[2];			/* Lower left image origin */
 	double tr_rgb[4];		/* Background color used to simulate image transparency [black] */
 	struct GMT_PALETTE *P;		/* Pointer to the active palette [NULL if image] */
+	int *z_lut;			/* Dense z -> CPT slice lookup table, if one could be built [NULL] */
+	double lut_zmin, lut_zmax;	/* The z range covered by z_lut */
+	double lut_idz;			/* The inverse of the z_lut bin width */
 	struct GMT_GRID *Grid;		/* Pointer to the active grid [NULL if image] */
 	struct GMT_GRID *Intens;	/* Pointer to the active intensity grid [NULL if no intensity] */
 	struct GMT_IMAGE *Image;	/* Pointer to the active image [NULL if grid] */
@@ -598,6 +603,36 @@ GMT_LOCAL unsigned int grdimage_clean_global_headers (struct GMT_CTRL *GMT, stru
 	return 1;
 }
 
+GMT_LOCAL unsigned int grdimage_overzoom_factor (struct GMT_CTRL *GMT, struct GRDIMAGE_CTRL *Ctrl, struct GMT_GRID_HEADER *h) {
+	/* Determine how much denser the image pixels are than what the plot scale times the rendering dpu
+	 * can resolve.  Like the automatic remote grid resolution selection, we equate map dimension in
+	 * inches times the dpu with the number of pixels the plot can actually use; reading more than that
+	 * from the file is wasted effort (and GDAL can serve a decimated read from overview levels).
+	 * Returns the integer decimation factor to request [1 means read at full resolution]. */
+	double region[4], dpi, width, height, ratio_x, ratio_y, ratio;
+	gmt_M_memcpy (region, h->wesn, 4, double);
+	if (GMT->common.R.active[RSET]) {	/* The plot may only cover a subset of the image */
+		if (gmt_M_is_geographic (GMT, GMT_IN) && gmt_M_360_range (h->wesn[XLO], h->wesn[XHI])) {	/* Global image: -R may use another 360-degree range */
+			region[XLO] = GMT->common.R.wesn[XLO];	region[XHI] = GMT->common.R.wesn[XHI];
+		}
+		else {
+			region[XLO] = MAX (region[XLO], GMT->common.R.wesn[XLO]);	region[XHI] = MIN (region[XHI], GMT->common.R.wesn[XHI]);
+		}
+		region[YLO] = MAX (region[YLO], GMT->common.R.wesn[YLO]);	region[YHI] = MIN (region[YHI], GMT->common.R.wesn[YHI]);
+	}
+	if (region[XHI] <= region[XLO] || region[YHI] <= region[YLO]) return 1;	/* No overlap; let the regular machinery deal with that */
+	if (gmt_map_setup (GMT, region)) return 1;	/* Just need the plot dimensions; the real (and possibly fatal) setup happens later */
+	dpi = (Ctrl->E.dpi > 0) ? (double)Ctrl->E.dpi : GMT->current.setting.graphics_dpu;
+	if (Ctrl->E.dpi == 0 && GMT->current.setting.graphics_dpu_unit == 'c') dpi *= 2.54;	/* Convert dpc to dpi */
+	width  = GMT->current.proj.rect[XHI] - GMT->current.proj.rect[XLO];	/* Plot dimensions in inches */
+	height = GMT->current.proj.rect[YHI] - GMT->current.proj.rect[YLO];
+	if (width <= 0.0 || height <= 0.0 || dpi <= 0.0) return 1;
+	ratio_x = ((region[XHI] - region[XLO]) / h->inc[GMT_X]) / (width  * dpi);	/* Pixels available per pixel the plot can resolve */
+	ratio_y = ((region[YHI] - region[YLO]) / h->inc[GMT_Y]) / (height * dpi);
+	ratio = MIN (ratio_x, ratio_y);	/* Be conservative so neither direction falls below the plot resolution */
+	return ((ratio < 2.0) ? 1 : (unsigned int)floor (ratio));
+}
+
 GMT_LOCAL void grdimage_set_proj_limits (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *r, struct GMT_GRID_HEADER *g, bool projected, unsigned int mixed) {
 	/* Sets the projected extent of the grid given the map projection.
 	 * The extreme x/y coordinates are returned in r, with inc and
@@ -731,6 +766,54 @@ GMT_LOCAL void grdimage_blackwhite_PS_image (struct GMT_CTRL *GMT, struct GRDIMA
  * In the cases without intensity we simply use H_s, kk_s, and node_s for consistency.
  */
 
+GMT_LOCAL void grdimage_cpt_lut_init (struct GMT_CTRL *GMT, struct GRDIMAGE_CONF *Conf) {
+	/* Precompute a dense z -> CPT slice lookup table so that the per-node binary search in
+	 * gmt_get_index can be skipped for almost all nodes.  A bin maps to a slice only when the
+	 * entire bin falls inside that slice; bins straddling a slice boundary are flagged and those
+	 * nodes take the regular search instead.  Colors are still computed by gmt_get_rgb_lookup so
+	 * the resulting image is identical to calling gmt_get_rgb_from_z for every node.
+	 * Wrapping CPTs modify the z-value during lookup and categorical CPTs must check each exact
+	 * z-value, so for those we leave Conf->z_lut NULL and nothing changes. */
+	unsigned int bin;
+	int lo, hi;
+	double z_lo, z_hi, dz;
+	struct GMT_PALETTE *P = Conf->P;
+
+	if (P == NULL || P->n_colors == 0 || P->categorical || P->is_wrapping) return;	/* Not a CPT we can tabulate */
+	Conf->lut_zmin = P->data[0].z_low;	Conf->lut_zmax = P->data[P->n_colors-1].z_high;
+	dz = (Conf->lut_zmax - Conf->lut_zmin) / GRDIMAGE_LUT_N;	/* Width of each z bin */
+	if (dz <= 0.0 || gmt_M_is_dnan (dz)) return;	/* Empty or bad z range */
+	Conf->lut_idz = 1.0 / dz;
+	Conf->z_lut = gmt_M_memory (GMT, NULL, GRDIMAGE_LUT_N, int);
+	for (bin = 0; bin < GRDIMAGE_LUT_N; bin++) {	/* Find the slice at each end of this bin */
+		z_lo = Conf->lut_zmin + bin * dz;
+		z_hi = Conf->lut_zmin + (bin + 1) * dz;
+		lo = gmt_get_index (GMT, P, &z_lo);
+		hi = gmt_get_index (GMT, P, &z_hi);
+		Conf->z_lut[bin] = (lo == hi) ? lo : GRDIMAGE_LUT_AMBIGUOUS;	/* Same slice means all z in the bin share it */
+	}
+	GMT_Report (GMT->parent, GMT_MSG_DEBUG, "grdimage_cpt_lut_init: Built CPT slice lookup table with %d bins\n", GRDIMAGE_LUT_N);
+}
+
+GMT_LOCAL int grdimage_get_rgb_from_z (struct GMT_CTRL *GMT, struct GRDIMAGE_CONF *Conf, double value, double *rgb) {
+	/* Same result as gmt_get_rgb_from_z but consults the precomputed slice lookup table, if there is one */
+	int index;
+	if (Conf->z_lut == NULL || gmt_M_is_dnan (value))	/* No lookup table (or NaN z): take the regular path */
+		return (gmt_get_rgb_from_z (GMT, Conf->P, value, rgb));
+	if (value > Conf->lut_zmax)	/* Above the CPT range: foreground color */
+		index = GMT_FGD - 3;
+	else if (value < Conf->lut_zmin)	/* Below the CPT range: background color */
+		index = GMT_BGD - 3;
+	else {	/* Inside the CPT range where the lookup table applies */
+		unsigned int bin = (unsigned int)((value - Conf->lut_zmin) * Conf->lut_idz);
+		if (bin >= GRDIMAGE_LUT_N) bin = GRDIMAGE_LUT_N - 1;	/* Happens for value == lut_zmax */
+		if ((index = Conf->z_lut[bin]) == GRDIMAGE_LUT_AMBIGUOUS)	/* Bin straddles a slice boundary so must search */
+			index = gmt_get_index (GMT, Conf->P, &value);
+	}
+	gmt_get_rgb_lookup (GMT, Conf->P, index, value, rgb);
+	return (index);
+}
+
 GMT_LOCAL void grdimage_grd_gray_no_intensity (struct GMT_CTRL *GMT, struct GRDIMAGE_CTRL *Ctrl, struct GRDIMAGE_CONF *Conf, unsigned char *image) {
 	/* Function that fills out the image in the special case of 1) grid, 2) grayscale, 3) no intensity */
 	int64_t srow, scol;	/* Due to OPENMP on Windows requiring signed int loop variables */
@@ -748,7 +831,7 @@ GMT_LOCAL void grdimage_grd_gray_no_intensity (struct GMT_CTRL *GMT, struct GRDI
 		kk_s = gmt_M_ijpgi (H_s, Conf->actual_row[srow], 0);	/* Start pixel of this data row */
 		for (scol = 0; scol < Conf->n_columns; scol++) {	/* Compute rgb for each pixel along this scanline */
 			node_s = kk_s + Conf->actual_col[scol];	/* Current grid node */
-			(void)gmt_get_rgb_from_z (GMT, Conf->P, Conf->Grid->data[node_s], rgb);
+			(void)grdimage_get_rgb_from_z (GMT, Conf, Conf->Grid->data[node_s], rgb);
 			image[byte++] = gmt_M_u255 (rgb[0]);	/* Color table only has grays, just use r since r = g = b here */
 		}
 	}
@@ -774,7 +857,7 @@ GMT_LOCAL void grdimage_grd_gray_with_intensity (struct GMT_CTRL *GMT, struct GR
 		kk_i = (different) ? gmt_M_ijpgi (H_i, Conf->actual_row[srow], 0) : kk_s;	/* Start node of same row in the intensity grid */
 		for (scol = 0; scol < Conf->n_columns; scol++) {	/* Compute rgb for each pixel along this scanline */
 			node_s = kk_s + Conf->actual_col[scol];	/* Current grid node */
-			index = gmt_get_rgb_from_z (GMT, Conf->P, Conf->Grid->data[node_s], rgb);
+			index = grdimage_get_rgb_from_z (GMT, Conf, Conf->Grid->data[node_s], rgb);
 			if (index != GRDIMAGE_NAN_INDEX) {	/* Add in the effect of illumination */
 				if (Conf->int_mode == 2) {	/* Intensity value comes from a co-registered grid */
 					node_i = kk_i + Conf->actual_col[scol];	/* Current intensity node */
@@ -805,7 +888,7 @@ GMT_LOCAL void grdimage_grd_c2s_no_intensity (struct GMT_CTRL *GMT, struct GRDIM
 		kk_s = gmt_M_ijpgi (H_s, Conf->actual_row[srow], 0);	/* Start pixel of this row in the data grid */
 		for (scol = 0; scol < Conf->n_columns; scol++) {	/* Compute rgb for each pixel along this scanline */
 			node_s = kk_s + Conf->actual_col[scol];	/* Current grid node */
-			(void)gmt_get_rgb_from_z (GMT, Conf->P, Conf->Grid->data[node_s], rgb);
+			(void)grdimage_get_rgb_from_z (GMT, Conf, Conf->Grid->data[node_s], rgb);
 			image[byte++] = gmt_M_u255 (gmt_M_yiq (rgb));
 		}
 	}
@@ -831,7 +914,7 @@ GMT_LOCAL void grdimage_grd_c2s_with_intensity (struct GMT_CTRL *GMT, struct GRD
 		kk_i = (different) ? gmt_M_ijpgi (H_i, Conf->actual_row[srow], 0) : kk_s;	/* Start pixel of this row in the intensity grid */
 		for (scol = 0; scol < Conf->n_columns; scol++) {	/* Compute rgb for each pixel along this scanline */
 			node_s = kk_s + Conf->actual_col[scol];	/* Current data grid node */
-			index = gmt_get_rgb_from_z (GMT, Conf->P, Conf->Grid->data[node_s], rgb);
+			index = grdimage_get_rgb_from_z (GMT, Conf, Conf->Grid->data[node_s], rgb);
 			if (index != GRDIMAGE_NAN_INDEX) {	/* Deal with illumination */
 				if (Conf->int_mode == 2) {	/* Intensity value comes from the grid */
 					node_i = kk_i + Conf->actual_col[scol];	/* Current intensity grid node */
@@ -863,7 +946,7 @@ GMT_LOCAL void grdimage_grd_color_no_intensity (struct GMT_CTRL *GMT, struct GRD
 		kk_s = gmt_M_ijpgi (H_s, Conf->actual_row[srow], 0);	/* Start pixel of this row */
 		for (scol = 0; scol < Conf->n_columns; scol++) {	/* Compute rgb for each pixel along this scanline */
 			node_s = kk_s + Conf->actual_col[scol];	/* Current grid node */
-			(void)gmt_get_rgb_from_z (GMT, Conf->P, Conf->Grid->data[node_s], rgb);
+			(void)grdimage_get_rgb_from_z (GMT, Conf, Conf->Grid->data[node_s], rgb);
 			for (k = 0; k < 3; k++) image[byte++] = gmt_M_u255 (rgb[k]);
 		}
 	}
@@ -885,7 +968,7 @@ GMT_LOCAL void grdimage_grd_color_no_intensity_CM (struct GMT_CTRL *GMT, struct
 		kk_s = gmt_M_ijpgi (H_s, Conf->actual_row[srow], 0);	/* Start pixel of this row */
 		for (scol = 0; scol < Conf->n_columns; scol++) {	/* Compute rgb for each pixel along this scanline */
 			node_s = kk_s + Conf->actual_col[scol];	/* Current grid node */
-			index = gmt_get_rgb_from_z (GMT, Conf->P, Conf->Grid->data[node_s], rgb);
+			index = grdimage_get_rgb_from_z (GMT, Conf, Conf->Grid->data[node_s], rgb);
 			for (k = 0; k < 3; k++) image[byte++] = i_rgb[k] = gmt_M_u255 (rgb[k]);
 			if (index != GRDIMAGE_NAN_INDEX) {	/* Deal with illumination */
 				index = (i_rgb[0]*256 + i_rgb[1])*256 + i_rgb[2];	/* The index into the cube for the selected NaN color */
@@ -915,7 +998,7 @@ GMT_LOCAL void grdimage_grd_color_with_intensity (struct GMT_CTRL *GMT, struct G
 		kk_i = (different) ? gmt_M_ijpgi (H_i, Conf->actual_row[srow], 0) : kk_s;	/* Start pixel of this row in the intensity grid */
 		for (scol = 0; scol < Conf->n_columns; scol++) {	/* Compute rgb for each pixel along this scanline */
 			node_s = kk_s + Conf->actual_col[scol];	/* Current grid node */
-			index = gmt_get_rgb_from_z (GMT, Conf->P, Conf->Grid->data[node_s], rgb);
+			index = grdimage_get_rgb_from_z (GMT, Conf, Conf->Grid->data[node_s], rgb);
 			if (index != GRDIMAGE_NAN_INDEX) {	/* Deal with illumination */
 				if (Conf->int_mode == 2) {	/* Intensity value comes from the grid */
 					node_i = kk_i + Conf->actual_col[scol];	/* Current intensity node */
@@ -951,7 +1034,7 @@ GMT_LOCAL void grdimage_grd_color_with_intensity_CM (struct GMT_CTRL *GMT, struc
 		kk_i = (different) ? gmt_M_ijpgi (H_i, Conf->actual_row[srow], 0) : kk_s;	/* Start pixel of this row in the intensity grid */
 		for (scol = 0; scol < Conf->n_columns; scol++) {	/* Compute rgb for each pixel along this scanline */
 			node_s = kk_s + Conf->actual_col[scol];	/* Current grid node */
-			index = gmt_get_rgb_from_z (GMT, Conf->P, Conf->Grid->data[node_s], rgb);
+			index = grdimage_get_rgb_from_z (GMT, Conf, Conf->Grid->data[node_s], rgb);
 			if (index == GRDIMAGE_NAN_INDEX) {	 /* Nan color */
 				for (k = 0; k < 3; k++) image[byte++] = n_rgb[k];
 			}
@@ -1581,6 +1664,8 @@ EXTERN_MSC int GMT_grdimage (void *V_API, int mode, void *args) {
 
 	if (Ctrl->D.active) {	/* Main input is a single image and not a grid */
 		bool R_save = GMT->common.R.active[RSET];
+		unsigned int jump = 1;
+		char jump_text[GMT_LEN16] = {""};
 		double *I_wesn = (API->got_remote_wesn) ? API->tile_wesn : NULL;
 		if (I && !need_to_project) {
 			gmt_M_memcpy (wesn, GMT->common.R.active[RSET] ? GMT->common.R.wesn : I->header->wesn, 4, double);
@@ -1609,11 +1694,26 @@ EXTERN_MSC int GMT_grdimage (void *V_API, int mode, void *args) {
 			GMT->common.R.active[RSET] = false;	/* Temporarily turn off -R if given */
 			I_wesn = NULL;
 		}
+		if (!Ctrl->D.mode && !Ctrl->A.active && !Ctrl->E.device_dpi && GMT->common.J.active) {	/* Plotting at a known scale: see if a decimated (overview) read will do */
+			struct GMT_IMAGE *I_h = I;	/* We may already have the header from the image-vs-grid test above */
+			if (I_h == NULL && (I_h = GMT_Read_Data (API, GMT_IS_IMAGE, GMT_IS_FILE, GMT_IS_SURFACE, GMT_CONTAINER_ONLY | GMT_GRID_IS_IMAGE, NULL, Ctrl->In.file, NULL)) == NULL)
+				GMT_Report (API, GMT_MSG_DEBUG, "Unable to read image header for %s; will read at full resolution\n", Ctrl->In.file);
+			if (I_h && (jump = grdimage_overzoom_factor (GMT, Ctrl, I_h->header)) > 1) {
+				snprintf (jump_text, GMT_LEN16, "%u", jump);
+				GMT->current.gdal_read_in.P.active = true;	/* Ask gmt_gdalread for a 1:jump decimated read */
+				GMT->current.gdal_read_in.P.jump = jump_text;
+				GMT_Report (API, GMT_MSG_INFORMATION, "Image resolution exceeds plot resolution; reading with 1:%u decimation\n", jump);
+			}
+			if (I_h && I_h != I && GMT_Destroy_Data (API, &I_h) != GMT_NOERROR)
+				Return (API->error);
+		}
 		/* Read in the the entire image that is to be mapped */
 		GMT_Report (API, GMT_MSG_INFORMATION, "Allocate memory and read image file %s\n", Ctrl->In.file);
 		if ((I = GMT_Read_Data (API, GMT_IS_IMAGE, GMT_IS_FILE, GMT_IS_SURFACE, GMT_CONTAINER_AND_DATA | GMT_IMAGE_NO_INDEX | pad_mode, I_wesn, Ctrl->In.file, NULL)) == NULL) {
+			GMT->current.gdal_read_in.P.active = false;	GMT->current.gdal_read_in.P.jump = NULL;
 			Return (API->error);
 		}
+		GMT->current.gdal_read_in.P.active = false;	GMT->current.gdal_read_in.P.jump = NULL;	/* The preview request only applied to the read above */
 
 		if (grdimage_transparencies (GMT, I, Ctrl->Q.invert, &Transp)) {	/* What if any transparency situation do we have in the image? */
 			double percent = 100.0 * (double)Transp.n_dominant / (double) I->header->nm;
@@ -1757,70 +1857,80 @@ EXTERN_MSC int GMT_grdimage (void *V_API, int mode, void *args) {
 	if (Ctrl->I.derive) {	/* Auto-create intensity grid from data grid using the now determined data region */
 		bool got_int4_grid = false;
 		char int_grd[GMT_VF_LEN] = {""}, int4_grd[GMT_VF_LEN] = {""};
+		char spec[GMT_LEN256] = {""}, *int_source = (Ctrl->I.file) ? Ctrl->I.file : Ctrl->In.file;
 		double *region = (got_data_tiles) ? header_work->wesn : wesn;	/* Region to pass to grdgradient */
 		struct GMT_GRID *I_data = NULL;
 
-		GMT_Report (API, GMT_MSG_INFORMATION, "Derive intensity grid from data grid %s\n", (Ctrl->I.file) ? Ctrl->I.file : data_grd);
-		/* Create a virtual file to hold the intensity grid */
-		if (GMT_Open_VirtualFile (API, GMT_IS_GRID, GMT_IS_SURFACE, GMT_OUT|GMT_IS_REFERENCE, NULL, int_grd))
-			Return (API->error);
-		if (Ctrl->I.file) {	/* Gave a file to derive from. In case it is a tiled grid we read it in here */
-			if ((I_data = GMT_Read_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_CONTAINER_AND_DATA|pad_mode, wesn, Ctrl->I.file, NULL)) == NULL)	/* Get grid data header*/
+		if (!got_data_tiles && got_z_grid && !gmt_M_file_is_memory (int_source))	/* Derivation from a local file that the session cache can replay */
+			snprintf (spec, GMT_LEN256, "intensity|%s|%s|%s|%.12g/%.12g/%.12g/%.12g|%.12g/%.12g|%u", Ctrl->I.azimuth, Ctrl->I.method,
+				Ctrl->I.ambient, region[XLO], region[XHI], region[YLO], region[YHI], Grid_orig->header->inc[GMT_X], Grid_orig->header->inc[GMT_Y], Grid_orig->header->registration);
+		if (spec[0] && (Intens_orig = gmtlib_grdcache_fetch_derived (GMT, int_source, spec)) != NULL)	/* This exact intensity was derived earlier in the session */
+			GMT_Report (API, GMT_MSG_INFORMATION, "Reuse session-cached derived intensity grid for %s\n", int_source);
+		else {
+			GMT_Report (API, GMT_MSG_INFORMATION, "Derive intensity grid from data grid %s\n", (Ctrl->I.file) ? Ctrl->I.file : data_grd);
+			/* Create a virtual file to hold the intensity grid */
+			if (GMT_Open_VirtualFile (API, GMT_IS_GRID, GMT_IS_SURFACE, GMT_OUT|GMT_IS_REFERENCE, NULL, int_grd))
 				Return (API->error);
-			/* If dimensions don't match the data grid we must resample this secondary z-grid */
-			if (Grid_orig && (I_data->header->n_columns != Grid_orig->header->n_columns || I_data->header->n_rows != Grid_orig->header->n_rows)) {
-				char int_z_grd[GMT_VF_LEN] = {""}, *res = "gp";
-				if (I_data->header->wesn[XLO] > region[XLO] || I_data->header->wesn[XHI] < region[XHI] || I_data->header->wesn[YLO] > region[YLO] || I_data->header->wesn[YHI] < region[YHI]) {
-					GMT_Report (API, GMT_MSG_ERROR, "Your secondary data grid given via -I does not cover the same area as the primary grid - aborting\n");
-					Return (GMT_GRDIO_DOMAIN_VIOLATION);
-				}
-				if (GMT_Open_VirtualFile (API, GMT_IS_GRID, GMT_IS_SURFACE, GMT_OUT|GMT_IS_REFERENCE, NULL, int_z_grd))
+			if (Ctrl->I.file) {	/* Gave a file to derive from. In case it is a tiled grid we read it in here */
+				if ((I_data = GMT_Read_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_CONTAINER_AND_DATA|pad_mode, wesn, Ctrl->I.file, NULL)) == NULL)	/* Get grid data header*/
 					Return (API->error);
-				sprintf (cmd, "%s -R%.16g/%.16g/%.16g/%.16g -I%.16g/%.16g -r%c -G%s --GMT_HISTORY=readonly ",
-					Ctrl->I.file, region[XLO], region[XHI], region[YLO], region[YHI], Grid_orig->header->inc[GMT_X], Grid_orig->header->inc[GMT_Y], res[Grid_orig->header->registration], int_z_grd);
-				/* Call the grdsample module */
-				GMT_Report (API, GMT_MSG_INFORMATION, "Calling grdsample with args %s\n", cmd);
-				if (GMT_Call_Module (API, "grdsample", GMT_MODULE_CMD, cmd))
-					Return (API->error);
-				/* Destroy the header we read so we can get the revised on from grdsample */
-				if (GMT_Destroy_Data (API, &I_data) != GMT_NOERROR)
+				/* If dimensions don't match the data grid we must resample this secondary z-grid */
+				if (Grid_orig && (I_data->header->n_columns != Grid_orig->header->n_columns || I_data->header->n_rows != Grid_orig->header->n_rows)) {
+					char int_z_grd[GMT_VF_LEN] = {""}, *res = "gp";
+					if (I_data->header->wesn[XLO] > region[XLO] || I_data->header->wesn[XHI] < region[XHI] || I_data->header->wesn[YLO] > region[YLO] || I_data->header->wesn[YHI] < region[YHI]) {
+						GMT_Report (API, GMT_MSG_ERROR, "Your secondary data grid given via -I does not cover the same area as the primary grid - aborting\n");
+						Return (GMT_GRDIO_DOMAIN_VIOLATION);
+					}
+					if (GMT_Open_VirtualFile (API, GMT_IS_GRID, GMT_IS_SURFACE, GMT_OUT|GMT_IS_REFERENCE, NULL, int_z_grd))
+						Return (API->error);
+					sprintf (cmd, "%s -R%.16g/%.16g/%.16g/%.16g -I%.16g/%.16g -r%c -G%s --GMT_HISTORY=readonly ",
+						Ctrl->I.file, region[XLO], region[XHI], region[YLO], region[YHI], Grid_orig->header->inc[GMT_X], Grid_orig->header->inc[GMT_Y], res[Grid_orig->header->registration], int_z_grd);
+					/* Call the grdsample module */
+					GMT_Report (API, GMT_MSG_INFORMATION, "Calling grdsample with args %s\n", cmd);
+					if (GMT_Call_Module (API, "grdsample", GMT_MODULE_CMD, cmd))
+						Return (API->error);
+					/* Destroy the header we read so we can get the revised on from grdsample */
+					if (GMT_Destroy_Data (API, &I_data) != GMT_NOERROR)
+						Return (API->error);
+					/* Obtain the resampled data from the virtual file */
+					if ((I_data = GMT_Read_VirtualFile (API, int_z_grd)) == NULL)
+						Return (API->error);
+				}
+				else if ((I_data = GMT_Read_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_DATA_ONLY|pad_mode, wesn, Ctrl->I.file, I_data)) == NULL)	/* Get grid data */
 					Return (API->error);
-				/* Obtain the resampled data from the virtual file */
-				if ((I_data = GMT_Read_VirtualFile (API, int_z_grd)) == NULL)
+				if (GMT_Open_VirtualFile (API, GMT_IS_GRID, GMT_IS_SURFACE, GMT_IN|GMT_IS_REFERENCE, I_data, int4_grd))
 					Return (API->error);
+				got_int4_grid = true;
 			}
-			else if ((I_data = GMT_Read_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_DATA_ONLY|pad_mode, wesn, Ctrl->I.file, I_data)) == NULL)	/* Get grid data */
+			/* Prepare the grdgradient arguments using selected -A -N and the data region in effect.  If we read in a tiled grid
+			 * then it was made with 0/360 so we must use that region in grdgradient.  For non-tiles, we read the actual grid
+			 * AFTER calling gmt_mapsetup which changes the region.  The tiled region remains unchanged because it is read in
+			 * all at once as it is being assembled.  This fixes https://github.com/GenericMappingTools/gmt/issues/3694 */
+			sprintf (cmd, "-G%s -A%s -N%s+a%s -R%.16g/%.16g/%.16g/%.16g --GMT_HISTORY=readonly ",
+				int_grd, Ctrl->I.azimuth, Ctrl->I.method, Ctrl->I.ambient, region[XLO], region[XHI], region[YLO], region[YHI]);
+			if (got_data_tiles)	/* Use the virtual file we made earlier when first getting a tiled grid */
+				strcat (cmd, data_grd);
+			else if (got_int4_grid)	/* Use the virtual file just assigned a few lines above this call */
+				strcat (cmd, int4_grd);
+			else {	/* Default is to use the data file; we quote it in case there are spaces in the filename */
+				gmt_filename_set (Ctrl->In.file);	/* Replace any spaces with ASCII 29 */
+				strcat (cmd, Ctrl->In.file);
+				gmt_filename_get (Ctrl->In.file);	/* Replace any ASCII 29 with spaces */
+			}
+			/* Call the grdgradient module */
+			GMT_Report (API, GMT_MSG_INFORMATION, "Calling grdgradient with args %s\n", cmd);
+			if (GMT_Call_Module (API, "grdgradient", GMT_MODULE_CMD, cmd))
 				Return (API->error);
-			if (GMT_Open_VirtualFile (API, GMT_IS_GRID, GMT_IS_SURFACE, GMT_IN|GMT_IS_REFERENCE, I_data, int4_grd))
+			/* Obtain the data from the virtual file */
+			if ((Intens_orig = GMT_Read_VirtualFile (API, int_grd)) == NULL)
 				Return (API->error);
-			got_int4_grid = true;
-		}
-		/* Prepare the grdgradient arguments using selected -A -N and the data region in effect.  If we read in a tiled grid
-		 * then it was made with 0/360 so we must use that region in grdgradient.  For non-tiles, we read the actual grid
-		 * AFTER calling gmt_mapsetup which changes the region.  The tiled region remains unchanged because it is read in
-		 * all at once as it is being assembled.  This fixes https://github.com/GenericMappingTools/gmt/issues/3694 */
-		sprintf (cmd, "-G%s -A%s -N%s+a%s -R%.16g/%.16g/%.16g/%.16g --GMT_HISTORY=readonly ",
-			int_grd, Ctrl->I.azimuth, Ctrl->I.method, Ctrl->I.ambient, region[XLO], region[XHI], region[YLO], region[YHI]);
-		if (got_data_tiles)	/* Use the virtual file we made earlier when first getting a tiled grid */
-			strcat (cmd, data_grd);
-		else if (got_int4_grid)	/* Use the virtual file just assigned a few lines above this call */
-			strcat (cmd, int4_grd);
-		else {	/* Default is to use the data file; we quote it in case there are spaces in the filename */
-			gmt_filename_set (Ctrl->In.file);	/* Replace any spaces with ASCII 29 */
-			strcat (cmd, Ctrl->In.file);
-			gmt_filename_get (Ctrl->In.file);	/* Replace any ASCII 29 with spaces */
-		}
-		/* Call the grdgradient module */
-		GMT_Report (API, GMT_MSG_INFORMATION, "Calling grdgradient with args %s\n", cmd);
-		if (GMT_Call_Module (API, "grdgradient", GMT_MODULE_CMD, cmd))
-			Return (API->error);
-		/* Obtain the data from the virtual file */
-		if ((Intens_orig = GMT_Read_VirtualFile (API, int_grd)) == NULL)
-			Return (API->error);
-		if (got_data_tiles)
-			GMT_Close_VirtualFile (API, data_grd);
-		else if (got_int4_grid)	/* Use the virtual file we made earlier */
-			GMT_Close_VirtualFile (API, int4_grd);
+			if (got_data_tiles)
+				GMT_Close_VirtualFile (API, data_grd);
+			else if (got_int4_grid)	/* Use the virtual file we made earlier */
+				GMT_Close_VirtualFile (API, int4_grd);
+			if (spec[0])	/* Keep a session-cached copy so repeated renderings can skip grdsample and grdgradient */
+				gmtlib_grdcache_store_derived (GMT, int_source, spec, Intens_orig);
+		}
 	}
 
 	if (got_z_grid) {	/* Get grid dimensions */
@@ -1872,18 +1982,27 @@ EXTERN_MSC int GMT_grdimage (void *V_API, int mode, void *args) {
 		if (Ctrl->D.active && (I->header->n_columns != Intens_orig->header->n_columns || I->header->n_rows != Intens_orig->header->n_rows)) {
 			/* Resize illumination grid to match the dimensions of the image via a call to grdsample */
 
-			char in_string[GMT_VF_LEN] = {""}, out_string[GMT_VF_LEN] = {""};
-    		/* Associate the intensity grid with an open virtual file - in_string will then hold the name of this input "file" */
-    		GMT_Open_VirtualFile (API, GMT_IS_GRID, GMT_IS_SURFACE, GMT_IN|GMT_IS_REFERENCE, Intens_orig, in_string);
-   			/* Create a virtual file to hold the resampled grid - out_string then holds the name of this output "file" */
-    		GMT_Open_VirtualFile (API, GMT_IS_GRID, GMT_IS_SURFACE, GMT_OUT|GMT_IS_REFERENCE, NULL, out_string);
-			/* Create the command to do the resampling via the grdsample module */
-			sprintf (cmd, "%s -G%s -I%d+/%d+ --GMT_HISTORY=readonly", in_string, out_string, (int)Conf->n_columns, (int)Conf->n_rows);
-			GMT_Report (API, GMT_MSG_INFORMATION, "Calling grdsample with args %s\n", cmd);
-			if (GMT_Call_Module (GMT->parent, "grdsample", GMT_MODULE_CMD, cmd) != GMT_NOERROR)	/* Do the resampling */
-				return (API->error);
-   			/* Obtain the resmapled intensity grid from the virtual file */
-    		G2 = GMT_Read_VirtualFile (API, out_string);
+			char in_string[GMT_VF_LEN] = {""}, out_string[GMT_VF_LEN] = {""}, spec[GMT_LEN256] = {""};
+			if (!gmt_M_file_is_memory (Ctrl->I.file))	/* Resampling of a local file that the session cache can replay */
+				snprintf (spec, GMT_LEN256, "resample|%.12g/%.12g/%.12g/%.12g|%d/%d", region[XLO], region[XHI], region[YLO], region[YHI], (int)Conf->n_columns, (int)Conf->n_rows);
+			if (spec[0] && (G2 = gmtlib_grdcache_fetch_derived (GMT, Ctrl->I.file, spec)) != NULL) {	/* This exact resampling was done earlier in the session */
+				GMT_Report (API, GMT_MSG_INFORMATION, "Reuse session-cached resampled intensity grid for %s\n", Ctrl->I.file);
+			}
+			else {
+	    		/* Associate the intensity grid with an open virtual file - in_string will then hold the name of this input "file" */
+	    		GMT_Open_VirtualFile (API, GMT_IS_GRID, GMT_IS_SURFACE, GMT_IN|GMT_IS_REFERENCE, Intens_orig, in_string);
+	   			/* Create a virtual file to hold the resampled grid - out_string then holds the name of this output "file" */
+	    		GMT_Open_VirtualFile (API, GMT_IS_GRID, GMT_IS_SURFACE, GMT_OUT|GMT_IS_REFERENCE, NULL, out_string);
+				/* Create the command to do the resampling via the grdsample module */
+				sprintf (cmd, "%s -G%s -I%d+/%d+ --GMT_HISTORY=readonly", in_string, out_string, (int)Conf->n_columns, (int)Conf->n_rows);
+				GMT_Report (API, GMT_MSG_INFORMATION, "Calling grdsample with args %s\n", cmd);
+				if (GMT_Call_Module (GMT->parent, "grdsample", GMT_MODULE_CMD, cmd) != GMT_NOERROR)	/* Do the resampling */
+					return (API->error);
+	   			/* Obtain the resmapled intensity grid from the virtual file */
+	    		G2 = GMT_Read_VirtualFile (API, out_string);
+				if (spec[0])	/* Keep a session-cached copy so repeated renderings can skip grdsample */
+					gmtlib_grdcache_store_derived (GMT, Ctrl->I.file, spec, G2);
+			}
 			if (GMT_Destroy_Data (API, &Intens_orig) != GMT_NOERROR) {	/* We can now delete the original intensity grid ... */
 				Return (API->error);
 			}
@@ -2208,10 +2327,14 @@ tr_image:		GMT_Report (API, GMT_MSG_INFORMATION, "Project the input image\n");
 	Conf->actual_col = gmt_M_memory (GMT, NULL, Conf->n_columns, unsigned int);	/* Deal with any reversal of the x-axis due to -J */
 	for (col = 0; col < (unsigned int)Conf->n_columns; col++) Conf->actual_col[col] = (normal_x) ? col : Conf->n_columns - col - 1;
 
+	if (P) gmt_cpt_prep_index (GMT, P);	/* Build the quantized CPT index serially since the render loops below look up colors in parallel */
+
 	if (plot_squares) goto ready;
 
 	rgb_cube_scan = (P && Ctrl->Q.active && !Ctrl->A.active);	/* Need to look for unique rgb for PostScript masking */
 
+	if (got_z_grid) grdimage_cpt_lut_init (GMT, Conf);	/* Speed up the CPT slice lookups below, when possible */
+
 	/* Evaluate colors at least once (try = 0), but may do twice if -Q is active and we need to select another unique NaN color not used in the image */
 	for (try = 0, done = false; !done && try < 2; try++) {
 		if (got_z_grid) {	/* Dealing with Grids and CPT lookup */
@@ -2413,6 +2536,7 @@ basemap_and_free:
 
 	gmt_M_free (GMT, Conf->actual_row);
 	gmt_M_free (GMT, Conf->actual_col);
+	gmt_M_free (GMT, Conf->z_lut);
 	gmt_M_free (GMT, Conf);
 
 	/* May return a flag that the image/PS had no data (see -W), or just NO_ERROR [for grd2kml] */
@@ -56,6 +56,8 @@ enum Opt_L_modes {
 	GRDINFO_MEDIAN	= 2,
 	GRDINFO_MODE	= 4};
 
+#define GRDINFO_BAND_ROWS	256	/* Number of grid rows to read per band when scanning with -M+s */
+
 enum Opt_M_modes {
 	GRDINFO_FORCE_REPORT	= 1,
 	GRDINFO_FORCE			= 2,
@@ -90,9 +92,11 @@ struct GRDINFO_CTRL {
 		unsigned int status;
 		double inc[2];
 	} I;
-	struct GRDINFO_M {	/* -M[c|f] */
+	struct GRDINFO_M {	/* -M[c|f][+s[<step>]][+u] */
 		bool active;
+		bool update;		/* Write the extrema we find back into the grid file header (+u) */
 		unsigned int mode;	/* 1 is force, 2 is conditional */
+		unsigned int step;	/* 0 means read all the data at once; else scan in bands of rows, sampling every step node (+s) */
 	} M;
 	struct GRDINFO_L {	/* -L[0|1|2|p] */
 		bool active;
@@ -126,7 +130,7 @@ static int usage (struct GMTAPI_CTRL *API, int level) {
 	const char *name = gmt_show_name_and_purpose (API, THIS_MODULE_LIB, THIS_MODULE_CLASSIC_NAME, THIS_MODULE_PURPOSE);
 	if (level == GMT_MODULE_PURPOSE) return (GMT_NOERROR);
 	GMT_Usage (API, 0, "usage: %s %s [-C[n|t]] [-D[<offx>[/<offy>]][+i]] [-E[x|y][+l|L|u|U]] [-F] [-G] [-I[<dx>[/<dy>]|b|i|o|r]] [-L[a|0|1|2|p]] "
-		"[-M[c|f]] [%s] [-T[<dv>][+a[<alpha>]][+s]] [%s] [%s] [%s] [%s] [%s]\n", name, GMT_INGRID, GMT_Rgeo_OPT, GMT_V_OPT, GMT_f_OPT, GMT_ho_OPT, GMT_o_OPT, GMT_PAR_OPT);
+		"[-M[c|f][+s[<step>]][+u]] [%s] [-T[<dv>][+a[<alpha>]][+s]] [%s] [%s] [%s] [%s] [%s]\n", name, GMT_INGRID, GMT_Rgeo_OPT, GMT_V_OPT, GMT_f_OPT, GMT_ho_OPT, GMT_o_OPT, GMT_PAR_OPT);
 
 	if (level == GMT_SYNOPSIS) return (GMT_MODULE_SYNOPSIS);
 
@@ -173,9 +177,13 @@ static int usage (struct GMTAPI_CTRL *API, int level) {
 	GMT_Usage (API, 3, "p: Report mode (lms) and LMS-scale (MAD w.r.t. mode) of data set.");
 	GMT_Usage (API, 3, "a: All of the above.");
 	GMT_Usage (API, -2, "Note: If grid is geographic then we report area-weighted statistics.");
-	GMT_Usage (API, 1, "\n-M[c|f]");
+	GMT_Usage (API, 1, "\n-M[c|f][+s[<step>]][+u]");
 	GMT_Usage (API, -2, "\nSearch for the global data min and max locations (x0,y0{,z0}) and (x1,y1{,z1}) [Default]."
-		" Append c to only determine data min/max range if missing from the header, or f to force that search to override the header range.");
+		" Append c to only determine data min/max range if missing from the header, or f to force that search to override the header range. Optional modifiers:");
+	GMT_Usage (API, 3, "+s Scan the grid in bands of rows to limit memory use, optionally only sampling every <step> row and column [1]. "
+		"Note: A <step> > 1 yields approximate results.");
+	GMT_Usage (API, 3, "+u Update the data range stored in the grid file header with the extrema found, "
+		"so later queries can be answered from the header alone (requires an exact scan of the entire grid).");
 	GMT_Option (API, "R");
 	GMT_Usage (API, 1, "\n-T[<dv>][+a[<alpha>]][+s]");
 	GMT_Usage (API, -2, "Print global -Tvmin/vmax[/dv] (in rounded multiples of <dv>, if given). Optional modifiers:");
@@ -331,6 +339,26 @@ static int parse (struct GMT_CTRL *GMT, struct GRDINFO_CTRL *Ctrl, struct GMT_OP
 				break;
 			case 'M':	/* Global extrema and|or update missing header data range */
 				n_errors += gmt_M_repeated_module_option (API, Ctrl->M.active);
+				if ((c = gmt_first_modifier (GMT, opt->arg, "su"))) {	/* Process any modifiers */
+					unsigned int pos = 0;
+					while (gmt_getmodopt (GMT, 'M', c, "su", &pos, text, &n_errors) && n_errors == 0) {
+						switch (text[0]) {
+							case 's':	/* Scan the grid in bands of rows, optionally sampling every <step> node */
+								Ctrl->M.step = (text[1]) ? atoi (&text[1]) : 1;
+								if (Ctrl->M.step == 0) {
+									GMT_Report (API, GMT_MSG_ERROR, "Option -M: Modifier +s requires a positive step\n");
+									n_errors++;
+								}
+								break;
+							case 'u':	/* Write the extrema found back into the grid file header */
+								Ctrl->M.update = true;
+								break;
+							default:
+								break;	/* These are caught in gmt_getmodopt so break is just for Coverity */
+						}
+					}
+					c[0] = '\0';	/* Chop off the modifiers */
+				}
 				switch (opt->arg[0]) {
 					case 'c':	Ctrl->M.mode = GRDINFO_CONDITIONAL;	break;
 					case 'f':	Ctrl->M.mode = GRDINFO_FORCE;		break;
@@ -340,6 +368,7 @@ static int parse (struct GMT_CTRL *GMT, struct GRDINFO_CTRL *Ctrl, struct GMT_OP
 						n_errors++;
 						break;
 				}
+				if (c) c[0] = '+';	/* Restore the modifiers */
 				break;
 			case 'Q':	/* Expect cubes is no longer an option as we detect it automatically */
 				break;
@@ -402,6 +431,8 @@ static int parse (struct GMT_CTRL *GMT, struct GRDINFO_CTRL *Ctrl, struct GMT_OP
 									   "Option -I: Must specify a positive increment(s)\n");
 	n_errors += gmt_M_check_condition (GMT, (Ctrl->I.active || Ctrl->T.active) && Ctrl->M.active,
 	                                   "Option -M: Not compatible with -I or -T\n");
+	n_errors += gmt_M_check_condition (GMT, Ctrl->M.update && Ctrl->M.step > 1,
+	                                   "Option -M: Modifier +u requires an exact scan and cannot be combined with +s<step> for <step> > 1\n");
 	n_errors += gmt_M_check_condition (GMT, (Ctrl->I.active || Ctrl->T.active) && Ctrl->L.active,
 	                                   "Option -L: Not compatible with -I or -T\n");
 	n_errors += gmt_M_check_condition (GMT, Ctrl->T.active && Ctrl->I.active,
@@ -582,7 +613,7 @@ EXTERN_MSC int GMT_grdinfo (void *V_API, int mode, void *args) {
 	int error = 0, k_data, k_tile_id;
 	unsigned int n_grds = 0, n_cols = 0, col, level, i_status, gtype, cmode = GMT_COL_FIX, geometry = GMT_IS_TEXT;
 	unsigned int x_col_min, x_col_max, y_col_min, y_col_max, z_col_min, z_col_max, GMT_W = GMT_Z;
-	bool subset, delay, num_report, is_cube;
+	bool subset, delay, num_report, is_cube, stream = false;
 
 	uint64_t ij, n_nan = 0, n = 0;
 
@@ -750,7 +781,13 @@ EXTERN_MSC int GMT_grdinfo (void *V_API, int mode, void *args) {
 				GMT_Report (API, GMT_MSG_DEBUG, "Found valid actual data range in header - no need to read matrix\n");
 		}
 
-		if (Ctrl->E.active || Ctrl->M.mode || Ctrl->L.active || subset || Ctrl->D.mode || (Ctrl->T.mode & 2)) {	/* Need to read the data (all or subset) */
+		/* Only read the data in bands if the sole reason for reading them is the min/max scan and the whole region is wanted */
+		stream = (Ctrl->M.step && (Ctrl->M.mode == GRDINFO_FORCE_REPORT || Ctrl->M.mode == GRDINFO_FORCE) && !is_cube && !subset &&
+		          !Ctrl->E.active && !Ctrl->L.active && !Ctrl->D.mode && !(Ctrl->T.mode & 2) && !gmt_M_file_is_memory (opt->arg));
+		if (Ctrl->M.step && !stream && Ctrl->M.mode)
+			GMT_Report (API, GMT_MSG_INFORMATION, "-M+s: Other options require the full grid in memory; reading normally\n");
+
+		if (Ctrl->E.active || (Ctrl->M.mode && Ctrl->M.mode != GRDINFO_CONDITIONAL && !stream) || Ctrl->L.active || subset || Ctrl->D.mode || (Ctrl->T.mode & 2)) {	/* Need to read the data (all or subset) */
 			if (is_cube) {
 				if (GMT_Read_Data (API, GMT_IS_CUBE, GMT_IS_FILE, GMT_IS_VOLUME, GMT_DATA_ONLY, wesn, opt->arg, U) == NULL) {
 					Return (API->error);
@@ -813,7 +850,55 @@ EXTERN_MSC int GMT_grdinfo (void *V_API, int mode, void *args) {
 
 		if (Ctrl->T.mode & 2) strncpy (grdfile, opt->arg, PATH_MAX-1);
 
-		if (Ctrl->M.mode == GRDINFO_FORCE_REPORT || Ctrl->M.mode == GRDINFO_FORCE || Ctrl->L.active) {	/* Must determine the [location of] global min and max values */
+		if (stream) {	/* Determine the [location of] global min and max values by reading the grid in bands of rows */
+			unsigned int row, col, band, n_bands, row0, row1, step = Ctrl->M.step;
+			uint64_t n_scanned = 0;
+			double band_wesn[4];
+			struct GMT_GRID *B = NULL;
+
+			if (step > 1)
+				GMT_Report (API, GMT_MSG_INFORMATION, "-M+s: Only sampling every %d row and column; extrema are approximate\n", step);
+			v_min = DBL_MAX;	v_max = -DBL_MAX;	n = 0;
+			gmt_M_memcpy (band_wesn, header->wesn, 4, double);
+			n_bands = (header->n_rows + GRDINFO_BAND_ROWS - 1) / GRDINFO_BAND_ROWS;
+			for (band = 0; band < n_bands; band++) {	/* Read and scan one band of rows at the time */
+				row0 = band * GRDINFO_BAND_ROWS;
+				row1 = MIN (row0 + GRDINFO_BAND_ROWS, header->n_rows) - 1;
+				band_wesn[YHI] = header->wesn[YHI] - row0 * header->inc[GMT_Y];
+				band_wesn[YLO] = header->wesn[YHI] - (row1 + header->registration) * header->inc[GMT_Y];
+				if ((B = GMT_Read_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_CONTAINER_AND_DATA, band_wesn, opt->arg, NULL)) == NULL) {
+					Return (API->error);
+				}
+				for (row = 0; row < B->header->n_rows; row++) {
+					if ((row0 + row) % step) continue;	/* Keep the sampling phase across band boundaries */
+					for (col = 0; col < B->header->n_columns; col += step) {
+						ij = gmt_M_ijp (B->header, row, col);
+						n_scanned++;
+						if (gmt_M_is_fnan (B->data[ij])) continue;
+						if (B->data[ij] < v_min) {
+							v_min = B->data[ij];
+							x_min = gmt_M_grd_col_to_x (GMT, col, B->header);	y_min = gmt_M_grd_row_to_y (GMT, row, B->header);
+						}
+						if (B->data[ij] > v_max) {
+							v_max = B->data[ij];
+							x_max = gmt_M_grd_col_to_x (GMT, col, B->header);	y_max = gmt_M_grd_row_to_y (GMT, row, B->header);
+						}
+						n++;
+					}
+				}
+				if (GMT_Destroy_Data (API, &B) != GMT_NOERROR) {
+					Return (API->error);
+				}
+			}
+			n_nan = n_scanned - n;
+			if (n == 0)	/* Not a single valid node */
+				x_min = x_max = y_min = y_max = z_min = z_max = GMT->session.d_NaN;
+			if (Ctrl->M.mode == GRDINFO_FORCE) {	/* Update header */
+				header->z_min = v_min;
+				header->z_max = v_max;
+			}
+		}
+		else if (Ctrl->M.mode == GRDINFO_FORCE_REPORT || Ctrl->M.mode == GRDINFO_FORCE || Ctrl->L.active) {	/* Must determine the [location of] global min and max values */
 			uint64_t ij_min, ij_max, here = 0, node;
 			unsigned int col, row;
 			gmt_grdfloat *data = (is_cube) ? U->data : G->data;
@@ -856,6 +941,27 @@ EXTERN_MSC int GMT_grdinfo (void *V_API, int mode, void *args) {
 			}
 		}
 
+		if (Ctrl->M.update) {	/* Write the extrema we found back into the grid file header so later queries are header reads */
+			if (is_cube)
+				GMT_Report (API, GMT_MSG_WARNING, "-M+u: Updating the file header is only available for grids; skipped\n");
+			else if (subset)
+				GMT_Report (API, GMT_MSG_WARNING, "-M+u: Cannot update the file header from a subset region; skipped\n");
+			else if (gmt_M_file_is_memory (opt->arg) || gmt_M_file_is_remote (opt->arg) || gmt_M_file_is_url (opt->arg))
+				GMT_Report (API, GMT_MSG_WARNING, "-M+u: Can only update the header of local grid files; skipped\n");
+			else if (Ctrl->M.mode == GRDINFO_CONDITIONAL)	/* Header already held the data range; nothing to update */
+				GMT_Report (API, GMT_MSG_DEBUG, "-M+u: Header already holds the data range; no update needed\n");
+			else {	/* Set the new range in a scratch header since gmt_update_grd_info packs the z-range in place */
+				struct GMT_GRID_HEADER *h = gmt_get_header (GMT);
+				gmt_copy_gridheader (GMT, h, header);
+				h->z_min = v_min;	h->z_max = v_max;
+				if (gmt_update_grd_info (GMT, NULL, h))
+					GMT_Report (API, GMT_MSG_WARNING, "-M+u: Unable to update the header of %s\n", HH->name);
+				else
+					GMT_Report (API, GMT_MSG_INFORMATION, "Updated the data range in the header of %s\n", HH->name);
+				gmt_free_header (GMT, &h);
+			}
+		}
+
 		if (Ctrl->L.norm && gmt_M_is_geographic (GMT, GMT_IN)) {	/* Must use spherical weights */
 			W = gmt_duplicate_grid (GMT, G, GMT_DUPLICATE_ALLOC);
 			gmt_get_cellarea (GMT, W);
@@ -1342,7 +1448,7 @@ EXTERN_MSC int GMT_grdinfo (void *V_API, int mode, void *args) {
 			gmt_grdfloat *tmp_grid = NULL;
 			char *file_ptr = grdfile;	/* To avoid a warning */
 			if (is_cube) {
-				if (gmt_M_file_is_memory (file_ptr)) {	/* Must operate on a copy since sorting is required */
+				if (gmt_M_file_is_memory (file_ptr)) {	/* Must operate on a copy since the quantile selection reorders the data */
 					tmp_grid = gmt_M_memory_aligned (GMT, NULL, size, gmt_grdfloat);
 					gmt_M_memcpy (tmp_grid, G->data, size, gmt_grdfloat);
 				}
@@ -1350,16 +1456,15 @@ EXTERN_MSC int GMT_grdinfo (void *V_API, int mode, void *args) {
 					tmp_grid = U->data;
 			}
 			else {	/* Grid */
-				if (gmt_M_file_is_memory (file_ptr)) {	/* Must operate on a copy since sorting is required */
+				if (gmt_M_file_is_memory (file_ptr)) {	/* Must operate on a copy since the quantile selection reorders the data */
 					tmp_grid = gmt_M_memory_aligned (GMT, NULL, size, gmt_grdfloat);
 					gmt_M_memcpy (tmp_grid, G->data, size, gmt_grdfloat);
 				}
 				else
 					tmp_grid = G->data;
 			}
-			gmt_sort_array (GMT, tmp_grid, size, GMT_FLOAT);	/* Sort so we can find quantiles */
-			global_vmin = gmt_quantile_f (GMT, tmp_grid, Ctrl->T.alpha[XLO], size);		/* "Left" quantile */
-			global_vmax = gmt_quantile_f (GMT, tmp_grid, 100.0-Ctrl->T.alpha[XHI], size);	/* "Right" quantile */
+			global_vmin = gmt_quantile_f_inplace (GMT, tmp_grid, Ctrl->T.alpha[XLO], size);		/* "Left" quantile */
+			global_vmax = gmt_quantile_f_inplace (GMT, tmp_grid, 100.0-Ctrl->T.alpha[XHI], size);	/* "Right" quantile */
 			if (is_cube && GMT_Destroy_Data (API, &U) != GMT_NOERROR) {
 				if (gmt_M_file_is_memory (file_ptr))	/* Now free temp grid */
 					gmt_M_free (GMT, tmp_grid);
@@ -40,12 +40,23 @@
 #define THIS_MODULE_NEEDS	""
 #define THIS_MODULE_OPTIONS "-:>RVbdefghinoqs"
 
+enum grdinterpolate_reduction {	/* Directives for -A */
+	GRDINTERPOLATE_MEAN = 0,
+	GRDINTERPOLATE_STD,
+	GRDINTERPOLATE_QUANTILE,
+	GRDINTERPOLATE_TREND};
+
 struct GRDINTERPOLATE_CTRL {
 	struct GRDINTERPOLATE_In {
 		bool active;
 		char **file;
 		unsigned int n_files;
 	} In;
+	struct GRDINTERPOLATE_A {	/* -Am|s|t|q[<quantile>] */
+		bool active;
+		unsigned int mode;
+		double quantile;
+	} A;
 	struct GRDEDIT_D {	/* -D[+x<xname>][+yyname>][+z<zname>][+v<zname>][+s<scale>][+o<offset>][+n<invalid>][+t<title>][+r<remark>] */
 		bool active;
 		char *information;
@@ -119,7 +130,7 @@ static void Free_Ctrl (struct GMT_CTRL *GMT, struct GRDINTERPOLATE_CTRL *C) {	/*
 static int usage (struct GMTAPI_CTRL *API, int level) {
 	const char *name = gmt_show_name_and_purpose (API, THIS_MODULE_LIB, THIS_MODULE_CLASSIC_NAME, THIS_MODULE_PURPOSE);
 	if (level == GMT_MODULE_PURPOSE) return (GMT_NOERROR);
-	GMT_Usage (API, 0, "usage: %s <cube> | <grd1> <grd2> <grd3> ... -G<outfile> [%s] "
+	GMT_Usage (API, 0, "usage: %s <cube> | <grd1> <grd2> <grd3> ... -G<outfile> [-Am|s|t|q[<quantile>]] [%s] "
 		"[-E<file>|<line1>[,<line2>,...][+a<az>][+g][+i<step>][+l<length>][+n<np>][+o<az>][+p][+r<radius>][+x]] "
 		"[-F%s [%s] [-S<x>/<y>|<table>[+h<header>]] [-T[<min>/<max>/]<inc>[+i|n]] [%s] "
 		"[-Z[<levels>]] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s]\n",
@@ -137,6 +148,13 @@ static int usage (struct GMTAPI_CTRL *API, int level) {
 		"series of 2-D grids instead of a cube, include a floating-point C-format statement in <outfile> set via "
 		"-G for embedding the level in the file name.");
 	GMT_Message (API, GMT_TIME_NONE, "\n  OPTIONAL ARGUMENTS:\n");
+	GMT_Usage (API, 1, "\n-Am|s|t|q[<quantile>]");
+	GMT_Usage (API, -2, "Reduce the cube across the 3rd dimension and write a single 2-D grid via -G. Append directive:");
+	GMT_Usage (API, 3, "m: Mean of each vertical column of nodes.");
+	GMT_Usage (API, 3, "s: Standard deviation about the column mean.");
+	GMT_Usage (API, 3, "q: Quantile in percent; optionally append <quantile> [50].");
+	GMT_Usage (API, 3, "t: Rate of the best-fitting linear trend versus level.");
+	GMT_Usage (API, -2, "NaN nodes are skipped level-wise. Cannot be combined with -E, -S, or -T.");
 	gmt_cube_info_syntax (API->GMT, 'D');
 	gmt_explain_lines (API, 1);
 	gmt_explain_interpolate_mode (API);
@@ -193,6 +211,22 @@ static int parse (struct GMT_CTRL *GMT, struct GRDINTERPOLATE_CTRL *Ctrl, struct
 
 			/* Processes program-specific parameters */
 
+			case 'A':	/* Reduce the cube across the 3rd dimension */
+				n_errors += gmt_M_repeated_module_option (API, Ctrl->A.active);
+				switch (opt->arg[0]) {
+					case 'm': Ctrl->A.mode = GRDINTERPOLATE_MEAN;	break;
+					case 's': Ctrl->A.mode = GRDINTERPOLATE_STD;	break;
+					case 't': Ctrl->A.mode = GRDINTERPOLATE_TREND;	break;
+					case 'q':
+						Ctrl->A.mode = GRDINTERPOLATE_QUANTILE;
+						Ctrl->A.quantile = (opt->arg[1]) ? atof (&opt->arg[1]) : 50.0;
+						break;
+					default:
+						GMT_Report (API, GMT_MSG_ERROR, "Option -A: Append directive m, s, t, or q[<quantile>]\n");
+						n_errors++;
+						break;
+				}
+				break;
 			case 'D':	/* Give grid information */
 				n_errors += gmt_M_repeated_module_option (API, Ctrl->D.active);
 				n_errors += gmt_get_required_string (GMT, opt->arg, opt->option, 0, &Ctrl->D.information);
@@ -272,6 +306,9 @@ static int parse (struct GMT_CTRL *GMT, struct GRDINTERPOLATE_CTRL *Ctrl, struct
 		n_errors += gmt_M_check_condition (GMT, n_files != 1, "Must specify only one output file name\n");
 	}
 	n_errors += gmt_M_check_condition (GMT, Ctrl->E.active && Ctrl->S.active, "Options -E and -S cannot be used together\n");
+	n_errors += gmt_M_check_condition (GMT, Ctrl->A.active && (Ctrl->E.active || Ctrl->S.active || Ctrl->T.active), "Option -A: Cannot be combined with -E, -S, or -T\n");
+	n_errors += gmt_M_check_condition (GMT, Ctrl->A.active && Ctrl->A.mode == GRDINTERPOLATE_QUANTILE && (Ctrl->A.quantile < 0.0 || Ctrl->A.quantile > 100.0), "Option -A: Quantile must be in the 0-100 range\n");
+	n_errors += gmt_M_check_condition (GMT, Ctrl->A.active && Ctrl->G.file && strchr (Ctrl->G.file, '%'), "Option -A: Output is a single 2-D grid so -G cannot be a filename template\n");
 	if (Ctrl->E.active) {
 		n_errors += gmt_M_check_condition (GMT, strstr (Ctrl->E.lines, "+d"), "Option -E: Unrecognized modifier +d\n");
 	}
@@ -357,7 +394,7 @@ EXTERN_MSC int GMT_grdinterpolate (void *V_API, int mode, void *args) {
 			level = Ctrl->Z.T.array;	/* Pointer to allocated array with the level values */
 			z_is_abstime = Ctrl->Z.T.temporal;	/* In case we parsed abs time for levels */
 		}
-		if (!(Ctrl->T.active || Ctrl->E.active || Ctrl->S.active)) convert_to_cube = true;	/* Just want to build cube from input stack */
+		if (!(Ctrl->T.active || Ctrl->E.active || Ctrl->S.active || Ctrl->A.active)) convert_to_cube = true;	/* Just want to build cube from input stack */
 	}
 	else if (gmt_M_file_is_memory (Ctrl->In.file[0])) {	/* Got a memory reference */
 		if (Ctrl->In.n_files == 1) {	/* Got one memory reference so it must be a cube */
@@ -392,7 +429,7 @@ EXTERN_MSC int GMT_grdinterpolate (void *V_API, int mode, void *args) {
 		Return (GMT_RUNTIME_ERROR);
 	}
 
-	if (got_cube && !(Ctrl->E.active || Ctrl->S.active || Ctrl->T.active)) {	/* No other options - do a 3-D grdcut */
+	if (got_cube && !(Ctrl->E.active || Ctrl->S.active || Ctrl->T.active || Ctrl->A.active)) {	/* No other options - do a 3-D grdcut */
 		GMT_Report (API, GMT_MSG_INFORMATION, "Data cube read but none of -E, -S -T were given means we return all layers within -R\n");
 	}
 	/* Create output level array, if selected */
@@ -730,6 +767,130 @@ EXTERN_MSC int GMT_grdinterpolate (void *V_API, int mode, void *args) {
 		Return (GMT_NOERROR);
 	}
 
+	if (Ctrl->A.active) {	/* Reduce the cube across the 3rd dimension to a single 2-D grid */
+		static char *operation[4] = {"Mean", "Standard deviation", "Quantile", "Linear trend rate"};
+		char remark[GMT_LEN128] = {""};
+		openmp_int row, col;
+		uint64_t node;
+		unsigned int *n_in = NULL;
+		gmt_grdfloat *stack = NULL;
+		double value, *s_z = NULL, *s_z2 = NULL, *s_t = NULL, *s_t2 = NULL, *s_tz = NULL, *wesn_p = NULL;
+		struct GMT_GRID *L = NULL;
+
+		if (GMT->common.R.active[RSET]) wesn_p = GMT->common.R.wesn;	/* Only read the subset */
+
+		for (k = 0; k < n_layers; k++) {	/* Stream one level at a time so only the accumulators stay in memory */
+			gmt_grdfloat *layer = NULL;
+			struct GMT_GRID_HEADER *h = NULL;
+			if (C[GMT_IN]) {	/* Cube already in memory; just point to the k'th slice */
+				layer = &C[GMT_IN]->data[k * C[GMT_IN]->header->size];
+				h = C[GMT_IN]->header;
+			}
+			else {	/* Read the k'th level as a 2-D grid */
+				if (Ctrl->Z.active)	/* Get the k'th file */
+					sprintf (file, "%s", Ctrl->In.file[k]);
+				else	/* Get the k'th layer from 3-D cube possibly via a selected variable */
+					sprintf (file, "%s?%s[%" PRIu64 "]", Ctrl->In.file[0], cube_layer, k);
+				if ((L = GMT_Read_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_CONTAINER_AND_DATA, wesn_p, file, NULL)) == NULL)
+					Return (API->error);
+				layer = L->data;	h = L->header;
+			}
+			if (Grid == NULL) {	/* First level: create the output grid and the accumulators */
+				if ((Grid = GMT_Create_Data (API, GMT_IS_GRID, GMT_IS_SURFACE, GMT_CONTAINER_AND_DATA, NULL, h->wesn, h->inc, h->registration, GMT_NOTSET, NULL)) == NULL)
+					Return (API->error);
+				if (h->x_units[0]) strncpy (Grid->header->x_units, h->x_units, GMT_GRID_UNIT_LEN80);
+				if (h->y_units[0]) strncpy (Grid->header->y_units, h->y_units, GMT_GRID_UNIT_LEN80);
+				if (Ctrl->A.mode == GRDINTERPOLATE_QUANTILE) {	/* Order statistics need all the levels for a node at hand */
+					if ((stack = gmt_M_memory (GMT, NULL, Grid->header->size * n_layers, gmt_grdfloat)) == NULL) Return (GMT_MEMORY_ERROR);
+				}
+				else {	/* Running sums suffice */
+					if ((n_in = gmt_M_memory (GMT, NULL, Grid->header->size, unsigned int)) == NULL) Return (GMT_MEMORY_ERROR);
+					if ((s_z = gmt_M_memory (GMT, NULL, Grid->header->size, double)) == NULL) Return (GMT_MEMORY_ERROR);
+					if (Ctrl->A.mode == GRDINTERPOLATE_STD && (s_z2 = gmt_M_memory (GMT, NULL, Grid->header->size, double)) == NULL) Return (GMT_MEMORY_ERROR);
+					if (Ctrl->A.mode == GRDINTERPOLATE_TREND) {	/* NaN-skipping means the level sums vary per node */
+						if ((s_t  = gmt_M_memory (GMT, NULL, Grid->header->size, double)) == NULL) Return (GMT_MEMORY_ERROR);
+						if ((s_t2 = gmt_M_memory (GMT, NULL, Grid->header->size, double)) == NULL) Return (GMT_MEMORY_ERROR);
+						if ((s_tz = gmt_M_memory (GMT, NULL, Grid->header->size, double)) == NULL) Return (GMT_MEMORY_ERROR);
+					}
+				}
+			}
+			else if (h->n_rows != Grid->header->n_rows || h->n_columns != Grid->header->n_columns) {
+				GMT_Report (API, GMT_MSG_ERROR, "Level %" PRIu64 " (%s) is not coregistered with the first level\n", k, file);
+				Return (GMT_RUNTIME_ERROR);
+			}
+#ifdef _OPENMP
+#pragma omp parallel for private(row,col,node,value) shared(GMT,Grid,Ctrl,layer,stack,n_in,s_z,s_z2,s_t,s_t2,s_tz,n_layers,level,k)
+#endif
+			for (row = 0; row < (openmp_int)Grid->header->n_rows; row++) {	/* Accumulate this level */
+				node = gmt_M_ijp (Grid->header, row, 0);
+				for (col = 0; col < (openmp_int)Grid->header->n_columns; col++, node++) {
+					if (Ctrl->A.mode == GRDINTERPOLATE_QUANTILE) {	/* Just build the per-node stacks; NaNs are swept by gmt_quantile_f_inplace */
+						stack[node*n_layers+k] = layer[node];
+						continue;
+					}
+					value = layer[node];
+					if (gmt_M_is_dnan (value)) continue;	/* Only valid nodes enter the sums */
+					n_in[node]++;
+					s_z[node] += value;
+					if (Ctrl->A.mode == GRDINTERPOLATE_STD)
+						s_z2[node] += value * value;
+					else if (Ctrl->A.mode == GRDINTERPOLATE_TREND) {
+						s_t[node]  += level[k];
+						s_t2[node] += level[k] * level[k];
+						s_tz[node] += level[k] * value;
+					}
+				}
+			}
+			if (L && GMT_Destroy_Data (API, &L))	/* Done with this level */
+				Return (API->error);
+		}
+
+		/* Finalize the reduction per node */
+#ifdef _OPENMP
+#pragma omp parallel for private(row,col,node,value) shared(GMT,Grid,Ctrl,stack,n_in,s_z,s_z2,s_t,s_t2,s_tz,n_layers)
+#endif
+		for (row = 0; row < (openmp_int)Grid->header->n_rows; row++) {
+			double d;
+			node = gmt_M_ijp (Grid->header, row, 0);
+			for (col = 0; col < (openmp_int)Grid->header->n_columns; col++, node++) {
+				switch (Ctrl->A.mode) {
+					case GRDINTERPOLATE_MEAN:
+						value = (n_in[node]) ? s_z[node] / n_in[node] : GMT->session.d_NaN;
+						break;
+					case GRDINTERPOLATE_STD:
+						value = (n_in[node] > 1) ? sqrt ((s_z2[node] - s_z[node] * s_z[node] / n_in[node]) / (n_in[node] - 1.0)) : GMT->session.d_NaN;
+						break;
+					case GRDINTERPOLATE_QUANTILE:
+						value = gmt_quantile_f_inplace (GMT, &stack[node*n_layers], Ctrl->A.quantile, n_layers);
+						break;
+					default:	/* GRDINTERPOLATE_TREND */
+						d = (n_in[node] > 1) ? s_t2[node] - s_t[node] * s_t[node] / n_in[node] : 0.0;
+						value = (d > 0.0) ? (s_tz[node] - s_t[node] * s_z[node] / n_in[node]) / d : GMT->session.d_NaN;
+						break;
+				}
+				Grid->data[node] = (gmt_grdfloat)value;
+			}
+		}
+		gmt_M_free (GMT, stack);	gmt_M_free (GMT, n_in);	gmt_M_free (GMT, s_z);	gmt_M_free (GMT, s_z2);
+		gmt_M_free (GMT, s_t);	gmt_M_free (GMT, s_t2);	gmt_M_free (GMT, s_tz);
+		if (C[GMT_IN]) {	/* Done with the input cube */
+			if (GMT_Destroy_Data (API, &C[GMT_IN]))
+				Return (API->error);
+		}
+		else if (!Ctrl->Z.active)
+			gmt_M_free (GMT, level);
+		if (Ctrl->A.mode == GRDINTERPOLATE_QUANTILE)
+			sprintf (remark, "%g%% quantile across %" PRIu64 " levels", Ctrl->A.quantile, n_layers);
+		else
+			sprintf (remark, "%s across %" PRIu64 " levels", operation[Ctrl->A.mode], n_layers);
+		if (GMT_Set_Comment (API, GMT_IS_GRID, GMT_COMMENT_IS_REMARK, remark, Grid)) Return (API->error);
+		if (GMT_Set_Comment (API, GMT_IS_GRID, GMT_COMMENT_IS_OPTION | GMT_COMMENT_IS_COMMAND, options, Grid)) Return (API->error);
+		GMT_Report (API, GMT_MSG_INFORMATION, "Write reduced grid (%s) to output file %s\n", remark, Ctrl->G.file);
+		if (GMT_Write_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_CONTAINER_AND_DATA, NULL, Ctrl->G.file, Grid) != GMT_NOERROR)
+			Return (API->error);
+		Return (GMT_NOERROR);
+	}
+
 	/* Get here if neither -E nor -S were selected: We want to interpolate for one or more horizontal slices in the cube and need to read/write cubes */
 
 	int_mode = gmt_set_interpolate_mode (GMT, Ctrl->F.mode, Ctrl->F.type);	/* What mode we pass to the interpolation */
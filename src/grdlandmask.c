@@ -257,7 +257,7 @@ GMT_LOCAL void grdlandmask_assign_node (struct GMT_CTRL *GMT, struct GMT_GRID *G
 
 EXTERN_MSC int GMT_grdlandmask (void *V_API, int mode, void *args) {
 	bool temp_shift = false, wrap, used_polygons, double_dip;
-	unsigned int base = 3, k, bin, np, side, np_new;
+	unsigned int base = 3, k, bin, np, side, np_new, n_threads = 1, t;
 	int row, row_min, row_max, col, col_min, col_max, nx1, ny1;
 	int ii, i, direction, err, ind, error = 0;
 	openmp_int rowu, colu;
@@ -280,6 +280,7 @@ EXTERN_MSC int GMT_grdlandmask (void *V_API, int mode, void *args) {
 	struct GMT_GRID_HEADER *C = NULL;
 	struct GMT_GRID_HEADER_HIDDEN *HH = NULL;
 	struct GMT_GSHHS_POL *p = NULL;
+	struct GMT_SCANLINE **SLX = NULL;
 	struct GRDLANDMASK_BINCROSS *X = NULL;
 	struct GRDLANDMASK_CTRL *Ctrl = NULL;
 	struct GMT_CTRL *GMT = NULL, *GMT_cpy = NULL;
@@ -380,6 +381,11 @@ EXTERN_MSC int GMT_grdlandmask (void *V_API, int mode, void *args) {
 	y = gmt_M_memory (GMT, NULL, Grid->header->n_rows, double);
 	if (Ctrl->E.linetrace)
 		X = gmt_M_memory (GMT, X, nx_alloc, struct GRDLANDMASK_BINCROSS);
+#ifdef _OPENMP
+	n_threads = omp_get_max_threads ();	/* One scanline workspace per thread since we parallelize over rows */
+#endif
+	SLX = gmt_M_memory (GMT, NULL, n_threads, struct GMT_SCANLINE *);
+	for (t = 0; t < n_threads; t++) SLX[t] = gmt_scanline_init (GMT);
 
 	nx1 = (int)Grid->header->n_columns - 1;	ny1 = (int)Grid->header->n_rows - 1;
 
@@ -452,18 +458,28 @@ EXTERN_MSC int GMT_grdlandmask (void *V_API, int mode, void *args) {
 				f_level = (gmt_grdfloat)(2*p[k].level);
 
 #ifdef _OPENMP
-#pragma omp parallel for private(row,col,side,ij) shared(row_min,row_max,col_min,col_max,GMT,x,y,p,k,Ctrl,Grid,f_level)
+#pragma omp parallel for private(row,col,side,ij) shared(row_min,row_max,col_min,col_max,GMT,x,y,p,k,Ctrl,Grid,f_level,SLX)
 #endif
 				for (row = row_min; row <= row_max; row++) {
+					struct GMT_SCANLINE *SL = SLX[0];
+#ifdef _OPENMP
+					SL = SLX[omp_get_thread_num ()];
+#endif
 					assert (row >= 0);	/* Just in case we have a logic bug somewhere */
+					/* Build the sorted list of polygon edge crossings for this row once; each node then
+					 * classifies from the crossing winding counts unless it sits so close to the boundary
+					 * that we must fall back on the full per-node winding test */
+					gmt_scanline_build (GMT, SL, p[k].lon, p[k].lat, p[k].n, y[row]);
+					ij = gmt_M_ijp (Grid->header, row, 0);	/* Start of this padded row; the node is then ij + col */
 					for (col = col_min; col <= col_max; col++) {
 
-						if ((side = gmt_non_zero_winding (GMT, x[col], y[row], p[k].lon, p[k].lat, p[k].n)) < Ctrl->E.inside) continue;	/* Outside */
+						if (!gmt_scanline_side (SL, x[col], &side))	/* Too close to the boundary to be sure */
+							side = gmt_non_zero_winding (GMT, x[col], y[row], p[k].lon, p[k].lat, p[k].n);
+						if (side < Ctrl->E.inside) continue;	/* Outside */
 
 						/* Here, point is inside, we must assign value */
 
-						ij = gmt_M_ijp (Grid->header, row, col);
-						if (f_level > Grid->data[ij]) Grid->data[ij] = f_level;
+						if (f_level > Grid->data[ij+col]) Grid->data[ij+col] = f_level;
 					}
 				}
 			}
@@ -621,11 +637,18 @@ EXTERN_MSC int GMT_grdlandmask (void *V_API, int mode, void *args) {
 #pragma omp parallel for private(row,col,ii,ij) shared(row_min,row_max,col_min,col_max,wrap,nx1,Grid,f_level)
 #endif
 			for (row = row_min; row <= row_max; row++) {
-				for (col = col_min; col <= col_max; col++) {
-					ii = (wrap) ? col % (int)Grid->header->n_columns : col;
-					if (ii < 0 || ii > nx1) continue;
-					ij = gmt_M_ijp (Grid->header, row, ii);
-					Grid->data[ij] = f_level;
+				if (wrap) {	/* Must fold each col back into the grid */
+					for (col = col_min; col <= col_max; col++) {
+						ii = col % (int)Grid->header->n_columns;
+						if (ii < 0 || ii > nx1) continue;
+						ij = gmt_M_ijp (Grid->header, row, ii);
+						Grid->data[ij] = f_level;
+					}
+				}
+				else {	/* Contiguous span of the row; unit stride with no per-node index math */
+					ij = gmt_M_ijp (Grid->header, row, col_min);
+					for (col = col_min; col <= col_max; col++, ij++)
+						Grid->data[ij] = f_level;
 				}
 			}
 		}
@@ -634,6 +657,8 @@ EXTERN_MSC int GMT_grdlandmask (void *V_API, int mode, void *args) {
 	}
 
 	gmt_shore_cleanup (GMT, &c);
+	for (t = 0; t < n_threads; t++) gmt_scanline_free (GMT, &SLX[t]);
+	gmt_M_free (GMT, SLX);
 	gmt_M_free (GMT, x);
 	gmt_M_free (GMT, y);
 	if (Ctrl->E.linetrace) gmt_M_free (GMT, X);
@@ -308,7 +308,7 @@ static int parse (struct GMT_CTRL *GMT, struct GRDMASK_CTRL *Ctrl, struct GMT_OP
 
 EXTERN_MSC int GMT_grdmask (void *V_API, int mode, void *args) {
 	bool periodic = false, periodic_grid = false, do_test = true;
-	bool wrap_180, replicate_x, replicate_y, worry_about_jumps;
+	bool wrap_180, replicate_x, replicate_y, worry_about_jumps, use_scanline = false, decided;
 	unsigned int side = 0, known_side;
 	unsigned int tbl, gmode, n_pol = 0, n_cols = 2, x_wrap, y_wrap;
 	int row, col, row_start, row_end, col_start, col_end, ii, jj, n_columns, n_rows, error = 0, col_0, row_0;
@@ -327,6 +327,7 @@ EXTERN_MSC int GMT_grdmask (void *V_API, int mode, void *args) {
 	struct GMT_DATASEGMENT *S = NULL;
 	struct GMT_DATASET_HIDDEN *DH = NULL;
 	struct GMT_DATASEGMENT_HIDDEN *SH = NULL;
+	struct GMT_SCANLINE *SL = NULL;
 	struct GRDMASK_CTRL *Ctrl = NULL;
 	struct GMT_CTRL *GMT = NULL, *GMT_cpy = NULL;
 	struct GMT_OPTION *options = NULL;
@@ -479,6 +480,7 @@ EXTERN_MSC int GMT_grdmask (void *V_API, int mode, void *args) {
 
 	if (Ctrl->S.mode == GRDMASK_N_CART_MASK) radius = 1;	/* radius not used in this case and this avoids another if test */
 	worry_about_jumps = (gmt_M_x_is_lon (GMT, GMT_IN) && !gmt_grd_is_global (GMT, Grid->header));
+	if (!Ctrl->S.active) SL = gmt_scanline_init (GMT);	/* Workspace for scanline polygon rasterization */
 
 	for (tbl = n_pol = 0; tbl < D->n_tables; tbl++) {
 		for (seg = 0; seg < D->table[tbl]->n_segments; seg++, n_pol++) {	/* For each segment in the table */
@@ -620,6 +622,10 @@ EXTERN_MSC int GMT_grdmask (void *V_API, int mode, void *args) {
 
 				if (worry_about_jumps) gmt_eliminate_lon_jumps (GMT, S->data[GMT_X], S->n_rows);	/* Since many segments may have been read we cannot be sure there are no junps */
 
+				/* We can rasterize from per-row crossing lists when the exact test is the Cartesian winding
+				 * rule and there are no trailing hole polygons (those require the full gmt_inonout test) */
+				use_scanline = (!GMT->current.proj.sph_inside && (SH->next == NULL || !gmt_polygon_is_hole (GMT, SH->next)));
+
 				for (row = 0; row < n_rows; row++) {	/* Loop over grid rows */
 					yy = gmt_M_grd_row_to_y (GMT, row, Grid->header);
 
@@ -643,16 +649,31 @@ EXTERN_MSC int GMT_grdmask (void *V_API, int mode, void *args) {
 					else if (yy < S->min[GMT_Y] || yy > S->max[GMT_Y])	/* Cartesian case */
 						continue;	/* Outside, no need to check */
 
+					if (do_test && use_scanline)	/* Build the sorted list of polygon edge crossings for this row */
+						gmt_scanline_build (GMT, SL, S->data[GMT_X], S->data[GMT_Y], S->n_rows, yy);
+
 					/* Here we will have to consider the x coordinates as well (or known_side is set) */
 #ifdef _OPENMP
-#pragma omp parallel for private(col,ij,xx,side,z_to_set) shared(n_columns,Grid,row,Ctrl,node_is_set,GMT,do_test,yy,S,known_side,z_value,mask_val)
+#pragma omp parallel for private(col,ij,xx,side,z_to_set,decided) shared(n_columns,Grid,row,Ctrl,node_is_set,GMT,do_test,yy,S,known_side,z_value,mask_val,use_scanline,periodic,SL)
 #endif
 					for (col = 0; col < n_columns; col++) {	/* Loop over grid columns */
 						ij = gmt_M_ijp (Grid->header, row, col);
 						if (Ctrl->C.mode == GRDMASK_SET_FIRST && node_is_set[ij]) continue;	/* Already set */
 						xx = gmt_M_grd_col_to_x (GMT, col, Grid->header);
 						if (do_test) {	/* Must consider xx to determine if we are inside */
-							if ((side = gmt_inonout (GMT, xx, yy, S)) == GMT_OUTSIDE)
+							decided = false;
+							if (use_scanline) {	/* Classify from the crossing list unless too close to the boundary */
+								double xs = xx;
+								if (periodic) {	/* Wind the longitude into the polygon's range first */
+									if (xs < S->min[GMT_X]) xs += 360.0;
+									else if (xs > S->max[GMT_X]) xs -= 360.0;
+								}
+								decided = gmt_scanline_side (SL, xs, &side);
+							}
+							if (decided) {
+								if (side == GMT_OUTSIDE) continue;	/* Outside polygon, go to next point */
+							}
+							else if ((side = gmt_inonout (GMT, xx, yy, S)) == GMT_OUTSIDE)
 								continue;	/* Outside polygon, go to next point */
 						}
 						else	/* Already know the answer */
@@ -690,6 +711,7 @@ EXTERN_MSC int GMT_grdmask (void *V_API, int mode, void *args) {
 	}
 
 	gmt_M_free (GMT, node_is_set);
+	if (SL) gmt_scanline_free (GMT, &SL);
 	if (Ctrl->S.active)
 		gmt_M_free (GMT, d_col);
 
@@ -37,6 +37,7 @@
  */
 
 #include "gmt_dev.h"
+#include "gmt_internals.h"
 #include "longopt/grdmath_inc.h"
 
 #define THIS_MODULE_CLASSIC_NAME	"grdmath"
@@ -121,6 +122,9 @@ struct GRDMATH_CTRL {	/* All control options for this program (except common arg
 		bool force;	/* if true, select next highest level if current set is not available */
 		char set;	/* One of f, h, i, l, c, or auto */
 	} D;
+	struct GRDMATH_H {	/* -H */
+		bool active;
+	} H;
 	struct GRDMATH_I {	/* -I (for checking only) */
 		bool active;
 	} I;
@@ -150,6 +154,7 @@ struct GRDMATH_INFO {
 
 struct GRDMATH_STACK {
 	struct GMT_GRID *G;		/* The grid */
+	uint16_t *H16;			/* Half-precision copy of the grid under -H (stored memory only) */
 	bool constant;			/* true if a constant (see factor) and S == NULL */
 	double factor;			/* The value if constant is true */
 };
@@ -174,10 +179,74 @@ static void Free_Ctrl (struct GMT_CTRL *GMT, struct GRDMATH_CTRL *C) {	/* Deallo
 	gmt_M_free (GMT, C);
 }
 
+GMT_LOCAL uint16_t grdmath_float_to_half (float f) {
+	/* Convert IEEE binary32 to binary16 with round-to-nearest-even; values beyond
+	 * the half range become +/-inf and NaNs stay NaNs */
+	union { float f; uint32_t u; } v;
+	uint32_t sign, rest;
+	uint16_t h;
+	v.f = f;
+	sign = (v.u >> 16) & 0x8000U;
+	rest = v.u & 0x7fffffffU;
+	if (rest >= 0x7f800000U)	/* Inf or NaN; keep a payload bit so NaN stays NaN */
+		h = (uint16_t)(sign | 0x7c00U | ((rest > 0x7f800000U) ? 0x200U : 0U));
+	else if (rest >= 0x47800000U)	/* Too large for half; clamp to inf */
+		h = (uint16_t)(sign | 0x7c00U);
+	else if (rest < 0x38800000U) {	/* Becomes subnormal (or zero) in half */
+		uint32_t man = (rest & 0x7fffffU) | 0x800000U;	/* Restore the implicit bit */
+		int shift = 113 - (int)(rest >> 23);		/* Shift into subnormal position */
+		if (shift > 24)
+			h = (uint16_t)sign;	/* Underflows to signed zero */
+		else {
+			uint32_t q = man >> (shift + 13), rem = man & ((1U << (shift + 13)) - 1U), half = 1U << (shift + 12);
+			if (rem > half || (rem == half && (q & 1U))) q++;	/* Round to nearest, ties to even */
+			h = (uint16_t)(sign | q);
+		}
+	}
+	else {	/* Normal range; rebias the exponent and round at bit 13 */
+		uint32_t q = rest + 0xfffU + ((rest >> 13) & 1U);
+		h = (uint16_t)(sign | ((q - 0x38000000U) >> 13));
+	}
+	return (h);
+}
+
+GMT_LOCAL float grdmath_half_to_float (uint16_t h) {
+	/* Convert IEEE binary16 back to binary32 (exact) */
+	union { float f; uint32_t u; } v;
+	uint32_t sign = (uint32_t)(h & 0x8000U) << 16;
+	uint32_t exp = (h >> 10) & 0x1fU, man = h & 0x3ffU;
+	if (exp == 0x1fU)	/* Inf or NaN */
+		v.u = sign | 0x7f800000U | (man << 13);
+	else if (exp == 0U) {
+		if (man == 0U)
+			v.u = sign;	/* Signed zero */
+		else {	/* Subnormal half; normalize for float */
+			exp = 113U;
+			while ((man & 0x400U) == 0U) { man <<= 1; exp--; }
+			v.u = sign | (exp << 23) | ((man & 0x3ffU) << 13);
+		}
+	}
+	else
+		v.u = sign | ((exp + 112U) << 23) | (man << 13);
+	return (v.f);
+}
+
+GMT_LOCAL void grdmath_grd_to_half (gmt_grdfloat *in, uint16_t *out, size_t n) {
+	/* Pack a grid into half precision for stored memory under -H */
+	size_t k;
+	for (k = 0; k < n; k++) out[k] = grdmath_float_to_half ((float)in[k]);
+}
+
+GMT_LOCAL void grdmath_half_to_grd (uint16_t *in, gmt_grdfloat *out, size_t n) {
+	/* Expand a half-precision stored grid back to the working precision */
+	size_t k;
+	for (k = 0; k < n; k++) out[k] = (gmt_grdfloat)grdmath_half_to_float (in[k]);
+}
+
 static int usage (struct GMTAPI_CTRL *API, int level) {
 	const char *name = gmt_show_name_and_purpose (API, THIS_MODULE_LIB, THIS_MODULE_CLASSIC_NAME, THIS_MODULE_PURPOSE);
 	if (level == GMT_MODULE_PURPOSE) return (GMT_NOERROR);
-	GMT_Usage (API, 0, "usage: %s [%s] [%s] [-D<resolution>[+f]] [%s] [-M] [-N] [-S] [%s] [%s] [%s] [%s] [%s] [%s] [%s] "
+	GMT_Usage (API, 0, "usage: %s [%s] [%s] [-D<resolution>[+f]] [-H] [%s] [-M] [-N] [-S] [%s] [%s] [%s] [%s] [%s] [%s] [%s] "
 		"[%s] [%s] [%s] [%s]%s[%s] A B op C op D op ... = %s\n", name, GMT_Rgeo_OPT, GMT_A_OPT, GMT_I_OPT, GMT_V_OPT, GMT_a_OPT, GMT_bi_OPT, GMT_di_OPT,
 		GMT_e_OPT, GMT_f_OPT, GMT_g_OPT, GMT_h_OPT, GMT_i_OPT, GMT_n_OPT, GMT_r_OPT, GMT_x_OPT, GMT_PAR_OPT, GMT_OUTGRID);
 
@@ -465,6 +534,10 @@ static int usage (struct GMTAPI_CTRL *API, int level) {
 	GMT_Usage (API, 3, "c: Crude resolution, for busy plots that need crude continent outlines only.");
 	GMT_Usage (API, -2, "Append +f to use a lower resolution should the chosen one not be available [Default will abort]. ");
 	GMT_Usage (API, -2, "Note: -D is only relevant if using the LDISTG operator.");
+	GMT_Usage (API, 1, "\n-H Hold stored memory (STO@<label>) in half precision (16-bit floats). "
+		"This halves the memory taken by stored grids so that long chains with many stored layers "
+		"stay in cache; all arithmetic is still carried out in the working grid precision. "
+		"Note: Values recalled from storage are rounded to ~3 significant (decimal) digits.");
 	GMT_Option (API, "I");
 	GMT_Usage (API, 1, "\n-M Handle map units in derivatives.  In this case, dx,dy of grid "
 		"will be converted from degrees lon,lat into meters (Flat-earth approximation). "
@@ -530,6 +603,10 @@ static int parse (struct GMT_CTRL *GMT, struct GRDMATH_CTRL *Ctrl, struct GMT_OP
 				n_errors += gmt_get_required_char (GMT, opt->arg, opt->option, 0, &Ctrl->D.set);
 				Ctrl->D.force = (opt->arg[1] == '+');
 				break;
+			case 'H':	/* Half-precision stored memory */
+				n_errors += gmt_M_repeated_module_option (API, Ctrl->H.active);
+				n_errors += gmt_get_no_argument (GMT, opt->arg, opt->option, 0);
+				break;
 			case 'I':	/* Grid spacings */
 				n_errors += gmt_M_repeated_module_option (API, Ctrl->I.active);
 				n_errors += gmt_parse_inc_option (GMT, 'I', opt->arg);
@@ -576,6 +653,54 @@ GMT_LOCAL int grdmath_find_stored_item (struct GMT_CTRL *GMT, struct GRDMATH_STO
 	return (k == n_stored ? GMT_NOTSET : k);
 }
 
+GMT_LOCAL bool grdmath_fold_constants (struct GMT_CTRL *GMT, char *name, struct GRDMATH_STACK *stack[], unsigned int nstack, unsigned int n_in, unsigned int n_out) {
+	/* Constant folding: If every operand consumed by a purely element-wise operator is a
+	 * constant then the result is the same scalar at every node, so we compute it once and
+	 * leave it on the stack as a constant rather than allocating a stack grid and filling
+	 * every node.  Chains of constant arguments (common in macro expansions) thus never
+	 * touch grid memory until they are combined with an actual grid.  Only side-effect-free
+	 * operators are folded here; those that may issue domain warnings (LOG, SQRT, DIV, ...)
+	 * or change the output column type (ACOS, ...) must take the normal path.
+	 * Returns true if the operation was folded, with the result left on the stack. */
+	unsigned int k;
+	double a, b = 0.0, value;
+
+	if (n_out != 1 || n_in < 1 || n_in > 2) return false;	/* Only unary|binary operators with a single result can fold */
+	for (k = 1; k <= n_in; k++)
+		if (!stack[nstack-k]->constant) return false;
+	a = stack[nstack-n_in]->factor;
+	if (n_in == 2) b = stack[nstack-1]->factor;
+	if (n_in == 1) {	/* The eligible unary operators */
+		if (!strcmp (name, "ABS"))	value = fabs (a);
+		else if (!strcmp (name, "CEIL"))	value = ceil (a);
+		else if (!strcmp (name, "COS"))	value = cos (a);
+		else if (!strcmp (name, "COSD"))	value = cosd (a);
+		else if (!strcmp (name, "EXP"))	value = exp (a);
+		else if (!strcmp (name, "FLOOR"))	value = floor (a);
+		else if (!strcmp (name, "NEG"))	value = -a;
+		else if (!strcmp (name, "RINT"))	value = rint (a);
+		else if (!strcmp (name, "SIN"))	value = sin (a);
+		else if (!strcmp (name, "SIND"))	value = sind (a);
+		else if (!strcmp (name, "SQR"))	value = a * a;
+		else if (!strcmp (name, "TAN"))	value = tan (a);
+		else if (!strcmp (name, "TAND"))	value = tand (a);
+		else return false;
+	}
+	else {	/* The eligible binary operators */
+		if (!strcmp (name, "ADD"))	value = a + b;
+		else if (!strcmp (name, "HYPOT"))	value = hypot (a, b);
+		else if (!strcmp (name, "MAX"))	value = (gmt_M_is_dnan (a) || gmt_M_is_dnan (b)) ? GMT->session.d_NaN : MAX (a, b);
+		else if (!strcmp (name, "MIN"))	value = (gmt_M_is_dnan (a) || gmt_M_is_dnan (b)) ? GMT->session.d_NaN : MIN (a, b);
+		else if (!strcmp (name, "MUL"))	value = a * b;
+		else if (!strcmp (name, "POW"))	value = pow (a, b);
+		else if (!strcmp (name, "SUB"))	value = a - b;
+		else return false;
+	}
+	stack[nstack-n_in]->factor = value;	/* Replace operand(s) with the folded result; it remains a constant */
+	GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Folded constant operands of %s to %g\n", name, value);
+	return true;
+}
+
 /* Stack collapsing operators that work on same nodes across all stack items */
 
 GMT_LOCAL double grdmath_stack_collapse_add (struct GMT_CTRL *GMT, double *array, uint64_t n) {
@@ -1211,8 +1336,12 @@ GMT_LOCAL void grdmath_BEI (struct GMT_CTRL *GMT, struct GRDMATH_INFO *info, str
 	uint64_t node;
 	double a = 0.0;
 
-	if (stack[last]->constant) a = gmt_bei (GMT, fabs (stack[last]->factor));
-	for (node = 0; node < info->size; node++) stack[last]->G->data[node] = (gmt_grdfloat)((stack[last]->constant) ? a : gmt_bei (GMT, fabs((double)stack[last]->G->data[node])));
+	if (stack[last]->constant) {
+		a = gmt_bei (GMT, fabs (stack[last]->factor));
+		for (node = 0; node < info->size; node++) stack[last]->G->data[node] = (gmt_grdfloat)a;
+	}
+	else	/* Batch kernel so the series evaluation vectorizes across nodes */
+		gmt_bei_f_n (GMT, stack[last]->G->data, info->size);
 }
 
 GMT_LOCAL void grdmath_BER (struct GMT_CTRL *GMT, struct GRDMATH_INFO *info, struct GRDMATH_STACK *stack[], unsigned int last)
@@ -1221,8 +1350,12 @@ GMT_LOCAL void grdmath_BER (struct GMT_CTRL *GMT, struct GRDMATH_INFO *info, str
 	uint64_t node;
 	double a = 0.0;
 
-	if (stack[last]->constant) a = gmt_ber (GMT, fabs (stack[last]->factor));
-	for (node = 0; node < info->size; node++) stack[last]->G->data[node] = (gmt_grdfloat)((stack[last]->constant) ? a : gmt_ber (GMT, fabs ((double)stack[last]->G->data[node])));
+	if (stack[last]->constant) {
+		a = gmt_ber (GMT, fabs (stack[last]->factor));
+		for (node = 0; node < info->size; node++) stack[last]->G->data[node] = (gmt_grdfloat)a;
+	}
+	else	/* Batch kernel so the series evaluation vectorizes across nodes */
+		gmt_ber_f_n (GMT, stack[last]->G->data, info->size);
 }
 
 GMT_LOCAL void grdmath_BITAND (struct GMT_CTRL *GMT, struct GRDMATH_INFO *info, struct GRDMATH_STACK *stack[], unsigned int last)
@@ -2415,6 +2548,7 @@ GMT_LOCAL void grdmath_ERFINV (struct GMT_CTRL *GMT, struct GRDMATH_INFO *info,
 /*OPERATOR: ERFINV 1 1 Inverse error function of A.  */
 {
 	uint64_t node;
+	openmp_int row, col;
 	gmt_grdfloat a = 0.0;
 
 	if (stack[last]->constant) {
@@ -2423,8 +2557,13 @@ GMT_LOCAL void grdmath_ERFINV (struct GMT_CTRL *GMT, struct GRDMATH_INFO *info,
 			stack[last]->G->data[node] = a;
 	}
 	else {
-		for (node = 0; node < info->size; node++)
-			stack[last]->G->data[node] = (gmt_grdfloat)gmt_erfinv (GMT, stack[last]->G->data[node]);
+#ifdef _OPENMP
+#pragma omp parallel for private(row,col,node) shared(info,stack,last,GMT)
+#endif
+		for (row = 0; row < (openmp_int)info->G->header->n_rows; row++) {
+			for (col = 0, node = gmt_M_ijp (info->G->header, row, 0); col < (openmp_int)info->G->header->n_columns; col++, node++)
+				stack[last]->G->data[node] = (gmt_grdfloat)gmt_erfinv (GMT, stack[last]->G->data[node]);
+		}
 	}
 }
 
@@ -3246,20 +3385,44 @@ GMT_LOCAL void grdmath_KEI (struct GMT_CTRL *GMT, struct GRDMATH_INFO *info, str
 /*OPERATOR: KEI 1 1 Kelvin function kei (A).  */
 {
 	uint64_t node;
+	openmp_int row, col;
 	gmt_grdfloat a = 0.0;
 
-	if (stack[last]->constant) a = (gmt_grdfloat)gmt_kei (GMT, fabs (stack[last]->factor));
-	for (node = 0; node < info->size; node++) stack[last]->G->data[node] = (stack[last]->constant) ? a : (gmt_grdfloat)gmt_kei (GMT, fabsf (stack[last]->G->data[node]));
+	if (stack[last]->constant) {
+		a = (gmt_grdfloat)gmt_kei (GMT, fabs (stack[last]->factor));
+		for (node = 0; node < info->size; node++) stack[last]->G->data[node] = a;
+	}
+	else {
+#ifdef _OPENMP
+#pragma omp parallel for private(row,col,node) shared(info,stack,last,GMT)
+#endif
+		for (row = 0; row < (openmp_int)info->G->header->n_rows; row++) {
+			for (col = 0, node = gmt_M_ijp (info->G->header, row, 0); col < (openmp_int)info->G->header->n_columns; col++, node++)
+				stack[last]->G->data[node] = (gmt_grdfloat)gmt_kei (GMT, fabsf (stack[last]->G->data[node]));
+		}
+	}
 }
 
 GMT_LOCAL void grdmath_KER (struct GMT_CTRL *GMT, struct GRDMATH_INFO *info, struct GRDMATH_STACK *stack[], unsigned int last)
 /*OPERATOR: KER 1 1 Kelvin function ker (A).  */
 {
 	uint64_t node;
+	openmp_int row, col;
 	double a = 0.0;
 
-	if (stack[last]->constant) a = gmt_ker (GMT, fabs (stack[last]->factor));
-	for (node = 0; node < info->size; node++) stack[last]->G->data[node] = (gmt_grdfloat)((stack[last]->constant) ? a : gmt_ker (GMT, fabsf (stack[last]->G->data[node])));
+	if (stack[last]->constant) {
+		a = gmt_ker (GMT, fabs (stack[last]->factor));
+		for (node = 0; node < info->size; node++) stack[last]->G->data[node] = (gmt_grdfloat)a;
+	}
+	else {
+#ifdef _OPENMP
+#pragma omp parallel for private(row,col,node) shared(info,stack,last,GMT)
+#endif
+		for (row = 0; row < (openmp_int)info->G->header->n_rows; row++) {
+			for (col = 0, node = gmt_M_ijp (info->G->header, row, 0); col < (openmp_int)info->G->header->n_columns; col++, node++)
+				stack[last]->G->data[node] = (gmt_grdfloat)gmt_ker (GMT, fabsf (stack[last]->G->data[node]));
+		}
+	}
 }
 
 GMT_LOCAL void grdmath_KM2DEG (struct GMT_CTRL *GMT, struct GRDMATH_INFO *info, struct GRDMATH_STACK *stack[], unsigned int last)
@@ -4455,9 +4618,8 @@ GMT_LOCAL void grdmath_PQUANT (struct GMT_CTRL *GMT, struct GRDMATH_INFO *info,
 	}
 	else {
 		gmt_M_memcpy (pad, stack[prev]->G->header->pad, 4U, unsigned int);	/* Save original pad */
-		gmt_grd_pad_off (GMT, stack[prev]->G);				/* Undo pad if one existed so we can sort */
-		gmt_sort_array (GMT, stack[prev]->G->data, info->nm, GMT_FLOAT);
-		p = (gmt_grdfloat) gmt_quantile_f (GMT, stack[prev]->G->data, stack[last]->factor, info->nm);
+		gmt_grd_pad_off (GMT, stack[prev]->G);				/* Undo pad if one existed so we can select */
+		p = (gmt_grdfloat) gmt_quantile_f_inplace (GMT, stack[prev]->G->data, stack[last]->factor, info->nm);
 		gmt_M_memset (stack[prev]->G->data, info->size, gmt_grdfloat);	/* Wipes everything */
 		gmt_grd_pad_on (GMT, stack[prev]->G, pad);		/* Reinstate the original pad */
 	}
@@ -5466,11 +5628,24 @@ GMT_LOCAL void grdmath_TCDF (struct GMT_CTRL *GMT, struct GRDMATH_INFO *info, st
 
 	if (stack[prev]->constant && stack[prev]->factor == 0.0) GMT_Report (GMT->parent, GMT_MSG_WARNING, "Operand one == 0 for TCDF!\n");
 	if (stack[last]->constant && stack[last]->factor == 0.0) GMT_Report (GMT->parent, GMT_MSG_WARNING, "Operand two == 0 for TCDF!\n");
-	for (row = 0; row < (openmp_int)info->G->header->n_rows; row++) {
-		for (col = 0, node = gmt_M_ijp (info->G->header, row, 0); col < (openmp_int)info->G->header->n_columns; col++, node++) {
-			a = (stack[prev]->constant) ? stack[prev]->factor : stack[prev]->G->data[node];
-			b = lrint ((stack[last]->constant) ? stack[last]->factor : stack[last]->G->data[node]);
-			stack[prev]->G->data[node] = (gmt_grdfloat)gmt_t_cdf (GMT, a, b);
+	if (stack[prev]->constant && stack[last]->constant) {	/* Compute once then copy */
+		gmt_grdfloat tcdf;
+		a = stack[prev]->factor;
+		b = lrint (stack[last]->factor);
+		tcdf = (gmt_grdfloat)gmt_t_cdf (GMT, a, b);
+		for (node = 0; node < info->size; node++)
+			stack[prev]->G->data[node] = tcdf;
+	}
+	else {
+#ifdef _OPENMP
+#pragma omp parallel for private(row,col,node,a,b) shared(info,stack,prev,last,GMT)
+#endif
+		for (row = 0; row < (openmp_int)info->G->header->n_rows; row++) {
+			for (col = 0, node = gmt_M_ijp (info->G->header, row, 0); col < (openmp_int)info->G->header->n_columns; col++, node++) {
+				a = (stack[prev]->constant) ? stack[prev]->factor : stack[prev]->G->data[node];
+				b = lrint ((stack[last]->constant) ? stack[last]->factor : stack[last]->G->data[node]);
+				stack[prev]->G->data[node] = (gmt_grdfloat)gmt_t_cdf (GMT, a, b);
+			}
 		}
 	}
 }
@@ -5485,11 +5660,24 @@ GMT_LOCAL void grdmath_TPDF (struct GMT_CTRL *GMT, struct GRDMATH_INFO *info, st
 
 	if (stack[prev]->constant && stack[prev]->factor == 0.0) GMT_Report (GMT->parent, GMT_MSG_WARNING, "Operand one == 0 for TCDF!\n");
 	if (stack[last]->constant && stack[last]->factor == 0.0) GMT_Report (GMT->parent, GMT_MSG_WARNING, "Operand two == 0 for TCDF!\n");
-	for (row = 0; row < (openmp_int)info->G->header->n_rows; row++) {
-		for (col = 0, node = gmt_M_ijp (info->G->header, row, 0); col < (openmp_int)info->G->header->n_columns; col++, node++) {
-			a = (stack[prev]->constant) ? stack[prev]->factor : stack[prev]->G->data[node];
-			b = lrint ((stack[last]->constant) ? stack[last]->factor : stack[last]->G->data[node]);
-			stack[prev]->G->data[node] = (gmt_grdfloat)gmt_t_pdf (GMT, a, b);
+	if (stack[prev]->constant && stack[last]->constant) {	/* Compute once then copy */
+		gmt_grdfloat tpdf;
+		a = stack[prev]->factor;
+		b = lrint (stack[last]->factor);
+		tpdf = (gmt_grdfloat)gmt_t_pdf (GMT, a, b);
+		for (node = 0; node < info->size; node++)
+			stack[prev]->G->data[node] = tpdf;
+	}
+	else {
+#ifdef _OPENMP
+#pragma omp parallel for private(row,col,node,a,b) shared(info,stack,prev,last,GMT)
+#endif
+		for (row = 0; row < (openmp_int)info->G->header->n_rows; row++) {
+			for (col = 0, node = gmt_M_ijp (info->G->header, row, 0); col < (openmp_int)info->G->header->n_columns; col++, node++) {
+				a = (stack[prev]->constant) ? stack[prev]->factor : stack[prev]->G->data[node];
+				b = lrint ((stack[last]->constant) ? stack[last]->factor : stack[last]->G->data[node]);
+				stack[prev]->G->data[node] = (gmt_grdfloat)gmt_t_pdf (GMT, a, b);
+			}
 		}
 	}
 }
@@ -5532,13 +5720,8 @@ GMT_LOCAL void grdmath_TRIM (struct GMT_CTRL *GMT, struct GRDMATH_INFO *info, st
 	}
 	tmp_grid = gmt_M_memory_aligned (GMT, NULL, stack[last]->G->header->size, gmt_grdfloat);
 	gmt_M_memcpy (tmp_grid, stack[last]->G->data, stack[last]->G->header->size, gmt_grdfloat);
-#ifdef DOUBLE_PRECISION_GRID
-	gmt_sort_array (GMT, tmp_grid, stack[last]->G->header->size, GMT_DOUBLE);	/* Sort so we can find quantiles */
-#else
-	gmt_sort_array (GMT, tmp_grid, stack[last]->G->header->size, GMT_FLOAT);	/* Sort so we can find quantiles */
-#endif
-	global_zmin = (gmt_grdfloat)gmt_quantile_f (GMT, tmp_grid, stack[prev2]->factor, stack[last]->G->header->size);	/* "Left" quantile */
-	global_zmax = (gmt_grdfloat)gmt_quantile_f (GMT, tmp_grid, stack[prev1]->factor, stack[last]->G->header->size);	/* "Right" quantile */
+	global_zmin = (gmt_grdfloat)gmt_quantile_f_inplace (GMT, tmp_grid, stack[prev2]->factor, stack[last]->G->header->size);	/* "Left" quantile */
+	global_zmax = (gmt_grdfloat)gmt_quantile_f_inplace (GMT, tmp_grid, stack[prev1]->factor, stack[last]->G->header->size);	/* "Right" quantile */
 	gmt_M_free (GMT, tmp_grid);
 	gmt_M_grd_loop (GMT, info->G, row, col, node) {
 		stack[prev2]->G->data[node] = (stack[last]->G->data[node] < global_zmin || stack[last]->G->data[node] > global_zmax) ? GMT->session.f_NaN : stack[last]->G->data[node];
@@ -6481,14 +6664,16 @@ EXTERN_MSC int GMT_grdmath (void *V_API, int mode, void *args) {
 	char *in_file = NULL, *label = NULL;
 
 	uint64_t node;
+	uint64_t op_count[GRDMATH_N_OPERATORS];
 	openmp_int row, col;
 
 	struct GRDMATH_STACK *stack[GRDMATH_STACK_SIZE];
 	struct GRDMATH_STORE *recall[GRDMATH_STORE_SIZE];
 	struct GMT_GRID *G_in = NULL;
 
-	double value, x_noise, y_noise, off, scale;
+	double value, x_noise, y_noise, off, scale, op_clock;
 	double wesn[4], special_symbol[GRDMATH_ARG_IS_PI-GRDMATH_ARG_IS_NY+1];
+	double op_time[GRDMATH_N_OPERATORS];
 
 	/* Declare operator array */
 
@@ -6767,6 +6952,8 @@ EXTERN_MSC int GMT_grdmath (void *V_API, int mode, void *args) {
 	gmt_M_memset (&info, 1, struct GRDMATH_INFO);		/* Initialize here to not crash when Return gets called */
 	gmt_M_memset (recall, GRDMATH_STORE_SIZE, struct GRDMATH_STORE *);
 	gmt_M_memset (localhashnode, GRDMATH_N_OPERATORS, struct GMT_HASH);
+	gmt_M_memset (op_time,  GRDMATH_N_OPERATORS, double);	/* Start of the per-operator cost accounting */
+	gmt_M_memset (op_count, GRDMATH_N_OPERATORS, uint64_t);
 	for (k = 0; k < GRDMATH_STACK_SIZE; k++) stack[k] = gmt_M_memory (GMT, NULL, 1, struct GRDMATH_STACK);
 	gmt_set_pad (GMT, 2U);	/* Ensure space for BCs in case an API passed pad == 0 */
 
@@ -7027,15 +7214,28 @@ EXTERN_MSC int GMT_grdmath (void *V_API, int mode, void *args) {
 				if ((k = grdmath_find_stored_item (GMT, recall, n_stored, label)) != GMT_NOTSET) {
 					GMT_Report (API, GMT_MSG_DEBUG, "Stored memory cell %d named %s is overwritten with new information\n", k, label);
 					if (!stack[last]->constant) {	/* Must copy over the grid - and allocate if not yet done */
-						if (recall[k]->stored.G == NULL) recall[k]->stored.G = GMT_Duplicate_Data (API, GMT_IS_GRID, GMT_DUPLICATE_ALLOC, stack[last]->G);
-						gmt_M_memcpy (recall[k]->stored.G->data, stack[last]->G->data, info.size, gmt_grdfloat);
+						if (Ctrl->H.active) {	/* Keep the stored copy in half precision */
+							if (recall[k]->stored.H16 == NULL) recall[k]->stored.H16 = gmt_M_memory (GMT, NULL, info.size, uint16_t);
+							grdmath_grd_to_half (stack[last]->G->data, recall[k]->stored.H16, info.size);
+						}
+						else {
+							if (recall[k]->stored.G == NULL) recall[k]->stored.G = GMT_Duplicate_Data (API, GMT_IS_GRID, GMT_DUPLICATE_ALLOC, stack[last]->G);
+							gmt_M_memcpy (recall[k]->stored.G->data, stack[last]->G->data, info.size, gmt_grdfloat);
+						}
 					}
 				}
 				else {	/* Need new named storage place */
 					k = n_stored;
 					recall[k] = gmt_M_memory (GMT, NULL, 1, struct GRDMATH_STORE);
 					recall[k]->label = strdup (label);
-					if (!stack[last]->constant) recall[k]->stored.G = GMT_Duplicate_Data (API, GMT_IS_GRID, GMT_DUPLICATE_DATA, stack[last]->G);
+					if (!stack[last]->constant) {
+						if (Ctrl->H.active) {	/* Keep the stored copy in half precision */
+							recall[k]->stored.H16 = gmt_M_memory (GMT, NULL, info.size, uint16_t);
+							grdmath_grd_to_half (stack[last]->G->data, recall[k]->stored.H16, info.size);
+						}
+						else
+							recall[k]->stored.G = GMT_Duplicate_Data (API, GMT_IS_GRID, GMT_DUPLICATE_DATA, stack[last]->G);
+					}
 					added_new = true;
 					GMT_Report (API, GMT_MSG_DEBUG, "Stored memory cell %d named %s is created with new information\n", k, label);
 				}
@@ -7060,7 +7260,10 @@ EXTERN_MSC int GMT_grdmath (void *V_API, int mode, void *args) {
 					stack[nstack]->constant = false;
 					if (!stack[nstack]->G)
 						stack[nstack]->G = grdmath_alloc_stack_grid (GMT, info.G);
-					gmt_M_memcpy (stack[nstack]->G->data, recall[k]->stored.G->data, info.size, gmt_grdfloat);
+					if (recall[k]->stored.H16)	/* Expand the half-precision copy kept under -H */
+						grdmath_half_to_grd (recall[k]->stored.H16, stack[nstack]->G->data, info.size);
+					else
+						gmt_M_memcpy (stack[nstack]->G->data, recall[k]->stored.G->data, info.size, gmt_grdfloat);
 				}
 				if (gmt_M_is_verbose (GMT, GMT_MSG_INFORMATION)) GMT_Message (API, GMT_TIME_NONE, "@%s ", recall[k]->label);
 				nstack++;
@@ -7076,7 +7279,7 @@ EXTERN_MSC int GMT_grdmath (void *V_API, int mode, void *args) {
 				if (recall[k]->stored.G && GMT_Destroy_Data (API, &recall[k]->stored.G) != GMT_NOERROR) {
 					GMT_Report (API, GMT_MSG_ERROR, "Failed to free recall item %d\n", k);
 				}
-
+				gmt_M_free (GMT, recall[k]->stored.H16);
 				gmt_M_str_free (recall[k]->label);
 				gmt_M_free (GMT, recall[k]);
 				while (n_stored && k == (int)(n_stored-1) && !recall[k]) k--, n_stored--;	/* Chop off trailing NULL cases */
@@ -7178,6 +7381,12 @@ EXTERN_MSC int GMT_grdmath (void *V_API, int mode, void *args) {
 		n_items++;
 		if (gmt_M_is_verbose (GMT, GMT_MSG_INFORMATION)) GMT_Message (API, GMT_TIME_NONE, "%s ", operator[op]);
 
+		if (grdmath_fold_constants (GMT, operator[op], stack, nstack, consumed_operands[op], produced_operands[op])) {
+			/* All operands were constants and the operator was element-wise; scalar result is already on the stack */
+			nstack = new_stack;
+			continue;
+		}
+
 		for (k = produced_operands[op] - consumed_operands[op]; k > 0; k--) {
 			if (stack[nstack+k-1]->G) continue;
 
@@ -7195,20 +7404,35 @@ EXTERN_MSC int GMT_grdmath (void *V_API, int mode, void *args) {
 		gmt_set_column_type (GMT, GMT_OUT, GMT_Z, GMT_IS_FLOAT);
 
 		pos = (consumed_operands[op]) ? nstack - 1 : nstack;
+		op_clock = gmtlib_wall_clock ();	/* Time this operator call for the cost statistics */
 		(*call_operator[op]) (GMT, &info, stack, pos);	/* Do it */
+		op_time[op] += gmtlib_wall_clock () - op_clock;
+		op_count[op]++;
 
 		if (info.error) Return (info.error);	/* Got an error inside the operator */
 
 		nstack = new_stack;
-		for (kk = 1; kk <= produced_operands[op]; kk++) stack[nstack-kk]->constant = false;	/* Now filled with grid */
+		for (kk = 1; kk <= produced_operands[op]; kk++) {
+			stack[nstack-kk]->constant = false;	/* Now filled with grid */
+			if (stack[nstack-kk]->G) gmt_grd_dirty (stack[nstack-kk]->G);	/* Any earlier boundary fill is now stale */
+		}
 	}
 
 	/* Clean-up time */
 
+#ifdef GMT_ENABLE_TIMINGS
+	for (op = 0; op < GRDMATH_N_OPERATORS; op++) {	/* Report per-operator cost statistics */
+		if (op_count[op] == 0) continue;
+		GMT_Report (API, GMT_MSG_NOTICE, "Timings: Operator %s: %" PRIu64 " call(s), total %.6f s, mean %.6f s\n",
+			operator[op], op_count[op], op_time[op], op_time[op] / (double)op_count[op]);
+	}
+#endif
+
 	for (kk = 0; kk < n_stored; kk++) {	/* Free up stored STO/RCL memory */
 		if (recall[kk]->stored.G && GMT_Destroy_Data (API, &recall[kk]->stored.G) != GMT_NOERROR) {
 			GMT_Report (API, GMT_MSG_ERROR, "Failed to free recall item %d\n", kk);
 		}
+		gmt_M_free (GMT, recall[kk]->stored.H16);
 		gmt_M_str_free (recall[kk]->label);
 		gmt_M_free (GMT, recall[kk]);
 	}
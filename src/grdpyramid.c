@@ -0,0 +1,190 @@
+/*--------------------------------------------------------------------
+ *
+ *	Copyright (c) 1991-2024 by the GMT Team (https://www.generic-mapping-tools.org/team.html)
+ *	See LICENSE.TXT file for copying and redistribution conditions.
+ *
+ *	This program is free software; you can redistribute it and/or modify
+ *	it under the terms of the GNU Lesser General Public License as published by
+ *	the Free Software Foundation; version 3 or any later version.
+ *
+ *	This program is distributed in the hope that it will be useful,
+ *	but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *	MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *	GNU Lesser General Public License for more details.
+ *
+ *	Contact info: www.generic-mapping-tools.org
+ *--------------------------------------------------------------------*/
+/*
+ * API functions to support the grdpyramid application.
+ *
+ * Brief synopsis: grdpyramid reads a grid file and writes a pyramid of
+ * power-of-two downsampled overview grids as sidecar files next to the
+ * input grid.  Each level is built from the previous one: for pixel
+ * registration a node is the mean of the four parent cells it covers,
+ * while for gridline registration we place a 3x3 binomial (1-2-1) window
+ * on the coincident parent node.  Both schemes skip NaNs.  The sidecar
+ * files are named <base>_pyr<factor><ext> and modules that know their
+ * target resolution can substitute a level via gmt_grd_pyramid_select.
+ */
+
+#include "gmt_dev.h"
+#include "longopt/grdpyramid_inc.h"
+
+#define THIS_MODULE_CLASSIC_NAME	"grdpyramid"
+#define THIS_MODULE_MODERN_NAME	"grdpyramid"
+#define THIS_MODULE_LIB		"core"
+#define THIS_MODULE_PURPOSE	"Create multi-resolution overview levels of a grid"
+#define THIS_MODULE_KEYS	"<G{"
+#define THIS_MODULE_NEEDS	""
+#define THIS_MODULE_OPTIONS "-Vf"
+
+#define GRDPYRAMID_MIN_DIM	64	/* Stop pyramiding when a level gets smaller than this */
+
+struct GRDPYRAMID_CTRL {
+	struct GRDPYRAMID_In {
+		bool active;
+		char *file;
+	} In;
+	struct GRDPYRAMID_L {	/* -L<levels> */
+		bool active;
+		unsigned int n_levels;
+	} L;
+};
+
+static void *New_Ctrl (struct GMT_CTRL *GMT) {	/* Allocate and initialize a new control structure */
+	struct GRDPYRAMID_CTRL *C;
+
+	C = gmt_M_memory (GMT, NULL, 1, struct GRDPYRAMID_CTRL);
+
+	/* Initialize values whose defaults are not 0/false/NULL */
+	return (C);
+}
+
+static void Free_Ctrl (struct GMT_CTRL *GMT, struct GRDPYRAMID_CTRL *C) {	/* Deallocate control structure */
+	if (!C) return;
+	gmt_M_str_free (C->In.file);
+	gmt_M_free (GMT, C);
+}
+
+static int usage (struct GMTAPI_CTRL *API, int level) {
+	const char *name = gmt_show_name_and_purpose (API, THIS_MODULE_LIB, THIS_MODULE_CLASSIC_NAME, THIS_MODULE_PURPOSE);
+	if (level == GMT_MODULE_PURPOSE) return (GMT_NOERROR);
+	GMT_Usage (API, 0, "usage: %s %s [-L<levels>] [%s] [%s] [%s]\n",
+		name, GMT_INGRID, GMT_V_OPT, GMT_f_OPT, GMT_PAR_OPT);
+
+	if (level == GMT_SYNOPSIS) return (GMT_MODULE_SYNOPSIS);
+
+	GMT_Message (API, GMT_TIME_NONE, "  REQUIRED ARGUMENTS:\n");
+	gmt_ingrid_syntax (API, 0, "Name of grid for which overview levels are built");
+	GMT_Message (API, GMT_TIME_NONE, "\n  OPTIONAL ARGUMENTS:\n");
+	GMT_Usage (API, 1, "\n-L<levels>");
+	GMT_Usage (API, -2, "Maximum number of overview levels to build [Default keeps halving "
+		"until a level has fewer than %d rows or columns].", GRDPYRAMID_MIN_DIM);
+	GMT_Option (API, "V,f,.");
+
+	return (GMT_MODULE_USAGE);
+}
+
+static int parse (struct GMT_CTRL *GMT, struct GRDPYRAMID_CTRL *Ctrl, struct GMT_OPTION *options) {
+
+	/* This parses the options provided to grdpyramid and sets parameters in CTRL.
+	 * Any GMT common options will override values set previously by other commands.
+	 */
+
+	unsigned int n_errors = 0;
+	struct GMT_OPTION *opt = NULL;
+	struct GMTAPI_CTRL *API = GMT->parent;
+
+	for (opt = options; opt; opt = opt->next) {
+		switch (opt->option) {
+
+			case '<':	/* Input file */
+				n_errors += gmt_M_repeated_module_option (API, Ctrl->In.active);
+				n_errors += gmt_get_required_file (GMT, opt->arg, opt->option, 0, GMT_IS_GRID, GMT_IN, GMT_FILE_LOCAL, &(Ctrl->In.file));
+				break;
+
+			/* Processes program-specific parameters */
+
+			case 'L':	/* Max number of levels */
+				n_errors += gmt_M_repeated_module_option (API, Ctrl->L.active);
+				Ctrl->L.n_levels = atoi (opt->arg);
+				break;
+
+			default:	/* Report bad options */
+				n_errors += gmt_default_option_error (GMT, opt);
+				break;
+		}
+	}
+
+	n_errors += gmt_M_check_condition (GMT, !Ctrl->In.active, "Must specify a single input grid file\n");
+	n_errors += gmt_M_check_condition (GMT, Ctrl->In.file && gmt_M_file_is_memory (Ctrl->In.file),
+	                                   "Pyramid sidecar files require a grid file, not a memory grid\n");
+	n_errors += gmt_M_check_condition (GMT, Ctrl->L.active && Ctrl->L.n_levels == 0,
+	                                   "Option -L: Must specify a positive number of levels\n");
+	return (n_errors ? GMT_PARSE_ERROR : GMT_NOERROR);
+}
+
+#define bailout(code) {gmt_M_free_options (mode); return (code);}
+#define Return(code) {Free_Ctrl (GMT, Ctrl); gmt_end_module (GMT, GMT_cpy); bailout (code);}
+
+EXTERN_MSC int GMT_grdpyramid (void *V_API, int mode, void *args) {
+	int error = 0;
+	unsigned int level = 0, factor = 2;
+	char file[PATH_MAX] = {""};
+
+	struct GRDPYRAMID_CTRL *Ctrl = NULL;
+	struct GMT_GRID *P = NULL, *C = NULL;
+	struct GMT_CTRL *GMT = NULL, *GMT_cpy = NULL;
+	struct GMT_OPTION *options = NULL;
+	struct GMTAPI_CTRL *API = gmt_get_api_ptr (V_API);	/* Cast from void to GMTAPI_CTRL pointer */
+
+	/*----------------------- Standard module initialization and parsing ----------------------*/
+
+	if (API == NULL) return (GMT_NOT_A_SESSION);
+	if (mode == GMT_MODULE_PURPOSE) return (usage (API, GMT_MODULE_PURPOSE));	/* Return the purpose of program */
+	options = GMT_Create_Options (API, mode, args);	if (API->error) return (API->error);	/* Set or get option list */
+
+	if ((error = gmt_report_usage (API, options, 0, usage)) != GMT_NOERROR) bailout (error);	/* Give usage if requested */
+
+	/* Parse the command-line arguments */
+
+	if ((GMT = gmt_init_module (API, THIS_MODULE_LIB, THIS_MODULE_CLASSIC_NAME, THIS_MODULE_KEYS, THIS_MODULE_NEEDS, module_kw, &options, &GMT_cpy)) == NULL) bailout (API->error); /* Save current state */
+	if (GMT_Parse_Common (API, THIS_MODULE_OPTIONS, options)) Return (API->error);
+	Ctrl = New_Ctrl (GMT);	/* Allocate and initialize a new control structure */
+	if ((error = parse (GMT, Ctrl, options)) != 0) Return (error);
+
+	/*---------------------------- This is the grdpyramid main code ----------------------------*/
+
+	GMT_Report (API, GMT_MSG_INFORMATION, "Processing input grid\n");
+	if ((P = GMT_Read_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_CONTAINER_AND_DATA, NULL, Ctrl->In.file, NULL)) == NULL) {
+		Return (API->error);
+	}
+
+	while (!Ctrl->L.active || level < Ctrl->L.n_levels) {	/* Keep halving until we cannot or should not */
+		if ((P->header->n_columns + 1) / 2 < GRDPYRAMID_MIN_DIM || (P->header->n_rows + 1) / 2 < GRDPYRAMID_MIN_DIM) {
+			GMT_Report (API, GMT_MSG_INFORMATION, "Next level would have fewer than %d rows or columns; stopping\n", GRDPYRAMID_MIN_DIM);
+			break;
+		}
+		if ((C = gmt_grd_halve (GMT, P)) == NULL) {
+			GMT_Report (API, GMT_MSG_WARNING, "Grid dimensions not divisible by two at factor %u; stopping\n", factor);
+			break;
+		}
+		gmt_grd_pyramid_name (GMT, Ctrl->In.file, factor, file);
+		GMT_Report (API, GMT_MSG_INFORMATION, "Writing overview level %u (factor %u) to %s\n", level + 1, factor, file);
+		if (GMT_Set_Comment (API, GMT_IS_GRID, GMT_COMMENT_IS_OPTION | GMT_COMMENT_IS_COMMAND, options, C)) Return (API->error);
+		if (GMT_Write_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_CONTAINER_AND_DATA, NULL, file, C) != GMT_NOERROR) {
+			Return (API->error);
+		}
+		if (GMT_Destroy_Data (API, &P) != GMT_NOERROR) {	/* Done with the previous level */
+			Return (API->error);
+		}
+		P = C;	C = NULL;	/* The new level becomes the parent of the next */
+		factor *= 2;	level++;
+	}
+	if (level == 0)
+		GMT_Report (API, GMT_MSG_WARNING, "No overview levels could be built for %s\n", Ctrl->In.file);
+	else
+		GMT_Report (API, GMT_MSG_INFORMATION, "Built %u overview level%s for %s\n", level, (level == 1) ? "" : "s", Ctrl->In.file);
+
+	Return (GMT_NOERROR);
+}
@@ -185,7 +185,7 @@ static int parse (struct GMT_CTRL *GMT, struct GRDSAMPLE_CTRL *Ctrl, struct GMT_
 
 EXTERN_MSC int GMT_grdsample (void *V_API, int mode, void *args) {
 
-	int error = 0;
+	int error = 0, *bcr_col = NULL;
 	openmp_int row, col;
 	unsigned int registration;
 
@@ -193,7 +193,7 @@ EXTERN_MSC int GMT_grdsample (void *V_API, int mode, void *args) {
 
 	char format[GMT_BUFSIZ];
 
-	double *lon = NULL, lat, wesn_i[4], wesn_o[4], inc[2], ince[2];
+	double *lon = NULL, *bcr_wx = NULL, lat, wesn_i[4], wesn_o[4], inc[2], ince[2];
 
 	struct GRDSAMPLE_CTRL *Ctrl = NULL;
 	struct GMT_GRID *Gin = NULL, *Gout = NULL;
@@ -256,6 +256,20 @@ EXTERN_MSC int GMT_grdsample (void *V_API, int mode, void *args) {
 
 	gmt_increment_adjust (GMT, wesn_o, inc, registration);	/* In case user specified incs using distance units we must call this here before adjusting wesn_o */
 
+	if (GMT->common.R.active[ISET]) {	/* Asked for a coarser lattice; see if a pyramid overview (from grdpyramid) can stand in for the full grid */
+		char *overview = gmt_grd_pyramid_select (GMT, Ctrl->In.file, Gin->header->inc, inc);
+		if (overview) {	/* Found a suitable level; start over with that grid instead */
+			GMT_Report (API, GMT_MSG_INFORMATION, "Reading pyramid overview %s instead of %s\n", overview, Ctrl->In.file);
+			if (GMT_Destroy_Data (API, &Gin) != GMT_NOERROR) Return (API->error);
+			gmt_M_str_free (Ctrl->In.file);
+			Ctrl->In.file = overview;
+			if ((Gin = GMT_Read_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_CONTAINER_ONLY, NULL, Ctrl->In.file, NULL)) == NULL) {
+				Return (API->error);
+			}
+			gmt_M_memcpy (wesn_i, Gin->header->wesn, 4, double);	/* Reset to the overview's domain */
+		}
+	}
+
 	if (GMT->common.R.active[RSET]) {		/* Gave -R */
 		bool wrap_360_i = (gmt_M_x_is_lon (GMT, GMT_IN) && gmt_M_360_range (Gin->header->wesn[XLO], Gin->header->wesn[XHI]));
 		bool wrap_360_o = (gmt_M_x_is_lon (GMT, GMT_OUT) && gmt_M_360_range (wesn_o[XLO], wesn_o[XHI]));
@@ -375,12 +389,20 @@ EXTERN_MSC int GMT_grdsample (void *V_API, int mode, void *args) {
 			lon[col] += Gin->header->inc[GMT_X] * HH->nxp;
 	}
 
-	/* Loop over input point and estimate output values */
+	/* Since the output is a regular lattice the stencil column and x-weights for each output
+	 * column are the same on every output row, so we precompute them once and then evaluate
+	 * whole rows; this avoids recomputing the convolution weights per node. */
+
+	bcr_col = gmt_M_memory (GMT, NULL, Gout->header->n_columns, int);
+	bcr_wx  = gmt_M_memory (GMT, NULL, 4 * Gout->header->n_columns, double);
+	gmt_bcr_prep_cols (GMT, Gin, lon, Gout->header->n_columns, bcr_col, bcr_wx);
+
+	/* Loop over output rows and estimate output values */
 
 	Gout->header->z_min = FLT_MAX; Gout->header->z_max = -FLT_MAX;	/* Min/max for out */
 
 #ifdef _OPENMP
-#pragma omp parallel for private(row,col,lat,ij) shared(GMT,Gin,Gout,lon)
+#pragma omp parallel for private(row,col,lat,ij) shared(GMT,Gin,Gout,bcr_col,bcr_wx)
 #endif
 	for (row = 0; row < (openmp_int)Gout->header->n_rows; row++) {
 		lat = gmt_M_grd_row_to_y (GMT, row, Gout->header);
@@ -390,14 +412,16 @@ EXTERN_MSC int GMT_grdsample (void *V_API, int mode, void *args) {
 			lat -= Gin->header->inc[GMT_Y] * HH->nyp;
 		else if (lat < Gin->header->wesn[YLO])
 			lat += Gin->header->inc[GMT_Y] * HH->nyp;
+		gmt_bcr_get_z_row (GMT, Gin, lat, Gout->header->n_columns, bcr_col, bcr_wx, &Gout->data[gmt_M_ijp (Gout->header, row, 0)]);
 		for (col = 0; col < (openmp_int)Gout->header->n_columns; col++) {
 			ij = gmt_M_ijp (Gout->header, row, col);
-			Gout->data[ij] = (gmt_grdfloat)gmt_bcr_get_z (GMT, Gin, lon[col], lat);
 			if (Gout->data[ij] < Gout->header->z_min) Gout->header->z_min = Gout->data[ij];
 			if (Gout->data[ij] > Gout->header->z_max) Gout->header->z_max = Gout->data[ij];
 		}
 	}
 	gmt_M_free (GMT, lon);
+	gmt_M_free (GMT, bcr_col);
+	gmt_M_free (GMT, bcr_wx);
 
 	if (!GMT->common.n.truncate && (Gout->header->z_min < Gin->header->z_min || Gout->header->z_max > Gin->header->z_max)) {	/* Report and possibly truncate output to input extrama */
 		GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "Output grid extrema [%g/%g] exceeds extrema of input grid [%g/%g]; to clip output use -n...+c""\n",
@@ -35,7 +35,7 @@
 #define THIS_MODULE_PURPOSE	"Sample one or more grids at specified locations"
 #define THIS_MODULE_KEYS	"<D{,DD),E-<,GG(,>D},SD)=s"
 #define THIS_MODULE_NEEDS	""
-#define THIS_MODULE_OPTIONS "-:>RVabdefghijnoqsw" GMT_OPT("HMmQ")
+#define THIS_MODULE_OPTIONS "-:>RVabdefghijnoqsw" GMT_ADD_x_OPT GMT_OPT("HMmQ")
 
 #define MAX_GRIDS GMT_BUFSIZ	/* Change and recompile if we need to sample more than GMT_BUFSIZ grids */
 
@@ -170,9 +170,9 @@ static int usage (struct GMTAPI_CTRL *API, int level) {
 	GMT_Usage (API, 0, "usage: %s -G%s -G<grid2> ... [<table>] [-A[f|m|p|r|R][+l]] [-C<length>/<ds>[/<spacing>][+a|v][+d|f<value>][+l|r]] "
 		"[-D<dfile>] [-E<line1>[,<line2>,...][+a<az>][+c][+d][+g][+i<step>][+l<length>][+n<np>][+o<az>][+r<radius>]] "
 		"[-F[+b][+n][+r][+z<z0>]] [-N] [%s] [-S[a|l|L|m|p|u|U][+a][+c][+d][+r][+s[<file>]]] [-T<radius>[+e|p]] [%s] [-Z] [%s] [%s] [%s] "
-		"[%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s]\n",
+		"[%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s]%s[%s] [%s]\n",
 		name, GMT_INGRID, GMT_Rgeo_OPT, GMT_V_OPT, GMT_b_OPT, GMT_d_OPT, GMT_e_OPT, GMT_f_OPT, GMT_g_OPT, GMT_h_OPT, GMT_i_OPT, GMT_j_OPT,
-		GMT_n_OPT, GMT_o_OPT, GMT_q_OPT, GMT_s_OPT, GMT_w_OPT, GMT_colon_OPT, GMT_PAR_OPT);
+		GMT_n_OPT, GMT_o_OPT, GMT_q_OPT, GMT_s_OPT, GMT_w_OPT, GMT_x_OPT, GMT_colon_OPT, GMT_PAR_OPT);
 
 	if (level == GMT_SYNOPSIS) return (GMT_MODULE_SYNOPSIS);
 
@@ -246,7 +246,7 @@ static int usage (struct GMTAPI_CTRL *API, int level) {
 	GMT_Usage (API, -2, "Note: -T can only be used with a single non-IMG grid and is incompatible with -A, -C, -D, -E, -S.");
 	GMT_Option (API, "V");
 	GMT_Usage (API, 1, "\n-Z Only output z-values [Default gives all columns].");
-	GMT_Option (API, "a,bi2,bo,d,e,f,g,h,i,j,n,o,q,s,w,:,.");
+	GMT_Option (API, "a,bi2,bo,d,e,f,g,h,i,j,n,o,q,s,w,x,:,.");
 
 	return (GMT_MODULE_USAGE);
 }
@@ -746,6 +746,7 @@ EXTERN_MSC int GMT_grdtrack (void *V_API, int mode, void *args) {
 	sprintf (run_cmd, "# %s %s", GMT->init.module_name, cmd);	/* Build command line argument string */
 	gmt_M_free (GMT, cmd);
 
+	gmt_enable_threads (GMT);	/* Set number of active threads, if supported */
 	GMT_Report (API, GMT_MSG_INFORMATION, "Processing input grid(s)\n");
 
 	gmt_M_memset (wesn, 4, double);
@@ -838,10 +839,18 @@ EXTERN_MSC int GMT_grdtrack (void *V_API, int mode, void *args) {
 	xy_mode = (img_conv_needed) ? 2 : (gmt_M_is_geographic (GMT, GMT_IN) ? 1 : 0);
 
 	if (Ctrl->C.active) {	/* Special case of requesting cross-profiles for given line segments */
+		openmp_int prow;
+		unsigned int n_threads = 1;
 		uint64_t tbl, col, row, seg, prof, n_cols = Ctrl->G.n_grids;
+		double *all_value = NULL;
 		struct GMT_DATASET *Dtmp = NULL;
 		struct GMT_DATASEGMENT *S = NULL;
 
+#ifdef _OPENMP
+		n_threads = omp_get_max_threads ();
+#endif
+		all_value = gmt_M_memory (GMT, NULL, (size_t)n_threads * Ctrl->G.n_grids, double);	/* Per-thread scratch for sampled values */
+
 		if (gmt_M_is_cartesian (GMT, GMT_IN) && Ctrl->A.loxo) {
 			GMT_Report (API, GMT_MSG_WARNING, "Loxodrome mode ignored for Cartesian data.\n");
 			Ctrl->A.loxo = false;
@@ -882,10 +891,18 @@ EXTERN_MSC int GMT_grdtrack (void *V_API, int mode, void *args) {
 				T = Dtmp->table[tbl];
 				for (seg = 0; seg < T->n_segments; seg++) {	/* For each segment to resample */
 					S = T->segment[seg];
-					for (row = 0; row < S->n_rows; row++) {	/* For each row to resample */
-						status = grdtrack_sample_all_grids (GMT, GC, Ctrl->G.n_grids, xy_mode, S->data[GMT_X][row], S->data[GMT_Y][row], value);
-						if (status < 0) some_outside = true;
-						for (col = 4, k = 0; k < Ctrl->G.n_grids; k++, col++) S->data[col][row] = value[k];
+#ifdef _OPENMP
+#pragma omp parallel for private(prow) shared(GMT,Ctrl,GC,S,xy_mode,all_value) reduction(||:some_outside)
+#endif
+					for (prow = 0; prow < (openmp_int)S->n_rows; prow++) {	/* For each row to resample */
+						unsigned int kk;
+						uint64_t colx;
+						double *val = all_value;
+#ifdef _OPENMP
+						val = &all_value[(size_t)omp_get_thread_num () * Ctrl->G.n_grids];
+#endif
+						if (grdtrack_sample_all_grids (GMT, GC, Ctrl->G.n_grids, xy_mode, S->data[GMT_X][prow], S->data[GMT_Y][prow], val) < 0) some_outside = true;
+						for (colx = 4, kk = 0; kk < Ctrl->G.n_grids; kk++, colx++) S->data[colx][prow] = val[kk];
 					}
 				}
 			}
@@ -926,16 +943,27 @@ EXTERN_MSC int GMT_grdtrack (void *V_API, int mode, void *args) {
 			T = Dout->table[tbl];
 			for (seg = 0; seg < T->n_segments; seg++) {	/* For each segment to resample */
 				S = T->segment[seg];
-				for (row = 0; row < S->n_rows; row++) {	/* For each row to resample */
-					status = grdtrack_sample_all_grids (GMT, GC, Ctrl->G.n_grids, xy_mode, S->data[GMT_X][row], S->data[GMT_Y][row], value);
-					for (col = 4, k = 0; k < Ctrl->G.n_grids; k++, col++) S->data[col][row] = value[k];
-					if (status < 0)
+#ifdef _OPENMP
+#pragma omp parallel for private(prow) shared(GMT,Ctrl,GC,S,xy_mode,all_value) reduction(||:some_outside) reduction(+:n_points)
+#endif
+				for (prow = 0; prow < (openmp_int)S->n_rows; prow++) {	/* For each row to resample */
+					int pstatus;
+					unsigned int kk;
+					uint64_t colx;
+					double *val = all_value;
+#ifdef _OPENMP
+					val = &all_value[(size_t)omp_get_thread_num () * Ctrl->G.n_grids];
+#endif
+					pstatus = grdtrack_sample_all_grids (GMT, GC, Ctrl->G.n_grids, xy_mode, S->data[GMT_X][prow], S->data[GMT_Y][prow], val);
+					for (colx = 4, kk = 0; kk < Ctrl->G.n_grids; kk++, colx++) S->data[colx][prow] = val[kk];
+					if (pstatus < 0)
 						some_outside = true;
 					else
 						n_points++;
 				}
 			}
 		}
+		gmt_M_free (GMT, all_value);
 		if (some_outside) GMT_Report (API, GMT_MSG_WARNING, "Some points along your profiles were outside the grid domain(s).\n");
 		if (Dout->n_segments > 1) gmt_set_segmentheader (GMT, GMT_OUT, true);	/* Turn on segment headers on output */
 
@@ -943,22 +971,24 @@ EXTERN_MSC int GMT_grdtrack (void *V_API, int mode, void *args) {
 			struct GMT_DATASET *Stack = NULL;
 			struct GMT_DATASEGMENT *M = NULL;
 			uint64_t dim[GMT_DIM_SIZE], n_rows, *stacked_n = NULL;
-			uint64_t colx, col_s, col0 = 4 + Ctrl->G.n_grids;		/* First column for stacked value in cross-profiles */
+			uint64_t col0 = 4 + Ctrl->G.n_grids;		/* First column for stacked value in cross-profiles */
 			unsigned int n_step = (Ctrl->S.mode < STACK_LOWER) ? 6 : 4;	/* Number of columns per gridded data in stack file */
-			unsigned int gmt_mode_selection = 0, GMT_n_multiples = 0, n_added_cols = 0;
-			double **stack = NULL, *stacked_val = NULL, *stacked_dev = NULL, *stacked_hi = NULL, *stacked_lo = NULL, *dev = NULL;
+			unsigned int n_added_cols = 0, t;
+			double **stack = NULL, **dev = NULL, *stacked_val = NULL, *stacked_dev = NULL, *stacked_hi = NULL, *stacked_lo = NULL;
 			dim[GMT_TBL] = 1;			/* One table */
 			dim[GMT_SEG] = Dout->n_tables;		/* Number of stacks */
 			dim[GMT_COL] = 1 + (uint64_t)n_step * Ctrl->G.n_grids;	/* Number of columns needed in stack file */
 			dim[GMT_ROW] = n_rows = Dout->table[0]->segment[0]->n_rows;	/* Number of rows */
 			if ((Stack = GMT_Create_Data (API, GMT_IS_DATASET, GMT_IS_LINE, 0, dim, NULL, NULL, 0, 0, NULL)) == NULL) Return (API->error);	/* An empty table for stacked results */
 
-			stack = gmt_M_memory (GMT, NULL, Ctrl->G.n_grids, double *);
-			stacked_val = gmt_M_memory (GMT, NULL, Ctrl->G.n_grids, double);
-			stacked_dev = gmt_M_memory (GMT, NULL, Ctrl->G.n_grids, double);
-			stacked_lo = gmt_M_memory (GMT, NULL, Ctrl->G.n_grids, double);
-			stacked_hi = gmt_M_memory (GMT, NULL, Ctrl->G.n_grids, double);
-			stacked_n = gmt_M_memory (GMT, NULL, Ctrl->G.n_grids, uint64_t);
+			/* The rows stack independently so each thread gets its own set of stack bins and scratch arrays */
+			stack = gmt_M_memory (GMT, NULL, (size_t)n_threads * Ctrl->G.n_grids, double *);
+			dev = gmt_M_memory (GMT, NULL, n_threads, double *);
+			stacked_val = gmt_M_memory (GMT, NULL, (size_t)n_threads * Ctrl->G.n_grids, double);
+			stacked_dev = gmt_M_memory (GMT, NULL, (size_t)n_threads * Ctrl->G.n_grids, double);
+			stacked_lo = gmt_M_memory (GMT, NULL, (size_t)n_threads * Ctrl->G.n_grids, double);
+			stacked_hi = gmt_M_memory (GMT, NULL, (size_t)n_threads * Ctrl->G.n_grids, double);
+			stacked_n = gmt_M_memory (GMT, NULL, (size_t)n_threads * Ctrl->G.n_grids, uint64_t);
 			if (Ctrl->S.selected[STACK_ADD_VAL]) n_added_cols++;
 			if (Ctrl->S.selected[STACK_ADD_DEV]) n_added_cols++;
 			if (Ctrl->S.selected[STACK_ADD_RES]) n_added_cols++;
@@ -966,66 +996,88 @@ EXTERN_MSC int GMT_grdtrack (void *V_API, int mode, void *args) {
 				T = Dout->table[tbl];
 				M = Stack->table[0]->segment[tbl];	/* Current stack */
 				M->n_rows = n_rows;
-				for (k = 0; k < Ctrl->G.n_grids; k++)	/* Allocate arrays for stack */
-					stack[k] = gmt_M_memory (GMT, NULL, T->n_segments, double);
-				if (Ctrl->S.mode == STACK_MEDIAN || Ctrl->S.mode == STACK_MODE) dev = gmt_M_memory (GMT, NULL, Dout->table[tbl]->n_segments, double);	/* Need temp array for these methods */
-				for (row = 0; row < n_rows; row++) {	/* For each row to stack across all segments, per data grid */
-					gmt_M_memset (stacked_n, Ctrl->G.n_grids, uint64_t);	/* Reset counts for new stack */
-					for (k = 0; k < Ctrl->G.n_grids; k++) {	/* Reset extremes upon starting new stack */
-						stacked_hi[k] = -DBL_MAX;
-						stacked_lo[k] = +DBL_MAX;
+				for (t = 0; t < n_threads; t++) {	/* Allocate per-thread arrays for stack */
+					for (k = 0; k < Ctrl->G.n_grids; k++)
+						stack[(size_t)t * Ctrl->G.n_grids + k] = gmt_M_memory (GMT, NULL, T->n_segments, double);
+					if (Ctrl->S.mode == STACK_MEDIAN || Ctrl->S.mode == STACK_MODE) dev[t] = gmt_M_memory (GMT, NULL, T->n_segments, double);	/* Need temp array for these methods */
+				}
+#ifdef _OPENMP
+#pragma omp parallel for private(prow) shared(GMT,Ctrl,T,M,stack,dev,stacked_val,stacked_dev,stacked_lo,stacked_hi,stacked_n,n_rows,n_step,n_added_cols,col0)
+#endif
+				for (prow = 0; prow < (openmp_int)n_rows; prow++) {	/* For each row to stack across all segments, per data grid */
+					unsigned int kk, t = 0;
+					unsigned int gmt_mode_selection = 0, GMT_n_multiples = 0;
+					uint64_t row = prow, seg, col, colx, col_s;
+					double **w_stack = NULL, *w_dev = NULL, *w_val = NULL, *w_sig = NULL, *w_lo = NULL, *w_hi = NULL;
+					uint64_t *w_n = NULL;
+#ifdef _OPENMP
+					t = omp_get_thread_num ();
+#endif
+					w_stack = &stack[(size_t)t * Ctrl->G.n_grids];	/* This thread's partial stack bins and scratch */
+					w_dev = dev[t];
+					w_val = &stacked_val[(size_t)t * Ctrl->G.n_grids];
+					w_sig = &stacked_dev[(size_t)t * Ctrl->G.n_grids];
+					w_lo  = &stacked_lo[(size_t)t * Ctrl->G.n_grids];
+					w_hi  = &stacked_hi[(size_t)t * Ctrl->G.n_grids];
+					w_n   = &stacked_n[(size_t)t * Ctrl->G.n_grids];
+					gmt_M_memset (w_n, Ctrl->G.n_grids, uint64_t);	/* Reset counts for new stack */
+					for (kk = 0; kk < Ctrl->G.n_grids; kk++) {	/* Reset extremes upon starting new stack */
+						w_hi[kk] = -DBL_MAX;
+						w_lo[kk] = +DBL_MAX;
 					}
 					for (seg = 0; seg < T->n_segments; seg++) {	/* For each segment to resample */
-						for (col = 4, k = 0; k < Ctrl->G.n_grids; k++, col++) {	/* Collect sampled values across all profiles for same row into temp array */
+						for (col = 4, kk = 0; kk < Ctrl->G.n_grids; kk++, col++) {	/* Collect sampled values across all profiles for same row into temp array */
 							if (gmt_M_is_dnan (T->segment[seg]->data[col][row])) continue;	/* Must skip any NaN entries in any profile */
-							stack[k][stacked_n[k]] = T->segment[seg]->data[col][row];
-							if (stack[k][stacked_n[k]] > stacked_hi[k]) stacked_hi[k] = stack[k][stacked_n[k]];
-							if (stack[k][stacked_n[k]] < stacked_lo[k]) stacked_lo[k] = stack[k][stacked_n[k]];
-							stacked_n[k]++;	/* Number of segments with non-NaN entries so far for this grid */
+							w_stack[kk][w_n[kk]] = T->segment[seg]->data[col][row];
+							if (w_stack[kk][w_n[kk]] > w_hi[kk]) w_hi[kk] = w_stack[kk][w_n[kk]];
+							if (w_stack[kk][w_n[kk]] < w_lo[kk]) w_lo[kk] = w_stack[kk][w_n[kk]];
+							w_n[kk]++;	/* Number of segments with non-NaN entries so far for this grid */
 						}
 					}
 					switch (Ctrl->S.mode) {	/* Compute stacked value per grid */
-						case STACK_MEAN:   for (k = 0; k < Ctrl->G.n_grids; k++) stacked_val[k] = gmt_mean_and_std (GMT, stack[k], stacked_n[k], &stacked_dev[k]); break;
-						case STACK_MEDIAN: for (k = 0; k < Ctrl->G.n_grids; k++) gmt_median (GMT, stack[k], stacked_n[k], stacked_lo[k], stacked_hi[k], 0.5*(stacked_lo[k]+stacked_hi[k]), &stacked_val[k]); break;
-						case STACK_MODE:   for (k = 0; k < Ctrl->G.n_grids; k++) gmt_mode (GMT, stack[k], stacked_n[k], stacked_n[k]/2, 0, gmt_mode_selection, &GMT_n_multiples, &stacked_val[k]); break;
-						case STACK_LOWER:  for (k = 0; k < Ctrl->G.n_grids; k++) stacked_val[k] = gmt_extreme (GMT, stack[k], stacked_n[k], 0.0, 0, -1); break;
-						case STACK_LOWERP: for (k = 0; k < Ctrl->G.n_grids; k++) stacked_val[k] = gmt_extreme (GMT, stack[k], stacked_n[k], 0.0, +1, -1); break;
-						case STACK_UPPER:  for (k = 0; k < Ctrl->G.n_grids; k++) stacked_val[k] = gmt_extreme (GMT, stack[k], stacked_n[k], 0.0, 0, +1); break;
-						case STACK_UPPERN: for (k = 0; k < Ctrl->G.n_grids; k++) stacked_val[k] = gmt_extreme (GMT, stack[k], stacked_n[k], 0.0, -1, +1); break;
+						case STACK_MEAN:   for (kk = 0; kk < Ctrl->G.n_grids; kk++) w_val[kk] = gmt_mean_and_std (GMT, w_stack[kk], w_n[kk], &w_sig[kk]); break;
+						case STACK_MEDIAN: for (kk = 0; kk < Ctrl->G.n_grids; kk++) w_val[kk] = gmt_quantile_inplace (GMT, w_stack[kk], 50.0, w_n[kk]); break;	/* Median by selection avoids sorting (or iterating) per bin */
+						case STACK_MODE:   for (kk = 0; kk < Ctrl->G.n_grids; kk++) gmt_mode (GMT, w_stack[kk], w_n[kk], w_n[kk]/2, 0, gmt_mode_selection, &GMT_n_multiples, &w_val[kk]); break;
+						case STACK_LOWER:  for (kk = 0; kk < Ctrl->G.n_grids; kk++) w_val[kk] = gmt_extreme (GMT, w_stack[kk], w_n[kk], 0.0, 0, -1); break;
+						case STACK_LOWERP: for (kk = 0; kk < Ctrl->G.n_grids; kk++) w_val[kk] = gmt_extreme (GMT, w_stack[kk], w_n[kk], 0.0, +1, -1); break;
+						case STACK_UPPER:  for (kk = 0; kk < Ctrl->G.n_grids; kk++) w_val[kk] = gmt_extreme (GMT, w_stack[kk], w_n[kk], 0.0, 0, +1); break;
+						case STACK_UPPERN: for (kk = 0; kk < Ctrl->G.n_grids; kk++) w_val[kk] = gmt_extreme (GMT, w_stack[kk], w_n[kk], 0.0, -1, +1); break;
 					}
-					if (Ctrl->S.mode == STACK_MEDIAN || Ctrl->S.mode == STACK_MODE) {	/* Compute deviations via stack residuals */
-						for (k = 0; k < Ctrl->G.n_grids; k++) {
-							for (seg = 0; seg < stacked_n[k]; seg++) dev[seg] = fabs (stack[k][seg] - stacked_val[k]);
-							gmt_median (GMT, dev, stacked_n[k], stacked_lo[k] - stacked_val[k], stacked_hi[k] - stacked_val[k], 0.5*(stacked_lo[k]+stacked_hi[k]) - stacked_val[k], &stacked_dev[k]);
-							stacked_dev[k] *= MAD_NORMALIZE;
+					if (Ctrl->S.mode == STACK_MEDIAN || Ctrl->S.mode == STACK_MODE) {	/* Compute MAD deviations via stack residuals */
+						for (kk = 0; kk < Ctrl->G.n_grids; kk++) {
+							for (seg = 0; seg < w_n[kk]; seg++) w_dev[seg] = fabs (w_stack[kk][seg] - w_val[kk]);
+							w_sig[kk] = MAD_NORMALIZE * gmt_quantile_inplace (GMT, w_dev, 50.0, w_n[kk]);
 						}
 					}
 					else if (Ctrl->S.mode >= STACK_LOWER) {	/* Use half-range as deviation */
-						for (k = 0; k < Ctrl->G.n_grids; k++) stacked_dev[k] = 0.5 * (stacked_hi[k] - stacked_lo[k]);
+						for (kk = 0; kk < Ctrl->G.n_grids; kk++) w_sig[kk] = 0.5 * (w_hi[kk] - w_lo[kk]);
 					}
 					/* Here we have everything needed to populate output arrays */
 					M->data[0][row] = T->segment[0]->data[2][row];	/* Copy over distance value */
-					for (col = 4, colx = col0, k = 0; k < Ctrl->G.n_grids; k++, col++, colx += n_added_cols) {	/* Place stacked, deviation, low, high [and lo_env hi_env] for each grid */
-						M->data[1+k*n_step][row] = stacked_val[k];	/* The stacked value */
-						M->data[2+k*n_step][row] = stacked_dev[k];	/* The stacked deviation */
-						M->data[3+k*n_step][row] = stacked_lo[k];	/* The stacked low value */
-						M->data[4+k*n_step][row] = stacked_hi[k];	/* The stacked high value */
+					for (col = 4, colx = col0, kk = 0; kk < Ctrl->G.n_grids; kk++, col++, colx += n_added_cols) {	/* Place stacked, deviation, low, high [and lo_env hi_env] for each grid */
+						M->data[1+kk*n_step][row] = w_val[kk];	/* The stacked value */
+						M->data[2+kk*n_step][row] = w_sig[kk];	/* The stacked deviation */
+						M->data[3+kk*n_step][row] = w_lo[kk];	/* The stacked low value */
+						M->data[4+kk*n_step][row] = w_hi[kk];	/* The stacked high value */
 						if (Ctrl->S.mode >= STACK_LOWER) continue;
-						M->data[5+k*n_step][row] = stacked_val[k] - Ctrl->S.factor * stacked_dev[k];	/* The low envelope value */
-						M->data[6+k*n_step][row] = stacked_val[k] + Ctrl->S.factor * stacked_dev[k];	/* The low envelope value */
+						M->data[5+kk*n_step][row] = w_val[kk] - Ctrl->S.factor * w_sig[kk];	/* The low envelope value */
+						M->data[6+kk*n_step][row] = w_val[kk] + Ctrl->S.factor * w_sig[kk];	/* The low envelope value */
 						if (n_added_cols == 0) continue;	/* No modification to profile outputs requested */
 						for (seg = 0; seg < T->n_segments; seg++) {	/* For each segment to append to */
 							col_s = colx;	/* Start over at this column */
-							if (Ctrl->S.selected[STACK_ADD_VAL]) T->segment[seg]->data[col_s++][row] = stacked_val[k];	/* Place stacked value at end of profile */
-							if (Ctrl->S.selected[STACK_ADD_DEV]) T->segment[seg]->data[col_s++][row] = stacked_dev[k];	/* Place deviation at end of profile */
-							if (Ctrl->S.selected[STACK_ADD_RES]) T->segment[seg]->data[col_s++][row] = T->segment[seg]->data[col][row] - stacked_val[k];	/* Place residuals(s) at end of profile */
+							if (Ctrl->S.selected[STACK_ADD_VAL]) T->segment[seg]->data[col_s++][row] = w_val[kk];	/* Place stacked value at end of profile */
+							if (Ctrl->S.selected[STACK_ADD_DEV]) T->segment[seg]->data[col_s++][row] = w_sig[kk];	/* Place deviation at end of profile */
+							if (Ctrl->S.selected[STACK_ADD_RES]) T->segment[seg]->data[col_s++][row] = T->segment[seg]->data[col][row] - w_val[kk];	/* Place residuals(s) at end of profile */
 						}
 					}
 				}
-				for (k = 0; k < Ctrl->G.n_grids; k++) gmt_M_free (GMT, stack[k]);
-				if (Ctrl->S.mode == STACK_MEDIAN || Ctrl->S.mode == STACK_MODE) gmt_M_free (GMT, dev);
+				for (t = 0; t < n_threads; t++) {
+					for (k = 0; k < Ctrl->G.n_grids; k++) gmt_M_free (GMT, stack[(size_t)t * Ctrl->G.n_grids + k]);
+					if (Ctrl->S.mode == STACK_MEDIAN || Ctrl->S.mode == STACK_MODE) gmt_M_free (GMT, dev[t]);
+				}
 			}
 			gmt_M_free (GMT, stack);
+			gmt_M_free (GMT, dev);
 			gmt_M_free (GMT, stacked_val);
 			gmt_M_free (GMT, stacked_dev);
 			gmt_M_free (GMT, stacked_lo);
@@ -1158,11 +1210,17 @@ EXTERN_MSC int GMT_grdtrack (void *V_API, int mode, void *args) {
 		}
 	}
 	else if (Ctrl->E.active) {	/* Quick sampling along given lines */
-		int status;
-		unsigned int k;
-		uint64_t col, n_cols = Din->n_columns + Ctrl->G.n_grids, row, seg;
+		openmp_int prow;
+		unsigned int n_threads = 1;
+		uint64_t col, n_cols = Din->n_columns + Ctrl->G.n_grids, seg;
+		double *all_value = NULL;
 		struct GMT_DATASEGMENT *Sin = NULL, *Sout = NULL;
 
+#ifdef _OPENMP
+		n_threads = omp_get_max_threads ();
+#endif
+		all_value = gmt_M_memory (GMT, NULL, (size_t)n_threads * Ctrl->G.n_grids, double);	/* Per-thread scratch for sampled values */
+
 		DH = gmt_get_DD_hidden (Din);
 		DH->dim[GMT_COL] = n_cols;	/* State we want a different set of columns on output */
 		Dout = GMT_Duplicate_Data (API, GMT_IS_DATASET, GMT_DUPLICATE_ALLOC, Din);	/* Same table length as Din, but with up to n_cols columns (lon, lat, dist, g1, g2, ...) */
@@ -1172,13 +1230,22 @@ EXTERN_MSC int GMT_grdtrack (void *V_API, int mode, void *args) {
 			Sin  = Din->table[0]->segment[seg];	/* Shorthand */
 			Sout = Dout->table[0]->segment[seg];	/* Shorthand */
 			for (col = 0; col < Din->n_columns; col++) gmt_M_memcpy (Sout->data[col], Sin->data[col], Sin->n_rows, double);
-			for (row = 0; row < Sin->n_rows; row++) {	/* For each row  */
-				status = grdtrack_sample_all_grids (GMT, GC, Ctrl->G.n_grids, xy_mode, Sin->data[GMT_X][row], Sin->data[GMT_Y][row], value);
-				if (status < 0) some_outside = true;
-				for (col = Din->n_columns, k = 0; k < Ctrl->G.n_grids; k++, col++) Sout->data[col][row] = value[k];
+#ifdef _OPENMP
+#pragma omp parallel for private(prow) shared(GMT,Ctrl,GC,Din,Sin,Sout,xy_mode,all_value) reduction(||:some_outside) reduction(+:n_points)
+#endif
+			for (prow = 0; prow < (openmp_int)Sin->n_rows; prow++) {	/* For each row  */
+				unsigned int kk;
+				uint64_t colx;
+				double *val = all_value;
+#ifdef _OPENMP
+				val = &all_value[(size_t)omp_get_thread_num () * Ctrl->G.n_grids];
+#endif
+				if (grdtrack_sample_all_grids (GMT, GC, Ctrl->G.n_grids, xy_mode, Sin->data[GMT_X][prow], Sin->data[GMT_Y][prow], val) < 0) some_outside = true;
+				for (colx = Din->n_columns, kk = 0; kk < Ctrl->G.n_grids; kk++, colx++) Sout->data[colx][prow] = val[kk];
 				n_points++;
 			}
 		}
+		gmt_M_free (GMT, all_value);
 		if (some_outside) GMT_Report (API, GMT_MSG_WARNING, "Some points along your profiles were outside the grid domain(s).\n");
 		T = Dout->table[0];
 		T->n_headers = 2;
@@ -501,60 +501,88 @@ GMT_LOCAL void grdtrend_write_model_parameters (struct GMT_CTRL *GMT, struct GRD
 
 GMT_LOCAL void grdtrend_load_gtg_and_gtd (struct GMT_CTRL *GMT, struct GMT_GRID *G, double *xval, double *yval, double *pstuff, double *gtg, double *gtd, unsigned int n_model, struct GMT_GRID *W, bool weighted, p_to_eval_func eval) {
 	/* Routine to load the matrix G'G (gtg) and vector G'd (gtd)
-	for the normal equations.  Routine uses indices row,col to refer
-	to the grid file of data, and k,l to refer to the k_row, l_col
-	of the normal equations matrix.  We need sums of [weighted]
-	data and model functions in gtg and gtd.  We save time by
-	loading only lower triangular part of gtg and then filling
-	by symmetry after row,col loop.  */
+	for the normal equations.  Every basis function is a separable
+	product of a Legendre polynomial in x and one in y, and since
+	P_n(1) = 1 we can read off the x-parts (y-parts) of the full
+	basis by evaluating it at y = 1 (x = 1).  We tabulate those
+	once per column and row up front so each node only costs one
+	multiply per basis function instead of a polynomial evaluation.
+	Each grid row accumulates into its own slots of the part array;
+	these partials are folded in fixed row order at the end so the
+	sums come out the same no matter how many threads are used.
+	We only form the lower triangular part of the symmetric gtg
+	and fill the rest by symmetry at the end.  */
 
 	openmp_int row, col;
-	unsigned int k, l, n_used = 0;
-	uint64_t ij;
-	gmt_M_unused(GMT);
-
-	/* First zero things out to start */
+	unsigned int k, l, n_used = 0, stride = n_model * n_model + n_model;	/* Per-row slots for gtg followed by gtd partials */
+	double *xbasis = NULL, *ybasis = NULL, *part = NULL, *pg = NULL, *pd = NULL;
 
-	gmt_M_memset (gtd, n_model, double);
-	gmt_M_memset (gtg, n_model * n_model, double);
+	xbasis = gmt_M_memory (GMT, NULL, (size_t)G->header->n_columns * n_model, double);
+	ybasis = gmt_M_memory (GMT, NULL, (size_t)G->header->n_rows * n_model, double);
+	part = gmt_M_memory (GMT, NULL, (size_t)G->header->n_rows * stride, double);
 
-	/* Now get going.  Have to eval separately in i and j,
-	   because it is possible that we skip data when i = 0.
-	   Loop over all data */
+	for (col = 0; col < (openmp_int)G->header->n_columns; col++) {	/* x-parts of the basis, evaluated at (x, 1) */
+		(*eval) (pstuff, n_model, xval[col], 1.0, 1, 1);
+		gmt_M_memcpy (&xbasis[(size_t)col*n_model], pstuff, n_model, double);
+	}
+	for (row = 0; row < (openmp_int)G->header->n_rows; row++) {	/* y-parts of the basis, evaluated at (1, y) */
+		(*eval) (pstuff, n_model, 1.0, yval[row], 1, 1);
+		gmt_M_memcpy (&ybasis[(size_t)row*n_model], pstuff, n_model, double);
+	}
 
-	gmt_M_row_loop (GMT, G, row) {
-		(*eval) (pstuff, n_model, xval[0], yval[row], 0, 1);
-		gmt_M_col_loop (GMT, G, row, col, ij) {
+#ifdef _OPENMP
+#pragma omp parallel for private(row,col,k,l) shared(G,W,weighted,n_model,stride,xbasis,ybasis,part) reduction(+:n_used) schedule(static)
+#endif
+	for (row = 0; row < (openmp_int)G->header->n_rows; row++) {
+		uint64_t ij = gmt_M_ijp (G->header, row, 0);
+		double b[10], wz;	/* Basis at the node; parse limits n_model to 10 */
+		double *prow_g = &part[(size_t)row * stride], *prow_d = prow_g + n_model * n_model;
+		double *yb = &ybasis[(size_t)row * n_model], *xb = xbasis;
+		for (col = 0; col < (openmp_int)G->header->n_columns; col++, ij++, xb += n_model) {
 
-			if (gmt_M_is_fnan (G->data[ij]))continue;
+			if (gmt_M_is_fnan (G->data[ij])) continue;
 
 			n_used++;
-			(*eval) (pstuff, n_model, xval[col], yval[row], 1, 0);
+			for (k = 0; k < n_model; k++) b[k] = xb[k] * yb[k];
 
 			if (weighted) {
 				/* Loop over all gtg and gtd elements */
-				gtd[0] += (G->data[ij] * W->data[ij]);	/* Implicitly multiply by pstuff[0] which is 1 */
-				gtg[0] += W->data[ij];			/* Implicitly multiply by pstuff[0] which is 1 */
+				wz = W->data[ij];
+				prow_d[0] += (G->data[ij] * wz);	/* Implicitly multiply by b[0] which is 1 */
+				prow_g[0] += wz;			/* Implicitly multiply by b[0] which is 1 */
 				for (k = 1; k < n_model; k++) {
-					gtd[k] += (G->data[ij] * W->data[ij] * pstuff[k]);
-					gtg[k*n_model] += (W->data[ij] * pstuff[k]);
+					prow_d[k] += (G->data[ij] * wz * b[k]);
+					prow_g[k*n_model] += (wz * b[k]);
 					for (l = 1; l <= k; l++)
-						gtg[k*n_model + l] += (pstuff[k]*pstuff[l]*W->data[ij]);
+						prow_g[k*n_model + l] += (b[k]*b[l]*wz);
 				}
 			}
 			else {	/* If !weighted  */
 				/* Loop over all gtg and gtd elements; do gtg[0] afterwards */
-				gtd[0] += G->data[ij];	/* Implicitly multiply by pstuff[0] which is 1 */
+				prow_d[0] += G->data[ij];	/* Implicitly multiply by b[0] which is 1 */
 				for (k = 1; k < n_model; k++) {	/* Rows in GTG */
-					gtd[k] += (G->data[ij] * pstuff[k]);
-					gtg[k*n_model] += pstuff[k];
+					prow_d[k] += (G->data[ij] * b[k]);
+					prow_g[k*n_model] += b[k];
 					for (l = 1; l <= k; l++)
-						gtg[k*n_model + l] += (pstuff[k]*pstuff[l]);
+						prow_g[k*n_model + l] += (b[k]*b[l]);
 				}
 			}	/* End if  */
 		}
 	}	/* End of loop over data row,col  */
 
+	/* Fold the per-row partials in fixed row order */
+
+	gmt_M_memset (gtd, n_model, double);
+	gmt_M_memset (gtg, n_model * n_model, double);
+	for (row = 0; row < (openmp_int)G->header->n_rows; row++) {
+		pg = &part[(size_t)row * stride];	pd = pg + n_model * n_model;
+		for (k = 0; k < n_model * n_model; k++) gtg[k] += pg[k];
+		for (k = 0; k < n_model; k++) gtd[k] += pd[k];
+	}
+	gmt_M_free (GMT, part);
+	gmt_M_free (GMT, ybasis);
+	gmt_M_free (GMT, xbasis);
+
 	/* Now if !weighted, use more accurate sum for gtg[0], and set symmetry */
 
 	if (!weighted) gtg[0] = (double)n_used;
@@ -568,6 +596,34 @@ GMT_LOCAL void grdtrend_load_gtg_and_gtd (struct GMT_CTRL *GMT, struct GMT_GRID
 	return;
 }
 
+GMT_LOCAL int grdtrend_solve_normal_equations (struct GMT_CTRL *GMT, double *gtg, double *gtd, unsigned int n_model) {
+	/* Solve gtg * m = gtd, returning the model in gtd.  Gaussian elimination with
+	 * partial pivoting is tried first; if the system turns out (near-)singular, as
+	 * high-order fits can produce, we redo the solve via the SVD which returns the
+	 * minimum-norm solution instead of failing outright.  */
+	int ierror;
+	double *A = NULL, *b = NULL, *w = NULL, *v = NULL;
+
+	A = gmt_M_memory (GMT, NULL, (size_t)n_model * n_model, double);
+	b = gmt_M_memory (GMT, NULL, n_model, double);
+	gmt_M_memcpy (A, gtg, (size_t)n_model * n_model, double);	/* gmt_gauss destroys its input */
+	gmt_M_memcpy (b, gtd, n_model, double);
+	if ((ierror = gmt_gauss (GMT, A, b, n_model, n_model, true)) == 0) {	/* System was well-behaved */
+		gmt_M_memcpy (gtd, b, n_model, double);
+		gmt_M_free (GMT, A);	gmt_M_free (GMT, b);
+		return (GMT_NOERROR);
+	}
+	GMT_Report (GMT->parent, GMT_MSG_WARNING, "Gauss returns error code %d; retrying via SVD\n", ierror);
+	w = gmt_M_memory (GMT, NULL, n_model, double);
+	v = gmt_M_memory (GMT, NULL, (size_t)n_model * n_model, double);
+	gmt_M_memcpy (A, gtg, (size_t)n_model * n_model, double);	/* Restore the normal matrix */
+	gmt_M_memcpy (b, gtd, n_model, double);
+	if ((ierror = gmt_svdcmp (GMT, A, n_model, n_model, w, v)) == 0)
+		(void)gmt_solve_svd (GMT, A, n_model, n_model, v, w, b, 1U, gtd, GMT_CONV15_LIMIT, GMT_SVD_EIGEN_RATIO_CUTOFF);
+	gmt_M_free (GMT, A);	gmt_M_free (GMT, b);	gmt_M_free (GMT, w);	gmt_M_free (GMT, v);
+	return (ierror);
+}
+
 #define bailout(code) {gmt_M_free_options (mode); return (code);}
 #define Return(code) {Free_Ctrl (GMT, Ctrl); gmt_end_module (GMT, GMT_cpy); bailout (code);}
 
@@ -719,9 +775,9 @@ EXTERN_MSC int GMT_grdtrend (void *V_API, int mode, void *args) {
 	else {	/* Problem is not trivial  !!  */
 		int ierror;
 		grdtrend_load_gtg_and_gtd (GMT, G, xval, yval, pstuff, gtg, gtd, Ctrl->N.value, W, weighted, eval);
-		ierror = gmt_gauss (GMT, gtg, gtd, Ctrl->N.value, Ctrl->N.value, true);
+		ierror = grdtrend_solve_normal_equations (GMT, gtg, gtd, Ctrl->N.value);
 		if (ierror) {
-			GMT_Report (API, GMT_MSG_ERROR, "Gauss returns error code %d\n", ierror);
+			GMT_Report (API, GMT_MSG_ERROR, "Failed to solve the normal equations [error code %d]\n", ierror);
 			error = GMT_RUNTIME_ERROR;
 			goto END;
 		}
@@ -737,9 +793,9 @@ EXTERN_MSC int GMT_grdtrend (void *V_API, int mode, void *args) {
 				gmt_M_memcpy (old, gtd, Ctrl->N.value, double);
 				scale = grdtrend_compute_robust_weight (GMT, R, W);
 				grdtrend_load_gtg_and_gtd (GMT, G, xval, yval, pstuff, gtg, gtd, Ctrl->N.value, W, weighted, eval);
-				ierror = gmt_gauss (GMT, gtg, gtd, Ctrl->N.value, Ctrl->N.value, true);
+				ierror = grdtrend_solve_normal_equations (GMT, gtg, gtd, Ctrl->N.value);
 				if (ierror) {
-					GMT_Report (API, GMT_MSG_ERROR, "Gauss returns error code %d\n", ierror);
+					GMT_Report (API, GMT_MSG_ERROR, "Failed to solve the normal equations [error code %d]\n", ierror);
 					error = GMT_RUNTIME_ERROR;
 					goto END;
 				}
@@ -89,6 +89,15 @@ struct GRDVECTOR_CTRL {
 	} Z;
 };
 
+struct GRDVECTOR_DATA {	/* Precomputed geometry for one vector */
+	double x, y;		/* User coordinates of the node */
+	double plot_x, plot_y;	/* Plot coordinates of the (justified) vector tail [Cartesian vectors only] */
+	double x2, y2;		/* Plot coordinates of the (justified) vector tip [Cartesian vectors only] */
+	double azim;		/* Data azimuth of the vector */
+	double length;		/* Data vector length in user units */
+	double value;		/* The value used for CPT lookups */
+};
+
 static void *New_Ctrl (struct GMT_CTRL *GMT) {	/* Allocate and initialize a new control structure */
 	struct GRDVECTOR_CTRL *C = NULL;
 	char unit[5] = "cimp";
@@ -423,16 +432,18 @@ static int parse (struct GMT_CTRL *GMT, struct GRDVECTOR_CTRL *Ctrl, struct GMT_
 #define Return(code) {Free_Ctrl (GMT, Ctrl); gmt_end_module (GMT, GMT_cpy); bailout (code);}
 
 EXTERN_MSC int GMT_grdvector (void *V_API, int mode, void *args) {
-	openmp_int row, col, col_0, row_0, d_col, d_row;
+	openmp_int row, col, col_0, row_0, d_col, d_row, i;
 	unsigned int justify, k, n_warn[3] = {0, 0, 0}, warn;
 	int error = 0;
 	bool Geographic;
 
-	uint64_t ij;
+	uint64_t ij, n = 0;
+	size_t n_alloc = 0;
 
 	double tmp, x, y, plot_x, plot_y, x_off, y_off, f, headpen_width = 0.0;
 	double x2, y2, wesn[4], value, vec_data_length, vec_azim, scaled_vec_length, c, s, dim[PSL_MAX_DIMS];
 
+	struct GRDVECTOR_DATA *data = NULL;
 	struct GMT_GRID *Grid[2] = {NULL, NULL};
 	struct GMT_PALETTE *P = NULL;
 	struct GMT_PEN last_headpen;
@@ -758,6 +769,10 @@ EXTERN_MSC int GMT_grdvector (void *V_API, int mode, void *args) {
 		Ctrl->Q.S.symbol = was;	/* Restore to original type */
 	}
 
+	/* First pass: Collect the nodes that survive the -I stride, NaN, and inside tests.
+	 * Note: gmt_map_outside updates GMT->current.map.this_x|y_status so it must stay serial. */
+
+	gmt_set_meminc (GMT, GMT_BIG_CHUNK);	/* Only allocate a sizeable amount of GRDVECTOR_DATA structures at the time */
 	for (row = row_0; row < (openmp_int)Grid[1]->header->n_rows; row += d_row) {
 		y = gmt_M_grd_row_to_y (GMT, row, Grid[0]->header);	/* Latitude OR y OR radius */
 		for (col = col_0; col < (openmp_int)Grid[1]->header->n_columns; col += d_col) {
@@ -788,92 +803,122 @@ EXTERN_MSC int GMT_grdvector (void *V_API, int mode, void *args) {
 				value = vec_data_length;
 			}
 
-			if (Ctrl->C.active) {	/* Get color based on the vector length */
-				gmt_get_fill_from_z (GMT, P, value, &Ctrl->G.fill);
+			if (n == n_alloc) data = gmt_M_malloc (GMT, data, n, &n_alloc, struct GRDVECTOR_DATA);
+			data[n].x = x;	data[n].y = y;
+			data[n].azim = vec_azim;	data[n].length = vec_data_length;	data[n].value = value;
+			n++;
+		}
+	}
+
+	justify = PSL_vec_justify (Ctrl->Q.S.v.status);	/* Return justification as 0-2 */
+
+	if (!Geographic) {
+		/* Second pass: Convert the surviving nodes to plot coordinates and Cartesian endpoints.
+		 * The per-point projection functions are stateless for all projections except GMT_GENPER,
+		 * whose forward routine updates GMT->current.proj.g_outside (see gmt_grd_project), so
+		 * unless that projection was selected we can spread the nodes among the available threads.
+		 * Geo-vectors are excluded since gmt_geo_vector plots as it computes. */
+#ifdef _OPENMP
+#pragma omp parallel for if (GMT->current.proj.projection_GMT != GMT_GENPER) private(i,vec_azim,scaled_vec_length,plot_x,plot_y,x2,y2,s,c,x_off,y_off) shared(GMT,Ctrl,data,n,justify)
+#endif
+		for (i = 0; i < (openmp_int)n; i++) {
+			vec_azim = data[i].azim;
+			scaled_vec_length = (Ctrl->S.constant) ? Ctrl->S.factor : data[i].length * Ctrl->S.factor;
+			/* scaled_vec_length is now in inches */
+			gmt_geo_to_xy (GMT, data[i].x, data[i].y, &plot_x, &plot_y);
+			if (gmt_M_is_geographic (GMT, GMT_IN))	/* Must align azimuth with local north */
+				vec_azim = 90.0 - gmt_azim_to_angle (GMT, data[i].x, data[i].y, 0.1, vec_azim);
+			if (Ctrl->T.active)	/* Deal with negative scales in x and/or y which affect the azimuths */
+				gmt_flip_azim_d (GMT, &vec_azim);
+			vec_azim = 90.0 - vec_azim;	/* Transform azimuths to plot angle */
+			if (GMT->current.proj.projection_GMT == GMT_POLAR) {	/* Must rotate azimuth since circular projection */
+				double x_orient;
+				x_orient = (GMT->current.proj.got_azimuths) ? -(data[i].x + GMT->current.proj.p_base_angle) : data[i].x - GMT->current.proj.p_base_angle - 90.0;
+				vec_azim += x_orient;
 			}
+			vec_azim *= D2R;		/* vec_azim is now in radians */
+			sincos (vec_azim, &s, &c);
+			x2 = plot_x + scaled_vec_length * c;
+			y2 = plot_y + scaled_vec_length * s;
+
+			if (justify) {	/* Justify vector at center, or tip [beginning] */
+				x_off = justify * 0.5 * (x2 - plot_x);	y_off = justify * 0.5 * (y2 - plot_y);
+				plot_x -= x_off;	plot_y -= y_off;
+				x2 -= x_off;		y2 -= y_off;
+			}
+			data[i].plot_x = plot_x;	data[i].plot_y = plot_y;
+			data[i].x2 = x2;		data[i].y2 = y2;
+		}
+	}
 
-			if (Ctrl->W.cpt_effect) {	/* Should color apply to pen, fill, or both [fill] */
-				if (Ctrl->W.pen.cptmode & 1) {	/* Change pen color via CPT */
-					gmt_M_rgb_copy (Ctrl->W.pen.rgb, Ctrl->G.fill.rgb);
-					if (!gmt_M_same_pen (Ctrl->W.pen, last_headpen)) {	/* Since color may have changed */
-						PSL_defpen (PSL, "PSL_vecheadpen", Ctrl->W.pen.width, Ctrl->W.pen.style, Ctrl->W.pen.offset, Ctrl->W.pen.rgb);
-						last_headpen = Ctrl->W.pen;
-					}
+	/* Final pass: Emit the vectors in node order since the CPT machinery and PSL are serial */
+
+	for (i = 0; i < (openmp_int)n; i++) {
+		if (Ctrl->C.active) {	/* Get color based on the vector length */
+			gmt_get_fill_from_z (GMT, P, data[i].value, &Ctrl->G.fill);
+		}
+
+		if (Ctrl->W.cpt_effect) {	/* Should color apply to pen, fill, or both [fill] */
+			if (Ctrl->W.pen.cptmode & 1) {	/* Change pen color via CPT */
+				gmt_M_rgb_copy (Ctrl->W.pen.rgb, Ctrl->G.fill.rgb);
+				if (!gmt_M_same_pen (Ctrl->W.pen, last_headpen)) {	/* Since color may have changed */
+					PSL_defpen (PSL, "PSL_vecheadpen", Ctrl->W.pen.width, Ctrl->W.pen.style, Ctrl->W.pen.offset, Ctrl->W.pen.rgb);
+					last_headpen = Ctrl->W.pen;
 				}
 			}
-			if (Ctrl->C.active) {	/* Update pen and fill color settings */
-				if (!Ctrl->Q.active)	/* Must update stick pen */
-					gmt_M_rgb_copy (Ctrl->W.pen.rgb, Ctrl->G.fill.rgb);
-				gmt_setpen (GMT, &Ctrl->W.pen);
-				if (Ctrl->Q.active) gmt_setfill (GMT, &Ctrl->G.fill, Ctrl->W.active);
-				gmt_init_vector_param (GMT, &Ctrl->Q.S, true, Ctrl->W.active, &Ctrl->W.pen, true, &Ctrl->G.fill);
-			}
+		}
+		if (Ctrl->C.active) {	/* Update pen and fill color settings */
+			if (!Ctrl->Q.active)	/* Must update stick pen */
+				gmt_M_rgb_copy (Ctrl->W.pen.rgb, Ctrl->G.fill.rgb);
+			gmt_setpen (GMT, &Ctrl->W.pen);
+			if (Ctrl->Q.active) gmt_setfill (GMT, &Ctrl->G.fill, Ctrl->W.active);
+			gmt_init_vector_param (GMT, &Ctrl->Q.S, true, Ctrl->W.active, &Ctrl->W.pen, true, &Ctrl->G.fill);
+		}
 
-			scaled_vec_length = (Ctrl->S.constant) ? Ctrl->S.factor : vec_data_length * Ctrl->S.factor;
-			/* scaled_vec_length is now in inches (Cartesian) or km (Geographic) */
+		scaled_vec_length = (Ctrl->S.constant) ? Ctrl->S.factor : data[i].length * Ctrl->S.factor;
+		/* scaled_vec_length is now in inches (Cartesian) or km (Geographic) */
 
-			if (Geographic) {	/* Draw great-circle geo-vectors */
-				Ctrl->Q.S.v.value = vec_data_length;
-				warn = gmt_geo_vector (GMT, x, y, vec_azim, scaled_vec_length, &Ctrl->W.pen, &Ctrl->Q.S);
-				n_warn[warn]++;
+		if (Geographic) {	/* Draw great-circle geo-vectors */
+			Ctrl->Q.S.v.value = data[i].length;
+			warn = gmt_geo_vector (GMT, data[i].x, data[i].y, data[i].azim, scaled_vec_length, &Ctrl->W.pen, &Ctrl->Q.S);
+			n_warn[warn]++;
+		}
+		else {	/* Draw straight Cartesian vectors from the precomputed endpoints */
+			n_warn[0]++;
+			if (!Ctrl->Q.active) {	/* Just a vector stem: line segment */
+				PSL_plotsegment (PSL, data[i].plot_x, data[i].plot_y, data[i].x2, data[i].y2);
+				continue;
 			}
-			else {	/* Draw straight Cartesian vectors */
-				gmt_geo_to_xy (GMT, x, y, &plot_x, &plot_y);
-				if (gmt_M_is_geographic (GMT, GMT_IN))	/* Must align azimuth with local north */
-					vec_azim = 90.0 - gmt_azim_to_angle (GMT, x, y, 0.1, vec_azim);
-				if (Ctrl->T.active)	/* Deal with negative scales in x and/or y which affect the azimuths */
-					gmt_flip_azim_d (GMT, &vec_azim);
-				vec_azim = 90.0 - vec_azim;	/* Transform azimuths to plot angle */
-				if (GMT->current.proj.projection_GMT == GMT_POLAR) {	/* Must rotate azimuth since circular projection */
-					double x_orient;
-					x_orient = (GMT->current.proj.got_azimuths) ? -(x + GMT->current.proj.p_base_angle) : x - GMT->current.proj.p_base_angle - 90.0;
-					vec_azim += x_orient;
-				}
-				vec_azim *= D2R;		/* vec_azim is now in radians */
-				sincos (vec_azim, &s, &c);
-				x2 = plot_x + scaled_vec_length * c;
-				y2 = plot_y + scaled_vec_length * s;
-
-				justify = PSL_vec_justify (Ctrl->Q.S.v.status);	/* Return justification as 0-2 */
-				if (justify) {	/* Justify vector at center, or tip [beginning] */
-					x_off = justify * 0.5 * (x2 - plot_x);	y_off = justify * 0.5 * (y2 - plot_y);
-					plot_x -= x_off;	plot_y -= y_off;
-					x2 -= x_off;		y2 -= y_off;
-				}
-				n_warn[0]++;
-				if (!Ctrl->Q.active) {	/* Just a vector stem: line segment */
-					PSL_plotsegment (PSL, plot_x, plot_y, x2, y2);
-					continue;
-				}
-				/* Must plot a vector head */
-				dim[PSL_VEC_XTIP]          = x2;
-				dim[PSL_VEC_YTIP]          = y2;
-				dim[PSL_VEC_TAIL_WIDTH]    = Ctrl->Q.S.v.v_width;
-				dim[PSL_VEC_HEAD_LENGTH]   = Ctrl->Q.S.v.h_length;
-				dim[PSL_VEC_HEAD_WIDTH]    = Ctrl->Q.S.v.h_width;
-				dim[PSL_VEC_HEAD_PENWIDTH] = headpen_width;	/* Possibly shrunk head pen width */
-				f = gmt_get_vector_shrinking (GMT, &(Ctrl->Q.S.v), vec_data_length, scaled_vec_length);	/* Vector attribute shrinking factor or 1 */
-				if (f < 1.0) {	/* Scale arrow attributes down with length */
-					for (k = 2; k <= 4; k++) dim[k] *= f;
-					dim[PSL_VEC_HEAD_PENWIDTH] *= f;
-				}
-				if (Ctrl->Q.S.symbol == GMT_SYMBOL_VECTOR_V4) {	/* Do the deprecated GMT4 vector polygon instead */
-					int v4_outline = Ctrl->W.active;
-					double *this_rgb = NULL;
-					if (Ctrl->G.active || Ctrl->C.active)
-						this_rgb = Ctrl->G.fill.rgb;
-					else
-						this_rgb = GMT->session.no_rgb;
-					if (v4_outline) gmt_setpen (GMT, &Ctrl->W.pen);
-					if (Ctrl->Q.S.v.status & PSL_VEC_BEGIN) v4_outline += 8;	/* Double-headed */
-					psl_vector_v4 (PSL, plot_x, plot_y, dim, this_rgb, v4_outline);
-				}
+			/* Must plot a vector head */
+			dim[PSL_VEC_XTIP]          = data[i].x2;
+			dim[PSL_VEC_YTIP]          = data[i].y2;
+			dim[PSL_VEC_TAIL_WIDTH]    = Ctrl->Q.S.v.v_width;
+			dim[PSL_VEC_HEAD_LENGTH]   = Ctrl->Q.S.v.h_length;
+			dim[PSL_VEC_HEAD_WIDTH]    = Ctrl->Q.S.v.h_width;
+			dim[PSL_VEC_HEAD_PENWIDTH] = headpen_width;	/* Possibly shrunk head pen width */
+			f = gmt_get_vector_shrinking (GMT, &(Ctrl->Q.S.v), data[i].length, scaled_vec_length);	/* Vector attribute shrinking factor or 1 */
+			if (f < 1.0) {	/* Scale arrow attributes down with length */
+				for (k = 2; k <= 4; k++) dim[k] *= f;
+				dim[PSL_VEC_HEAD_PENWIDTH] *= f;
+			}
+			if (Ctrl->Q.S.symbol == GMT_SYMBOL_VECTOR_V4) {	/* Do the deprecated GMT4 vector polygon instead */
+				int v4_outline = Ctrl->W.active;
+				double *this_rgb = NULL;
+				if (Ctrl->G.active || Ctrl->C.active)
+					this_rgb = Ctrl->G.fill.rgb;
 				else
-					PSL_plotsymbol (PSL, plot_x, plot_y, dim, PSL_VECTOR);
+					this_rgb = GMT->session.no_rgb;
+				if (v4_outline) gmt_setpen (GMT, &Ctrl->W.pen);
+				if (Ctrl->Q.S.v.status & PSL_VEC_BEGIN) v4_outline += 8;	/* Double-headed */
+				psl_vector_v4 (PSL, data[i].plot_x, data[i].plot_y, dim, this_rgb, v4_outline);
 			}
+			else
+				PSL_plotsymbol (PSL, data[i].plot_x, data[i].plot_y, dim, PSL_VECTOR);
 		}
 	}
 	PSL_command (GMT->PSL, "U\n");
+	gmt_M_free (GMT, data);
+	gmt_reset_meminc (GMT);
 	PSL->current.linewidth = 0.0;	/* Since we changed things under clip; this will force it to be set next */
 
 	if (!Ctrl->N.active) gmt_map_clip_off (GMT);
@@ -1120,9 +1120,14 @@ EXTERN_MSC int GMT_grdview(void *V_API, int mode, void *args) {
 			/* Old version of loop below could give round-off since we kept subtracting the increments between successive contours.
 			 * The safer way is to always start with original grid and subtract current contour value instead, as in grdcontour.
 			   PW, 11/18/2011 */
-			gmt_M_grd_loop (GMT, Topo, row, col, ij) {
-				if (!gmt_M_is_fnan (Z_orig->data[ij])) Z->data[ij] = Z_orig->data[ij] - (gmt_grdfloat)cval;
-				if (Z->data[ij] == 0.0) Z->data[ij] += (gmt_grdfloat)small;
+#ifdef _OPENMP
+#pragma omp parallel for private(row,col,ij) shared(Topo,Z,Z_orig,cval,small)
+#endif
+			for (row = 0; row < (openmp_int)Topo->header->n_rows; row++) {
+				for (col = 0, ij = gmt_M_ijp (Topo->header, row, 0); col < (openmp_int)Topo->header->n_columns; col++, ij++) {
+					if (!gmt_M_is_fnan (Z_orig->data[ij])) Z->data[ij] = Z_orig->data[ij] - (gmt_grdfloat)cval;
+					if (Z->data[ij] == 0.0) Z->data[ij] += (gmt_grdfloat)small;
+				}
 			}
 
 			begin = true;
@@ -1310,6 +1315,7 @@ EXTERN_MSC int GMT_grdview(void *V_API, int mode, void *args) {
 		int nx_i, ny_i, ip, jp, min_i, max_i, min_j, max_j, dist;
 		int done, layers, last_i, last_j;
 		int *top_jp = NULL, *bottom_jp = NULL, *ix = NULL, *iy = NULL;
+		size_t n_threads = 1;
 		uint64_t d_node, nm_i, node, kk, p;
 		double xp, yp, sum_w, w, sum_i, x_width, y_width, value;
 		double sum_r, sum_g, sum_b, intval = 0.0, *y_drape = NULL, *x_drape = NULL;
@@ -1339,24 +1345,30 @@ EXTERN_MSC int GMT_grdview(void *V_API, int mode, void *args) {
 			x_drape = Z->x;
 			y_drape = Z->y;
 			if (use_intensity_grid) int_drape = gmt_M_memory (GMT, NULL, Z->header->mx*Z->header->my, gmt_grdfloat);
-			bin = 0;	/* bin cycles over a grid with no padding, hence bin++ is good enough */
-			gmt_M_grd_loop (GMT, Z, row, col, ij) {	/* Get projected coordinates converted to pixel locations */
-				value = gmt_bcr_get_z (GMT, Topo, x_drape[col], y_drape[row]);	/* Relief value at drape coordinate */
-				if (gmt_M_is_dnan (value))	/* Outside -R or NaNs not used */
-					ix[bin] = iy[bin] = -1;
-				else {	/* Valid relief, compute projected point on 3-D surface */
-					gmt_geoz_to_xy (GMT, x_drape[col], y_drape[row], value, &xp, &yp);
-					/* Make sure ix,iy pixel values fall in the range (0,nx_i-1), (0,ny_i-1) */
-					ix[bin] = MAX(0, MIN(irint (floor((xp - GMT->current.proj.z_project.xmin) * Ctrl->Q.dpi)), last_i));
-					iy[bin] = MAX(0, MIN(irint (floor((yp - GMT->current.proj.z_project.ymin) * Ctrl->Q.dpi)), last_j));
+			/* Each node projects independently so rows can be done in parallel; bin cycles over a grid with no padding */
+#ifdef _OPENMP
+#pragma omp parallel for private(row,col,ij,bin,value,xp,yp) shared(GMT,Ctrl,Z,Topo,Intens,x_drape,y_drape,int_drape,ix,iy,last_i,last_j,use_intensity_grid) reduction(min:min_i,min_j) reduction(max:max_i,max_j)
+#endif
+			for (row = 0; row < (openmp_int)Z->header->n_rows; row++) {	/* Get projected coordinates converted to pixel locations */
+				ij = gmt_M_ijp (Z->header, row, 0);
+				bin = (uint64_t)row * Z->header->n_columns;
+				for (col = 0; col < (openmp_int)Z->header->n_columns; col++, ij++, bin++) {
+					value = gmt_bcr_get_z (GMT, Topo, x_drape[col], y_drape[row]);	/* Relief value at drape coordinate */
+					if (gmt_M_is_dnan (value))	/* Outside -R or NaNs not used */
+						ix[bin] = iy[bin] = -1;
+					else {	/* Valid relief, compute projected point on 3-D surface */
+						gmt_geoz_to_xy (GMT, x_drape[col], y_drape[row], value, &xp, &yp);
+						/* Make sure ix,iy pixel values fall in the range (0,nx_i-1), (0,ny_i-1) */
+						ix[bin] = MAX(0, MIN(irint (floor((xp - GMT->current.proj.z_project.xmin) * Ctrl->Q.dpi)), last_i));
+						iy[bin] = MAX(0, MIN(irint (floor((yp - GMT->current.proj.z_project.ymin) * Ctrl->Q.dpi)), last_j));
+					}
+					if (use_intensity_grid)	/* Get intensity value at drape coordinate */
+						int_drape[ij] = (gmt_grdfloat)gmt_bcr_get_z (GMT, Intens, x_drape[col], y_drape[row]);
+					if (ix[bin] < min_i) min_i = ix[bin];
+					if (ix[bin] > max_i) max_i = ix[bin];
+					if (iy[bin] < min_j) min_j = iy[bin];
+					if (iy[bin] > max_j) max_j = iy[bin];
 				}
-				if (use_intensity_grid)	/* Get intensity value at drape coordinate */
-					int_drape[ij] = (gmt_grdfloat)gmt_bcr_get_z (GMT, Intens, x_drape[col], y_drape[row]);
-				if (ix[bin] < min_i) min_i = ix[bin];
-				if (ix[bin] > max_i) max_i = ix[bin];
-				if (iy[bin] < min_j) min_j = iy[bin];
-				if (iy[bin] > max_j) max_j = iy[bin];
-				bin++;
 			}
 			if (use_intensity_grid) {	/* Reset intensity grid so that we have no boundary row/cols */
 				saved_data_pointer = Intens->data;
@@ -1366,21 +1378,26 @@ EXTERN_MSC int GMT_grdview(void *V_API, int mode, void *args) {
 		else {	/* Drape and relief grid [and optional intensity grid] all of same dimensions */
 			ix = gmt_M_memory (GMT, NULL, Topo->header->nm, int);
 			iy = gmt_M_memory (GMT, NULL, Topo->header->nm, int);
-			bin = 0;
-			gmt_M_grd_loop (GMT, Z, row, col, ij) {	/* Get projected relief coordinates converted to pixel locations */
-				if (gmt_M_is_fnan (Topo->data[ij]))	/* Outside -R or NaNs not used */
-					ix[bin] = iy[bin] = -1;
-				else {
-					gmt_geoz_to_xy (GMT, xval[col], yval[row], (double)Topo->data[ij], &xp, &yp);
-					/* Make sure ix,iy fall in the range (0,nx_i-1), (0,ny_i-1) */
-					ix[bin] = MAX(0, MIN(irint (floor((xp - GMT->current.proj.z_project.xmin) * Ctrl->Q.dpi)), last_i));
-					iy[bin] = MAX(0, MIN(irint (floor((yp - GMT->current.proj.z_project.ymin) * Ctrl->Q.dpi)), last_j));
-					if (ix[bin] < min_i) min_i = ix[bin];
-					if (ix[bin] > max_i) max_i = ix[bin];
-					if (iy[bin] < min_j) min_j = iy[bin];
-					if (iy[bin] > max_j) max_j = iy[bin];
+#ifdef _OPENMP
+#pragma omp parallel for private(row,col,ij,bin,xp,yp) shared(GMT,Ctrl,Z,Topo,xval,yval,ix,iy,last_i,last_j) reduction(min:min_i,min_j) reduction(max:max_i,max_j)
+#endif
+			for (row = 0; row < (openmp_int)Z->header->n_rows; row++) {	/* Get projected relief coordinates converted to pixel locations */
+				ij = gmt_M_ijp (Z->header, row, 0);
+				bin = (uint64_t)row * Z->header->n_columns;
+				for (col = 0; col < (openmp_int)Z->header->n_columns; col++, ij++, bin++) {
+					if (gmt_M_is_fnan (Topo->data[ij]))	/* Outside -R or NaNs not used */
+						ix[bin] = iy[bin] = -1;
+					else {
+						gmt_geoz_to_xy (GMT, xval[col], yval[row], (double)Topo->data[ij], &xp, &yp);
+						/* Make sure ix,iy fall in the range (0,nx_i-1), (0,ny_i-1) */
+						ix[bin] = MAX(0, MIN(irint (floor((xp - GMT->current.proj.z_project.xmin) * Ctrl->Q.dpi)), last_i));
+						iy[bin] = MAX(0, MIN(irint (floor((yp - GMT->current.proj.z_project.ymin) * Ctrl->Q.dpi)), last_j));
+						if (ix[bin] < min_i) min_i = ix[bin];
+						if (ix[bin] > max_i) max_i = ix[bin];
+						if (iy[bin] < min_j) min_j = iy[bin];
+						if (iy[bin] > max_j) max_j = iy[bin];
+					}
 				}
-				bin++;
 			}
 		}
 
@@ -1423,17 +1440,36 @@ EXTERN_MSC int GMT_grdview(void *V_API, int mode, void *args) {
 			}
 		}
 
-		if (!Ctrl->Q.mask) {	/* Set up arrays for staircase clippath and initialize them */
-			top_jp = gmt_M_memory (GMT, NULL, nx_i, int);
-			bottom_jp = gmt_M_memory (GMT, NULL, nx_i, int);
-			for (ip = 0; ip < nx_i; ip++) bottom_jp[ip] = ny_i;
+#ifdef _OPENMP
+		n_threads = (size_t)omp_get_max_threads ();
+#endif
+		if (!Ctrl->Q.mask) {	/* Set up arrays for staircase clippath and initialize them; one set per thread */
+			top_jp = gmt_M_memory (GMT, NULL, n_threads * (size_t)nx_i, int);
+			bottom_jp = gmt_M_memory (GMT, NULL, n_threads * (size_t)nx_i, int);
+			for (kk = 0; kk < n_threads * (size_t)nx_i; kk++) bottom_jp[kk] = ny_i;
 		}
 
-		/* Plot from back to front */
+		/* Plot from back to front.  With OpenMP each thread owns a horizontal band of pixel rows and scans
+		 * all tiles in the same back-to-front order, but only writes the pixels that fall inside its own band.
+		 * The bands are disjoint so there are no write conflicts, and within a band the painter order is unchanged. */
 
-		gmt_M_memset(rgb, 4, double);
 		GMT_Report(API, GMT_MSG_INFORMATION, "Start rasterization\n");
 		GMT_Report(API, GMT_MSG_DEBUG, "Scan line conversion at j-line %.6ld\n", start[0]);
+#ifdef _OPENMP
+#pragma omp parallel private(j,i,k,kk,p,bin,ij,node,d_node,bad,done,good,dist,w,sum_r,sum_g,sum_b,sum_w,sum_i,intval,min_i,max_i,min_j,max_j,ip,jp,rgb) shared(GMT,Ctrl,P,Z,Intens,Drape,ix,iy,bin_inc,ij_inc,start,stop,inc,id,nx_i,ny_i,layers,PS_colormask_off,bitimage_8,bitimage_24,use_intensity_grid,top_jp,bottom_jp)
+#endif
+		{
+		int jp_first = 0, jp_stop = ny_i, *top_t = top_jp, *bottom_t = bottom_jp;
+#ifdef _OPENMP
+		int tid = omp_get_thread_num (), nth = omp_get_num_threads ();
+		jp_first = (int)(((int64_t)tid * ny_i) / nth);	/* This thread only writes pixel rows jp_first <= jp < jp_stop */
+		jp_stop  = (int)(((int64_t)(tid + 1) * ny_i) / nth);
+		if (!Ctrl->Q.mask) {	/* Point to this thread's clip path arrays */
+			top_t = &top_jp[tid*nx_i];
+			bottom_t = &bottom_jp[tid*nx_i];
+		}
+#endif
+		gmt_M_memset(rgb, 4, double);
 		for (j = start[0]; j != stop[0]; j += inc[0]) {
 			for (i = start[1]; i != stop[1]; i += inc[1]) {
 				if (id[0] == GMT_Y) {
@@ -1456,14 +1492,14 @@ EXTERN_MSC int GMT_grdview(void *V_API, int mode, void *args) {
 					if (iy[p] > max_j) max_j = iy[p];
 				}
 				for (jp = min_j; jp <= max_j; jp++) {	/* Loop over all the pixels (rectangular domain) that may make up this tile */
-					if (jp < 0 || jp >= ny_i) continue;
+					if (jp < jp_first || jp >= jp_stop) continue;	/* Pixel row outside image or owned by another thread */
 					for (ip = min_i; ip <= max_i; ip++) {
 						if (ip < 0 || ip >= nx_i) continue;
 						if (!grdview_pixel_inside (GMT, ip, jp, ix, iy, bin, bin_inc)) continue;	/* Checks if actually inside the projected tile polygon */
 						/* These pixels are part of the current tile */
 						if (!Ctrl->Q.mask) {	/* Update clip mask */
-							if (jp > top_jp[ip]) top_jp[ip] = jp;
-							if (jp < bottom_jp[ip]) bottom_jp[ip] = jp;
+							if (jp > top_t[ip]) top_t[ip] = jp;
+							if (jp < bottom_t[ip]) bottom_t[ip] = jp;
 						}
 
 						sum_r = sum_g = sum_b = sum_w = sum_i = 0.0;
@@ -1519,7 +1555,18 @@ EXTERN_MSC int GMT_grdview(void *V_API, int mode, void *args) {
 				}
 			}
 		}
-		GMT_Report(API, GMT_MSG_DEBUG, "Scan line conversion at j-line %.6ld\n", j-1);
+		}	/* End of parallel section */
+#ifdef _OPENMP
+		if (!Ctrl->Q.mask) {	/* Merge the per-thread clip path extremes into the first set */
+			for (kk = 1; kk < n_threads; kk++) {
+				for (ip = 0; ip < nx_i; ip++) {
+					if (top_jp[kk*nx_i+ip] > top_jp[ip]) top_jp[ip] = top_jp[kk*nx_i+ip];
+					if (bottom_jp[kk*nx_i+ip] < bottom_jp[ip]) bottom_jp[ip] = bottom_jp[kk*nx_i+ip];
+				}
+			}
+		}
+#endif
+		GMT_Report(API, GMT_MSG_DEBUG, "Scan line conversion at j-line %.6ld\n", stop[0]-inc[0]);
 
 		if (!Ctrl->Q.mask) {	/* Must implement the clip path for the perspective image */
 			/* We now have the top and bottom j-pixel per i-pixel and will build a closed clip path.
@@ -241,6 +241,37 @@ GMT_LOCAL void grdvolume_EW_trapezoid (struct GMT_GRID *G, uint64_t ij, bool top
 	}
 }
 
+struct GRDVOLUME_BIN {	/* Level-independent information for one 4-node bin, harvested in a single grid traversal */
+	uint64_t ij;		/* Lower-left node of the bin */
+	double zmin, zmax;	/* Lowest and highest of the 4 corner values [zmin = DBL_MAX flags a bin with NaN corners] */
+	double dv;		/* Volume of the full prism (before the level is taken out), including the row area factor */
+	double fact;		/* Row area factor; also the area contribution of the full prism */
+};
+
+GMT_LOCAL int grdvolume_compare_bins (const void *p_1, const void *p_2) {
+	/* Sort the bins on their lowest corner value */
+	const struct GRDVOLUME_BIN *a = p_1, *b = p_2;
+	if (a->zmin < b->zmin) return (-1);
+	if (a->zmin > b->zmin) return (+1);
+	return (0);
+}
+
+GMT_LOCAL bool grdvolume_crossing_range (double zmin, double zmax, double t0, double inc, unsigned int n_contours, int64_t *c0, int64_t *c1) {
+	/* Determine the range of level indices c for which the threshold T(c) = t0 + c * inc satisfies
+	 * zmin <= T(c) < zmax, i.e., the levels whose contour actually crosses this bin.  The initial
+	 * guesses from the divisions are nudged so the exact floating-point comparisons used in the
+	 * per-level classification hold at both end points.  Returns true if no level crosses the bin. */
+	*c0 = (int64_t)ceil ((zmin - t0) / inc);
+	while (*c0 > 0 && t0 + (*c0 - 1) * inc >= zmin) (*c0)--;
+	while (t0 + *c0 * inc < zmin) (*c0)++;
+	if (*c0 < 0) *c0 = 0;
+	*c1 = (int64_t)floor ((zmax - t0) / inc);
+	while (*c1 >= 0 && t0 + *c1 * inc >= zmax) (*c1)--;
+	while ((*c1 + 1) < (int64_t)n_contours && t0 + (*c1 + 1) * inc < zmax) (*c1)++;
+	if (*c1 > (int64_t)n_contours - 1) *c1 = (int64_t)n_contours - 1;
+	return (*c0 > *c1);
+}
+
 GMT_LOCAL double grdvolume_median3 (double x[]) {
 	/* Returns the median of the three points in x */
 	if (x[0] < x[1]) {
@@ -459,11 +490,11 @@ static int parse (struct GMT_CTRL *GMT, struct GRDVOLUME_CTRL *Ctrl, struct GMT_
 EXTERN_MSC int GMT_grdvolume (void *V_API, int mode, void *args) {
 	bool bad, shrink, cut[4];
 	int error = 0, ij_inc[5];
-	unsigned int row, col, c, k, pos, neg, nc, n_contours;
+	unsigned int row, col, c, k, nc, n_contours;
 
 	uint64_t ij;
 
-	double take_out, dv, da, cval = 0.0, cellsize, fact, dist_pr_deg, sum, z_range, out[4];
+	double dv, da, cellsize, fact, dist_pr_deg, z_range, out[4];
 	double *area = NULL, *vol = NULL, *height = NULL, this_base, small, wesn[4];
 
 	struct GRDVOLUME_CTRL *Ctrl = NULL;
@@ -570,93 +601,151 @@ EXTERN_MSC int GMT_grdvolume (void *V_API, int mode, void *args) {
 	else
 		small = MIN (fabs (Ctrl->C.inc), z_range) * 1.0e-6;	/* Our gmt_grdfloat noise threshold */
 	GMT_Report (API, GMT_MSG_DEBUG, "Small noise value = %g\n", small);
-	for (c = 0; Ctrl->C.active && c < n_contours; c++) {	/* Trace contour, only count volumes inside contours */
-
-		cval = Ctrl->C.low + c * Ctrl->C.inc;
-		take_out = (c == 0) ? cval + small : Ctrl->C.inc;	/* Take out start contour the first time and just the increment subsequent times */
-
-		GMT_Report (API, GMT_MSG_INFORMATION, "Compute volume, area, and average height for contour = %g\n", cval);
-
-		for (ij = 0; ij < Work->header->size; ij++) {
-			Work->data[ij] -= (gmt_grdfloat)take_out;		/* Take out the zero value */
-			if (Work->data[ij] == 0.0) Work->data[ij] = (gmt_grdfloat)small;	/* But we don't want exactly zero, just + or - */
+	if (Ctrl->C.active) {	/* Sweep over the contour levels, only count volumes inside contours */
+		/* Rather than re-walking the full grid once per level we harvest each bin's corner extremes and
+		 * full-prism contribution in a single traversal.  Sorted on the lowest corner, the bins lying
+		 * entirely above a level are then summed via precomputed suffix sums (their contribution is linear
+		 * in the level), and only the bins the level actually crosses get the exact partial-prism geometry,
+		 * via per-level crossing lists.  The whole sweep is thus proportional to the total contour length
+		 * instead of levels times grid size. */
+		static int zb_inc[5] = {0, 1, -1, -2, 0};	/* The ij_inc equivalent for the 2 x 2 staging grid below */
+		uint64_t m, nb = 0, nc1 = Work->header->n_columns - 1, *first = NULL, *next = NULL, *xing = NULL;
+		int64_t mb, cc, c0, c1, nbins = (int64_t)(Work->header->n_rows - 1) * nc1;
+		double z, zsum, t0, *sum_dv = NULL, *sum_fact = NULL;
+		struct GRDVOLUME_BIN *bin = NULL;
+
+		bin = gmt_M_memory (GMT, NULL, MAX (nbins, 1), struct GRDVOLUME_BIN);
+#ifdef _OPENMP
+#pragma omp parallel for private(mb,row,col,ij,k,bad,fact,z,zsum) shared(GMT,Work,bin,nbins,nc1,cellsize,shrink,ij_inc)
+#endif
+		for (mb = 0; mb < nbins; mb++) {	/* One parallel traversal over all 4-node bins */
+			row = 1 + (unsigned int)(mb / nc1);	col = (unsigned int)(mb % nc1);
+			ij = gmt_M_ijp (Work->header, row, col);
+			bin[mb].zmin = DBL_MAX;	bin[mb].zmax = -DBL_MAX;
+			for (k = 0, bad = false, zsum = 0.0; !bad && k < 4; k++) {
+				z = Work->data[ij+ij_inc[k]];
+				if (gmt_M_is_dnan (z)) bad = true;
+				zsum += z;
+				if (z < bin[mb].zmin) bin[mb].zmin = z;
+				if (z > bin[mb].zmax) bin[mb].zmax = z;
+			}
+			if (bad) {	/* Bins with NaN corners are skipped at every level */
+				bin[mb].zmin = DBL_MAX;
+				continue;
+			}
+			fact = cellsize;
+			/* Allow for shrinking of longitudes with latitude */
+			if (shrink) fact *= cosd (Work->header->wesn[YHI] - (row+0.5) * Work->header->inc[GMT_Y]);
+			bin[mb].ij = ij;
+			bin[mb].dv = 0.25 * zsum * fact;
+			bin[mb].fact = fact;
 		}
-		if (Ctrl->L.active) this_base -= take_out;
-
-		if (Ctrl->L.active && this_base >= 0.0) {
-			GMT_Report (API, GMT_MSG_ERROR, "Base exceeds the current contour value - contour is ignored.\n");
-			continue;
+		for (mb = 0; mb < nbins; mb++)	/* Compact away the NaN bins */
+			if (bin[mb].zmin < DBL_MAX) bin[nb++] = bin[mb];
+		if (nb) {
+			if ((int64_t)nb < nbins) bin = gmt_M_memory (GMT, bin, nb, struct GRDVOLUME_BIN);
+			qsort (bin, nb, sizeof (struct GRDVOLUME_BIN), grdvolume_compare_bins);
 		}
-
-		for (row = 1; row < Work->header->n_rows; row++) {
-
-			dv = da = 0.0;	/* Reset these for each row */
-
-			for (col = 0, ij = gmt_M_ijp (Work->header, row, 0); col < (Work->header->n_columns-1); col++, ij++) {
-
-				/* Find if a contour goes through this bin */
-
-				for (k = neg = pos = 0, bad = false; !bad && k < 4; k++) {
-					(Work->data[ij+ij_inc[k]] <= (gmt_grdfloat)small) ? neg++ : pos++;
-					if (gmt_M_is_fnan (Work->data[ij+ij_inc[k]])) bad = true;
+		/* Suffix sums so the bins with zmin > T(c) (they occupy the tail of the sorted array) sum in O(1) */
+		sum_dv   = gmt_M_memory (GMT, NULL, nb + 1, double);
+		sum_fact = gmt_M_memory (GMT, NULL, nb + 1, double);
+		for (m = nb; m > 0; m--) {
+			sum_dv[m-1]   = sum_dv[m]   + bin[m-1].dv;
+			sum_fact[m-1] = sum_fact[m] + bin[m-1].fact;
+		}
+		/* Build the per-level lists of crossed bins.  T(c) = t0 + c * inc is the level threshold including
+		 * the noise guard: a corner z <= T counts as negative, matching the z - shift <= small test. */
+		t0 = Ctrl->C.low + 2.0 * small;
+		first = gmt_M_memory (GMT, NULL, n_contours + 1, uint64_t);
+		next  = gmt_M_memory (GMT, NULL, n_contours, uint64_t);
+		for (m = 0; m < nb; m++) {	/* Count the crossing levels per bin */
+			if (grdvolume_crossing_range (bin[m].zmin, bin[m].zmax, t0, Ctrl->C.inc, n_contours, &c0, &c1)) continue;
+			for (cc = c0; cc <= c1; cc++) first[cc+1]++;
+		}
+		for (c = 0; c < n_contours; c++) first[c+1] += first[c], next[c] = first[c];
+		xing = gmt_M_memory (GMT, NULL, MAX (first[n_contours], 1), uint64_t);
+		for (m = 0; m < nb; m++) {	/* Then place each bin in the list of every level crossing it */
+			if (grdvolume_crossing_range (bin[m].zmin, bin[m].zmax, t0, Ctrl->C.inc, n_contours, &c0, &c1)) continue;
+			for (cc = c0; cc <= c1; cc++) xing[next[cc]++] = m;
+		}
+		GMT_Report (API, GMT_MSG_INFORMATION, "Compute volume, area, and average height for %u contour levels [%" PRIu64 " bin crossings]\n", n_contours, first[n_contours]);
+
+#ifdef _OPENMP
+#pragma omp parallel for private(cc,m,k,nc,cut) shared(GMT,API,Ctrl,Work,bin,vol,area,sum_dv,sum_fact,first,xing,nb,n_contours,t0,small,this_base,ij_inc,zb_inc)
+#endif
+		for (cc = 0; cc < (int64_t)n_contours; cc++) {
+			uint64_t lo = 0, hi = nb, mid, q;
+			double T = t0 + cc * Ctrl->C.inc, shift = T - small;	/* shift is the cumulated take_out for this level */
+			gmt_grdfloat zb[4];
+			struct GMT_GRID_HEADER Bin_h;
+			struct GMT_GRID Bin;
+
+			if (Ctrl->L.active && (this_base - shift) >= 0.0) {
+				GMT_Report (API, GMT_MSG_ERROR, "Base exceeds the current contour value - contour is ignored.\n");
+				continue;
+			}
+			while (lo < hi) {	/* Find the first bin with zmin > T; all bins beyond it need their entire prism */
+				mid = (lo + hi) / 2;
+				if (bin[mid].zmin > T) hi = mid; else lo = mid + 1;
+			}
+			vol[cc]  = sum_dv[lo] - shift * sum_fact[lo];
+			area[cc] = sum_fact[lo];
+
+			/* Stage each crossed bin in a private 2 x 2 grid so the partial prism helpers can be used as is */
+			gmt_M_memset (&Bin_h, 1, struct GMT_GRID_HEADER);
+			Bin_h.mx = 2;	Bin.header = &Bin_h;	Bin.data = zb;
+			for (q = first[cc]; q < first[cc+1]; q++) {
+				double dv_bin = 0.0, da_bin = 0.0;
+				m = xing[q];
+				for (k = 0; k < 4; k++) {
+					zb[2+zb_inc[k]] = (gmt_grdfloat)(Work->data[bin[m].ij+ij_inc[k]] - shift);	/* Take out the zero value */
+					if (zb[2+zb_inc[k]] == 0.0) zb[2+zb_inc[k]] = (gmt_grdfloat)small;	/* But we don't want exactly zero, just + or - */
 				}
 
-				if (bad || neg == 4) continue;	/* Contour not crossing, go to next bin */
-
-				if (pos == 4) {	/* Need entire prism */
-					for (k = 0, sum = 0.0; k < 4; k++) sum += Work->data[ij+ij_inc[k]];
-					dv += 0.25 * sum;
-					da += 1.0;
+				for (k = nc = 0; k < 4; k++) {	/* Check the 4 sides for crossings */
+					cut[k] = false;
+					if ((zb[2+zb_inc[k]] * zb[2+zb_inc[k+1]]) < 0.0) nc++, cut[k] = true;	/* Crossing this border */
 				}
-				else {	/* Need partial prisms */
+				if (nc < 2) continue;	/* Can happen if some nodes were 0 and then reset to small, thus passing the test */
 
-					for (k = nc = 0; k < 4; k++) {	/* Check the 4 sides for crossings */
-						cut[k] = false;
-						if ((Work->data[ij+ij_inc[k]] * Work->data[ij+ij_inc[k+1]]) < 0.0) nc++, cut[k] = true;	/* Crossing this border */
-					}
-					if (nc < 2) continue;	/* Can happen if some nodes were 0 and then reset to small, thus passing the test */
-
-					if (nc == 4) {	/* Saddle scenario */
-						if (Work->data[ij] > 0.0) {	/* Need both SW and NE triangles */
-							grdvolume_SW_triangle (Work, ij, true, &dv, &da);
-							grdvolume_NE_triangle (Work, ij, true, &dv, &da);
-						}
-						else {			/* Need both SE and NW corners */
-							grdvolume_SE_triangle (Work, ij, true, &dv, &da);
-							grdvolume_NW_triangle (Work, ij, true, &dv, &da);
-						}
-
-					}
-					else if (cut[0]) {	/* Contour enters at S border ... */
-						if (cut[1])	/* and exits at E border */
-							grdvolume_SE_triangle (Work, ij, (Work->data[ij+ij_inc[1]] > 0.0), &dv, &da);
-						else if (cut[2])	/* or exits at N border */
-							grdvolume_NS_trapezoid (Work, ij, Work->data[ij] < 0.0, &dv, &da);
-						else			/* or exits at W border */
-							grdvolume_SW_triangle (Work, ij, (Work->data[ij] > 0.0), &dv, &da);
+				if (nc == 4) {	/* Saddle scenario */
+					if (zb[2] > 0.0) {	/* Need both SW and NE triangles */
+						grdvolume_SW_triangle (&Bin, 2, true, &dv_bin, &da_bin);
+						grdvolume_NE_triangle (&Bin, 2, true, &dv_bin, &da_bin);
 					}
-					else if (cut[1]) {	/* Contour enters at E border */
-						if (cut[2])	/* exits at N border */
-							grdvolume_NE_triangle (Work, ij, (Work->data[ij+ij_inc[2]] > 0.0), &dv, &da);
-						else			/* or exits at W border */
-							grdvolume_EW_trapezoid (Work, ij, Work->data[ij] < 0.0, &dv, &da);
+					else {			/* Need both SE and NW corners */
+						grdvolume_SE_triangle (&Bin, 2, true, &dv_bin, &da_bin);
+						grdvolume_NW_triangle (&Bin, 2, true, &dv_bin, &da_bin);
 					}
-					else			/* Contours enters at N border and exits at W */
-						grdvolume_NW_triangle (Work, ij, (Work->data[ij+ij_inc[3]] > 0.0), &dv, &da);
+
 				}
-			}
-			ij++;
+				else if (cut[0]) {	/* Contour enters at S border ... */
+					if (cut[1])	/* and exits at E border */
+						grdvolume_SE_triangle (&Bin, 2, (zb[2+zb_inc[1]] > 0.0), &dv_bin, &da_bin);
+					else if (cut[2])	/* or exits at N border */
+						grdvolume_NS_trapezoid (&Bin, 2, zb[2] < 0.0, &dv_bin, &da_bin);
+					else			/* or exits at W border */
+						grdvolume_SW_triangle (&Bin, 2, (zb[2] > 0.0), &dv_bin, &da_bin);
+				}
+				else if (cut[1]) {	/* Contour enters at E border */
+					if (cut[2])	/* exits at N border */
+						grdvolume_NE_triangle (&Bin, 2, (zb[2+zb_inc[2]] > 0.0), &dv_bin, &da_bin);
+					else			/* or exits at W border */
+						grdvolume_EW_trapezoid (&Bin, 2, zb[2] < 0.0, &dv_bin, &da_bin);
+				}
+				else			/* Contours enters at N border and exits at W */
+					grdvolume_NW_triangle (&Bin, 2, (zb[2+zb_inc[3]] > 0.0), &dv_bin, &da_bin);
 
-			fact = cellsize;
-			/* Allow for shrinking of longitudes with latitude */
-			if (shrink) fact *= cosd (Work->header->wesn[YHI] - (row+0.5) * Work->header->inc[GMT_Y]);
+				vol[cc]  += dv_bin * bin[m].fact;
+				area[cc] += da_bin * bin[m].fact;
+			}
 
-			vol[c]  += dv * fact;
-			area[c] += da * fact;
+			/* Adjust for lower starting base */
+			if (Ctrl->L.active) vol[cc] -= area[cc] * (this_base - shift);
 		}
-
-		/* Adjust for lower starting base */
-		if (Ctrl->L.active) vol[c] -= area[c] * this_base;
+		gmt_M_free (GMT, bin);
+		gmt_M_free (GMT, sum_dv);	gmt_M_free (GMT, sum_fact);
+		gmt_M_free (GMT, first);	gmt_M_free (GMT, next);	gmt_M_free (GMT, xing);
 	}
 	if (!Ctrl->C.active) {	/* Since no contours we can use columns with bilinear tops to get the volume */
 		for (row = 0; row < Work->header->n_rows; row++) {
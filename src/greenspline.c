@@ -70,9 +70,10 @@ struct GREENSPLINE_CTRL {
 		unsigned int mode;	/* 0 = azimuths, 1 = directions, 2 = dx,dy components, 3 = dx, dy, dz components */
 		char *file;
 	} A	;
-	struct GREENSPLINE_C {	/* -C[[n|r|v]<cutoff>[%]][+c][+f<file>][+i][+n] */
+	struct GREENSPLINE_C {	/* -C[[i|n|r|v]<cutoff>[%]][+c][+f<file>][+i][+n] */
 		bool active;
 		bool dryrun;	/* Only report eigenvalues */
+		bool iterative;	/* Solve by conjugate gradients instead of a full factorization */
 		unsigned int history;
 		unsigned int mode;
 		double value;
@@ -236,7 +237,7 @@ static void Free_Ctrl (struct GMT_CTRL *GMT, struct GREENSPLINE_CTRL *C) {	/* De
 static int usage (struct GMTAPI_CTRL *API, int level) {
 	const char *name = gmt_show_name_and_purpose (API, THIS_MODULE_LIB, THIS_MODULE_CLASSIC_NAME, THIS_MODULE_PURPOSE);
 	if (level == GMT_MODULE_PURPOSE) return (GMT_NOERROR);
-	GMT_Usage (API, 0, "usage: %s [<table>] -G<outfile> [-A<gradientfile>+f<format>] [-C[[n|r|v]<val>[%%]][+c][+f<file>][+i][+n]] "
+	GMT_Usage (API, 0, "usage: %s [<table>] -G<outfile> [-A<gradientfile>+f<format>] [-C[[i|n|r|v]<val>[%%]][+c][+f<file>][+i][+n]] "
 		"[-D<information>] [-E[<misfitfile>][+r<reportfile>]] [-I<dx>[/<dy>[/<dz>]]] [-L[t][r]] [-N<nodefile>] [-Q[<az>|<x/y/z>]] "
 		"[-R<xmin>/<xmax>[/<ymin>/<ymax>[/<zmin>/<zmax>]]] [-Sc|l|p|q|r|t][<tension>[/<scale>]][+e<limit>][+n<odd>]] [-T<maskgrid>] "
 		"[%s] [-W[w]] [-Z<mode>] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s]%s[%s] [%s]\n",
@@ -266,8 +267,10 @@ static int usage (struct GMTAPI_CTRL *API, int level) {
 	GMT_Usage (API, 3, "4: X, Vcomponents.");
 	GMT_Usage (API, 3, "5: X, Vunit-vector, Vmagnitude.");
 	GMT_Usage (API, -2, "Here, X = (x, y[, z]) is the position vector, V = (Vx, Vy[, Vz]) is the gradient vector.");
-	GMT_Usage (API, 1, "\n-C[[n|r|v]<val>[%%]][+c][+f<file>][+i][+n]");
+	GMT_Usage (API, 1, "\n-C[[i|n|r|v]<val>[%%]][+c][+f<file>][+i][+n]");
 	GMT_Usage (API, -2, "Solve by SVD and control how many eigenvalues to use. Optionally append a directive and value:");
+	GMT_Usage (API, 3, "i: Solve iteratively by conjugate gradients to relative tolerance <val> [1e-8]; "
+		"no eigenvalue control is possible but very large systems solve much faster.");
 	GMT_Usage (API, 3, "n: Only use the largest <val> eigenvalues [all].");
 	GMT_Usage (API, 3, "r: Eliminate eigenvalues whose ratio to largest eigenvalue is less than <val> [0].");
 	GMT_Usage (API, 3, "v: Include eigenvalues needed to reach a variance explained fraction of <val> [1].");
@@ -347,6 +350,72 @@ static int usage (struct GMTAPI_CTRL *API, int level) {
 	return (GMT_MODULE_USAGE);
 }
 
+#define GREENSPLINE_CG_RTOL 1.0e-8	/* Default relative residual tolerance for the -Ci conjugate gradient solver */
+
+GMT_LOCAL int greenspline_cgsolve (struct GMT_CTRL *GMT, double *A, uint64_t n, double *b, double rtol) {
+	/* Solve the symmetric n x n system A*x = b by the method of conjugate gradients,
+	 * overwriting b with the solution on return (mirroring what gmt_gaussjordan does).
+	 * Each iteration costs one matrix-vector product, so for the large systems where
+	 * the O(n^3) factorizations become prohibitive this converges in far less work,
+	 * and the product parallelizes trivially across threads.  This is also the hook
+	 * where a hierarchical (low-rank) operator could later replace the dense product. */
+	uint64_t k, iteration = 0, itmax = 10 * n;
+	int64_t row;	/* Signed for OpenMP */
+	double *x = NULL, *r = NULL, *p = NULL, *q = NULL;
+	double rr, rr_new, pq, alpha, beta, b_norm = 0.0, rel = DBL_MAX;
+
+	x = gmt_M_memory (GMT, NULL, 4 * n, double);	/* One block for the four work vectors */
+	if (x == NULL) return (GMT_MEMORY_ERROR);
+	r = &x[n];	p = &x[2*n];	q = &x[3*n];
+
+	for (k = 0; k < n; k++) {	/* x = 0 so r = p = b */
+		r[k] = p[k] = b[k];
+		b_norm += b[k] * b[k];
+	}
+	if (b_norm == 0.0) {	/* Trivial solution */
+		gmt_M_memcpy (b, x, n, double);
+		gmt_M_free (GMT, x);
+		return (GMT_NOERROR);
+	}
+	rr = b_norm;
+
+	while (iteration < itmax && (rel = sqrt (rr / b_norm)) > rtol) {
+#ifdef _OPENMP
+#pragma omp parallel for private(row,k) shared(A,p,q,n)
+#endif
+		for (row = 0; row < (int64_t)n; row++) {	/* q = A * p */
+			double sum = 0.0;
+			const double *Arow = &A[(uint64_t)row * n];
+			for (k = 0; k < n; k++) sum += Arow[k] * p[k];
+			q[row] = sum;
+		}
+		for (k = 0, pq = 0.0; k < n; k++) pq += p[k] * q[k];
+		if (pq == 0.0) break;	/* Stagnated; return best estimate so far */
+		alpha = rr / pq;
+		for (k = 0, rr_new = 0.0; k < n; k++) {
+			x[k] += alpha * p[k];
+			r[k] -= alpha * q[k];
+			rr_new += r[k] * r[k];
+		}
+		beta = rr_new / rr;
+		for (k = 0; k < n; k++) p[k] = r[k] + beta * p[k];
+		rr = rr_new;
+		iteration++;
+		/* Externalize convergence telemetry: log10(rel)/log10(rtol) goes 0 -> 1 as we converge */
+		if (rel < 1.0 && rtol > 0.0 && rtol < 1.0) GMT->parent->progress = log (rel) / log (rtol);
+		if (GMT->parent->cancel) {	/* Cancellation requested via GMT_Cancel_Module; return best estimate so far */
+			GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "CG solver stopped by cancellation after %" PRIu64 " iterations\n", iteration);
+			break;
+		}
+	}
+	GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "CG solver finished after %" PRIu64 " iterations with relative residual %g\n", iteration, rel);
+	if (rel > rtol)
+		GMT_Report (GMT->parent, GMT_MSG_WARNING, "CG solver did not reach rtol = %g; solution may be inaccurate (try -C for SVD)\n", rtol);
+	gmt_M_memcpy (b, x, n, double);	/* Return solution via b, like gmt_gaussjordan */
+	gmt_M_free (GMT, x);
+	return (GMT_NOERROR);
+}
+
 GMT_LOCAL unsigned int greenspline_pre_parser (struct GMT_CTRL *GMT, struct GMT_OPTION *options) {
 	/* Help GMT_Parse know if -R is geographic based on -Z mode and return dimension */
 	unsigned int dim = 0;
@@ -524,6 +593,7 @@ static int parse (struct GMT_CTRL *GMT, struct GREENSPLINE_CTRL *Ctrl, struct GM
 					break;	/* No modifiers for the deprecated syntax */
 				}
 				switch (opt->arg[0]) {	/* First check directives (Default is no directive [0] which is the same as -Cr) */
+					case 'i': Ctrl->C.iterative = true;                     k = 1; break;
 					case 'n': Ctrl->C.mode = GMT_SVD_EIGEN_NUMBER_CUTOFF;   k = 1; break;
 					case 'r': Ctrl->C.mode = GMT_SVD_EIGEN_RATIO_CUTOFF;    k = 1; break;
 					case 'v': Ctrl->C.mode = GMT_SVD_EIGEN_VARIANCE_CUTOFF; k = 1; break;
@@ -816,6 +886,8 @@ static int parse (struct GMT_CTRL *GMT, struct GREENSPLINE_CTRL *Ctrl, struct GM
 	n_errors += gmt_M_check_condition (GMT, Ctrl->S.mode == LINEAR_1D && Ctrl->Z.mode > 3, "Option -Sl: Cannot select -Z4 or higher\n");
 	n_errors += gmt_M_check_condition (GMT, Ctrl->I.active && (Ctrl->I.inc[GMT_X] <= 0.0 || (dimension > 1 && Ctrl->I.inc[GMT_Y] <= 0.0) || (dimension == 3 && Ctrl->I.inc[GMT_Z] <= 0.0)), "Option -I: Must specify positive increment(s)\n");
 	n_errors += gmt_M_check_condition (GMT, Ctrl->C.active && Ctrl->C.dryrun && !Ctrl->C.file, "Option -C: Must specify file name for eigenvalues if +n is set");
+	n_errors += gmt_M_check_condition (GMT, Ctrl->C.iterative && (Ctrl->C.history || Ctrl->C.dryrun || Ctrl->C.file), "Option -Ci: Eigenvalue reporting and history require a factorization; cannot combine with the iterative solver\n");
+	n_errors += gmt_M_check_condition (GMT, Ctrl->C.iterative && (Ctrl->A.active || Ctrl->Q.active), "Option -Ci: Gradient constraints yield a nonsymmetric system; use -C or the default Gauss-Jordan solver\n");
 	n_errors += gmt_M_check_condition (GMT, Ctrl->T.active && !Ctrl->T.file, "Option -T: Must specify mask grid file name\n");
 	n_errors += gmt_M_check_condition (GMT, Ctrl->T.active && dimension != 2, "Option -T: Only applies to 2-D gridding\n");
 	n_errors += gmt_M_check_condition (GMT, Ctrl->N.active && !Ctrl->N.file, "Option -N: Must specify node file name\n");
@@ -1568,6 +1640,62 @@ GMT_LOCAL double greenspline_get_dircosine (struct GMT_CTRL *GMT, double *D, dou
 	return (C);
 }
 
+#define GSP_EVAL_BATCH 64	/* Number of center radii evaluated per batch in the summation helpers */
+
+GMT_LOCAL double greenspline_eval_greens_sum (struct GMT_CTRL *GMT, double *V, double **X, uint64_t nm, unsigned int dim, double (*G) (struct GMT_CTRL *, double, double *, struct GREENSPLINE_LOOKUP *), double par[], struct GREENSPLINE_LOOKUP *Lz, double *alpha) {
+	/* Evaluate the solution at output point V by summing the nm scaled Green's functions.
+	 * The radii are computed in small batches ahead of the kernel so the two tight loops
+	 * pipeline (and auto-vectorize) better than the fused per-center loop, and in 2-D the
+	 * distance terms that only depend on V are computed once via gmt_distance_from instead
+	 * of once per center. */
+	uint64_t p, q, np;
+	double r[GSP_EVAL_BATCH], wp = 0.0;
+	struct GMT_DIST_FROM F;
+
+	if (dim == 2U) gmt_distance_from_prep (GMT, V[GMT_X], V[GMT_Y], &F);
+	for (p = 0; p < nm; p += np) {
+		np = MIN (GSP_EVAL_BATCH, nm - p);
+		if (dim == 2U) {
+			for (q = 0; q < np; q++)
+				r[q] = gmt_distance_from (GMT, &F, X[p+q][GMT_X], X[p+q][GMT_Y]);
+		}
+		else {
+			for (q = 0; q < np; q++)
+				r[q] = greenspline_get_radius (GMT, V, X[p+q], dim);
+		}
+		for (q = 0; q < np; q++)
+			wp += alpha[p+q] * G (GMT, r[q], par, Lz);
+	}
+	return (wp);
+}
+
+GMT_LOCAL double greenspline_eval_grad_sum (struct GMT_CTRL *GMT, double *V, double **X, uint64_t nm, unsigned int dim, double *qdir, double (*dGdr) (struct GMT_CTRL *, double, double *, struct GREENSPLINE_LOOKUP *), double par[], struct GREENSPLINE_LOOKUP *L, double *alpha) {
+	/* As greenspline_eval_greens_sum but for the directional derivative of the solution,
+	 * skipping self-pairs where the radius is zero. */
+	uint64_t p, q, np;
+	double r[GSP_EVAL_BATCH], C, wp = 0.0;
+	struct GMT_DIST_FROM F;
+
+	if (dim == 2U) gmt_distance_from_prep (GMT, V[GMT_X], V[GMT_Y], &F);
+	for (p = 0; p < nm; p += np) {
+		np = MIN (GSP_EVAL_BATCH, nm - p);
+		if (dim == 2U) {
+			for (q = 0; q < np; q++)
+				r[q] = gmt_distance_from (GMT, &F, X[p+q][GMT_X], X[p+q][GMT_Y]);
+		}
+		else {
+			for (q = 0; q < np; q++)
+				r[q] = greenspline_get_radius (GMT, V, X[p+q], dim);
+		}
+		for (q = 0; q < np; q++) {
+			if (gmt_M_is_zero (r[q])) continue;	/* Skip self-pairs */
+			C = greenspline_get_dircosine (GMT, qdir, V, X[p+q], dim, false);
+			wp += alpha[p+q] * dGdr (GMT, r[q], par, L) * C;
+		}
+	}
+	return (wp);
+}
+
 GMT_LOCAL void greenspline_dump_system (double *A, double *b, uint64_t nm, char *string) {
 	/* Dump an A | b system to stderr for debugging */
 	uint64_t row, col, ij;
@@ -2386,7 +2514,13 @@ EXTERN_MSC int GMT_greenspline (void *V_API, int mode, void *args) {
 		if (Ctrl->debug.active) greenspline_dump_system (A, obs, nm, "Normal equation N row || r");
 	}
 
-	if (Ctrl->C.active) {		/* Solve using SVD */
+	if (Ctrl->C.active && Ctrl->C.iterative) {	/* Solve iteratively by conjugate gradients */
+		double rtol = (Ctrl->C.value > 0.0) ? Ctrl->C.value : GREENSPLINE_CG_RTOL;
+		GMT_Report (API, GMT_MSG_INFORMATION, "Solve linear equations by conjugate gradients (rtol = %g)\n", rtol);
+		if ((error = greenspline_cgsolve (GMT, A, nm, obs, rtol)) != 0)
+			Return (error);
+	}
+	else if (Ctrl->C.active) {		/* Solve using SVD */
 		int error;
 
 		GMT_Report (API, GMT_MSG_INFORMATION, "Solve linear equations by Singular Value Decomposition\n");
@@ -2703,7 +2837,7 @@ EXTERN_MSC int GMT_greenspline (void *V_API, int mode, void *args) {
 				/* obs (hence alpha) now has the solution for the coefficients based on the first e eigenvalues */
 				if (Ctrl->Q.active) {	/* Derivatives of solution */
 #ifdef _OPENMP
-#pragma omp parallel for private(row,V,col,ij,p,wp,r,C,part) shared(Grid,yp,xp,nm,GMT,Ctrl,X,G,par,Lz,alpha,Out,normalize,norm)
+#pragma omp parallel for private(row,V,col,ij,wp) shared(Grid,yp,xp,nm,GMT,Ctrl,X,dGdr,par,Lz,alpha,Out,normalize,norm)
 #endif
 					for (row = 0; row < (openmp_int)Grid->header->n_rows; row++) {
 						V[GMT_Y] = yp[row];
@@ -2712,14 +2846,7 @@ EXTERN_MSC int GMT_greenspline (void *V_API, int mode, void *args) {
 							if (gmt_M_is_fnan (Grid->data[ij])) continue;	/* Only do solution where mask is not NaN */
 							V[GMT_X] = xp[col];
 							/* Here, V holds the current output coordinates */
-							for (p = 0, wp = 0.0; p < nm; p++) {
-								r = greenspline_get_radius (GMT, V, X[p], 2U);
-								if (!gmt_M_is_zero (r)) {	/* For all pairs except self-pairs */
-									C = greenspline_get_dircosine (GMT, Ctrl->Q.dir, V, X[p], 2U, false);
-									part = dGdr (GMT, r, par, Lz) * C;
-									wp += alpha[p] * part;
-								}
-							}
+							wp = greenspline_eval_grad_sum (GMT, V, X, nm, 2U, Ctrl->Q.dir, dGdr, par, Lz, alpha);
 							V[GMT_Z] = finalize (V, wp, normalize, norm, 2U);
 							Out->data[ij] = (gmt_grdfloat)V[GMT_Z];
 						}
@@ -2758,7 +2885,7 @@ EXTERN_MSC int GMT_greenspline (void *V_API, int mode, void *args) {
 						if (Ctrl->W.active) S->data[4][e] = chi2_sum;	/* Chi^2 sum for this solution */
 					}
 #ifdef _OPENMP
-#pragma omp parallel for private(row,V,col,ij,p,wp,r,part) shared(Grid,yp,xp,nm,GMT,X,G,par,Lz,alpha,Out,normalize,norm)
+#pragma omp parallel for private(row,V,col,ij,wp) shared(Grid,yp,xp,nm,GMT,X,G,par,Lz,alpha,Out,normalize,norm)
 #endif
 					for (row = 0; row < (openmp_int)Grid->header->n_rows; row++) {
 						V[GMT_Y] = yp[row];
@@ -2767,11 +2894,7 @@ EXTERN_MSC int GMT_greenspline (void *V_API, int mode, void *args) {
 							if (gmt_M_is_fnan (Grid->data[ij])) continue;	/* Only do solution where mask is not NaN */
 							V[GMT_X] = xp[col];
 							/* Here, V holds the current output coordinates */
-							for (p = 0, wp = 0.0; p < nm; p++) {
-								r = greenspline_get_radius (GMT, V, X[p], 2U);
-								part = G (GMT, r, par, Lz);
-								wp += alpha[p] * part;
-							}
+							wp = greenspline_eval_greens_sum (GMT, V, X, nm, 2U, G, par, Lz, alpha);
 							Out->data[ij] = (gmt_grdfloat)finalize (V, wp, normalize, norm, 2U);
 						}
 					}	/* End of row-loop [OpenMP] */
@@ -2836,7 +2959,7 @@ EXTERN_MSC int GMT_greenspline (void *V_API, int mode, void *args) {
 				double z_layer = (dimension == 3) ? Cube->z[layer] : 0.0;
 				if (Ctrl->Q.active) {	/* Derivatives of solution */
 #ifdef _OPENMP
-#pragma omp parallel for private(row,V,ij,col,p,wp,r,C,part) shared(header,dimension,yp,z_layer,nz_off,data,xp,nm,GMT,X,Ctrl,dGdr,par,Lz,alpha,normalize,norm)
+#pragma omp parallel for private(row,V,ij,col,wp) shared(header,dimension,yp,z_layer,nz_off,data,xp,nm,GMT,X,Ctrl,dGdr,par,Lz,alpha,normalize,norm)
 #endif
 					for (row = 0; row < (openmp_int)header->n_rows; row++) {	/* This would be a dummy loop for 1 row if 1-D data */
 						if (dimension > 1)  V[GMT_Y] = yp[row];
@@ -2846,21 +2969,14 @@ EXTERN_MSC int GMT_greenspline (void *V_API, int mode, void *args) {
 							if (dimension == 2 && gmt_M_is_fnan (data[ij])) continue;	/* Only do solution where mask is not NaN */
 							V[GMT_X] = xp[col];
 							/* Here, V holds the current output coordinates */
-							for (p = 0, wp = 0.0; p < (int64_t)nm; p++) {	/* Loop over Green's function components */
-								r = greenspline_get_radius (GMT, V, X[p], dimension);
-								if (!gmt_M_is_zero (r)) {	/* For all pairs except self-pairs */
-									C = greenspline_get_dircosine (GMT, Ctrl->Q.dir, V, X[p], dimension, false);
-									part = dGdr (GMT, r, par, Lz) * C;
-									wp += alpha[p] * part;
-								}
-							}
+							wp = greenspline_eval_grad_sum (GMT, V, X, nm, dimension, Ctrl->Q.dir, dGdr, par, Lz, alpha);
 							data[ij] = (gmt_grdfloat)finalize (V, wp, normalize, norm, dimension);
 						}
 					}	/* End of row-loop [OpenMP] */
 				}
 				else {	/* Regular surface */
 #ifdef _OPENMP
-#pragma omp parallel for private(row,V,ij,col,p,wp,r,part) shared(header,dimension,yp,z_layer,nz_off,data,xp,nm,GMT,X,G,par,Lz,alpha,normalize,norm)
+#pragma omp parallel for private(row,V,ij,col,wp) shared(header,dimension,yp,z_layer,nz_off,data,xp,nm,GMT,X,G,par,Lz,alpha,normalize,norm)
 #endif
 					for (row = 0; row < (openmp_int)header->n_rows; row++) {	/* This would be a dummy loop for 1 row if 1-D data */
 						if (dimension > 1)  V[GMT_Y] = yp[row];
@@ -2870,11 +2986,7 @@ EXTERN_MSC int GMT_greenspline (void *V_API, int mode, void *args) {
 							if (dimension == 2 && gmt_M_is_fnan (data[ij])) continue;	/* Only do solution where mask is not NaN */
 							V[GMT_X] = xp[col];
 							/* Here, V holds the current output coordinates */
-							for (p = 0, wp = 0.0; p < (int64_t)nm; p++) {	/* Loop over Green's function components */
-								r = greenspline_get_radius (GMT, V, X[p], dimension);
-								part = G (GMT, r, par, Lz);
-								wp += alpha[p] * part;
-							}
+							wp = greenspline_eval_greens_sum (GMT, V, X, nm, dimension, G, par, Lz, alpha);
 							data[ij] = (gmt_grdfloat)finalize (V, wp, normalize, norm, dimension);
 						}
 					}	/* End of row-loop [OpenMP] */
@@ -308,7 +308,66 @@ GMT_LOCAL void FZ_trend (double *x, double *y, int n, double *intercept, double
 	}
 }
 
-GMT_LOCAL int FZ_fit_model(struct GMT_CTRL *GMT, double *d, double *vgg, int n, double corridor, double *width, int n_widths, double *asym, int n_asym, double *comp, int n_comp, double *results, PFV *FZshape) {
+#define FZ_COARSE_NP	48	/* Decimate cross-profiles longer than this for the initial coarse parameter scan */
+
+struct FZ_WORK {	/* Per-thread scratch space so cross-profiles can be analyzed concurrently */
+	double *d_vgg;			/* Detrended copy of the observed profile */
+	double *res;			/* Residuals after removing a trial model */
+	double *predicted_vgg;		/* The blended trial model */
+	double *vgg_comp[N_SHAPES];	/* The three basic shapes for the current trial */
+	double *d_dec, *vgg_dec;	/* Decimated profile copies used by the coarse scan */
+	double *comp[N_SHAPES];		/* Scratch for evaluating the winning model shapes */
+};
+
+struct FZ_BEST {	/* Holds the best trial found during a parameter scan */
+	double var;	/* Sum of squared residuals for this trial */
+	double par[3];	/* Intercept, slope, and amplitude from the LS solution */
+	int way, col0, w, ic, row;	/* Indices of the winning trial parameters (col0 is a profile point) */
+};
+
+GMT_LOCAL void FZ_fit_scan (struct GMT_CTRL *GMT, double *d, double *vgg, int n, double corridor, double *width, double *asym, double *comp,
+	int w_lo, int w_hi, int a_lo, int a_hi, int c_lo, int c_hi, int col_lo, int col_hi, int way_lo, int way_hi,
+	int got_trough, struct FZ_BEST *best_b, struct FZ_BEST *best_t, PFV *FZshape, struct FZ_WORK *Wk, int *n_sing, int *n_fits)
+{	/* Scan the given index ranges of trial FZ locations, widths, compressions, and asymmetries for
+	 * the combination that minimizes the residual variance, updating best_b (and best_t for the pure
+	 * trough model when got_trough and asym = 0 is part of the scan).  The explicit ranges let the
+	 * caller run a full coarse scan first and then a narrow refinement around its winner. */
+	int col0, w, m, ic, row, way;
+	double var_model, par[3];
+	for (way = way_lo; way <= way_hi; way += 2) {	/* Must use normal and reversed model since we dont know which side is young (-1 means old is to the left or negative d) */
+		for (col0 = col_lo; col0 <= col_hi; col0++) {	/* Search for a better fit to FZ location within +- corr km of digitized location */
+			if (fabs (d[col0]) > corridor) continue;	/* Outside central corridor where we allow relocation of FZ position */
+			for (w = w_lo; w <= w_hi; w++) {	/* Search for best shape width from 20 to 100 km */
+				for (m = 0; m < N_SHAPES; m++)  FZshape[m] (d, n, d[col0], width[w], way, Wk->vgg_comp[m]);
+				for (ic = c_lo; ic <= c_hi; ic++) {	/* Search for best compression factor */
+					for (row = a_lo; row <= a_hi; row++) {	/* Search for optimal asymmetry parameter asym */
+						(*n_fits)++;
+						FZ_blendmodel(Wk->vgg_comp[FZ_G0], Wk->vgg_comp[FZ_G1], Wk->vgg_comp[FZ_G2], Wk->predicted_vgg, n, asym[row], comp[ic], 1.0);	/* a blend, with unit amplitude */
+						if (FZ_solution(GMT, d, vgg, d[col0], Wk->predicted_vgg, n, par)) {	/* LS solution for trend + scaled shape */
+							(*n_sing)++;
+							continue;		/* Return 1 if singular */
+						}
+						if (par[2] < 0.0) continue;	/* Do not consider negative amplitudes since we have way to handle reversals */
+						FZ_residuals (d, vgg, d[col0], Wk->predicted_vgg, Wk->res, n, par);	/* Return residuals after removing best-fitting FZ shape */
+						var_model = FZ_get_variance (Wk->res, n);			/* Compute sum of squares */
+						if (var_model < best_b->var) {		/* A better fit was obtained, update parameters */
+							best_b->var = var_model;
+							best_b->way = way;	best_b->col0 = col0;	best_b->w = w;	best_b->ic = ic;	best_b->row = row;
+							gmt_M_memcpy (best_b->par, par, 3, double);
+						}
+						if (got_trough && row == 0 && var_model < best_t->var) {	/* Keep separate tabs of best trough (t = 0) model */
+							best_t->var = var_model;
+							best_t->way = way;	best_t->col0 = col0;	best_t->w = w;	best_t->ic = ic;	best_t->row = row;
+							gmt_M_memcpy (best_t->par, par, 3, double);
+						}
+					}
+				}
+			}
+		}
+	}
+}
+
+GMT_LOCAL int FZ_fit_model(struct GMT_CTRL *GMT, double *d, double *vgg, int n, double corridor, double *width, int n_widths, double *asym, int n_asym, double *comp, int n_comp, double *results, PFV *FZshape, struct FZ_WORK *Wk) {
 	/* d	   = distance along crossing profile in km, with d = 0 the nominal FZ location given by digitized line.
 	 * vgg	   = observed (resampled) VGG along crossing profile, possibly with NaNs at end.
 	 * n	   = number of points in the profile (including any NaNs)
@@ -317,88 +376,95 @@ GMT_LOCAL int FZ_fit_model(struct GMT_CTRL *GMT, double *d, double *vgg, int n,
 	 * asym    = array with asymmetry parameters to try
 	 * comp    = array with compression parameters to try
 	 * results = array with parameters determined below
+	 * Wk      = this thread's scratch space so concurrent profiles share no state
 	 *
 	 * Take observed VGG cross-profile, detrend it, and then try to fit
 	 * a theoretical profile by shifting FZ position horizontally and
 	 * adjusting the width of the signal.  We do this for a blend of two models, and
 	 * keep track of the best blend overall. In the end we return which
-	 * model that fit best, its variance reduction (in %), and the parameters. */
-	
-	int col0, w, m, ic, row, way, n_sing = 0, n_fits = 0, got_trough;
-	double *d_vgg = NULL, *res = NULL, *predicted_vgg = NULL, *vgg_comp[N_SHAPES] = {NULL, NULL, NULL};
-	double min_var_b, min_var_t, var_model, intercept = 0.0, slope, var_data, F, par[3];
-	
+	 * model that fit best, its variance reduction (in %), and the parameters.
+	 * For long profiles we first scan the full parameter space on a decimated copy
+	 * of the profile, then refine at full resolution in a narrow neighborhood of the
+	 * coarse winner, which cuts the per-profile cost considerably. */
+
+	int w, q, n_sing = 0, n_fits = 0, got_trough;
+	double intercept = 0.0, slope, var_data, F;
+	struct FZ_BEST best_b, best_t;
+
 	/* The algorithms used below anticipate that vgg may have NaNs and thus skip those */
-	
+
 	/* First find a LS trend and remove it from vgg */
-	
-	d_vgg = gmt_M_memory (GMT, NULL, n, double);
-	res = gmt_M_memory (GMT, NULL, n, double);
-	for (m = 0; m < N_SHAPES; m++) vgg_comp[m] = gmt_M_memory (GMT, NULL, n, double);
-	predicted_vgg = gmt_M_memory (GMT, NULL, n, double);
-	gmt_M_memcpy (d_vgg, vgg, n, double);	/* Make copy of vgg */
-	FZ_trend(d, d_vgg, n, &intercept, &slope, 1);		/* Find and remove linear trend just for data variance calculation */
+
+	gmt_M_memcpy (Wk->d_vgg, vgg, n, double);	/* Make copy of vgg */
+	FZ_trend(d, Wk->d_vgg, n, &intercept, &slope, 1);		/* Find and remove linear trend just for data variance calculation */
 	/* So trend = d * slope + intercept; the shift of FZ location does not change this calculation (i.e. d is original d) */
-	
-	var_data = FZ_get_variance (d_vgg, n);	/* Compute sum of squares for the detrended data */
-	min_var_b = min_var_t = DBL_MAX;
+
+	var_data = FZ_get_variance (Wk->d_vgg, n);	/* Compute sum of squares for the detrended data */
+	best_b.var = best_t.var = DBL_MAX;
+	best_b.col0 = best_t.col0 = -1;
 	got_trough = (gmt_M_is_zero (asym[0]));
-	for (way = -1; way < 2; way += 2) {	/* Must use normal and reversed model since we dont know which side is young (-1 means old is to the left or negative d) */
-		for (col0 = 0; col0 < n; col0++) {	/* Search for a better fit to FZ location within +- corr km of digitized location */
-			if (fabs (d[col0]) > corridor) continue;	/* Outside central corridor where we allow relocation of FZ position */
-			for (w = 0; w < n_widths; w++) {	/* Search for best shape width from 20 to 100 km */
-				for (m = 0; m < N_SHAPES; m++)  FZshape[m] (d, n, d[col0], width[w], way, vgg_comp[m]);
-				for (ic = 0; ic < n_comp; ic++) {	/* Search for best compression factor */
-					for (row = 0; row < n_asym; row++) {	/* Search for optimal asymmetry parameter asym */
-						n_fits++;
-						FZ_blendmodel(vgg_comp[FZ_G0], vgg_comp[FZ_G1], vgg_comp[FZ_G2], predicted_vgg, n, asym[row], comp[ic], 1.0);	/* a blend, with unit amplitude */
-						if (FZ_solution(GMT, d, vgg, d[col0], predicted_vgg, n, par)) {	/* LS solution for trend + scaled shape */
-							n_sing++;
-							continue;		/* Return 1 if singular */
-						}
-						if (par[2] < 0.0) continue;	/* Do not consider negative amplitudes since we have way to handle reversals */
-						FZ_residuals (d, vgg, d[col0], predicted_vgg, res, n, par);	/* Return residuals after removing best-fitting FZ shape */
-						var_model = FZ_get_variance (res, n);				/* Compute sum of squares */
-						if (var_model < min_var_b) {		/* A better fit was obtained, update parameters */
-							min_var_b = var_model;
-							results[BEST_MODEL_B] = asym[row];
-							results[BEST_WAY_B] = (double)way;
-							results[BEST_FZLOC_B] = d[col0];
-							results[BEST_WIDTH_B] = width[w];
-							results[BEST_FLANK_B] = comp[ic];
-							results[BEST_INTER_B] = par[0];
-							results[BEST_SLOPE_B] = par[1];
-							results[BEST_AMPLT_B] = par[2];
-						}
-						if (got_trough && row == 0 && var_model < min_var_t) {		/* Keep separate tabs of best trough (t = 0) model */
-							min_var_t = var_model;
-							results[BEST_FZLOC_T] = d[col0];
-							results[BEST_WIDTH_T] = width[w];
-							results[BEST_FLANK_T] = comp[ic];
-							results[BEST_INTER_T] = par[0];
-							results[BEST_SLOPE_T] = par[1];
-							results[BEST_AMPLT_T] = par[2];
-						}
-					}
-				}
-			}
+	q = n / FZ_COARSE_NP;	/* Decimation factor for the coarse scan */
+	if (q > 1) {	/* Coarse-to-fine: scan every parameter on a decimated profile, then polish at full resolution */
+		int j, nd, c0, c_sing = 0, c_fits = 0;
+		struct FZ_BEST coarse_b, coarse_t;
+		coarse_b.var = coarse_t.var = DBL_MAX;
+		coarse_b.col0 = coarse_t.col0 = -1;
+		for (j = nd = 0; j < n; j += q, nd++) {	/* Build the decimated profile */
+			Wk->d_dec[nd] = d[j];
+			Wk->vgg_dec[nd] = vgg[j];
 		}
+		FZ_fit_scan (GMT, Wk->d_dec, Wk->vgg_dec, nd, corridor, width, asym, comp, 0, n_widths-1, 0, n_asym-1, 0, n_comp-1,
+			0, nd-1, -1, +1, got_trough, &coarse_b, &coarse_t, FZshape, Wk, &c_sing, &c_fits);
+		if (coarse_b.col0 != -1) {	/* Refine around the coarse winner at full resolution */
+			c0 = coarse_b.col0 * q;	/* Winning FZ location index on the full profile */
+			FZ_fit_scan (GMT, d, vgg, n, corridor, width, asym, comp,
+				MAX (0, coarse_b.w - 1), MIN (n_widths-1, coarse_b.w + 1),
+				MAX (0, coarse_b.row - 1), MIN (n_asym-1, coarse_b.row + 1),
+				MAX (0, coarse_b.ic - 1), MIN (n_comp-1, coarse_b.ic + 1),
+				MAX (0, c0 - q), MIN (n-1, c0 + q), coarse_b.way, coarse_b.way,
+				false, &best_b, &best_t, FZshape, Wk, &n_sing, &n_fits);
+		}
+		if (got_trough && coarse_t.col0 != -1) {	/* Also refine the pure trough (asym = 0) model around its own winner */
+			c0 = coarse_t.col0 * q;
+			FZ_fit_scan (GMT, d, vgg, n, corridor, width, asym, comp,
+				MAX (0, coarse_t.w - 1), MIN (n_widths-1, coarse_t.w + 1), 0, 0,
+				MAX (0, coarse_t.ic - 1), MIN (n_comp-1, coarse_t.ic + 1),
+				MAX (0, c0 - q), MIN (n-1, c0 + q), coarse_t.way, coarse_t.way,
+				got_trough, &best_b, &best_t, FZshape, Wk, &n_sing, &n_fits);
+		}
+	}
+	if (best_b.col0 == -1)	/* Short profile, or the coarse scan found nothing usable (e.g., mostly NaNs): do the full scan */
+		FZ_fit_scan (GMT, d, vgg, n, corridor, width, asym, comp, 0, n_widths-1, 0, n_asym-1, 0, n_comp-1,
+			0, n-1, -1, +1, got_trough, &best_b, &best_t, FZshape, Wk, &n_sing, &n_fits);
+	if (best_b.col0 != -1) {	/* Copy out the winning blend parameters */
+		results[BEST_MODEL_B] = asym[best_b.row];
+		results[BEST_WAY_B] = (double)best_b.way;
+		results[BEST_FZLOC_B] = d[best_b.col0];
+		results[BEST_WIDTH_B] = width[best_b.w];
+		results[BEST_FLANK_B] = comp[best_b.ic];
+		results[BEST_INTER_B] = best_b.par[0];
+		results[BEST_SLOPE_B] = best_b.par[1];
+		results[BEST_AMPLT_B] = best_b.par[2];
 	}
-	F = ((var_data - min_var_b) / 4) / (min_var_b / (n - 4));		/* Compute F for best model, assuming nu = 5-1 = 4 */
-	results[BEST_VARMD_B] = 100.0 * (var_data - min_var_b) / var_data;	/* Variance reduction in % */
+	if (got_trough && best_t.col0 != -1) {	/* Copy out the winning trough parameters */
+		results[BEST_FZLOC_T] = d[best_t.col0];
+		results[BEST_WIDTH_T] = width[best_t.w];
+		results[BEST_FLANK_T] = comp[best_t.ic];
+		results[BEST_INTER_T] = best_t.par[0];
+		results[BEST_SLOPE_T] = best_t.par[1];
+		results[BEST_AMPLT_T] = best_t.par[2];
+	}
+	F = ((var_data - best_b.var) / 4) / (best_b.var / (n - 4));		/* Compute F for best model, assuming nu = 5-1 = 4 */
+	results[BEST_VARMD_B] = 100.0 * (var_data - best_b.var) / var_data;	/* Variance reduction in % */
 	results[BEST_FSTAT_B] = F;
 	if (got_trough) {	/* Same results for a pure through model */
-		F = ((var_data - min_var_t) / 3) / (min_var_t / (n - 3));		/* Compute F for best trough model, assuming nu = 4-1 = 3 */
-		results[BEST_VARMD_T] = 100.0 * (var_data - min_var_t) / var_data;	/* Variance reduction in % */
+		F = ((var_data - best_t.var) / 3) / (best_t.var / (n - 3));		/* Compute F for best trough model, assuming nu = 4-1 = 3 */
+		results[BEST_VARMD_T] = 100.0 * (var_data - best_t.var) / var_data;	/* Variance reduction in % */
 		results[BEST_FSTAT_T] = F;
 	}
 	else {	/* Never requested a pure through model */
 		for (w = BEST_FZLOC_T; w <= BEST_FSTAT_T; w++) results[w] = GMT->session.d_NaN;
 	}
-	gmt_M_free (GMT, d_vgg);
-	gmt_M_free (GMT, res);
-	gmt_M_free (GMT, predicted_vgg);
-	for (m = 0; m < N_SHAPES; m++) gmt_M_free (GMT, vgg_comp[m]);
 	return ((int)irint (100.0 * n_sing / n_fits));	/* Return percentage of singular solutions as a measure of trouble */
 }
 
@@ -685,23 +751,23 @@ static int parse (struct GMTAPI_CTRL *API, struct FZMODELER_CTRL *Ctrl, struct G
 #define Return(code) {Free_Ctrl (GMT, Ctrl); gmt_end_module (GMT, GMT_cpy); bailout (code);}
 
 EXTERN_MSC int GMT_fzanalyzer (void *V_API, int mode, void *args) {
-	int error = 0, k, start, stop, left, right;
-	int n_sing, way, m;
-	uint64_t n_FZ_widths, n_FZ_asym, n_FZ_comp, np_cross, n_half_cross, ii;
-	uint64_t fz, ku, row, col, xseg;
+	int error = 0, m, t, n_threads = 1;
+	uint64_t n_FZ_widths, n_FZ_asym, n_FZ_comp, np_cross, n_half_cross;
+	uint64_t fz, ku, col, xseg;
+	openmp_int prow;
 
-	char buffer[BUFSIZ] = {""}, run_cmd[BUFSIZ] = {""}, add[BUFSIZ] = {""}, *cmd = NULL, *file = NULL;
-	
-	double fz_inc, corridor_half_width, cross_length, threshold, results[N_RESULTS], best_loc[4];
-	double *FZ_width = NULL, *FZ_asym = NULL, *FZ_comp = NULL, ages[2], *comp[N_SHAPES];
+	char buffer[BUFSIZ] = {""}, run_cmd[BUFSIZ] = {""}, *cmd = NULL, *file = NULL;
+
+	double corridor_half_width, cross_length, threshold;
+	double *FZ_width = NULL, *FZ_asym = NULL, *FZ_comp = NULL;
 
 	PFV FZshape[N_SHAPES] = {NULL, NULL, NULL};
 
+	struct FZ_WORK *work = NULL;
 	struct GMT_OPTION *options = NULL;
 	struct FZMODELER_CTRL *Ctrl = NULL;
 	struct GMT_DATASET *Fin = NULL, *Xin = NULL;
 	struct GMT_DATATABLE *F = NULL, *X = NULL;
-	struct GMT_DATASEGMENT *S = NULL;
 	struct GMT_CTRL *GMT = NULL, *GMT_cpy = NULL;
 	struct GMTAPI_CTRL *API = gmt_get_api_ptr (V_API);	/* Cast from void to GMTAPI_CTRL pointer */
 	
@@ -784,9 +850,22 @@ EXTERN_MSC int GMT_fzanalyzer (void *V_API, int mode, void *args) {
 	
 	np_cross = X->segment[0]->n_rows;			/* Since all cross-profiles have the same length */
 	corridor_half_width = 0.5 * Ctrl->D.corr_width;		/* Only search for trough within this zone */
-	ages[0] = ages[1] = GMT->session.d_NaN;			/* So we can report NaN if there are no ages */
-	
-	for (m = 0; m < N_SHAPES; m++) comp[m] = gmt_M_memory (GMT, NULL, np_cross, double);	/* Will hold normalized G0, G1, and G2 model predictions */
+
+#ifdef _OPENMP
+	n_threads = omp_get_max_threads ();
+#endif
+	work = gmt_M_memory (GMT, NULL, n_threads, struct FZ_WORK);
+	for (t = 0; t < n_threads; t++) {	/* Each thread gets its own fit workspace since the profiles are analyzed concurrently */
+		work[t].d_vgg = gmt_M_memory (GMT, NULL, np_cross, double);
+		work[t].res = gmt_M_memory (GMT, NULL, np_cross, double);
+		work[t].predicted_vgg = gmt_M_memory (GMT, NULL, np_cross, double);
+		work[t].d_dec = gmt_M_memory (GMT, NULL, np_cross, double);
+		work[t].vgg_dec = gmt_M_memory (GMT, NULL, np_cross, double);
+		for (m = 0; m < N_SHAPES; m++) {
+			work[t].vgg_comp[m] = gmt_M_memory (GMT, NULL, np_cross, double);
+			work[t].comp[m] = gmt_M_memory (GMT, NULL, np_cross, double);	/* Will hold normalized G0, G1, and G2 model predictions */
+		}
+	}
 
 	cmd = GMT_Create_Cmd (API,options);
 	sprintf (run_cmd, "# %s %s", GMT->init.module_name, cmd);	/* Build command line argument string */
@@ -826,22 +905,34 @@ EXTERN_MSC int GMT_fzanalyzer (void *V_API, int mode, void *args) {
 	threshold = -0.1 * (X->segment[0]->data[XPOS_D][1] - X->segment[0]->data[XPOS_D][0]);	/* 10% threshold lets us skip through tiny negative FZ dist steps due to round-off */
 	cross_length = X->segment[0]->data[XPOS_D][np_cross-1] - X->segment[0]->data[XPOS_D][0];	/* Length of a cross-profile */
 	
-	for (fz = xseg = 0; fz < F->n_segments; fz++) {	/* For each FZ segment */
+	for (fz = xseg = 0; fz < F->n_segments; xseg += F->segment[fz]->n_rows, fz++) {	/* For each FZ segment */
 
 		if (Ctrl->I.active && fz != (uint64_t)Ctrl->I.fz) {	/* Skip this FZ */
 			struct GMT_DATASEGMENT_HIDDEN *SH = gmt_get_DS_hidden (F->segment[fz]);
 			SH->mode = GMT_WRITE_SKIP;	/* Ignore on output */
-			xseg += F->segment[fz]->n_rows;		/* Must wind past all the cross-profiles for the skipped FZ */
 			continue;
 		}
-		
-		for (row = 0; row < F->segment[fz]->n_rows; row++, xseg++) {	/* Process all the cross-profiles for this FZ */
-			S = X->segment[xseg];	/* Current cross-profile */
+		GMT_Report (API, GMT_MSG_NORMAL, "Process %" PRIu64 " cross-profiles for FZ segment %" PRIu64 "\n", F->segment[fz]->n_rows, fz);
+
+#ifdef _OPENMP
+#pragma omp parallel for private(prow) shared(API,GMT,Ctrl,F,X,fz,xseg,np_cross,n_half_cross,threshold,corridor_half_width,FZ_width,n_FZ_widths,FZ_asym,n_FZ_asym,FZ_comp,n_FZ_comp,FZshape,work)
+#endif
+		for (prow = 0; prow < (openmp_int)F->segment[fz]->n_rows; prow++) {	/* The cross-profiles for this FZ are independent so we process them concurrently */
+			int k, start, stop, left, right, way, m, n_sing, t = 0;
+			uint64_t ku, ii, row = prow;
+			char hdr[BUFSIZ] = {""}, add[BUFSIZ] = {""};
+			double fz_inc, results[N_RESULTS], best_loc[4], ages[2];
+			struct GMT_DATASEGMENT *S = X->segment[xseg + row];	/* Current cross-profile */
+			struct FZ_WORK *Wk = NULL;
+#ifdef _OPENMP
+			t = omp_get_thread_num ();
+#endif
+			Wk = &work[t];	/* This thread's scratch space */
 			if (Ctrl->I.active && Ctrl->I.profile >= 0 && row != (uint64_t)Ctrl->I.profile) {	/* Skip this profile */
 				continue;
 			}
 			GMT_Report (API, GMT_MSG_NORMAL, "Process FZ cross-profile %s\r", S->label);
-			
+
 			/* Must determine if parts of the crossection is closer to a neighbor FZ; we then truncate the data. */
 			start = stop = -1;
 			for (ku = 0, left = n_half_cross - 1, right = n_half_cross + 1; ku < n_half_cross; ku++, right++, left--) {	/* March outwards from the center point which should have the smallest pn */
@@ -861,16 +952,16 @@ EXTERN_MSC int GMT_fzanalyzer (void *V_API, int mode, void *args) {
 			/* Find best fit shift, width, and amplitude plus various quality factors */
 
 			gmt_M_memset (results, N_RESULTS, double);
-			n_sing = FZ_fit_model (GMT, S->data[XPOS_D], S->data[XPOS_Z], np_cross, corridor_half_width, FZ_width, n_FZ_widths, FZ_asym, n_FZ_asym, FZ_comp, n_FZ_comp, results, FZshape);
-			if (n_sing) GMT_Report (API, GMT_MSG_NORMAL, "Warning: Cross profile %s generated %ld %% singular solutions\n", S->label, n_sing);
-	
+			n_sing = FZ_fit_model (GMT, S->data[XPOS_D], S->data[XPOS_Z], np_cross, corridor_half_width, FZ_width, n_FZ_widths, FZ_asym, n_FZ_asym, FZ_comp, n_FZ_comp, results, FZshape, Wk);
+			if (n_sing) GMT_Report (API, GMT_MSG_NORMAL, "Warning: Cross profile %s generated %d %% singular solutions\n", S->label, n_sing);
+
 			/* Evaluate the best model predictions */
-			FZshape[FZ_G0] (S->data[XPOS_D], np_cross, results[BEST_FZLOC_T], results[BEST_WIDTH_T], 0, comp[FZ_G0]);	/* Just need G0 & G2 for building trough model (asymmetry = 0) */
-			FZshape[FZ_G2] (S->data[XPOS_D], np_cross, results[BEST_FZLOC_T], results[BEST_WIDTH_T], 0, comp[FZ_G2]);
-			FZ_blendmodel (comp[FZ_G0], comp[FZ_G1], comp[FZ_G2], S->data[XPOS_T], np_cross, 0.0, results[BEST_FLANK_T], results[BEST_AMPLT_T]);	/* Best trough model (T) without the linear trend */
+			FZshape[FZ_G0] (S->data[XPOS_D], np_cross, results[BEST_FZLOC_T], results[BEST_WIDTH_T], 0, Wk->comp[FZ_G0]);	/* Just need G0 & G2 for building trough model (asymmetry = 0) */
+			FZshape[FZ_G2] (S->data[XPOS_D], np_cross, results[BEST_FZLOC_T], results[BEST_WIDTH_T], 0, Wk->comp[FZ_G2]);
+			FZ_blendmodel (Wk->comp[FZ_G0], Wk->comp[FZ_G1], Wk->comp[FZ_G2], S->data[XPOS_T], np_cross, 0.0, results[BEST_FLANK_T], results[BEST_AMPLT_T]);	/* Best trough model (T) without the linear trend */
 			way = irint (results[BEST_WAY_B]);	/* Old side on negative distance (-1) or positive distances (+1) */
-			for (m = 0; m < N_SHAPES; m++) FZshape[m] (S->data[XPOS_D], np_cross, results[BEST_FZLOC_B], results[BEST_WIDTH_B], way, comp[m]);	/* Evaluate all three shapes given blend parameters */
-			FZ_blendmodel (comp[FZ_G0], comp[FZ_G1], comp[FZ_G2], S->data[XPOS_B], np_cross, results[BEST_MODEL_B], results[BEST_FLANK_B], results[BEST_AMPLT_B]);	/* Best blend (B) without the linear trend */
+			for (m = 0; m < N_SHAPES; m++) FZshape[m] (S->data[XPOS_D], np_cross, results[BEST_FZLOC_B], results[BEST_WIDTH_B], way, Wk->comp[m]);	/* Evaluate all three shapes given blend parameters */
+			FZ_blendmodel (Wk->comp[FZ_G0], Wk->comp[FZ_G1], Wk->comp[FZ_G2], S->data[XPOS_B], np_cross, results[BEST_MODEL_B], results[BEST_FLANK_B], results[BEST_AMPLT_B]);	/* Best blend (B) without the linear trend */
 			m = FZ_trough_location (GMT, S->data[XPOS_D], S->data[XPOS_Z], S->data[XPOS_B], np_cross, corridor_half_width, best_loc);	/* Determine the LOC_DATA and LOC_BLEND_T estimates of FZ location */
 			best_loc[LOC_TROUGH] = results[BEST_FZLOC_T];		/* The 2nd best FZ location estimate is from the trough model */
 			best_loc[LOC_BLEND_E] = results[BEST_FZLOC_B];		/* The 3rd best FZ location estimate is from the blend model */
@@ -913,14 +1004,14 @@ EXTERN_MSC int GMT_fzanalyzer (void *V_API, int mode, void *args) {
 				(int)irint(results[BEST_VARMD_B]), results[BEST_FSTAT_B], best_loc[LOC_TROUGH], results[BEST_WIDTH_T], results[BEST_FLANK_T],
 				results[BEST_AMPLT_T], (int)irint(results[BEST_VARMD_T]), results[BEST_FSTAT_T], best_loc[LOC_DATA],
 				results[BEST_WIDTH_D], best_loc[LOC_BLEND_E]);
-			strcpy (buffer, S->header);
+			strcpy (hdr, S->header);
 			free (S->header);
-			gmt_chop (buffer);
-			strcat (buffer, add);
-			S->header = strdup (buffer);
+			gmt_chop (hdr);
+			strcat (hdr, add);
+			S->header = strdup (hdr);
 		}
 	}
-	GMT_Report (API, GMT_MSG_NORMAL, "Process FZ cross-profile %s\n", S->label);
+	GMT_Report (API, GMT_MSG_NORMAL, "Processed all FZ cross-profiles\n");
 
 	/* Save crosstrack profiles and models to file */
 	sprintf (buffer, "%s_cross.txt", Ctrl->T.prefix);
@@ -972,7 +1063,18 @@ EXTERN_MSC int GMT_fzanalyzer (void *V_API, int mode, void *args) {
 	
 	/* Close files and free misc. memory */
 	
-	for (m = 0; m < N_SHAPES; m++) gmt_M_free (GMT, comp[m]);
+	for (t = 0; t < n_threads; t++) {
+		gmt_M_free (GMT, work[t].d_vgg);
+		gmt_M_free (GMT, work[t].res);
+		gmt_M_free (GMT, work[t].predicted_vgg);
+		gmt_M_free (GMT, work[t].d_dec);
+		gmt_M_free (GMT, work[t].vgg_dec);
+		for (m = 0; m < N_SHAPES; m++) {
+			gmt_M_free (GMT, work[t].vgg_comp[m]);
+			gmt_M_free (GMT, work[t].comp[m]);
+		}
+	}
+	gmt_M_free (GMT, work);
 	gmt_M_free (GMT, FZ_width);
 	gmt_M_free (GMT, FZ_asym);
 	gmt_M_free (GMT, FZ_comp);
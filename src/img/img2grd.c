@@ -410,8 +410,10 @@ GMT_LOCAL int img2grd_setup_coord (struct GMT_CTRL *GMT, struct GMT_IMG_RANGE *r
 EXTERN_MSC int GMT_img2grd (void *V_API, int mode, void *args) {
 	int error = 0;
 	unsigned int navgsq, navg;	/* navg by navg pixels are averaged if navg > 1; else if navg == 1 do nothing */
-	unsigned int first, n_columns, n_rows, iout, jout, jinstart, jinstop, k, kk, ion, jj, iin, jin2, ii, kstart, *ix = NULL;
+	unsigned int first, n_columns, n_rows, iout, jinstart, jinstop, k, kk, ion, jj, iin, jin2, ii, kstart, *ix = NULL;
+	unsigned int n_threads = 1, band_rows, jband, jstop, n_read_rows;
 	int jin, iinstart, iinstop;
+	openmp_int jout;
 
 	uint64_t ij;
 	int16_t tempint;
@@ -419,9 +421,9 @@ EXTERN_MSC int GMT_img2grd (void *V_API, int mode, void *args) {
 	size_t n_expected;	/* Expected items per row */
 
 	double west, east, south, north, wesn[4], toplat, botlat, dx;
-	double south2, north2, rnavgsq, csum, dsum, left, bottom, inc[2];
+	double south2, north2, rnavgsq, csum, dsum, left, bottom, inc[2], scale;
 
-	int16_t *row = NULL;
+	int16_t *row = NULL, *this_row = NULL;
 	uint16_t *u2 = NULL;
 
 	char infile[PATH_MAX] = {""}, cmd[GMT_BUFSIZ] = {""}, input[GMT_VF_LEN] = {""}, output[PATH_MAX] = {""};
@@ -656,10 +658,14 @@ EXTERN_MSC int GMT_img2grd (void *V_API, int mode, void *args) {
 	}
 	strncpy (Merc->header->z_units, z_units, GMT_GRID_UNIT_LEN80-1);
 	strcpy (Merc->header->title, "Data from Altimetry");
-	Merc->header->z_min = DBL_MAX;	Merc->header->z_max = -DBL_MAX;
 	/* Now malloc some space for integer pixel index, and int16_t data buffer.  */
 
-	row = gmt_M_memory (GMT, NULL, navg * imgcoord.nxcol, int16_t);
+#ifdef _OPENMP
+	n_threads = (unsigned int)omp_get_max_threads ();
+#endif
+	band_rows = MAX (4 * n_threads, 16);	/* Output rows per file gulp; each gulp is decoded with its rows in parallel */
+	if (band_rows > Merc->header->n_rows) band_rows = Merc->header->n_rows;
+	row = gmt_M_memory (GMT, NULL, (size_t)band_rows * navg * imgcoord.nxcol, int16_t);
 	ix = gmt_M_memory (GMT, NULL, navgsq * Merc->header->n_columns, unsigned int);
 
 	/* Load ix with the index to the correct column, for each output desired.  This helps for Greenwich,
@@ -686,73 +692,83 @@ EXTERN_MSC int GMT_img2grd (void *V_API, int mode, void *args) {
 	/* Now before beginning data loop, fseek if needed.  */
 	if (jinstart > 0 && jinstart < (unsigned int)imgcoord.nyrow) fseek (fp, 2LL * imgcoord.nxcol * jinstart, SEEK_SET);
 
-	/* Now loop over output points, reading and handling data as needed */
+	/* Now loop over the output rows in bands of band_rows rows, reading each band of input rows in
+	 * one gulp and decoding its rows in parallel.  The byte swap, averaging, constraint decoding
+	 * and scaling are all row-local; only the file reads remain serial. */
 
 	n_expected = navg * imgcoord.nxcol;
-	for (jout = 0; jout < Merc->header->n_rows; jout++) {
-		jin = jinstart + navg * jout;
-		ij = gmt_M_ijp (Merc->header, jout, 0);	/* Left-most index of this row */
-		if (jin < 0 || jin >= imgcoord.nyrow) {	/* Outside latitude range; set row to NaNs */
-			for (iout = 0; iout < Merc->header->n_columns; iout++, ij++) Merc->data[ij] = GMT->session.f_NaN;
-			continue;
+	scale = (Ctrl->S.active) ? Ctrl->S.value : 1.0;	/* Constant for the whole conversion; hoisted out of the pixel loop */
+	for (jband = 0; jband < Merc->header->n_rows; jband += band_rows) {
+		jstop = MIN (jband + band_rows, Merc->header->n_rows);
+		/* The output rows that map to rows inside the file are contiguous from the top of the band */
+		for (n_read_rows = 0, jout = (openmp_int)jband; jout < (openmp_int)jstop; jout++) {
+			jin = jinstart + navg * jout;
+			if (jin >= 0 && jin < imgcoord.nyrow) n_read_rows++;
 		}
-		if ((fread (row, sizeof (int16_t), n_expected, fp) ) != n_expected) {
-			GMT_Report (API, GMT_MSG_ERROR, "Read failure at jin = %d.\n", jin);
+		if (n_read_rows && (fread (row, sizeof (int16_t), (size_t)n_read_rows * n_expected, fp)) != (size_t)n_read_rows * n_expected) {
+			GMT_Report (API, GMT_MSG_ERROR, "Read failure at jin = %d.\n", (int)(jinstart + navg * jband));
 			gmt_M_free (GMT, ix);	gmt_M_free (GMT, row);
 			fclose (fp);
 			Return (GMT_DATA_READ_ERROR);
 		}
 
+#ifdef _OPENMP
+#pragma omp parallel for private(jout,jin,ij,iout,kstart,k,kk,csum,dsum,tempint,this_row,u2) shared(GMT,Merc,Ctrl,navg,navgsq,rnavgsq,scale,jinstart,jband,jstop,imgcoord,ix,row,n_expected)
+#endif
+		for (jout = (openmp_int)jband; jout < (openmp_int)jstop; jout++) {
+			jin = jinstart + navg * jout;
+			ij = gmt_M_ijp (Merc->header, jout, 0);	/* Left-most index of this row */
+			if (jin < 0 || jin >= imgcoord.nyrow) {	/* Outside latitude range; set row to NaNs */
+				for (iout = 0; iout < Merc->header->n_columns; iout++, ij++) Merc->data[ij] = GMT->session.f_NaN;
+				continue;
+			}
+			this_row = row + (uint64_t)(jout - (openmp_int)jband) * n_expected;
+
 #ifndef WORDS_BIGENDIAN
-		u2 = (uint16_t *)row;
-		for (iout = 0; iout < navg * imgcoord.nxcol; iout++)
-			u2[iout] = bswap16 (u2[iout]);
+			u2 = (uint16_t *)this_row;
+			for (iout = 0; iout < n_expected; iout++)
+				u2[iout] = bswap16 (u2[iout]);
 #endif
 
-		for (iout = 0, kstart = 0; iout < Merc->header->n_columns; iout++, ij++, kstart += navgsq) {
-			if (navg) {
-				csum = dsum = 0.0;
-				for (k = 0, kk = kstart; k < navgsq; k++, kk++) {
-					tempint = row[ix[kk]];
-					if (Ctrl->T.value && abs (tempint) % 2 != 0) {
-						csum += 1.0;
-						tempint--;
+			for (iout = 0, kstart = 0; iout < Merc->header->n_columns; iout++, ij++, kstart += navgsq) {
+				if (navg) {
+					csum = dsum = 0.0;
+					for (k = 0, kk = kstart; k < navgsq; k++, kk++) {
+						tempint = this_row[ix[kk]];
+						if (Ctrl->T.value && abs (tempint) % 2 != 0) {
+							csum += 1.0;
+							tempint--;
+						}
+						dsum += (double) tempint;
 					}
-					dsum += (double) tempint;
+					csum *= rnavgsq;
+					dsum *= rnavgsq;
 				}
-				csum *= rnavgsq;
-				dsum *= rnavgsq;
-			}
-			else {
-				tempint = row[ix[iout]];
-				if (Ctrl->T.value && abs (tempint) %2 != 0) {
-					csum = 1.0;
-					tempint--;
+				else {
+					tempint = this_row[ix[iout]];
+					if (Ctrl->T.value && abs (tempint) %2 != 0) {
+						csum = 1.0;
+						tempint--;
+					}
+					else
+						csum = 0.0;
+					dsum = (double) tempint;
 				}
-				else
-					csum = 0.0;
-				dsum = (double) tempint;
-			}
 
-			if (Ctrl->S.active) dsum *= Ctrl->S.value;
-
-			switch (Ctrl->T.value) {
-				case 0:
-				case 1:
-					Merc->data[ij] = (gmt_grdfloat) dsum;
-					break;
-				case 2:
-					Merc->data[ij] = (gmt_grdfloat)((csum >= 0.5) ? dsum : GMT->session.f_NaN);
-					break;
-				case 3:
-					Merc->data[ij] = (gmt_grdfloat)csum;
-					break;
-			}
-
-
-			if (Ctrl->T.value != 2 || csum >= 0.5) {
-				if (Merc->header->z_min > Merc->data[ij]) Merc->header->z_min = Merc->data[ij];
-				if (Merc->header->z_max < Merc->data[ij]) Merc->header->z_max = Merc->data[ij];
+				dsum *= scale;
+
+				switch (Ctrl->T.value) {
+					case 0:
+					case 1:
+						Merc->data[ij] = (gmt_grdfloat) dsum;
+						break;
+					case 2:
+						Merc->data[ij] = (gmt_grdfloat)((csum >= 0.5) ? dsum : GMT->session.f_NaN);
+						break;
+					case 3:
+						Merc->data[ij] = (gmt_grdfloat)csum;
+						break;
+				}
 			}
 		}
 	}
@@ -761,6 +777,8 @@ EXTERN_MSC int GMT_img2grd (void *V_API, int mode, void *args) {
 	gmt_M_free (GMT, ix);
 	gmt_M_free (GMT, row);
 
+	gmt_grd_zminmax (GMT, Merc->header, Merc->data);	/* Reset z_min/z_max from the decoded values (NaNs are skipped) */
+
 	if (!Ctrl->E.active) {	/* Update R history with exact region found above */
 		/* Because the Mercator grid's equidistant y-nodes are not equidistant when converted back to geographic coordinates,
 		 * the corresponding south and north coordinates for the outside of the pixels will generally not match the given
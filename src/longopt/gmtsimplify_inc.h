@@ -25,6 +25,7 @@ static struct GMT_KEYWORD_DICTIONARY module_kw[] = {
 		  short_directives,    long_directives,
 		  short_modifiers,     long_modifiers,
 		  transproc_mask */
+	{ 0, 'D', "tolerances",        "", "", "", "", GMT_TP_STANDARD },
 	{ 0, 'T', "tolerance",         "", "", "", "", GMT_TP_STANDARD },
 	{ 0, '\0', "", "", "", "", "", 0 }  /* End of list marked with empty option and strings */
 };
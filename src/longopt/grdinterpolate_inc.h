@@ -25,6 +25,10 @@ static struct GMT_KEYWORD_DICTIONARY module_kw[] = { /* Local options for this m
 		  short_directives,    long_directives,
 		  short_modifiers,     long_modifiers,
 		  transproc_mask */
+	{ 0, 'A', "reduce",
+	          "m,s,t,q",               "mean,std,trend,quantile",
+	          "",                      "",
+		  GMT_TP_STANDARD },
 	{ 0, 'D', "netcdf|netCDF|ncheader",
 	          "",                      "",
 	          "x,y,z,c,d,s,o,n,t,r,v", "xname,yname,zname,cpt|cmap,dname,scale,offset,invalid,title,remark,varname",
@@ -30,6 +30,7 @@ static struct GMT_KEYWORD_DICTIONARY module_kw[] = {
 	          "d,l",               "delete,rhumb",
 		  GMT_TP_STANDARD },
 	GMT_C_CPT_KW,
+	{ 0, 'D', "tolerance",         "", "", "", "", GMT_TP_STANDARD },
 	{ 0, 'E', "keeptext",          "", "", "", "", GMT_TP_STANDARD },
 	{ 0, 'F', "interptype|interp",
 	          "a,c,e,l,n,s",       "akima,cubic,step,linear,none,smooth",
@@ -2310,6 +2310,113 @@ static int mgd77_free_header_record_cdf (struct GMT_CTRL *GMT, struct MGD77_HEAD
 	return (MGD77_NO_ERROR);	/* Success, it seems */
 }
 
+/* MGD77+ cruise header cache.  Programs like mgd77list and the x2sys tools reopen the same
+ * cruises over and over again; each open re-parses the 24-section header plus the attributes
+ * of every netCDF variable even though the file has not changed.  We therefore memoize the
+ * parsed MGD77_HEADER per file, keyed on path and modification time, and hand deep copies
+ * back on subsequent opens.  Callers own their copy and free it via MGD77_Free_Header_Record
+ * as before; the cache is released in MGD77_end (or silently at process exit). */
+
+#define MGD77_HCACHE_N	32	/* Number of cruise headers memoized at any one time */
+
+static struct MGD77_HCACHE_SLOT {	/* One memoized cruise header */
+	char *path;			/* Full path to the MGD77+ file [NULL if slot is empty] */
+	time_t mtime;			/* Modification time of the file when the header was parsed */
+	uint64_t last_use;		/* Access stamp used for LRU eviction */
+	int nc_recid;			/* Id of the record dimension in this file */
+	struct MGD77_HEADER H;		/* Deep copy of the parsed header */
+} mgd77_hcache[MGD77_HCACHE_N];
+static uint64_t mgd77_hcache_counter = 0;
+
+static void mgd77_hcache_dup (struct GMT_CTRL *GMT, struct MGD77_HEADER *from, struct MGD77_HEADER *to, bool to_cache) {
+	/* Deep-copy a parsed MGD77+ header.  Cache-internal copies (to_cache == true) use plain
+	 * strdup/calloc so they may outlive any one GMT session; copies handed back to callers use
+	 * gmt_M_memory so that mgd77_free_header_record_cdf can free them as it always has. */
+	int c, id;
+	size_t len;
+
+	gmt_M_memcpy (to, from, 1, struct MGD77_HEADER);	/* Copy all plain items; then redo the allocated ones */
+	if (from->author) {
+		len = strlen (from->author) + 1;
+		to->author = (to_cache) ? strdup (from->author) : gmt_M_memory (GMT, NULL, len, char);
+		if (!to_cache) gmt_M_memcpy (to->author, from->author, len, char);
+	}
+	if (from->history) {
+		len = strlen (from->history) + 1;
+		to->history = (to_cache) ? strdup (from->history) : gmt_M_memory (GMT, NULL, len, char);
+		if (!to_cache) gmt_M_memcpy (to->history, from->history, len, char);
+	}
+	if (from->E77) {
+		len = strlen (from->E77) + 1;
+		to->E77 = (to_cache) ? strdup (from->E77) : gmt_M_memory (GMT, NULL, len, char);
+		if (!to_cache) gmt_M_memcpy (to->E77, from->E77, len, char);
+	}
+	for (c = 0; c < 2; c++) {	/* The two parameter headers hold fixed-size text fields only */
+		to->mgd77[c] = (to_cache) ? calloc (1U, sizeof (struct MGD77_HEADER_PARAMS)) : gmt_M_memory (GMT, NULL, 1, struct MGD77_HEADER_PARAMS);
+		gmt_M_memcpy (to->mgd77[c], from->mgd77[c], 1, struct MGD77_HEADER_PARAMS);
+	}
+	for (c = 0; c < MGD77_N_SETS; c++) {	/* Column info strings are strdup'd in both directions (freed via gmt_M_str_free) */
+		for (id = 0; id < MGD77_SET_COLS; id++) {
+			if (from->info[c].col[id].abbrev)  to->info[c].col[id].abbrev  = strdup (from->info[c].col[id].abbrev);
+			if (from->info[c].col[id].name)    to->info[c].col[id].name    = strdup (from->info[c].col[id].name);
+			if (from->info[c].col[id].units)   to->info[c].col[id].units   = strdup (from->info[c].col[id].units);
+			if (from->info[c].col[id].comment) to->info[c].col[id].comment = strdup (from->info[c].col[id].comment);
+		}
+	}
+}
+
+static void mgd77_hcache_drop (struct MGD77_HCACHE_SLOT *S) {
+	/* Release one cache slot; all its allocations came from strdup/calloc */
+	int c;
+	gmt_M_str_free (S->path);
+	gmt_M_str_free (S->H.author);
+	gmt_M_str_free (S->H.history);
+	gmt_M_str_free (S->H.E77);
+	for (c = 0; c < 2; c++) gmt_M_str_free (S->H.mgd77[c]);
+	mgd77_free_plain_mgd77 (&S->H);
+	gmt_M_memset (S, 1, struct MGD77_HCACHE_SLOT);
+}
+
+static bool mgd77_hcache_fetch (struct GMT_CTRL *GMT, struct MGD77_CONTROL *F, struct MGD77_HEADER *H) {
+	/* Return true and fill H if we have a fresh parsed header for F->path */
+	int k;
+	struct stat buf;
+
+	if (stat (F->path, &buf)) return (false);	/* Inquiry about file failed somehow */
+	for (k = 0; k < MGD77_HCACHE_N; k++) {
+		if (!mgd77_hcache[k].path || strcmp (mgd77_hcache[k].path, F->path)) continue;
+		if (mgd77_hcache[k].mtime != buf.st_mtime) {	/* File was rewritten since we parsed it; discard stale entry */
+			mgd77_hcache_drop (&mgd77_hcache[k]);
+			return (false);
+		}
+		mgd77_hcache_dup (GMT, &mgd77_hcache[k].H, H, false);
+		F->nc_recid = mgd77_hcache[k].nc_recid;
+		mgd77_hcache[k].last_use = ++mgd77_hcache_counter;
+		GMT_Report (GMT->parent, GMT_MSG_DEBUG, "mgd77_hcache_fetch: Reusing parsed header for %s\n", F->path);
+		return (true);
+	}
+	return (false);
+}
+
+static void mgd77_hcache_store (struct GMT_CTRL *GMT, struct MGD77_CONTROL *F, struct MGD77_HEADER *H) {
+	/* Memoize the header just parsed from F->path, evicting the LRU entry if the cache is full */
+	int k, use;
+	struct stat buf;
+
+	if (stat (F->path, &buf)) return;	/* If we cannot stat the file we cannot detect staleness either */
+	for (k = 0; k < MGD77_HCACHE_N && mgd77_hcache[k].path; k++);	/* Find first free slot */
+	if (k == MGD77_HCACHE_N) {	/* Cache is full; evict the least recently used entry */
+		for (k = 1, use = 0; k < MGD77_HCACHE_N; k++) if (mgd77_hcache[k].last_use < mgd77_hcache[use].last_use) use = k;
+		mgd77_hcache_drop (&mgd77_hcache[use]);
+		k = use;
+	}
+	mgd77_hcache[k].path = strdup (F->path);
+	mgd77_hcache[k].mtime = buf.st_mtime;
+	mgd77_hcache[k].nc_recid = F->nc_recid;
+	mgd77_hcache[k].last_use = ++mgd77_hcache_counter;
+	mgd77_hcache_dup (GMT, H, &mgd77_hcache[k].H, true);
+}
+
 static int mgd77_read_header_record_cdf (struct GMT_CTRL *GMT, char *file, struct MGD77_CONTROL *F, struct MGD77_HEADER *H) {
 	/* Will read the entire 24-section header structure */
 	int n_vars, n_dims, dims[2] = {0, 0};
@@ -2323,6 +2430,9 @@ static int mgd77_read_header_record_cdf (struct GMT_CTRL *GMT, char *file, struc
 
 	gmt_M_memset (H, 1, struct MGD77_HEADER);	/* Initialize header */
 
+	if (mgd77_hcache_fetch (GMT, F, H))	/* Header for this cruise was parsed recently and the file is unchanged */
+		return (MGD77_Order_Columns (GMT, F, H));	/* Just organize the requested columns and we are done */
+
 	/* GET AUTHOR, HISTORY INFORMATION */
 
 	MGD77_nc_status (GMT, nc_inq_attlen (F->nc_id, NC_GLOBAL, "Author", count));		/* Get length of author */
@@ -2440,6 +2550,8 @@ static int mgd77_read_header_record_cdf (struct GMT_CTRL *GMT, char *file, struc
 	for (c = 0; c < MGD77_N_SETS; c++) H->info[c].n_col = (short)c_id[c];		/* Set the number of columns per set */
 	H->n_fields = H->info[MGD77_M77_SET].n_col + H->info[MGD77_CDF_SET].n_col;	/* Set total number of columns */
 
+	mgd77_hcache_store (GMT, F, H);	/* Memoize the parsed header for subsequent opens of this cruise */
+
 	if ((err = MGD77_Order_Columns (GMT, F, H)) != 0) return (err);	/* Make sure requested columns are OK; if not give set defaults */
 
 	return (MGD77_NO_ERROR); /* Success, unless failure! */
@@ -4292,6 +4404,8 @@ int MGD77_Get_Set (struct GMT_CTRL *GMT, char *word) {
 void MGD77_end (struct GMT_CTRL *GMT, struct MGD77_CONTROL *F) {
 	/* Free memory used by MGD77 machinery */
 	unsigned int i;
+	for (i = 0; i < MGD77_HCACHE_N; i++)	/* Release any memoized cruise headers */
+		if (mgd77_hcache[i].path) mgd77_hcache_drop (&mgd77_hcache[i]);
 	gmt_M_free (GMT, F->MGD77_HOME);
 	for (i = 0; i < F->n_MGD77_paths; i++)
 		gmt_M_free (GMT, F->MGD77_datadir[i]);
@@ -4965,7 +5079,15 @@ double MGD77_carter_correction (struct GMT_CTRL *GMT, double lon, double lat, do
   *
 *--------------------------------------------------------------------*/
 
-int MGD77_igrf10syn (struct GMT_CTRL *GMT, int isv, double date, int itype, double alt, double elong, double lat, double *out) {
+#define MGD77_IGRF_MAX_NC	195	/* Coefficients per epoch at the full truncation (nmx = 13) */
+
+static int mgd77_igrf_coeffs (struct GMT_CTRL *GMT, int isv, double date, double *g, int *kmx) {
+ /* Interpolate the IGRF spherical harmonic coefficients to the given epoch.  Fills
+  * g (at least MGD77_IGRF_MAX_NC long) and sets kmx to the matching truncation;
+  * returns MGD77_BAD_IGRFDATE for dates outside the valid range.  Split from the
+  * synthesis (mgd77_igrf_synth) so that batch evaluation can reuse one
+  * interpolation across all points sharing an epoch.  The description of the
+  * original combined routine follows: */
  /*     This is a synthesis routine for the 10th generation IGRF as agreed
   *     in December 2004 by IAGA Working Group V-MOD. It is valid 1900.0 to
   *     2010.0 inclusive. Values for dates from 1945.0 to 2000.0 inclusive are
@@ -5502,11 +5624,8 @@ int MGD77_igrf10syn (struct GMT_CTRL *GMT, int isv, double date, int itype, doub
              0.0,      0.0,      0.0,      0.0,      0.0,      0.0
 	 };
 
-	int i, j, k, l, m, n, ll, lm, kmx, nmx, nc;
-	double cd, cl[13], tc, ct, sd, fn = 0.0, gn = 0.0, fm, sl[13];
-	double rr, st, one, gmm, rho, two, three, ratio;
-	double p[105], q[105], r, t, a2, b2;
-	double H, F, X = 0, Y = 0, Z = 0, dec, dip;
+	int j, ll, nmx, nc;
+	double t, tc, one;
 
 	if (date < 1900.0 || date > 2025.0) {
 		GMT_Report (GMT->parent, GMT_MSG_ERROR, "Your date (%g) is outside valid extrapolated range for IGRF (1900-2025)\n", date);
@@ -5522,13 +5641,13 @@ int MGD77_igrf10syn (struct GMT_CTRL *GMT, int isv, double date, int itype, doub
 			nmx = 10;
 			nc = nmx * (nmx + 2);
 			ll = nc * ll;
-			kmx = (nmx + 1) * (nmx + 2) / 2;
+			*kmx = (nmx + 1) * (nmx + 2) / 2;
 		} else {
 			nmx = 13;
 			nc = nmx * (nmx + 2);
 			ll = (int) ((date - 1995.) * .2);
 			ll = nc * ll + 2280		/* 2280 (= 120*19), position of first coeff of 1995 */;
-			kmx = (nmx + 1) * (nmx + 2) / 2;
+			*kmx = (nmx + 1) * (nmx + 2) / 2;
 		}
 		tc = 1. - t;
 		if (isv == 1) {
@@ -5546,8 +5665,25 @@ int MGD77_igrf10syn (struct GMT_CTRL *GMT, int isv, double date, int itype, doub
 		ll = 3255;		/* nth position corresponding to first coeff of 2020 (must always point to pen-ultimate set) */
 		nmx = 13;
 		nc = nmx * (nmx + 2);
-		kmx = (nmx + 1) * (nmx + 2) / 2;
+		*kmx = (nmx + 1) * (nmx + 2) / 2;
 	}
+
+	for (j = 0; j < nc; j++)	/* Blend the two bracketing coefficient sets for this epoch */
+		g[j] = tc * gh[ll+j] + t * gh[ll+nc+j];
+
+	return (MGD77_NO_ERROR);
+}
+
+static void mgd77_igrf_synth (double *g, int kmx, int itype, double alt, double elong, double lat, double *out) {
+ /* Evaluate the geomagnetic field elements from coefficients already interpolated
+  * by mgd77_igrf_coeffs; see that function for the meaning of itype, alt and out.
+  * Keeps no shared state so concurrent calls are safe. */
+	int i, j, k, l, m, n;
+	double cd, cl[13], ct, sd, fn = 0.0, gn = 0.0, fm, sl[13];
+	double rr, st, one, gmm, rho, two, three, ratio;
+	double p[105], q[105], r, a2, b2;
+	double H, F, X = 0, Y = 0, Z = 0, dec, dip;
+
 	r = alt;
 	sincosd (90.0 - lat, &st, &ct);
 	sincosd (elong, &(sl[0]), &(cl[0]));
@@ -5611,15 +5747,14 @@ int MGD77_igrf10syn (struct GMT_CTRL *GMT, int isv, double date, int itype, doub
 
 		/* synthesis of x, y and z in geocentric coordinates */
 
-		lm = ll + l;
-		one = (tc * gh[lm-1] + t * gh[lm+nc-1]) * rr;
+		one = g[l-1] * rr;
 		if (m == 0) {
 			X += one * q[k-1];
 			Z -= (fn + 1.) * one * p[k-1];
 			l++;
 		}
 		else {
-			two = (tc * gh[lm] + t * gh[lm+nc]) * rr;
+			two = g[l] * rr;
 			three = one * cl[m-1] + two * sl[m - 1];
 			X += three * q[k-1];
 			Z -= (fn + 1.) * three * p[k-1];
@@ -5643,10 +5778,72 @@ int MGD77_igrf10syn (struct GMT_CTRL *GMT, int isv, double date, int itype, doub
 	out[2] = X;		out[3] = Y;
 	out[4] = Z;
 	out[5] = dec;		out[6] = dip;
+}
+
+int MGD77_igrf10syn (struct GMT_CTRL *GMT, int isv, double date, int itype, double alt, double elong, double lat, double *out) {
+ /* Single-point IGRF evaluation; see mgd77_igrf_coeffs above for the argument
+  * description and valid date range.  Deliberately kept free of cached state
+  * since e.g. grdgravmag3d calls it from concurrent threads; for long point
+  * streams use MGD77_igrf10syn_batch below which caches the interpolated
+  * coefficients per epoch and threads over the records. */
+	int kmx, error;
+	double g[MGD77_IGRF_MAX_NC];
+
+	if ((error = mgd77_igrf_coeffs (GMT, isv, date, g, &kmx)) != MGD77_NO_ERROR) return (error);
+	mgd77_igrf_synth (g, kmx, itype, alt, elong, lat, out);
 
 	return (MGD77_NO_ERROR);
 }
 
+int MGD77_igrf10syn_batch (struct GMT_CTRL *GMT, int isv, int itype, uint64_t n_pts, double *date, uint64_t n_dates, double *alt, uint64_t n_alts, double *lon, double *lat, double *out) {
+ /* Evaluate the IGRF at n_pts points, writing seven values per point to out in
+  * the same order as MGD77_igrf10syn.  date and alt may either hold one value
+  * per point or a single value applied to all points (n_dates or n_alts = 1,
+  * as in MGD77_cm4field).  Each thread caches its interpolated coefficients and
+  * only recomputes them when a record's epoch differs from the previous one, so
+  * cruises sorted in time interpolate once per distinct epoch.  Points with
+  * dates outside the IGRF range get all seven output values set to NaN; we
+  * return the number of such points (0 means all points were evaluated). */
+	openmp_int rec;
+	unsigned int n_threads = 1, tid = 0, k;
+	uint64_t n_bad = 0;
+	int *kmx = NULL;
+	double *g = NULL, *g_date = NULL;
+
+#ifdef _OPENMP
+	n_threads = omp_get_max_threads ();	/* One coefficient cache per thread */
+#endif
+	g = gmt_M_memory (GMT, NULL, (size_t)n_threads * MGD77_IGRF_MAX_NC, double);
+	g_date = gmt_M_memory (GMT, NULL, n_threads, double);
+	kmx = gmt_M_memory (GMT, NULL, n_threads, int);
+	for (k = 0; k < n_threads; k++) g_date[k] = -DBL_MAX;	/* No epoch interpolated yet */
+
+#ifdef _OPENMP
+#pragma omp parallel for private(rec,tid,k) shared(GMT,isv,itype,n_pts,date,n_dates,alt,n_alts,lon,lat,out,g,g_date,kmx) reduction(+:n_bad)
+#endif
+	for (rec = 0; rec < (openmp_int)n_pts; rec++) {
+		double this_date = (n_dates == 1) ? date[0] : date[rec];
+#ifdef _OPENMP
+		tid = (unsigned int)omp_get_thread_num ();
+#endif
+		if (this_date != g_date[tid]) {	/* New epoch for this thread; refresh the cached coefficients */
+			if (mgd77_igrf_coeffs (GMT, isv, this_date, &g[(size_t)tid*MGD77_IGRF_MAX_NC], &kmx[tid]) != MGD77_NO_ERROR) {
+				for (k = 0; k < 7; k++) out[(uint64_t)rec*7+k] = GMT->session.d_NaN;
+				n_bad++;
+				continue;
+			}
+			g_date[tid] = this_date;
+		}
+		mgd77_igrf_synth (&g[(size_t)tid*MGD77_IGRF_MAX_NC], kmx[tid], itype, (n_alts == 1) ? alt[0] : alt[rec], lon[rec], lat[rec], &out[(uint64_t)rec*7]);
+	}
+
+	gmt_M_free (GMT, g);
+	gmt_M_free (GMT, g_date);
+	gmt_M_free (GMT, kmx);
+
+	return ((int)n_bad);
+}
+
 void MGD77_IGF_text (struct GMTAPI_CTRL *API, int indent, int version) {
 	switch (version) {
 		case 1:	/* Heiskanen 1924 model */
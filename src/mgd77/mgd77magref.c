@@ -434,8 +434,9 @@ EXTERN_MSC int GMT_mgd77magref (void *V_API, int mode, void *args) {
 
 	size_t i, s, need = 0, n_alloc = 0;
 
-	double the_altitude, the_time, *time_array = NULL, *alt_array = NULL, *time_years = NULL, IGRF[7], out[GMT_MAX_COLUMNS];
+	double *time_array = NULL, *alt_array = NULL, *time_years = NULL, out[GMT_MAX_COLUMNS];
 	double *igrf_xyz = NULL;	/* Temporary storage for the joint_IGRF_CM4 case */
+	double *igrf_out = NULL, *geoc_alt = NULL;	/* Batch IGRF results and geocentric altitudes */
 
 	struct MGD77_CONTROL M;
 	struct MGD77MAGREF_CTRL *Ctrl = NULL;
@@ -613,6 +614,12 @@ EXTERN_MSC int GMT_mgd77magref (void *V_API, int mode, void *args) {
 
 				if (Ctrl->joint_IGRF_CM4)
 					igrf_xyz = gmt_M_memory (GMT, igrf_xyz, n_alloc * 3, double);
+
+				if (Ctrl->do_IGRF || Ctrl->joint_IGRF_CM4) {
+					igrf_out = gmt_M_memory (GMT, igrf_out, n_alloc * 7, double);
+					if (!Ctrl->CM4->CM4_G.geodetic && !Ctrl->A.fixed_alt)
+						geoc_alt = gmt_M_memory (GMT, geoc_alt, n_alloc, double);
+				}
 			}
 
 			if (!Ctrl->A.fixed_alt) {	/* Assign the alt_array to the provided altitude array */
@@ -640,23 +647,33 @@ EXTERN_MSC int GMT_mgd77magref (void *V_API, int mode, void *args) {
 			Ctrl->CM4->CM4_DATA.n_pts = (int)T->segment[s]->n_rows;
 			if (Ctrl->do_IGRF || Ctrl->joint_IGRF_CM4) {
 				int type;
+				uint64_t n_alts  = (Ctrl->A.fixed_alt)  ? 1 : T->segment[s]->n_rows;
+				uint64_t n_times = (Ctrl->A.fixed_time) ? 1 : T->segment[s]->n_rows;
+				double fixed_geoc_alt = 0.0, *igrf_alt = alt_array;
 				type = (Ctrl->CM4->CM4_G.geodetic) ? 1 : 2;
-				for (i = 0; i < T->segment[s]->n_rows; i++) {
-					the_altitude = (Ctrl->A.fixed_alt) ? alt_array[0] : alt_array[i];
-					the_time = (Ctrl->A.fixed_time) ? time_array[0] : time_array[i];
-					if (type == 2) the_altitude += 6371.2;
-					MGD77_igrf10syn (GMT, 0, the_time, type, the_altitude, T->segment[s]->data[GMT_X][i],
-							T->segment[s]->data[GMT_Y][i], IGRF);
-					if (!Ctrl->joint_IGRF_CM4) {		/* IGRF only */
-						int jj;
-						for (jj = 0; jj < Ctrl->CM4->CM4_F.n_field_components; jj++)
-							Ctrl->CM4->CM4_DATA.out_field[i*n_field_components+jj] = IGRF[Ctrl->CM4->CM4_F.field_components[jj]];
+				if (type == 2) {	/* Geocentric: altitudes must be distances from the Earth's center */
+					if (Ctrl->A.fixed_alt) {
+						fixed_geoc_alt = alt_array[0] + 6371.2;
+						igrf_alt = &fixed_geoc_alt;
 					}
-					else {				/* Store the IGRF x,y,z components for later use */
-						for (j = 0; j < 3; j++)
-							igrf_xyz[i*3+j] = IGRF[Ctrl->CM4->CM4_F.field_components[j]];
+					else {
+						for (i = 0; i < T->segment[s]->n_rows; i++) geoc_alt[i] = alt_array[i] + 6371.2;
+						igrf_alt = geoc_alt;
 					}
 				}
+				MGD77_igrf10syn_batch (GMT, 0, type, T->segment[s]->n_rows, time_array, n_times, igrf_alt, n_alts,
+						T->segment[s]->data[GMT_X], T->segment[s]->data[GMT_Y], igrf_out);
+				if (!Ctrl->joint_IGRF_CM4) {		/* IGRF only */
+					int jj;
+					for (i = 0; i < T->segment[s]->n_rows; i++)
+						for (jj = 0; jj < Ctrl->CM4->CM4_F.n_field_components; jj++)
+							Ctrl->CM4->CM4_DATA.out_field[i*n_field_components+jj] = igrf_out[i*7+Ctrl->CM4->CM4_F.field_components[jj]];
+				}
+				else {				/* Store the IGRF x,y,z components for later use */
+					for (i = 0; i < T->segment[s]->n_rows; i++)
+						for (j = 0; j < 3; j++)
+							igrf_xyz[i*3+j] = igrf_out[i*7+Ctrl->CM4->CM4_F.field_components[j]];
+				}
 			}
 
 			if (Ctrl->do_CM4) {				/* DO CM4 only. Eval CM4 at all points */
@@ -713,6 +730,8 @@ EXTERN_MSC int GMT_mgd77magref (void *V_API, int mode, void *args) {
 	gmt_M_free (GMT, Ctrl->CM4->CM4_DATA.out_field);
 	if (!(Ctrl->A.years || Ctrl->A.fixed_time)) gmt_M_free (GMT, time_years);
 	if (Ctrl->joint_IGRF_CM4) gmt_M_free (GMT, igrf_xyz);
+	gmt_M_free (GMT, igrf_out);
+	gmt_M_free (GMT, geoc_alt);
 
 	MGD77_end (GMT, &M);
 
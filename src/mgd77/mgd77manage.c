@@ -908,7 +908,7 @@ EXTERN_MSC int GMT_mgd77manage (void *V_API, int mode, void *args) {
 
 		if (c_kind == ADD_IGRF) {	/* Append IGRF column */
 			int ix, iy, it;
-			double date, *xvar = NULL, *yvar = NULL, *tvar = NULL, IGRF[7];
+			double sea_level = 0.0, *xvar = NULL, *yvar = NULL, *tvar = NULL, *date = NULL, *igrf = NULL;
 
 			if ((ix = mgd77manage_skip_if_missing (GMT, "lon",  list[argno], &In, &D)) == MGD77_NOT_SET) continue;
 			if ((iy = mgd77manage_skip_if_missing (GMT, "lat",  list[argno], &In, &D)) == MGD77_NOT_SET) continue;
@@ -918,12 +918,18 @@ EXTERN_MSC int GMT_mgd77manage (void *V_API, int mode, void *args) {
 			yvar = D->values[iy];
 			tvar = D->values[it];
 			colvalue = gmt_M_memory (GMT, NULL, D->H.n_records, double);
+			date = gmt_M_memory (GMT, NULL, D->H.n_records, double);
+			igrf = gmt_M_memory (GMT, NULL, D->H.n_records * 7, double);
 
+			for (rec = 0; rec < D->H.n_records; rec++)
+				date[rec] = MGD77_time_to_fyear (GMT, &In, tvar[rec]);	/* Get date as decimal year */
+			MGD77_igrf10syn_batch (GMT, 0, 1, D->H.n_records, date, D->H.n_records, &sea_level, 1, xvar, yvar, igrf);
 			for (rec = n_sampled = 0; rec < D->H.n_records; rec++) {
-				date = MGD77_time_to_fyear (GMT, &In, tvar[rec]);	/* Get date as decimal year */
-				colvalue[rec] = (MGD77_igrf10syn (GMT, 0, date, 1, 0.0, xvar[rec], yvar[rec], IGRF)) ? GMT->session.d_NaN : IGRF[MGD77_IGRF_F];
+				colvalue[rec] = igrf[rec*7+MGD77_IGRF_F];	/* NaN if the date fell outside the IGRF range */
 				n_sampled++;
 			}
+			gmt_M_free (GMT, date);
+			gmt_M_free (GMT, igrf);
 			GMT_Report (API, GMT_MSG_INFORMATION, "Estimated IGRF at %d locations out of %d for cruise %s\n", n_sampled, D->H.n_records, list[argno]);
 		}
 		else if (c_kind == ADD_GRAV) {	/* Append IGF column */
@@ -968,7 +974,7 @@ EXTERN_MSC int GMT_mgd77manage (void *V_API, int mode, void *args) {
 		}
 		else if (c_kind == ADD_RMAG) {	/* Append recomputed residual mag column */
 			int ix, iy, it, im;
-			double date, *xvar = NULL, *yvar = NULL, *tvar = NULL, *mvar = NULL, IGRF[7];
+			double sea_level = 0.0, *xvar = NULL, *yvar = NULL, *tvar = NULL, *mvar = NULL, *date = NULL, *igrf = NULL;
 			char field[5] = {""};
 
 			if ((ix = mgd77manage_skip_if_missing (GMT, "lon",  list[argno], &In, &D)) == MGD77_NOT_SET) continue;
@@ -982,13 +988,19 @@ EXTERN_MSC int GMT_mgd77manage (void *V_API, int mode, void *args) {
 			tvar = D->values[it];
 			mvar = D->values[im];
 			colvalue = gmt_M_memory (GMT, NULL, D->H.n_records, double);
+			date = gmt_M_memory (GMT, NULL, D->H.n_records, double);
+			igrf = gmt_M_memory (GMT, NULL, D->H.n_records * 7, double);
 
+			for (rec = 0; rec < D->H.n_records; rec++)
+				date[rec] = MGD77_time_to_fyear (GMT, &In, tvar[rec]);	/* Get date as decimal year */
+			check = MGD77_igrf10syn_batch (GMT, 0, 1, D->H.n_records, date, D->H.n_records, &sea_level, 1, xvar, yvar, igrf);
+			if (check) GMT_Report (API, GMT_MSG_WARNING, "%d records had dates outside the IGRF range for cruise %s\n", check, list[argno]);
 			for (rec = n_sampled = 0; rec < D->H.n_records; rec++) {
-				date = MGD77_time_to_fyear (GMT, &In, tvar[rec]);	/* Get date as decimal year */
-				check = MGD77_igrf10syn (GMT, 0, date, 1, 0.0, xvar[rec], yvar[rec], IGRF);
-				colvalue[rec] = (check) ? GMT->session.d_NaN : mvar[rec] - IGRF[MGD77_IGRF_F];
+				colvalue[rec] = mvar[rec] - igrf[rec*7+MGD77_IGRF_F];	/* NaN if the date fell outside the IGRF range */
 				n_sampled++;
 			}
+			gmt_M_free (GMT, date);
+			gmt_M_free (GMT, igrf);
 			GMT_Report (API, GMT_MSG_INFORMATION, "Estimated recomputed magnetic anomaly at %d locations out of %d for cruise %s\n",
 			            n_sampled, D->H.n_records, list[argno]);
 		}
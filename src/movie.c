@@ -112,6 +112,8 @@
 #define MOVIE_WAIT_TO_CHECK	10000	/* In microseconds, so 0.01 seconds */
 #define MOVIE_PAUSE_A_SEC	1000000	/* In microseconds, so 1 seconds */
 
+#define MOVIE_BATCH_MAX		32	/* Most frames we assign to a single batch job */
+
 #define MOVIE_RASTER_EXTENSION	"png"	/* Fixed raster format extension */
 #define MOVIE_DEBUG_FORMAT	",ps"	/* Comma is intentional since we append to a list of formats */
 
@@ -277,6 +279,7 @@ struct MOVIE_STATUS {
 	/* Used to monitor the start, running, and completion of frame jobs running in parallel */
 	bool started;	/* true if frame job has started */
 	bool completed;	/* true if PNG has been successfully produced */
+	bool last_in_batch;	/* true if this is the final frame of a launched batch job */
 };
 
 static void *New_Ctrl (struct GMT_CTRL *GMT) {	/* Allocate and initialize a new control structure */
@@ -1389,6 +1392,7 @@ EXTERN_MSC int GMT_movie (void *V_API, int mode, void *args) {
 
 	unsigned int n_values = 0, n_frames = 0, n_data_frames, first_fade_out_frame = 0, frame, i_frame, col, p_width, p_height, k, T;
 	unsigned int n_frames_not_started = 0, n_frames_completed = 0, first_i_frame = 0, data_frame, n_cores_unused, n_fade_frames = 0;
+	unsigned int n_workers, batch;
 	unsigned int dd, hh, mm, ss, start, flavor[2] = {0, 0};
 
 	bool done = false, layers = false, one_frame = false, upper_case[2] = {false, false}, has_conf = false;
@@ -1405,6 +1409,7 @@ EXTERN_MSC int GMT_movie (void *V_API, int mode, void *args) {
 	char string[GMT_LEN128] = {""}, extra[GMT_BUFSIZ] = {""}, cmd[PATH_MAX] = {""}, cleanup_file[PATH_MAX] = {""}, L_txt[GMT_LEN128] = {""};
 	char png_file[PATH_MAX] = {""}, topdir[PATH_MAX] = {""}, workdir[PATH_MAX] = {""}, datadir[PATH_MAX] = {""}, frame_products[GMT_LEN32] = {""};
 	char intro_file[PATH_MAX] = {""}, conf_file[PATH_MAX], tmpwpath[PATH_MAX] = {""}, *script_file =  NULL, which[2] = {"LP"}, spacer, dir_sep;
+	char batch_file[PATH_MAX] = {""};
 	char audio_option[PATH_MAX] = {""};
 
 	double percent = 0.0, L_col = 0, sx, sy, fade_level = 0.0, audio_stretch = 0.0, dpu;
@@ -2605,33 +2610,81 @@ EXTERN_MSC int GMT_movie (void *V_API, int mode, void *args) {
 
 	i_frame = first_i_frame = 0; n_frames_not_started = n_frames;
 	frame = Ctrl->T.start_frame;
-	n_cores_unused = MAX (1, Ctrl->x.n_threads - 1);			/* Remove one for the main movie module thread */
+	n_workers = n_cores_unused = MAX (1, Ctrl->x.n_threads - 1);		/* Remove one for the main movie module thread */
 	status = gmt_M_memory (GMT, NULL, n_frames, struct MOVIE_STATUS);	/* Used to keep track of frame status */
 	if (Ctrl->E.active) script_file = intro_file; else script_file = main_file;
+	/* Rather than launching one shell job per frame we hand each job a contiguous batch of frames which it runs
+	 * sequentially via a small runner script.  Batch sizes follow a guided schedule: large up front to amortize the
+	 * per-job launch overhead, shrinking to single frames near the end so straggling jobs cannot idle the cores. */
+	sprintf (batch_file, "movie_batch.%s", extension[Ctrl->In.mode]);
+	GMT_Report (API, GMT_MSG_INFORMATION, "Create batch runner script %s\n", batch_file);
+	if ((fp = fopen (batch_file, "w")) == NULL) {
+		GMT_Report (API, GMT_MSG_ERROR, "Unable to create batch runner script %s - exiting\n", batch_file);
+		error = GMT_ERROR_ON_FOPEN;
+		goto out_of_here;
+	}
+	gmt_set_script (fp, Ctrl->In.mode);	/* Write 1st line of a script */
+	gmt_set_comment (fp, Ctrl->In.mode, "Batch runner: Run the frame script (arg 1) for each frame from arg 2 through arg 3");
+	switch (Ctrl->In.mode) {
+		case GMT_BASH_MODE:
+			fprintf (fp, "f=$2\n");
+			fprintf (fp, "while [ $f -le $3 ]; do\n");
+			fprintf (fp, "\t%s $1 `printf %%0%dd $f`\n", sys_cmd_wait[Ctrl->In.mode], precision);
+			fprintf (fp, "\tf=`expr $f + 1`\n");
+			fprintf (fp, "done\n");
+			break;
+		case GMT_CSH_MODE:
+			fprintf (fp, "@ f = $2\n");
+			fprintf (fp, "while ($f <= $3)\n");
+			fprintf (fp, "\t%s $1 `printf %%0%dd $f`\n", sys_cmd_wait[Ctrl->In.mode], precision);
+			fprintf (fp, "\t@ f = $f + 1\n");
+			fprintf (fp, "end\n");
+			break;
+		case GMT_DOS_MODE:
+			fprintf (fp, "setlocal enabledelayedexpansion\n");
+			fprintf (fp, "for /L %%%%f in (%%2,1,%%3) do (\n");
+			fprintf (fp, "\tset \"F=%.*d%%%%f\"\n", precision, 0);	/* Zero-pad the frame number to the movie tag width */
+			fprintf (fp, "\t%s %%1 !F:~-%d!\n", sys_cmd_wait[Ctrl->In.mode], precision);
+			fprintf (fp, ")\n");
+			break;
+	}
+	fclose (fp);	/* Done writing the batch runner script */
+#ifndef WIN32	/* Set executable bit if not Windows cmd */
+	if (chmod (batch_file, S_IRWXU)) {
+		GMT_Report (API, GMT_MSG_ERROR, "Unable to make batch runner script %s executable - exiting.\n", batch_file);
+		error = GMT_RUNTIME_ERROR;
+		goto out_of_here;
+	}
+#endif
 	GMT_Report (API, GMT_MSG_INFORMATION, "Build frames using %u cores\n", n_cores_unused);
 	/* START PARALLEL EXECUTION OF FRAME SCRIPTS */
 	GMT_Report (API, GMT_MSG_INFORMATION, "Execute movie frame scripts in parallel\n");
 	while (!done) {	/* Keep running jobs until all frames have completed */
-		while (n_frames_not_started && n_cores_unused) {	/* Launch new jobs if possible */
+		while (n_frames_not_started && n_cores_unused) {	/* Launch new batch jobs if possible */
+			batch = MAX (1, n_frames_not_started / (2 * n_workers));	/* Guided schedule: half the remaining work spread across the workers */
+			if (batch > MOVIE_BATCH_MAX) batch = MOVIE_BATCH_MAX;
+			if (Ctrl->E.active && frame < Ctrl->E.duration && (frame + batch) > Ctrl->E.duration)
+				batch = Ctrl->E.duration - frame;	/* A batch cannot mix title and main frames since they use different scripts */
 #ifdef WIN32
 			if (Ctrl->In.mode < 2)		/* A bash or csh run from Windows. Need to call via "start" to get parallel */
-				sprintf (cmd, "start /B %s %s %*.*d", sys_cmd_nowait[Ctrl->In.mode], script_file, precision, precision, frame);
+				sprintf (cmd, "start /B %s %s %s %d %d", sys_cmd_nowait[Ctrl->In.mode], batch_file, script_file, frame, frame + batch - 1);
 			else						/* Running batch, so no need for the above trick */
-				sprintf (cmd, "%s %s %*.*d &", sys_cmd_nowait[Ctrl->In.mode], script_file, precision, precision, frame);
+				sprintf (cmd, "%s %s %s %d %d &", sys_cmd_nowait[Ctrl->In.mode], batch_file, script_file, frame, frame + batch - 1);
 #else		/* Regular Linux/macOS shell behavior */
-			sprintf (cmd, "%s %s %*.*d &", sys_cmd_nowait[Ctrl->In.mode], script_file, precision, precision, frame);
+			sprintf (cmd, "%s %s %s %d %d &", sys_cmd_nowait[Ctrl->In.mode], batch_file, script_file, frame, frame + batch - 1);
 #endif
 
-			GMT_Report (API, GMT_MSG_DEBUG, "Launch script for frame %*.*d\n", precision, precision, frame);
+			GMT_Report (API, GMT_MSG_DEBUG, "Launch script for frames %*.*d to %*.*d\n", precision, precision, frame, precision, precision, frame + batch - 1);
 			if ((error = system (cmd))) {
 				GMT_Report (API, GMT_MSG_ERROR, "Running script %s returned error %d - aborting.\n", cmd, error);
 				error = GMT_RUNTIME_ERROR;
 				goto out_of_here;
 			}
-			status[i_frame].started = true;	/* We have now launched this frame job */
-			frame++;			/* Advance to next frame for next launch */
-			i_frame++;			/* Advance to next frame for next launch */
-			n_frames_not_started--;		/* One less frame remaining */
+			for (T = 0; T < batch; T++) status[i_frame+T].started = true;	/* We have now launched these frame jobs */
+			status[i_frame+batch-1].last_in_batch = true;	/* Completing this frame means the job (and its core) is done */
+			frame += batch;			/* Advance to next frame for next launch */
+			i_frame += batch;		/* Advance to next frame for next launch */
+			n_frames_not_started -= batch;	/* Fewer frames remaining */
 			n_cores_unused--;		/* This core is now busy */
 			if (Ctrl->E.active && frame == Ctrl->E.duration)	/* Past the title intro, now point to main script */
 				script_file = main_file;
@@ -2645,7 +2698,7 @@ EXTERN_MSC int GMT_movie (void *V_API, int mode, void *args) {
 			if (access (png_file, F_OK)) continue;	/* Not found yet */
 			n_frames_completed++;		/* One more frame completed */
 			status[k].completed = true;	/* Flag this frame as completed */
-			n_cores_unused++;		/* Free up the core */
+			if (status[k].last_in_batch) n_cores_unused++;	/* Last frame of its batch, so that core is free again */
 			percent = 100.0 * n_frames_completed / n_frames;
 			GMT_Report (API, GMT_MSG_INFORMATION, "Frame %*.*d of %d completed [%5.1f %%]\n", precision, precision, k+1, n_frames, percent);
 		}
@@ -2806,6 +2859,8 @@ EXTERN_MSC int GMT_movie (void *V_API, int mode, void *args) {
 			fprintf (fp, "%s %s%c%s\n", rmfile[Ctrl->In.mode], tmpwpath, dir_sep, post_file);
 		fprintf (fp, "%s %s%c%s\n", rmfile[Ctrl->In.mode], tmpwpath, dir_sep, init_file);	/* Delete the init script */
 		fprintf (fp, "%s %s%c%s\n", rmfile[Ctrl->In.mode], tmpwpath, dir_sep, main_file);	/* Delete the main script */
+		if (batch_file[0])	/* Remove the batch runner script */
+			fprintf (fp, "%s %s%c%s\n", rmfile[Ctrl->In.mode], tmpwpath, dir_sep, batch_file);
 		if (layers)
 			fprintf (fp, "%s %s%c*.ps\n", rmfile[Ctrl->In.mode], tmpwpath, dir_sep);	/* Delete any PostScript layers */
 	}
@@ -79,7 +79,7 @@ struct NEARNEIGHBOR_NODE {	/* Structure with point id and distance pairs for all
 };
 
 struct NEARNEIGHBOR_POINT {	/* Structure with input data constraints */
-	gmt_grdfloat x, y, z, w;
+	gmt_grdfloat z, w;	/* The coordinates are kept in separate arrays since only the bin index needs them */
 };
 
 static void *New_Ctrl (struct GMT_CTRL *GMT) {	/* Allocate and initialize a new control structure */
@@ -127,6 +127,98 @@ GMT_LOCAL void nearneighbor_free_node (struct GMT_CTRL *GMT, struct NEARNEIGHBOR
 	gmt_M_free (GMT, node);
 }
 
+GMT_LOCAL void nearneighbor_grid_via_index (struct GMT_CTRL *GMT, struct NEARNEIGHBOR_CTRL *Ctrl, struct GMT_GRID *Grid, struct GMT_POINT_BIN *PB, double *xp, double *yp, struct NEARNEIGHBOR_POINT *point, double *x0, double *y0, openmp_int *d_col, openmp_int d_row, uint64_t *n_set, uint64_t *n_almost, uint64_t *n_none) {
+	/* Node-centered gridding used when the grid has no periodic boundaries: instead of scanning the node
+	 * neighborhood of every input point we visit each output node once and query the bin index for the
+	 * points that can lie within the search radius.  Every node is independent of the others so the rows
+	 * can be processed in parallel; we just need per-sector scratch arrays for each thread. */
+	openmp_int rowu;
+	unsigned int n_threads = 1;
+	uint64_t nset = 0, nalmost = 0, nnone = 0;
+	double factor = Ctrl->N.sectors / (2.0 * M_PI);
+	double three_over_radius = 3.0 / Ctrl->S.radius;
+	double *all_dist = NULL;
+	int64_t *all_id = NULL;
+
+	if (PB == NULL) {	/* No points survived the domain test so all nodes are empty */
+		openmp_int colu;
+		uint64_t ij;
+		gmt_M_grd_loop (GMT, Grid, rowu, colu, ij) Grid->data[ij] = (gmt_grdfloat)Ctrl->E.value;
+		*n_none += Grid->header->nm;
+		return;
+	}
+#ifdef _OPENMP
+	n_threads = omp_get_max_threads ();
+#endif
+	all_dist = gmt_M_memory (GMT, NULL, (size_t)n_threads * Ctrl->N.sectors, double);
+	all_id   = gmt_M_memory (GMT, NULL, (size_t)n_threads * Ctrl->N.sectors, int64_t);
+#ifdef _OPENMP
+#pragma omp parallel for private(rowu) shared(GMT,Ctrl,Grid,PB,xp,yp,point,x0,y0,d_col,d_row,all_dist,all_id,factor,three_over_radius) reduction(+:nset,nalmost,nnone)
+#endif
+	for (rowu = 0; rowu < (openmp_int)Grid->header->n_rows; rowu++) {
+		unsigned int k, sector, n_filled;
+		openmp_int colu;
+		int64_t brow, bcol;
+		uint64_t ij, b, q, id;
+		double distance, dx, dy, delta, weight, weight_sum, grd_sum;
+		double *best_dist = all_dist;
+		int64_t *best_id = all_id;
+#ifdef _OPENMP
+		best_dist = &all_dist[(size_t)omp_get_thread_num () * Ctrl->N.sectors];
+		best_id   = &all_id[(size_t)omp_get_thread_num () * Ctrl->N.sectors];
+#endif
+		for (colu = 0; colu < (openmp_int)Grid->header->n_columns; colu++) {
+			for (k = 0; k < Ctrl->N.sectors; k++) best_id[k] = GMT_NOTSET;
+			/* The halo is one ring wider than the search half-widths so this bin window cannot leave the bin matrix */
+			for (brow = rowu - d_row + PB->halo_row; brow <= rowu + d_row + PB->halo_row; brow++) {
+				for (bcol = colu - d_col[rowu] + PB->halo_col; bcol <= colu + d_col[rowu] + PB->halo_col; bcol++) {
+					b = (uint64_t)brow * PB->n_bin_cols + bcol;
+					for (q = PB->start[b]; q < PB->start[b+1]; q++) {	/* Visit the points binned here */
+						id = PB->ids[q];
+						if (gmt_distance_exceeds (GMT, x0[colu], y0[rowu], xp[id], yp[id], Ctrl->S.radius)) continue;	/* Data constraint is too far from this node */
+						distance = gmt_distance (GMT, x0[colu], y0[rowu], xp[id], yp[id]);
+						dx = xp[id] - x0[colu];	dy = yp[id] - y0[rowu];
+						sector = urint (floor (((d_atan2 (dy, dx) + M_PI) * factor))) % Ctrl->N.sectors;
+						if (best_id[sector] == GMT_NOTSET || distance < best_dist[sector] || (distance == best_dist[sector] && (int64_t)id < best_id[sector])) {
+							best_dist[sector] = distance;
+							best_id[sector] = (int64_t)id;
+						}
+					}
+				}
+			}
+			ij = gmt_M_ijp (Grid->header, rowu, colu);
+			for (k = n_filled = 0; k < Ctrl->N.sectors; k++)
+				if (best_id[k] >= 0) n_filled++;
+			if (n_filled == 0) {	/* No nearest neighbors, set to empty and goto next node */
+				nnone++;
+				Grid->data[ij] = (gmt_grdfloat)Ctrl->E.value;
+				continue;
+			}
+			if (n_filled < Ctrl->N.min_sectors) { 	/* Not minimum set of neighbors in all sectors, set to empty and goto next node */
+				nalmost++;
+				Grid->data[ij] = (gmt_grdfloat)Ctrl->E.value;
+				continue;
+			}
+
+			/* OK, here we have enough data and need to calculate the weighted value */
+
+			nset++;
+			weight_sum = grd_sum = 0.0;	/* Initialize sums */
+			for (k = 0; k < Ctrl->N.sectors; k++) {
+				if (best_id[k] < 0) continue;
+				delta = three_over_radius * best_dist[k];
+				weight = 1.0 / (1.0 + delta * delta);	/* This is distance weight */
+				if (Ctrl->W.active) weight *= point[best_id[k]].w;	/* This is observation weight */
+				grd_sum += weight * point[best_id[k]].z;
+				weight_sum += weight;
+			}
+			Grid->data[ij] = (gmt_grdfloat)(grd_sum / weight_sum);
+		}
+	}
+	gmt_M_free (GMT, all_dist);	gmt_M_free (GMT, all_id);
+	*n_set += nset;	*n_almost += nalmost;	*n_none += nnone;
+}
+
 static int usage (struct GMTAPI_CTRL *API, int level) {
 	const char *name = gmt_show_name_and_purpose (API, THIS_MODULE_LIB, THIS_MODULE_CLASSIC_NAME, THIS_MODULE_PURPOSE);
 	if (level == GMT_MODULE_PURPOSE) return (GMT_NOERROR);
@@ -288,7 +380,7 @@ EXTERN_MSC int GMT_nearneighbor (void *V_API, int mode, void *args) {
 	openmp_int rowu, colu, max_d_col, d_row, *d_col = NULL;
 	int col_0, row_0, row, col, row_end, col_end, ii, jj, error = 0;
 	unsigned int k, sector, y_wrap, x_wrap;
-	bool wrap_180, replicate_x, replicate_y;
+	bool wrap_180, replicate_x, replicate_y, build_index;
 	size_t n_alloc = GMT_INITIAL_MEM_ROW_ALLOC;
 
 	uint64_t ij, ij0, kk, n, n_read, n_almost, n_none, n_set, n_filled;
@@ -296,8 +388,9 @@ EXTERN_MSC int GMT_nearneighbor (void *V_API, int mode, void *args) {
 	double weight, weight_sum, grd_sum, dx, dy, delta, distance = 0.0;
 	double x_left, x_right, y_top, y_bottom, factor, three_over_radius;
 	double half_y_width, y_width, half_x_width, x_width;
-	double *x0 = NULL, *y0 = NULL, *in = NULL;
+	double *x0 = NULL, *y0 = NULL, *xp = NULL, *yp = NULL, *in = NULL;
 
+	struct GMT_POINT_BIN *PB = NULL;
 	struct GMT_GRID *Grid = NULL;
 	struct GMT_GRID_HEADER_HIDDEN *HH = NULL;
 	struct GMT_RECORD *In = NULL;
@@ -397,10 +490,15 @@ EXTERN_MSC int GMT_nearneighbor (void *V_API, int mode, void *args) {
 	replicate_y = (HH->nyp && Grid->header->registration == GMT_GRID_NODE_REG);	/* Gridline registration has duplicate row */
 	x_wrap = Grid->header->n_columns - 1;				/* Add to node index to go to right column */
 	y_wrap = (Grid->header->n_rows - 1) * Grid->header->n_columns;	/* Add to node index to go to bottom row */
+	build_index = (HH->nxp == 0 && HH->nyp == 0);	/* Without periodic boundaries to wrap we can bin the points and grid node-by-node instead */
+	if (build_index) {	/* Must keep the point coordinates so we can build the bin index once reading is done */
+		xp = gmt_M_memory (GMT, NULL, n_alloc, double);
+		yp = gmt_M_memory (GMT, NULL, n_alloc, double);
+	}
 	GMT_Report (API, GMT_MSG_INFORMATION, "Processing input table data\n");
 	if (GMT_Begin_IO (API, GMT_IS_DATASET, GMT_IN, GMT_HEADER_ON) != GMT_NOERROR) {	/* Enables data input and sets access mode */
 		gmt_M_free (GMT, x0);		gmt_M_free (GMT, y0);		gmt_M_free (GMT, grid_node);
-		gmt_M_free (GMT, point);	gmt_M_free (GMT, d_col);
+		gmt_M_free (GMT, point);	gmt_M_free (GMT, d_col);	gmt_M_free (GMT, xp);	gmt_M_free (GMT, yp);
 		Return (API->error);
 	}
 
@@ -409,7 +507,7 @@ EXTERN_MSC int GMT_nearneighbor (void *V_API, int mode, void *args) {
 		if ((In = GMT_Get_Record (API, GMT_READ_DATA, NULL)) == NULL) {	/* Read next record, get NULL if special case */
 			if (gmt_M_rec_is_error (GMT)) {		/* Bail if there are any read errors */
 				gmt_M_free (GMT, x0);		gmt_M_free (GMT, y0);		gmt_M_free (GMT, grid_node);
-				gmt_M_free (GMT, point);	gmt_M_free (GMT, d_col);
+				gmt_M_free (GMT, point);	gmt_M_free (GMT, d_col);	gmt_M_free (GMT, xp);	gmt_M_free (GMT, yp);
 				Return (GMT_RUNTIME_ERROR);
 			}
 			else if (gmt_M_rec_is_eof (GMT)) 		/* Reached end of file */
@@ -431,69 +529,71 @@ EXTERN_MSC int GMT_nearneighbor (void *V_API, int mode, void *args) {
 
 		/* Store this point in memory */
 
-		point[n].x = (gmt_grdfloat)in[GMT_X];
-		point[n].y = (gmt_grdfloat)in[GMT_Y];
 		point[n].z = (gmt_grdfloat)in[GMT_Z];
 		if (Ctrl->W.active) point[n].w = (gmt_grdfloat)in[3];
 
-		/* Find row/col indices of the node closest to this data point.  Note: These may be negative */
-
-		col_0 = (int)gmt_M_grd_x_to_col (GMT, in[GMT_X], Grid->header);
-		row_0 = (int)gmt_M_grd_y_to_row (GMT, in[GMT_Y], Grid->header);
-
-		/* Loop over all nodes within radius of this node */
-
-		row_end = row_0 + (int)d_row;
-		for (row = row_0 - (int)d_row; row <= row_end; row++) {
-
-			jj = row;
-			if (gmt_y_out_of_bounds (GMT, &jj, Grid->header, &wrap_180)) continue;	/* Outside y-range.  This call must happen BEFORE gmt_x_out_of_bounds as it sets wrap_180 */
-			rowu = (openmp_int)jj;
-			col_end = col_0 + (int)d_col[jj];
-			for (col = col_0 - (int)d_col[jj]; col <= col_end; col++) {
-
-				ii = col;
-				if (gmt_x_out_of_bounds (GMT, &ii, Grid->header, wrap_180)) continue;	/* Outside x-range,  This call must happen AFTER gmt_y_out_of_bounds which sets wrap_180 */
-
-				/* Here, (ii,jj) [both are >= 0] is index of a node (kk) inside the grid */
-				colu = (openmp_int)ii;
-
-				distance = gmt_distance (GMT, x0[colu], y0[rowu], in[GMT_X], in[GMT_Y]);
-
-				if (distance > Ctrl->S.radius) continue;	/* Data constraint is too far from this node */
-				kk = gmt_M_ij0 (Grid->header, rowu, colu);	/* No padding used for gridnode array */
-				dx = in[GMT_X] - x0[colu];	dy = in[GMT_Y] - y0[rowu];
-
-				/* Check for wrap-around in x or y.  This should only occur if the
-				   search radius is larger than 1/2 the grid width/height so that
-				   the shortest distance is going through the periodic boundary.
-				   For longitudes the dx obviously cannot exceed 180 (half_x_width)
-				   since we could then go the other direction instead.
-				*/
-				if (HH->nxp && fabs (dx) > half_x_width) dx -= copysign (x_width, dx);
-				if (HH->nyp && fabs (dy) > half_y_width) dy -= copysign (y_width, dy);
-
-				/* OK, this point should constrain this node.  Calculate which sector and assign the value */
-
-				sector = urint (floor (((d_atan2 (dy, dx) + M_PI) * factor))) % Ctrl->N.sectors;
-				nearneighbor_assign_node (GMT, &grid_node[kk], Ctrl->N.sectors, sector, distance, n);
-
-				/* With periodic, gridline-registered grids there are duplicate rows and/or columns
-				   so we may have to assign the point to more than one node.  The next section deals
-				   with this situation.
-				*/
-
-				if (replicate_x) {	/* Must check if we have to replicate a column */
-					if (colu == 0) 	/* Must replicate left to right column */
-						nearneighbor_assign_node (GMT, &grid_node[kk+x_wrap], Ctrl->N.sectors, sector, distance, n);
-					else if (colu == (openmp_int)HH->nxp)	/* Must replicate right to left column */
-						nearneighbor_assign_node (GMT, &grid_node[kk-x_wrap], Ctrl->N.sectors, sector, distance, n);
-				}
-				if (replicate_y) {	/* Must check if we have to replicate a row */
-					if (rowu == 0)	/* Must replicate top to bottom row */
-						nearneighbor_assign_node (GMT, &grid_node[kk+y_wrap], Ctrl->N.sectors, sector, distance, n);
-					else if (rowu == (openmp_int)HH->nyp)	/* Must replicate bottom to top row */
-						nearneighbor_assign_node (GMT, &grid_node[kk-y_wrap], Ctrl->N.sectors, sector, distance, n);
+		if (build_index) {	/* Defer all neighbor assignments to the node-centered pass; just keep the point coordinates */
+			xp[n] = in[GMT_X];	yp[n] = in[GMT_Y];
+		}
+		else {	/* Assign this point to all nodes within the search radius as we read */
+			/* Find row/col indices of the node closest to this data point.  Note: These may be negative */
+
+			col_0 = (int)gmt_M_grd_x_to_col (GMT, in[GMT_X], Grid->header);
+			row_0 = (int)gmt_M_grd_y_to_row (GMT, in[GMT_Y], Grid->header);
+
+			/* Loop over all nodes within radius of this node */
+
+			row_end = row_0 + (int)d_row;
+			for (row = row_0 - (int)d_row; row <= row_end; row++) {
+
+				jj = row;
+				if (gmt_y_out_of_bounds (GMT, &jj, Grid->header, &wrap_180)) continue;	/* Outside y-range.  This call must happen BEFORE gmt_x_out_of_bounds as it sets wrap_180 */
+				rowu = (openmp_int)jj;
+				col_end = col_0 + (int)d_col[jj];
+				for (col = col_0 - (int)d_col[jj]; col <= col_end; col++) {
+
+					ii = col;
+					if (gmt_x_out_of_bounds (GMT, &ii, Grid->header, wrap_180)) continue;	/* Outside x-range,  This call must happen AFTER gmt_y_out_of_bounds which sets wrap_180 */
+
+					/* Here, (ii,jj) [both are >= 0] is index of a node (kk) inside the grid */
+					colu = (openmp_int)ii;
+
+					if (gmt_distance_exceeds (GMT, x0[colu], y0[rowu], in[GMT_X], in[GMT_Y], Ctrl->S.radius)) continue;	/* Data constraint is too far from this node */
+					distance = gmt_distance (GMT, x0[colu], y0[rowu], in[GMT_X], in[GMT_Y]);
+					kk = gmt_M_ij0 (Grid->header, rowu, colu);	/* No padding used for gridnode array */
+					dx = in[GMT_X] - x0[colu];	dy = in[GMT_Y] - y0[rowu];
+
+					/* Check for wrap-around in x or y.  This should only occur if the
+					   search radius is larger than 1/2 the grid width/height so that
+					   the shortest distance is going through the periodic boundary.
+					   For longitudes the dx obviously cannot exceed 180 (half_x_width)
+					   since we could then go the other direction instead.
+					*/
+					if (HH->nxp && fabs (dx) > half_x_width) dx -= copysign (x_width, dx);
+					if (HH->nyp && fabs (dy) > half_y_width) dy -= copysign (y_width, dy);
+
+					/* OK, this point should constrain this node.  Calculate which sector and assign the value */
+
+					sector = urint (floor (((d_atan2 (dy, dx) + M_PI) * factor))) % Ctrl->N.sectors;
+					nearneighbor_assign_node (GMT, &grid_node[kk], Ctrl->N.sectors, sector, distance, n);
+
+					/* With periodic, gridline-registered grids there are duplicate rows and/or columns
+					   so we may have to assign the point to more than one node.  The next section deals
+					   with this situation.
+					*/
+
+					if (replicate_x) {	/* Must check if we have to replicate a column */
+						if (colu == 0) 	/* Must replicate left to right column */
+							nearneighbor_assign_node (GMT, &grid_node[kk+x_wrap], Ctrl->N.sectors, sector, distance, n);
+						else if (colu == (openmp_int)HH->nxp)	/* Must replicate right to left column */
+							nearneighbor_assign_node (GMT, &grid_node[kk-x_wrap], Ctrl->N.sectors, sector, distance, n);
+					}
+					if (replicate_y) {	/* Must check if we have to replicate a row */
+						if (rowu == 0)	/* Must replicate top to bottom row */
+							nearneighbor_assign_node (GMT, &grid_node[kk+y_wrap], Ctrl->N.sectors, sector, distance, n);
+						else if (rowu == (openmp_int)HH->nyp)	/* Must replicate bottom to top row */
+							nearneighbor_assign_node (GMT, &grid_node[kk-y_wrap], Ctrl->N.sectors, sector, distance, n);
+					}
 				}
 			}
 		}
@@ -504,6 +604,10 @@ EXTERN_MSC int GMT_nearneighbor (void *V_API, int mode, void *args) {
 			n_alloc <<= 1;
 			point = gmt_M_memory (GMT, point, n_alloc, struct NEARNEIGHBOR_POINT);
 			gmt_M_memset (&(point[old_n_alloc]), n_alloc - old_n_alloc, struct NEARNEIGHBOR_POINT);	/* Set to NULL/0 */
+			if (build_index) {	/* Must also grow the coordinate arrays */
+				xp = gmt_M_memory (GMT, xp, n_alloc, double);
+				yp = gmt_M_memory (GMT, yp, n_alloc, double);
+			}
 		}
 	} while (true);
 
@@ -512,12 +616,18 @@ EXTERN_MSC int GMT_nearneighbor (void *V_API, int mode, void *args) {
 	}
 	GMT_Report (API, GMT_MSG_INFORMATION, "Processed record %10ld\n", n);
 
-	if (n < n_alloc) point = gmt_M_memory (GMT, point, n, struct NEARNEIGHBOR_POINT);
+	if (n && n < n_alloc) {
+		point = gmt_M_memory (GMT, point, n, struct NEARNEIGHBOR_POINT);
+		if (build_index) {
+			xp = gmt_M_memory (GMT, xp, n, double);
+			yp = gmt_M_memory (GMT, yp, n, double);
+		}
+	}
 	/* Compute weighted averages based on the nearest neighbors */
 
 	if (GMT_Create_Data (API, GMT_IS_GRID, GMT_IS_SURFACE, GMT_DATA_ONLY, NULL, NULL, NULL, 0, 0, Grid) == NULL) {
 		gmt_M_free (GMT, point);	gmt_M_free (GMT, grid_node);	gmt_M_free (GMT, d_col);
-		gmt_M_free (GMT, x0);		gmt_M_free (GMT, y0);
+		gmt_M_free (GMT, x0);		gmt_M_free (GMT, y0);		gmt_M_free (GMT, xp);	gmt_M_free (GMT, yp);
 		Return (API->error);
 	}
 
@@ -526,56 +636,63 @@ EXTERN_MSC int GMT_nearneighbor (void *V_API, int mode, void *args) {
 	if (!Ctrl->E.active) Ctrl->E.value = GMT->session.d_NaN;
 	three_over_radius = 3.0 / Ctrl->S.radius;
 
-	ij0 = 0;
-	gmt_M_row_loop (GMT, Grid, rowu) {
-		gmt_M_col_loop (GMT, Grid, rowu, colu, ij) {
-			if (!grid_node[ij0]) {	/* No nearest neighbors, set to empty and goto next node */
-				n_none++;
-				Grid->data[ij] = (gmt_grdfloat)Ctrl->E.value;
-				ij0++;
-				continue;
-			}
-
-			for (k = 0, n_filled = 0; k < Ctrl->N.sectors; k++)
-				if (grid_node[ij0]->datum[k] >= 0) n_filled++;
-			if (n_filled < Ctrl->N.min_sectors) { 	/* Not minimum set of neighbors in all sectors, set to empty and goto next node */
-				n_almost++;
-				Grid->data[ij] = (gmt_grdfloat)Ctrl->E.value;
-				nearneighbor_free_node (GMT, grid_node[ij0]);
-				ij0++;
-				continue;
-			}
+	if (build_index) {	/* Grid node-by-node via the point bin index so each node only queries the nearby bins */
+		PB = gmt_point_bin_create (GMT, Grid->header, xp, yp, n, d_row + 1, max_d_col + 1);
+		nearneighbor_grid_via_index (GMT, Ctrl, Grid, PB, xp, yp, point, x0, y0, d_col, d_row, &n_set, &n_almost, &n_none);
+		gmt_point_bin_free (GMT, &PB);
+	}
+	else {	/* Periodic boundaries require the per-point assignments made during reading */
+		ij0 = 0;
+		gmt_M_row_loop (GMT, Grid, rowu) {
+			gmt_M_col_loop (GMT, Grid, rowu, colu, ij) {
+				if (!grid_node[ij0]) {	/* No nearest neighbors, set to empty and goto next node */
+					n_none++;
+					Grid->data[ij] = (gmt_grdfloat)Ctrl->E.value;
+					ij0++;
+					continue;
+				}
 
-			/* OK, here we have enough data and need to calculate the weighted value */
+				for (k = 0, n_filled = 0; k < Ctrl->N.sectors; k++)
+					if (grid_node[ij0]->datum[k] >= 0) n_filled++;
+				if (n_filled < Ctrl->N.min_sectors) { 	/* Not minimum set of neighbors in all sectors, set to empty and goto next node */
+					n_almost++;
+					Grid->data[ij] = (gmt_grdfloat)Ctrl->E.value;
+					nearneighbor_free_node (GMT, grid_node[ij0]);
+					ij0++;
+					continue;
+				}
 
-			n_set++;
-			weight_sum = grd_sum = 0.0;	/* Initialize sums */
-			for (k = 0; k < Ctrl->N.sectors; k++) {
-				if (grid_node[ij0]->datum[k] >= 0) {
-					delta = three_over_radius * grid_node[ij0]->distance[k];
-					weight = 1.0 / (1.0 + delta * delta);	/* This is distance weight */
-					if (Ctrl->W.active) weight *= point[grid_node[ij0]->datum[k]].w;	/* This is observation weight */
-					grd_sum += weight * point[grid_node[ij0]->datum[k]].z;
-					weight_sum += weight;
+				/* OK, here we have enough data and need to calculate the weighted value */
+
+				n_set++;
+				weight_sum = grd_sum = 0.0;	/* Initialize sums */
+				for (k = 0; k < Ctrl->N.sectors; k++) {
+					if (grid_node[ij0]->datum[k] >= 0) {
+						delta = three_over_radius * grid_node[ij0]->distance[k];
+						weight = 1.0 / (1.0 + delta * delta);	/* This is distance weight */
+						if (Ctrl->W.active) weight *= point[grid_node[ij0]->datum[k]].w;	/* This is observation weight */
+						grd_sum += weight * point[grid_node[ij0]->datum[k]].z;
+						weight_sum += weight;
+					}
 				}
+				Grid->data[ij] = (gmt_grdfloat)(grd_sum / weight_sum);
+				nearneighbor_free_node (GMT, grid_node[ij0]);
+				ij0++;
 			}
-			Grid->data[ij] = (gmt_grdfloat)(grd_sum / weight_sum);
-			nearneighbor_free_node (GMT, grid_node[ij0]);
-			ij0++;
+			if ((rowu % 128) == 0) GMT_Report (API, GMT_MSG_INFORMATION, "Gridded row %10ld\r", rowu);
 		}
-		if ((rowu % 128) == 0) GMT_Report (API, GMT_MSG_INFORMATION, "Gridded row %10ld\r", rowu);
+		GMT_Report (API, GMT_MSG_INFORMATION, "Gridded row %10ld\n", rowu);
 	}
-	GMT_Report (API, GMT_MSG_INFORMATION, "Gridded row %10ld\n", rowu);
 
 	if (GMT_Set_Comment (API, GMT_IS_GRID, GMT_COMMENT_IS_OPTION | GMT_COMMENT_IS_COMMAND, options, Grid)) {
 		gmt_M_free (GMT, point);	gmt_M_free (GMT, grid_node);	gmt_M_free (GMT, d_col);
-		gmt_M_free (GMT, x0);		gmt_M_free (GMT, y0);
+		gmt_M_free (GMT, x0);		gmt_M_free (GMT, y0);		gmt_M_free (GMT, xp);	gmt_M_free (GMT, yp);
 		Return (API->error);
 	}
 
 	if (GMT_Write_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_CONTAINER_AND_DATA, NULL, Ctrl->G.file, Grid) != GMT_NOERROR) {
 		gmt_M_free (GMT, point);	gmt_M_free (GMT, grid_node);	gmt_M_free (GMT, d_col);
-		gmt_M_free (GMT, x0);		gmt_M_free (GMT, y0);
+		gmt_M_free (GMT, x0);		gmt_M_free (GMT, y0);		gmt_M_free (GMT, xp);	gmt_M_free (GMT, yp);
 		Return (API->error);
 	}
 
@@ -588,7 +705,7 @@ EXTERN_MSC int GMT_nearneighbor (void *V_API, int mode, void *args) {
 	}
 
 	gmt_M_free (GMT, point);	gmt_M_free (GMT, grid_node);	gmt_M_free (GMT, d_col);
-	gmt_M_free (GMT, x0);		gmt_M_free (GMT, y0);
+	gmt_M_free (GMT, x0);		gmt_M_free (GMT, y0);		gmt_M_free (GMT, xp);	gmt_M_free (GMT, yp);
 
 	Return (GMT_NOERROR);
 }
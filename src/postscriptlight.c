@@ -832,17 +832,20 @@ static int psl_convert_path_new (struct PSL_CTRL *PSL, double *x, double *y, int
 	return (k);
 }
 
-static int psl_convert_path_old (struct PSL_CTRL *PSL, double *x, double *y, int n, int *ix, int *iy, int mode) {
-	/* Simplifies the (x,y) array by converting it to pixel coordinates (ix,iy)
-	 * and eliminating repeating points and intermediate points along straight
-	 * line segments.  The result is the fewest points needed to draw the path
-	 * and still look exactly like the original path.  However, if mode == 1 we do
-	 * no shortening. */
-
-	int i, k, dx, dy;
-	int old_dir = 0, new_dir;
-	double old_slope = -DBL_MAX, new_slope;
-	/* These seeds for old_slope and old_dir make sure that first point gets saved */
+static int psl_convert_path_dp (struct PSL_CTRL *PSL, double *x, double *y, int n, int *ix, int *iy, int mode) {
+	/* Simplifies the (x,y) array by converting it to pixel coordinates (ix,iy) and then
+	 * running an iterative Douglas-Peucker pass with the same one-dot tolerance used by
+	 * psl_convert_path_new.  The incremental algorithm re-examines all points between the
+	 * current anchors and goes quadratic when thousands of vertices collapse into a few
+	 * pixels (dense coastlines at small scale), whereas this pass handles a collapsed run
+	 * in one scan.  The first and last points are always kept and the retained points stay
+	 * within one dot of the original path, so the drawing is visually unchanged.
+	 * If mode == 1 we do no shortening. */
+
+	int i, k, a, b, m, top = 0;
+	int *stack = NULL;
+	int64_t dx, dy, d, cross, c_max;
+	unsigned char *keep = NULL;
 
 	if (n < 2) return (n);	/* Not a path to start with */
 
@@ -852,34 +855,44 @@ static int psl_convert_path_old (struct PSL_CTRL *PSL, double *x, double *y, int
 	}
 	if (mode == PSL_CONVERT_PATH) return (n);   /* No shortening */
 
-	/* The only truly unique point is the starting point; all else must show increments
-	 * relative to the previous point */
-
-	/* First point is the anchor. We will find at least one point, unless all points are the same */
-	for (i = k = 0; i < n - 1; i++) {
-		dx = ix[i+1] - ix[i];
-		dy = iy[i+1] - iy[i];
-		if (dx == 0 && dy == 0) continue;	/* Skip duplicates */
-		new_slope = (dx == 0) ? copysign (DBL_MAX, (double)dy) : ((double)dy) / ((double)dx);
-		new_dir = (dx >= 0) ? 1 : -1;
-		if (new_slope != old_slope || new_dir != old_dir) {
-			ix[k] = ix[i];
-			iy[k] = iy[i];
-			k++;
-			old_slope = new_slope;
-			old_dir = new_dir;
+	keep  = PSL_memory (PSL, NULL, n, unsigned char);
+	stack = PSL_memory (PSL, NULL, 4 * ((size_t)n + 2), int);	/* Each kept point causes at most one split (two pushed pairs) */
+	keep[0] = keep[n-1] = 1;
+	stack[top++] = 0;	stack[top++] = n - 1;
+	while (top) {	/* Process the segments depth-first */
+		b = stack[--top];	a = stack[--top];
+		if (b - a < 2) continue;	/* No interior points to consider */
+		dx = ix[b] - ix[a];
+		dy = iy[b] - iy[a];
+		m = -1;	c_max = -1;
+		if (dx == 0 && dy == 0) {	/* Degenerate: both anchors in the same pixel; split at the point leaving it the furthest, if any */
+			for (i = a + 1; i < b; i++) {
+				cross = MAX (llabs ((int64_t)ix[i] - ix[a]), llabs ((int64_t)iy[i] - iy[a]));
+				if (cross > c_max) { c_max = cross; m = i; }
+			}
+			d = 1;	/* Any point in another pixel must be kept */
+		}
+		else {	/* Regular segment: find the interior point deviating the most from the a-b line */
+			for (i = a + 1; i < b; i++) {
+				cross = llabs (dx * ((int64_t)iy[i] - iy[a]) - ((int64_t)ix[i] - ix[a]) * dy);
+				if (cross > c_max) { c_max = cross; m = i; }
+			}
+			d = MAX (llabs (dx), llabs (dy));	/* "Far" means |dx by - bx dy| >= max(|dx|,|dy|), i.e., more than one dot off the line */
+		}
+		if (c_max >= d) {	/* Must keep point m and recurse on both halves; otherwise the whole interior is dropped */
+			keep[m] = 1;
+			stack[top++] = a;	stack[top++] = m;
+			stack[top++] = m;	stack[top++] = b;
 		}
 	}
-
-	/* If all points are the same, we get here with k = 0, so we can exit here now with 1 point */
-	if (k < 1) return (1);
-
-	/* Last point (k cannot be < 1 so k-1 >= 0) */
-	if (ix[k-1] != ix[n-1] || iy[k-1] != iy[n-1]) {	/* Do not do slope check on last point since we must end there */
-		ix[k] = ix[n-1];
-		iy[k] = iy[n-1];
+	for (i = k = 0; i < n; i++) {	/* Compress the arrays down to the retained points */
+		if (!keep[i]) continue;
+		ix[k] = ix[i];
+		iy[k] = iy[i];
 		k++;
 	}
+	PSL_free (keep);
+	PSL_free (stack);
 
 	return (k);
 }
@@ -890,7 +903,7 @@ static int psl_convert_path_old (struct PSL_CTRL *PSL, double *x, double *y, int
 
 static int psl_convert_path (struct PSL_CTRL *PSL, double *x, double *y, int n, int *ix, int *iy, int mode) {
 	if (n > N_LENGTH_THRESHOLD)
-		return psl_convert_path_old (PSL, x, y, n, ix, iy, mode);
+		return psl_convert_path_dp (PSL, x, y, n, ix, iy, mode);
 	else
 		return psl_convert_path_new (PSL, x, y, n, ix, iy, mode);
 }
@@ -1156,6 +1169,38 @@ static void psl_prepare_buffer (struct PSL_CTRL *C, size_t len) {
 	}
 }
 
+static void psl_puts (struct PSL_CTRL *C, const char *txt, size_t len) {
+	/* Append len raw bytes to the output buffer or stream.  Unlike PSL_command this
+	 * does no printf formatting, so callers that have already built their text can
+	 * emit it in one go. */
+	if (C->internal.memory) {
+		psl_prepare_buffer (C, len);
+		memcpy (&C->internal.buffer[C->internal.n], txt, len);
+		C->internal.n += len;
+		C->internal.buffer[C->internal.n] = '\0';
+	}
+	else
+		fwrite (txt, 1U, len, C->internal.fp);
+}
+
+static char *psl_copyint (char *p, int value) {
+	/* Write the decimal form of value at p and return the new end of string.  This is
+	 * sprintf "%d" without the format-parsing overhead since the coordinate loops emit
+	 * millions of these. */
+	char tmp[16];
+	int k = 0;
+	unsigned int u;
+	if (value < 0) {	/* Emit the sign, then negate without overflowing INT_MIN */
+		*p++ = '-';
+		u = (unsigned int)(-(value + 1)) + 1U;
+	}
+	else
+		u = (unsigned int)value;
+	do { tmp[k++] = (char)('0' + (u % 10U)); u /= 10U; } while (u);
+	while (k) *p++ = tmp[--k];
+	return (p);
+}
+
 static size_t psl_a85_encode (struct PSL_CTRL *PSL, const unsigned char *src_buf, size_t nbytes) {
 	/* Encode 4-byte binary data from src_buf to 5-byte ASCII85
 	 * Special cases: 0x00000000 is encoded as z
@@ -1705,7 +1750,7 @@ char *psl_prepare_text (struct PSL_CTRL *PSL, char *text) {
 }
 
 static int psl_pattern_cleanup (struct PSL_CTRL *PSL) {
-	int image_no, k = 0;
+	int image_no, v, k = 0;
 
 	for (image_no = 0; image_no < PSL_N_PATTERNS * 2; image_no++)
 		if (PSL->internal.pattern[image_no].status) k++;
@@ -1714,7 +1759,9 @@ static int psl_pattern_cleanup (struct PSL_CTRL *PSL) {
 	for (image_no = 0; image_no < PSL_N_PATTERNS * 2; image_no++) {
 		if (PSL->internal.pattern[image_no].status) {
 			PSL_command (PSL, "currentdict /image%d undef\n", image_no+1);
-			PSL_command (PSL, "currentdict /pattern%d undef\n", image_no+1);
+			for (v = 0; v < PSL->internal.pattern[image_no].n_variants; v++)	/* Undefine every defined variant of this pattern */
+				PSL_command (PSL, "currentdict /pattern%d undef\n", image_no+1 + v * PSL_N_PATTERNS * 2);
+			PSL_free (PSL->internal.pattern[image_no].variant);	/* Callers reset the pattern array next so no dangling pointer */
 		}
 	}
 	return (PSL_NO_ERROR);
@@ -3640,6 +3687,7 @@ int PSL_endsession (struct PSL_CTRL *PSL) {
 	psl_freeplot (PSL);
 	PSL_free (PSL->internal.font);
 	for (i = 0; i < PSL->internal.n_userimages; i++) PSL_free (PSL->internal.user_image[i]);
+	for (i = 0; i < PSL_N_PATTERNS * 2; i++) PSL_free (PSL->internal.pattern[i].variant);	/* In case a plot was not finalized */
 	PSL_free (PSL->internal.SHAREDIR);
 	PSL_free (PSL->internal.USERDIR);
 	PSL_free (PSL->init.encoding);
@@ -3978,8 +4026,6 @@ int PSL_plotsymbol (struct PSL_CTRL *PSL, double x, double y, double size[], int
 		case PSL_PLUS:		/* Plus */
 		case PSL_XDASH:		/* Horizontal line segment */
 		case PSL_YDASH:		/* Vertical line segment */
-			PSL_command (PSL, "%d %d %d S%c\n", psl_iz (PSL, 0.5 * size[0]), psl_ix (PSL, x), psl_iy (PSL, y), (char)symbol);
-			break;
 
 		/* One-parameter Fillable symbols. size[0] = diameter of circumscribing circle. */
 
@@ -3992,7 +4038,15 @@ int PSL_plotsymbol (struct PSL_CTRL *PSL, double x, double y, double size[], int
 		case PSL_PENTAGON:	/* Pentagon */
 		case PSL_SQUARE:	/* Square */
 		case PSL_TRIANGLE:	/* Triangle */
-			PSL_command (PSL, "%d %d %d S%c\n", psl_iz (PSL, 0.5 * size[0]), psl_ix (PSL, x), psl_iy (PSL, y), (char)symbol);
+		{	/* These all take the same three arguments; assemble the text directly since point
+			 * clouds emit millions of them and the printf formatting alone adds up */
+			char text[64], *p = text;
+			p = psl_copyint (p, psl_iz (PSL, 0.5 * size[0]));	*p++ = ' ';
+			p = psl_copyint (p, psl_ix (PSL, x));	*p++ = ' ';
+			p = psl_copyint (p, psl_iy (PSL, y));	*p++ = ' ';
+			*p++ = 'S';	*p++ = (char)symbol;	*p++ = '\n';
+			psl_puts (PSL, text, (size_t)(p - text));
+		}
 			break;
 
 		/* Multi-parameter fillable symbols */
@@ -4167,7 +4221,7 @@ int PSL_setimage (struct PSL_CTRL *PSL, int image_no, char *imagefile, unsigned
 	 * Returns image number
 	 */
 
-	int mask, id, inv, k;
+	int mask, id, inv, k, v, unique_no;
 	uint64_t nx, ny;
 	const char *colorspace[3] = {"Gray", "RGB", "CMYK"};			/* What kind of image we are writing */
 	const char *decode[3] = {"0 1", "0 1 0 1 0 1", "0 1 0 1 0 1 0 1"};	/* What kind of color decoding */
@@ -4193,38 +4247,51 @@ int PSL_setimage (struct PSL_CTRL *PSL, int image_no, char *imagefile, unsigned
 	id = (PSL->internal.color_mode == PSL_CMYK) ? 2 : 1;
 	mask = (PSL->internal.pattern[k].depth == 1 && (f_rgb[0] < 0.0 || b_rgb[0] < 0.0));
 
-	/* When DPI or colors have changed, the /pattern procedure needs to be rewritten */
+	/* Each unique (pattern, DPI, colors) combination is only defined once in the file, as a pattern
+	 * instance bound by makepattern under its own unique number; fills then simply reference it.
+	 * This keeps the PS size down and lets the interpreter reuse its rendered pattern tile instead
+	 * of re-rasterizing the cell for every polygon when fills alternate between combinations. */
 
-	if (PSL->internal.pattern[k].dpi != image_dpi ||
-		!PSL_same_rgb(PSL->internal.pattern[k].f_rgb,f_rgb) ||
-		!PSL_same_rgb(PSL->internal.pattern[k].b_rgb,b_rgb)) {
+	for (v = 0; v < PSL->internal.pattern[k].n_variants; v++) {	/* See if this exact combination was defined already */
+		struct PSL_PATTERN_VARIANT *var = &PSL->internal.pattern[k].variant[v];
+		if (var->dpi == image_dpi && PSL_same_rgb (var->f_rgb, f_rgb) && PSL_same_rgb (var->b_rgb, b_rgb))
+			return (image_no + v * PSL_N_PATTERNS * 2);	/* Yes, just hand back its unique number */
+	}
 
-		PSL_comment (PSL, "Setup %s fill using pattern %d\n", kind_mask[mask], image_no);
-		if (image_dpi) {	/* Use given DPI */
-			nx = lrint (nx * PSL->internal.dpu / image_dpi);
-			ny = lrint (ny * PSL->internal.dpu / image_dpi);
-		}
-		PSL_command (PSL, "/pattern%d {V %" PRIu64 " %" PRIu64 " scale", image_no, nx, ny);
-		PSL_command (PSL, "\n<< /PaintType 1 /PatternType 1 /TilingType 1 /BBox [0 0 1 1] /XStep 1 /YStep 1 /PaintProc\n   {begin");
+	/* Here we must define a new variant of this pattern */
 
-		if (PSL->internal.pattern[k].depth == 1) {	/* 1-bit bitmap basis */
-			inv = psl_bitimage_cmap (PSL, f_rgb, b_rgb) % 2;
-			PSL_command (PSL, "\n<< /ImageType 1 /Decode [%d %d]", inv, 1-inv);
-		}
-		else
-			PSL_command (PSL, " /Device%s setcolorspace\n<< /ImageType 1 /Decode [%s]", colorspace[id], decode[id]);
-		PSL_command (PSL, " /Width %d /Height %d /BitsPerComponent %d",
-		             PSL->internal.pattern[k].nx, PSL->internal.pattern[k].ny, MIN(PSL->internal.pattern[k].depth,8));
-		PSL_command (PSL, "\n   /ImageMatrix [%d 0 0 %d 0 %d] /DataSource image%d\n>> %s end}\n>> matrix makepattern U} def\n",
-		             PSL->internal.pattern[k].nx, -PSL->internal.pattern[k].ny, PSL->internal.pattern[k].ny,
-		             image_no, kind_mask[mask]);
+	v = PSL->internal.pattern[k].n_variants++;
+	PSL->internal.pattern[k].variant = PSL_memory (PSL, PSL->internal.pattern[k].variant, PSL->internal.pattern[k].n_variants, struct PSL_PATTERN_VARIANT);
+	PSL->internal.pattern[k].variant[v].dpi = image_dpi;
+	PSL_rgb_copy (PSL->internal.pattern[k].variant[v].f_rgb, f_rgb);
+	PSL_rgb_copy (PSL->internal.pattern[k].variant[v].b_rgb, b_rgb);
+	unique_no = image_no + v * PSL_N_PATTERNS * 2;	/* Guaranteed unique since image_no is in the 1-182 range */
 
-		PSL->internal.pattern[k].dpi = image_dpi;
-		PSL_rgb_copy (PSL->internal.pattern[k].f_rgb, f_rgb);
-		PSL_rgb_copy (PSL->internal.pattern[k].b_rgb, b_rgb);
+	PSL_comment (PSL, "Setup %s fill using pattern %d [variant %d]\n", kind_mask[mask], image_no, v);
+	if (image_dpi) {	/* Use given DPI */
+		nx = lrint (nx * PSL->internal.dpu / image_dpi);
+		ny = lrint (ny * PSL->internal.dpu / image_dpi);
 	}
+	PSL_command (PSL, "/pattern%d V %" PRIu64 " %" PRIu64 " scale", unique_no, nx, ny);
+	PSL_command (PSL, "\n<< /PaintType 1 /PatternType 1 /TilingType 1 /BBox [0 0 1 1] /XStep 1 /YStep 1 /PaintProc\n   {begin");
 
-	return (image_no);
+	if (PSL->internal.pattern[k].depth == 1) {	/* 1-bit bitmap basis */
+		inv = psl_bitimage_cmap (PSL, f_rgb, b_rgb) % 2;
+		PSL_command (PSL, "\n<< /ImageType 1 /Decode [%d %d]", inv, 1-inv);
+	}
+	else
+		PSL_command (PSL, " /Device%s setcolorspace\n<< /ImageType 1 /Decode [%s]", colorspace[id], decode[id]);
+	PSL_command (PSL, " /Width %d /Height %d /BitsPerComponent %d",
+	             PSL->internal.pattern[k].nx, PSL->internal.pattern[k].ny, MIN(PSL->internal.pattern[k].depth,8));
+	PSL_command (PSL, "\n   /ImageMatrix [%d 0 0 %d 0 %d] /DataSource image%d\n>> %s end}\n>> matrix makepattern U def\n",
+	             PSL->internal.pattern[k].nx, -PSL->internal.pattern[k].ny, PSL->internal.pattern[k].ny,
+	             image_no, kind_mask[mask]);
+
+	PSL->internal.pattern[k].dpi = image_dpi;
+	PSL_rgb_copy (PSL->internal.pattern[k].f_rgb, f_rgb);
+	PSL_rgb_copy (PSL->internal.pattern[k].b_rgb, b_rgb);
+
+	return (unique_no);
 }
 
 int PSL_plotepsimage (struct PSL_CTRL *PSL, double x, double y, double xsize, double ysize, int justify, unsigned char *buffer, struct imageinfo *h) {
@@ -4381,6 +4448,7 @@ int PSL_plotline (struct PSL_CTRL *PSL, double *x, double *y, int n, int type) {
      *                  when the first and last point are the same and PSL_MOVE is on.
      */
     int i, i0 = 0, *ix = NULL, *iy = NULL;
+    char *buf = NULL, *p = NULL;
 
     if (n < 1) return (PSL_NO_ERROR);   /* Cannot deal with empty lines */
     if (type < 0) type = -type;     /* Should be obsolete now */
@@ -4398,27 +4466,42 @@ int PSL_plotline (struct PSL_CTRL *PSL, double *x, double *y, int n, int type) {
 
     if (n > 1 && (type & PSL_MOVE) && (ix[0] == ix[n-1] && iy[0] == iy[n-1]) && (type & PSL_CLOSE_INTERIOR) == 0) {n--; type |= PSL_CLOSE;}
 
+    /* Batch the whole coordinate stream into one buffer; emitting it in a single call
+     * sidesteps the per-point printf formatting that dominates long lines.  Each point
+     * needs at most two signed ints plus " D\n" which 32 bytes covers comfortably. */
+
+    buf = PSL_memory (PSL, NULL, 32 * ((size_t)n + 1), char);
+    p = buf;
+
     if (type & PSL_MOVE) {
-        PSL_command (PSL, "%d %d M\n", ix[0], iy[0]);
+        p = psl_copyint (p, ix[0]); *p++ = ' ';
+        p = psl_copyint (p, iy[0]); strcpy (p, " M\n"); p += 3;
         PSL->internal.ix = ix[0];
         PSL->internal.iy = iy[0];
         i0++;
-        if (n == 1) PSL_command (PSL, "0 0 D\n");   /* Add at least a zero length line */
+        if (n == 1) { strcpy (p, "0 0 D\n"); p += 6; }   /* Add at least a zero length line */
     }
 
     for (i = i0; i < n; i++) {
-        if (ix[i] != PSL->internal.ix || iy[i] != PSL->internal.iy)
-            PSL_command (PSL, "%d %d D\n", ix[i] - PSL->internal.ix, iy[i] - PSL->internal.iy);
+        if (ix[i] != PSL->internal.ix || iy[i] != PSL->internal.iy) {
+            p = psl_copyint (p, ix[i] - PSL->internal.ix); *p++ = ' ';
+            p = psl_copyint (p, iy[i] - PSL->internal.iy); strcpy (p, " D\n"); p += 3;
+        }
         PSL->internal.ix = ix[i];
         PSL->internal.iy = iy[i];
     }
-    if (type & PSL_STROKE && type & PSL_CLOSE)
-        PSL_command (PSL, "P S\n"); /* Close and stroke the path */
-    else if (type & PSL_CLOSE)
-        PSL_command (PSL, "P\n");   /* Close the path */
-    else if (type & PSL_STROKE)
-        PSL_command (PSL, "S\n");   /* Stroke the path */
+    if (type & PSL_STROKE && type & PSL_CLOSE) {
+        strcpy (p, "P S\n"); p += 4; /* Close and stroke the path */
+    }
+    else if (type & PSL_CLOSE) {
+        strcpy (p, "P\n"); p += 2;   /* Close the path */
+    }
+    else if (type & PSL_STROKE) {
+        strcpy (p, "S\n"); p += 2;   /* Stroke the path */
+    }
+    psl_puts (PSL, buf, (size_t)(p - buf));
 
+    PSL_free (buf);
     PSL_free (ix);
     PSL_free (iy);
 
@@ -4595,6 +4678,35 @@ char * PSL_getplot (struct PSL_CTRL *PSL) {
 	return (PSL->internal.buffer);
 }
 
+int PSL_setplot (struct PSL_CTRL *PSL, char *buffer, size_t n, size_t n_alloc, int pmode) {
+	/* Hand an externally kept plot buffer (e.g., one previously surrendered via PSL_detachplot)
+	 * back to PSL so that subsequent output (new overlays, or the trailer) appends to it in memory. */
+	if (!PSL) return (PSL_NO_SESSION);	/* Never was allocated */
+	if (PSL->internal.buffer && PSL->internal.buffer != buffer) psl_freeplot (PSL);	/* Free any previous plot laying around */
+	PSL->internal.memory  = 1;
+	PSL->internal.buffer  = buffer;
+	PSL->internal.n       = n;
+	PSL->internal.n_alloc = n_alloc;
+	PSL->internal.pmode   = pmode;
+	return (PSL_NO_ERROR);
+}
+
+char * PSL_detachplot (struct PSL_CTRL *PSL, size_t *n, size_t *n_alloc, int *pmode) {
+	/* Surrender ownership of the memory plot buffer to the caller and reset PSL memory output.
+	 * The caller must eventually free the buffer or return it via PSL_setplot. */
+	char *buffer = NULL;
+	if (!PSL || !PSL->internal.memory) return (NULL);	/* Nothing to detach */
+	buffer = PSL->internal.buffer;
+	if (n) *n = PSL->internal.n;
+	if (n_alloc) *n_alloc = PSL->internal.n_alloc;
+	if (pmode) *pmode = PSL->internal.pmode;
+	PSL->internal.buffer  = NULL;
+	PSL->internal.n = PSL->internal.n_alloc = 0;
+	PSL->internal.memory = 0;
+	PSL->internal.pmode  = 0;
+	return (buffer);
+}
+
 int PSL_beginplot (struct PSL_CTRL *PSL, FILE *fp, int orientation, int overlay, int color_mode, char origin[], double offset[], double page_size[], char *title, int font_no[]) {
 /* fp:		Output stream or NULL for standard output
    orientation:	0 = landscape, 1 = portrait.  If orientation &2 then we write to memory array [Default is to fp]
@@ -4890,6 +5002,7 @@ int PSL_setfont (struct PSL_CTRL *PSL, int font_no) {
 	}
 	PSL->current.font_no = font_no;
 	PSL->current.fontsize = 0.0;	/* Forces "%d F%d" to be written on next call to psl_putfont */
+	PSL->current.string_size = 0.0;	/* Any string dimensions set in PS refer to the previous font */
 	/* Encoding will be done by subsequent calls inside the text-producing routines through calls to psl_encodefont [PS: testing line below] */
 	psl_encodefont (PSL, PSL->current.font_no);
 
@@ -5140,6 +5253,7 @@ int PSL_plottextbox (struct PSL_CTRL *PSL, double x, double y, double fontsize,
 	PSL_command (PSL, "U\n");
 	PSL_comment (PSL, "PSL_plottextbox end:\n");
 	strncpy (PSL->current.string, &text[i], PSL_BUFSIZ - 1);	/* Save the string with one left for null terminator */
+	PSL->current.string_size = fontsize;	/* Let PSL_plottext reuse the PSL_dim_* values for this string */
 	return (PSL_NO_ERROR);
 }
 
@@ -5490,7 +5604,17 @@ int PSL_plottext (struct PSL_CTRL *PSL, double x, double y, double fontsize, cha
 	if (justify > 1) {
 		x_just = (justify + 3) % 4;	/* Gives 0 (left justify, i.e., do nothing), 1 (center), or 2 (right justify) */
 		y_just = justify / 4;		/* Gives 0 (bottom justify, i.e., do nothing), 1 (middle), or 2 (top justify) */
-		if (x_just && y_just) {
+		if (text == NULL && PSL->current.string_size == fontsize) {
+			/* PSL_plottextbox already measured this very string at this font and size and set
+			 * PSL_dim_w|h in PS, so skip the remeasuring and reuse those values directly */
+			if (x_just && y_just)
+				PSL_command (PSL, "PSL_dim_w %s PSL_dim_h %s G\n", align[x_just], align[y_just]);
+			else if (x_just)
+				PSL_command (PSL, "PSL_dim_w %s 0 G\n", align[x_just]);
+			else
+				PSL_command (PSL, "0 PSL_dim_h %s G\n", align[y_just]);
+		}
+		else if (x_just && y_just) {
 			PSL_deftextdim (PSL, "-b", fontsize, string);	/* Get width and height of string */
 			PSL_command (PSL, "%s exch %s exch G\n", align[y_just], align[x_just]);
 		}
@@ -359,6 +359,7 @@ struct PSL_CTRL {
 		double transparency;		/* Current transparency	[deprecated]		*/
 		double transparencies[2];	/* Current transparencies			*/
 		double fontsize;		/* Current font size				*/
+		double string_size;		/* Font size at which PSL_dim_* was set for string [0 = not set] */
 		double subsupsize;		/* Fractional size of super/sub-scripts		*/
 		double scapssize;		/* Fractional size of small caps		*/
 		double sub_down;		/* Fractional fontsize shift down for subscript */
@@ -415,6 +416,11 @@ struct PSL_CTRL {
 			int nx, ny;	/* Dimension of pattern image */
 			int status, depth, dpi;
 			double f_rgb[4], b_rgb[4];
+			int n_variants;			/* Number of (dpi, color) variants of this pattern defined in the file */
+			struct PSL_PATTERN_VARIANT {	/* One entry per variant already emitted so we can reference instead of redefine */
+				int dpi;		/* Resolution this variant was set up for */
+				double f_rgb[4], b_rgb[4];	/* Foreground and background colors of this variant */
+			} *variant;
 		} pattern[PSL_N_PATTERNS*2];
 	} internal;
 };
@@ -459,6 +465,8 @@ EXTERN_MSC int PSL_endlayer (struct PSL_CTRL *PSL);
 EXTERN_MSC int PSL_endplot (struct PSL_CTRL *PSL, int lastpage);
 EXTERN_MSC int PSL_endsession (struct PSL_CTRL *PSL);
 EXTERN_MSC char * PSL_getplot (struct PSL_CTRL *PSL);
+EXTERN_MSC char * PSL_detachplot (struct PSL_CTRL *PSL, size_t *n, size_t *n_alloc, int *pmode);
+EXTERN_MSC int PSL_setplot (struct PSL_CTRL *PSL, char *buffer, size_t n, size_t n_alloc, int pmode);
 EXTERN_MSC char * PSL_makecolor (struct PSL_CTRL *PSL, double rgb[]);
 EXTERN_MSC char * PSL_makefont (struct PSL_CTRL *PSL, double size, double rgb[]);
 EXTERN_MSC char * PSL_makefontsize (struct PSL_CTRL *PSL, double size);
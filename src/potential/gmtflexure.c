@@ -379,20 +379,20 @@ GMT_LOCAL int gmtflexure_get_curvature (double flexure[], int n, double dist_inc
 	return (1);
 }
 
-GMT_LOCAL int gmtflexure_lu_solver (struct GMT_CTRL *GMT, double *a, int n, double *x, double *b) {
-	/* A 5-diagonal matrix problem A*w = p solved using a LU-transformation */
+struct GMTFLEXURE_LU {	/* Reusable factorization of a pentadiagonal flexure operator (see gmtflexure_lu_solver) */
+	int n;		/* Number of equations in the system last factored [0 means no factorization yet] */
+	double scale;	/* Normalization that was applied to the matrix; the rhs needs the same scaling */
+	double *a;	/* Copy of the unnormalized matrix so we can detect when a refactor is needed */
+	double *l, *u;	/* The two triangular factors */
+};
 
-	int i, off3, off5;
-	double new_max, old_max, *l = NULL, *u = NULL, *z = NULL;
+GMT_LOCAL void gmtflexure_lu_factor (double *a, int n, double *l, double *u, double *scale) {
+	/* Decompose the pentadiagonal matrix a into triangular factors l and u.
+	 * The matrix is normalized in place by 1/max|a[i]| and that factor is returned
+	 * via scale since the rhs must be scaled the same way before substitution. */
 
-	if (n < 4) {
-		fprintf (stderr, "gmtflexure_lu_solver: n < 4!\n");
-		return (1);
-	}
-
-	l = gmt_M_memory (GMT, NULL, n * 5, double);
-	u = gmt_M_memory (GMT, NULL, n * 5, double);
-	z = gmt_M_memory (GMT, NULL, n, double);
+	int i, off3, off5;
+	double new_max, old_max;
 
 	/* Find largest element in coefficient matrix */
 
@@ -404,7 +404,7 @@ GMT_LOCAL int gmtflexure_lu_solver (struct GMT_CTRL *GMT, double *a, int n, doub
 	old_max = 1.0 / old_max;
 	for (i = 0; i < n*5; i++) a[i] *= old_max;
 
-	for (i = 0; i < n; i++) b[i] *= old_max;
+	*scale = old_max;
 
 	/* Start decomposition of a to l * u */
 	/* Row 1 */
@@ -452,8 +452,18 @@ GMT_LOCAL int gmtflexure_lu_solver (struct GMT_CTRL *GMT, double *a, int n, doub
 	l[off3+1] = (a[off5+1] - l[off3] * u[off3-5]) / u[off3-3];
 	l[off3+2] = 1.0;
 	u[off3] = a[off5+2] - l[off3] * u[off3-4] - l[off3+1] * u[off3-2];
+}
+
+GMT_LOCAL void gmtflexure_lu_substitute (struct GMT_CTRL *GMT, double *l, double *u, int n, double *x, double *b, double scale) {
+	/* Complete the solve given the triangular factors from gmtflexure_lu_factor;
+	 * b is scaled in place by the normalization that was applied to the matrix. */
+
+	int i, off3;
+	double *z = gmt_M_memory (GMT, NULL, n, double);
+
+	for (i = 0; i < n; i++) b[i] *= scale;
 
-	/* Then solve l * z = b by forward substitution */
+	/* First solve l * z = b by forward substitution */
 
 	z[0] = b[0];
 	z[1] = b[1] - z[0] * l[4];
@@ -469,13 +479,58 @@ GMT_LOCAL int gmtflexure_lu_solver (struct GMT_CTRL *GMT, double *a, int n, doub
 	for (i = n-3, off3 = i*3; i >= 0; i--, off3 -= 3)
 		x[i] = (z[i] - x[i+1] * u[off3+1] - x[i+2] * u[off3+2]) / u[off3];
 
+	gmt_M_free (GMT, z);
+}
+
+GMT_LOCAL int gmtflexure_lu_solver (struct GMT_CTRL *GMT, double *a, int n, double *x, double *b, struct GMTFLEXURE_LU *LU) {
+	/* A 5-diagonal matrix problem A*w = p solved using a LU-transformation.  If LU is given
+	 * we keep the triangular factors there and reuse them whenever the matrix matches the
+	 * one last factored, so batch runs over profiles with unchanged rigidity only pay for
+	 * the substitution.  Pass LU = NULL for the one-shot factor-and-solve behavior. */
+
+	double scale, *l = NULL, *u = NULL;
+
+	if (n < 4) {
+		fprintf (stderr, "gmtflexure_lu_solver: n < 4!\n");
+		return (1);
+	}
+
+	if (LU) {	/* Caller maintains a factorization between calls */
+		if (LU->n != n) {	/* First system or new size - (re)allocate the workspace */
+			LU->a = gmt_M_memory (GMT, LU->a, n * 5, double);
+			LU->l = gmt_M_memory (GMT, LU->l, n * 5, double);
+			LU->u = gmt_M_memory (GMT, LU->u, n * 5, double);
+			LU->n = 0;	/* Not factored yet */
+		}
+		if (LU->n != n || memcmp (LU->a, a, (size_t)(n * 5) * sizeof (double))) {	/* Operator changed - must refactor */
+			gmt_M_memcpy (LU->a, a, n * 5, double);
+			gmtflexure_lu_factor (a, n, LU->l, LU->u, &LU->scale);
+			LU->n = n;
+		}
+		gmtflexure_lu_substitute (GMT, LU->l, LU->u, n, x, b, LU->scale);
+		return (0);
+	}
+
+	l = gmt_M_memory (GMT, NULL, n * 5, double);
+	u = gmt_M_memory (GMT, NULL, n * 5, double);
+
+	gmtflexure_lu_factor (a, n, l, u, &scale);
+	gmtflexure_lu_substitute (GMT, l, u, n, x, b, scale);
+
 	gmt_M_free (GMT, u);
 	gmt_M_free (GMT, l);
-	gmt_M_free (GMT, z);
 
 	return (0);
 }
 
+GMT_LOCAL void gmtflexure_lu_free (struct GMT_CTRL *GMT, struct GMTFLEXURE_LU *LU) {
+	/* Release a factorization kept by gmtflexure_lu_solver */
+	gmt_M_free (GMT, LU->a);
+	gmt_M_free (GMT, LU->l);
+	gmt_M_free (GMT, LU->u);
+	LU->n = 0;
+}
+
 /* gmtflexure_flx1d will compute 1-D plate flexure for a variable rigidity case.
  * The equation is
  *	d2/dx2 (D * d2/dx2 w(x)) + T * d2/dx2 w(x) + k(x) * w(x) = p (x)
@@ -508,7 +563,7 @@ GMT_LOCAL int gmtflexure_lu_solver (struct GMT_CTRL *GMT, double *a, int n, doub
  *
  */
 
-GMT_LOCAL int gmtflexure_flx1d (struct GMT_CTRL *GMT, double *w, double *d, double *p, int n, double dx, double *k, int k_flag, double stress, int bc_left, int bc_right) {
+GMT_LOCAL int gmtflexure_flx1d (struct GMT_CTRL *GMT, double *w, double *d, double *p, int n, double dx, double *k, int k_flag, double stress, int bc_left, int bc_right, struct GMTFLEXURE_LU *LU) {
 	int i, row, off, ind, error;
 	double dx_4, c_1 = 0.0, c_2 = 0.0, stress2, restore, *work = NULL;
 
@@ -666,7 +721,7 @@ GMT_LOCAL int gmtflexure_flx1d (struct GMT_CTRL *GMT, double *w, double *d, doub
 
 	/* Solve for w */
 
-	error = gmtflexure_lu_solver (GMT, work, n, w, p);
+	error = gmtflexure_lu_solver (GMT, work, n, w, p, LU);
 	gmt_M_free (GMT, work);
 	if (error == 1) {
 		fprintf (stderr, "gmtflexure_flx1d: error=1 returned from gmtflexure_lu_solver!\n");
@@ -721,6 +776,7 @@ GMT_LOCAL int gmtflexure_flx1dk (struct GMT_CTRL *GMT, double w[], double d[], d
 	int i, error;
 	double restore_a, restore_b1, restore_b2, diff = 2 * LIMIT, dw, w0, w1, wn1, wn, max_dw;
 	double *w_old = NULL, *k = NULL, *load = NULL;
+	struct GMTFLEXURE_LU LU = {0, 0.0, NULL, NULL, NULL};	/* Lets iterations skip the refactor once k(x) stops changing */
 
 	/* Allocate memory for load and restore force */
 
@@ -741,7 +797,8 @@ GMT_LOCAL int gmtflexure_flx1dk (struct GMT_CTRL *GMT, double w[], double d[], d
 
 	gmt_M_memcpy (load, p, n, double);
 
-	if ((error = gmtflexure_flx1d (GMT, w, d, load, n, dx, k, 1, stress, bc_left, bc_right))) {
+	if ((error = gmtflexure_flx1d (GMT, w, d, load, n, dx, k, 1, stress, bc_left, bc_right, &LU))) {
+		gmtflexure_lu_free (GMT, &LU);
 		gmt_M_free (GMT, load);		gmt_M_free (GMT, k);
 		return (error);
 	}
@@ -764,7 +821,7 @@ GMT_LOCAL int gmtflexure_flx1dk (struct GMT_CTRL *GMT, double w[], double d[], d
 		gmt_M_memset (w, n, double);
 		w[0] = w0;	w[1] = w1;	w[n-2] = wn1;	w[n-1] = wn;	/* Reset BC values */
 
-		error = gmtflexure_flx1d (GMT, w, d, load, n, dx, k, 1, stress, bc_left, bc_right);
+		error = gmtflexure_flx1d (GMT, w, d, load, n, dx, k, 1, stress, bc_left, bc_right, &LU);
 
 		for (i = 0, diff = max_dw = 0.0; i < n; i++) {
 			dw = fabs (w[i] - w_old[i]);
@@ -775,6 +832,7 @@ GMT_LOCAL int gmtflexure_flx1dk (struct GMT_CTRL *GMT, double w[], double d[], d
 		diff = max_dw;
 	}
 
+	gmtflexure_lu_free (GMT, &LU);
 	gmt_M_free (GMT, k);
 	gmt_M_free (GMT, load);
 	gmt_M_free (GMT, w_old);
@@ -982,7 +1040,7 @@ GMT_LOCAL int gmtflexure_flx1dw0 (struct GMT_CTRL *GMT, double *w, double *w0, d
 
 	/* Solve for w */
 
-	error = gmtflexure_lu_solver (GMT, work, n, w, p);
+	error = gmtflexure_lu_solver (GMT, work, n, w, p, NULL);
 	gmt_M_free (GMT, work);
 	gmt_M_free (GMT, squeeze);
 	if (error == 1) {
@@ -1088,7 +1146,7 @@ GMT_LOCAL int gmtflexure_flxr (struct GMT_CTRL *GMT, double *w, double *d, doubl
 
 	/* Solve for w */
 	off = 5*n;
-	error = gmtflexure_lu_solver (GMT, work, n, w, p);
+	error = gmtflexure_lu_solver (GMT, work, n, w, p, NULL);
 	gmt_M_free (GMT, work);
 	if (error == 1) {
 		fprintf(stderr, "gmtflexure_flxr: error=1 returned from gmtflexure_lu_solver!\n");
@@ -1165,7 +1223,7 @@ GMT_LOCAL int gmtflexure_flxr2 (struct GMT_CTRL *GMT, double *w, double *d, doub
 
 	/* Solve for w */
 	off = 5*n;
-	error = gmtflexure_lu_solver (GMT, work, n, w, p);
+	error = gmtflexure_lu_solver (GMT, work, n, w, p, NULL);
 	gmt_M_free (GMT, work);
 	if (error == 1) {
 		fprintf(stderr, "gmtflexure_flxr2: error=1 returned from gmtflexure_lu_solver!\n");
@@ -1245,20 +1303,78 @@ GMT_LOCAL int gmtflexure_flxrk (struct GMT_CTRL *GMT, double w[], double  d[], d
 }
 #endif
 
+GMT_LOCAL int gmtflexure_solve_profile (struct GMT_CTRL *GMT, struct GMTFLEXURE_CTRL *Ctrl, struct GMT_DATASEGMENT *SQ, struct GMT_DATASEGMENT *SE, struct GMT_DATASEGMENT *ST, struct GMT_DATASEGMENT *SW, double restore, struct GMTFLEXURE_LU *LU, bool *was_airy) {
+	/* Set up and solve the flexure system for a single profile, given the load (SQ),
+	 * rigidity (SE), optional pre-existing deflection (ST) and output (SW) segments.
+	 * All reporting is left to the caller so that independent profiles may be solved
+	 * from separate threads; LU (may be NULL) holds a reusable factorization. */
+	bool airy;
+	int error = 0;
+	uint64_t row;
+	double x_inc;
+	double *deflection = SW->data[GMT_Y], *load = SQ->data[GMT_Y], *rigidity = SE->data[GMT_Y];
+
+	gmt_M_memcpy (SW->data[GMT_X], SQ->data[GMT_X], SQ->n_rows, double);
+	if (Ctrl->A.bc[LEFT] == BC_CLAMPED)
+		deflection[0] = Ctrl->A.deflection[LEFT];
+	else if (Ctrl->A.bc[LEFT] == BC_FREE) {
+		deflection[0] = -Ctrl->A.moment[LEFT];	/* Minus-sign because of the +ve gives +ve convention */
+		deflection[1] = Ctrl->A.force[LEFT];
+	}
+	if (Ctrl->A.bc[RIGHT] == BC_CLAMPED)
+		deflection[SQ->n_rows-1] = Ctrl->A.deflection[RIGHT];
+	else if (Ctrl->A.bc[RIGHT] == BC_FREE) {
+		deflection[SQ->n_rows-2] = -Ctrl->A.moment[RIGHT];	/* Minus-sign because of the +ve gives +ve convention */
+		deflection[SQ->n_rows-1] = Ctrl->A.force[RIGHT];
+	}
+	for (row = 0, airy = true; airy && row < SQ->n_rows; row++)
+		if (rigidity[row] > 0.0) airy = false;
+
+	if (airy) {	/* Airy compensation */
+		for (row = 0; row < SQ->n_rows; row++) deflection[row] = load[row] / restore;
+	}
+	*was_airy = airy;
+	x_inc = SQ->data[GMT_X][1] - SQ->data[GMT_X][0];
+	if (Ctrl->M.active[0]) x_inc *= 1000.0;	/* Got x in km */
+
+	if (Ctrl->T.active)	/* Plate has pre-existing deflection */
+		error = gmtflexure_flx1dw0 (GMT, deflection, ST->data[GMT_Y], rigidity, load, (int)SQ->n_rows, x_inc, &restore, 0, Ctrl->F.force, Ctrl->A.bc[LEFT], Ctrl->A.bc[RIGHT]);
+	else if (Ctrl->L.active)	/* Variable restoring force */
+		error = gmtflexure_flx1dk (GMT, deflection, rigidity, load, (int)SQ->n_rows, x_inc, Ctrl->D.rhom, Ctrl->D.rhol, Ctrl->D.rhoi, Ctrl->D.rhow, Ctrl->F.force, Ctrl->A.bc[LEFT], Ctrl->A.bc[RIGHT]);
+	else	/* Constant restoring force */
+		error = gmtflexure_flx1d (GMT, deflection, rigidity, load, (int)SQ->n_rows, x_inc, &restore, 0, Ctrl->F.force, Ctrl->A.bc[LEFT], Ctrl->A.bc[RIGHT], LU);
+
+	if (error) return (error);
+
+	if (Ctrl->S.active)	/* Compute curvatures */
+		gmtflexure_get_curvature (deflection, (int)SQ->n_rows, x_inc, SW->data[GMT_Z]);
+
+	/* Add in Moho depth, possibly convert back to km, and let z be positive up */
+	for (row = 0; row < SQ->n_rows; row++) {
+		deflection[row] = -(deflection[row] + Ctrl->Z.zm);
+		if (Ctrl->M.active[1]) deflection[row] /= 1000.0;	/* m -> km */
+	}
+	return (0);
+}
+
 #define bailout(code) {gmt_M_free_options (mode); return (code);}
 #define Return(code) {Free_Ctrl (GMT, Ctrl); gmt_end_module (GMT, GMT_cpy); bailout (code);}
 
 EXTERN_MSC int GMT_gmtflexure (void *V_API, int mode, void *args) {
-	uint64_t tbl, seg, row, n_columns;
+	openmp_int sp;
+	uint64_t tbl, seg, row, n_columns, n_seg = 0, n_airy = 0;
+	unsigned int n_threads = 1, k;
 	int error;
-	bool airy;
+	int *status = NULL;
+	bool *was_airy = NULL;
 	char msg[GMT_LEN256] = {""}, txt[GMT_LEN256] = {""};
-	double x_inc, restore;
-	double *load = NULL, *deflection = NULL, *rigidity = NULL;
+	double restore;
 
 	struct GMTFLEXURE_CTRL *Ctrl = NULL;
 	struct GMT_DATASET *Q = NULL, *E = NULL, *T = NULL, *W = NULL;
 	struct GMT_DATASEGMENT *S = NULL;
+	struct GMT_DATASEGMENT **QS = NULL, **ES = NULL, **TS = NULL, **WS = NULL;
+	struct GMTFLEXURE_LU *LU = NULL;
 	struct GMT_CTRL *GMT = NULL, *GMT_cpy = NULL;
 	struct GMT_OPTION *options = NULL;
 	struct GMTAPI_CTRL *API = gmt_get_api_ptr (V_API);	/* Cast from void to GMTAPI_CTRL pointer */
@@ -1408,82 +1524,83 @@ EXTERN_MSC int GMT_gmtflexure (void *V_API, int mode, void *args) {
 	n_columns = (Ctrl->S.active) ? 3 : 2;	/* Duplicate Q but possibly add 1 more column */
 	W = gmt_alloc_dataset (GMT, Q, 0, n_columns, GMT_ALLOC_NORMAL);
 
-	for (tbl = 0; tbl < W->n_tables; tbl++) {
-		for (seg = 0; seg < W->table[tbl]->n_segments; seg++) {
-			S = Q->table[tbl]->segment[seg];
-			deflection = W->table[tbl]->segment[seg]->data[GMT_Y];	/* Current flexure */
-			load = S->data[GMT_Y];	/* Current load */
-			rigidity = E->table[tbl]->segment[seg]->data[GMT_Y];	/* Current rigidities */
-			gmt_M_memcpy (W->table[tbl]->segment[seg]->data[GMT_X], S->data[GMT_X], S->n_rows, double);
-			sprintf (msg, "BCs > ");
-			if (Ctrl->A.bc[LEFT] == BC_INFINITY) strcat (msg, "infinity at left edge + ");
-			else if (Ctrl->A.bc[LEFT] == BC_PERIODIC) strcat (msg, "periodic at left edge + ");
-			else if (Ctrl->A.bc[LEFT] == BC_CLAMPED) {
-				deflection[0] = Ctrl->A.deflection[LEFT];
-				sprintf (txt, "plate clamped with deflection = %g at left edge + ", Ctrl->A.deflection[LEFT]);
-				strcat (msg, txt);
-			}
-			else if (Ctrl->A.bc[LEFT] == BC_FREE) {
-				deflection[0] =  -Ctrl->A.moment[LEFT];	/* Minus-sign because of the +ve gives +ve convention */
-				deflection[1] = Ctrl->A.force[LEFT];
-				sprintf (txt, "plate free with Moment = %g and Force = %g at left edge + ", Ctrl->A.moment[LEFT], Ctrl->A.force[LEFT]);
-				strcat (msg, txt);
-			}
-			if (Ctrl->A.bc[RIGHT] == BC_INFINITY) strcat (msg, "infinity at right edge.\n");
-			else if (Ctrl->A.bc[RIGHT] == BC_PERIODIC) strcat (msg, "periodic at right edge.\n");
-			else if (Ctrl->A.bc[RIGHT] == BC_CLAMPED) {
-				deflection[S->n_rows-1] = Ctrl->A.deflection[RIGHT];
-				sprintf (txt, "plate clamped with deflection = %g at right edge.\n", Ctrl->A.deflection[RIGHT]);
-				strcat (msg, txt);
-			}
-			else if (Ctrl->A.bc[RIGHT] == BC_FREE) {
-				deflection[S->n_rows-2] = -Ctrl->A.moment[RIGHT];	/* Minus-sign because of the +ve gives +ve convention */
-				deflection[S->n_rows-1] = Ctrl->A.force[RIGHT];
-				sprintf (txt, "plate free with Moment = %g and Force = %g at right edge.\n", Ctrl->A.moment[RIGHT], Ctrl->A.force[RIGHT]);
-				strcat (msg, txt);
-			}
-			GMT_Report (API, GMT_MSG_INFORMATION, msg);
-			for (row = 0, airy = true; airy && row < S->n_rows; row++)
-				if (rigidity[row] > 0.0) airy = false;
+	/* The boundary conditions apply to every profile so report them once */
 
-			if (airy) {	/* Airy compensation */
-				GMT_Report (API, GMT_MSG_INFORMATION, "Calculate flexure using Airy compensation\n");
-				for (row = 0; row < S->n_rows; row++) deflection[row] = load[row] / restore;
-			}
-			x_inc = S->data[GMT_X][1] - S->data[GMT_X][0];
-			if (Ctrl->M.active[0]) x_inc *= 1000.0;	/* Got x in km */
-
-			if (Ctrl->T.active) {	/* Plate has pre-existing deflection */
-				double *w0 = T->table[tbl]->segment[seg]->data[GMT_Y];
-				GMT_Report (API, GMT_MSG_INFORMATION, "Calculate flexure of pre-deformed surface\n");
-				error = gmtflexure_flx1dw0 (GMT, deflection, w0, rigidity, load, (int)S->n_rows, x_inc, &restore, 0, Ctrl->F.force, Ctrl->A.bc[LEFT], Ctrl->A.bc[RIGHT]);
-			}
-			else if (Ctrl->L.active) {
-				GMT_Report (API, GMT_MSG_INFORMATION, "Calculate flexure with variable restoring force\n");
-				error = gmtflexure_flx1dk (GMT, deflection, rigidity, load, (int)S->n_rows, x_inc, Ctrl->D.rhom, Ctrl->D.rhol, Ctrl->D.rhoi, Ctrl->D.rhow, Ctrl->F.force, Ctrl->A.bc[LEFT], Ctrl->A.bc[RIGHT]);
-			}
-			else {	/* Constant restoring force */
-				GMT_Report (API, GMT_MSG_INFORMATION, "Calculate flexure for constant restoring force\n");
-				error = gmtflexure_flx1d (GMT, deflection, rigidity, load, (int)S->n_rows, x_inc, &restore, 0, Ctrl->F.force, Ctrl->A.bc[LEFT], Ctrl->A.bc[RIGHT]);
-			}
-
-			if (error) {
-				GMT_Report (API, GMT_MSG_ERROR, "Flexure sub-function returned error = %d!\n", error);
-				Return (API->error);
-			}
-
-			if (Ctrl->S.active) {	/* Compute curvatures */
-				double *curvature = W->table[tbl]->segment[seg]->data[GMT_Z];
-				gmtflexure_get_curvature (deflection, (int)S->n_rows, x_inc, curvature);
-			}
-
-			/* Add in Moho depth, possibly convert back to km, and let z be positive up */
-			for (row = 0; row < S->n_rows; row++) {
-				deflection[row] = -(deflection[row] + Ctrl->Z.zm);
-				if (Ctrl->M.active[1]) deflection[row] /= 1000.0;	/* m -> km */
-			}
+	sprintf (msg, "BCs > ");
+	if (Ctrl->A.bc[LEFT] == BC_INFINITY) strcat (msg, "infinity at left edge + ");
+	else if (Ctrl->A.bc[LEFT] == BC_PERIODIC) strcat (msg, "periodic at left edge + ");
+	else if (Ctrl->A.bc[LEFT] == BC_CLAMPED) {
+		sprintf (txt, "plate clamped with deflection = %g at left edge + ", Ctrl->A.deflection[LEFT]);
+		strcat (msg, txt);
+	}
+	else if (Ctrl->A.bc[LEFT] == BC_FREE) {
+		sprintf (txt, "plate free with Moment = %g and Force = %g at left edge + ", Ctrl->A.moment[LEFT], Ctrl->A.force[LEFT]);
+		strcat (msg, txt);
+	}
+	if (Ctrl->A.bc[RIGHT] == BC_INFINITY) strcat (msg, "infinity at right edge.\n");
+	else if (Ctrl->A.bc[RIGHT] == BC_PERIODIC) strcat (msg, "periodic at right edge.\n");
+	else if (Ctrl->A.bc[RIGHT] == BC_CLAMPED) {
+		sprintf (txt, "plate clamped with deflection = %g at right edge.\n", Ctrl->A.deflection[RIGHT]);
+		strcat (msg, txt);
+	}
+	else if (Ctrl->A.bc[RIGHT] == BC_FREE) {
+		sprintf (txt, "plate free with Moment = %g and Force = %g at right edge.\n", Ctrl->A.moment[RIGHT], Ctrl->A.force[RIGHT]);
+		strcat (msg, txt);
+	}
+	GMT_Report (API, GMT_MSG_INFORMATION, msg);
+	if (Ctrl->T.active)
+		GMT_Report (API, GMT_MSG_INFORMATION, "Calculate flexure of pre-deformed surface\n");
+	else if (Ctrl->L.active)
+		GMT_Report (API, GMT_MSG_INFORMATION, "Calculate flexure with variable restoring force\n");
+	else
+		GMT_Report (API, GMT_MSG_INFORMATION, "Calculate flexure for constant restoring force\n");
+
+	/* Flatten the (table, segment) hierarchy so the independent profiles can be solved in
+	 * parallel; each thread keeps its own LU factorization so batch runs where the rigidity
+	 * does not change between profiles only pay for the substitution step */
+
+	for (tbl = 0; tbl < W->n_tables; tbl++) n_seg += W->table[tbl]->n_segments;
+	QS     = gmt_M_memory (GMT, NULL, n_seg, struct GMT_DATASEGMENT *);
+	ES     = gmt_M_memory (GMT, NULL, n_seg, struct GMT_DATASEGMENT *);
+	WS     = gmt_M_memory (GMT, NULL, n_seg, struct GMT_DATASEGMENT *);
+	if (T) TS = gmt_M_memory (GMT, NULL, n_seg, struct GMT_DATASEGMENT *);
+	status = gmt_M_memory (GMT, NULL, n_seg, int);
+	was_airy = gmt_M_memory (GMT, NULL, n_seg, bool);
+	for (tbl = 0, n_seg = 0; tbl < W->n_tables; tbl++) {
+		for (seg = 0; seg < W->table[tbl]->n_segments; seg++, n_seg++) {
+			QS[n_seg] = Q->table[tbl]->segment[seg];
+			ES[n_seg] = E->table[tbl]->segment[seg];
+			WS[n_seg] = W->table[tbl]->segment[seg];
+			if (T) TS[n_seg] = T->table[tbl]->segment[seg];
 		}
 	}
+#ifdef _OPENMP
+	n_threads = (unsigned int)omp_get_max_threads ();
+#endif
+	LU = gmt_M_memory (GMT, NULL, n_threads, struct GMTFLEXURE_LU);
+#ifdef _OPENMP
+#pragma omp parallel for private(sp) shared(GMT,Ctrl,QS,ES,TS,WS,n_seg,restore,LU,status,was_airy)
+#endif
+	for (sp = 0; sp < (openmp_int)n_seg; sp++) {
+		struct GMTFLEXURE_LU *LU_t = LU;
+#ifdef _OPENMP
+		LU_t = &LU[omp_get_thread_num ()];
+#endif
+		status[sp] = gmtflexure_solve_profile (GMT, Ctrl, QS[sp], ES[sp], (T) ? TS[sp] : NULL, WS[sp], restore, LU_t, &was_airy[sp]);
+	}
+	for (k = 0; k < n_threads; k++) gmtflexure_lu_free (GMT, &LU[k]);
+	gmt_M_free (GMT, LU);
+	for (seg = 0, n_airy = 0; seg < n_seg; seg++) if (was_airy[seg]) n_airy++;
+	if (n_airy) GMT_Report (API, GMT_MSG_INFORMATION, "Calculated flexure using Airy compensation for %" PRIu64 " profile(s) with zero rigidity\n", n_airy);
+	for (seg = 0; seg < n_seg; seg++) {
+		if (status[seg] == 0) continue;
+		GMT_Report (API, GMT_MSG_ERROR, "Flexure sub-function returned error = %d!\n", status[seg]);
+		gmt_M_free (GMT, QS);	gmt_M_free (GMT, ES);	gmt_M_free (GMT, WS);
+		gmt_M_free (GMT, TS);	gmt_M_free (GMT, status);	gmt_M_free (GMT, was_airy);
+		Return (API->error);
+	}
+	gmt_M_free (GMT, QS);	gmt_M_free (GMT, ES);	gmt_M_free (GMT, WS);
+	gmt_M_free (GMT, TS);	gmt_M_free (GMT, status);	gmt_M_free (GMT, was_airy);
 
 	if (GMT_Write_Data (API, GMT_IS_DATASET, GMT_IS_FILE, GMT_IS_LINE, GMT_WRITE_NORMAL, NULL, Ctrl->Out.file, W) != GMT_NOERROR) {
 		Return (API->error);
@@ -747,20 +747,19 @@ GMT_LOCAL void solids(struct GMT_CTRL *GMT, struct GMTGRAVMAG3D_CTRL *Ctrl) {
 
 EXTERN_MSC int GMT_gmtgravmag3d (void *V_API, int mode, void *args) {
 
-	bool bat = true, DO = true;
-	unsigned int row, col, i, j, k, kk;
-	unsigned int ndata_p = 0, nx_p, ny_p, n_vert_max;
+	bool bat = true;
+	unsigned int row, col, i, j, k;
+	unsigned int ndata_p = 0, nx_p, ny_p;
 	unsigned int z_th = 0, n_triang = 0, ndata_s = 0, n_swap = 0;
 	int error = 0;
-	uint64_t ij;
 	size_t nm;
 	int km, pm;		/* index of current body facet (for mag only) */
 	gmt_grdfloat	*g = NULL, one_100;
-	double	s_rad2, x_o, y_o, t_mag, a, DX, DY;
+	double	s_rad2, y_o, t_mag;
 	double	*x_obs = NULL, *y_obs = NULL, *z_obs = NULL, *x = NULL, *y = NULL, *cos_vec = NULL;
+	double	*x_row = NULL, *y_row = NULL;
 	double	cc_t, cs_t, s_t, lon_0 = 0, lat_0 = 0;
 
-	struct	LOC_OR *loc_or = NULL;
 	struct	BODY_VERTS *body_verts = NULL;
 	struct	BODY_DESC body_desc;
 	struct	GMTGRAVMAG3D_CTRL *Ctrl = NULL;
@@ -937,14 +936,6 @@ EXTERN_MSC int GMT_gmtgravmag3d (void *V_API, int mode, void *args) {
 		goto END;
 	}
 
-	/* Allocate a structure that will be used inside okabe().
-	   We do it here to avoid thousands of alloc/free that would result if done in okabe() */
-	n_vert_max = body_desc.n_v[0];
-	for (i = 1; i < body_desc.n_f; i++)
-		n_vert_max = MAX(body_desc.n_v[i], n_vert_max);
-
-	loc_or = gmt_M_memory (GMT, NULL, (n_vert_max+1), struct LOC_OR);
-
 	if (Ctrl->H.active) { /* 1e2 is a factor to obtain nT from magnetization in A/m */
 		cc_t = cos(Ctrl->H.m_dip*D2R)*cos((Ctrl->H.m_dec - 90.)*D2R);
 		cs_t = cos(Ctrl->H.m_dip*D2R)*sin((Ctrl->H.m_dec - 90.)*D2R);
@@ -1019,6 +1010,9 @@ EXTERN_MSC int GMT_gmtgravmag3d (void *V_API, int mode, void *args) {
 		cos_vec = gmt_M_memory (GMT, NULL, Gout->header->n_rows, double);
 		for (i = 0; i < Gout->header->n_rows; i++)
 			cos_vec[i] = (Ctrl->box.is_geog) ? cos(y[i]*D2R): 1;
+		/* Scratch station vectors so each grid row can be handed to okabe_vec in one batch */
+		x_row = gmt_M_memory (GMT, NULL, Gout->header->n_columns, double);
+		y_row = gmt_M_memory (GMT, NULL, Gout->header->n_columns, double);
 	}
 
 	error = GMT_NOERROR;
@@ -1038,36 +1032,26 @@ EXTERN_MSC int GMT_gmtgravmag3d (void *V_API, int mode, void *args) {
 		else if (Ctrl->T.raw || Ctrl->T.stl || Ctrl->M.active)
 			z_th = facet_raw (Ctrl, body_verts, i, Ctrl->box.is_geog);
 		if (z_th) {
+			/* Hand all stations of a row (or the whole polyline) to okabe_vec in one batch;
+			   it computes the facet angles only once per body and may thread the station loop */
+			double x_c = (Ctrl->S.active) ? Ctrl->t_center[i].x : 0.0;
+			double y_c = (Ctrl->S.active) ? Ctrl->t_center[i].y : 0.0;
+			double rad2 = (Ctrl->S.active) ? s_rad2 : 0.0;
 			if (Ctrl->G.active) { /* grid */
 				for (row = 0; row < Gout->header->n_rows; row++) {
 					y_o = (Ctrl->box.is_geog) ? ((y[row]+lat_0) * Ctrl->box.d_to_m): y[row];
-					ij = gmt_M_ijp(Gout->header, row, 0);
-					for (col = 0; col < Gout->header->n_columns; col++, ij++) {
-						x_o = (Ctrl->box.is_geog) ? ((x[col]-lon_0)*Ctrl->box.d_to_m * cos_vec[row]) : x[col];
-						if (Ctrl->S.active) {
-							DX = Ctrl->t_center[i].x - x_o;
-							DY = Ctrl->t_center[i].y - y_o;
-							DO = (DX*DX + DY*DY) < s_rad2;
-							if (!DO) continue;
-						}
-
-						a = okabe (GMT, x_o, y_o, Ctrl->L.zobs, Ctrl->C.rho, Ctrl->C.active, body_desc, body_verts, km, pm, loc_or, okabe_mag_param, okabe_mag_var);
-						Gout->data[ij] += (gmt_grdfloat)a;
-					}
-				}
-			}
-			else {		/* polygon */
-				for (kk = 0; kk < ndata_p; kk++){
-					if (Ctrl->S.active) {
-						DX = Ctrl->t_center[i].x - x_obs[kk];
-						DY = Ctrl->t_center[i].y - y_obs[kk];
-						DO = (DX*DX + DY*DY) < s_rad2;
-						if (!DO) continue;
+					for (col = 0; col < Gout->header->n_columns; col++) {
+						x_row[col] = (Ctrl->box.is_geog) ? ((x[col]-lon_0)*Ctrl->box.d_to_m * cos_vec[row]) : x[col];
+						y_row[col] = y_o;
 					}
-					a = okabe (GMT, x_obs[kk], y_obs[kk], Ctrl->L.zobs, Ctrl->C.rho, Ctrl->C.active, body_desc, body_verts, km, pm, loc_or, okabe_mag_param, okabe_mag_var);
-					g[kk] += (gmt_grdfloat)a;
+					okabe_vec (GMT, Gout->header->n_columns, x_row, y_row, Ctrl->L.zobs, Ctrl->C.rho, Ctrl->C.active,
+					           body_desc, body_verts, km, pm, okabe_mag_param, okabe_mag_var, x_c, y_c, rad2,
+					           &Gout->data[gmt_M_ijp(Gout->header, row, 0)]);
 				}
 			}
+			else		/* polygon */
+				okabe_vec (GMT, ndata_p, x_obs, y_obs, Ctrl->L.zobs, Ctrl->C.rho, Ctrl->C.active,
+				           body_desc, body_verts, km, pm, okabe_mag_param, okabe_mag_var, x_c, y_c, rad2, g);
 		}
 	}
 
@@ -1142,9 +1126,10 @@ END:
 	gmt_M_free (GMT, okabe_mag_var);
 	gmt_M_free (GMT, body_desc.n_v);
 	gmt_M_free (GMT, body_desc.ind);
-	gmt_M_free (GMT, loc_or);
 	gmt_M_free (GMT, body_verts);
 	gmt_M_free (GMT, cos_vec);
+	gmt_M_free (GMT, x_row);
+	gmt_M_free (GMT, y_row);
 	if (Ctrl->T.m_var1) gmt_M_free (GMT, Ctrl->box.mag_int);
 	if (Ctrl->T.m_var2) gmt_M_free (GMT, Ctrl->okabe_mag_var2);
 	if (Ctrl->T.m_var3) gmt_M_free (GMT, Ctrl->okabe_mag_var3);
@@ -146,6 +146,7 @@ struct GRDFLEXURE_RHEOLOGY {	/* Used to pass parameters in/out of functions */
 	double dens_ratio;	/* (Ctrl->D.rhom - Ctrl->D.rhoi) / Ctrl->D.rhom */
 	bool relative;		/* eval_time_yr is relative to load time [at 0] */
 	bool isotropic;		/* true when no inplane forces are set (no -A) */
+	bool time_dependent;	/* true when the transfer function varies with load or evaluation time */
 	double (*transfer) (double *, struct GRDFLEXURE_RHEOLOGY *);	/* pointer to function returning isostatic response for given k and R */
 	double (*tr_elastic_sub) (double *, struct GRDFLEXURE_RHEOLOGY *);	/* pointer to sub-function returning elastic isostatic response for given k and R */
 	void (*setup) (struct GMT_CTRL *, struct GRDFLEXURE_CTRL *, struct GRDFLEXURE_RHEOLOGY *);	/* Init function */
@@ -158,6 +159,15 @@ struct GRDFLEXURE_GRID {
 	double rho_load;			/* Density of this load layer (may be constant or variable with time) */
 };
 
+struct GRDFLEXURE_TF_CACHE {	/* Holds evaluated wavenumber-domain response so repeated loads and time steps can skip re-evaluation */
+	gmt_grdfloat *tf;	/* One response value per complex node pair [NULL until allocated] */
+	double rho_load;	/* Load density the cached response was evaluated for */
+	double eval_time_yr;	/* Evaluation time --"-- */
+	double load_time_yr;	/* Load time --"-- */
+	bool relative;		/* Time interpretation --"-- */
+	bool valid;		/* true once tf holds the response for the parameters above */
+};
+
 #define	YOUNGS_MODULUS	7.0e10		/* Pascal = Nt/m**2  */
 #define	NORMAL_GRAVITY	9.806199203	/* Moritz's 1980 IGF value for gravity at 45 degrees latitude (m/s) */
 #define	POISSONS_RATIO	0.25
@@ -644,27 +654,65 @@ GMT_LOCAL double grdflexure_transfer_v2 (double *k, struct GRDFLEXURE_RHEOLOGY *
 	return (R->scale * phi_v2);
 }
 
-GMT_LOCAL void grdflexure_apply_transfer_function (struct GMT_CTRL *GMT, struct GMT_GRID *Grid, struct GRDFLEXURE_CTRL *Ctrl, struct GMT_FFT_WAVENUMBER *K, struct GRDFLEXURE_RHEOLOGY *R) {
-	/* Do the spectral convolution for isostatic response in the Freq domain. */
-	uint64_t k;
-	double  mk[3], grdflexure_transfer_fn;
+GMT_LOCAL void grdflexure_apply_transfer_function (struct GMT_CTRL *GMT, struct GMT_GRID *Grid, struct GRDFLEXURE_CTRL *Ctrl, struct GMT_FFT_WAVENUMBER *K, struct GRDFLEXURE_RHEOLOGY *R, struct GRDFLEXURE_TF_CACHE *C) {
+	/* Do the spectral convolution for isostatic response in the Freq domain.
+	 * The evaluated response only depends on the load density and (for time-dependent rheologies) the
+	 * load and evaluation times, so we cache it in C and reuse it when those parameters are unchanged.
+	 * For an elastic or Airy rheology this means the response is evaluated once per run no matter how
+	 * many loads and -T time steps are processed. */
+	bool reuse;
+	openmp_int row, n_c_rows;
+	uint64_t k, node, n_c_cols = (uint64_t)K->nx2;
 
 	GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "Apply the Transfer Function\n");
 	R->setup (GMT, Ctrl, R);	/* Set up parameters */
 
-	/* Loop over complex grid and multiply with the real transfer function */
-	for (k = 0; k < Grid->header->size; k += 2) {
-		if (R->isotropic)	/* No in-plane forcing */
-			mk[GMT_FFT_K_IS_KR] = gmt_fft_get_wave (k, K);	/* Radial wavenumber */
-		else {	/* Need kx, ky, and kr */
-			mk[GMT_FFT_K_IS_KX] = gmt_fft_any_wave (k, GMT_FFT_K_IS_KX, K);		/* kx wavenumber */
-			mk[GMT_FFT_K_IS_KY] = gmt_fft_any_wave (k, GMT_FFT_K_IS_KY, K);		/* kx wavenumber */
-			mk[GMT_FFT_K_IS_KR] = hypot (mk[GMT_FFT_K_IS_KX], mk[GMT_FFT_K_IS_KY]);	/* kr wavenumber */
+	reuse = (C->valid && C->rho_load == Ctrl->D.rhol && (!R->time_dependent ||
+	        (C->eval_time_yr == R->eval_time_yr && C->load_time_yr == R->load_time_yr && C->relative == R->relative)));
+	n_c_rows = (openmp_int)(Grid->header->size / (2 * n_c_cols));	/* Rows of complex node pairs */
+
+	if (reuse) {	/* Just multiply the complex grid with the cached response */
+		GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Reuse cached transfer function\n");
+#ifdef _OPENMP
+#pragma omp parallel for private(row,k,node) shared(n_c_rows,n_c_cols,Grid,C)
+#endif
+		for (row = 0; row < n_c_rows; row++) {
+			node = 2 * (uint64_t)row * n_c_cols;
+			for (k = node; k < node + 2 * n_c_cols; k += 2) {
+				Grid->data[k]   *= C->tf[k/2];
+				Grid->data[k+1] *= C->tf[k/2];
+			}
+		}
+		return;
+	}
+
+	/* Loop over complex grid, evaluate and cache the real transfer function, and multiply */
+#ifdef _OPENMP
+#pragma omp parallel for private(row,k,node) shared(n_c_rows,n_c_cols,Grid,C,K,R)
+#endif
+	for (row = 0; row < n_c_rows; row++) {
+		double mk[3], grdflexure_transfer_fn;
+		node = 2 * (uint64_t)row * n_c_cols;
+		for (k = node; k < node + 2 * n_c_cols; k += 2) {
+			if (R->isotropic)	/* No in-plane forcing */
+				mk[GMT_FFT_K_IS_KR] = gmt_fft_get_wave (k, K);	/* Radial wavenumber */
+			else {	/* Need kx, ky, and kr */
+				mk[GMT_FFT_K_IS_KX] = gmt_fft_any_wave (k, GMT_FFT_K_IS_KX, K);		/* kx wavenumber */
+				mk[GMT_FFT_K_IS_KY] = gmt_fft_any_wave (k, GMT_FFT_K_IS_KY, K);		/* kx wavenumber */
+				mk[GMT_FFT_K_IS_KR] = hypot (mk[GMT_FFT_K_IS_KX], mk[GMT_FFT_K_IS_KY]);	/* kr wavenumber */
+			}
+			grdflexure_transfer_fn = R->transfer (mk, R);
+			C->tf[k/2] = (gmt_grdfloat)grdflexure_transfer_fn;
+			Grid->data[k] *= C->tf[k/2];
+			Grid->data[k+1] *= C->tf[k/2];
 		}
-		grdflexure_transfer_fn = R->transfer (mk, R);
-		Grid->data[k] *= (gmt_grdfloat)grdflexure_transfer_fn;
-		Grid->data[k+1] *= (gmt_grdfloat)grdflexure_transfer_fn;
 	}
+	/* Record what the cached response was evaluated for */
+	C->rho_load = Ctrl->D.rhol;
+	C->eval_time_yr = R->eval_time_yr;
+	C->load_time_yr = R->load_time_yr;
+	C->relative = R->relative;
+	C->valid = true;
 }
 
 static int parse (struct GMT_CTRL *GMT, struct GRDFLEXURE_CTRL *Ctrl, struct GMT_OPTION *options) {
@@ -1114,6 +1162,7 @@ GMT_LOCAL struct GRDFLEXURE_RHEOLOGY *grdflexure_select_rheology (struct GMT_CTR
 			R->setup = grdflexure_setup_fv2;		R->transfer = grdflexure_transfer_v2;		break;
 	}
 	R->mode = fmode;
+	R->time_dependent = (fmode > FLX_E);	/* Only Airy and elastic responses are independent of time */
 
 	return (R);
 }
@@ -1206,6 +1255,7 @@ EXTERN_MSC int GMT_grdflexure (void *V_API, int mode, void *args) {
 
 	struct GMT_FFT_WAVENUMBER *K = NULL;
 	struct GRDFLEXURE_RHEOLOGY *R = NULL;
+	struct GRDFLEXURE_TF_CACHE TF_cache = {NULL, 0.0, 0.0, 0.0, false, false};
 	struct GRDFLEXURE_GRID **Load = NULL, *This_Load = NULL;
 	struct GMT_GRID *Out = NULL, *Grid_A = NULL;
 	struct GMT_DATASET *L = NULL;
@@ -1321,6 +1371,7 @@ EXTERN_MSC int GMT_grdflexure (void *V_API, int mode, void *args) {
 		}
 	}
 	K = Load[0]->K;	/* We only need one pointer to get to wavenumbers as they are all the same for all grids */
+	TF_cache.tf = gmt_M_memory (GMT, NULL, Load[0]->Grid->header->size / 2, gmt_grdfloat);	/* Response cache; all grids are coregistered */
 	fixed_rho_load = Ctrl->D.rhol;	/* Remember the setting since we may change it temporarily below */
 
 	/* 3. DETERMINE AND POSSIBLY CREATE ONE OUTPUT GRID */
@@ -1383,7 +1434,7 @@ EXTERN_MSC int GMT_grdflexure (void *V_API, int mode, void *args) {
 			/* 4b. COMPUTE THE RESPONSE DUE TO THIS LOAD */
 			Ctrl->D.rhol = This_Load->rho_load;	/* Since it may be variable and grdflexure_apply_transfer_function uses Ctrl->D.rhol to set things up */
 			if (retain_original) gmt_M_memcpy (orig_load, This_Load->Grid->data, This_Load->Grid->header->size, gmt_grdfloat);	/* Make a copy of H(kx,ky) before operations */
-			grdflexure_apply_transfer_function (GMT, This_Load->Grid, Ctrl, This_Load->K, R);	/* Multiplies H(kx,ky) by transfer function, yielding W(kx,ky) */
+			grdflexure_apply_transfer_function (GMT, This_Load->Grid, Ctrl, This_Load->K, R, &TF_cache);	/* Multiplies H(kx,ky) by transfer function, yielding W(kx,ky) */
 			if (retain_original) {	/* Must add this contribution to our total output grid */
 				grdflexure_accumulate_solution (GMT, Out, This_Load->Grid);
 				gmt_M_memcpy (This_Load->Grid->data, orig_load, This_Load->Grid->header->size, gmt_grdfloat);	/* Restore H(kx,ky) to what it was before operations */
@@ -1463,6 +1514,7 @@ cleanup_time:
 	}
 	gmt_M_free (GMT, Load);
 	gmt_M_free (GMT, R);
+	gmt_M_free (GMT, TF_cache.tf);
 	if (retain_original) gmt_M_free (GMT, orig_load);
 
 	Return (error);
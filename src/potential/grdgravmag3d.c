@@ -1200,7 +1200,8 @@ GMT_LOCAL void grdgravmag3d_calc_surf_ (struct THREAD_STRUCT *t) {
 	/* Do the actual work. This function is called in either threaded and non-threaded cases. */
 
 	char   tabs[16] = {""}, frmt[64] = {""};
-	unsigned int row, col, k, i, km = 0, pm = 0, indf;
+	unsigned int row, col, km = 0, pm = 0, indf;
+	openmp_int k, i;
 	double rho_or_mag, x_o, y_o, tmp = 1, a, DX, DY = 0.0, s_rad2;
 	double out_igrf[7], *igrf_dip = NULL, *igrf_dec = NULL;		/* Row vectors for the case where we will need to compute IGRF params */
 	struct BODY_VERTS *body_verts = NULL;
@@ -1297,7 +1298,12 @@ GMT_LOCAL void grdgravmag3d_calc_surf_ (struct THREAD_STRUCT *t) {
 			}
 
 			if (Ctrl->G.active) {
-				for (k = 0; k < Gout->header->n_rows; k++) {            /* Loop over output grid rows */
+				/* Each station writes its own output node so the station loop threads trivially; the
+				   if clause leaves all the parallelism to the row-based gthreads when -x asked for them */
+#ifdef _OPENMP
+#pragma omp parallel for if (GMT->common.x.n_threads <= 1) private(k,i,y_o,x_o,tmp,DX,DY,a) shared(GMT,Ctrl,Gout,body_desc,body_verts,x_obs,y_obs,loc_or,okabe_mag_param,okabe_mag_var,rho_or_mag,km,pm,indf,s_rad2,d_func)
+#endif
+				for (k = 0; k < (openmp_int)Gout->header->n_rows; k++) {            /* Loop over output grid rows */
 					y_o = (Ctrl->box.is_geog) ? (y_obs[k] + Ctrl->box.lat_0) * Ctrl->box.d_to_m : y_obs[k]; /* +lat_0 because y was already *= -1 */
 					if (Ctrl->S.active) {
 						DY = body_verts[0].y - y_o;
@@ -1305,8 +1311,8 @@ GMT_LOCAL void grdgravmag3d_calc_surf_ (struct THREAD_STRUCT *t) {
 						DY *= DY;                                   /* Square it right away */
 					}
 
-					if (Ctrl->box.is_geog) tmp = Ctrl->box.d_to_m * cos(y_obs[k]*D2R);
-					for (i = 0; i < Gout->header->n_columns; i++) {        /* Loop over output grid cols */
+					tmp = (Ctrl->box.is_geog) ? Ctrl->box.d_to_m * cos(y_obs[k]*D2R) : 1.0;
+					for (i = 0; i < (openmp_int)Gout->header->n_columns; i++) {        /* Loop over output grid cols */
 						x_o = (Ctrl->box.is_geog) ? (x_obs[i] - Ctrl->box.lon_0) * tmp : x_obs[i];
 						if (Ctrl->S.active) {
 							DX = body_verts[0].x - x_o;             /* Use the first vertex to estimate distance. Approximate but good enough */
@@ -1318,7 +1324,10 @@ GMT_LOCAL void grdgravmag3d_calc_surf_ (struct THREAD_STRUCT *t) {
 				}
 			}
 			else {                                                  /* Compute on a polyline only */
-				for (k = 0; k < n_pts; k++)
+#ifdef _OPENMP
+#pragma omp parallel for if (GMT->common.x.n_threads <= 1) private(k) shared(GMT,Ctrl,g,n_pts,x_obs,y_obs,body_desc,body_verts,km,pm,loc_or,okabe_mag_param,okabe_mag_var,rho_or_mag,indf,d_func)
+#endif
+				for (k = 0; k < (openmp_int)n_pts; k++)
 					g[k] += d_func[indf](GMT, x_obs[k], y_obs[k], Ctrl->L.zobs, rho_or_mag, Ctrl->C.active,
 					                     *body_desc, body_verts, km, pm, loc_or, okabe_mag_param, okabe_mag_var);
 			}
@@ -1451,18 +1451,19 @@ GMT_LOCAL double grdseamount_volume_flux_curve (struct GRDSEAMOUNT_CTRL *Ctrl, s
 
 EXTERN_MSC int GMT_grdseamount (void *V_API, int mode, void *args) {
 	bool map = false, periodic = false, replicate, first, empty_grid, exact, exact_increments, cone_increments, z_is_NaN = false;
+	bool reuse_done = false, add_to_done = false, *finished = NULL;
 
 	int scol, srow, scol_0, srow_0, error;
 
 	openmp_int row, col, max_d_col, delta_rows, nx1, *delta_cols = NULL;
 
-	unsigned int distance_mode, inc_mode, t, t_use;
+	unsigned int distance_mode, inc_mode, t, t_use, n_threads = 1, tt;
 
-	uint64_t node, n_smts, smt;
+	uint64_t node, n_smts, smt, n_changed = 0;
 
 	char gfile[PATH_MAX] = {""}, wfile[PATH_MAX] = {""};
 
-	gmt_grdfloat *data = NULL, *current = NULL, *previous = NULL, *rho_weight = NULL, *prev_z = NULL;
+	gmt_grdfloat *data = NULL, *current = NULL, *previous = NULL, *rho_weight = NULL, *prev_z = NULL, *done = NULL;
 
 	double this_r, dV, scale_curr = 1.0, major, minor, z_assign, this_user_time = 0.0;
 	double normalized_untruncated_height, normalized_truncated_height, max_height, r_km, amplitude = 0.0;
@@ -1470,7 +1471,7 @@ EXTERN_MSC int GMT_grdseamount (void *V_API, int mode, void *args) {
 	double prev_user_time = 0.0, h_curr = 0.0, h_prev = 0.0, h0, pf, phi_prev, phi_curr, r_boost = 1.0;
 	double thickness, rho_z, sum_rz, sum_z, r_max, tau = 1.0, theta, psi = 1.0, h0_scale = 1.0, ABC[3], f;
 
-	double *V_sum = NULL, *h_sum = NULL, *h = NULL, *V = NULL;
+	double *V_sum = NULL, *h_sum = NULL, *h = NULL, *V = NULL, *zmax = NULL;
 
 	double (*pappas_func[N_SHAPES]) (double r0, double h0, double f, double r1, double r2);
 	double (*phi_solver[N_SHAPES]) (struct SEAMOUNT *S, double f, double v, bool elliptical);
@@ -1659,6 +1660,18 @@ EXTERN_MSC int GMT_grdseamount (void *V_API, int mode, void *args) {
 	if (exact) current  = gmt_M_memory (GMT, NULL, Grid->header->size, gmt_grdfloat);	/* current time solution */
 	if (exact_increments) previous = gmt_M_memory (GMT, NULL, Grid->header->size, gmt_grdfloat);	/* previous time solution */
 	if (Ctrl->W.active && exact_increments) prev_z = gmt_M_memory (GMT, NULL, Grid->header->size, gmt_grdfloat);	/* Keep track of previous height */
+	/* In exact mode a seamount (and its slides) that has reached its final shape contributes the same heights to every
+	 * later time step.  Unless those heights are post-processed per step (mask, density or normalization output) we
+	 * accumulate each finished seamount once in the done grid and skip it thereafter */
+	reuse_done = (exact && !Ctrl->A.mask && !Ctrl->W.active && !Ctrl->N.active);
+	if (reuse_done) {
+		done = gmt_M_memory (GMT, NULL, Grid->header->size, gmt_grdfloat);	/* Sum of all final-shape seamounts */
+		finished = gmt_M_memory (GMT, NULL, n_smts, bool);	/* True once a seamount has been added to done */
+	}
+#ifdef _OPENMP
+	n_threads = (unsigned int)omp_get_max_threads ();
+#endif
+	zmax = gmt_M_memory (GMT, NULL, n_threads, double);	/* Per-thread max height trackers */
 
 	for (t = t_use = 0; t < Ctrl->T.n_times; t++) {	/* For each time step (or just once) */
 
@@ -1667,19 +1680,31 @@ EXTERN_MSC int GMT_grdseamount (void *V_API, int mode, void *args) {
 			this_user_time = Ctrl->T.time[t].value;	/* In years */
 			GMT_Report (API, GMT_MSG_INFORMATION, "Evaluating bathymetry for time %s\n", Ctrl->T.time[t].tag);
 		}
-		if (Ctrl->Q.bmode == SMT_INCREMENTAL || exact)
-			gmt_M_memset (Grid->data, Grid->header->size, gmt_grdfloat);	/* Wipe clean for next increment */
+		if (Ctrl->Q.bmode == SMT_INCREMENTAL || exact) {	/* Wipe clean for next increment */
+			if (reuse_done)	/* Start from the sum of all seamounts that have reached their final shape */
+				gmt_M_memcpy (Grid->data, done, Grid->header->size, gmt_grdfloat);
+			else
+				gmt_M_memset (Grid->data, Grid->header->size, gmt_grdfloat);
+		}
 
 		max_height = -DBL_MAX;
-		empty_grid = true;	/* So far, no seamounts have left a contribution */
+		for (tt = 0; tt < n_threads; tt++) zmax[tt] = -DBL_MAX;
+		n_changed = 0;	/* So far, no seamounts have left a contribution */
 
 		/* 2. VISIT ALL SEAMOUNTS */
 		for (smt = 0; smt < n_smts; smt++) {
 			if (Ctrl->T.active) {	/* Check if outside time-range */
 				if (this_user_time >= S[smt].t0) continue;	/* Not started growing yet */
 				if (this_user_time <  S[smt].t1 && !exact) continue;	/* Completed so making no contribution to incremental discs */
+				if (reuse_done && finished[smt]) continue;	/* Final contribution already accumulated in the done grid */
 			}
 			gmt_M_memcpy (&this_smt, &S[smt], 1, struct SEAMOUNT);	/* Make a copy so we can modify if needed */
+			if (reuse_done) {	/* Determine if this seamount (and any slides) has now reached its final shape */
+				unsigned int slide;
+				add_to_done = (this_user_time < this_smt.t1);	/* Done growing */
+				for (slide = 0; slide < this_smt.n_slides; slide++)
+					if (this_user_time >= this_smt.Slide[slide].t1) add_to_done = false;	/* Slide still pending or active */
+			}
 			(void)(gmt_x_is_outside (GMT, &this_smt.lon, wesn[XLO], wesn[XHI])); /* May return periodically shifted longitude */
 
 			if (!cone_increments) inc_mode = this_smt.build_mode;
@@ -1814,7 +1839,14 @@ EXTERN_MSC int GMT_grdseamount (void *V_API, int mode, void *args) {
 			gmt_M_free (GMT, delta_cols);
 			delta_cols = gmt_prep_nodesearch (GMT, Grid, r_max, distance_mode, &delta_rows, &max_d_col);
 
+#ifdef _OPENMP
+#pragma omp parallel for private(srow,row,col,scol,x,y,first,this_r,r_normalized,normalized_truncated_height,normalized_untruncated_height,z_assign,node,thickness,rho,rho_z) shared(GMT,Ctrl,Grid,Ave,this_smt,delta_cols,delta_rows,scol_0,srow_0,periodic,nx1,replicate,r_max,r_km,r_boost,major,amplitude,h0_scale,f,inc_mode,z_is_NaN,exact,exact_increments,prev_z,rho_weight,done,add_to_done,zmax,this_user_time,ABC) reduction(+:sum_rz,sum_z,n_changed)
+#endif
 			for (srow = srow_0 - (int)delta_rows; srow <= (srow_0 + (int)delta_rows); srow++) {
+				unsigned int tid = 0;	/* Which of the zmax slots to update [0 unless under OpenMP] */
+#ifdef _OPENMP
+				tid = (unsigned int)omp_get_thread_num ();
+#endif
 				if (srow < 0) continue;	/* Above grid area */
 				if ((row = (openmp_int)srow) >= (openmp_int)Grid->header->n_rows) continue;	/* Below grid area */
 				y = gmt_M_grd_row_to_y (GMT, row, Grid->header);	/* Current node latitude or y */
@@ -1883,7 +1915,8 @@ EXTERN_MSC int GMT_grdseamount (void *V_API, int mode, void *args) {
 					else {	/* Add in contribution and keep track of max height */
 						if (z_is_NaN && gmt_M_is_fnan (Grid->data[node])) Grid->data[node] = 0.0;	/* Must first change NaN to 0 before we can add */
 						Grid->data[node] += (gmt_grdfloat)z_assign;
-						if (Grid->data[node] > max_height) max_height = Grid->data[node];
+						if (add_to_done) done[node] += (gmt_grdfloat)z_assign;	/* This seamount is final so bank its contribution */
+						if (Grid->data[node] > zmax[tid]) zmax[tid] = Grid->data[node];
 					}
 					if (Ctrl->W.active) {	/* Must accumulate the average vertical density */
 						/* When -T is not active then we build the complete seamount as is.  In that case
@@ -1907,6 +1940,7 @@ EXTERN_MSC int GMT_grdseamount (void *V_API, int mode, void *args) {
 							if (Ctrl->A.mask) Grid->data[node+nx1] = Ctrl->A.value[GMT_IN]; else {
 								if (z_is_NaN && gmt_M_is_fnan (Grid->data[node+nx1])) Grid->data[node+nx1] = 0.0;	/* Must first change NaN to 0 before we can add */
 								Grid->data[node+nx1] += (gmt_grdfloat)z_assign;
+								if (add_to_done) done[node+nx1] += (gmt_grdfloat)z_assign;
 							}
 							if (Ctrl->W.active) {	/* Must accumulate the average vertical density */
 								Ave->data[node+nx1]  += (gmt_grdfloat)rho_z;
@@ -1917,6 +1951,7 @@ EXTERN_MSC int GMT_grdseamount (void *V_API, int mode, void *args) {
 						else if (col == nx1) {	/* Must copy from x_max to repeated column at x_min */
 							if (Ctrl->A.mask) Grid->data[node-nx1] = Ctrl->A.value[GMT_IN]; else {
 								Grid->data[node-nx1] += (gmt_grdfloat)z_assign;
+								if (add_to_done) done[node-nx1] += (gmt_grdfloat)z_assign;
 								if (z_is_NaN && gmt_M_is_fnan (Grid->data[node-nx1])) Grid->data[node-nx1] = 0.0;	/* Must first change NaN to 0 before we can add */
 							}
 							if (Ctrl->W.active) {	/* Must accumulate the average vertical density */
@@ -1926,15 +1961,18 @@ EXTERN_MSC int GMT_grdseamount (void *V_API, int mode, void *args) {
 							first = false;
 						}
 					}
-					empty_grid = false;	/* We have made a change to this grid */
+					n_changed++;	/* We have made a change to this grid */
 				}
 			}
+			if (add_to_done) finished[smt] = true;	/* From now on this seamount is served from the done grid */
 			if (sum_z > 0.0) {	/* This is only true when -H -W are used */
 				double mean_rho = sum_rz / sum_z;
 				GMT_Report (API, GMT_MSG_INFORMATION, "Seamount # %d mean density: %g\n", n_smts, mean_rho);
 			}
 		}
 		prev_user_time = this_user_time;	/* Make this the previous time */
+		for (tt = 0; tt < n_threads; tt++) if (zmax[tt] > max_height) max_height = zmax[tt];	/* Combine the per-thread maxima */
+		empty_grid = (n_changed == 0);
 		if (empty_grid && Ctrl->T.active) {	/* No contribution made */
 			GMT_Report (API, GMT_MSG_INFORMATION, "No contribution made for time %s\n", Ctrl->T.time[t].tag);
 			if (exact && !exact_increments) gmt_M_memcpy (Grid->data, current, Grid->header->size, float);	/* Nothing new added so same cumulative surface as last step */
@@ -2028,6 +2066,7 @@ wrap_up:
 	gmt_M_free (GMT, current);	gmt_M_free (GMT, previous);
 	gmt_M_free (GMT, delta_cols);	gmt_M_free (GMT, V);		gmt_M_free (GMT, h);
 	gmt_M_free (GMT, V_sum);	gmt_M_free (GMT, h_sum);	gmt_M_free (GMT, data);
+	gmt_M_free (GMT, done);		gmt_M_free (GMT, finished);	gmt_M_free (GMT, zmax);
 	if (Ctrl->W.active) gmt_M_free (GMT, rho_weight);
 	if (Ctrl->W.active && exact_increments) gmt_M_free (GMT, prev_z);
 
@@ -53,6 +53,10 @@ static struct GMT_KEYWORD_DICTIONARY module_kw[] = {
 	          "",                  "",
 	          "",                  "",
 		  GMT_TP_STANDARD },
+	{ 0, 'T', "",
+	          "",                  "",
+	          "",                  "",
+		  GMT_TP_STANDARD },
 	{ 0, 'Z', "",
 	          "",                  "",
 	          "",                  "",
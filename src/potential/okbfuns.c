@@ -24,6 +24,10 @@ GMT_LOCAL double eq_30 (double c, double s, double x, double y, double z);
 GMT_LOCAL double eq_43 (double mz, double c, double tg, double auxil, double x, double y, double z);
 GMT_LOCAL void rot_17 (unsigned int n_vert, bool top, struct LOC_OR *loc_or, double *c_tet, double *s_tet,
 	double *c_phi, double *s_phi);
+GMT_LOCAL void okb_facet_angles (double xi, double yi, double zi, double xj, double yj, double zj,
+	double xk, double yk, double zk, double *c_tet, double *s_tet, double *c_phi, double *s_phi);
+GMT_LOCAL void okb_rotate (unsigned int n_vert, struct LOC_OR *loc_or, double c_tet, double s_tet,
+	double c_phi, double s_phi);
 
 /*--------------------------------------------------------------------*/
 double okabe (struct GMT_CTRL *GMT, double x_o, double y_o, double z_o, double rho, bool is_grav,
@@ -105,46 +109,127 @@ double okabe (struct GMT_CTRL *GMT, double x_o, double y_o, double z_o, double r
 	return (okb);
 }
 
+/*--------------------------------------------------------------------*/
+void okabe_vec (struct GMT_CTRL *GMT, unsigned int n_obs, double *x_obs, double *y_obs, double z_o, double rho,
+                bool is_grav, struct BODY_DESC bd_desc, struct BODY_VERTS *body_verts, unsigned int km, unsigned int pm,
+                struct MAG_PARAM *okabe_mag_param, struct MAG_VAR *okabe_mag_var, double x_c, double y_c, double rad2,
+                gmt_grdfloat *g) {
+
+	/* Batch version of okabe(): accumulate the anomaly of one body at the n_obs observation
+	 * points (x_obs[k], y_obs[k], z_o) into g[k].  The facet rotation angles of eq (17) do not
+	 * depend on the observation point (only coordinate differences enter them), so here they
+	 * are computed once per facet instead of once per station-facet pair, and the station loop
+	 * is free of any shared state so it can run in parallel.  If rad2 > 0 then only stations
+	 * within that squared distance from (x_c, y_c) are computed [used to honor -S culling]. */
+
+	openmp_int k;
+	unsigned int i, l, kv, cnt_v = 0, n_vert;
+	double c_tet[32], s_tet[32], c_phi[32], s_phi[32];
+
+	if (bd_desc.n_f > 32) {	/* No body built in GMT has that many facets, but play safe and do it the slow way */
+		for (k = 0; k < (openmp_int)n_obs; k++) {
+			if (rad2 > 0.0 && (pow (x_c - x_obs[k], 2.0) + pow (y_c - y_obs[k], 2.0)) >= rad2) continue;
+			g[k] += (gmt_grdfloat)okabe (GMT, x_obs[k], y_obs[k], z_o, rho, is_grav, bd_desc, body_verts, km, pm, NULL, okabe_mag_param, okabe_mag_var);
+		}
+		return;
+	}
+
+	for (i = 0; i < bd_desc.n_f; i++) {	/* Compute the rotation angles of each facet only once */
+		n_vert = bd_desc.n_v[i];
+		if (n_vert < 3)
+			GMT_Report (GMT->parent, GMT_MSG_WARNING, "Facet with less than 3 vertex\n");
+		okb_facet_angles (body_verts[bd_desc.ind[cnt_v]].x,   body_verts[bd_desc.ind[cnt_v]].y,   body_verts[bd_desc.ind[cnt_v]].z,
+		                  body_verts[bd_desc.ind[cnt_v+1]].x, body_verts[bd_desc.ind[cnt_v+1]].y, body_verts[bd_desc.ind[cnt_v+1]].z,
+		                  body_verts[bd_desc.ind[cnt_v+2]].x, body_verts[bd_desc.ind[cnt_v+2]].y, body_verts[bd_desc.ind[cnt_v+2]].z,
+		                  &c_tet[i], &s_tet[i], &c_phi[i], &s_phi[i]);
+		cnt_v += n_vert;
+	}
+
+#ifdef _OPENMP
+#pragma omp parallel for private(k,i,l,kv,cnt_v,n_vert) shared(GMT,n_obs,x_obs,y_obs,z_o,rho,is_grav,bd_desc,body_verts,km,pm,okabe_mag_param,okabe_mag_var,x_c,y_c,rad2,g,c_tet,s_tet,c_phi,s_phi)
+#endif
+	for (k = 0; k < (openmp_int)n_obs; k++) {	/* Loop over the stations */
+		double okb = 0.0, dx, dy;
+		struct LOC_OR loc_or[32];
+
+		if (rad2 > 0.0) {	/* Only compute the stations inside the culling radius */
+			dx = x_c - x_obs[k];	dy = y_c - y_obs[k];
+			if ((dx * dx + dy * dy) >= rad2) continue;
+		}
+		for (i = 0, cnt_v = 0; i < bd_desc.n_f; i++) {	/* Loop over facets */
+			n_vert = bd_desc.n_v[i];	/* Number of vertices of each face */
+			for (l = 0; l < n_vert; l++) {
+				kv = bd_desc.ind[l+cnt_v];
+				loc_or[l].x = body_verts[kv].x - x_obs[k];
+				loc_or[l].y = body_verts[kv].y - y_obs[k];
+				loc_or[l].z = body_verts[kv].z - z_o;
+			}
+			loc_or[n_vert].x = loc_or[0].x;		loc_or[n_vert].y = loc_or[0].y;
+			loc_or[n_vert].z = loc_or[0].z;		/* Last point = first point */
+			okb_rotate (n_vert, loc_or, c_tet[i], s_tet[i], c_phi[i], s_phi[i]);
+			okb += (is_grav) ? okb_grv (n_vert, loc_or, c_phi[i]) :
+					okb_mag (n_vert, km, pm, loc_or, c_tet[i], s_tet[i], c_phi[i], s_phi[i], okabe_mag_param, okabe_mag_var);
+			cnt_v += n_vert;
+		}
+		if (is_grav) okb *= rho;
+		g[k] += (gmt_grdfloat)okb;
+	}
+}
+
+/* ---------------------------------------------------------------------- */
+GMT_LOCAL void okb_facet_angles (double xi, double yi, double zi, double xj, double yj, double zj,
+                                 double xk, double yk, double zk, double *c_tet, double *s_tet, double *c_phi, double *s_phi) {
+	/* Compute the teta and phi rotation angles of equation (17) of Okabe from the first three
+	 * vertices of a facet. Only coordinate differences enter, so the angles are the same no
+	 * matter if the vertices were already translated to the observation point or not. */
+	double r, r2, r_3d, Sxy, Szx, Syz;
+
+	Sxy = xi * (yj - yk) + xj * (yk - yi) + xk * (yi - yj);
+	Syz = yi * (zj - zk) + yj * (zk - zi) + yk * (zi - zj);
+	Szx = zi * (xj - xk) + zj * (xk - xi) + zk * (xi - xj);
+	r2 = Syz * Syz + Szx * Szx;
+	r = sqrt(r2);
+	r_3d = sqrt(r2 + Sxy * Sxy);
+	*c_phi = - Sxy / r_3d;
+	*s_phi = r / r_3d;
+
+	if (Szx == 0.0 && Syz == 0.0) {*c_tet = 1.0;	*s_tet = 0.0;}
+	else {*c_tet = - Syz / r;	*s_tet = - Szx / r;}
+}
+
+/* ---------------------------------------------------------------------- */
+GMT_LOCAL void okb_rotate (unsigned int n_vert, struct LOC_OR *loc_or, double c_tet, double s_tet,
+                           double c_phi, double s_phi) {
+	/* Apply the rotation of equation (17) of Okabe to the n_vert+1 translated vertices */
+	double v, x, y, z;
+	unsigned int l;
+
+	for (l = 0; l < n_vert + 1; l++) {
+		x = loc_or[l].x;	y = loc_or[l].y;	z = loc_or[l].z;
+		v = x * c_tet + y * s_tet;
+		loc_or[l].x = v * c_phi - z * s_phi;
+		loc_or[l].y = y * c_tet - x * s_tet;
+		loc_or[l].z = v * s_phi + z * c_phi;
+	}
+}
+
 /* ---------------------------------------------------------------------- */
 GMT_LOCAL void rot_17 (unsigned int n_vert, bool top, struct LOC_OR *loc_or,
                        double *c_tet, double *s_tet, double *c_phi, double *s_phi) {
 	/* Rotates coordinates by teta and phi according to equation (17) of Okabe */
 	/* store the result in external structure loc_or and angles c_tet s_tet c_phi s_phi */
-	double xi, xj, xk, yi, yj, yk, zi, zj, zk, v, x, y, z;
-	double r, r2, r_3d, Sxy, Szx, Syz;
-	unsigned int i = 0, j, k, l;
 
 	loc_or[n_vert].x = loc_or[0].x;		loc_or[n_vert].y = loc_or[0].y;
 	loc_or[n_vert].z = loc_or[0].z;		/* Last point = first point */
 
-	if (top) { /* Currently, this is always true */
-		j = i + 1;	k = i + 2;
-		xi = loc_or[i].x;	xj = loc_or[j].x;	xk = loc_or[k].x;
-		yi = loc_or[i].y;	yj = loc_or[j].y;	yk = loc_or[k].y;
-		zi = loc_or[i].z;	zj = loc_or[j].z;	zk = loc_or[k].z;
-		Sxy = xi * (yj - yk) + xj * (yk - yi) + xk * (yi - yj);
-		Syz = yi * (zj - zk) + yj * (zk - zi) + yk * (zi - zj);
-		Szx = zi * (xj - xk) + zj * (xk - xi) + zk * (xi - xj);
-		r2 = Syz * Syz + Szx * Szx;
-		r = sqrt(r2);
-		r_3d = sqrt(r2 + Sxy * Sxy);
-		*c_phi = - Sxy / r_3d;
-		*s_phi = r / r_3d;
-
-		if (Szx == 0.0 && Syz == 0.0) {*c_tet = 1.0;	*s_tet = 0.0;}
-		else {*c_tet = - Syz / r;	*s_tet = - Szx / r;}
-		}
+	if (top) /* Currently, this is always true */
+		okb_facet_angles (loc_or[0].x, loc_or[0].y, loc_or[0].z, loc_or[1].x, loc_or[1].y, loc_or[1].z,
+		                  loc_or[2].x, loc_or[2].y, loc_or[2].z, c_tet, s_tet, c_phi, s_phi);
 	else { /* Don't need to recompute angles, only do this */
 		*c_tet *= -1;	*s_tet *= -1;	*c_phi *= -1;
 	}
 
-	for (l = 0; l < n_vert + 1; l++) {
-		x = loc_or[l].x;	y = loc_or[l].y;	z = loc_or[l].z;
-		v = x * *c_tet + y * *s_tet;
-		loc_or[l].x = v * *c_phi - z * *s_phi;
-		loc_or[l].y = y * *c_tet - x * *s_tet;
-		loc_or[l].z = v * *s_phi + z * *c_phi;
-	}
+	okb_rotate (n_vert, loc_or, *c_tet, *s_tet, *c_phi, *s_phi);
 }
 
 /* ---------------------------------------------------------------------- */
@@ -48,5 +48,8 @@ struct MAG_VAR {		/* Used when only the modulus of magnetization varies */
 
 EXTERN_MSC double okabe (struct GMT_CTRL *GMT, double x_o, double y_o, double z_o, double rho, bool is_grav,
 		struct BODY_DESC bd_desc, struct BODY_VERTS *bd_vert, unsigned int km, unsigned int pm, struct LOC_OR *loc_or, struct MAG_PARAM *okabe_mag_param, struct MAG_VAR *okabe_mag_var);
+EXTERN_MSC void okabe_vec (struct GMT_CTRL *GMT, unsigned int n_obs, double *x_obs, double *y_obs, double z_o, double rho,
+		bool is_grav, struct BODY_DESC bd_desc, struct BODY_VERTS *bd_vert, unsigned int km, unsigned int pm,
+		struct MAG_PARAM *okabe_mag_param, struct MAG_VAR *okabe_mag_var, double x_c, double y_c, double rad2, gmt_grdfloat *g);
 
 #endif /* OKBFUNS_H */
@@ -94,6 +94,10 @@ struct TALWANI3D_CTRL {
 		bool active;
 		char *file;
 	} N;
+	struct TALWANI3D_T {	/* -T[<ratio>] use far-field approximation for distant slices */
+		bool active;
+		double ratio;
+	} T;
 	struct TALWANI3D_Z {	/* Observation level file or constant */
 		bool active;
 		double level;
@@ -107,6 +111,9 @@ struct TALWANI3D_SLICE {	/* Holds a single contour slice and its density, plus l
 	int n;
 	double rho;
 	double *x, *y;
+	double xc, yc;	/* Area centroid of the slice polygon (input units) [if -T] */
+	double area;	/* Absolute polygon area in km^2 [if -T] */
+	double rad2;	/* Squared max centroid-to-vertex distance in km^2 [if -T] */
 };
 
 struct TALWANI3D_CAKE {	/* Holds linked list of slices for same depth */
@@ -130,6 +137,7 @@ static void *New_Ctrl (struct GMT_CTRL *GMT) {	/* Allocate and initialize a new
 	/* Initialize values whose defaults are not 0/false/NULL */
 
 	C->F.lat = 45.0;	/* So we compute normal gravity at 45 */
+	C->T.ratio = 8.0;	/* Far-field kicks in (if -T) beyond 8 bounding radii */
 
 	return (C);
 }
@@ -207,6 +215,10 @@ static int parse (struct GMT_CTRL *GMT, struct TALWANI3D_CTRL *Ctrl, struct GMT_
 				n_errors += gmt_M_repeated_module_option (API, Ctrl->N.active);
 				n_errors += gmt_get_required_file (GMT, opt->arg, opt->option, 0, GMT_IS_DATASET, GMT_IN, GMT_FILE_REMOTE, &(Ctrl->N.file));
 				break;
+			case 'T':	/* Far-field approximation of distant slices */
+				n_errors += gmt_M_repeated_module_option (API, Ctrl->T.active);
+				if (opt->arg[0]) Ctrl->T.ratio = atof (opt->arg);
+				break;
 			case 'Z':
 				n_errors += gmt_M_repeated_module_option (API, Ctrl->Z.active);
 				if (!gmt_access (GMT, opt->arg, F_OK)) {	/* file exists */
@@ -233,6 +245,8 @@ static int parse (struct GMT_CTRL *GMT, struct TALWANI3D_CTRL *Ctrl, struct GMT_
 	                                 "Option -G: Must specify output gridfile name if -N is not used.\n");
 	n_errors += gmt_M_check_condition (GMT, Ctrl->N.active && Ctrl->Z.mode == 1,
 	                                 "Option -N: Cannot give a grid of zlevels via -Z if -N is used.\n");
+	n_errors += gmt_M_check_condition (GMT, Ctrl->T.active && Ctrl->T.ratio < 2.0,
+	                                 "Option -T: Distance ratio must be at least 2.\n");
 
 	return (n_errors ? GMT_PARSE_ERROR : GMT_NOERROR);
 }
@@ -241,7 +255,7 @@ static int usage (struct GMTAPI_CTRL *API, int level) {
 	const char *name = gmt_show_name_and_purpose (API, THIS_MODULE_LIB, THIS_MODULE_CLASSIC_NAME, THIS_MODULE_PURPOSE);
 	if (level == GMT_MODULE_PURPOSE) return (GMT_NOERROR);
 	GMT_Usage (API, 0, "usage: %s <modelfile> [-A] [-D<density>] [-Ff|n[<lat>]|v] [-G<outfile>] [%s] "
-		"[-M[h][v]] [-N<trktable>] [%s] [%s] [-Z<level>] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s]%s [%s]\n",
+		"[-M[h][v]] [-N<trktable>] [%s] [-T[<ratio>]] [%s] [-Z<level>] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s]%s [%s]\n",
 		name, GMT_I_OPT, GMT_Rgeo_OPT, GMT_V_OPT, GMT_bo_OPT, GMT_d_OPT, GMT_e_OPT, GMT_f_OPT, GMT_h_OPT,
 		GMT_i_OPT, GMT_o_OPT, GMT_r_OPT, GMT_x_OPT, GMT_PAR_OPT);
 
@@ -271,7 +285,12 @@ static int usage (struct GMTAPI_CTRL *API, int level) {
 	GMT_Usage (API, 1, "\n-N<trktable>");
 	GMT_Usage (API, -2, "File with output locations where a calculation is requested.  No grid "
 		"is produced and output (x,y,z,g|n|v) is written to standard output (see -bo for binary output).");
-	GMT_Option (API, "R,V");
+	GMT_Option (API, "R");
+	GMT_Usage (API, 1, "\n-T[<ratio>]");
+	GMT_Usage (API, -2, "Approximate a slice by an equivalent mass sheet at its centroid when the horizontal "
+		"distance to the observation point exceeds <ratio> times the slice bounding radius [8]. "
+		"This speeds up large models considerably at a small loss of precision [Default is exact everywhere].");
+	GMT_Option (API, "V");
 	GMT_Usage (API, 1, "\n-Z<level>");
 	GMT_Usage (API, -2, "Set observation level for output locations [0]. "
 		"Append either a constant or the name of grid file with variable levels. "
@@ -655,11 +674,68 @@ GMT_LOCAL double talwani3d_get_geoid3d (double x[], double y[], int n, double x_
 	return (1.0e-2 * GAMMA * rho * nsum / G0);	/* To get geoid in meter */
 }
 
-GMT_LOCAL double talwani3d_get_one_output (double x_obs, double y_obs, double z_obs, struct TALWANI3D_CAKE *cake, double depths[], unsigned int ndepths, unsigned int mode, bool flat_earth, double G0) {
+GMT_LOCAL void talwani3d_prep_slice (struct TALWANI3D_SLICE *sl, bool flat) {
+	/* Precompute the area centroid, area (in km^2), and squared bounding radius (in km^2) of
+	 * this slice polygon for use with the -T far-field approximation.  Using the area centroid
+	 * (rather than the vertex average) kills the dipole term of the multipole expansion so the
+	 * leading error of the mass-sheet approximation is quadrupole, i.e., O((rad/dist)^2). */
+	int k;
+	double A2 = 0.0, cx = 0.0, cy = 0.0, cross, dx, dy, d2;
+
+	for (k = 0; k < sl->n - 1; k++) {	/* Shoelace sums over the closed polygon */
+		cross = sl->x[k] * sl->y[k+1] - sl->x[k+1] * sl->y[k];
+		A2 += cross;
+		cx += (sl->x[k] + sl->x[k+1]) * cross;
+		cy += (sl->y[k] + sl->y[k+1]) * cross;
+	}
+	if (fabs (A2) < TOL) {	/* Degenerate (zero-area) slice: flag as never eligible for far-field */
+		sl->area = 0.0;
+		sl->rad2 = DBL_MAX;
+		return;
+	}
+	sl->xc = cx / (3.0 * A2);
+	sl->yc = cy / (3.0 * A2);
+	sl->area = 0.5 * fabs (A2);
+	if (flat) sl->area *= DEG_TO_KM * DEG_TO_KM * cos (sl->yc * D2R);	/* Was in degrees^2; scale to km^2 */
+	sl->rad2 = 0.0;
+	for (k = 0; k < sl->n - 1; k++) {	/* Find the most distant vertex from the centroid */
+		if (flat) {	/* Got lon, lat and must convert to Flat-Earth km */
+			dx = DX_FROM_DLON (sl->x[k], sl->xc, sl->y[k], sl->yc);
+			dy = DY_FROM_DLAT (sl->y[k], sl->yc);
+		}
+		else {	/* Got km */
+			dx = sl->x[k] - sl->xc;
+			dy = sl->y[k] - sl->yc;
+		}
+		d2 = dx * dx + dy * dy;
+		if (d2 > sl->rad2) sl->rad2 = d2;
+	}
+}
+
+GMT_LOCAL double talwani3d_get_far3d (struct TALWANI3D_SLICE *sl, double dx, double dy, double z_obs, unsigned int mode, double G0) {
+	/* Far-field approximation of a distant slice: treat it as an equivalent mass sheet of area
+	 * sl->area at its centroid, a horizontal distance (dx,dy) and vertical distance z_obs (all in km)
+	 * from the observation point.  The expressions are the leading terms of the exact kernels in
+	 * talwani3d_get_grav3d|vgg3d|geoid3d and follow the same sign conventions, including taking the
+	 * sign from z_obs for FAA and geoid.  Only valid when the observation point projects well outside
+	 * the polygon (ensured by the -T distance test) since the exact kernels differ by a solid-angle
+	 * wrap for interior points below the slice. */
+	double r2 = dx * dx + dy * dy + z_obs * z_obs, r = sqrt (r2), value;
+
+	if (mode == TALWANI3D_FAA)	/* mGal */
+		value = GAMMA * sl->rho * sl->area * fabs (z_obs) / (r * r2);
+	else if (mode == TALWANI3D_GEOID)	/* Geoid in meter */
+		value = 1.0e-2 * GAMMA * sl->rho * sl->area / (r * G0);
+	else	/* VGG in Eotvos; this kernel is even in z_obs so no sign flip */
+		return (10.0 * GAMMA * sl->rho * sl->area * (3.0 * z_obs * z_obs - r2) / (r * r2 * r2));
+	return ((z_obs > 0.0) ? value : -value);
+}
+
+GMT_LOCAL double talwani3d_get_one_output (double x_obs, double y_obs, double z_obs, struct TALWANI3D_CAKE *cake, double depths[], unsigned int ndepths, unsigned int mode, bool flat_earth, double G0, double far2) {
 	/* Evaluate output at a single observation point (x,y,z) */
 	/* Work array vtry must have at least of length ndepths */
 	unsigned int k;
-	double z;
+	double z, dx, dy;
 	struct TALWANI3D_SLICE *sl = NULL;
 	double vtry[GMT_TALWANI3D_N_DEPTHS];	/* Allocate on stack since trouble with OpenMP otherwise */
 #if 0
@@ -686,6 +762,20 @@ GMT_LOCAL double talwani3d_get_one_output (double x_obs, double y_obs, double z_
 		vtry[k] = 0.0;
 		z = cake[k].depth - z_obs;	/* Vertical distance from observation point to this slice */
 		for (sl = cake[k].first_slice; sl; sl = sl->next) {	/* Loop over slices */
+			if (far2 > 0.0) {	/* See if this slice is distant enough for the -T far-field approximation */
+				if (flat_earth) {	/* Got lon, lat and must convert to Flat-Earth km */
+					dx = DX_FROM_DLON (sl->xc, x_obs, sl->yc, y_obs);
+					dy = DY_FROM_DLAT (sl->yc, y_obs);
+				}
+				else {	/* Got km */
+					dx = sl->xc - x_obs;
+					dy = sl->yc - y_obs;
+				}
+				if ((dx * dx + dy * dy) > far2 * sl->rad2) {	/* Projection is far outside the polygon */
+					vtry[k] += talwani3d_get_far3d (sl, dx, dy, z, mode, G0);
+					continue;
+				}
+			}
 			if (mode == TALWANI3D_FAA) /* FAA */
 				vtry[k] += talwani3d_get_grav3d  (sl->x, sl->y, sl->n, x_obs, y_obs, z, sl->rho, flat_earth);
 			else if (mode == TALWANI3D_GEOID) /* GEOID */
@@ -717,7 +807,7 @@ EXTERN_MSC int GMT_talwani3d (void *V_API, int mode, void *args) {
 	bool flat_earth = false, first_slice = true;
 
 	char *uname[2] = {"meter", "km"}, *kind[3] = {"FAA", "VGG", "GEOID"}, remark[GMT_LEN64] = {""};
-	double z_level, depth = 0.0, rho = 0.0, lat = 45.0, G0;
+	double z_level, depth = 0.0, rho = 0.0, lat = 45.0, G0, far2 = 0.0;
 	double *x = NULL, *y = NULL, *in = NULL, *depths = NULL;
 
 	struct TALWANI3D_SLICE *sl = NULL, *slnext = NULL;
@@ -947,6 +1037,13 @@ EXTERN_MSC int GMT_talwani3d (void *V_API, int mode, void *args) {
 	}
 	GMT_Report (API, GMT_MSG_INFORMATION, "Start calculating %s\n", kind[Ctrl->F.mode]);
 
+	if (Ctrl->T.active) {	/* Precompute slice centroids, areas and bounding radii for the far-field test */
+		for (k = 0; k < ndepths; k++)
+			for (sl = cake[k].first_slice; sl; sl = sl->next)
+				talwani3d_prep_slice (sl, flat_earth);
+		far2 = Ctrl->T.ratio * Ctrl->T.ratio;	/* Compare squared distances to avoid hypots */
+		GMT_Report (API, GMT_MSG_INFORMATION, "Far-field approximation used for slices beyond %g bounding radii\n", Ctrl->T.ratio);
+	}
 	G0 = (Ctrl->F.lset) ? g_normal (Ctrl->F.lat) : g_normal (lat);
 	/* Set up depths array needed by talwani3d_get_one_output */
 	depths = gmt_M_memory (GMT, NULL, ndepths, double);
@@ -990,14 +1087,14 @@ EXTERN_MSC int GMT_talwani3d (void *V_API, int mode, void *args) {
 				gmt_prep_tmp_arrays (GMT, GMT_OUT, S->n_rows, 1);	/* Init or reallocate tmp vector */
 #ifdef _OPENMP
 				/* Spread calculation over selected cores */
-#pragma omp parallel for private(row,z_level) shared(S,Ctrl,GMT,scl,cake,depths,ndepths,flat_earth,G0)
+#pragma omp parallel for private(row,z_level) shared(S,Ctrl,GMT,scl,cake,depths,ndepths,flat_earth,G0,far2)
 #endif
 				/* Separate the calculation from the output in two separate row-loops since cannot do rec-by-rec output
 				 * with OpenMP due to race condiations that would mess up the output order */
 				for (row = 0; row < (int64_t)S->n_rows; row++) {	/* Calculate attraction at all output locations for this segment */
 					z_level = (S->n_columns == 3 && !Ctrl->Z.active) ? S->data[GMT_Z][row] : Ctrl->Z.level;	/* Default observation z level unless provided in input file */
 					if (!Ctrl->M.active[TALWANI3D_VER]) z_level /= METERS_IN_A_KM;	/* Change level to km */
-					GMT->hidden.mem_coord[GMT_X][row] = talwani3d_get_one_output (S->data[GMT_X][row] * scl, S->data[GMT_Y][row] * scl, z_level, cake, depths, ndepths, Ctrl->F.mode, flat_earth, G0);
+					GMT->hidden.mem_coord[GMT_X][row] = talwani3d_get_one_output (S->data[GMT_X][row] * scl, S->data[GMT_Y][row] * scl, z_level, cake, depths, ndepths, Ctrl->F.mode, flat_earth, G0, far2);
 				}
 				/* This loop is not under OpenMP */
 				out[GMT_Z] = Ctrl->Z.level;	/* Default observation z level unless provided in input file */
@@ -1025,7 +1122,7 @@ EXTERN_MSC int GMT_talwani3d (void *V_API, int mode, void *args) {
 		}
 #ifdef _OPENMP
 		/* Spread calculation over selected cores */
-#pragma omp parallel for private(row,y_obs,col,node,z_level) shared(n_rows,GMT,G,flat_earth,Ctrl,n_columns,x_obs,cake,depths,ndepths,G0)
+#pragma omp parallel for private(row,y_obs,col,node,z_level) shared(n_rows,GMT,G,flat_earth,Ctrl,n_columns,x_obs,cake,depths,ndepths,G0,far2)
 #endif
 		for (row = 0; row < n_rows; row++) {	/* Do row-by-row and report on progress if -V */
 			y_obs = gmt_M_grd_row_to_y (GMT, row, G->header);
@@ -1037,7 +1134,7 @@ EXTERN_MSC int GMT_talwani3d (void *V_API, int mode, void *args) {
 				/* Loop over cols; always save the next level before we update the array at that col */
 				node = gmt_M_ijp (G->header, row, col);
 				z_level = (Ctrl->A.active) ? -G->data[node] : G->data[node];	/* Get observation z level and possibly flip direction */
-				G->data[node] = (gmt_grdfloat) talwani3d_get_one_output (x_obs[col], y_obs, z_level, cake, depths, ndepths, Ctrl->F.mode, flat_earth, G0);
+				G->data[node] = (gmt_grdfloat) talwani3d_get_one_output (x_obs[col], y_obs, z_level, cake, depths, ndepths, Ctrl->F.mode, flat_earth, G0, far2);
 			}
 		}
 		gmt_M_free (GMT, x_obs);
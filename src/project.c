@@ -239,6 +239,30 @@ GMT_LOCAL void project_matrix_2v (double *a, double *x, double *b) {
 	b[1] = x[0]*a[2] + x[1]*a[3];
 }
 
+GMT_LOCAL void project_rotate_about_pole (struct GMT_CTRL *GMT, double *p, double *x, double scale, struct PROJECT_DATA *p_data, uint64_t n_used) {
+	/* Rotate the fixed unit vector x about the pole p by each record's angle (scale * a[2])
+	   and store the resulting lon, lat in a[4], a[5].  Rather than rebuilding the full Euler
+	   matrix per record (which only differs in the angle), we precompute the constant Rodrigues
+	   terms p x x and p . x once so each record costs one sincosd and a 3-vector combination.
+	   The records are independent so the loop can be spread across the threads. */
+	openmp_int rec;
+	double p_cross_x[3], p_dot_x;
+
+	gmt_cross3v (GMT, p, x, p_cross_x);
+	p_dot_x = gmt_dot3v (GMT, p, x);
+#ifdef _OPENMP
+#pragma omp parallel for private(rec) shared(GMT,p,x,scale,p_data,n_used,p_cross_x,p_dot_x)
+#endif
+	for (rec = 0; rec < (openmp_int)n_used; rec++) {
+		unsigned int k;
+		double sin_theta, cos_theta, temp, xt[3];
+		sincosd (scale * p_data[rec].a[2], &sin_theta, &cos_theta);
+		temp = p_dot_x * (1.0 - cos_theta);
+		for (k = 0; k < 3; k++) xt[k] = x[k] * cos_theta + p_cross_x[k] * sin_theta + p[k] * temp;
+		gmt_cart_to_geo (GMT, &(p_data[rec].a[5]), &(p_data[rec].a[4]), xt, true);
+	}
+}
+
 GMT_LOCAL void project_sphere_setup (struct GMT_CTRL *GMT, double alat, double alon, double *a, double blat, double blon, double *b, double azim, double *p, double *c, bool two_pts) {
 	/* routine to initialize a pole vector, p, and a central meridian
 	   normal vector, c, for use in projecting points onto a great circle.
@@ -669,7 +693,7 @@ static int parse (struct GMT_CTRL *GMT, struct PROJECT_CTRL *Ctrl, struct GMT_OP
 
 GMT_LOCAL int project_write_one_segment (struct GMT_CTRL *GMT, struct PROJECT_CTRL *Ctrl, double theta, struct PROJECT_DATA *p_data, struct PROJECT_INFO *P) {
 	uint64_t col, n_items, rec, k;
-	double sin_theta, cos_theta, e[9], x[3], xt[3], *out = NULL;
+	double sin_theta, cos_theta, x[3], *out = NULL;
 	struct GMT_RECORD *Out = NULL;
 
 	if (Ctrl->S.active) qsort (p_data, P->n_used, sizeof (struct PROJECT_DATA), project_compare_distances);
@@ -687,11 +711,7 @@ GMT_LOCAL int project_write_one_segment (struct GMT_CTRL *GMT, struct PROJECT_CT
 		}
 		else {
 			gmt_geo_to_cart (GMT, Ctrl->C.y, Ctrl->C.x, x, true);
-			for (rec = 0; rec < P->n_used; rec++) {
-				project_make_euler_matrix (P->pole, e, p_data[rec].a[2]);
-				project_matrix_3v (e,x,xt);
-				gmt_cart_to_geo (GMT, &(p_data[rec].a[5]), &(p_data[rec].a[4]), xt, true);
-			}
+			project_rotate_about_pole (GMT, P->pole, x, 1.0, p_data, P->n_used);
 		}
 	}
 
@@ -1044,11 +1064,7 @@ EXTERN_MSC int GMT_project (void *V_API, int mode, void *args) {
 			project_make_euler_matrix (N, e, Ctrl->G.colat);	/* Rotation matrix about N */
 			project_matrix_3v (e, P.pole, x);			/* This is the generating vector for our circle */
 			if (Ctrl->L.constrain) counteract = 1.0 / sin_lat_to_pole;	/* Increase angle to counteract effect of small circle settings */
-			for (rec = 0; rec < P.n_used; rec++) {
-				project_make_euler_matrix (P.pole, e, sign * p_data[rec].a[2] * counteract);
-				project_matrix_3v (e,x,xt);
-				gmt_cart_to_geo (GMT, &(p_data[rec].a[5]), &(p_data[rec].a[4]), xt, true);
-			}
+			project_rotate_about_pole (GMT, P.pole, x, sign * counteract, p_data, P.n_used);
 		}
 
 		/* At this stage, all values are still in degrees.  */
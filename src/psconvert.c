@@ -251,6 +251,17 @@ GMT_LOCAL void psconvert_pclose2 (struct popen2 **Faddr, int dir) {
 }
 #endif
 
+struct PSCONVERT_BB_JOB {	/* Argument package for one background BoundingBox-sniffing Ghostscript run */
+	char *cmd;	/* The full command to execute */
+	int status;	/* Exit status from system */
+};
+
+GMT_LOCAL void psconvert_bb_worker (void *arg) {
+	/* Executed by the session thread pool; just runs the prepared command and keeps the status */
+	struct PSCONVERT_BB_JOB *job = arg;
+	job->status = system (job->cmd);
+}
+
 GMT_LOCAL int psconvert_parse_new_A_settings (struct GMT_CTRL *GMT, char *arg, struct PSCONVERT_CTRL *Ctrl) {
 	/* Syntax: -A[+r][+u] */
 	gmt_M_unused (GMT);
@@ -1143,6 +1154,38 @@ GMT_LOCAL inline char *psconvert_alpha_bits (struct PSCONVERT_CTRL *Ctrl) {
 	return alpha;
 }
 
+#define PSCONVERT_BIG_FRAME 2147483647.0	/* Frames larger than this (in bytes) are rendered in bands to bound gs memory */
+
+GMT_LOCAL void psconvert_band_options (struct GMTAPI_CTRL *API, struct PSCONVERT_CTRL *Ctrl, unsigned int pix_w, unsigned int pix_h, char *options) {
+	/* Huge plots (e.g., posters at high dpi) exceed the full-frame bitmap we normally request via
+	 * -dMaxBitmap, and letting gs try to materialize the whole raster makes it die or swap.  When
+	 * the frame would be larger than PSCONVERT_BIG_FRAME we instead override the earlier MaxBitmap
+	 * setting (the last repeated option on the gs command line wins) so gs falls back on its banded
+	 * (command-list) rasterizer: only a few band buffers are resident at any time and each finished
+	 * band is streamed to the output file, bounding peak memory regardless of plot size.  We also
+	 * ask gs to render bands on several threads since banding makes them independent. */
+	int n_threads;
+	unsigned int bpp;
+	double frame_size, factor = (Ctrl->H.active) ? (double)Ctrl->H.factor : 1.0;
+	options[0] = '\0';
+	switch (Ctrl->T.device) {	/* Bytes per pixel of the requested raster device */
+		case GS_DEV_TPNG:
+			bpp = 4; break;
+		case GS_DEV_JPGG: case GS_DEV_PNGG: case GS_DEV_TIFG: case GS_DEV_BMPG:
+			bpp = 1; break;
+		case GS_DEV_EPS: case GS_DEV_PDF: case GS_DEV_SVG:	/* Vector formats build no frame */
+			return;
+		default:	/* All the 24-bit rasters */
+			bpp = 3; break;
+	}
+	frame_size = (pix_w * factor) * (pix_h * factor) * bpp;	/* May exceed integer range, hence double */
+	if (frame_size <= PSCONVERT_BIG_FRAME) return;	/* Small enough to render as one frame */
+	n_threads = MIN ((int)API->n_cores, 8);	/* More threads keep more bands resident so cap the parallelism */
+	sprintf (options, " -dMaxBitmap=100000000 -dBufferSpace=250000000 -dNumRenderingThreads=%d", n_threads);
+	GMT_Report (API, GMT_MSG_INFORMATION,
+		"Frame of %u x %u pixels is too large to hold in memory; using banded rasterization on %d threads\n", pix_w, pix_h, n_threads);
+}
+
 GMT_LOCAL void psconvert_possibly_fill_or_outline_BB (struct GMT_CTRL *GMT, struct PSCONVERT_N *N, FILE *fp) {
 	/* Check if user wanted to paint or outline the BoundingBox - otherwise do nothing */
 	char *ptr = NULL;
@@ -1519,7 +1562,10 @@ GMT_LOCAL int psconvert_in_mem_PS(struct GMTAPI_CTRL *API, struct PSCONVERT_CTRL
 		sprintf (t, " -sDEVICE=%s %s -sOutputFile=", device[Ctrl->T.device], device_options[Ctrl->T.device]);
 		strcat (out_file, t);
 		if (API->external && Ctrl->F.active && !gmt_M_file_is_memory (Ctrl->F.file)) {
-			strncpy (t, Ctrl->F.file, PATH_MAX-1);
+			if (Ctrl->D.active)	/* Honor the output directory for relative -F names */
+				snprintf (t, PATH_MAX, "%s/%s", Ctrl->D.dir, Ctrl->F.file);
+			else
+				strncpy (t, Ctrl->F.file, PATH_MAX-1);
 		}
 		else {
 			if (API->tmp_dir)	/* Use the established temp directory */
@@ -1638,10 +1684,12 @@ EXTERN_MSC int GMT_psconvert (void *V_API, int mode, void *args) {
 
 	char **ps_names = NULL;
 	char ps_file[PATH_MAX] = "", no_U_file[PATH_MAX] = "", clean_PS_file[PATH_MAX] = "", tmp_file[PATH_MAX] = "",
-	     out_file[PATH_MAX] = "", BB_file[PATH_MAX] = "", resolution[GMT_LEN128] = "", jpeg_device[GMT_LEN16] = {""};
+	     out_file[PATH_MAX] = "", BB_file[PATH_MAX] = "", resolution[GMT_LEN128] = "", jpeg_device[GMT_LEN16] = {""},
+	     band_opts[GMT_LEN128] = "";
 	char *line = NULL, c1[20] = {""}, c2[20] = {""}, c3[20] = {""}, c4[20] = {""}, GSstring[GMT_LEN64] = {""},
 	     cmd[GMT_BUFSIZ] = {""}, proj4_name[20] = {""}, *quiet = NULL;
 	char *gs_BB = NULL, *proj4_cmd = NULL;
+	struct PSCONVERT_BB_JOB *BB_jobs = NULL;	/* Only used when the BB-sniffing prepass runs concurrently */
 	char *device[N_GS_DEVICES] = {"", "pdfwrite", "svg", "jpeg", "png16m", "ppmraw", "tiff24nc", "bmp16m", "pngalpha",
 	                              "jpeggray", "pnggray", "tiffgray", "bmpgray"};
 	char *device_options[N_GS_DEVICES] = {
@@ -1686,6 +1734,7 @@ EXTERN_MSC int GMT_psconvert (void *V_API, int mode, void *args) {
 	struct GMTAPI_CTRL *API = gmt_get_api_ptr (V_API);	/* Cast from void to GMTAPI_CTRL pointer */
 	struct { int major, minor, patch; } gsVersion = {0, 0, 0};
 	struct GMT_POSTSCRIPT *PS = NULL;
+	struct GMT_PS_ARENA *A = NULL;
 
 	/*----------------------- Standard module initialization and parsing ----------------------*/
 
@@ -1816,17 +1865,32 @@ EXTERN_MSC int GMT_psconvert (void *V_API, int mode, void *args) {
 		}
 	}
 	if (GMT->current.setting.run_mode == GMT_MODERN) {	/* Need to complete the half-baked PS file */
-		if (Ctrl->In.n_files == 0) {	/* Add the default hidden PS file */
+		if (Ctrl->In.n_files == 0) {	/* Add the default hidden PS file (or in-memory arena) */
 			if ((k = gmt_set_psfilename (GMT)) == 0) {	/* Get hidden file name for current PS */
 				GMT_Report (API, GMT_MSG_ERROR, "No hidden PS file %s found\n", GMT->current.ps.filename);
 				Return (GMT_RUNTIME_ERROR);
 			}
-			GMT_Report (API, GMT_MSG_DEBUG, "Hidden PS file %s found\n", GMT->current.ps.filename);
 			ps_names = gmt_M_memory (GMT, NULL, 1, char *);
-			ps_names[0] = gmt_strdup_noquote (GMT->current.ps.filename);
+			if (gmt_ps_memory_active (API) && (A = gmt_ps_arena_get (API, GMT->current.ps.figure, false)) && A->n) {	/* Session PS lives in memory */
+				GMT_Report (API, GMT_MSG_DEBUG, "In-memory PS for figure %d found\n", GMT->current.ps.figure);
+				ps_names[0] = strdup ("=");
+			}
+			else {
+				GMT_Report (API, GMT_MSG_DEBUG, "Hidden PS file %s found\n", GMT->current.ps.filename);
+				ps_names[0] = gmt_strdup_noquote (GMT->current.ps.filename);
+			}
 			Ctrl->In.n_files = 1;
 		}
-		if (access (ps_names[0], F_OK) == 0) {	/* File exist, so complete it */
+		if (A && A->n) {	/* Lend the arena to PSL and complete the PS in memory */
+			PSL_setplot (GMT->PSL, A->buffer, A->n, A->n_alloc, A->pmode);
+			A->buffer = NULL;	A->n = A->n_alloc = 0;	/* PSL owns the bytes until we reclaim them below */
+			if (GMT->PSL->internal.pmode != 3) {	/* Only half-baked so finalize the trailer in memory */
+				GMT->PSL->internal.call_level++;	/* Must increment here since PSL_beginplot not called, and PSL_endplot will decrement */
+				PSL_endplot (GMT->PSL, 1);	/* Finalize the PS plot */
+				GMT_Report (API, GMT_MSG_DEBUG, "Fattened up in-memory PS for figure %d\n", GMT->current.ps.figure);
+			}
+		}
+		else if (access (ps_names[0], F_OK) == 0) {	/* File exist, so complete it */
 			struct stat buf;
 			GMT_Report (API, GMT_MSG_DEBUG, "Complete partial PS file %s\n", ps_names[0]);
 			if (stat (ps_names[0], &buf))
@@ -1859,6 +1923,8 @@ EXTERN_MSC int GMT_psconvert (void *V_API, int mode, void *args) {
 		else
 			error = psconvert_in_mem_PS(API, Ctrl, ps_names, gs_BB, gs_params, device, device_options, ext);
 
+		if (A)	/* Reclaim the completed PS from PSL so the session arena keeps it */
+			A->buffer = PSL_detachplot (GMT->PSL, &A->n, &A->n_alloc, &A->pmode);
 		gmt_M_str_free (ps_names[0]);
 		gmt_M_free (GMT, ps_names);
 		gmt_M_free (GMT, line);
@@ -1909,6 +1975,28 @@ EXTERN_MSC int GMT_psconvert (void *V_API, int mode, void *args) {
 
 	PS = gmt_M_memory (GMT, NULL, 1, struct GMT_POSTSCRIPT);	/* Only used if API passes = */
 
+	if (Ctrl->A.crop && !Ctrl->A.media && !Ctrl->A.strip && !Ctrl->M[0].active && !Ctrl->M[1].active \
+		&& clean_PS_file[0] == '\0' && Ctrl->In.n_files > 1) {
+		/* Many files to crop: sniff the tight BoundingBoxes up front through the session thread
+		 * pool so the Ghostscript bbox passes overlap instead of serializing one gs at the time.
+		 * Options that rewrite the PS before the bbox pass (-A+u, -M) keep the serial path, as
+		 * do memory-based inputs which are only staged to temp files inside the loop below. */
+		BB_jobs = gmt_M_memory (GMT, NULL, Ctrl->In.n_files, struct PSCONVERT_BB_JOB);
+		for (k = 0; k < Ctrl->In.n_files; k++) {
+			if (gmt_M_file_is_memory (ps_names[k])) continue;
+			if (GMT->current.setting.run_mode == GMT_MODERN)	/* Place BB files in session dir */
+				sprintf (BB_file, "%s/psconvert_%d_%uc.bb", API->gwf_dir, (int)getpid(), k);
+			else
+				sprintf (BB_file, "%s/psconvert_%d_%uc.bb", Ctrl->D.dir, (int)getpid(), k);
+			BB_jobs[k].cmd = gmt_M_memory (GMT, NULL, strlen (ps_names[k]) + PATH_MAX, char);
+			sprintf (BB_jobs[k].cmd, "%s%s %s %s %c%s%c 2> %c%s%c",
+			         at_sign, Ctrl->G.file, gs_BB, Ctrl->C.arg, quote, ps_names[k], quote, quote, BB_file, quote);
+			GMT_Report (API, GMT_MSG_DEBUG, "Submitting: %s\n", BB_jobs[k].cmd);
+			gmt_thread_pool_submit (GMT, psconvert_bb_worker, &BB_jobs[k]);
+		}
+		gmt_thread_pool_wait (GMT);
+	}
+
 	/* Loop over all input files */
 
 	for (k = 0; k < Ctrl->In.n_files; k++) {
@@ -2009,15 +2097,25 @@ EXTERN_MSC int GMT_psconvert (void *V_API, int mode, void *args) {
 		else if (Ctrl->A.crop) {
 			char *psfile_to_use = NULL;
 			GMT_Report (API, GMT_MSG_INFORMATION, "Find HiResBoundingBox ...\n");
-			if (GMT->current.setting.run_mode == GMT_MODERN)	/* Place BB file in session dir */
-				sprintf (BB_file, "%s/psconvert_%dc.bb", API->gwf_dir, (int)getpid());
-			else
-				sprintf (BB_file, "%s/psconvert_%dc.bb", Ctrl->D.dir, (int)getpid());
-			psfile_to_use = Ctrl->A.strip ? no_U_file : ((strlen (clean_PS_file) > 0) ? clean_PS_file : ps_file);
-			sprintf (cmd, "%s%s %s %s %c%s%c 2> %c%s%c",
-			         at_sign, Ctrl->G.file, gs_BB, Ctrl->C.arg, quote, psfile_to_use, quote, quote, BB_file, quote);
-			GMT_Report (API, GMT_MSG_DEBUG, "Running: %s\n", cmd);
-			sys_retval = system (cmd);		/* Execute the command that computes the tight BB */
+			if (BB_jobs && BB_jobs[k].cmd) {	/* This file's BB was computed in the concurrent prepass */
+				if (GMT->current.setting.run_mode == GMT_MODERN)	/* Placed BB file in session dir */
+					sprintf (BB_file, "%s/psconvert_%d_%uc.bb", API->gwf_dir, (int)getpid(), k);
+				else
+					sprintf (BB_file, "%s/psconvert_%d_%uc.bb", Ctrl->D.dir, (int)getpid(), k);
+				strncpy (cmd, BB_jobs[k].cmd, GMT_BUFSIZ-1);	/* Only needed by the error message below */
+				sys_retval = BB_jobs[k].status;
+			}
+			else {
+				if (GMT->current.setting.run_mode == GMT_MODERN)	/* Place BB file in session dir */
+					sprintf (BB_file, "%s/psconvert_%dc.bb", API->gwf_dir, (int)getpid());
+				else
+					sprintf (BB_file, "%s/psconvert_%dc.bb", Ctrl->D.dir, (int)getpid());
+				psfile_to_use = Ctrl->A.strip ? no_U_file : ((strlen (clean_PS_file) > 0) ? clean_PS_file : ps_file);
+				sprintf (cmd, "%s%s %s %s %c%s%c 2> %c%s%c",
+				         at_sign, Ctrl->G.file, gs_BB, Ctrl->C.arg, quote, psfile_to_use, quote, quote, BB_file, quote);
+				GMT_Report (API, GMT_MSG_DEBUG, "Running: %s\n", cmd);
+				sys_retval = system (cmd);		/* Execute the command that computes the tight BB */
+			}
 			if (sys_retval) {
 				GMT_Report (API, GMT_MSG_ERROR, "System call [%s] returned error %d.\n", cmd, sys_retval);
 				fclose (fp);
@@ -2580,8 +2678,9 @@ EXTERN_MSC int GMT_psconvert (void *V_API, int mode, void *args) {
 				sprintf (resolution, "-g%dx%d -r%g -dDownScaleFactor=%d", pix_w * Ctrl->H.factor, pix_h * Ctrl->H.factor, Ctrl->E.dpi * Ctrl->H.factor, Ctrl->H.factor);
 			else
 				sprintf (resolution, "-g%dx%d -r%g", pix_w, pix_h, Ctrl->E.dpi);
-			sprintf (cmd, "%s%s %s %s%s -sDEVICE=%s %s %s -sOutputFile=%c%s%c %c%s%c",
-				at_sign, Ctrl->G.file, gs_params, Ctrl->C.arg, psconvert_alpha_bits(Ctrl), device[Ctrl->T.device],
+			psconvert_band_options (API, Ctrl, pix_w, pix_h, band_opts);	/* Fall back on banded rasterization if the frame is huge */
+			sprintf (cmd, "%s%s %s %s%s%s -sDEVICE=%s %s %s -sOutputFile=%c%s%c %c%s%c",
+				at_sign, Ctrl->G.file, gs_params, Ctrl->C.arg, band_opts, psconvert_alpha_bits(Ctrl), device[Ctrl->T.device],
 				device_options[Ctrl->T.device], resolution, quote, out_file, quote, quote, tmp_file, quote);
 
 			if (Ctrl->S.active) {	/* Print Ghostscript command */
@@ -2630,8 +2729,9 @@ EXTERN_MSC int GMT_psconvert (void *V_API, int mode, void *args) {
 					strcat (out_file, Ctrl->F.file);
 				strcat (out_file, ext[Ctrl->T.device]);
 				/* After conversion, convert the tmp PDF file to desired format via a 2nd gs call */
-				sprintf (cmd, "%s%s %s %s%s -sDEVICE=%s %s %s -sOutputFile=%c%s%c %c%s%c",
-					at_sign, Ctrl->G.file, gs_params, Ctrl->C.arg, psconvert_alpha_bits(Ctrl), device[Ctrl->T.device],
+				psconvert_band_options (API, Ctrl, pix_w, pix_h, band_opts);	/* Now aimed at the final raster device */
+				sprintf (cmd, "%s%s %s %s%s%s -sDEVICE=%s %s %s -sOutputFile=%c%s%c %c%s%c",
+					at_sign, Ctrl->G.file, gs_params, Ctrl->C.arg, band_opts, psconvert_alpha_bits(Ctrl), device[Ctrl->T.device],
 					device_options[Ctrl->T.device],
 					resolution, quote, out_file, quote, quote, pdf_file, quote);
 				if (Ctrl->S.active) {	/* Print 2nd Ghostscript command */
@@ -2870,6 +2970,10 @@ EXTERN_MSC int GMT_psconvert (void *V_API, int mode, void *args) {
 	}
 
 	for (k = 0; k < Ctrl->In.n_files; k++) gmt_M_str_free (ps_names[k]);
+	if (BB_jobs) {	/* Release the prepass commands */
+		for (k = 0; k < Ctrl->In.n_files; k++) gmt_M_free (GMT, BB_jobs[k].cmd);
+		gmt_M_free (GMT, BB_jobs);
+	}
 	gmt_M_free (GMT, ps_names);
 	gmt_M_free (GMT, line);
 	gmt_M_free (GMT, PS);
@@ -136,9 +136,11 @@ struct PSEVENTS_CTRL {
 		unsigned int mode;
 		char *symbol;
 	} S;
-	struct PSEVENTS_T {	/* 	-T<nowtime> */
+	struct PSEVENTS_T {	/* 	-T<nowtime> or -T<start>/<stop>/<inc>[+n] */
 		bool active;
+		bool series;	/* True if we were given a frame-time series to stream in one go */
 		double now;
+		struct GMT_ARRAY T;
 	} T;
 	struct PSEVENTS_W {	/* 	-W<pen> */
 		bool active;
@@ -186,6 +188,7 @@ static void Free_Ctrl (struct GMT_CTRL *GMT, struct PSEVENTS_CTRL *C) {	/* Deall
 	gmt_M_str_free (C->W.pen);
 	gmt_M_str_free (C->Z.module);
 	gmt_M_str_free (C->Z.cmd);
+	gmt_free_array (GMT, &(C->T.T));
 	gmt_M_free (GMT, C);
 }
 
@@ -203,7 +206,8 @@ static int usage (struct GMTAPI_CTRL *API, int level) {
 	GMT_Message (API, GMT_TIME_NONE, "  REQUIRED ARGUMENTS:\n");
 	GMT_Option (API, "J-Z,R");
 	GMT_Usage (API, 1, "\n-T<now>");
-	GMT_Usage (API, -2, "Specify the time for preparing events.");
+	GMT_Usage (API, -2, "Specify the time for preparing events.  Alternatively, give a <start>/<stop>/<inc>[+n] frame-time series "
+		"to stream symbol and label files for all those times from a single read of the events; this requires -Q and no plotting is done.");
 	GMT_Message (API, GMT_TIME_NONE, "\n  OPTIONAL ARGUMENTS:\n");
 	GMT_Option (API, "<");
 	GMT_Usage (API, -2, "Record format: lon lat [z] [size] time [length|time2].");
@@ -648,8 +652,14 @@ maybe_set_two:
 	if (Ctrl->C.active) n_col++;	/* Need to read one more column for z */
 	if (Ctrl->S.mode) n_col++;	/* Must allow for size in input before time and length */
 	if (t_string) {	/* Do a special check for absolute time since auto-detection based on input file has not happened yet and user may have forgotten about -f */
-		enum gmt_col_enum type = (strchr (t_string, 'T')) ? GMT_IS_ABSTIME : gmt_M_type (GMT, GMT_IN, n_col-1);
-		n_errors += gmt_verify_expectations (GMT, type, gmt_scanf_arg (GMT, t_string, type, false, &Ctrl->T.now), t_string);
+		if (strchr (t_string, '/')) {	/* Got a <start>/<stop>/<inc> frame-time series; we will stream all those frames from this one process */
+			n_errors += gmt_parse_array (GMT, 'T', t_string, &(Ctrl->T.T), GMT_ARRAY_TIME | GMT_ARRAY_RANGE, 0);
+			Ctrl->T.series = true;
+		}
+		else {
+			enum gmt_col_enum type = (strchr (t_string, 'T')) ? GMT_IS_ABSTIME : gmt_M_type (GMT, GMT_IN, n_col-1);
+			n_errors += gmt_verify_expectations (GMT, type, gmt_scanf_arg (GMT, t_string, type, false, &Ctrl->T.now), t_string);
+		}
 	}
 	else if (Ctrl->A.mode != PSEVENTS_LINE_TO_POINTS) {
 		GMT_Report (API, GMT_MSG_ERROR, "Option -T: -T<now> is a required option.\n");
@@ -677,6 +687,7 @@ maybe_set_two:
 		n_errors += gmt_M_check_condition (GMT, Ctrl->W.active, "Option -W: Not allowed with -Ar<dpu>.\n");
 		n_errors += gmt_M_check_condition (GMT, GMT->current.setting.proj_length_unit == GMT_PT, "PROJ_LENGTH_UNIT: Must be either cm or inch for -Ar<dpu> to work.\n");
 	}
+	n_errors += gmt_M_check_condition (GMT, Ctrl->T.series && !Ctrl->Q.active, "Option -T: A frame-time series requires -Q to set the output file prefix.\n");
 	n_errors += gmt_M_check_condition (GMT, !Ctrl->C.active && Ctrl->M.active[PSEVENTS_DZ], "Option -Mv: Requires -C");
 	n_errors += gmt_M_check_condition (GMT, !gmt_M_is_zero (Ctrl->E.dt[PSEVENTS_TEXT][PSEVENTS_DECAY]), "Option -Et: No decay phase for labels.\n");
 	n_errors += gmt_M_check_condition (GMT, !gmt_M_is_zero (Ctrl->E.dt[PSEVENTS_TEXT][PSEVENTS_PLATEAU]), "Option -Et: No plateau phase for labels.\n");
@@ -911,18 +922,19 @@ EXTERN_MSC int GMT_psevents (void *V_API, int mode, void *args) {
 	char string[GMT_LEN128] = {""}, header[GMT_BUFSIZ] = {""}, X[GMT_LEN32] = {""}, Y[GMT_LEN32] = {""};
 
 	bool do_coda, finite_duration, has_text, out_segment = false, have_previous_point = false;
+	bool time_sorted = false, frame_done = false;
 
 	int error;
 
 	enum gmt_col_enum time_type, end_type;
 
 	unsigned int n_cols_needed, n_copy_to_out, col, t_in = 2, d_in = 3, x_col = 2, i_col = 3, t_col = 4;
-	unsigned int x_type, y_type, geometry;
+	unsigned int x_type, y_type, geometry, frame, n_frames = 1, ndigits = 1;
 
 	uint64_t tbl, seg, row, n_symbols_plotted = 0, n_labels_plotted = 0;
 
 	double out[20], in[GMT_LEN16], last_in[3];
-	double t[PSEVENTS_NT], x, t_event_seg, t_end_seg;
+	double t[PSEVENTS_NT], x, t_event_seg, t_end_seg, t_lead = 0.0;
 
 	FILE *fp_symbols = NULL, *fp_labels = NULL;
 
@@ -1189,203 +1201,255 @@ EXTERN_MSC int GMT_psevents (void *V_API, int mode, void *args) {
 		Return (API->error);
 	}
 
-	for (tbl = 0; tbl < D->n_tables; tbl++) {
-		for (seg = 0; seg < D->table[tbl]->n_segments; seg++) {
-			S = D->table[tbl]->segment[seg];	/* Shorthand */
+	if (Ctrl->T.series) {	/* Build the frame-time array so we can stream all frames from this single read of the events */
+		if (gmt_create_array (GMT, 'T', &(Ctrl->T.T), NULL, NULL)) Return (GMT_RUNTIME_ERROR);
+		n_frames = (unsigned int)Ctrl->T.T.n;
+		ndigits = urint (floor (log10 ((double)n_frames))) + 1;
+		GMT_Report (API, GMT_MSG_INFORMATION, "Streaming symbol and label sets for %u frame times\n", n_frames);
+	}
 
-			if (Ctrl->A.active) {	/* Process and echo any segment headers for lines and polygons */
-				if (Ctrl->A.mode == PSEVENTS_LINE_SEG) {	/* We require the -Tstring option in the header for segments */
-					if (gmt_parse_segment_item (GMT, S->header, "-T", string)) {	/* Found required -Targs */
-						if (Ctrl->L.mode == PSEVENTS_FIXED_DURATION) {	/* Just get event time */
-							gmt_scanf_arg (GMT, string, time_type, false, &t_event_seg);
-						}
-						else {	/* Get both event time and end time (or duration) */
-							char start[GMT_LEN64] = {""}, stop[GMT_LEN64] = {""};
-							if ((c = strchr (string, ','))) c[0] = ' ';
-							else if ((c = strchr (string, '/'))) c[0] = ' ';
-							else {
-								GMT_Report (API, GMT_MSG_ERROR, "Segment header missing required -T<time>,<end|duration> or -T<time>/<end|duration> option!\n");
-								if (fp_labels) fclose (fp_labels);
-								if (fp_symbols) fclose (fp_symbols);
-								Return (GMT_RUNTIME_ERROR);
+	if (Ctrl->T.series && !Ctrl->A.active) {	/* See if event times are sorted so each frame can stop scanning once it reaches future events */
+		double t_prev = -DBL_MAX;
+		time_sorted = true;
+		for (tbl = 0; time_sorted && tbl < D->n_tables; tbl++) {
+			for (seg = 0; time_sorted && seg < D->table[tbl]->n_segments; seg++) {
+				S = D->table[tbl]->segment[seg];
+				for (row = 0; row < S->n_rows; row++) {
+					if (S->data[t_in][row] < t_prev) { time_sorted = false; break; }
+					t_prev = S->data[t_in][row];
+				}
+			}
+		}
+		if (time_sorted) {	/* Determine the earliest lead before its event time that any phase becomes visible */
+			t_lead = DBL_MAX;
+			if (Ctrl->E.active[PSEVENTS_SYMBOL]) t_lead = MIN (t_lead, Ctrl->E.dt[PSEVENTS_SYMBOL][PSEVENTS_OFFSET] - Ctrl->E.dt[PSEVENTS_SYMBOL][PSEVENTS_RISE]);
+			if (Ctrl->E.active[PSEVENTS_TEXT])   t_lead = MIN (t_lead, Ctrl->E.dt[PSEVENTS_TEXT][PSEVENTS_OFFSET] - Ctrl->E.dt[PSEVENTS_TEXT][PSEVENTS_RISE]);
+			if (t_lead == DBL_MAX) t_lead = 0.0;
+			GMT_Report (API, GMT_MSG_INFORMATION, "Event times are sorted; frames will skip all not-yet-risen events\n");
+		}
+	}
+
+	for (frame = 0; frame < n_frames; frame++) {	/* Normally a single frame time; with -T<start>/<stop>/<inc> we stream them all */
+		if (Ctrl->T.series) Ctrl->T.now = Ctrl->T.T.array[frame];	/* Update the current frame time */
+		frame_done = false;	out_segment = have_previous_point = false;	/* Reset per-frame state */
+		for (tbl = 0; tbl < D->n_tables; tbl++) {
+			for (seg = 0; seg < D->table[tbl]->n_segments; seg++) {
+				S = D->table[tbl]->segment[seg];	/* Shorthand */
+
+				if (Ctrl->A.active) {	/* Process and echo any segment headers for lines and polygons */
+					if (Ctrl->A.mode == PSEVENTS_LINE_SEG) {	/* We require the -Tstring option in the header for segments */
+						if (gmt_parse_segment_item (GMT, S->header, "-T", string)) {	/* Found required -Targs */
+							if (Ctrl->L.mode == PSEVENTS_FIXED_DURATION) {	/* Just get event time */
+								gmt_scanf_arg (GMT, string, time_type, false, &t_event_seg);
+							}
+							else {	/* Get both event time and end time (or duration) */
+								char start[GMT_LEN64] = {""}, stop[GMT_LEN64] = {""};
+								if ((c = strchr (string, ','))) c[0] = ' ';
+								else if ((c = strchr (string, '/'))) c[0] = ' ';
+								else {
+									GMT_Report (API, GMT_MSG_ERROR, "Segment header missing required -T<time>,<end|duration> or -T<time>/<end|duration> option!\n");
+									if (fp_labels) fclose (fp_labels);
+									if (fp_symbols) fclose (fp_symbols);
+									Return (GMT_RUNTIME_ERROR);
+								}
+								sscanf (string, "%s %s", start, stop);
+								gmt_scanf_arg (GMT, start, time_type, false, &t_event_seg);
+								gmt_scanf_arg (GMT, stop,  end_type,  false, &t_end_seg);
 							}
-							sscanf (string, "%s %s", start, stop);
-							gmt_scanf_arg (GMT, start, time_type, false, &t_event_seg);
-							gmt_scanf_arg (GMT, stop,  end_type,  false, &t_end_seg);
+						}
+						else {	/* We require the -Tstring option in the header for segments */
+							GMT_Report (API, GMT_MSG_ERROR, "Segment header missing required -T<time> option!\n");
+							if (fp_labels) fclose (fp_labels);
+							if (fp_symbols) fclose (fp_symbols);
+							Return (GMT_RUNTIME_ERROR);
 						}
 					}
-					else {	/* We require the -Tstring option in the header for segments */
-						GMT_Report (API, GMT_MSG_ERROR, "Segment header missing required -T<time> option!\n");
-						if (fp_labels) fclose (fp_labels);
-						if (fp_symbols) fclose (fp_symbols);
-						Return (GMT_RUNTIME_ERROR);
+					/* build output segment header: Pass any -Z<val>, -G<fill> -W<pen> as given, but if no -G, -W and command line has them we add them.
+					 * We do this because -t<transparency> will also be added and this is how the -G -W colors will acquire transparency in psxy */
+					gmt_M_memset (header, GMT_BUFSIZ, char);	/* Wipe header record */
+					if (Ctrl->C.active && gmt_parse_segment_item (GMT, S->header, "-Z", string)) {	/* Found optional -Z<val> and -C<cpt> is in effect */
+						strcat (header, " -Z"); strcat (header, string);
 					}
-				}
-				/* build output segment header: Pass any -Z<val>, -G<fill> -W<pen> as given, but if no -G, -W and command line has them we add them.
-				 * We do this because -t<transparency> will also be added and this is how the -G -W colors will acquire transparency in psxy */
-				gmt_M_memset (header, GMT_BUFSIZ, char);	/* Wipe header record */
-				if (Ctrl->C.active && gmt_parse_segment_item (GMT, S->header, "-Z", string)) {	/* Found optional -Z<val> and -C<cpt> is in effect */
-					strcat (header, " -Z"); strcat (header, string);
-				}
-				if (gmt_parse_segment_item (GMT, S->header, "-W", string)) {	/* Found optional -W<pen> */
-					strcat (header, " -W"); strcat (header, string);
-				}
-				else if (Ctrl->W.active) {	/* Issue the current pen instead */
-					strcat (header, " -W"); strcat (header, Ctrl->W.pen);
-				}
-				if (Ctrl->A.mode == PSEVENTS_LINE_SEG) {	/* Deal with optional -G<fill> */
-					if (gmt_parse_segment_item (GMT, S->header, "-G", string)) {	/* Found optional -G<fill> */
-						strcat (header, " -G"); strcat (header, string);
+					if (gmt_parse_segment_item (GMT, S->header, "-W", string)) {	/* Found optional -W<pen> */
+						strcat (header, " -W"); strcat (header, string);
 					}
-					else if (Ctrl->G.active) {	/* Issue the current fill instead */
-						strcat (header, " -G"); strcat (header, Ctrl->G.fill);
+					else if (Ctrl->W.active) {	/* Issue the current pen instead */
+						strcat (header, " -W"); strcat (header, Ctrl->W.pen);
 					}
+					if (Ctrl->A.mode == PSEVENTS_LINE_SEG) {	/* Deal with optional -G<fill> */
+						if (gmt_parse_segment_item (GMT, S->header, "-G", string)) {	/* Found optional -G<fill> */
+							strcat (header, " -G"); strcat (header, string);
+						}
+						else if (Ctrl->G.active) {	/* Issue the current fill instead */
+							strcat (header, " -G"); strcat (header, Ctrl->G.fill);
+						}
+					}
+					out_segment = true;	/* Time to echo out a segment header */
 				}
-				out_segment = true;	/* Time to echo out a segment header */
-			}
 
-			for (row = 0; row < S->n_rows; row++) {
-				for (col = 0; col < S->n_columns; col++) in[col] = S->data[col][row];	/* Make a local copy since we will be making changes */
-				has_text = (S->text && S->text[row]);	/* True if this record has trailing text */
+				for (row = 0; row < S->n_rows; row++) {
+					for (col = 0; col < S->n_columns; col++) in[col] = S->data[col][row];	/* Make a local copy since we will be making changes */
+					has_text = (S->text && S->text[row]);	/* True if this record has trailing text */
 
-				if (Ctrl->A.mode == PSEVENTS_LINE_SEG) {	/* Assign new segment start/end times for lines/polygons */
-					in[t_in] = t_event_seg;	/* Current segment event start time */
-					if (Ctrl->L.mode != PSEVENTS_FIXED_DURATION)	/* Set segment end time or duration */
-						in[d_in] = t_end_seg;
-				}
+					if (time_sorted && in[t_in] + t_lead > Ctrl->T.now) {	/* Sorted input means all remaining events are still in the future */
+						frame_done = true;
+						break;
+					}
 
-				if (Ctrl->E.active[PSEVENTS_SYMBOL]) {	/* Plot event symbols */
-					t[PSEVENTS_T_END] = DBL_MAX;	/* Infinite duration until overridden below */
-					t[PSEVENTS_T_EVENT] = in[t_in] + Ctrl->E.dt[PSEVENTS_SYMBOL][PSEVENTS_OFFSET];	/* Nominal (or offset) start of this event */
-					t[PSEVENTS_T_RISE] = t[PSEVENTS_T_EVENT] - Ctrl->E.dt[PSEVENTS_SYMBOL][PSEVENTS_RISE];		/* Earliest time to plot anything at all for this event */
-					if (Ctrl->T.now < t[PSEVENTS_T_RISE]) {
-						if (Ctrl->A.active && have_previous_point) {	/* Linearly interpolate to supply the intermediate point on line first */
-							double dx, f = (Ctrl->T.now - last_in[t_in]) / (in[t_in] - last_in[t_in]);	/* Fractional portion of time for this line segment */
-							if (gmt_M_is_geographic (GMT, GMT_IN)) {
-								gmt_M_set_delta_lon (last_in[GMT_X], in[GMT_X], dx);	/* Beware of jumps due to sign differences */
+					if (Ctrl->A.mode == PSEVENTS_LINE_SEG) {	/* Assign new segment start/end times for lines/polygons */
+						in[t_in] = t_event_seg;	/* Current segment event start time */
+						if (Ctrl->L.mode != PSEVENTS_FIXED_DURATION)	/* Set segment end time or duration */
+							in[d_in] = t_end_seg;
+					}
+
+					if (Ctrl->E.active[PSEVENTS_SYMBOL]) {	/* Plot event symbols */
+						t[PSEVENTS_T_END] = DBL_MAX;	/* Infinite duration until overridden below */
+						t[PSEVENTS_T_EVENT] = in[t_in] + Ctrl->E.dt[PSEVENTS_SYMBOL][PSEVENTS_OFFSET];	/* Nominal (or offset) start of this event */
+						t[PSEVENTS_T_RISE] = t[PSEVENTS_T_EVENT] - Ctrl->E.dt[PSEVENTS_SYMBOL][PSEVENTS_RISE];		/* Earliest time to plot anything at all for this event */
+						if (Ctrl->T.now < t[PSEVENTS_T_RISE]) {
+							if (Ctrl->A.active && have_previous_point) {	/* Linearly interpolate to supply the intermediate point on line first */
+								double dx, f = (Ctrl->T.now - last_in[t_in]) / (in[t_in] - last_in[t_in]);	/* Fractional portion of time for this line segment */
+								if (gmt_M_is_geographic (GMT, GMT_IN)) {
+									gmt_M_set_delta_lon (last_in[GMT_X], in[GMT_X], dx);	/* Beware of jumps due to sign differences */
+								}
+								else
+									dx = in[GMT_X] -  last_in[GMT_X];
+								out[GMT_X] = last_in[GMT_X] + f * dx;
+								out[GMT_Y] = last_in[GMT_Y] + f * (in[GMT_Y] -  last_in[GMT_Y]);
+								psevents_set_XY (GMT, x_type, y_type, out, X, Y);
+								fprintf (fp_symbols, "%s\t%s\n", X, Y);
+								have_previous_point = false;	/* So we do not repeat this step for this line segment */
 							}
-							else
-								dx = in[GMT_X] -  last_in[GMT_X];
-							out[GMT_X] = last_in[GMT_X] + f * dx;
-							out[GMT_Y] = last_in[GMT_Y] + f * (in[GMT_Y] -  last_in[GMT_Y]);
-							psevents_set_XY (GMT, x_type, y_type, out, X, Y);
-							fprintf (fp_symbols, "%s\t%s\n", X, Y);
-							have_previous_point = false;	/* So we do not repeat this step for this line segment */
+							goto Do_txt;	/* This event is still in the future so we skip it */
 						}
-						goto Do_txt;	/* This event is still in the future so we skip it */
-					}
-					/* Compute the last time we need to plot the event [infinity] */
-					if (Ctrl->L.mode == PSEVENTS_FIXED_DURATION)	/* Only show the event as stable during this fixed interval */
-						t[PSEVENTS_T_END] = t[PSEVENTS_T_EVENT] + Ctrl->L.length;
-					else if (Ctrl->L.mode == PSEVENTS_VAR_DURATION)	/* Only show the event as stable during its individual interval */
-						t[PSEVENTS_T_END] = t[PSEVENTS_T_EVENT] + in[d_in];
-					else if (Ctrl->L.mode == PSEVENTS_VAR_ENDTIME)	/* Only show the event as stable until its end time */
-						t[PSEVENTS_T_END] = in[d_in];
-					if (t[PSEVENTS_T_END] < DBL_MAX && Ctrl->E.trim[PSEVENTS_SYMBOL]) t[PSEVENTS_T_END] -= Ctrl->E.dt[PSEVENTS_SYMBOL][PSEVENTS_OFFSET];	/* Offset applied to t_end */
-					t[PSEVENTS_T_FADE] = t[PSEVENTS_T_END] + Ctrl->E.dt[PSEVENTS_SYMBOL][PSEVENTS_FADE];		/* End of the fade phase */
-					if (!do_coda && Ctrl->T.now > t[PSEVENTS_T_FADE]) goto Do_txt;	/* Event is in the past and there is no coda, so skip plotting it */
-
-					/* Here we must plot one phase of this event */
-
-					if (n_symbols_plotted == 0) {	/* Open output events file the first time */
-						if (Ctrl->Q.active)	/* We want a persistent file to survive this process */
-							sprintf (tmp_file_symbols, "%s_symbols.txt", Ctrl->Q.file);
-						else	/* Temporary file to be deleted after use */
-							sprintf (tmp_file_symbols, "%s/GMT_psevents_symbols_%d.txt", API->tmp_dir, (int)getpid());
-						if ((fp_symbols = fopen (tmp_file_symbols, "w")) == NULL) {
-							GMT_Report (API, GMT_MSG_ERROR, "Unable to create file %s\n", tmp_file_symbols);
-							if (fp_labels) fclose (fp_labels);
-							Return (GMT_RUNTIME_ERROR);
+						/* Compute the last time we need to plot the event [infinity] */
+						if (Ctrl->L.mode == PSEVENTS_FIXED_DURATION)	/* Only show the event as stable during this fixed interval */
+							t[PSEVENTS_T_END] = t[PSEVENTS_T_EVENT] + Ctrl->L.length;
+						else if (Ctrl->L.mode == PSEVENTS_VAR_DURATION)	/* Only show the event as stable during its individual interval */
+							t[PSEVENTS_T_END] = t[PSEVENTS_T_EVENT] + in[d_in];
+						else if (Ctrl->L.mode == PSEVENTS_VAR_ENDTIME)	/* Only show the event as stable until its end time */
+							t[PSEVENTS_T_END] = in[d_in];
+						if (t[PSEVENTS_T_END] < DBL_MAX && Ctrl->E.trim[PSEVENTS_SYMBOL]) t[PSEVENTS_T_END] -= Ctrl->E.dt[PSEVENTS_SYMBOL][PSEVENTS_OFFSET];	/* Offset applied to t_end */
+						t[PSEVENTS_T_FADE] = t[PSEVENTS_T_END] + Ctrl->E.dt[PSEVENTS_SYMBOL][PSEVENTS_FADE];		/* End of the fade phase */
+						if (!do_coda && Ctrl->T.now > t[PSEVENTS_T_FADE]) goto Do_txt;	/* Event is in the past and there is no coda, so skip plotting it */
+
+						/* Here we must plot one phase of this event */
+
+						if (fp_symbols == NULL) {	/* Open output events file the first time this frame needs it */
+							if (Ctrl->T.series)	/* One persistent file per frame time */
+								sprintf (tmp_file_symbols, "%s_%*.*d_symbols.txt", Ctrl->Q.file, (int)ndigits, (int)ndigits, (int)frame);
+							else if (Ctrl->Q.active)	/* We want a persistent file to survive this process */
+								sprintf (tmp_file_symbols, "%s_symbols.txt", Ctrl->Q.file);
+							else	/* Temporary file to be deleted after use */
+								sprintf (tmp_file_symbols, "%s/GMT_psevents_symbols_%d.txt", API->tmp_dir, (int)getpid());
+							if ((fp_symbols = fopen (tmp_file_symbols, "w")) == NULL) {
+								GMT_Report (API, GMT_MSG_ERROR, "Unable to create file %s\n", tmp_file_symbols);
+								if (fp_labels) fclose (fp_labels);
+								Return (GMT_RUNTIME_ERROR);
+							}
 						}
-					}
-					gmt_M_memcpy (out, in, n_copy_to_out, double);	/* Pass out the key input parameters unchanged (but not time, duration) */
-					out[x_col] = (t[PSEVENTS_T_RISE] <= Ctrl->T.now) ? 1.0 : 0.0;	/* Default size is a step-function unless modulated below */
+						gmt_M_memcpy (out, in, n_copy_to_out, double);	/* Pass out the key input parameters unchanged (but not time, duration) */
+						out[x_col] = (t[PSEVENTS_T_RISE] <= Ctrl->T.now) ? 1.0 : 0.0;	/* Default size is a step-function unless modulated below */
 
-					t[PSEVENTS_T_PLATEAU] = t[PSEVENTS_T_EVENT] + Ctrl->E.dt[PSEVENTS_SYMBOL][PSEVENTS_PLATEAU];	/* End of the plateau phase */
-					t[PSEVENTS_T_DECAY] = t[PSEVENTS_T_PLATEAU] + Ctrl->E.dt[PSEVENTS_SYMBOL][PSEVENTS_DECAY];	/* End of the decay phase */
+						t[PSEVENTS_T_PLATEAU] = t[PSEVENTS_T_EVENT] + Ctrl->E.dt[PSEVENTS_SYMBOL][PSEVENTS_PLATEAU];	/* End of the plateau phase */
+						t[PSEVENTS_T_DECAY] = t[PSEVENTS_T_PLATEAU] + Ctrl->E.dt[PSEVENTS_SYMBOL][PSEVENTS_DECAY];	/* End of the decay phase */
 
-					psevents_set_outarray (GMT, Ctrl, Ctrl->T.now, t, finite_duration, do_coda, x_col, i_col, t_col, GMT_Z, out);
+						psevents_set_outarray (GMT, Ctrl, Ctrl->T.now, t, finite_duration, do_coda, x_col, i_col, t_col, GMT_Z, out);
 
-					if (out_segment) {	/* Write segment header for lines and polygons only */
-						fprintf (fp_symbols, "%c -t%g %s\n", GMT->current.setting.io_seg_marker[GMT_OUT], out[t_col], header);
-						out_segment = false;	/* Wait for next segment header */
-					}
-					psevents_set_XY (GMT, x_type, y_type, out, X, Y);
-
-					fprintf (fp_symbols, "%s\t%s", X, Y);	/* All need the map coordinates */
-					if (Ctrl->Z.active) {	/* A variable set of coordinates */
-						for (col = GMT_Z; col <= t_col; col++)
-							fprintf (fp_symbols, "\t%g", out[col]);	/* Write out all required and extra columns */
-						if (has_text)	/* Also output the trailing text */
-							fprintf (fp_symbols, "\t%s", S->text[row]);
-						fprintf (fp_symbols, "\n");
-					}
-					else if (Ctrl->A.active) {	/* Just needed the line coordinates */
-						fprintf (fp_symbols, "\n");
-						gmt_M_memcpy (last_in, in, 3U, double);
-						have_previous_point = true;	/* Now we are able to interpolate if needed */
-					}
-					else {	/* Symbols -S, which may need optional -C and -S columns before the scale, intens, transp are appended */ 
-						for (col = GMT_Z; col < n_copy_to_out; col++)
-							fprintf (fp_symbols, "\t%.16g", out[col]);
-						fprintf (fp_symbols, "\t%g\t%g\t%g\n", out[x_col], out[i_col], out[t_col]);
+						if (out_segment) {	/* Write segment header for lines and polygons only */
+							fprintf (fp_symbols, "%c -t%g %s\n", GMT->current.setting.io_seg_marker[GMT_OUT], out[t_col], header);
+							out_segment = false;	/* Wait for next segment header */
+						}
+						psevents_set_XY (GMT, x_type, y_type, out, X, Y);
+
+						fprintf (fp_symbols, "%s\t%s", X, Y);	/* All need the map coordinates */
+						if (Ctrl->Z.active) {	/* A variable set of coordinates */
+							for (col = GMT_Z; col <= t_col; col++)
+								fprintf (fp_symbols, "\t%g", out[col]);	/* Write out all required and extra columns */
+							if (has_text)	/* Also output the trailing text */
+								fprintf (fp_symbols, "\t%s", S->text[row]);
+							fprintf (fp_symbols, "\n");
+						}
+						else if (Ctrl->A.active) {	/* Just needed the line coordinates */
+							fprintf (fp_symbols, "\n");
+							gmt_M_memcpy (last_in, in, 3U, double);
+							have_previous_point = true;	/* Now we are able to interpolate if needed */
+						}
+						else {	/* Symbols -S, which may need optional -C and -S columns before the scale, intens, transp are appended */ 
+							for (col = GMT_Z; col < n_copy_to_out; col++)
+								fprintf (fp_symbols, "\t%.16g", out[col]);
+							fprintf (fp_symbols, "\t%g\t%g\t%g\n", out[x_col], out[i_col], out[t_col]);
+						}
+						n_symbols_plotted++;	/* Count output symbols */
 					}
-					n_symbols_plotted++;	/* Count output symbols */
-				}
 
-Do_txt:			if (Ctrl->E.active[PSEVENTS_TEXT] && has_text) {	/* Also plot trailing text strings */
-					t[PSEVENTS_T_END] = DBL_MAX;	/* Infinite duration until overridden below */
-					t[PSEVENTS_T_EVENT] = in[t_in] + Ctrl->E.dt[PSEVENTS_TEXT][PSEVENTS_OFFSET];	/* Nominal (or offset) start of this event */
-					t[PSEVENTS_T_RISE] = t[PSEVENTS_T_EVENT] - Ctrl->E.dt[PSEVENTS_TEXT][PSEVENTS_RISE];	/* Earliest time to plot anything at all for this event */
-					if (Ctrl->T.now < t[PSEVENTS_T_RISE]) continue;	/* This event is still in the future */
-					/* Compute the last time we need to plot the event [infinity] */
-					if (Ctrl->E.dt[PSEVENTS_TEXT][PSEVENTS_LENGTH] > 0.0)	/* Overriding with specific label duration */
-						t[PSEVENTS_T_END] = t[PSEVENTS_T_EVENT] + Ctrl->E.dt[PSEVENTS_TEXT][PSEVENTS_LENGTH];
-					else if (Ctrl->L.mode == PSEVENTS_FIXED_DURATION)	/* Only show the label during this fixed interval given via -L or -Et+l */
-						t[PSEVENTS_T_END] = t[PSEVENTS_T_EVENT] + Ctrl->L.length;
-					else if (Ctrl->L.mode == PSEVENTS_VAR_DURATION)	/* Only show the label during its individual interval read from file */
-						t[PSEVENTS_T_END] = t[PSEVENTS_T_EVENT] + in[d_in];
-					else if (Ctrl->L.mode == PSEVENTS_VAR_ENDTIME)	/* Only show the label until its end time read from file */
-						t[PSEVENTS_T_END] = in[d_in];
-					if (t[PSEVENTS_T_END] < DBL_MAX && Ctrl->E.trim[PSEVENTS_TEXT]) t[PSEVENTS_T_END] -= Ctrl->E.dt[PSEVENTS_TEXT][PSEVENTS_OFFSET];	/* Offset applied to t_end */
-					t[PSEVENTS_T_FADE] = t[PSEVENTS_T_END] + Ctrl->E.dt[PSEVENTS_TEXT][PSEVENTS_FADE];	/* End of the fade phase */
-					if (!do_coda && Ctrl->T.now > t[PSEVENTS_T_FADE]) continue;				/* Event is in the past and there is no coda */
-
-					/* Here we must plot a label during one phase of this event */
-
-					if (n_labels_plotted == 0) {	/* Open output events file the first time */
-						if (Ctrl->Q.active)	/* We want a persistent file to survive this process */
-							sprintf (tmp_file_labels, "%s_labels.txt", Ctrl->Q.file);
-						else	/* Temporary file to be deleted after use */
-							sprintf (tmp_file_labels, "%s/GMT_psevents_labels_%d.txt", API->tmp_dir, (int)getpid());
-						if ((fp_labels = fopen (tmp_file_labels, "w")) == NULL) {
-							GMT_Report (API, GMT_MSG_ERROR, "Unable to create file %s\n", tmp_file_labels);
-							Return (GMT_RUNTIME_ERROR);
+	Do_txt:			if (Ctrl->E.active[PSEVENTS_TEXT] && has_text) {	/* Also plot trailing text strings */
+						t[PSEVENTS_T_END] = DBL_MAX;	/* Infinite duration until overridden below */
+						t[PSEVENTS_T_EVENT] = in[t_in] + Ctrl->E.dt[PSEVENTS_TEXT][PSEVENTS_OFFSET];	/* Nominal (or offset) start of this event */
+						t[PSEVENTS_T_RISE] = t[PSEVENTS_T_EVENT] - Ctrl->E.dt[PSEVENTS_TEXT][PSEVENTS_RISE];	/* Earliest time to plot anything at all for this event */
+						if (Ctrl->T.now < t[PSEVENTS_T_RISE]) continue;	/* This event is still in the future */
+						/* Compute the last time we need to plot the event [infinity] */
+						if (Ctrl->E.dt[PSEVENTS_TEXT][PSEVENTS_LENGTH] > 0.0)	/* Overriding with specific label duration */
+							t[PSEVENTS_T_END] = t[PSEVENTS_T_EVENT] + Ctrl->E.dt[PSEVENTS_TEXT][PSEVENTS_LENGTH];
+						else if (Ctrl->L.mode == PSEVENTS_FIXED_DURATION)	/* Only show the label during this fixed interval given via -L or -Et+l */
+							t[PSEVENTS_T_END] = t[PSEVENTS_T_EVENT] + Ctrl->L.length;
+						else if (Ctrl->L.mode == PSEVENTS_VAR_DURATION)	/* Only show the label during its individual interval read from file */
+							t[PSEVENTS_T_END] = t[PSEVENTS_T_EVENT] + in[d_in];
+						else if (Ctrl->L.mode == PSEVENTS_VAR_ENDTIME)	/* Only show the label until its end time read from file */
+							t[PSEVENTS_T_END] = in[d_in];
+						if (t[PSEVENTS_T_END] < DBL_MAX && Ctrl->E.trim[PSEVENTS_TEXT]) t[PSEVENTS_T_END] -= Ctrl->E.dt[PSEVENTS_TEXT][PSEVENTS_OFFSET];	/* Offset applied to t_end */
+						t[PSEVENTS_T_FADE] = t[PSEVENTS_T_END] + Ctrl->E.dt[PSEVENTS_TEXT][PSEVENTS_FADE];	/* End of the fade phase */
+						if (!do_coda && Ctrl->T.now > t[PSEVENTS_T_FADE]) continue;				/* Event is in the past and there is no coda */
+
+						/* Here we must plot a label during one phase of this event */
+
+						if (fp_labels == NULL) {	/* Open output events file the first time this frame needs it */
+							if (Ctrl->T.series)	/* One persistent file per frame time */
+								sprintf (tmp_file_labels, "%s_%*.*d_labels.txt", Ctrl->Q.file, (int)ndigits, (int)ndigits, (int)frame);
+							else if (Ctrl->Q.active)	/* We want a persistent file to survive this process */
+								sprintf (tmp_file_labels, "%s_labels.txt", Ctrl->Q.file);
+							else	/* Temporary file to be deleted after use */
+								sprintf (tmp_file_labels, "%s/GMT_psevents_labels_%d.txt", API->tmp_dir, (int)getpid());
+							if ((fp_labels = fopen (tmp_file_labels, "w")) == NULL) {
+								GMT_Report (API, GMT_MSG_ERROR, "Unable to create file %s\n", tmp_file_labels);
+								Return (GMT_RUNTIME_ERROR);
+							}
 						}
-					}
-					psevents_set_XY (GMT, x_type, y_type, in, X, Y);	/* Pass out the input coordinates unchanged */
+						psevents_set_XY (GMT, x_type, y_type, in, X, Y);	/* Pass out the input coordinates unchanged */
 
-					/* Labels have variable transparency during optional rise and fade, and fully opaque during normal section, and skipped otherwise unless coda */
+						/* Labels have variable transparency during optional rise and fade, and fully opaque during normal section, and skipped otherwise unless coda */
 
-					if (Ctrl->T.now < t[PSEVENTS_T_EVENT]) {	/* We are within the rise phase */
-						x = psevents_ramp (GMT, Ctrl, PSEVENTS_TEXT, PSEVENTS_DECAY, t, Ctrl->T.now);	/* Ramp function */
-						out[GMT_Z] = Ctrl->M.value[PSEVENTS_TRANSP][PSEVENTS_VAL1] * (1.0 - x);		/* Magnification of opacity */
-					}
-					else if (finite_duration && Ctrl->T.now < t[PSEVENTS_T_END])	/* We are within the normal phase, keep everything constant */
-						out[GMT_Z] = 0.0;	/* No transparency during this phase */
-					else if (finite_duration && Ctrl->T.now <= t[PSEVENTS_T_FADE]) {	/* We are within the fade phase */
-						x = psevents_ramp (GMT, Ctrl, PSEVENTS_TEXT, PSEVENTS_FADE, t, Ctrl->T.now);	/* Ramp function */
-						out[GMT_Z] = Ctrl->M.value[PSEVENTS_TRANSP][PSEVENTS_VAL2] * (1.0 - x);		/* Increase of transparency up to coda transparency */
+						if (Ctrl->T.now < t[PSEVENTS_T_EVENT]) {	/* We are within the rise phase */
+							x = psevents_ramp (GMT, Ctrl, PSEVENTS_TEXT, PSEVENTS_DECAY, t, Ctrl->T.now);	/* Ramp function */
+							out[GMT_Z] = Ctrl->M.value[PSEVENTS_TRANSP][PSEVENTS_VAL1] * (1.0 - x);		/* Magnification of opacity */
+						}
+						else if (finite_duration && Ctrl->T.now < t[PSEVENTS_T_END])	/* We are within the normal phase, keep everything constant */
+							out[GMT_Z] = 0.0;	/* No transparency during this phase */
+						else if (finite_duration && Ctrl->T.now <= t[PSEVENTS_T_FADE]) {	/* We are within the fade phase */
+							x = psevents_ramp (GMT, Ctrl, PSEVENTS_TEXT, PSEVENTS_FADE, t, Ctrl->T.now);	/* Ramp function */
+							out[GMT_Z] = Ctrl->M.value[PSEVENTS_TRANSP][PSEVENTS_VAL2] * (1.0 - x);		/* Increase of transparency up to coda transparency */
+						}
+						else if (do_coda)	/* If there is a coda then the label is visible given its coda attributes */
+							out[GMT_Z] = Ctrl->M.value[PSEVENTS_TRANSP][PSEVENTS_VAL2];
+						fprintf (fp_labels, "%s\t%s\t%g\t%s\n", X, Y, out[GMT_Z], S->text[row]);
+						n_labels_plotted++;	/* Count output labels */
 					}
-					else if (do_coda)	/* If there is a coda then the label is visible given its coda attributes */
-						out[GMT_Z] = Ctrl->M.value[PSEVENTS_TRANSP][PSEVENTS_VAL2];
-					fprintf (fp_labels, "%s\t%s\t%g\t%s\n", X, Y, out[GMT_Z], S->text[row]);
-					n_labels_plotted++;	/* Count output labels */
 				}
+				if (frame_done) break;	/* No point scanning the remaining segments for this frame */
 			}
+			if (frame_done) break;
+		}
+		if (Ctrl->T.series) {	/* Close this frame's files so they are ready for use */
+			if (fp_symbols) {fclose (fp_symbols);	fp_symbols = NULL;}
+			if (fp_labels)  {fclose (fp_labels);	fp_labels = NULL;}
 		}
 	}
 
+	if (Ctrl->T.series) {	/* All frames were streamed to per-frame files; no plotting in this mode */
+		GMT_Report (API, GMT_MSG_INFORMATION, "Events read: %" PRIu64 " Event symbols written: %" PRIu64 " Event labels written: %" PRIu64 "\n", D->n_records, n_symbols_plotted, n_labels_plotted);
+		Return (GMT_NOERROR);
+	}
+
 	if (fp_symbols || fp_labels) {	/* Finalize temporary files */
 		if (fp_symbols) fclose (fp_symbols);	/* Close the file so symbol output is flushed */
 		if (fp_labels)  fclose (fp_labels);		/* Close the file so label output is flushed */
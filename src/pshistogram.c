@@ -209,7 +209,10 @@ GMT_LOCAL int pshistogram_fill_boxes (struct GMT_CTRL *GMT, struct PSHISTOGRAM_I
 	double w, b0, b1, count_sum;
 	uint64_t ibox, i;
 	int64_t sbox, last_box = 0, hi_bin = F->T->n - 2;
-	int64_t (*pshistogram_get_bin) (struct GMT_ARRAY *, double, int64_t);	
+	int64_t (*pshistogram_get_bin) (struct GMT_ARRAY *, double, int64_t);
+#ifdef _OPENMP
+	unsigned int n_threads;
+#endif
 
 	gmt_M_tic (GMT);
 	F->n_boxes = F->T->n - 1;	/* One less than the bin boundaries */
@@ -220,6 +223,46 @@ GMT_LOCAL int pshistogram_fill_boxes (struct GMT_CTRL *GMT, struct PSHISTOGRAM_I
 
 	/* First fill boxes with counts  */
 
+#ifdef _OPENMP
+	if (weights == NULL && n >= BIN_FASTER_IF_THIS_LARGE && (n_threads = omp_get_max_threads ()) > 1) {
+		/* Unweighted binning of many points: let each thread count into a private bin replica,
+		 * then sum the replicas.  Counts are exact integers so the result is identical to the
+		 * serial path; weighted data keep the loop below so the floating-point summation order
+		 * (and hence the bin heights) does not change with the thread count. */
+		uint64_t k, t, n_counted = 0;
+		double *t_boxh = gmt_M_memory (GMT, NULL, (size_t)n_threads * F->n_boxes, double);
+		GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "Binning %" PRIu64 " points in parallel using %u threads\n", n, n_threads);
+#pragma omp parallel shared(F,data,n,t_boxh,pshistogram_get_bin,hi_bin) reduction(+:n_counted)
+		{
+			openmp_int b;
+			int64_t tbox, my_last = 0;
+			uint64_t kbox;
+			double *my_boxh = &t_boxh[(size_t)omp_get_thread_num () * F->n_boxes];
+#pragma omp for schedule(static)
+			for (b = 0; b < (openmp_int)n; b++) {
+				tbox = pshistogram_get_bin (F->T, data[b], my_last);	/* Get the bin where this data point falls */
+				if (tbox < 0) {	/* Extreme value left of first bin; check if -W was set */
+					if ((F->extremes & PSHISTOGRAM_LEFT) == 0) continue;	/* No, we skip this value */
+					tbox = 0;	/* Put in first bin instead */
+				}
+				kbox = (uint64_t)tbox;	/* We know tbox is positive now */
+				if (kbox >= F->n_boxes) {	/* Extreme value right of last bin; check if -W was set */
+					if ((F->extremes & PSHISTOGRAM_RIGHT) == 0) continue;	/* No, we skip this value */
+					kbox = hi_bin;	/* Put in last bin instead */
+				}
+				my_boxh[kbox] += 1.0;
+				n_counted++;
+				my_last = tbox;
+			}
+		}
+		for (t = k = 0; t < n_threads; t++)	/* Sum the per-thread replicas into the shared bin array */
+			for (ibox = 0; ibox < F->n_boxes; ibox++, k++) F->boxh[ibox] += t_boxh[k];
+		F->n_counted = n_counted;
+		F->sum_w += (double)n_counted;	/* Unweighted, so each point counted has unit weight */
+		gmt_M_free (GMT, t_boxh);
+	}
+	else
+#endif
 	for (i = 0; i < n; i++) {
 		sbox = pshistogram_get_bin (F->T, data[i], last_box);	/* Get the bin where this data point falls */
 		if (sbox < 0) {	/* Extreme value left of first bin; check if -W was set */
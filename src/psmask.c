@@ -415,6 +415,65 @@ GMT_LOCAL void psmask_shrink_clip_contours (double *x, double *y, uint64_t np, d
 	}
 }
 
+GMT_LOCAL void psmask_expand_seeds (struct GMT_CTRL *GMT, struct GMT_GRID_HEADER *h, char *grd, char *seed, double *grd_x0, double *grd_y0, openmp_int d_row, openmp_int *d_col, double radius) {
+	/* Expand each distinct node hit by one or more data points (flagged in seed) to all nodes
+	 * within the search radius.  In a dense survey many points map to the same node, so doing
+	 * the expansion once per distinct node instead of once per point saves a great deal of
+	 * distance testing.  We first bin the seed columns per row, then sweep the rows of output
+	 * nodes [in parallel under OpenMP]: each row is written by a single thread so no
+	 * synchronization is needed.  Note d_col is indexed by the row of the node being tested,
+	 * as in the original per-point search [see gmt_prep_nodesearch]. */
+	openmp_int row, col, jj;
+	uint64_t ij, n_seeds = 0, *start = NULL;
+	openmp_int *scol = NULL;
+
+	start = gmt_M_memory (GMT, NULL, h->n_rows + 1, uint64_t);
+	for (row = 0; row < (openmp_int)h->n_rows; row++) {	/* Count the seeds in each row */
+		ij = gmt_M_ijp (h, row, 0);
+		start[row] = n_seeds;
+		for (col = 0; col < (openmp_int)h->n_columns; col++)
+			if (seed[ij+col]) n_seeds++;
+	}
+	start[h->n_rows] = n_seeds;
+	if (n_seeds == 0) {	/* Nothing to expand */
+		gmt_M_free (GMT, start);
+		return;
+	}
+	scol = gmt_M_memory (GMT, NULL, n_seeds, openmp_int);
+	for (row = 0, n_seeds = 0; row < (openmp_int)h->n_rows; row++) {	/* Bin the seed columns per row */
+		ij = gmt_M_ijp (h, row, 0);
+		for (col = 0; col < (openmp_int)h->n_columns; col++)
+			if (seed[ij+col]) scol[n_seeds++] = col;
+	}
+
+#ifdef _OPENMP
+#pragma omp parallel for private(jj) shared(GMT,h,grd,grd_x0,grd_y0,d_row,d_col,radius,start,scol)
+#endif
+	for (jj = 0; jj < (openmp_int)h->n_rows; jj++) {	/* For each row of nodes we may set */
+		openmp_int srow, ii, i_start, s_col;
+		uint64_t k, node;
+		double distance;
+		srow = (jj > d_row) ? jj - d_row : 0;	/* Only seeds within d_row rows can reach row jj */
+		for (; srow <= jj + d_row; srow++) {
+			if (srow >= (openmp_int)h->n_rows) continue;
+			for (k = start[srow]; k < start[srow+1]; k++) {	/* For each seed in this row */
+				s_col = scol[k];
+				i_start = (s_col > d_col[jj]) ? s_col - d_col[jj] : 0;
+				for (ii = i_start; ii <= s_col + d_col[jj]; ii++) {
+					if (ii >= (openmp_int)h->n_columns) continue;
+					node = gmt_M_ijp (h, jj, ii);
+					if (grd[node]) continue;	/* Already set */
+					distance = gmt_distance (GMT, grd_x0[s_col], grd_y0[srow], grd_x0[ii], grd_y0[jj]);
+					if (distance > radius) continue;
+					grd[node] = 1;
+				}
+			}
+		}
+	}
+	gmt_M_free (GMT, scol);
+	gmt_M_free (GMT, start);
+}
+
 static void *New_Ctrl (struct GMT_CTRL *GMT) {	/* Allocate and initialize a new control structure */
 	struct PSMASK_CTRL *C = NULL;
 
@@ -620,7 +679,7 @@ static int parse (struct GMT_CTRL *GMT, struct PSMASK_CTRL *Ctrl, struct GMT_OPT
 #define Return(code) {Free_Ctrl (GMT, Ctrl); gmt_end_module (GMT, GMT_cpy); bailout (code);}
 
 EXTERN_MSC int GMT_psmask (void *V_API, int mode, void *args) {
-	openmp_int row, col, *d_col = NULL, d_row = 0, max_d_col = 0, ii, jj, i_start, j_start;
+	openmp_int row, col, *d_col = NULL, d_row = 0, max_d_col = 0;
 	unsigned int section, k, n_edges;
 	unsigned int io_mode = GMT_WRITE_SET, first = 1;
 	unsigned int fmt[3] = {0, 0, 0}, cont_counts[2] = {0, 0}, *edge = NULL;
@@ -631,9 +690,9 @@ EXTERN_MSC int GMT_psmask (void *V_API, int mode, void *args) {
 
 	size_t n_seg_alloc = 0;
 
-	char *grd = NULL;
+	char *grd = NULL, *seed = NULL;
 
-	double *in = NULL, distance, x0, y0;
+	double *in = NULL, distance;
 	double inc2[2], *x = NULL, *y = NULL, *grd_x0 = NULL, *grd_y0 = NULL;
 
 	struct GMT_DATASET *D = NULL;
@@ -750,6 +809,8 @@ EXTERN_MSC int GMT_psmask (void *V_API, int mode, void *args) {
 		if (node_only && Ctrl->S.radius > 0.0) {
 			GMT_Report (API, GMT_MSG_WARNING, "Your search radius is too small to have any effect and is ignored.\n");
 		}
+		if (!node_only)	/* Track the distinct nodes hit by data points; the radius expansion happens after reading */
+			seed = gmt_M_memory (GMT, NULL, Grid->header->size, char);
 
 		if ((error = GMT_Set_Columns (API, GMT_IN, 2, GMT_COL_FIX_NO_TEXT)) != GMT_NOERROR) {
 			Return (error);
@@ -821,24 +882,10 @@ EXTERN_MSC int GMT_psmask (void *V_API, int mode, void *args) {
 					}
 				}
 
-				x0 = gmt_M_grd_col_to_x (GMT, col, Grid->header);
-				y0 = gmt_M_grd_row_to_y (GMT, row, Grid->header);
-
-				/* Set this and all nodes within radius distance to 1 */
-
-				j_start = (row > d_row) ? row - d_row : 0;
-				for (jj = j_start; jj <= row + d_row; jj++) {
-					if (jj >= (openmp_int)Grid->header->n_rows) continue;
-					i_start = (col > d_col[jj]) ? col - d_col[jj] : 0;
-					for (ii = i_start; ii <= col + d_col[jj]; ii++) {
-						if (ii >= (openmp_int)Grid->header->n_columns) continue;
-						ij = gmt_M_ijp (Grid->header, jj, ii);
-						if (grd[ij]) continue;	/* Already set */
-						distance = gmt_distance (GMT, x0, y0, grd_x0[ii], grd_y0[jj]);
-						if (distance > Ctrl->S.radius) continue;
-						grd[ij] = 1;
-					}
-				}
+				/* Just flag the nearest node; the nodes within radius distance are set once per distinct node after reading */
+
+				ij = gmt_M_ijp (Grid->header, row, col);
+				seed[ij] = 1;
 			}
 		} while (true);
 
@@ -848,6 +895,11 @@ EXTERN_MSC int GMT_psmask (void *V_API, int mode, void *args) {
 
 		GMT_Report (API, GMT_MSG_INFORMATION, "Read %" PRIu64 " data points\n", n_read);
 
+		if (!node_only) {	/* Expand each distinct node hit by data to all nodes within the search radius */
+			psmask_expand_seeds (GMT, Grid->header, grd, seed, grd_x0, grd_y0, d_row, d_col, Ctrl->S.radius);
+			gmt_M_free (GMT, seed);
+		}
+
 		if (Ctrl->N.active) for (ij = 0; ij < Grid->header->size; ij++) grd[ij] = 1 - grd[ij];	/* Reverse sense of test */
 
 		/* Force perimeter nodes to be false; thus all contours will be closed */
@@ -665,6 +665,56 @@ GMT_LOCAL int psxyz_dist_compare (const void *a, const void *b) {
 #endif
 }
 
+#define PSXYZ_MIN_PARALLEL_SORT 100000	/* Only parallelize the viewer-distance sort for large symbol counts */
+
+GMT_LOCAL void psxyz_sort_data (struct GMT_CTRL *GMT, struct PSXYZ_DATA *data, uint64_t n) {
+	/* Sort the symbols by distance from the viewer.  With OpenMP we qsort one chunk per
+	 * thread and then merge pairs of sorted runs in parallel passes, since a single qsort
+	 * of tens of millions of symbols dominates the run time for large 3-D point clouds. */
+#ifdef _OPENMP
+	int t, m, mm, n_threads = omp_get_max_threads ();
+	uint64_t *start = NULL;
+	struct PSXYZ_DATA *src = NULL, *dst = NULL, *buf = NULL;
+
+	if (n_threads < 2 || n < PSXYZ_MIN_PARALLEL_SORT) {	/* Not worth the merge overhead */
+		qsort (data, n, sizeof (struct PSXYZ_DATA), psxyz_dist_compare);
+		return;
+	}
+	start = gmt_M_memory (GMT, NULL, n_threads + 1, uint64_t);
+	for (t = 0; t < n_threads; t++) start[t] = t * (n / n_threads);
+	start[n_threads] = n;
+#pragma omp parallel for private(t) shared(data,start,n_threads)
+	for (t = 0; t < n_threads; t++)	/* Sort each chunk independently */
+		qsort (&data[start[t]], start[t+1] - start[t], sizeof (struct PSXYZ_DATA), psxyz_dist_compare);
+	buf = gmt_M_memory (GMT, NULL, n, struct PSXYZ_DATA);
+	src = data;	dst = buf;
+	m = n_threads;	/* Number of sorted runs remaining */
+	while (m > 1) {	/* Merge pairs of runs until a single sorted run remains */
+#pragma omp parallel for private(t) shared(src,dst,start,m)
+		for (t = 0; t < m - 1; t += 2) {	/* Merge runs t and t+1 */
+			uint64_t a = start[t], b = start[t+1], e1 = start[t+1], e2 = start[t+2], o = start[t];
+			while (a < e1 && b < e2)
+				dst[o++] = (psxyz_dist_compare (&src[a], &src[b]) <= 0) ? src[a++] : src[b++];
+			while (a < e1) dst[o++] = src[a++];
+			while (b < e2) dst[o++] = src[b++];
+		}
+		if (m % 2)	/* Odd run out; carry it over unchanged */
+			gmt_M_memcpy (&dst[start[m-1]], &src[start[m-1]], n - start[m-1], struct PSXYZ_DATA);
+		mm = (m + 1) / 2;	/* Runs left after this pass */
+		for (t = 1; t < mm; t++) start[t] = start[2*t];	/* Collapse the run boundaries */
+		start[mm] = n;
+		m = mm;
+		{ struct PSXYZ_DATA *tmp = src; src = dst; dst = tmp; }	/* Swap the source and scratch buffers */
+	}
+	if (src != data) gmt_M_memcpy (data, src, n, struct PSXYZ_DATA);	/* Result ended up in the scratch buffer */
+	gmt_M_free (GMT, buf);
+	gmt_M_free (GMT, start);
+#else
+	gmt_M_unused (GMT);
+	qsort (data, n, sizeof (struct PSXYZ_DATA), psxyz_dist_compare);
+#endif
+}
+
 GMT_LOCAL bool psxyz_no_z_variation (struct GMT_CTRL *GMT, struct GMT_DATASEGMENT *L) {
 	/* Determine if we are on a constant z-level plane */
 	unsigned int row;
@@ -1715,7 +1765,7 @@ EXTERN_MSC int GMT_psxyz (void *V_API, int mode, void *args) {
 
 		/* Sort according to distance from viewer */
 
-		if (!Ctrl->Q.active) qsort (data, n, sizeof (struct PSXYZ_DATA), psxyz_dist_compare);
+		if (!Ctrl->Q.active) psxyz_sort_data (GMT, data, n);
 
 		/* Now plot these symbols one at the time */
 
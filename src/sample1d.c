@@ -57,6 +57,10 @@ struct SAMPLE1D_CTRL {
 		char *file;
 		char *savecpt;	/* For when we want to save the automatically generated CPT */
 	} C;
+	struct SAMPLE1D_D {	/* -D<tolerance> */
+		bool active;
+		double tolerance;
+	} D;
 	struct SAMPLE1D_E {	/* -E */
 		bool active;
 	} E;
@@ -105,10 +109,62 @@ static void Free_Ctrl (struct GMT_CTRL *GMT, struct SAMPLE1D_CTRL *C) {	/* Deall
 	gmt_M_free (GMT, C);
 }
 
+GMT_LOCAL void sample1d_mark_vital (struct GMT_CTRL *GMT, double *t, double *z, uint64_t n, double tolerance, bool *keep) {
+	/* Stack-based scan (like the Douglas-Peucker routine in gmtsimplify, but with vertical
+	 * deviation from the local chord since t is monotonic) that sets keep[i] = true for all
+	 * interior points whose removal would change a linear reconstruction of z(t) by more
+	 * than tolerance.  NaN points (and the spans around them) are always kept since they
+	 * cannot be recovered by interpolation.  The caller marks the two end points. */
+	uint64_t n_stack, start, end, i, sig;
+	uint64_t *sig_start = NULL, *sig_end = NULL;
+	double dev, max_dev, slope;
+
+	if (n < 3) return;	/* Nothing to thin */
+
+	sig_start = gmt_M_memory (GMT, NULL, n, uint64_t);
+	sig_end   = gmt_M_memory (GMT, NULL, n, uint64_t);
+
+	sig_start[0] = 0;	sig_end[0] = n - 1;
+	n_stack = 1;
+
+	while (n_stack > 0) {	/* Pop the top-most section off the stack */
+		start = sig_start[n_stack-1];
+		end   = sig_end[n_stack-1];
+		n_stack--;
+
+		if ((end - start) < 2) continue;	/* No intermediate points */
+
+		if (gmt_M_is_dnan (z[start]) || gmt_M_is_dnan (z[end])) {	/* No chord possible; keep the whole span */
+			for (i = start + 1; i < end; i++) keep[i] = true;
+			continue;
+		}
+		slope = (z[end] - z[start]) / (t[end] - t[start]);
+		for (i = start + 1, sig = start, max_dev = -1.0; i < end; i++) {
+			dev = (gmt_M_is_dnan (z[i])) ? DBL_MAX : fabs (z[i] - (z[start] + slope * (t[i] - t[start])));
+			if (dev > max_dev) {
+				sig = i;
+				max_dev = dev;
+			}
+		}
+		if (max_dev > tolerance) {	/* Most deviant point is vital; push the two sub-sections on the stack */
+			keep[sig] = true;
+			n_stack++;
+			sig_start[n_stack-1] = start;
+			sig_end[n_stack-1] = sig;
+			n_stack++;
+			sig_start[n_stack-1] = sig;
+			sig_end[n_stack-1] = end;
+		}
+	}
+
+	gmt_M_free (GMT, sig_start);
+	gmt_M_free (GMT, sig_end);
+}
+
 static int usage (struct GMTAPI_CTRL *API, int level) {
 	const char *name = gmt_show_name_and_purpose (API, THIS_MODULE_LIB, THIS_MODULE_CLASSIC_NAME, THIS_MODULE_PURPOSE);
 	if (level == GMT_MODULE_PURPOSE) return (GMT_NOERROR);
-	GMT_Usage (API, 0, "usage: %s [<table>] [-A[f|m|p|r|R][+d][+l]] [-C%s] [-E] [-F%s "
+	GMT_Usage (API, 0, "usage: %s [<table>] [-A[f|m|p|r|R][+d][+l]] [-C%s] [-D<tolerance>] [-E] [-F%s "
 		"[-T[<min>/<max>/]<inc>[+i|n][+a][+t][+u]] [%s] [-W<w_col>] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s]\n",
 		name, CPT_OPT_ARGS, GMT_INTERPOLANT_OPT, GMT_V_OPT, GMT_b_OPT, GMT_d_OPT, GMT_e_OPT, GMT_f_OPT, GMT_g_OPT, GMT_h_OPT, GMT_i_OPT, GMT_j_OPT,
 		GMT_o_OPT, GMT_q_OPT, GMT_s_OPT, GMT_w_OPT, GMT_PAR_OPT);
@@ -132,6 +188,11 @@ static int usage (struct GMTAPI_CTRL *API, int level) {
 	GMT_Usage (API, -2, "Note: +l uses spherical calculations - cannot be combined with -je.");
 	gmt_explain_cpt_input (API, 'C');
 	GMT_Usage (API, -2, "\nWill sample the CPT given values in last input column an add R, G, B, A columns at the end.");
+	GMT_Usage (API, 1, "\n-D<tolerance>");
+	GMT_Usage (API, -2, "Thin the resampled points adaptively, keeping only those needed to reproduce each "
+		"sampled curve to within <tolerance> (in data units) by linear interpolation.  Densely sampled "
+		"smooth sections are reduced while curved sections keep their points.  If only coordinate columns "
+		"are present the tolerance applies to the track coordinates instead.");
 	GMT_Usage (API, 1, "\n-E Add input data trailing text to output records when possible [Ignore trailing text].");
 	gmt_explain_interpolate_mode (API);
 	GMT_Usage (API, 1, "\n-N<time_col>");
@@ -228,6 +289,10 @@ static int parse (struct GMT_CTRL *GMT, struct SAMPLE1D_CTRL *Ctrl, struct GMT_O
 				}
 				gmt_cpt_interval_modifier (GMT, &(Ctrl->C.file), &(Ctrl->C.dz));
 				break;
+			case 'D':	/* Adaptive thinning of the resampled points */
+				n_errors += gmt_M_repeated_module_option (API, Ctrl->D.active);
+				Ctrl->D.tolerance = atof (opt->arg);
+				break;
 			case 'E':
 				n_errors += gmt_M_repeated_module_option (API, Ctrl->E.active);
 				n_errors += gmt_get_no_argument (GMT, opt->arg, opt->option, 0);
@@ -316,6 +381,8 @@ static int parse (struct GMT_CTRL *GMT, struct SAMPLE1D_CTRL *Ctrl, struct GMT_O
 		n_errors += gmt_parse_array (GMT, 'T', t_arg, &(Ctrl->T.T), GMT_ARRAY_TIME | GMT_ARRAY_DIST | GMT_ARRAY_NOMINMAX, Ctrl->N.col);
 	}
 
+	n_errors += gmt_M_check_condition (GMT, Ctrl->D.active && Ctrl->D.tolerance <= 0.0,
+	                                   "Option -D: Tolerance must be positive\n");
 	n_errors += gmt_M_check_condition (GMT, Ctrl->A.loxo && GMT->common.j.mode == GMT_GEODESIC,
 	                                   "Option -A+l: Requires spherical calculations so -je cannot be used\n");
 	n_errors += gmt_M_check_condition (GMT, Ctrl->N.active && s_arg, "Specify only one of -N and -S\n");
@@ -339,10 +406,11 @@ EXTERN_MSC int GMT_sample1d (void *V_API, int mode, void *args) {
 
 	unsigned char *nan_flag = NULL;
 
-	uint64_t k, tbl, col, row, seg, m = 0, dim[GMT_DIM_SIZE] = {0, 0, 0, 0};
+	uint64_t k, tbl, col, row, seg, m = 0, n_direct, dim[GMT_DIM_SIZE] = {0, 0, 0, 0};
 
 	double *t_out = NULL, *dist_in = NULL, *ttime = NULL, *data = NULL;
 	double low_t, high_t, *lon = NULL, *lat = NULL, *weight = NULL;
+	double **ycols = NULL, **vcols = NULL;
 
 	struct GMT_DATASET *Din = NULL, *Dout = NULL;
 	struct GMT_DATATABLE *Tout = NULL;
@@ -473,6 +541,8 @@ EXTERN_MSC int GMT_sample1d (void *V_API, int mode, void *args) {
 	Dout->n_tables = Din->n_tables;
 
 	nan_flag = gmt_M_memory (GMT, NULL, Din->n_columns, unsigned char);
+	ycols = gmt_M_memory (GMT, NULL, Din->n_columns, double *);	/* Input and output column pointers for batched interpolation */
+	vcols = gmt_M_memory (GMT, NULL, Din->n_columns, double *);
 	for (tbl = 0; tbl < Din->n_tables; tbl++) {
 		Tout = gmt_create_table (GMT, Din->table[tbl]->n_segments, 0, Dout->n_columns, 0U, false);
 		Dout->table[tbl] = Tout;
@@ -539,6 +609,7 @@ EXTERN_MSC int GMT_sample1d (void *V_API, int mode, void *args) {
 			SH = gmt_get_DS_hidden (Sout);
 			Sout->n_rows = SH->n_alloc = m;
 
+			n_direct = 0;	/* Number of columns that can share the segment's time column as is */
 			for (col = 0; m && col < Din->n_columns; col++) {
 
 				if (col == Ctrl->N.col && !Ctrl->T.T.spatial) continue;	/* Skip the time column */
@@ -561,13 +632,22 @@ EXTERN_MSC int GMT_sample1d (void *V_API, int mode, void *args) {
 					gmt_M_free (GMT, ttime);
 					gmt_M_free (GMT, data);
 					if (Ctrl->W.active) gmt_M_free (GMT, weight);
+
+					if (result != GMT_NOERROR) {
+						GMT_Report (API, GMT_MSG_ERROR, "Failure in gmt_intpol near row %d!\n", result+1);
+						return (result);
+					}
 				}
-				else {
-					ttime = (Ctrl->T.T.spatial) ? dist_in : S->data[Ctrl->N.col];
-					weight = (Ctrl->W.active) ? S->data[Ctrl->W.col] : NULL;
-					result = gmt_intpol (GMT, ttime, S->data[col], weight, S->n_rows, m, t_out, Sout->data[col], Ctrl->F.fit, int_mode);
+				else {	/* Can use the shared time column directly; defer so all such columns go in one batch */
+					ycols[n_direct] = S->data[col];
+					vcols[n_direct] = Sout->data[col];
+					n_direct++;
 				}
-
+			}
+			if (n_direct) {	/* Interpolate all columns sharing the time column in one (possibly threaded) call */
+				ttime = (Ctrl->T.T.spatial) ? dist_in : S->data[Ctrl->N.col];
+				weight = (Ctrl->W.active) ? S->data[Ctrl->W.col] : NULL;
+				result = gmtlib_intpol_many (GMT, ttime, ycols, weight, n_direct, S->n_rows, m, t_out, vcols, Ctrl->F.fit, int_mode);
 				if (result != GMT_NOERROR) {
 					GMT_Report (API, GMT_MSG_ERROR, "Failure in gmt_intpol near row %d!\n", result+1);
 					return (result);
@@ -588,6 +668,39 @@ EXTERN_MSC int GMT_sample1d (void *V_API, int mode, void *args) {
 				}
 			}
 
+			if (Ctrl->D.active && m > 2) {	/* Thin the resampled points adaptively */
+				uint64_t n_keep;
+				bool used_data = false, *keep = gmt_M_memory (GMT, NULL, m, bool);
+				keep[0] = keep[m-1] = true;	/* Always keep the end points */
+				for (col = 0; col < Din->n_columns; col++) {	/* Find which curves must be reproduced within tolerance */
+					if (col == Ctrl->N.col && !Ctrl->T.T.spatial) continue;	/* The abscissa itself */
+					if (Ctrl->W.active && col == Ctrl->W.col) continue;	/* Weights do not drive the thinning */
+					if (Ctrl->T.T.spatial && col <= GMT_Y) continue;	/* Sampled curves, not coordinates (see below) */
+					sample1d_mark_vital (GMT, t_out, Sout->data[col], m, Ctrl->D.tolerance, keep);
+					used_data = true;
+				}
+				if (Ctrl->T.T.spatial && !used_data) {	/* Just a track; apply the tolerance to the coordinates vs distance instead */
+					sample1d_mark_vital (GMT, t_out, Sout->data[GMT_X], m, Ctrl->D.tolerance, keep);
+					sample1d_mark_vital (GMT, t_out, Sout->data[GMT_Y], m, Ctrl->D.tolerance, keep);
+				}
+				for (k = n_keep = 0; k < m; k++) {	/* Compact the segment in place */
+					if (!keep[k]) {	/* This point can be recovered by linear interpolation */
+						if (Sout->text && Sout->text[k]) gmt_M_str_free (Sout->text[k]);
+						continue;
+					}
+					if (n_keep < k) {	/* Must shuffle this point down */
+						for (col = 0; col < Dout->n_columns; col++) Sout->data[col][n_keep] = Sout->data[col][k];
+						if (Sout->text) {
+							Sout->text[n_keep] = Sout->text[k];
+							Sout->text[k] = NULL;
+						}
+					}
+					n_keep++;
+				}
+				GMT_Report (API, GMT_MSG_INFORMATION, "Segment %" PRIu64 ": Adaptive thinning kept %" PRIu64 " of %" PRIu64 " resampled points\n", seg, n_keep, m);
+				Sout->n_rows = n_keep;
+				gmt_M_free (GMT, keep);
+			}
 			if (Ctrl->T.T.spatial) {	/* Free up memory used */
 				gmt_M_free (GMT, dist_in);	gmt_M_free (GMT, t_out);
 				gmt_M_free (GMT, lon);		gmt_M_free (GMT, lat);
@@ -602,6 +715,8 @@ EXTERN_MSC int GMT_sample1d (void *V_API, int mode, void *args) {
 	}
 
 	gmt_M_free (GMT, nan_flag);
+	gmt_M_free (GMT, ycols);
+	gmt_M_free (GMT, vcols);
 
 	GMT->hidden.sample_along_arc = false;	/* Reset */
 
@@ -673,6 +673,17 @@ EXTERN_MSC int GMT_pssegy (void *V_API, int mode, void *args) {
 			}
 		}
 
+		if (n_tracelist && !plot_it) {	/* Trace not on the list so skip its samples in the file without reading them */
+			if (!segy_skip_data (fpi, header)) {
+				gmt_M_str_free (header);
+				break;
+			}
+			GMT_Report (API, GMT_MSG_INFORMATION, "trace %d at %f skipped\n", ix+1, x0);
+			gmt_M_str_free (header);
+			ix++;
+			continue;
+		}
+
 		if (Ctrl->Q.value[U_ID]) {
 			toffset = (float) - (fabs ((double)(header->sourceToRecDist)) / Ctrl->Q.value[U_ID]);
 			GMT_Report (API, GMT_MSG_INFORMATION, "time shifted by %f\n", toffset);
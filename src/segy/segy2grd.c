@@ -493,6 +493,16 @@ EXTERN_MSC int GMT_segy2grd (void *V_API, int mode, void *args) {
 				header->num_samps = bswap32 (header->num_samps);
 			}
 
+			if (x0 < GMT->common.R.wesn[XLO] || x0 > GMT->common.R.wesn[XHI]) {	/* Trace outside x-range; skip its samples without reading them */
+				if (!segy_skip_data (fpi, header)) {
+					gmt_M_str_free (header);
+					break;
+				}
+				gmt_M_str_free (header);
+				ix++;
+				continue;
+			}
+
 			data = segy_get_data (fpi, header); /* read a trace */
 			/* get number of samples in _this_ trace (e.g. OMEGA has strange ideas about SEGY standard)
 			   or set to number in reel header */
@@ -112,3 +112,41 @@ float *segy_get_data (FILE *file_ptr, SEGYHEAD *head_ptr) {
 	}
 	return (data_ptr);
 }
+
+/************************ segy_skip_data()  **************************/
+/*
+ * Advances the file position past the data samples of the current trace
+ * without reading them.  The plotting programs call this when a trace has
+ * been excluded from the plot (e.g., it is not on the trace list) so that
+ * unwanted regions of very large files are never read or byte-swapped.
+ * Seekable files jump directly; pipes fall back to reading into a small
+ * scratch buffer.
+ *
+ * Returns true on success, false on failure (with a message to stderr
+ * unless we simply hit EOF).
+ */
+
+int segy_skip_data (FILE *file_ptr, SEGYHEAD *head_ptr) {
+	uint32_t num_samps;
+	long nbytes;
+
+	num_samps = segy_samp_rd(head_ptr);
+	nbytes = (long)num_samps * (long)sizeof (float);
+
+	if (nbytes == 0) return (true);
+	if (fseek (file_ptr, nbytes, SEEK_CUR) == 0) return (true);
+	{	/* Not seekable, so consume the samples instead */
+		char scratch[4096];
+		size_t left = (size_t)nbytes, chunk;
+		while (left) {
+			chunk = (left < sizeof (scratch)) ? left : sizeof (scratch);
+			if (fread (scratch, 1, chunk, file_ptr) != chunk) {
+				if (!feof (file_ptr))
+					fprintf(stderr, "Error: Unable to skip trace data\n");
+				return (false);
+			}
+			left -= chunk;
+		}
+	}
+	return (true);
+}
@@ -25,5 +25,6 @@ int segy_get_reelhd (FILE *fileptr, char *reelhead);
 int segy_get_binhd (FILE *fileptr, SEGYREEL *binhead);
 SEGYHEAD *segy_get_header (FILE *file_ptr);
 float *segy_get_data (FILE *file_ptr, SEGYHEAD *head_ptr);
+int segy_skip_data (FILE *file_ptr, SEGYHEAD *head_ptr);
 
 #endif /* SEGY_IO_H */
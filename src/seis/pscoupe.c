@@ -1066,6 +1066,7 @@ EXTERN_MSC int GMT_pscoupe (void *V_API, int mode, void *args) {
 	struct SEIS_AXIS T, N, P, Tr, Nr, Pr;
 	struct GMT_PALETTE *CPT = NULL;
 	struct GMT_PEN current_pen;
+	struct SEIS_BB_CACHE *bb_cache = NULL;	/* Cache of beachball outlines reused across events with the same mechanism */
 	struct GMT_DATASET *D = NULL;	/* Pointer to GMT multisegment input tables */
 	struct GMT_DATASEGMENT *S = NULL;
 
@@ -1270,6 +1271,8 @@ EXTERN_MSC int GMT_pscoupe (void *V_API, int mode, void *args) {
 		pext = fopen (Ctrl->A.extfile, "w");
 	}
 
+	bb_cache = meca_bb_cache_new (GMT);	/* Returns NULL if out of memory; then we just compute each event from scratch */
+
 	for (tbl = 0; tbl < D->n_tables; tbl++) {
 		for (seg = 0; seg < D->table[tbl]->n_segments; seg++) {
 			S = D->table[tbl]->segment[seg];	/* Shorthand */
@@ -1576,7 +1579,7 @@ EXTERN_MSC int GMT_pscoupe (void *V_API, int mode, void *args) {
 							gmt_scale_pen (GMT, &current_pen, scl);
 						}
 						gmt_setpen (GMT, &current_pen);
-						meca_ps_tensor (GMT, PSL, plot_x, plot_y, size, T, N, P, &Ctrl->G.fill, &Ctrl->E.fill, Ctrl->L.active, Ctrl->S.zerotrace, n_rec);
+						meca_ps_tensor (GMT, PSL, plot_x, plot_y, size, T, N, P, &Ctrl->G.fill, &Ctrl->E.fill, Ctrl->L.active, Ctrl->S.zerotrace, n_rec, bb_cache);
 					}
 
 					if (Ctrl->S.zerotrace) {
@@ -1586,7 +1589,7 @@ EXTERN_MSC int GMT_pscoupe (void *V_API, int mode, void *args) {
 							gmt_scale_pen (GMT, &current_pen, scl);
 						}
 						gmt_setpen (GMT, &current_pen);
-						meca_ps_tensor (GMT, PSL, plot_x, plot_y, size, T, N, P, NULL, NULL, true, true, n_rec);
+						meca_ps_tensor (GMT, PSL, plot_x, plot_y, size, T, N, P, NULL, NULL, true, true, n_rec, bb_cache);
 					}
 
 					if (Ctrl->T.active) {
@@ -1610,7 +1613,7 @@ EXTERN_MSC int GMT_pscoupe (void *V_API, int mode, void *args) {
 							gmt_scale_pen (GMT, &current_pen, scl);
 						}
 						gmt_setpen (GMT, &current_pen);
-						meca_ps_mechanism (GMT, PSL, plot_x, plot_y, meca, size, &Ctrl->G.fill, &Ctrl->E.fill, Ctrl->L.active);
+						meca_ps_mechanism (GMT, PSL, plot_x, plot_y, meca, size, &Ctrl->G.fill, &Ctrl->E.fill, Ctrl->L.active, bb_cache);
 					}
 
 					if (Ctrl->A2.active) {	/* Plot axis symbols */
@@ -1669,6 +1672,8 @@ EXTERN_MSC int GMT_pscoupe (void *V_API, int mode, void *args) {
 		}
 	}
 
+	meca_bb_cache_free (GMT, &bb_cache);
+
 	if (GMT->common.t.variable) {	/* Reset the transparencies */
 		double transp[2] = {0.0, 0.0};	/* None selected */
 		PSL_settransparencies (PSL, transp);
@@ -604,6 +604,7 @@ EXTERN_MSC int GMT_psmeca (void *V_API, int mode, void *args) {
 	struct SEIS_AXIS T, N, P;
 
 	struct GMT_PALETTE *CPT = NULL;
+	struct SEIS_BB_CACHE *bb_cache = NULL;	/* Cache of beachball outlines reused across events with the same mechanism */
 	struct GMT_DATASET *D = NULL;	/* Pointer to GMT multisegment input tables */
 	struct GMT_DATASEGMENT *S = NULL;
 	struct GMT_PEN current_pen;
@@ -708,6 +709,8 @@ EXTERN_MSC int GMT_psmeca (void *V_API, int mode, void *args) {
 	if (D->n_records == 0)
 		GMT_Report (API, GMT_MSG_WARNING, "No data records provided\n");
 
+	bb_cache = meca_bb_cache_new (GMT);	/* Returns NULL if out of memory; then we just compute each event from scratch */
+
 	for (tbl = 0; tbl < D->n_tables; tbl++) {
 		for (seg = 0; seg < D->table[tbl]->n_segments; seg++) {
 			S = D->table[tbl]->segment[seg];	/* Shorthand */
@@ -997,10 +1000,10 @@ EXTERN_MSC int GMT_psmeca (void *V_API, int mode, void *args) {
 					if (fabs (N.val) < SEIS_EPSILON && fabs (T.val + P.val) < SEIS_EPSILON) {
 						meca_axe2dc (T, P, &meca.NP1, &meca.NP2);
 						added_delaz = true;
-						meca_ps_mechanism (GMT, PSL, plot_x, plot_y, meca, size, &Ctrl->G.fill, &Ctrl->E.fill, Ctrl->L.active);
+						meca_ps_mechanism (GMT, PSL, plot_x, plot_y, meca, size, &Ctrl->G.fill, &Ctrl->E.fill, Ctrl->L.active, bb_cache);
 					}
 					else
-						meca_ps_tensor (GMT, PSL, plot_x, plot_y, size, T, N, P, &Ctrl->G.fill, &Ctrl->E.fill, Ctrl->L.active, Ctrl->S.plotmode == SEIS_PLOT_TRACE, n_rec);
+						meca_ps_tensor (GMT, PSL, plot_x, plot_y, size, T, N, P, &Ctrl->G.fill, &Ctrl->E.fill, Ctrl->L.active, Ctrl->S.plotmode == SEIS_PLOT_TRACE, n_rec, bb_cache);
 				}
 
 				if (Ctrl->Z2.active) {
@@ -1010,7 +1013,7 @@ EXTERN_MSC int GMT_psmeca (void *V_API, int mode, void *args) {
 						gmt_scale_pen (GMT, &current_pen, scl);
 					}
 					gmt_setpen (GMT, &current_pen);
-					meca_ps_tensor (GMT, PSL, plot_x, plot_y, size, T, N, P, NULL, NULL, true, true, n_rec);
+					meca_ps_tensor (GMT, PSL, plot_x, plot_y, size, T, N, P, NULL, NULL, true, true, n_rec, bb_cache);
 				}
 
 				if (Ctrl->T.active) {
@@ -1042,7 +1045,7 @@ EXTERN_MSC int GMT_psmeca (void *V_API, int mode, void *args) {
 						gmt_scale_pen (GMT, &current_pen, scl);
 					}
 					gmt_setpen (GMT, &current_pen);
-					meca_ps_mechanism (GMT, PSL, plot_x, plot_y, meca, size, &Ctrl->G.fill, &Ctrl->E.fill, Ctrl->L.active);
+					meca_ps_mechanism (GMT, PSL, plot_x, plot_y, meca, size, &Ctrl->G.fill, &Ctrl->E.fill, Ctrl->L.active, bb_cache);
 				}
 
 				if (!Ctrl->S.no_label) {
@@ -1103,6 +1106,8 @@ EXTERN_MSC int GMT_psmeca (void *V_API, int mode, void *args) {
 			}
 	}
 
+	meca_bb_cache_free (GMT, &bb_cache);
+
 	if (GMT_End_IO (API, GMT_IN, 0) != GMT_NOERROR) {	/* Disables further data input */
 		Return (API->error);
 	}
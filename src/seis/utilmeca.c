@@ -25,6 +25,167 @@
 
 #define squared(x) ((x) * (x))
 
+/* A beachball plotted at symbol size s is just a translated and scaled copy of the
+ * unit-size symbol, so when plotting large catalogs (where many events repeat the
+ * same mechanism to within plotting accuracy) we cache the computed outline per
+ * mechanism class and only translate/scale it on reuse.  A class is the mechanism
+ * quantized to SEIS_BB_ANG_TOL degrees (plus, for full moment tensors, the eigenvalues
+ * normalized by the largest magnitude and quantized to SEIS_BB_VAL_TOL; the outline
+ * only depends on their ratios).  psmeca and pscoupe create one cache per run via
+ * meca_bb_cache_new and hand it to meca_ps_mechanism and meca_ps_tensor; passing a
+ * NULL cache means compute-and-discard as before. */
+
+#define SEIS_BB_ANG_TOL	0.05	/* Quantization (degrees) of angles when classifying mechanisms */
+#define SEIS_BB_VAL_TOL	1e-4	/* Quantization of normalized eigenvalues */
+#define SEIS_BB_NKEY	11	/* Number of entries in a quantized class key */
+#define SEIS_BB_MAX_PTS	1000	/* No stored outline polygon has more points than this */
+
+struct SEIS_BB_CLASS {	/* One cached unit-size beachball outline, centered on the origin */
+	int64_t qkey[SEIS_BB_NKEY];	/* The quantized mechanism parameters */
+	int computed;	/* true once the geometry below has been determined */
+	int status;	/* 0 = plot the polygons, +1|-1 = full circle with compressive|extensive fill, +2 = plot nothing, -2 = could not classify */
+	int swap;	/* true if the background circle takes the compressive fill and the polygons the extensive fill */
+	int np[2];	/* Number of points in each outline polygon (0 = polygon not used) */
+	double *xp[2], *yp[2];	/* The outline polygon coordinates */
+};
+
+struct SEIS_BB_CACHE {	/* Open-addressed hash table of mechanism classes */
+	uint64_t n;		/* Number of classes seen so far */
+	uint64_t n_slots;	/* Current table size (power of 2) */
+	uint64_t n_hits;	/* Number of events that reused a cached outline */
+	struct SEIS_BB_CLASS **slot;
+};
+
+static uint64_t utilmeca_bb_hash (int64_t qkey[]) {
+	/* FNV-1a over the quantized key */
+	uint64_t h = 14695981039346656037ULL;
+	int k;
+	for (k = 0; k < SEIS_BB_NKEY; k++) {
+		h ^= (uint64_t)qkey[k];
+		h *= 1099511628211ULL;
+	}
+	return (h);
+}
+
+static struct SEIS_BB_CLASS * utilmeca_bb_cache_get (struct GMT_CTRL *GMT, struct SEIS_BB_CACHE *C, int64_t qkey[]) {
+	/* Return the class entry for this key, adding an empty entry on first sight; NULL if we run out of memory */
+	uint64_t h;
+	struct SEIS_BB_CLASS *B = NULL;
+
+	if (2 * C->n >= C->n_slots) {	/* Keep the table at most half full; rehash into a table twice the size */
+		uint64_t k, hh, n_old = C->n_slots;
+		struct SEIS_BB_CLASS **old = C->slot, **slot = NULL;
+		if ((slot = gmt_M_memory (GMT, NULL, 2 * n_old, struct SEIS_BB_CLASS *)) == NULL) return (NULL);
+		C->slot = slot;	C->n_slots = 2 * n_old;
+		for (k = 0; k < n_old; k++) {
+			if (old[k] == NULL) continue;
+			hh = utilmeca_bb_hash (old[k]->qkey) & (C->n_slots - 1);
+			while (C->slot[hh]) hh = (hh + 1) & (C->n_slots - 1);
+			C->slot[hh] = old[k];
+		}
+		gmt_M_free (GMT, old);
+	}
+	h = utilmeca_bb_hash (qkey) & (C->n_slots - 1);
+	while (C->slot[h]) {	/* Linear probing */
+		if (memcmp (C->slot[h]->qkey, qkey, SEIS_BB_NKEY * sizeof (int64_t)) == 0) {
+			C->n_hits++;
+			return (C->slot[h]);
+		}
+		h = (h + 1) & (C->n_slots - 1);
+	}
+	if ((B = gmt_M_memory (GMT, NULL, 1, struct SEIS_BB_CLASS)) == NULL) return (NULL);
+	gmt_M_memcpy (B->qkey, qkey, SEIS_BB_NKEY, int64_t);
+	C->slot[h] = B;	C->n++;
+	return (B);
+}
+
+static void utilmeca_bb_store (struct GMT_CTRL *GMT, struct SEIS_BB_CLASS *B, double *x, double *y, int n) {
+	/* Append one outline polygon to the class */
+	int k = (B->np[0]) ? 1 : 0;
+	if ((B->xp[k] = gmt_M_memory (GMT, NULL, n, double)) == NULL) return;
+	if ((B->yp[k] = gmt_M_memory (GMT, NULL, n, double)) == NULL) return;
+	gmt_M_memcpy (B->xp[k], x, n, double);
+	gmt_M_memcpy (B->yp[k], y, n, double);
+	B->np[k] = n;
+}
+
+static void utilmeca_bb_wipe (struct GMT_CTRL *GMT, struct SEIS_BB_CLASS *B) {
+	/* Release the outlines of a class computed without a cache */
+	int k;
+	for (k = 0; k < 2; k++) {
+		gmt_M_free (GMT, B->xp[k]);
+		gmt_M_free (GMT, B->yp[k]);
+	}
+}
+
+static void utilmeca_bb_stamp (struct GMT_CTRL *GMT, struct PSL_CTRL *PSL, struct SEIS_BB_CLASS *B, double x0, double y0, double size, struct GMT_FILL *C, struct GMT_FILL *E, int outline) {
+	/* Emit one beachball instance by translating and scaling the unit outline to (x0, y0) at the given size */
+	int i, k;
+	double xs[SEIS_BB_MAX_PTS], ys[SEIS_BB_MAX_PTS], ssize[1];
+	struct GMT_FILL *F1 = (B->swap) ? E : C, *F2 = (B->swap) ? C : E;
+
+	/*  argument is DIAMETER!! */
+	ssize[0] = size;
+	if (B->status) {	/* Just a filled circle (pure implosion or explosion) or nothing at all */
+		if (B->status == +1) {
+			gmt_setfill (GMT, C, 1);
+			PSL_plotsymbol (PSL, x0, y0, ssize, PSL_CIRCLE);
+		}
+		else if (B->status == -1) {
+			gmt_setfill (GMT, E, 1);
+			PSL_plotsymbol (PSL, x0, y0, ssize, PSL_CIRCLE);
+		}
+		return;
+	}
+
+	/* fill at then beginning (here), outline at the end */
+	gmt_setfill (GMT, F2, 0);
+	PSL_plotsymbol (PSL, x0, y0, ssize, PSL_CIRCLE);
+
+	gmt_setfill (GMT, F1, outline);
+	for (k = 0; k < 2; k++) {
+		if (B->np[k] == 0) continue;
+		for (i = 0; i < B->np[k]; i++) {
+			xs[i] = x0 + size * B->xp[k][i];
+			ys[i] = y0 + size * B->yp[k][i];
+		}
+		PSL_plotpolygon (PSL, xs, ys, B->np[k]);
+	}
+
+	/* fill at then beginning, outline at the end (here) */
+	gmt_setfill (GMT, NULL, 1);
+	PSL_plotsymbol (PSL, x0, y0, ssize, PSL_CIRCLE);
+}
+
+/*! . */
+struct SEIS_BB_CACHE * meca_bb_cache_new (struct GMT_CTRL *GMT) {
+	/* Create an empty beachball outline cache */
+	struct SEIS_BB_CACHE *C = gmt_M_memory (GMT, NULL, 1, struct SEIS_BB_CACHE);
+	if (C == NULL) return (NULL);
+	C->n_slots = 1024;	/* Start small; utilmeca_bb_cache_get grows the table as needed */
+	if ((C->slot = gmt_M_memory (GMT, NULL, C->n_slots, struct SEIS_BB_CLASS *)) == NULL) {
+		gmt_M_free (GMT, C);
+		return (NULL);
+	}
+	return (C);
+}
+
+/*! . */
+void meca_bb_cache_free (struct GMT_CTRL *GMT, struct SEIS_BB_CACHE **cache) {
+	/* Release a beachball outline cache and all its classes */
+	uint64_t k;
+	struct SEIS_BB_CACHE *C = (cache) ? *cache : NULL;
+	if (C == NULL) return;
+	GMT_Report (GMT->parent, GMT_MSG_DEBUG, "meca_bb_cache_free: %" PRIu64 " unique mechanism classes, %" PRIu64 " reuses\n", C->n, C->n_hits);
+	for (k = 0; k < C->n_slots; k++) {
+		if (C->slot[k] == NULL) continue;
+		utilmeca_bb_wipe (GMT, C->slot[k]);
+		gmt_M_free (GMT, C->slot[k]);
+	}
+	gmt_M_free (GMT, C->slot);
+	gmt_M_free (GMT, *cache);
+}
+
 /************************************************************************/
 void meca_get_trans (struct GMT_CTRL *GMT, double slon, double slat, double *t11, double *t12, double *t21, double *t22) {
 	/* determine local transformation between (lon,lat) and (x,y) */
@@ -137,16 +298,28 @@ static double utilmeca_proj_radius(double str1, double dip1, double str) {
 	return (r);
 }
 
+static void utilmeca_bb_key_dc (st_me meca, int64_t qkey[]) {
+	/* Build the quantized class key for a double couple mechanism */
+	gmt_M_memset (qkey, SEIS_BB_NKEY, int64_t);
+	qkey[0] = 0;	/* Double couple */
+	qkey[1] = lrint (meca.NP1.str  / SEIS_BB_ANG_TOL);
+	qkey[2] = lrint (meca.NP1.dip  / SEIS_BB_ANG_TOL);
+	qkey[3] = lrint (meca.NP1.rake / SEIS_BB_ANG_TOL);
+	qkey[4] = lrint (meca.NP2.str  / SEIS_BB_ANG_TOL);
+	qkey[5] = lrint (meca.NP2.dip  / SEIS_BB_ANG_TOL);
+	qkey[6] = lrint (meca.NP2.rake / SEIS_BB_ANG_TOL);
+}
+
 /***********************************************************************************************************/
-double meca_ps_mechanism (struct GMT_CTRL *GMT, struct PSL_CTRL *PSL, double x0, double y0, st_me meca, double size, struct GMT_FILL *F, struct GMT_FILL *E, int outline) {
-	/* Draw beachball for double couples
+static void utilmeca_dc_geometry (struct GMT_CTRL *GMT, st_me meca, struct SEIS_BB_CLASS *B) {
+	/* Compute the unit-size double couple outline(s) about the origin
 	   By Genevieve Patau
 	*/
 
 	double x[1000], y[1000];
 	double pos_NP1_NP2 = sind (meca.NP1.str - meca.NP2.str);
 	int fault = (meca.NP1.rake > 0 ? 1 : -1);
-	double radius_size, str, radius, increment, si, co, ssize[1];
+	double radius_size, str, radius, increment, si, co;
 
 	int i;
 
@@ -156,16 +329,9 @@ double meca_ps_mechanism (struct GMT_CTRL *GMT, struct PSL_CTRL *PSL, double x0,
 	N_axis.dip = utilmeca_null_axis_dip (meca.NP1.str, meca.NP1.dip, meca.NP2.str, meca.NP2.dip);
 	N_axis.str = utilmeca_null_axis_strike (meca.NP1.str, meca.NP1.dip, meca.NP2.str, meca.NP2.dip);
 
-	/* compute radius size of the bubble */
-	radius_size = size * 0.5;
+	/* compute radius size of the unit bubble */
+	radius_size = 0.5;
 
-	/* fill at then beginning (here), outline at the end */
-	/*  argument is DIAMETER!! */
-	ssize[0] = size;
-	gmt_setfill (GMT, E, 0);
-	PSL_plotsymbol (PSL, x0, y0, ssize, PSL_CIRCLE);
-
-	gmt_setfill (GMT, F, outline);
 	if (fabs (pos_NP1_NP2) < SEIS_EPSILON) {
 		/* pure normal or inverse fault (null axis strike is determined
 		   with + or - 180 degrees. */
@@ -176,8 +342,8 @@ double meca_ps_mechanism (struct GMT_CTRL *GMT, struct PSL_CTRL *PSL, double x0,
 		while (str <= meca.NP1.str + 180. + SEIS_EPSILON) {
 			radius = utilmeca_proj_radius (meca.NP1.str, meca.NP1.dip, str) * radius_size;
 			sincosd (str, &si, &co);
-			x[i] = x0 + radius * si;
-			y[i] = y0 + radius * co;
+			x[i] = radius * si;
+			y[i] = radius * co;
 			str += increment;
 			i++;
 		}
@@ -186,12 +352,12 @@ double meca_ps_mechanism (struct GMT_CTRL *GMT, struct PSL_CTRL *PSL, double x0,
 			str = meca.NP1.str + 180.;
 			while (str >= meca.NP1.str - SEIS_EPSILON) {
 				sincosd (str, &si, &co);
-				x[i] = x0 + si * radius_size;
-				y[i] = y0 + co * radius_size;
+				x[i] = si * radius_size;
+				y[i] = co * radius_size;
 				str -= increment;
 				i++;
 			}
-			PSL_plotpolygon (PSL, x, y, i);
+			utilmeca_bb_store (GMT, B, x, y, i);
 			i = 0;
 		}
 		/* second nodal plane part */
@@ -199,8 +365,8 @@ double meca_ps_mechanism (struct GMT_CTRL *GMT, struct PSL_CTRL *PSL, double x0,
 		while (str <= meca.NP2.str + 180. + SEIS_EPSILON) {
 			radius = utilmeca_proj_radius (meca.NP2.str, meca.NP2.dip, str) * radius_size;
 			sincosd (str, &si, &co);
-			x[i] = x0 + radius * si;
-			y[i] = y0 + radius * co;
+			x[i] = radius * si;
+			y[i] = radius * co;
 			str += increment;
 			i++;
 		}
@@ -209,13 +375,13 @@ double meca_ps_mechanism (struct GMT_CTRL *GMT, struct PSL_CTRL *PSL, double x0,
 			str = meca.NP2.str + 180.;
 			while (str >= meca.NP2.str - SEIS_EPSILON) {
 				sincosd (str, &si, &co);
-				x[i] = x0 + si * radius_size;
-				y[i] = y0 + co * radius_size;
+				x[i] = si * radius_size;
+				y[i] = co * radius_size;
 				str -= increment;
 				i++;
 			}
 		}
-		PSL_plotpolygon (PSL, x, y, i);
+		utilmeca_bb_store (GMT, B, x, y, i);
 	}
 	/* pure strike-slip */
 	else if (fabs (90. - N_axis.dip) < SEIS_EPSILON) {
@@ -225,24 +391,24 @@ double meca_ps_mechanism (struct GMT_CTRL *GMT, struct PSL_CTRL *PSL, double x0,
 		for (i = 0; i <= 90; i++) {
 			str = meca.NP1.str - 90.0 + i * increment;
 			sincosd (str, &si, &co);
-			x[i] = x0 + si * radius_size;
-			y[i] = y0 + co * radius_size;
+			x[i] = si * radius_size;
+			y[i] = co * radius_size;
 		}
-		x[i] = x0;
-		y[i] = y0;
+		x[i] = 0.0;
+		y[i] = 0.0;
 		i++;
-		PSL_plotpolygon (PSL, x, y, i);
+		utilmeca_bb_store (GMT, B, x, y, i);
 		/* second compressing part */
 		for (i = 0; i <= 90; i++) {
 			str = meca.NP1.str + 90.0 + i * increment;
 			sincosd (str, &si, &co);
-			x[i] = x0 + si * radius_size;
-			y[i] = y0 + co * radius_size;
+			x[i] = si * radius_size;
+			y[i] = co * radius_size;
 		}
-		x[i] = x0;
-		y[i] = y0;
+		x[i] = 0.0;
+		y[i] = 0.0;
 		i++;
-		PSL_plotpolygon (PSL, x, y, i);
+		utilmeca_bb_store (GMT, B, x, y, i);
 	}
 	else {
 		/* other cases */
@@ -254,8 +420,8 @@ double meca_ps_mechanism (struct GMT_CTRL *GMT, struct PSL_CTRL *PSL, double x0,
 		while (fabs (90. - meca.NP1.dip) < SEIS_EPSILON ? str <= meca.NP1.str + SEIS_EPSILON : str <= N_axis.str + SEIS_EPSILON) {
 			radius = utilmeca_proj_radius (meca.NP1.str, meca.NP1.dip, str) * radius_size;
 			sincosd (str, &si, &co);
-			x[i] = x0 + radius * si;
-			y[i] = y0 + radius * co;
+			x[i] = radius * si;
+			y[i] = radius * co;
 			str += increment;
 			i++;
 		}
@@ -269,8 +435,8 @@ double meca_ps_mechanism (struct GMT_CTRL *GMT, struct PSL_CTRL *PSL, double x0,
 		while (increment > 0. ? str <= meca.NP2.str + SEIS_EPSILON : str >= meca.NP2.str - SEIS_EPSILON) {
 			radius = utilmeca_proj_radius (meca.NP2.str - (1 + fault) * 90., meca.NP2.dip, str) * radius_size;
 			sincosd (str, &si, &co);
-			x[i] = x0 + radius * si;
-			y[i] = y0 + radius * co;
+			x[i] = radius * si;
+			y[i] = radius * co;
 			str += increment;
 			i++;
 		}
@@ -283,13 +449,13 @@ double meca_ps_mechanism (struct GMT_CTRL *GMT, struct PSL_CTRL *PSL, double x0,
 		str = meca.NP2.str;
 		while (increment > 0. ? str <= meca.NP1.str + SEIS_EPSILON : str >= meca.NP1.str - SEIS_EPSILON) {
 			sincosd (str, &si, &co);
-			x[i] = x0 + si * radius_size;
-			y[i] = y0 + co * radius_size;
+			x[i] = si * radius_size;
+			y[i] = co * radius_size;
 			str += increment;
 			i++;
 		}
 
-		PSL_plotpolygon (PSL, x, y, i);
+		utilmeca_bb_store (GMT, B, x, y, i);
 
 		/* first nodal plane till null axis */
 		i = 0;
@@ -300,8 +466,8 @@ double meca_ps_mechanism (struct GMT_CTRL *GMT, struct PSL_CTRL *PSL, double x0,
 		while (fabs (90. - meca.NP1.dip) < SEIS_EPSILON ? str >= meca.NP1.str -SEIS_EPSILON : str >= N_axis.str - SEIS_EPSILON) {
 			radius = utilmeca_proj_radius (meca.NP1.str - 180., meca.NP1.dip, str) * radius_size;
 			sincosd (str, &si, &co);
-			x[i] = x0 + radius * si;
-			y[i] = y0 + radius * co;
+			x[i] = radius * si;
+			y[i] = radius * co;
 			str += increment;
 			i++;
 		}
@@ -314,8 +480,8 @@ double meca_ps_mechanism (struct GMT_CTRL *GMT, struct PSL_CTRL *PSL, double x0,
 		while (increment > 0. ? str <= meca.NP2.str + SEIS_EPSILON : str >= meca.NP2.str - SEIS_EPSILON) {
 			radius = utilmeca_proj_radius (meca.NP2.str - (1 - fault) * 90., meca.NP2.dip, str) * radius_size;
 			sincosd (str, &si, &co);
-			x[i] = x0 + radius * si;
-			y[i] = y0 + radius * co;
+			x[i] = radius * si;
+			y[i] = radius * co;
 			str += increment;
 			i++;
 		}
@@ -328,18 +494,35 @@ double meca_ps_mechanism (struct GMT_CTRL *GMT, struct PSL_CTRL *PSL, double x0,
 		str = meca.NP2.str;
 		while (increment > 0. ? str <= meca.NP1.str + SEIS_EPSILON : str >= meca.NP1.str - SEIS_EPSILON) {
 			sincosd (str, &si, &co);
-			x[i] = x0 + si * radius_size;
-			y[i] = y0 + co * radius_size;
+			x[i] = si * radius_size;
+			y[i] = co * radius_size;
 			str += increment;
 			i++;
 		}
 
-		PSL_plotpolygon (PSL, x, y, i);
+		utilmeca_bb_store (GMT, B, x, y, i);
 	}
 
-	/* fill at then beginning, outline at the end (here) */
-	gmt_setfill (GMT, NULL, 1);
-	PSL_plotsymbol (PSL, x0, y0, ssize, PSL_CIRCLE);
+	B->status = 0;	/* Regular case: plot the polygon(s) */
+	B->computed = 1;
+}
+
+/***********************************************************************************************************/
+double meca_ps_mechanism (struct GMT_CTRL *GMT, struct PSL_CTRL *PSL, double x0, double y0, st_me meca, double size, struct GMT_FILL *F, struct GMT_FILL *E, int outline, struct SEIS_BB_CACHE *cache) {
+	/* Draw beachball for double couples
+	   By Genevieve Patau
+	*/
+	int64_t qkey[SEIS_BB_NKEY];
+	struct SEIS_BB_CLASS *B = NULL, B_local;
+
+	utilmeca_bb_key_dc (meca, qkey);
+	if (cache == NULL || (B = utilmeca_bb_cache_get (GMT, cache, qkey)) == NULL) {	/* No cache, so compute and discard */
+		gmt_M_memset (&B_local, 1, struct SEIS_BB_CLASS);
+		B = &B_local;
+	}
+	if (!B->computed) utilmeca_dc_geometry (GMT, meca, B);
+	utilmeca_bb_stamp (GMT, PSL, B, x0, y0, size, F, E, outline);
+	if (B == &B_local) utilmeca_bb_wipe (GMT, B);
 	return (size);
 }
 
@@ -601,8 +784,8 @@ void meca_moment2axe (struct GMT_CTRL *GMT, struct SEIS_M_TENSOR mt, struct SEIS
 }
 
 /***************************************************************************************/
-double meca_ps_tensor (struct GMT_CTRL *GMT, struct PSL_CTRL *PSL, double x0, double y0, double size, struct SEIS_AXIS T, struct SEIS_AXIS N, struct SEIS_AXIS P, struct GMT_FILL *C, struct GMT_FILL *E, int outline, int plot_zerotrace, int recno) {
-	/* Plot beachball for full moment tensors */
+static int utilmeca_tensor_geometry (struct GMT_CTRL *GMT, struct SEIS_AXIS T, struct SEIS_AXIS N, struct SEIS_AXIS P, int plot_zerotrace, struct SEIS_BB_CLASS *B) {
+	/* Compute the unit-size outline(s) for a full moment tensor about the origin */
 	int d, b = 1, m, i, ii, n = 0, j1 = 1, j2 = 0, j3 = 0;
 	int bigisotestv0, bigisotestv2;
 
@@ -614,9 +797,7 @@ double meca_ps_tensor (struct GMT_CTRL *GMT, struct PSL_CTRL *PSL, double x0, do
 	double az = 0., azp = 0., takeoff, r, xc, yc;
 	double x1[400], y1[400], x2[400], y2[400], x3[400], y3[400];
 	double xp1[800], yp1[800], xp2[400], yp2[400];
-	double radius_size, si, co, ssize[1];
-
-	struct GMT_FILL *F1 = NULL, *F2 = NULL;
+	double radius_size, si, co;
 
 	a[0] = T.str; a[1] = N.str; a[2] = P.str;
 	p[0] = T.dip; p[1] = N.dip; p[2] = P.dip;
@@ -625,20 +806,18 @@ double meca_ps_tensor (struct GMT_CTRL *GMT, struct PSL_CTRL *PSL, double x0, do
 	vi = (v[0] + v[1] + v[2]) / 3.;
 	for (i=0; i<=2; i++) v[i] = v[i] - vi;
 
-	ssize[0] = size;
-	radius_size = size * 0.5;
+	radius_size = 0.5;
 
 	/* pure implosion or explosion */
 	if (fabs (squared(v[0]) + squared(v[1]) + squared(v[2])) < SEIS_EPSILON) {
-		if (vi > 0.) {
-			gmt_setfill (GMT, C, 1);
-			PSL_plotsymbol (PSL, x0, y0, ssize, PSL_CIRCLE);
-		}
-		if (vi < 0.) {
-			gmt_setfill (GMT, E, 1);
-			PSL_plotsymbol (PSL, x0, y0, ssize, PSL_CIRCLE);
-		}
-		return (radius_size*2.);
+		if (vi > 0.)
+			B->status = +1;	/* Full circle with compressive fill */
+		else if (vi < 0.)
+			B->status = -1;	/* Full circle with extensive fill */
+		else
+			B->status = +2;	/* Nothing to plot */
+		B->computed = 1;
+		return (0);
 	}
 
 	if (plot_zerotrace) vi = 0.;
@@ -665,16 +844,15 @@ double meca_ps_tensor (struct GMT_CTRL *GMT, struct PSL_CTRL *PSL, double x0, do
 	if (bigisotestv0 == 0) {
 		d = 0;
 		m = 2;
-		F1 = C;
-		F2 = E;
+		B->swap = false;	/* Polygons take the compressive fill */
 	} else if (bigisotestv2 == 0) {
 		d = 2;
 		m = 0;
-		F1 = E;
-		F2 = C;
+		B->swap = true;	/* Polygons take the extensive fill */
 	} else {
-		fprintf (stderr, "Warning: bigisotest failed for record %d, please report the issue to us! \n", recno);
-		return -1;
+		B->status = -2;	/* The caller reports the failure with the record number */
+		B->computed = 1;
+		return (-1);
 	}
 
 	f = - v[1] / v[d];
@@ -714,8 +892,8 @@ double meca_ps_tensor (struct GMT_CTRL *GMT, struct PSL_CTRL *PSL, double x0, do
 		}
 		r = M_SQRT2 * sin(takeoff / 2.);
 		sincos (az, &si, &co);
-		xc = x0 + radius_size * r * si;
-		yc = y0 + radius_size * r * co;
+		xc = radius_size * r * si;
+		yc = radius_size * r * co;
 
 		if (i == 0) {
 			azi[i][0] = az;
@@ -755,17 +933,12 @@ double meca_ps_tensor (struct GMT_CTRL *GMT, struct PSL_CTRL *PSL, double x0, do
 	}
 	azi[n][1] = az;
 
-	/* fill at then beginning (here), outline at the end */
-	gmt_setfill (GMT, F2, 0);
-	PSL_plotsymbol (PSL, x0, y0, ssize, PSL_CIRCLE);
-
-	gmt_setfill (GMT, F1, outline);
 	switch (n) {
 		case 0 :
 			for (i = 0; i < 360; i++) {
 				xp1[i] = x1[i]; yp1[i] = y1[i];
 			}
-			PSL_plotpolygon (PSL, xp1, yp1, i);
+			utilmeca_bb_store (GMT, B, xp1, yp1, i);
 			break;
 		case 1 :
 			for (i = 0; i < j1; i++) {
@@ -778,18 +951,18 @@ double meca_ps_tensor (struct GMT_CTRL *GMT, struct PSL_CTRL *PSL, double x0, do
 			if (azi[0][0] < azi[0][1]) {
 				for (az = azi[0][1] - D2R; az > azi[0][0]; az -= D2R) {
 					sincos (az, &si, &co);
-					xp1[i] = x0 + radius_size * si;
-					yp1[i++] = y0 + radius_size * co;
+					xp1[i] = radius_size * si;
+					yp1[i++] = radius_size * co;
 				}
 			}
 			else {
 				for (az = azi[0][1] + D2R; az < azi[0][0]; az += D2R) {
 					sincos (az, &si, &co);
-					xp1[i] = x0 + radius_size * si;
-					yp1[i++] = y0 + radius_size * co;
+					xp1[i] = radius_size * si;
+					yp1[i++] = radius_size * co;
 				}
 			}
-			PSL_plotpolygon (PSL, xp1, yp1, i);
+			utilmeca_bb_store (GMT, B, xp1, yp1, i);
 			for (i = 0; i < j2; i++) {
 				xp2[i] = x2[i]; yp2[i] = y2[i];
 			}
@@ -800,18 +973,18 @@ double meca_ps_tensor (struct GMT_CTRL *GMT, struct PSL_CTRL *PSL, double x0, do
 			if (azi[1][0] < azi[1][1]) {
 				for (az = azi[1][1] - D2R; az > azi[1][0]; az -= D2R) {
 					sincos (az, &si, &co);
-					xp2[i] = x0 + radius_size * si;
-					yp2[i++] = y0 + radius_size * co;
+					xp2[i] = radius_size * si;
+					yp2[i++] = radius_size * co;
 				}
 			}
 			else {
 				for (az = azi[1][1] + D2R; az < azi[1][0]; az += D2R) {
 					sincos (az, &si, &co);
-					xp2[i] = x0 + radius_size * si;
-					yp2[i++] = y0 + radius_size * co;
+					xp2[i] = radius_size * si;
+					yp2[i++] = radius_size * co;
 				}
 			}
-			PSL_plotpolygon (PSL, xp2, yp2, i);
+			utilmeca_bb_store (GMT, B, xp2, yp2, i);
 			break;
 		case 2 :
 			for (i = 0; i < j3; i++) {
@@ -828,18 +1001,18 @@ double meca_ps_tensor (struct GMT_CTRL *GMT, struct PSL_CTRL *PSL, double x0, do
 			if (azi[2][0] < azi[0][1]) {
 				for (az = azi[0][1] - D2R; az > azi[2][0]; az -= D2R) {
 					sincos (az, &si, &co);
-					xp1[i] = x0 + radius_size * si;
-					yp1[i++] = y0 + radius_size * co;
+					xp1[i] = radius_size * si;
+					yp1[i++] = radius_size * co;
 				}
 			}
 			else {
 				for (az = azi[0][1] + D2R; az < azi[2][0]; az += D2R) {
 					sincos (az, &si, &co);
-					xp1[i] = x0 + radius_size * si;
-					yp1[i++] = y0 + radius_size * co;
+					xp1[i] = radius_size * si;
+					yp1[i++] = radius_size * co;
 				}
 			}
-			PSL_plotpolygon (PSL, xp1, yp1, i);
+			utilmeca_bb_store (GMT, B, xp1, yp1, i);
 			for (i = 0; i < j2; i++) {
 				xp2[i] = x2[i]; yp2[i] = y2[i];
 			}
@@ -850,25 +1023,64 @@ double meca_ps_tensor (struct GMT_CTRL *GMT, struct PSL_CTRL *PSL, double x0, do
 			if (azi[1][0] < azi[1][1]) {
 				for (az = azi[1][1] - D2R; az > azi[1][0]; az -= D2R) {
 					sincos (az, &si, &co);
-					xp2[i] = x0 + radius_size * si;
-					yp2[i++] = y0 + radius_size * co;
+					xp2[i] = radius_size * si;
+					yp2[i++] = radius_size * co;
 				}
 			}
 			else {
 				for (az = azi[1][1] + D2R; az < azi[1][0]; az += D2R) {
 					sincos (az, &si, &co);
-					xp2[i] = x0 + radius_size * si;
-					yp2[i++] = y0 + radius_size * co;
+					xp2[i] = radius_size * si;
+					yp2[i++] = radius_size * co;
 				}
 			}
-			PSL_plotpolygon (PSL, xp2, yp2, i);
+			utilmeca_bb_store (GMT, B, xp2, yp2, i);
 			break;
 	}
 
-	/* fill at then beginning, outline at the end (here) */
-	gmt_setfill (GMT, NULL, 1);
-	PSL_plotsymbol (PSL, x0, y0, ssize, PSL_CIRCLE);
+	B->status = 0;	/* Regular case: plot the polygon(s) */
+	B->computed = 1;
+
+	return (0);
+}
 
+static void utilmeca_bb_key_tensor (struct SEIS_AXIS T, struct SEIS_AXIS N, struct SEIS_AXIS P, int plot_zerotrace, int64_t qkey[]) {
+	/* Build the quantized class key for a full moment tensor.  The outline only depends
+	 * on the eigenvalue ratios so we normalize by the largest magnitude before quantizing. */
+	double vmax = MAX (fabs (T.val), MAX (fabs (N.val), fabs (P.val)));
+	if (vmax == 0.0) vmax = 1.0;	/* All zero, so avoid division by zero */
+	qkey[0] = 1;	/* Full moment tensor */
+	qkey[1] = lrint (T.str / SEIS_BB_ANG_TOL);
+	qkey[2] = lrint (T.dip / SEIS_BB_ANG_TOL);
+	qkey[3] = lrint (N.str / SEIS_BB_ANG_TOL);
+	qkey[4] = lrint (N.dip / SEIS_BB_ANG_TOL);
+	qkey[5] = lrint (P.str / SEIS_BB_ANG_TOL);
+	qkey[6] = lrint (P.dip / SEIS_BB_ANG_TOL);
+	qkey[7] = lrint (T.val / vmax / SEIS_BB_VAL_TOL);
+	qkey[8] = lrint (N.val / vmax / SEIS_BB_VAL_TOL);
+	qkey[9] = lrint (P.val / vmax / SEIS_BB_VAL_TOL);
+	qkey[10] = plot_zerotrace;
+}
+
+/***************************************************************************************/
+double meca_ps_tensor (struct GMT_CTRL *GMT, struct PSL_CTRL *PSL, double x0, double y0, double size, struct SEIS_AXIS T, struct SEIS_AXIS N, struct SEIS_AXIS P, struct GMT_FILL *C, struct GMT_FILL *E, int outline, int plot_zerotrace, int recno, struct SEIS_BB_CACHE *cache) {
+	/* Plot beachball for full moment tensors */
+	int64_t qkey[SEIS_BB_NKEY];
+	struct SEIS_BB_CLASS *B = NULL, B_local;
+
+	utilmeca_bb_key_tensor (T, N, P, plot_zerotrace, qkey);
+	if (cache == NULL || (B = utilmeca_bb_cache_get (GMT, cache, qkey)) == NULL) {	/* No cache, so compute and discard */
+		gmt_M_memset (&B_local, 1, struct SEIS_BB_CLASS);
+		B = &B_local;
+	}
+	if (!B->computed) utilmeca_tensor_geometry (GMT, T, N, P, plot_zerotrace, B);
+	if (B->status == -2) {	/* Could not determine the dominant eigenvalue */
+		fprintf (stderr, "Warning: bigisotest failed for record %d, please report the issue to us! \n", recno);
+		if (B == &B_local) utilmeca_bb_wipe (GMT, B);
+		return -1;
+	}
+	utilmeca_bb_stamp (GMT, PSL, B, x0, y0, size, C, E, outline);
+	if (B == &B_local) utilmeca_bb_wipe (GMT, B);
 	return (size);
 }
 
@@ -237,7 +237,11 @@ GMT_LOCAL int spectrum1d_compute_spectra (struct GMT_CTRL *GMT, struct SPECTRUM1
 		x_varp = spec_scale * (C->datac[0] * C->datac[0]);
 		if (C->y_given) {
 			y_varp = spec_scale * (C->datac[1] * C->datac[1]);
-			for (i = 0, f = 2; i < C->n_spec; i++, f+=2) {
+#ifdef _OPENMP
+#pragma omp parallel for private(i,f,xreal,ximag,yreal,yimag,xpower,ypower,co_spec,quad_spec) shared(C,spec_scale) reduction(+:x_varp,y_varp)
+#endif
+			for (i = 0; i < C->n_spec; i++) {	/* The frequency bins are all independent */
+				f = 2 * (i + 1);
 				xreal = (i == C->n_spec - 1) ? C->datac[f] : C->datac[f] + C->datac[C->window_2 - f];
 				ximag = (i == C->n_spec - 1) ? 0.0 : C->datac[f+1] - C->datac[C->window_2 - f + 1];
 				yreal = (i == C->n_spec - 1) ? C->datac[f+1] : C->datac[f+1] + C->datac[C->window_2 - f + 1];
@@ -260,7 +264,11 @@ GMT_LOCAL int spectrum1d_compute_spectra (struct GMT_CTRL *GMT, struct SPECTRUM1
 			y_varp *= (C->dt/C->n_spec);
 		}
 		else {
-			for (i = 0, f = 2; i < C->n_spec; i++, f+=2) {
+#ifdef _OPENMP
+#pragma omp parallel for private(i,f,xreal,ximag,xpower) shared(C,spec_scale) reduction(+:x_varp)
+#endif
+			for (i = 0; i < C->n_spec; i++) {	/* The frequency bins are all independent */
+				f = 2 * (i + 1);
 				xreal = C->datac[f] + C->datac[C->window_2 - f];
 				ximag = C->datac[f+1] - C->datac[C->window_2 - f + 1];
 				xpower = spec_scale * (xreal * xreal + ximag * ximag);
@@ -282,6 +290,9 @@ GMT_LOCAL int spectrum1d_compute_spectra (struct GMT_CTRL *GMT, struct SPECTRUM1
 		The cross spectral stuff needs to be computed */
 
 	if (C->y_given ) {
+#ifdef _OPENMP
+#pragma omp parallel for private(i,co_spec,quad_spec,co_quad) shared(C,one_on_nw)
+#endif
 		for (i = 0; i < C->n_spec; i++) {
 			C->spec[i].xpow *= one_on_nw;
 			C->spec[i].ypow *= one_on_nw;
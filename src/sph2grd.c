@@ -223,7 +223,7 @@ static int parse (struct GMT_CTRL *GMT, struct SPH2GRD_CTRL *Ctrl, struct GMT_OP
 EXTERN_MSC int GMT_sph2grd (void *V_API, int mode, void *args) {
 	bool ortho = false, duplicate_col;
 	openmp_int row, col, n_columns;
-	int error, L_sign = 1, L, L_min = 0, L_max = 0, M, M_max = 0, kk = 0;
+	int error, L_sign = 1, L, L_min = 0, L_max = 0, M, M_max = 0, M_lim = 0, kk = 0;
 	unsigned int n_PLM, n_CS, n_CS_nx, next_10_percent = 10;
 	uint64_t tbl, seg, drow, node, k;
 	char text[GMT_LEN32] = {""};
@@ -232,7 +232,7 @@ EXTERN_MSC int GMT_sph2grd (void *V_API, int mode, void *args) {
 	struct GMT_DATASET *D = NULL;
 	struct GMT_DATASEGMENT *T = NULL;
 	double **C = NULL, **S = NULL, **Cosm = NULL, **Sinm = NULL;
-	double *Cosmx = NULL, *Sinmx = NULL, *P_lm = NULL;
+	double *Cosmx = NULL, *Sinmx = NULL, *P_lm = NULL, *Am = NULL, *Bm = NULL;
 	struct SPH2GRD_CTRL *Ctrl = NULL;
 	struct GMT_CTRL *GMT = NULL, *GMT_cpy = NULL;
 	struct GMT_OPTION *options = NULL;
@@ -377,6 +377,7 @@ EXTERN_MSC int GMT_sph2grd (void *V_API, int mode, void *args) {
 	P_lm  = gmt_M_memory (GMT, NULL, n_PLM, double);
 	gmt_M_malloc2 (GMT, Cosmx, Sinmx, n_CS_nx, NULL, double);
 	gmt_M_malloc2 (GMT, Cosm,  Sinm,  Grid->header->n_columns, NULL, double *);
+	gmt_M_malloc2 (GMT, Am, Bm, n_CS, NULL, double);	/* Order sums A_m, B_m for the current latitude */
 
 	/* Evaluate longitude terms once and for all to avoid doing it repeatedly in the big loop.
 	 * We compute a matrix with rows representing order M and columns representing longitude.
@@ -403,6 +404,7 @@ EXTERN_MSC int GMT_sph2grd (void *V_API, int mode, void *args) {
 		n_bytes += 2 * (L_max + 1) * sizeof (double *);			/* C[] and S[] pointers */
 		n_bytes += 2 * (L_max + 1) * (L_max + 1) * sizeof (double);	/* C[] and S[] contents */
 		n_bytes += n_PLM * sizeof (double);				/* P_lm */
+		n_bytes += 2 * n_CS * sizeof (double);				/* Am and Bm */
 		n_bytes += 2 * n_CS_nx * sizeof (double);			/* Sinmx and Cosmn */
 		n_bytes += 2 * Grid->header->n_columns * sizeof (double *);		/* Sinm and Cosm pointers */
 
@@ -416,13 +418,12 @@ EXTERN_MSC int GMT_sph2grd (void *V_API, int mode, void *args) {
 
 	GMT_Report (API, GMT_MSG_INFORMATION, "Start evaluating the spherical harmonic series\n");
 
-	/* Below section will become parallellized via OpenMP soon.
-	 * Shared:  Grid, L_sign, L_max, L_min, ortho, Cosm, Sinm, Cosmx, Sinmx.
-	 * Private: P_lm, row, lat, col, node, sum, k, L, M.
-	 * Probably redo the verbosity to deal with multiple threads: Split 100% over
-	 * the n_threads, split 10/n_treads into nearest integer.
-	 */
+	/* The synthesis is factored in the standard fast way: for each latitude we first collapse
+	 * the degree sums per order, A_m = sum_L P_lm * C_lm and B_m = sum_L P_lm * S_lm, and then
+	 * each longitude only needs the single sum over orders of A_m*cos(M*lon) + B_m*sin(M*lon).
+	 * This reduces the per-node work from O(L_max^2) to O(L_max); both stages thread via OpenMP. */
 
+	M_lim = MIN (L_max, M_max);	/* Coefficients beyond the highest order present are all zero */
 	gmt_M_row_loop (GMT, Grid, row) {					/* For each output latitude */
 		lat = gmt_M_grd_row_to_y (GMT, row, Grid->header);	/* Current latitude */
 		/* Compute all P_lm needed for this latitude at once via gmt_plm_bar_all */
@@ -437,16 +438,24 @@ EXTERN_MSC int GMT_sph2grd (void *V_API, int mode, void *args) {
 			GMT_Report (API, GMT_MSG_DEBUG, "Working on latitude: %s\n", text);
 		}
 #ifdef _OPENMP
-#pragma omp parallel for private(col,node,sum,kk,L,M) shared(Grid,row,n_columns,L_min,L_max,P_lm,C,Cosm,S,Sinm)
+#pragma omp parallel for private(M,L,kk) shared(L_min,L_max,M_lim,P_lm,C,S,Am,Bm)
+#endif
+		for (M = 0; M <= M_lim; M++) {	/* Collapse the degree sums for each order */
+			double a = 0.0, b = 0.0;
+			for (L = MAX (L_min, M); L <= L_max; L++) {	/* Only degrees >= M contribute to this order */
+				kk = LM_index (L, M);
+				a += P_lm[kk] * C[L][M];
+				b += P_lm[kk] * S[L][M];
+			}
+			Am[M] = a;	Bm[M] = b;
+		}
+#ifdef _OPENMP
+#pragma omp parallel for private(col,node,sum,M) shared(Grid,row,n_columns,M_lim,Am,Cosm,Bm,Sinm)
 #endif
 		for (col = 0; col < n_columns; col++) {	/* For each longitude along this parallel */
 			sum = 0.0;	/* Initialize sum to zero for new output node */
-			kk = (L_min) ? LM_index (L_min, 0) : 0;	/* Set start index for P_lm packed array */
-			for (L = L_min; L <= L_max; L++) {	/* For all degrees */
-				for (M = 0; M <= L; M++, kk++) {	/* For all orders <= L */
-					sum += P_lm[kk] * (C[L][M] * Cosm[col][M] + S[L][M] * Sinm[col][M]);
-				}
-			}
+			for (M = 0; M <= M_lim; M++)	/* Sum over all orders */
+				sum += Am[M] * Cosm[col][M] + Bm[M] * Sinm[col][M];
 			node = gmt_M_ijp (Grid->header, row, col);
 			Grid->data[node] = (gmt_grdfloat)sum;	/* Assign total to the grid, cast as gmt_grdfloat */
 		}
@@ -470,6 +479,8 @@ EXTERN_MSC int GMT_sph2grd (void *V_API, int mode, void *args) {
 	/* Clear up by freeing memory */
 
 	gmt_M_free (GMT, P_lm);
+	gmt_M_free (GMT, Am);
+	gmt_M_free (GMT, Bm);
 	gmt_M_free (GMT, Cosm);
 	gmt_M_free (GMT, Sinm);
 	gmt_M_free (GMT, Cosmx);
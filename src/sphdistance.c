@@ -52,10 +52,8 @@ enum sphdist_modes {
 	SPHD_VALUES = 2};
 
 struct SPHDISTANCE_CTRL {
-	struct SPHDISTANCE_A {	/* -A[m|p|x|y|step] */
+	struct SPHDISTANCE_A {	/* -A */
 		bool active;
-		unsigned int mode;
-		double step;
 	} A;
 	struct SPHDISTANCE_C {	/* -C */
 		bool active;
@@ -122,6 +120,101 @@ GMT_LOCAL void sphdistance_prepare_polygon (struct GMT_CTRL *GMT, struct GMT_DAT
 	}
 }
 
+GMT_LOCAL uint64_t sphdistance_frontier_fill (struct GMT_CTRL *GMT, struct GMT_GRID *Grid, double *lon, double *lat, gmt_grdfloat *z_val, uint64_t n, unsigned int e_mode, bool periodic, unsigned int nx1) {
+	/* Multi-source frontier propagation producing the nearest-data-point field in near-linear
+	 * time.  Each data point is seeded at its closest grid node with its exact distance; the
+	 * frontier then relaxes outward, and every candidate assignment re-evaluates the exact
+	 * spherical distance from the grid node to the propagated data point, so the final field
+	 * matches the per-polygon scan to grid resolution without visiting any polygon arcs.
+	 * Nodes keep the index of their nearest data point so the -En and -Ez modes work too. */
+	openmp_int row, col;
+	int srow, scol, drow, dcol, row2, col2;
+	unsigned int n_rows = Grid->header->n_rows, n_cols = Grid->header->n_columns;
+	uint64_t k, node, node2, ij, q_head = 0, q_tail = 0, q_n = 0, nm = Grid->header->nm;
+	bool *in_queue = NULL;
+	uint64_t *queue = NULL, *nearest = NULL;
+	double d, *grid_lon = Grid->x, *grid_lat = Grid->y;
+	struct GMT_DIST_FROM D_from;
+
+	nearest  = gmt_M_memory (GMT, NULL, nm, uint64_t);
+	in_queue = gmt_M_memory (GMT, NULL, nm, bool);
+	queue    = gmt_M_memory (GMT, NULL, nm, uint64_t);	/* FIFO ring; in_queue guarantees at most nm entries */
+
+	gmt_M_grd_loop (GMT, Grid, row, col, ij)	/* Initialize all distances to huge */
+		Grid->data[ij] = FLT_MAX;
+
+	for (k = 0; k < n; k++) {	/* Seed each data point at its nearest grid node with the exact distance */
+		srow = (int)gmt_M_grd_y_to_row (GMT, lat[k], Grid->header);
+		if (srow < 0) srow = 0;	else if (srow >= (int)n_rows) srow = n_rows - 1;
+		scol = (int)gmt_M_grd_x_to_col (GMT, lon[k], Grid->header);
+		if (periodic) {	/* Wrap into the grid */
+			while (scol < 0) scol += nx1;
+			while (scol >= (int)n_cols) scol -= nx1;
+		}
+		else {	/* A point outside a regional grid seeds the nearest border node with its true distance */
+			if (scol < 0) scol = 0;	else if (scol >= (int)n_cols) scol = n_cols - 1;
+		}
+		node = (uint64_t)srow * n_cols + scol;
+		ij = gmt_M_ijp (Grid->header, srow, scol);
+		d = gmt_distance (GMT, grid_lon[scol], grid_lat[srow], lon[k], lat[k]);
+		if ((gmt_grdfloat)d < Grid->data[ij]) {
+			Grid->data[ij] = (gmt_grdfloat)d;
+			nearest[node] = k;
+			if (!in_queue[node]) {
+				queue[q_tail] = node;	q_tail = (q_tail + 1) % nm;	q_n++;
+				in_queue[node] = true;
+			}
+		}
+	}
+
+	while (q_n) {	/* Relax the frontier until no node can be improved */
+		node = queue[q_head];	q_head = (q_head + 1) % nm;	q_n--;
+		in_queue[node] = false;
+		row = (openmp_int)(node / n_cols);	col = (openmp_int)(node % n_cols);
+		k = nearest[node];
+		gmt_distance_from_prep (GMT, lon[k], lat[k], &D_from);	/* All 8 evaluations share this origin */
+		for (drow = -1; drow <= 1; drow++) {
+			row2 = (int)row + drow;
+			if (row2 < 0 || row2 >= (int)n_rows) continue;
+			for (dcol = -1; dcol <= 1; dcol++) {
+				if (drow == 0 && dcol == 0) continue;
+				col2 = (int)col + dcol;
+				if (col2 < 0) {
+					if (!periodic) continue;
+					col2 += nx1;
+				}
+				else if (col2 >= (int)n_cols) {
+					if (!periodic) continue;
+					col2 -= nx1;
+				}
+				node2 = (uint64_t)row2 * n_cols + col2;
+				ij = gmt_M_ijp (Grid->header, row2, col2);
+				d = gmt_distance_from (GMT, &D_from, grid_lon[col2], grid_lat[row2]);
+				if ((gmt_grdfloat)d < Grid->data[ij]) {	/* Compare as stored so improvements strictly decrease */
+					Grid->data[ij] = (gmt_grdfloat)d;
+					nearest[node2] = k;
+					if (!in_queue[node2]) {
+						queue[q_tail] = node2;	q_tail = (q_tail + 1) % nm;	q_n++;
+						in_queue[node2] = true;
+					}
+				}
+			}
+		}
+	}
+
+	if (e_mode != SPHD_DIST) {	/* Wanted the id or value of the nearest data point, not the distance */
+		gmt_M_grd_loop (GMT, Grid, row, col, ij) {
+			node = (uint64_t)row * n_cols + col;
+			Grid->data[ij] = (e_mode == SPHD_NODES) ? (gmt_grdfloat)nearest[node] : z_val[nearest[node]];
+		}
+	}
+
+	gmt_M_free (GMT, nearest);
+	gmt_M_free (GMT, in_queue);
+	gmt_M_free (GMT, queue);
+	return (nm);	/* All nodes are visited and set */
+}
+
 static void *New_Ctrl (struct GMT_CTRL *GMT) {	/* Allocate and initialize a new control structure */
 	struct SPHDISTANCE_CTRL *C;
 
@@ -143,7 +236,7 @@ static int usage (struct GMTAPI_CTRL *API, int level) {
 	const char *name = gmt_show_name_and_purpose (API, THIS_MODULE_LIB, THIS_MODULE_CLASSIC_NAME, THIS_MODULE_PURPOSE);
 	if (level == GMT_MODULE_PURPOSE) return (GMT_NOERROR);
 	GMT_Usage (API, 1, "==> The hard work is done by algorithms 772 (STRIPACK) & 773 (SSRFPACK) by R. J. Renka [1997] <==\n");
-	GMT_Usage (API, 0, "usage: %s [<table>] -G%s %s [-C] [-D] [-En|z|d[<dr>]] "
+	GMT_Usage (API, 0, "usage: %s [<table>] -G%s %s [-A] [-C] [-D] [-En|z|d[<dr>]] "
 		"[-L<unit>] [-N<nodetable>] [-Q<voronoitable>] [%s] [%s] [%s] [%s] "
 		"[%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s]\n",
 		 name, GMT_OUTGRID, GMT_I_OPT, GMT_Rgeo_OPT, GMT_V_OPT, GMT_bi_OPT, GMT_di_OPT, GMT_e_OPT, GMT_h_OPT,
@@ -157,6 +250,8 @@ static int usage (struct GMTAPI_CTRL *API, int level) {
 	GMT_Option (API, "I");
 
 	GMT_Message (API, GMT_TIME_NONE, "\n  OPTIONAL ARGUMENTS:\n");
+	GMT_Usage (API, 1, "\n-A Fill the grid by frontier propagation from the data points instead of scanning each "
+		"Voronoi polygon.  Runs in near-linear time and matches the exact mode to grid resolution [exact mode].");
 	GMT_Usage (API, 1, "\n-C Conserve memory (Converts lon/lat <--> x/y/z when needed) [store both in memory]. Not used with -Q.");
 	GMT_Usage (API, 1, "\n-D Delete any duplicate points [Default assumes there are no duplicates].");
 	GMT_Usage (API, 1, "\n-En|z|d[<dr>]");
@@ -199,6 +294,10 @@ static int parse (struct GMT_CTRL *GMT, struct SPHDISTANCE_CTRL *Ctrl, struct GM
 
 			/* Processes program-specific parameters */
 
+			case 'A':
+				n_errors += gmt_M_repeated_module_option (API, Ctrl->A.active);
+				n_errors += gmt_get_no_argument (GMT, opt->arg, opt->option, 0);
+				break;
 			case 'C':
 				n_errors += gmt_M_repeated_module_option (API, Ctrl->C.active);
 				n_errors += gmt_get_no_argument (GMT, opt->arg, opt->option, 0);
@@ -280,6 +379,7 @@ EXTERN_MSC int GMT_sphdistance (void *V_API, int mode, void *args) {
 	struct GMT_GRID *Grid = NULL;
 	struct GMT_RECORD *In = NULL;
 	struct SPHDISTANCE_CTRL *Ctrl = NULL;
+	struct GMT_DIST_FROM D_from;
 	struct STRIPACK T;
 	struct GMT_DATASEGMENT *P = NULL;
 	struct GMT_DATASET *Qin = NULL;
@@ -469,11 +569,12 @@ EXTERN_MSC int GMT_sphdistance (void *V_API, int mode, void *args) {
 		else
 			GMT_Report (API, GMT_MSG_INFORMATION, "No duplicate check performed [-D was not activated]\n");
 
-		GMT_Report (API, GMT_MSG_INFORMATION, "Do Voronoi construction using %" PRIu64 " points\n", n);
-
-		T.mode = VORONOI;
-		if (gmt_stripack_lists (GMT, n, xx, yy, zz, &T)) Return (GMT_RUNTIME_ERROR);	/* Do the basic triangulation */
-		gmt_M_free (GMT, T.D.tri);	/* Don't need the triangulation */
+		if (!Ctrl->A.active) {	/* Frontier propagation only needs the data points, not their Voronoi polygons */
+			GMT_Report (API, GMT_MSG_INFORMATION, "Do Voronoi construction using %" PRIu64 " points\n", n);
+			T.mode = VORONOI;
+			if (gmt_stripack_lists (GMT, n, xx, yy, zz, &T)) Return (GMT_RUNTIME_ERROR);	/* Do the basic triangulation */
+			gmt_M_free (GMT, T.D.tri);	/* Don't need the triangulation */
+		}
 		if (Ctrl->C.active) {	/* Recompute lon,lat and set pointers */
 			gmt_n_cart_to_geo (GMT, n, xx, yy, zz, xx, yy);	/* Revert to lon, lat */
 			lon = xx;
@@ -508,111 +609,122 @@ EXTERN_MSC int GMT_sphdistance (void *V_API, int mode, void *args) {
 	else
 		V = &T.V;
 
-	for (node = 0; node < n; node++) {
-		GMT_Report (API, GMT_MSG_INFORMATION, "Processing polygon %7ld\r", node);
-		if (Ctrl->Q.active) {	/* Just point to next polygon */
-			if (duplicate)	/* Must duplicate externally allocated segment since it needs to be resampled below */
-				P = gmt_duplicate_segment (GMT, Table->segment[node]);
-			else
-				P = Table->segment[node];
-		}
-		else {	/* Obtain current polygon from Voronoi listings */
-			if (P == NULL) {	/* Need a single polygon structure that we reuse for each polygon */
-				P = gmt_get_segment (GMT, 2);	/* Needed as pointer below */
-				P->data = gmt_M_memory (GMT, NULL, 2, double *);	/* Needed as pointers below */
-				P->min = gmt_M_memory (GMT, NULL, 2, double);	/* Needed to hold min lon/lat */
-				P->max = gmt_M_memory (GMT, NULL, 2, double);	/* Needed to hold max lon/lat */
-				P->n_columns = 2;	p_alloc = 0;
-				gmt_M_malloc2 (GMT, P->data[GMT_X], P->data[GMT_Y], GMT_TINY_CHUNK, &p_alloc, double);
+	if (Ctrl->A.active) {	/* Fill the grid by frontier propagation from the data points; no polygon scanning needed */
+		n_set = sphdistance_frontier_fill (GMT, Grid, lon, lat, z_val, n, Ctrl->E.mode, periodic, nx1);
+		GMT_Report (API, GMT_MSG_INFORMATION, "Frontier propagation assigned all %" PRIu64 " nodes\n", n_set);
+	}
+	else {
+		for (node = 0; node < n; node++) {
+			GMT_Report (API, GMT_MSG_INFORMATION, "Processing polygon %7ld\r", node);
+			if (Ctrl->Q.active) {	/* Just point to next polygon */
+				if (duplicate)	/* Must duplicate externally allocated segment since it needs to be resampled below */
+					P = gmt_duplicate_segment (GMT, Table->segment[node]);
+				else
+					P = Table->segment[node];
 			}
-			node_new = node_stop = V->lend[node];
-			vertex_new = V->listc[node_new];
-
-			/* Each iteration of this do-loop walks along one side of the polygon,
-			   considering the subtriangle NODE --> VERTEX_LAST --> VERTEX. */
-
-			vertex = 0;
-		    	do {
-				node_last = node_new;
-				node_new = V->lptr[node_last];
-				vertex_last = vertex_new;
+			else {	/* Obtain current polygon from Voronoi listings */
+				if (P == NULL) {	/* Need a single polygon structure that we reuse for each polygon */
+					P = gmt_get_segment (GMT, 2);	/* Needed as pointer below */
+					P->data = gmt_M_memory (GMT, NULL, 2, double *);	/* Needed as pointers below */
+					P->min = gmt_M_memory (GMT, NULL, 2, double);	/* Needed to hold min lon/lat */
+					P->max = gmt_M_memory (GMT, NULL, 2, double);	/* Needed to hold max lon/lat */
+					P->n_columns = 2;	p_alloc = 0;
+					gmt_M_malloc2 (GMT, P->data[GMT_X], P->data[GMT_Y], GMT_TINY_CHUNK, &p_alloc, double);
+				}
+				node_new = node_stop = V->lend[node];
 				vertex_new = V->listc[node_new];
 
-				P->data[GMT_X][vertex] = V->lon[vertex_last];
-				P->data[GMT_Y][vertex] = V->lat[vertex_last];
-				if (P->data[GMT_X][vertex] < 0.0) P->data[GMT_X][vertex] += 360.0;
-				if (P->data[GMT_X][vertex] == 360.0) P->data[GMT_X][vertex] = 0.0;
-				vertex++;
-				if (vertex == p_alloc)
+				/* Each iteration of this do-loop walks along one side of the polygon,
+				   considering the subtriangle NODE --> VERTEX_LAST --> VERTEX. */
+
+				vertex = 0;
+			    	do {
+					node_last = node_new;
+					node_new = V->lptr[node_last];
+					vertex_last = vertex_new;
+					vertex_new = V->listc[node_new];
+
+					P->data[GMT_X][vertex] = V->lon[vertex_last];
+					P->data[GMT_Y][vertex] = V->lat[vertex_last];
+					if (P->data[GMT_X][vertex] < 0.0) P->data[GMT_X][vertex] += 360.0;
+					if (P->data[GMT_X][vertex] == 360.0) P->data[GMT_X][vertex] = 0.0;
+					vertex++;
+					if (vertex == p_alloc)
+						gmt_M_malloc2 (GMT, P->data[GMT_X], P->data[GMT_Y], vertex, &p_alloc, double);
+
+					/* When we reach the vertex where we started, we are done with this polygon */
+				} while (node_new != node_stop);
+				P->data[GMT_X][vertex] = P->data[GMT_X][0];	/* Close polygon explicitly */
+				P->data[GMT_Y][vertex] = P->data[GMT_Y][0];
+				if ((++vertex) == p_alloc)
 					gmt_M_malloc2 (GMT, P->data[GMT_X], P->data[GMT_Y], vertex, &p_alloc, double);
-
-				/* When we reach the vertex where we started, we are done with this polygon */
-			} while (node_new != node_stop);
-			P->data[GMT_X][vertex] = P->data[GMT_X][0];	/* Close polygon explicitly */
-			P->data[GMT_Y][vertex] = P->data[GMT_Y][0];
-			if ((++vertex) == p_alloc)
-				gmt_M_malloc2 (GMT, P->data[GMT_X], P->data[GMT_Y], vertex, &p_alloc, double);
-			P->n_rows = vertex;
-			switch (Ctrl->E.mode) {
-				case SPHD_NODES:	f_val = (gmt_grdfloat)node;	break;
-				case SPHD_VALUES:	f_val = z_val[node];	break;
-				default:	break;	/* Must compute distances below */
+				P->n_rows = vertex;
+				switch (Ctrl->E.mode) {
+					case SPHD_NODES:	f_val = (gmt_grdfloat)node;	break;
+					case SPHD_VALUES:	f_val = z_val[node];	break;
+					default:	break;	/* Must compute distances below */
+				}
 			}
-		}
 
-		/* Here we have the polygon in P */
+			/* Here we have the polygon in P */
 
-		if ((n_new = gmt_fix_up_path (GMT, &P->data[GMT_X], &P->data[GMT_Y], P->n_rows, Ctrl->E.dist, GMT_STAIRS_OFF)) == 0) {
-			gmt_M_free (GMT, P);
-			Return (GMT_RUNTIME_ERROR);
-		}
-		P->n_rows = p_alloc = n_new;	/* Must reset p_alloc since gmt_fix_up_path reallocated to fit n_new */
-		sphdistance_prepare_polygon (GMT, P);	/* Determine the enclosing sector */
-
-		south_row = (int)gmt_M_grd_y_to_row (GMT, P->min[GMT_Y], Grid->header);
-		north_row = (int)gmt_M_grd_y_to_row (GMT, P->max[GMT_Y], Grid->header);
-		w_col  = (int)gmt_M_grd_x_to_col (GMT, P->min[GMT_X], Grid->header);
-		while (w_col < 0) w_col += nx1;
-		west_col = w_col;
-		e_col = (int)gmt_M_grd_x_to_col (GMT, P->max[GMT_X], Grid->header);
-		while (e_col < w_col) e_col += nx1;
-		east_col = e_col;
-		/* So here, any polygon will have a positive (or 0) west_col with an east_col >= west_col */
-		for (s_row = north_row; s_row <= south_row; s_row++) {	/* For each scanline intersecting this polygon */
-			if (s_row < 0) continue;	/* North of region */
-			row = s_row; if (row >= Grid->header->n_rows) continue;	/* South of region */
-			for (p_col = west_col; p_col <= east_col; p_col++) {	/* March along the scanline using col >= 0 */
-				if (p_col >= Grid->header->n_columns) {	/* Off the east end of the grid */
-					if (periodic)	/* Just shuffle to the corresponding point inside the global grid */
-						col = p_col - nx1;
-					else		/* Sorry, really outside the region */
-						continue;
-				}
-				else
-					col = p_col;
-				side = gmt_inonout (GMT, grid_lon[col], grid_lat[row], P);
-
-				if (side == GMT_OUTSIDE) continue;	/* Outside spherical polygon */
-				ij = gmt_M_ijp (Grid->header, row, col);
-				if (Ctrl->E.mode == SPHD_DIST)
-					f_val = (gmt_grdfloat)gmt_distance (GMT, grid_lon[col], grid_lat[row], lon[node], lat[node]);
-				Grid->data[ij] = f_val;
-				n_set++;
-				if (duplicate_col) {	/* Duplicate the repeating column on the other side of this one */
-					if (col == 0) Grid->data[ij+nx1] = Grid->data[ij], n_set++;
-					else if (col == nx1) Grid->data[ij-nx1] = Grid->data[ij], n_set++;
+			if ((n_new = gmt_fix_up_path (GMT, &P->data[GMT_X], &P->data[GMT_Y], P->n_rows, Ctrl->E.dist, GMT_STAIRS_OFF)) == 0) {
+				gmt_M_free (GMT, P);
+				Return (GMT_RUNTIME_ERROR);
+			}
+			P->n_rows = p_alloc = n_new;	/* Must reset p_alloc since gmt_fix_up_path reallocated to fit n_new */
+			sphdistance_prepare_polygon (GMT, P);	/* Determine the enclosing sector */
+
+			if (Ctrl->E.mode == SPHD_DIST)	/* All distances inside this polygon are from the same node so cache its terms */
+				gmt_distance_from_prep (GMT, lon[node], lat[node], &D_from);
+
+			south_row = (int)gmt_M_grd_y_to_row (GMT, P->min[GMT_Y], Grid->header);
+			north_row = (int)gmt_M_grd_y_to_row (GMT, P->max[GMT_Y], Grid->header);
+			w_col  = (int)gmt_M_grd_x_to_col (GMT, P->min[GMT_X], Grid->header);
+			while (w_col < 0) w_col += nx1;
+			west_col = w_col;
+			e_col = (int)gmt_M_grd_x_to_col (GMT, P->max[GMT_X], Grid->header);
+			while (e_col < w_col) e_col += nx1;
+			east_col = e_col;
+			/* So here, any polygon will have a positive (or 0) west_col with an east_col >= west_col */
+			for (s_row = north_row; s_row <= south_row; s_row++) {	/* For each scanline intersecting this polygon */
+				if (s_row < 0) continue;	/* North of region */
+				row = s_row; if (row >= Grid->header->n_rows) continue;	/* South of region */
+				for (p_col = west_col; p_col <= east_col; p_col++) {	/* March along the scanline using col >= 0 */
+					if (p_col >= Grid->header->n_columns) {	/* Off the east end of the grid */
+						if (periodic)	/* Just shuffle to the corresponding point inside the global grid */
+							col = p_col - nx1;
+						else		/* Sorry, really outside the region */
+							continue;
+					}
+					else
+						col = p_col;
+					side = gmt_inonout (GMT, grid_lon[col], grid_lat[row], P);
+
+					if (side == GMT_OUTSIDE) continue;	/* Outside spherical polygon */
+					ij = gmt_M_ijp (Grid->header, row, col);
+					if (Ctrl->E.mode == SPHD_DIST)
+						f_val = (gmt_grdfloat)gmt_distance_from (GMT, &D_from, grid_lon[col], grid_lat[row]);
+					Grid->data[ij] = f_val;
+					n_set++;
+					if (duplicate_col) {	/* Duplicate the repeating column on the other side of this one */
+						if (col == 0) Grid->data[ij+nx1] = Grid->data[ij], n_set++;
+						else if (col == nx1) Grid->data[ij-nx1] = Grid->data[ij], n_set++;
+					}
 				}
 			}
+			if (duplicate)	/* Free duplicate segment */
+				gmt_free_segment (GMT, &P);
 		}
-		if (duplicate)	/* Free duplicate segment */
-			gmt_free_segment (GMT, &P);
+		GMT_Report (API, GMT_MSG_INFORMATION, "Processing polygon %7ld\n", node);
 	}
-	GMT_Report (API, GMT_MSG_INFORMATION, "Processing polygon %7ld\n", node);
 
 	if (!Ctrl->Q.active) {
-		gmt_M_free (GMT, P->data[GMT_X]);
-		gmt_M_free (GMT, P->data[GMT_Y]);
-		gmt_free_segment (GMT, &P);
+		if (P) {	/* Only allocated when scanning polygons */
+			gmt_M_free (GMT, P->data[GMT_X]);
+			gmt_M_free (GMT, P->data[GMT_Y]);
+			gmt_free_segment (GMT, &P);
+		}
 		gmt_M_free (GMT, T.V.lon);
 		gmt_M_free (GMT, T.V.lat);
 		gmt_M_free (GMT, T.V.lend);
@@ -365,8 +365,7 @@ static int parse (struct GMT_CTRL *GMT, struct BACKTRACKER_CTRL *Ctrl, struct GM
 	return (n_errors ? GMT_PARSE_ERROR : GMT_NOERROR);
 }
 
-#define SPOTTER_BACK -1
-#define SPOTTER_FWD  +1
+/* SPOTTER_BACK and SPOTTER_FWD are defined in spotter.h */
 
 GMT_LOCAL int backtracker_spotter_track (struct GMT_CTRL *GMT, int way, double xp[], double yp[], double tp[], unsigned int np, struct EULER p[], unsigned int ns, double d_km, double t_zero, unsigned int time_flag, double wesn[], double **c) {
 	int n = GMT_NOTSET;
@@ -392,6 +391,7 @@ GMT_LOCAL int backtracker_spotter_track (struct GMT_CTRL *GMT, int way, double x
 
 EXTERN_MSC int GMT_backtracker (void *V_API, int mode, void *args) {
 	struct EULER *p = NULL;			/* Pointer to array of stage poles */
+	struct SPOTTER_ROT_CACHE *RotCache = NULL;	/* Memoized time -> rotation matrix table */
 
 	uint64_t n_points;		/* Number of data points read */
 	uint64_t n_track;		/* Number of points in a track segment */
@@ -482,6 +482,8 @@ EXTERN_MSC int GMT_backtracker (void *V_API, int mode, void *args) {
 			(Ctrl->L.mode == SPOTTER_FLOWLINE) ? sprintf (type, "Flowline") : sprintf (type, "Hotspot track");
 			(Ctrl->D.mode == SPOTTER_TOWARDS_PAST) ? sprintf (dir, "from") : sprintf (dir, "to");
 		}
+		else	/* Projecting individual points; memoize the composed rotation per distinct age */
+			RotCache = spotter_rot_cache_init (GMT, p, n_stages, spotter_way, Ctrl->T.t_zero);
 	}
 
 	if (Ctrl->F.active) {	/* Get and use hotspot motion file */
@@ -717,12 +719,9 @@ EXTERN_MSC int GMT_backtracker (void *V_API, int mode, void *args) {
 					continue;
 				}
 			}
-			else {	/* Reconstruct the point */
+			else {	/* Reconstruct the point via the memoized composed rotation for this age */
 				lon *= D2R;	lat *= D2R;
-				if (backtracker_spotter_track (GMT, spotter_way, &lon, &lat, &age, 1L, p, n_stages, Ctrl->L.d_km, Ctrl->T.t_zero, 1 + Ctrl->L.stage_id, NULL, &c) <= 0) {
-					GMT_Report (API, GMT_MSG_ERROR, "Nothing returned from backtracker_spotter_track - aborting\n");
-					Return (GMT_RUNTIME_ERROR);
-				}
+				spotter_rot_cache_rotate (GMT, RotCache, age, &lon, &lat);
 				out[GMT_X] = lon * R2D;
 				out[GMT_Y] = lat * R2D;
 				if (Ctrl->F.active && Ctrl->D.mode == SPOTTER_TOWARDS_PRESENT && Ctrl->L.mode == SPOTTER_TRAILLINE) {	/* Must account for hotspot drift, use interpolation for given age */
@@ -756,6 +755,7 @@ EXTERN_MSC int GMT_backtracker (void *V_API, int mode, void *args) {
 
 	/* Clean up and exit */
 
+	if (RotCache) spotter_rot_cache_free (GMT, &RotCache);
 	if (!Ctrl->E.rot.single) gmt_M_free (GMT, p);
 
 	Return (GMT_NOERROR);
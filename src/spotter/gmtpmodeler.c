@@ -218,7 +218,7 @@ static int parse (struct GMT_CTRL *GMT, struct GMTPMODELER_CTRL *Ctrl, struct GM
 }
 
 #define bailout(code) {gmt_M_free_options (mode); return (code);}
-#define Return(code) {if (p) gmt_M_free (GMT, p); Free_Ctrl (GMT, Ctrl); gmt_end_module (GMT, GMT_cpy); bailout (code);}
+#define Return(code) {if (p) gmt_M_free (GMT, p); if (RotCache) spotter_rot_cache_free (GMT, &RotCache); Free_Ctrl (GMT, Ctrl); gmt_end_module (GMT, GMT_cpy); bailout (code);}
 
 EXTERN_MSC int GMT_gmtpmodeler (void *V_API, int mode, void *args) {
 	unsigned int inside, stage, n_stages, k;
@@ -234,6 +234,7 @@ EXTERN_MSC int GMT_gmtpmodeler (void *V_API, int mode, void *args) {
 	struct GMT_DATASET *D = NULL;
 	struct GMT_DATATABLE *pol = NULL;
 	struct EULER *p = NULL;			/* Pointer to array of stage poles */
+	struct SPOTTER_ROT_CACHE *RotCache = NULL;	/* Memoized time -> rotation matrix table */
 	struct GMT_RECORD *In = NULL, *Out = NULL;
 	struct GMT_OPTION *ptr = NULL;
 	struct GMTPMODELER_CTRL *Ctrl = NULL;
@@ -302,6 +303,7 @@ EXTERN_MSC int GMT_gmtpmodeler (void *V_API, int mode, void *args) {
 		GMT_Report (API, GMT_MSG_ERROR, "Requested a fixed reconstruction time outside range of rotation table\n");
 		Return (GMT_RUNTIME_ERROR);
 	}
+	RotCache = spotter_rot_cache_init (GMT, p, n_stages, SPOTTER_BACK, 0.0);	/* Compose the back-rotation once per distinct age */
 	/* Set up input */
 	if (GMT_Init_IO (API, GMT_IS_DATASET, GMT_IS_POINT, GMT_IN,  GMT_ADD_DEFAULT, 0, options) != GMT_NOERROR) {	/* Establishes data input */
 		Return (API->error);
@@ -416,8 +418,7 @@ EXTERN_MSC int GMT_gmtpmodeler (void *V_API, int mode, void *args) {
 				case PM_DIST:	/* Compute great-circle distance between node and point of origin at ridge */
 					if (!spotted) {
 						lon = in[GMT_X] * D2R;	lat = lat_c * D2R;
-						if (spotter_backtrack (GMT, &lon, &lat, &age, 1U, p, n_stages, 0.0, 0.0, 0, NULL, NULL) < 0)
-							Return (GMT_RUNTIME_ERROR);
+						spotter_rot_cache_rotate (GMT, RotCache, age, &lon, &lat);
 						spotted = true;
 					}
 					value = GMT->current.proj.DIST_KM_PR_DEG * gmt_distance (GMT, in[GMT_X], lat_c, lon * R2D, lat * R2D);
@@ -435,8 +436,7 @@ EXTERN_MSC int GMT_gmtpmodeler (void *V_API, int mode, void *args) {
 					case PM_DLON:	/* Compute latitude where this point was formed in the model */
 					if (!spotted) {
 						lon = in[GMT_X] * D2R;	lat = lat_c * D2R;
-						if (spotter_backtrack (GMT, &lon, &lat, &age, 1U, p, n_stages, 0.0, 0.0, 0, NULL, NULL) < 0)
-							Return (GMT_RUNTIME_ERROR);
+						spotter_rot_cache_rotate (GMT, RotCache, age, &lon, &lat);
 						spotted = true;
 					}
 					value = in[GMT_X] - lon * R2D;
@@ -445,8 +445,7 @@ EXTERN_MSC int GMT_gmtpmodeler (void *V_API, int mode, void *args) {
 				case PM_DLAT:	/* Compute latitude where this point was formed in the model */
 					if (!spotted) {
 						lon = in[GMT_X] * D2R;	lat = lat_c * D2R;
-						if (spotter_backtrack (GMT, &lon, &lat, &age, 1U, p, n_stages, 0.0, 0.0, 0, NULL, NULL) < 0)
-							Return (GMT_RUNTIME_ERROR);
+						spotter_rot_cache_rotate (GMT, RotCache, age, &lon, &lat);
 						spotted = true;
 					}
 					value = in[GMT_Y] - gmt_lat_swap (GMT, lat * R2D, GMT_LATSWAP_O2G);	/* Convert back to geodetic */
@@ -454,8 +453,7 @@ EXTERN_MSC int GMT_gmtpmodeler (void *V_API, int mode, void *args) {
 				case PM_LON:	/* Compute latitude where this point was formed in the model */
 					if (!spotted) {
 						lon = in[GMT_X] * D2R;	lat = lat_c * D2R;
-						if (spotter_backtrack (GMT, &lon, &lat, &age, 1U, p, n_stages, 0.0, 0.0, 0, NULL, NULL) < 0)
-							Return (GMT_RUNTIME_ERROR);
+						spotter_rot_cache_rotate (GMT, RotCache, age, &lon, &lat);
 						spotted = true;
 					}
 					value = lon * R2D;
@@ -463,8 +461,7 @@ EXTERN_MSC int GMT_gmtpmodeler (void *V_API, int mode, void *args) {
 				case PM_LAT:	/* Compute latitude where this point was formed in the model */
 					if (!spotted) {
 						lon = in[GMT_X] * D2R;	lat = lat_c * D2R;
-						if (spotter_backtrack (GMT, &lon, &lat, &age, 1U, p, n_stages, 0.0, 0.0, 0, NULL, NULL) < 0)
-							Return (GMT_RUNTIME_ERROR);
+						spotter_rot_cache_rotate (GMT, RotCache, age, &lon, &lat);
 						spotted = true;
 					}
 					value = gmt_lat_swap (GMT, lat * R2D, GMT_LATSWAP_O2G);			/* Convert back to geodetic */
@@ -252,7 +252,7 @@ static int parse (struct GMT_CTRL *GMT, struct GRDROTATER_CTRL *Ctrl, struct GMT
 }
 
 #define bailout(code) {gmt_M_free_options (mode); return (code);}
-#define Return(code) {gmt_M_free (GMT, p); Free_Ctrl (GMT, Ctrl); gmt_end_module (GMT, GMT_cpy); bailout (code);}
+#define Return(code) {gmt_M_free (GMT, p); if (RotCache) spotter_rot_cache_free (GMT, &RotCache); Free_Ctrl (GMT, Ctrl); gmt_end_module (GMT, GMT_cpy); bailout (code);}
 
 EXTERN_MSC int GMT_grdpmodeler (void *V_API, int mode, void *args) {
 	openmp_int col, row;
@@ -271,6 +271,7 @@ EXTERN_MSC int GMT_grdpmodeler (void *V_API, int mode, void *args) {
 	struct GMT_DATASET *D = NULL;
 	struct GMT_DATATABLE *pol = NULL;
 	struct EULER *p = NULL;			/* Pointer to array of stage poles */
+	struct SPOTTER_ROT_CACHE *RotCache = NULL;	/* Memoized time -> rotation matrix table */
 	struct GMT_OPTION *ptr = NULL;
 	struct GMT_GRID *G_age = NULL, **G_mod = NULL, *G = NULL;
 	struct GMT_RECORD *Out = NULL;
@@ -353,6 +354,7 @@ EXTERN_MSC int GMT_grdpmodeler (void *V_API, int mode, void *args) {
 		GMT_Report (API, GMT_MSG_ERROR, "Requested a fixed reconstruction time outside range of rotation table\n");
 		Return (GMT_RUNTIME_ERROR);
 	}
+	RotCache = spotter_rot_cache_init (GMT, p, n_stages, SPOTTER_BACK, 0.0);	/* Compose the back-rotation once per distinct age */
 
 	if (Ctrl->G.active) {	/* Need one or more output grids */
 		G_mod = gmt_M_memory (GMT, NULL, Ctrl->S.n_items, struct GMT_GRID *);
@@ -462,8 +464,7 @@ EXTERN_MSC int GMT_grdpmodeler (void *V_API, int mode, void *args) {
 				case PM_DIST:	/* Compute great-circle distance between node and point of origin at ridge */
 					if (!spotted) {
 						lon = grd_x[col] * D2R;	lat = grd_yc[row] * D2R;
-						if (spotter_backtrack (GMT, &lon, &lat, &age, 1U, p, n_stages, 0.0, 0.0, 0, NULL, NULL) < 0)
-							Return (GMT_RUNTIME_ERROR);
+						spotter_rot_cache_rotate (GMT, RotCache, age, &lon, &lat);
 						spotted = true;
 					}
 					value = GMT->current.proj.DIST_KM_PR_DEG * gmt_distance (GMT, grd_x[col], grd_yc[row], lon * R2D, lat * R2D);
@@ -481,8 +482,7 @@ EXTERN_MSC int GMT_grdpmodeler (void *V_API, int mode, void *args) {
 					case PM_DLON:	/* Compute latitude where this point was formed in the model */
 					if (!spotted) {
 						lon = grd_x[col] * D2R;	lat = grd_yc[row] * D2R;
-						if (spotter_backtrack (GMT, &lon, &lat, &age, 1U, p, n_stages, 0.0, 0.0, 0, NULL, NULL) < 0)
-							Return (GMT_RUNTIME_ERROR);
+						spotter_rot_cache_rotate (GMT, RotCache, age, &lon, &lat);
 						spotted = true;
 					}
 					value = grd_x[col] - lon * R2D;
@@ -491,8 +491,7 @@ EXTERN_MSC int GMT_grdpmodeler (void *V_API, int mode, void *args) {
 				case PM_DLAT:	/* Compute latitude where this point was formed in the model */
 					if (!spotted) {
 						lon = grd_x[col] * D2R;	lat = grd_yc[row] * D2R;
-						if (spotter_backtrack (GMT, &lon, &lat, &age, 1U, p, n_stages, 0.0, 0.0, 0, NULL, NULL) < 0)
-							Return (GMT_RUNTIME_ERROR);
+						spotter_rot_cache_rotate (GMT, RotCache, age, &lon, &lat);
 						spotted = true;
 					}
 					value = grd_y[row] - gmt_lat_swap (GMT, lat * R2D, GMT_LATSWAP_O2G);	/* Convert back to geodetic */
@@ -500,8 +499,7 @@ EXTERN_MSC int GMT_grdpmodeler (void *V_API, int mode, void *args) {
 				case PM_LON:	/* Compute latitude where this point was formed in the model */
 					if (!spotted) {
 						lon = grd_x[col] * D2R;	lat = grd_yc[row] * D2R;
-						if (spotter_backtrack (GMT, &lon, &lat, &age, 1U, p, n_stages, 0.0, 0.0, 0, NULL, NULL) < 0)
-							Return (GMT_RUNTIME_ERROR);
+						spotter_rot_cache_rotate (GMT, RotCache, age, &lon, &lat);
 						spotted = true;
 					}
 					value = lon * R2D;
@@ -509,8 +507,7 @@ EXTERN_MSC int GMT_grdpmodeler (void *V_API, int mode, void *args) {
 				case PM_LAT:	/* Compute latitude where this point was formed in the model */
 					if (!spotted) {
 						lon = grd_x[col] * D2R;	lat = grd_yc[row] * D2R;
-						if (spotter_backtrack (GMT, &lon, &lat, &age, 1U, p, n_stages, 0.0, 0.0, 0, NULL, NULL) < 0)
-							Return (GMT_RUNTIME_ERROR);
+						spotter_rot_cache_rotate (GMT, RotCache, age, &lon, &lat);
 						spotted = true;
 					}
 					value = gmt_lat_swap (GMT, lat * R2D, GMT_LATSWAP_O2G);			/* Convert back to geodetic */
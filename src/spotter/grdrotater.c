@@ -577,11 +577,10 @@ EXTERN_MSC int GMT_grdrotater (void *V_API, int mode, void *args) {
 			for (rec = 0; rec < pol->segment[seg]->n_rows; rec++) {
 				Sr->data[GMT_X][rec] = S->data[GMT_X][rec];
 				Sr->data[GMT_Y][rec] = gmt_lat_swap (GMT, S->data[GMT_Y][rec], GMT_LATSWAP_G2O);	/* Convert to geocentric */
-				gmt_geo_to_cart (GMT, Sr->data[GMT_Y][rec], Sr->data[GMT_X][rec], P_original, true);	/* Convert to a Cartesian x,y,z vector; true since we have degrees */
-				gmt_matrix_vect_mult (GMT, 3U, R, P_original, P_rotated);				/* Rotate the vector */
-				gmt_cart_to_geo (GMT, &Sr->data[GMT_Y][rec], &Sr->data[GMT_X][rec], P_rotated, true);	/* Recover lon lat representation; true to get degrees */
-				Sr->data[GMT_Y][rec] = gmt_lat_swap (GMT, Sr->data[GMT_Y][rec], GMT_LATSWAP_O2G);	/* Convert back to geodetic */
 			}
+			spotter_rotate_points (GMT, R, Sr->data[GMT_X], Sr->data[GMT_Y], Sr->n_rows, true);	/* Rotate the entire segment in one batch */
+			for (rec = 0; rec < pol->segment[seg]->n_rows; rec++)
+				Sr->data[GMT_Y][rec] = gmt_lat_swap (GMT, Sr->data[GMT_Y][rec], GMT_LATSWAP_O2G);	/* Convert back to geodetic */
 			gmt_set_seg_polar (GMT, Sr);	/* Determine if it is a polar cap */
 		}
 		gmt_set_tbl_minmax (GMT, GMT_IS_POLY, polr);	/* Update table domain */
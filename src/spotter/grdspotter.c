@@ -492,7 +492,7 @@ GMT_LOCAL void grdspotter_normalize_grid (struct GMT_CTRL *GMT, struct GMT_GRID
 #define Return(code) {Free_Ctrl (GMT, Ctrl); gmt_end_module (GMT, GMT_cpy); bailout (code);}
 
 EXTERN_MSC int GMT_grdspotter (void *V_API, int mode, void *args) {
-	openmp_int row, col;
+	openmp_int row, col, sm;
 	unsigned int n_stages;	/* Number of stage rotations (poles) */
 	unsigned int try;		/* Number of current bootstrap estimate */
 	unsigned int row2, col2, k_step;
@@ -827,11 +827,11 @@ EXTERN_MSC int GMT_grdspotter (void *V_API, int mode, void *args) {
 	}
 
 	if (Ctrl->Z.mode) {	/* Do CVA calculations for each z-slice using stored flowlines */
-		unsigned int layer, nz;
+		unsigned int layer, nz, t, n_threads = 1;
 		size_t len;
-		char file[PATH_MAX] = {""}, format[PATH_MAX] = {""};
+		char file[PATH_MAX] = {""}, format[PATH_MAX] = {""}, *visited = NULL;
 		double z0, z1;
-		gmt_grdfloat *CVA_inc = NULL, *old = G->data;
+		gmt_grdfloat *CVA_inc = NULL, *CVA_tmp = NULL, *old = G->data;
 
 		GMT_Report (API, GMT_MSG_INFORMATION, "Start z-slice CVA calculations\n");
 		for (len = strlen (Ctrl->G.file); len > 0 && Ctrl->G.file[len] != '.'; len--);
@@ -841,27 +841,48 @@ EXTERN_MSC int GMT_grdspotter (void *V_API, int mode, void *args) {
 			strncat (format, &Ctrl->G.file[len], PATH_MAX-1);	/* Should add the extension from said file */
 		}
 		CVA_inc = gmt_M_memory (GMT, NULL, G->header->size, gmt_grdfloat);
+#ifdef _OPENMP
+		n_threads = omp_get_max_threads ();
+#endif
+		/* The flowlines are independent so each thread accumulates into its own grid layer and
+		 * visited-node array; the layers are then summed into CVA_inc after each parallel pass */
+		CVA_tmp = gmt_M_memory (GMT, NULL, (size_t)n_threads * G->header->size, gmt_grdfloat);
+		visited = gmt_M_memory (GMT, NULL, (size_t)n_threads * G->header->size, char);
 		nz = urint ((Ctrl->Z.max - Ctrl->Z.min) / Ctrl->Z.inc);
 		for (layer = 0; layer < nz; layer++) {
 			z0 = Ctrl->Z.min + layer * Ctrl->Z.inc;
 			z1 = z0 + Ctrl->Z.inc;
 			GMT_Report (API, GMT_MSG_INFORMATION, "Start z-slice %g - %g\n", z0, z1);
-			gmt_M_memset (CVA_inc, G->header->size, gmt_grdfloat);	/* Fresh start for this z-slice */
-			for (m = 0; m < n_nodes; m++) {				/* Loop over all active flowlines */
-				ij = flowline[m].ij;
-				if (Z->data[ij] <= z0 || Z->data[ij] > z1) continue;	/* z outside current slice */
-				row = (unsigned int)gmt_M_row (Z->header, ij);
-				cva_contribution = lat_area[row] * (Ctrl->T.active[UPPER] ? Ctrl->T.t_fix : Z->data[ij]);	/* This node's contribution to the convolution */
-				gmt_M_memset (processed_node, G->header->size, char);		/* Fresh start for this flowline convolution */
-				for (k = 0; k < flowline[m].n; k++) {			/* For each point along this flowline */
-					node = flowline[m].node[k];
-					if (node != UINTMAX_MAX && !processed_node[node]) {	/* Have not added to the CVA at this node yet */
-						CVA_inc[node] += (gmt_grdfloat)cva_contribution;
-						processed_node[node] = true;		/* Now we have visited this node */
+			gmt_M_memset (CVA_tmp, (size_t)n_threads * G->header->size, gmt_grdfloat);	/* Fresh start for this z-slice */
+#ifdef _OPENMP
+#pragma omp parallel for private(sm) shared(GMT,Ctrl,G,Z,flowline,lat_area,n_nodes,CVA_tmp,visited,z0,z1)
+#endif
+			for (sm = 0; sm < (openmp_int)n_nodes; sm++) {		/* Loop over all active flowlines */
+				uint64_t kk, nij, this_node;
+				openmp_int zrow;
+				double contribution;
+				gmt_grdfloat *my_cva = CVA_tmp;
+				char *my_visited = visited;
+#ifdef _OPENMP
+				my_cva = &CVA_tmp[(size_t)omp_get_thread_num () * G->header->size];
+				my_visited = &visited[(size_t)omp_get_thread_num () * G->header->size];
+#endif
+				nij = flowline[sm].ij;
+				if (Z->data[nij] <= z0 || Z->data[nij] > z1) continue;	/* z outside current slice */
+				zrow = (openmp_int)gmt_M_row (Z->header, nij);
+				contribution = lat_area[zrow] * (Ctrl->T.active[UPPER] ? Ctrl->T.t_fix : Z->data[nij]);	/* This node's contribution to the convolution */
+				gmt_M_memset (my_visited, G->header->size, char);		/* Fresh start for this flowline convolution */
+				for (kk = 0; kk < flowline[sm].n; kk++) {			/* For each point along this flowline */
+					this_node = flowline[sm].node[kk];
+					if (this_node != UINTMAX_MAX && !my_visited[this_node]) {	/* Have not added to the CVA at this node yet */
+						my_cva[this_node] += (gmt_grdfloat)contribution;
+						my_visited[this_node] = true;		/* Now we have visited this node */
 					}
 				}
-				if (!(m%10000)) GMT_Report (API, GMT_MSG_INFORMATION, "Processed %5ld flowlines\r", m);
 			}
+			gmt_M_memset (CVA_inc, G->header->size, gmt_grdfloat);	/* Merge the per-thread layers into the final z-slice grid */
+			for (t = 0; t < n_threads; t++)
+				for (node = 0; node < G->header->size; node++) CVA_inc[node] += CVA_tmp[(size_t)t * G->header->size + node];
 			GMT_Report (API, GMT_MSG_INFORMATION, "Processed %5" PRIu64 " flowlines\n", n_nodes);
 
 			/* Time to write out this z-slice grid */
@@ -875,17 +896,19 @@ EXTERN_MSC int GMT_grdspotter (void *V_API, int mode, void *args) {
 			GMT_Report (API, GMT_MSG_INFORMATION, "Save z-slice CVA to file %s\n", file);
 			if (GMT_Set_Comment (API, GMT_IS_GRID, GMT_COMMENT_IS_OPTION | GMT_COMMENT_IS_COMMAND, options, G)) {
 				error = API->error;
-				gmt_M_free (GMT, CVA_inc);
+				gmt_M_free (GMT, CVA_inc);	gmt_M_free (GMT, CVA_tmp);	gmt_M_free (GMT, visited);
 				goto END;
 			}
 			if (GMT_Write_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_CONTAINER_AND_DATA, NULL, file, G) != GMT_NOERROR) {
 				error = API->error;
-				gmt_M_free (GMT, CVA_inc);
+				gmt_M_free (GMT, CVA_inc);	gmt_M_free (GMT, CVA_tmp);	gmt_M_free (GMT, visited);
 				goto END;
 			}
 		}
 		G->data = old;	/* Reset the array pointer */
 		gmt_M_free (GMT, CVA_inc);
+		gmt_M_free (GMT, CVA_tmp);
+		gmt_M_free (GMT, visited);
 	}
 
 	if (Ctrl->D.active || Ctrl->PA.active) {	/* Must determine max CVA along each flowline */
@@ -904,18 +927,23 @@ EXTERN_MSC int GMT_grdspotter (void *V_API, int mode, void *args) {
 		GMT_Report (API, GMT_MSG_INFORMATION, "Compute DI and/or PA grids\n");
 
 		if (keep_flowlines) {
-			for (m = 0; m < n_nodes; m++) {	/* Loop over all active flowlines */
+			/* Each flowline only reads the shared CVA grid and writes to its own originating
+			 * node in the DI/PA grids so the flowlines can be scanned in parallel */
+#ifdef _OPENMP
+#pragma omp parallel for private(sm,k,node,CVA_max,pa) shared(GMT,Ctrl,G,DI,PA,flowline,n_nodes)
+#endif
+			for (sm = 0; sm < (openmp_int)n_nodes; sm++) {	/* Loop over all active flowlines */
 				CVA_max = 0.0;						/* Fresh start for this flowline convolution */
-				for (k = 0; k < flowline[m].n; k++) {			/* For each point along this flowline */
-					node = flowline[m].node[k];
+				pa = 0;
+				for (k = 0; k < flowline[sm].n; k++) {			/* For each point along this flowline */
+					node = flowline[sm].node[k];
 					if (node != UINTMAX_MAX && G->data[node] > CVA_max) {	/* Found a higher CVA value */
 						CVA_max = G->data[node];
-						if (Ctrl->PA.active) pa = flowline[m].PA[k];	/* Keep the estimate of age at highest CVA */
+						if (Ctrl->PA.active) pa = flowline[sm].PA[k];	/* Keep the estimate of age at highest CVA */
 					}
 				}
-				if (Ctrl->D.active) DI->data[flowline[m].ij] = (gmt_grdfloat)CVA_max;	/* Store the maximum CVA associated with this node's flowline */
-				if (Ctrl->PA.active) PA->data[flowline[m].ij] = (gmt_grdfloat) (pa * PA_2_T);
-				if (!(m%10000)) GMT_Report (API, GMT_MSG_INFORMATION, "Processed %5ld flowlines\r", m);
+				if (Ctrl->D.active) DI->data[flowline[sm].ij] = (gmt_grdfloat)CVA_max;	/* Store the maximum CVA associated with this node's flowline */
+				if (Ctrl->PA.active) PA->data[flowline[sm].ij] = (gmt_grdfloat) (pa * PA_2_T);
 			}
 			GMT_Report (API, GMT_MSG_INFORMATION, "Processed %5" PRIu64 " flowlines\n", n_nodes);
 		}
@@ -539,17 +539,29 @@ EXTERN_MSC int GMT_polespotter (void *V_API, int mode, void *args) {
 		gmt_M_free (GMT, Out);
 	}
 	else {	/* SPOTTER_SCAN_POLES */
-		double *plon = NULL, *plat = NULL, sum_L = 0.0, del_angle, chi2;
+		uint64_t ns, n_segs = 0;
+		double *plon = NULL, *plat = NULL, *seg_wt = NULL, sum_L = 0.0, del_angle, chi2;
 
-		/* Now visit all our segments to convert to geocentric and to get sum of weights once */
+		/* Now visit all our segments to convert to geocentric and to get sum of weights once.
+		 * We also store each segment's weight so the pole scan below does not have to re-parse
+		 * segment headers for every trial pole. */
 
 		GMT_Report (API, GMT_MSG_INFORMATION, "Entering scan mode: poles\n");
-		for (d = POLESPOTTER_AH; d <= POLESPOTTER_FZ; d++) {
+		for (d = POLESPOTTER_AH; d <= POLESPOTTER_FZ; d++) {	/* Count segments so we can allocate the weight array */
+			if (In[d] == NULL) continue;	/* Don't have this data set */
+			for (tbl = 0; tbl < In[d]->n_tables; tbl++) n_segs += In[d]->table[tbl]->n_segments;
+		}
+		seg_wt = gmt_M_memory (GMT, NULL, n_segs, double);
+		for (d = POLESPOTTER_AH, ns = 0; d <= POLESPOTTER_FZ; d++) {
 			if (In[d] == NULL) continue;	/* Don't have this data set */
 			weight = (d == POLESPOTTER_AH) ? Ctrl->A.weight : Ctrl->F.weight;
 			for (tbl = 0; tbl < In[d]->n_tables; tbl++) {
 				for (seg = 0; seg < In[d]->table[tbl]->n_segments; seg++) {	/* For each segment in the table */
 					S = In[d]->table[tbl]->segment[seg];	/* Set shortcut to current segment */
+					if (gmt_parse_segment_item (GMT, S->header, "-D", header))	/* Found -D<val> */
+						seg_wt[ns++] = 1.0 / atof (header);
+					else
+						seg_wt[ns++] = weight;	/* Already 1/sigma, actually */
 					/* Convert the entire segment to geocentric latitude as we go through */
 					S->data[GMT_Y][0] = gmt_lat_swap (GMT, S->data[GMT_Y][0], GMT_LATSWAP_G2O);
 					gmt_geo_to_cart (GMT, S->data[GMT_Y][0], S->data[GMT_X][0], P1, true);	/* get x/y/z of first point P1 */
@@ -563,26 +575,27 @@ EXTERN_MSC int GMT_polespotter (void *V_API, int mode, void *args) {
 				}
 			}
 		}
-		/* Now we know sum_L which we will divide our grid by at the end */
+		/* Now we know sum_L which we will divide our grid by at the end.  Each trial pole only
+		 * reads the (now geocentric) segments and writes its own grid node so the rows of the
+		 * pole grid can be evaluated in parallel. */
 
 		plon = gmt_grd_coord (GMT, Grid->header, GMT_X);
 		plat = gmt_grd_coord (GMT, Grid->header, GMT_Y);
+#ifdef _OPENMP
+#pragma omp parallel for private(grow,gcol,node,d,tbl,seg,row,ns,X,P1,P2,L,del_angle,chi2,seg_weight,S) shared(GMT,Grid,In,plon,plat,seg_wt)
+#endif
 		for (grow = 0; grow < (openmp_int)Grid->header->n_rows; grow++) {	/* Try all possible pole latitudes in selected region */
 			plat[grow] = gmt_lat_swap (GMT, plat[grow], GMT_LATSWAP_G2O);	/* Convert latitude to geodetic */
 			for (gcol = 0; gcol < (openmp_int)Grid->header->n_columns; gcol++) {	/* Try all possible pole longitudes in selected region */
 				node = gmt_M_ijp (Grid->header, grow, gcol);		/* Current grid node */
 				gmt_geo_to_cart (GMT, plat[grow], plon[gcol], X, true);	/* Get x/y/z of current pole X */
 				/* Now visit all our segments */
-				for (d = POLESPOTTER_AH; d <= POLESPOTTER_FZ; d++) {
+				for (d = POLESPOTTER_AH, ns = 0; d <= POLESPOTTER_FZ; d++) {
 					if (In[d] == NULL) continue;	/* Don't have this data set */
-					weight = (d == POLESPOTTER_AH) ? Ctrl->A.weight : Ctrl->F.weight;
 					for (tbl = 0; tbl < In[d]->n_tables; tbl++) {
 						for (seg = 0; seg < In[d]->table[tbl]->n_segments; seg++) {	/* For each segment in the table */
 							S = In[d]->table[tbl]->segment[seg];	/* Set shortcut to current segment */
-							if (gmt_parse_segment_item (GMT, S->header, "-D", header))	/* Found -D<val> */
-								seg_weight = 1.0 / atof (header);
-							else
-								seg_weight = weight;	/* Already 1/sigma, actually */
+							seg_weight = seg_wt[ns++];	/* 1/sigma for this segment, precomputed above */
 							/* Reminder, latitudes in segments are now geocentric latitudes */
 							gmt_geo_to_cart (GMT, S->data[GMT_Y][0], S->data[GMT_X][0], P1, true);	/* Get x/y/z of first point P1 */
 							for (row = 1; row < S->n_rows; row++) {
@@ -600,6 +613,7 @@ EXTERN_MSC int GMT_polespotter (void *V_API, int mode, void *args) {
 		}
 		gmt_M_free (GMT, plon);
 		gmt_M_free (GMT, plat);
+		gmt_M_free (GMT, seg_wt);
 
 		for (node = 0; node < Grid->header->size; node++) Grid->data[node] /= (gmt_grdfloat)sum_L;	/* Correct for weight sum */
 	}
@@ -1395,6 +1395,123 @@ void spotter_get_rotation (struct GMT_CTRL *GMT, struct EULER *p, unsigned int n
 	spotter_matrix_to_pole (GMT, X, lon, lat, w);					/* Convert to rotation parameters lon, lat, w */
 }
 
+GMT_LOCAL void spotter_compose_rotation (struct GMT_CTRL *GMT, struct EULER p[], unsigned int ns, double t, double t_zero, int way, double R[3][3]) {
+	/* Compose the total rotation matrix that takes a point of age t to its position at time
+	 * t_zero (way == SPOTTER_BACK) or from t_zero forward to age t (way == SPOTTER_FWD).
+	 * The stage walk mirrors spotter_backtrack and spotter_forthtrack exactly; each (partial)
+	 * stage rotation is applied by left-multiplying its matrix onto the running product. */
+	unsigned int stage;
+	double dt, w, Rs[3][3], X[3][3];
+
+	gmt_M_memset (R, 9, double);
+	R[0][0] = R[1][1] = R[2][2] = 1.0;	/* Start with the identity matrix */
+	if (p[ns-1].t_stop > t_zero) t_zero = p[ns-1].t_stop;	/* In case we don't go all the way to zero */
+	if (way == SPOTTER_BACK) {	/* Walk from age t back towards t_zero [see spotter_backtrack] */
+		while (t > t_zero) {
+			stage = 0;
+			while (stage < ns && t <= p[stage].t_stop) stage++;	/* Find first applicable stage pole */
+			if (stage == ns) return;	/* Ran out of stage poles; caller has vetted the time range */
+			dt = MIN (p[stage].duration, t - MAX (p[stage].t_stop, t_zero));
+			w = p[stage].omega * dt;	/* Opening angle (degrees) for this (partial) stage */
+			gmt_make_rot_matrix (GMT, p[stage].lon, p[stage].lat, w, Rs);
+			spotter_matrix_mult (GMT, Rs, R, X);	/* Apply this stage after the previous ones */
+			gmt_M_memcpy (R, X, 9, double);
+			t -= dt;
+		}
+	}
+	else {	/* Walk forward in time from t_zero up to age t [see spotter_forthtrack] */
+		double tx = t_zero;
+		while (tx < t) {
+			stage = ns - 1;
+			while (stage && (tx + GMT_CONV8_LIMIT) > p[stage].t_start) stage--;
+			dt = MIN (t, p[stage].t_start) - tx;	/* Time interval to rotate */
+			w = -p[stage].omega * dt;	/* Forward tracking rotates the opposite way */
+			gmt_make_rot_matrix (GMT, p[stage].lon, p[stage].lat, w, Rs);
+			spotter_matrix_mult (GMT, Rs, R, X);	/* Apply this stage after the previous ones */
+			gmt_M_memcpy (R, X, 9, double);
+			tx += dt;
+		}
+	}
+}
+
+struct SPOTTER_ROT_CACHE *spotter_rot_cache_init (struct GMT_CTRL *GMT, struct EULER *p, unsigned int ns, int way, double t_zero) {
+	/* Set up an empty memoized time -> composed rotation matrix table for these stage poles.
+	 * Modules that reconstruct very many points (e.g., every node of an age grid) tend to ask
+	 * for the same times over and over; composing the stage-pole chain once per distinct time
+	 * and reusing the matrix turns each subsequent point into a single 3x3 multiply. */
+	struct SPOTTER_ROT_CACHE *Cache = gmt_M_memory (GMT, NULL, 1, struct SPOTTER_ROT_CACHE);
+
+	Cache->p = p;	Cache->ns = ns;	Cache->way = way;	Cache->t_zero = t_zero;
+	Cache->n_alloc = GMT_CHUNK;
+	Cache->t = gmt_M_memory (GMT, NULL, Cache->n_alloc, double);
+	Cache->R = gmt_M_memory (GMT, NULL, 9 * Cache->n_alloc, double);
+	return (Cache);
+}
+
+void spotter_rot_cache_matrix (struct GMT_CTRL *GMT, struct SPOTTER_ROT_CACHE *Cache, double t, double R[3][3]) {
+	/* Return the composed rotation matrix for time t, composing and memoizing it on first use */
+	uint64_t lo = 0, hi = Cache->n, mid;
+
+	while (lo < hi) {	/* Binary search for the first table entry >= t */
+		mid = lo + (hi - lo) / 2;
+		if (Cache->t[mid] < t) lo = mid + 1;
+		else hi = mid;
+	}
+	if (lo < Cache->n && Cache->t[lo] == t) {	/* Composed this one before */
+		gmt_M_memcpy (R, &Cache->R[9*lo], 9, double);
+		return;
+	}
+	spotter_compose_rotation (GMT, Cache->p, Cache->ns, t, Cache->t_zero, Cache->way, R);
+	if (Cache->n == BIG_CHUNK) return;	/* Table is full; just hand back the matrix */
+	if (Cache->n == Cache->n_alloc) {	/* Extend the table */
+		Cache->n_alloc <<= 1;
+		Cache->t = gmt_M_memory (GMT, Cache->t, Cache->n_alloc, double);
+		Cache->R = gmt_M_memory (GMT, Cache->R, 9 * Cache->n_alloc, double);
+	}
+	if (lo < Cache->n) {	/* Keep the table sorted on time */
+		memmove (&Cache->t[lo+1], &Cache->t[lo], (Cache->n - lo) * sizeof (double));
+		memmove (&Cache->R[9*(lo+1)], &Cache->R[9*lo], 9 * (Cache->n - lo) * sizeof (double));
+	}
+	Cache->t[lo] = t;
+	gmt_M_memcpy (&Cache->R[9*lo], R, 9, double);
+	Cache->n++;
+}
+
+void spotter_rot_cache_rotate (struct GMT_CTRL *GMT, struct SPOTTER_ROT_CACHE *Cache, double t, double *lon, double *lat) {
+	/* Rotate a single point (lon, lat in RADIANS, as in spotter_backtrack) to its position at time t */
+	double R[3][3], X[3], Y[3];
+
+	spotter_rot_cache_matrix (GMT, Cache, t, R);
+	gmt_geo_to_cart (GMT, *lat, *lon, X, false);	/* Convert to a Cartesian x,y,z vector */
+	gmt_matrix_vect_mult (GMT, 3U, R, X, Y);	/* Rotate the vector */
+	gmt_cart_to_geo (GMT, lat, lon, Y, false);	/* Recover lon, lat representation */
+	if (*lon < 0.0) *lon += TWO_PI;		/* Keep longitudes in 0-360 range as the stage walks do */
+	if (*lon >= TWO_PI) *lon -= TWO_PI;
+}
+
+void spotter_rot_cache_free (struct GMT_CTRL *GMT, struct SPOTTER_ROT_CACHE **Cache) {
+	/* Free a rotation cache [note the stage poles are owned by the caller] */
+	if (*Cache == NULL) return;
+	gmt_M_free (GMT, (*Cache)->t);
+	gmt_M_free (GMT, (*Cache)->R);
+	gmt_M_free (GMT, *Cache);
+}
+
+void spotter_rotate_points (struct GMT_CTRL *GMT, double R[3][3], double *lon, double *lat, uint64_t n, bool degrees) {
+	/* Rotate arrays of points in place through the rotation matrix R.  Each point is
+	 * independent so we let OpenMP spread the matrix multiplies over the cores. */
+	int64_t k;	/* Must be signed due to OpenMP */
+#ifdef _OPENMP
+#pragma omp parallel for private(k) shared(GMT,R,lon,lat,n,degrees)
+#endif
+	for (k = 0; k < (int64_t)n; k++) {
+		double X[3], Y[3];
+		gmt_geo_to_cart (GMT, lat[k], lon[k], X, degrees);	/* Convert to a Cartesian x,y,z vector */
+		gmt_matrix_vect_mult (GMT, 3U, R, X, Y);		/* Rotate the vector */
+		gmt_cart_to_geo (GMT, &lat[k], &lon[k], Y, degrees);	/* Recover lon, lat representation */
+	}
+}
+
 bool spotter_conf_ellipse (struct GMT_CTRL *GMT, double lon, double lat, double t, struct EULER *p, unsigned int np, char flag, bool forward, double out[]) {
 	/* Given time and rotation parameters, calculate uncertainty in the
 	 * reconstructed point in the form of a confidence ellipse.  To follow
@@ -41,6 +41,9 @@
 
 #define SPOTTER_E_OPT "-E<rottable>|<ID1>-<ID2>|<plon>/<plat>/<prot>[+i]"
 
+#define SPOTTER_BACK -1		/* Rotate points back in time */
+#define SPOTTER_FWD  +1		/* Rotate points forward in time */
+
 /*! Structure with info on each Euler (stage) pole */
 struct EULER {
 	double lon, lat;		/* Location of Euler pole in degrees */
@@ -80,6 +83,17 @@ struct HOTSPOT {
         double x, y, z;			/* Cartesian Current location of hot spot */
 };
 
+/*! Memoized time -> composed rotation matrix table for one loaded set of stage poles */
+struct SPOTTER_ROT_CACHE {
+	struct EULER *p;	/* The stage poles we compose from [not owned by the cache] */
+	unsigned int ns;	/* Number of stage poles */
+	int way;		/* SPOTTER_BACK or SPOTTER_FWD */
+	double t_zero;		/* Rotate between each requested time and this time */
+	uint64_t n, n_alloc;	/* Current and allocated table sizes */
+	double *t;		/* Sorted array of memoized times */
+	double *R;		/* Matching composed rotation matrices, 9 doubles each */
+};
+
 struct SPOTTER_ROT {	/* Holds -E information */
 	bool single;		/* True if given a single finite rotation */
 	bool invert;		/* True if we should invert the rotation(s) */
@@ -111,6 +125,11 @@ EXTERN_MSC void spotter_covar_to_record (struct GMT_CTRL *GMT, struct EULER *e,
 EXTERN_MSC void spotter_cov_of_inverse (struct GMT_CTRL *GMT, struct EULER *e, double Ct[3][3]);
 EXTERN_MSC void spotter_get_rotation (struct GMT_CTRL *GMT, struct EULER *p, unsigned int np, double t, double *lon, double *lat, double *w);
 EXTERN_MSC void spotter_matrix_to_pole (struct GMT_CTRL *GMT, double T[3][3], double *plon, double *plat, double *w);
+EXTERN_MSC struct SPOTTER_ROT_CACHE *spotter_rot_cache_init (struct GMT_CTRL *GMT, struct EULER *p, unsigned int ns, int way, double t_zero);
+EXTERN_MSC void spotter_rot_cache_matrix (struct GMT_CTRL *GMT, struct SPOTTER_ROT_CACHE *Cache, double t, double R[3][3]);
+EXTERN_MSC void spotter_rot_cache_rotate (struct GMT_CTRL *GMT, struct SPOTTER_ROT_CACHE *Cache, double t, double *lon, double *lat);
+EXTERN_MSC void spotter_rot_cache_free (struct GMT_CTRL *GMT, struct SPOTTER_ROT_CACHE **Cache);
+EXTERN_MSC void spotter_rotate_points (struct GMT_CTRL *GMT, double R[3][3], double *lon, double *lat, uint64_t n, bool degrees);
 EXTERN_MSC void spotter_matrix_1Dto2D (struct GMT_CTRL *GMT, double *M, double X[3][3]);
 EXTERN_MSC void spotter_matrix_2Dto1D (struct GMT_CTRL *GMT, double *M, double X[3][3]);
 EXTERN_MSC void spotter_inv_cov (struct GMT_CTRL *GMT, double Ci[3][3], double C[3][3]);
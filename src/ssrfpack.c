@@ -157,8 +157,8 @@ GMT_LOCAL doublereal arclen_(doublereal *p, doublereal *q) {
     double atan(doublereal), sqrt(doublereal);
 
     /* Local variables */
-    static doublereal d__;
-    static integer i__;
+    doublereal d__;
+    integer i__;
 
 
 /* *********************************************************** */
@@ -238,7 +238,7 @@ GMT_LOCAL integer snhcsh_(doublereal *x, doublereal *sinhm, doublereal *coshm, d
     double exp(doublereal);
 
     /* Local variables */
-    static doublereal f, ax, xc, xs, xsd2, xsd4, expx;
+    doublereal f, ax, xc, xs, xsd2, xsd4, expx;
 
 
 /* *********************************************************** */
@@ -315,9 +315,9 @@ GMT_LOCAL integer arcint_(doublereal *p, doublereal *p1, doublereal *p2, doubler
     double sqrt(doublereal), exp(doublereal);
 
     /* Local variables */
-    static doublereal a, e;
-    static integer i__;
-    static doublereal s, b1, b2, d1, d2, e1, e2, al, cm, gt, sm, tm, un[3],
+    doublereal a, e;
+    integer i__;
+    doublereal s, b1, b2, d1, d2, e1, e2, al, cm, gt, sm, tm, un[3],
 	    ts, cm2, sb1, sb2, sm2, tm1, tm2, tp1, tp2, cmm, sig, ems, tau1,
 	    tau2, sinh__, sinh2, dummy, unorm;
 
@@ -607,7 +607,7 @@ GMT_LOCAL doublereal hval_(doublereal *b, doublereal *h1, doublereal *h2, double
     double exp(doublereal);
 
     /* Local variables */
-    static doublereal e, s, b1, b2, d1, d2, e1, e2, cm, sm, tm, ts, cm2, sb1,
+    doublereal e, s, b1, b2, d1, d2, e1, e2, cm, sm, tm, ts, cm2, sb1,
 	    sb2, sm2, tm1, tm2, cmm, sig, ems, dummy;
 
 
@@ -717,9 +717,9 @@ GMT_LOCAL doublereal fval_(doublereal *b1, doublereal *b2, doublereal *b3, doubl
     double sqrt(doublereal);
 
     /* Local variables */
-    static doublereal f, g[3];
-    static integer i__;
-    static doublereal c1, c2, c3, q1[3], q2[3], q3[3], s1, s2, s3, u1[3], u2[
+    doublereal f, g[3];
+    integer i__;
+    doublereal c1, c2, c3, q1[3], q2[3], q3[3], s1, s2, s3, u1[3], u2[
 	    3], u3[3], ds, dv, u1n, u2n, u3n, sig, val, dum, sum;
 
 
@@ -2771,12 +2771,12 @@ GMT_LOCAL integer intrc0_(integer *n, doublereal *plat, doublereal *plon, double
     double cos(doublereal), sin(doublereal);
 
     /* Local variables */
-    static doublereal p[3], b1, b2, b3;
-    static integer i1, i2, i3, n1, n2;
-    static doublereal s12;
-    static integer lp;
-    static doublereal cos_plat;
-    static doublereal sum, ptn1, ptn2;
+    doublereal p[3], b1, b2, b3;
+    integer i1, i2, i3, n1, n2;
+    doublereal s12;
+    integer lp;
+    doublereal cos_plat;
+    doublereal sum, ptn1, ptn2;
 
 
 /* *********************************************************** */
@@ -3027,18 +3027,18 @@ GMT_LOCAL integer intrc1_(integer *n, doublereal *plat, doublereal *plon, double
     double cos(doublereal), sin(doublereal), sqrt(doublereal);
 
     /* Local variables */
-    static doublereal a;
-    static integer i__;
-    static doublereal p[3], q[3], b1, b2, b3, g1[3], g2[3];
-    static integer i1, i2, i3;
-    static doublereal g3[3];
-    static integer n1, n2;
-    static doublereal p1[3], p2[3], p3[3], s1, s2, s3, fq, gq[3], s12;
-    static integer lp, nn;
-    static doublereal dum[3], gqn, sum, ptn1, ptn2;
-    static integer ierr;
-    static doublereal ptgq;
-    static doublereal qnorm;
+    doublereal a;
+    integer i__;
+    doublereal p[3], q[3], b1, b2, b3, g1[3], g2[3];
+    integer i1, i2, i3;
+    doublereal g3[3];
+    integer n1, n2;
+    doublereal p1[3], p2[3], p3[3], s1, s2, s3, fq, gq[3], s12;
+    integer lp, nn;
+    doublereal dum[3], gqn, sum, ptn1, ptn2;
+    integer ierr;
+    doublereal ptgq;
+    doublereal qnorm;
 
 
 /* *********************************************************** */
@@ -4188,216 +4188,3 @@ L5:
     g0 = g;
     goto L3;
 } /* smsurf_ */
-
-GMT_LOCAL integer unif_(integer *n, doublereal *x, doublereal *y, doublereal *z__, doublereal *f, integer *list, integer *lptr, integer *lend, integer *iflgs, doublereal *sigma, integer *nrow, integer *ni, integer *nj, doublereal *plat, doublereal *plon, integer *iflgg, doublereal *grad, doublereal *ff, integer *ier) {
-    /* Initialized data */
-
-    static integer nst = 1;
-
-    /* System generated locals */
-    integer ff_dim1, ff_offset, i__1, i__2;
-
-    /* Local variables */
-    static integer i__, j, nn, nx, ny, ifl, nex, ist, ierr;
-
-
-/* *********************************************************** */
-
-/*                                              From SSRFPACK */
-/*                                            Robert J. Renka */
-/*                                  Dept. of Computer Science */
-/*                                       Univ. of North Texas */
-/*                                           renka@cs.unt.edu */
-/*                                                   07/25/96 */
-
-/*   Given a Delaunay triangulation of a set of nodes on the */
-/* unit sphere, along with data values and tension factors */
-/* associated with the triangulation arcs, this routine */
-/* interpolates the data values to a uniform grid for such */
-/* applications as contouring.  The interpolant is once con- */
-/* tinuously differentiable.  Extrapolation is performed at */
-/* grid points exterior to the triangulation when the nodes */
-/* do not cover the entire sphere. */
-
-/* On input: */
-
-/*       N = Number of nodes.  N .GE. 3 and N .GE. 7 if */
-/*           IFLAG .NE. 1. */
-
-/*       X,Y,Z = Arrays containing Cartesian coordinates of */
-/*               the nodes.  X(I)**2 + Y(I)**2 + Z(I)**2 = 1 */
-/*               for I = 1 to N. */
-
-/*       F = Array containing data values.  F(I) is associ- */
-/*           ated with (X(I),Y(I),Z(I)). */
-
-/*       LIST,LPTR,LEND = Data structure defining the trian- */
-/*                        gulation.  Refer to STRIPACK */
-/*                        Subroutine TRMESH. */
-
-/*       IFLGS = Tension factor option: */
-/*               IFLGS .LE. 0 if a single uniform tension */
-/*                            factor is to be used. */
-/*               IFLGS .GE. 1 if variable tension is desired. */
-
-/*       SIGMA = Uniform tension factor (IFLGS .LE. 0), or */
-/*               array containing tension factors associated */
-/*               with arcs in one-to-one correspondence with */
-/*               LIST entries (IFLGS .GE. 1).  Refer to Sub- */
-/*               programs GETSIG, SIG0, SIG1, and SIG2. */
-
-/*       NROW = Number of rows in the dimension statement of */
-/*              FF. */
-
-/*       NI,NJ = Number of rows and columns in the uniform */
-/*               grid.  1 .LE. NI .LE. NROW and 1 .LE. NJ. */
-
-/*       PLAT,PLON = Arrays of length NI and NJ, respective- */
-/*                   ly, containing the latitudes and */
-/*                   longitudes of the grid lines. */
-
-/*       IFLGG = Option indicator: */
-/*               IFLGG = 0 if gradient estimates at the ver- */
-/*                         tices of a triangle are to be */
-/*                         recomputed for each grid point in */
-/*                         the triangle and not saved. */
-/*               IFLGG = 1 if gradient estimates are input in */
-/*                         GRAD. */
-/*               IFLGG = 2 if gradient estimates are to be */
-/*                         computed once for each node (by */
-/*                         GRADL) and saved in GRAD. */
-
-/* The above parameters are not altered by this routine. */
-
-/*       GRAD = 3 by N array whose columns contain the X, Y, */
-/*              and Z components (in that order) of the grad- */
-/*              ients at the nodes if IFLGG = 1, array of */
-/*              sufficient size if IFLGG = 2, or dummy para- */
-/*              meter if IFLGG = 0. */
-
-/* Gradient estimates may be computed by Subroutines GRADL or */
-/*   GRADG if IFLGG = 1. */
-
-/*       FF = NROW by NCOL array with NROW .GE. NI and NCOL */
-/*            .GE. NJ. */
-
-/* On output: */
-
-/*       GRAD = Array containing estimated gradients as de- */
-/*              fined above if IFLGG = 2 and IER .GE. 0. */
-/*              GRAD is not altered if IFLGG .NE. 2. */
-
-/*       FF = Interpolated values at the grid points if IER */
-/*            .GE. 0.  FF(I,J) = F(PLAT(I),PLON(J)) for I = */
-/*            1,...,NI and J = 1,...,NJ. */
-
-/*       IER = Error indicator: */
-/*             IER = K if no errors were encountered and K */
-/*                     grid points required extrapolation for */
-/*                     K .GE. 0. */
-/*             IER = -1 if N, NI, NJ, or IFLGG is outside its */
-/*                      valid range. */
-/*             IER = -2 if the nodes are collinear. */
-/*             IER = -3 if extrapolation failed due to the */
-/*                      uniform grid extending too far beyond */
-/*                      the triangulation boundary. */
-
-/* STRIPACK modules required by UNIF:  GETNP, JRAND, LSTPTR, */
-/*                                       STORE, TRFIND */
-
-/* SSRFPACK modules required by UNIF:  APLYR, APLYRT, ARCINT, */
-/*                                       ARCLEN, CONSTR, */
-/*                                       FVAL, GIVENS, GRADL, */
-/*                                       HVAL, INTRC1, */
-/*                                       ROTATE, SETUP, */
-/*                                       SNHCSH */
-
-/* *********************************************************** */
-
-    /* Parameter adjustments */
-    grad -= 4;
-    --lend;
-    --f;
-    --z__;
-    --y;
-    --x;
-    --list;
-    --lptr;
-    --sigma;
-    --plat;
-    ff_dim1 = *nrow;
-    ff_offset = 1 + ff_dim1;
-    ff -= ff_offset;
-    --plon;
-
-    /* Function Body */
-
-/* Local parameters: */
-
-/* I,J =   DO-loop indexes */
-/* IERR =  Error flag for calls to GRADL and INTRC1 */
-/* IFL =   Local copy of IFLGG */
-/* IST =   Parameter for INTRC1 */
-/* NEX =   Number of grid points exterior to the triangula- */
-/*           tion boundary (number of extrapolated values) */
-/* NN =    Local copy of N */
-/* NST =   Initial value for IST */
-/* NX,NY = Local copies of NI and NJ */
-
-    nn = *n;
-    nx = *ni;
-    ny = *nj;
-    ifl = *iflgg;
-    if (nx < 1 || nx > *nrow || ny < 1 || ifl < 0 || ifl > 2) {
-	goto L4;
-    }
-    ist = nst;
-    if (ifl == 2) {
-
-/* Compute gradient estimates at the nodes. */
-
-	i__1 = nn;
-	for (i__ = 1; i__ <= i__1; ++i__) {
-	    gradl_(&nn, &i__, &x[1], &y[1], &z__[1], &f[1], &list[1], &lptr[1]
-		    , &lend[1], &grad[i__ * 3 + 1], &ierr);
-	    if (ierr < 0) {
-		goto L5;
-	    }
-/* L1: */
-	}
-	ifl = 1;
-    }
-
-/* Compute uniform grid points and interpolated values. */
-
-    nex = 0;
-    i__1 = ny;
-    for (j = 1; j <= i__1; ++j) {
-	i__2 = nx;
-	for (i__ = 1; i__ <= i__2; ++i__) {
-	    intrc1_(&nn, &plat[i__], &plon[j], &x[1], &y[1], &z__[1], &f[1], &
-		    list[1], &lptr[1], &lend[1], iflgs, &sigma[1], &ifl, &
-		    grad[4], &ist, &ff[i__ + j * ff_dim1], &ierr);
-	    if (ierr < 0) {
-		goto L5;
-	    }
-	    nex += ierr;
-/* L2: */
-	}
-/* L3: */
-    }
-    *ier = nex;
-    return 0;
-
-/* NI, NJ, or IFLGG is outside its valid range. */
-
-L4:
-    *ier = -1;
-    return 0;
-
-/* Error in GRADL or INTRC1. */
-
-L5:
-    *ier = ierr;
-    return 0;
-} /* unif_ */
@@ -5,17 +5,9 @@
  * All these functions are local (static) and included into gmt_sph.c where they are used.
  */
 
-/* Common Block Declarations */
-
-static struct {
-    doublereal y;
-} stcom_;
-
-#define stcom_1 stcom_
-
 GMT_LOCAL doublereal store_(doublereal *x) {
     /* System generated locals */
-    doublereal ret_val;
+    volatile doublereal ret_val;
 
 
 /* *********************************************************** */
@@ -50,8 +42,9 @@ GMT_LOCAL doublereal store_(doublereal *x) {
 
 /* *********************************************************** */
 
-    stcom_1.y = *x;
-    ret_val = stcom_1.y;
+    /* The f2c original stored X in a common block; a volatile local forces the
+     * same trip through memory without sharing state between threads. */
+    ret_val = *x;
     return ret_val;
 } /* store_ */
 
@@ -60,7 +53,7 @@ GMT_LOCAL integer jrand_(integer *n, integer *ix, integer *iy, integer *iz) {
     integer ret_val;
 
     /* Local variables */
-    static doublereal u, x;
+    doublereal u, x;
 
 
 /* *********************************************************** */
@@ -129,7 +122,7 @@ GMT_LOCAL integer lstptr_(integer *lpl, integer *nb, integer *list, integer *lpt
     integer ret_val;
 
     /* Local variables */
-    static integer nd, lp;
+    integer nd, lp;
 
 
 /* *********************************************************** */
@@ -601,25 +594,27 @@ GMT_LOCAL integer intadd_(integer *kk, integer *i1, integer *i2, integer * i3, i
 } /* intadd_ */
 
 GMT_LOCAL integer trfind_(integer *nst, doublereal *p, integer *n, doublereal *x, doublereal *y, doublereal *z__, integer *list, integer *lptr, integer *lend, doublereal *b1, doublereal *b2, doublereal *b3, integer *i1, integer *i2, integer *i3) {
-    /* Initialized data */
+    /* Initialized data.  The f2c original kept these JRAND seeds in static
+     * storage (Fortran SAVE); reseeding per call instead makes TRFIND
+     * reentrant so several threads may search the same triangulation. */
 
-    static integer ix = 1;
-    static integer iy = 2;
-    static integer iz = 3;
+    integer ix = 1;
+    integer iy = 2;
+    integer iz = 3;
 
     /* System generated locals */
     integer i__1;
     doublereal d__1, d__2;
 
     /* Local variables */
-    static doublereal q[3];
-    static integer n0, n1, n2, n3, n4, nf;
-    static doublereal s12;
-    static integer nl, lp;
-    static doublereal xp, yp, zp;
-    static integer n1s, n2s;
-    static doublereal eps, tol, ptn1, ptn2;
-    static integer next;
+    doublereal q[3];
+    integer n0, n1, n2, n3, n4, nf;
+    doublereal s12;
+    integer nl, lp;
+    doublereal xp, yp, zp;
+    integer n1s, n2s;
+    doublereal eps, tol, ptn1, ptn2;
+    integer next;
 
 
 /* *********************************************************** */
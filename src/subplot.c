@@ -93,6 +93,7 @@ struct SUBPLOT_CTRL {
 		bool active;
 		bool next;
 		bool no_B;
+		bool clear;		/* Strip this panel's previous PS before replotting it (set row,col+c) */
 		unsigned int mode;	/* SUBPLOT_BEGIN|SUBPLOT_SET|SUBPLOT_END*/
 		int row, col;		/* Current (row,col) subplot */
 	} In;
@@ -323,6 +324,10 @@ static int parse (struct GMT_CTRL *GMT, struct SUBPLOT_CTRL *Ctrl, struct GMT_OP
 	else if (!strncmp (opt->arg, "set", 3U)) {	/* Explicitly called set row,col or set index */
 		opt = opt->next;	/* The row,col part */
 		if (opt && opt->option == GMT_OPT_INFILE) {	/* There is an argument without a leading -? option (thus flagged as input file) */
+			if ((c = strstr (opt->arg, "+c"))) {	/* Clear this panel's previous PS so it can be redrawn from scratch */
+				Ctrl->In.clear = true;
+				c[0] = '\0';	/* Chop off modifier */
+			}
 			if (isdigit (opt->arg[0]) && (n = sscanf (opt->arg, "%d,%d", &Ctrl->In.row, &Ctrl->In.col)) < 1) {
 				GMT_Report (API, GMT_MSG_ERROR, "Unable to parse row,col: %s\n", opt->arg);
 				return GMT_PARSE_ERROR;
@@ -341,6 +346,10 @@ static int parse (struct GMT_CTRL *GMT, struct SUBPLOT_CTRL *Ctrl, struct GMT_OP
 		Ctrl->In.mode = SUBPLOT_SET;
 	}
 	else if (strchr (opt->arg, ',')) {	/* Implicitly called set without using the word "set" */
+		if ((c = strstr (opt->arg, "+c"))) {	/* Clear this panel's previous PS so it can be redrawn from scratch */
+			Ctrl->In.clear = true;
+			c[0] = '\0';	/* Chop off modifier */
+		}
 		if (sscanf (opt->arg, "%d,%d", &Ctrl->In.row, &Ctrl->In.col) < 2 || Ctrl->In.row < 0 || Ctrl->In.col < 0) {
 			GMT_Report (API, GMT_MSG_ERROR, "Not a subplot command: %s\n", opt->arg);
 			return GMT_PARSE_ERROR;
@@ -1503,6 +1512,10 @@ EXTERN_MSC int GMT_subplot (void *V_API, int mode, void *args) {
 			if ((error = gmt_get_next_panel (API, fig, &Ctrl->In.row, &Ctrl->In.col)))	/* Bad */
 				Return (error)
 		}
+		if (Ctrl->In.clear && (error = gmt_strip_panel (API, fig, Ctrl->In.row, Ctrl->In.col))) {	/* Cut this panel's previous PS from the figure so it can be redrawn */
+			GMT_Report (API, GMT_MSG_ERROR, "Failed to strip previous PS for panel (%d, %d)\n", Ctrl->In.row, Ctrl->In.col);
+			Return (error)
+		}
 		if ((error = gmt_set_current_panel (API, fig, Ctrl->In.row, Ctrl->In.col, Ctrl->C.active ? Ctrl->C.gap : gap, Ctrl->A.format, 1)))
 			Return (error)
 		gmt_reload_history (GMT);	/* Start fresh in this panel */
@@ -1557,6 +1570,8 @@ EXTERN_MSC int GMT_subplot (void *V_API, int mode, void *args) {
 		gmt_remove_file (GMT, file);
 		sprintf (file, "%s/gmt.panel.%d", API->gwf_dir, fig);
 		gmt_remove_file (GMT, file);
+		sprintf (file, "%s/gmt.panelranges.%d", API->gwf_dir, fig);
+		if (!access (file, F_OK)) gmt_remove_file (GMT, file);
 		sprintf (file, "%s/gmt.tags.%d", API->gwf_dir, fig);
 		gmt_remove_file (GMT, file);
 		for (row = 0; row < P->nrows; row++) {
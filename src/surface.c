@@ -49,13 +49,14 @@
  */
 
 #include "gmt_dev.h"
+#include "gmt_internals.h"	/* For gmtlib_wall_clock used by the checkpoint timer */
 #include "longopt/surface_inc.h"
 
 #define THIS_MODULE_CLASSIC_NAME	"surface"
 #define THIS_MODULE_MODERN_NAME	"surface"
 #define THIS_MODULE_LIB		"core"
 #define THIS_MODULE_PURPOSE	"Grid table data using adjustable tension continuous curvature splines"
-#define THIS_MODULE_KEYS	"<D{,DD(=,LG(,GG}"
+#define THIS_MODULE_KEYS	"<D{,DD(=,EG(,LG(,GG}"
 #define THIS_MODULE_NEEDS	"R"
 #define THIS_MODULE_OPTIONS "-:RVabdefhiqrw" GMT_OPT("FH")
 
@@ -77,6 +78,13 @@ struct SURFACE_CTRL {
 		double z;
 		char *file;	/* Name of file with breaklines */
 	} D;
+	struct SURFACE_E {	/* -E[<prior_grid>][+c[<interval>]] */
+		bool active;
+		bool checkpoint;	/* true if +c given: periodically save the solution so a preempted run can resume */
+		double interval;	/* Time between checkpoints, in seconds */
+		char *file;	/* Name of grid with a previous solution used to warm-start the iterations */
+		char *ckfile;	/* Name of the checkpoint grid we write [session dir or cwd] */
+	} E;
 	struct SURFACE_G {	/* -G<file> */
 		bool active;
 		char *file;
@@ -134,6 +142,9 @@ struct SURFACE_CTRL {
 #define SURFACE_MAX_ITERATIONS		500		/* Default iterations at final grid size */
 #define SURFACE_OVERRELAXATION		1.4		/* Default over-relaxation value */
 #define SURFACE_CLOSENESS_FACTOR	0.05		/* A node is considered known if the nearest data is within 0.05 of a gridspacing of the node */
+#define SURFACE_CKPT_INTERVAL		10.0		/* Default minutes between solution checkpoints under -E+c */
+#define SURFACE_CKPT_FILE		"surface_checkpoint.grd"	/* Default checkpoint file name */
+#define SURFACE_ACTIVE_BLOCK		32		/* Side of the square node blocks whose residuals decide if a region still needs sweeping */
 #define SURFACE_IS_UNCONSTRAINED	0		/* Node has no data constraint within its bin box */
 #define SURFACE_DATA_IS_IN_QUAD1	1		/* Nearnest data constraint is in quadrant 1 relative to current node */
 #define SURFACE_DATA_IS_IN_QUAD2	2		/* Nearnest data constraint is in quadrant 2 relative to current node */
@@ -225,6 +236,7 @@ struct SURFACE_INFO {	/* Control structure for surface setup and execution */
 	FILE *fp_log;			/* File pointer to log file, if -W is selected */
 	struct SURFACE_DATA *data;	/* All the data constraints */
 	struct SURFACE_BRIGGS *Briggs;	/* Array with Briggs 6-coefficients per nearest active data constraint */
+	uint64_t *briggs_index;		/* Per-node lookup into Briggs since the multicolor and active-set sweeps visit nodes out of order */
 	struct GMT_GRID *Grid;		/* The final grid */
 	struct GMT_GRID *Bound[2];	/* Optional grids for lower and upper limits on the solution */
 	struct GMT_GRID_HEADER *Bh;	/* Grid header for one of the limit grids [or NULL] */
@@ -254,11 +266,14 @@ struct SURFACE_INFO {	/* Control structure for surface setup and execution */
 	char mode_type[2];		/* D = include data points when iterating, I = just interpolate from larger grid */
 	char format[GMT_BUFSIZ];	/* Format statement used in some messages */
 	char *limit_file[2];		/* Pointers to grids with low and high limits, if selected */
+	char *ckpt_file;		/* Where to write periodic solution checkpoints [NULL means no checkpointing] */
 	bool periodic;			/* true if geographic grid and west-east == 360 */
 	bool constrained;		/* true if set_limit[LO] or set_limit[HI] is true */
 	bool logging;			/* true if -W was specified */
 	bool adjusted;			/* true if -L grids need to be enlarged with pads */
 	double limit[2];		/* Low and high constrains on range of solution */
+	double ckpt_interval;		/* Seconds between solution checkpoints */
+	double ckpt_next;		/* Wall-clock time when the next checkpoint is due */
 	double inc[2];			/* Size of each grid cell for current grid factor */
 	double r_inc[2];		/* Reciprocal grid spacings  */
 	double converge_limit;		/* Convergence limit */
@@ -651,6 +666,7 @@ GMT_LOCAL void surface_find_nearest_constraint (struct GMT_CTRL *GMT, struct SUR
 				}
 				/* Evaluate the Briggs coefficients */
 				surface_solve_Briggs_coefficients (C, C->Briggs[briggs_index].b, xx, yy, C->data[k].z);
+				C->briggs_index[node] = briggs_index;	/* The sweeps in surface_iterate visit constrained nodes out of order */
 	 			briggs_index++;
 	 		}
 	 	}
@@ -739,6 +755,57 @@ GMT_LOCAL void surface_initialize_grid (struct GMT_CTRL *GMT, struct SURFACE_INF
 	}
 }
 
+GMT_LOCAL double surface_warm_start_residual (struct GMT_CTRL *GMT, struct SURFACE_INFO *C, struct GMT_GRID *Prior) {
+	/* Determine the largest misfit (in original z units) between the prior solution and the data
+	 * constraints.  This decides how many coarse multigrid levels the warm start can skip: any
+	 * level whose convergence limit exceeds this misfit would converge immediately anyway. */
+	uint64_t k;
+	double z_prior, xx, y_up, u_prior, change, max_change = 0.0;
+	struct GMT_GRID_HEADER *h = C->Grid->header;
+	struct GMT_GRID_HEADER_HIDDEN *HH = gmt_get_H_hidden (h);
+
+	for (k = 0; k < C->npoints; k++) {
+		z_prior = gmt_bcr_get_z (GMT, Prior, C->data[k].x, C->data[k].y);
+		if (gmt_M_is_dnan (z_prior)) return (DBL_MAX);	/* Prior does not cover this constraint so no level can be skipped */
+		xx   = x_to_fcol (C->data[k].x, h->wesn[XLO], HH->r_inc[GMT_X]);
+		y_up = y_to_frow (C->data[k].y, h->wesn[YLO], HH->r_inc[GMT_Y]);
+		u_prior = (z_prior - evaluate_plane (C, xx, y_up)) * C->r_z_rms;	/* Prior in the detrended and normalized frame */
+		change = fabs (C->data[k].z - u_prior) * C->z_rms;			/* Misfit back in original z units */
+		if (change > max_change) max_change = change;
+	}
+	return (max_change);
+}
+
+GMT_LOCAL void surface_warm_start_grid (struct GMT_CTRL *GMT, struct SURFACE_INFO *C, struct GMT_GRID *Prior) {
+	/* Initialize the current (coarsest remaining) grid by resampling the prior solution through
+	 * the bicubic interpolant, converting values to the detrended and normalized frame used
+	 * internally.  This replaces the moving-average initialization (-S) when -E is in effect. */
+	int row, col;
+	uint64_t node;
+	double x0, y0, z_prior, xx, y_up;
+	gmt_grdfloat *u = C->Grid->data;
+	struct GMT_GRID_HEADER *h = C->Grid->header;
+	struct GMT_GRID_HEADER_HIDDEN *HH = gmt_get_H_hidden (h);
+
+	GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "Initialize grid from prior solution [stride = %d]\n", C->current_stride);
+
+	for (row = 0; row < C->current_ny; row++) {
+		y0 = row_to_y (row, h->wesn[YLO], h->wesn[YHI], C->inc[GMT_Y], C->current_ny);
+		node = row_col_to_node (row, 0, C->current_mx);
+		for (col = 0; col < C->current_nx; col++, node++) {
+			x0 = col_to_x (col, h->wesn[XLO], h->wesn[XHI], C->inc[GMT_X], C->current_nx);
+			z_prior = gmt_bcr_get_z (GMT, Prior, x0, y0);
+			if (gmt_M_is_dnan (z_prior))	/* Prior has a hole here; detrended data have zero mean so start from the plane */
+				u[node] = 0.0f;
+			else {
+				xx   = x_to_fcol (x0, h->wesn[XLO], HH->r_inc[GMT_X]);
+				y_up = y_to_frow (y0, h->wesn[YLO], HH->r_inc[GMT_Y]);
+				u[node] = (gmt_grdfloat)((z_prior - evaluate_plane (C, xx, y_up)) * C->r_z_rms);
+			}
+		}
+	}
+}
+
 GMT_LOCAL int surface_read_data (struct GMT_CTRL *GMT, struct SURFACE_INFO *C, struct GMT_OPTION *options) {
 	/* Process input data into data structure */
 	int col, row, error;
@@ -1075,18 +1142,118 @@ GMT_LOCAL void surface_set_BCs (struct GMT_CTRL *GMT, struct SURFACE_INFO *C, gm
 	}
 }
 
+#ifdef _OPENMP
+GMT_LOCAL double surface_relax_node (struct SURFACE_INFO *C, uint64_t node, int row, int col) {
+	/* Update a single unconstrained interior node in place and return the absolute change.
+	 * Used by the multicolor sweep in surface_iterate; the sequential code path there
+	 * performs the same update inline with a running Briggs index. */
+	unsigned int set, quadrant;
+	int k, *d_node = C->offset;	/* Relative changes in node index from present node */
+	uint64_t node_final;
+	double u_00 = 0.0, sum_bk_uk, u_change;
+	gmt_grdfloat *b = NULL, *u = C->Grid->data;
+	unsigned char *status = C->status;
+
+	/* Estimate a solution via equations (A-4) [SURFACE_UNCONSTRAINED] or (A-7) [SURFACE_CONSTRAINED] */
+	set = (status[node] == SURFACE_IS_UNCONSTRAINED) ? SURFACE_UNCONSTRAINED : SURFACE_CONSTRAINED;	/* Index to C->coeff set to use */
+	for (k = 0; k < 12; k++)	/* This is either equation (A-4) or the corresponding part of (A-7), depending on the value of set */
+		u_00 += (u[node+d_node[k]] * C->coeff[set][k]);
+	if (set == SURFACE_CONSTRAINED) {	/* Solution is (A-7) and modifications depend on which quadrant the point lies in */
+		b = C->Briggs[C->briggs_index[node]].b;	/* Shorthand to this node's Briggs b-array */
+		quadrant = status[node];		/* Which quadrant did the point fall in? */
+		for (k = 0, sum_bk_uk = 0.0; k < 4; k++)	/* Sum over b[k]*u[k] for nodes A-D in Fig A-1 */
+			sum_bk_uk += b[k] * u[node+d_node[C->p[quadrant][k]]];
+		u_00 = (u_00 + C->a0_const_2 * (sum_bk_uk + b[4])) * b[5];	/* Add point E in Fig A-1 to sum_bk_uk and normalize */
+	}
+	/* We now apply the over-relaxation: */
+	u_00 = u[node] * C->relax_old + u_00 * C->relax_new;
+	if (C->constrained) {	/* Must check that we don't exceed any imposed limits.  */
+		/* Must use final spacing node index to access the Bound grids */
+		node_final = gmt_M_ijp (C->Bh, C->current_stride * row, C->current_stride * col);
+		if (C->set_limit[LO] && !gmt_M_is_fnan (C->Bound[LO]->data[node_final]) && u_00 < C->Bound[LO]->data[node_final])
+			u_00 = C->Bound[LO]->data[node_final];
+		else if (C->set_limit[HI] && !gmt_M_is_fnan (C->Bound[HI]->data[node_final]) && u_00 > C->Bound[HI]->data[node_final])
+			u_00 = C->Bound[HI]->data[node_final];
+	}
+	u_change = fabs (u_00 - u[node]);	/* Change in node value between iterations */
+	u[node] = (gmt_grdfloat)u_00;		/* Our updated estimate at this node */
+	return (u_change);
+}
+#endif
+
+GMT_LOCAL void surface_checkpoint (struct GMT_CTRL *GMT, struct SURFACE_INFO *C) {
+	/* Write the current solution as a regular grid in user units so that a preempted run can be
+	 * resumed via -E<checkpoint>.  Only called at the final grid size, where the node lattice
+	 * equals the output lattice.  We undo the detrending/normalization on a copy so the live
+	 * iteration arrays are untouched.  A checkpoint torn by mid-write preemption merely costs
+	 * falling back to a cold start. */
+	unsigned int row, col;
+	uint64_t node;
+	gmt_grdfloat *v = NULL;
+	double y_up;	/* Measure y up from south in fractional rows */
+	struct GMT_GRID *Ckpt = NULL;
+
+	if ((Ckpt = GMT_Duplicate_Data (GMT->parent, GMT_IS_GRID, GMT_DUPLICATE_DATA, C->Grid)) == NULL) {
+		GMT_Report (GMT->parent, GMT_MSG_WARNING, "Unable to duplicate solution grid - checkpoint skipped\n");
+		return;
+	}
+	v = Ckpt->data;
+	for (row = 0; row < Ckpt->header->n_rows; row++) {	/* Undo normalization as in surface_restore_planar_trend */
+		y_up = (double)(Ckpt->header->n_rows - row - 1);	/* # of rows from south (where y_up = 0) to this node */
+		node = row_col_to_node (row, 0, C->current_mx);	/* Node index at left end of interior row */
+		for (col = 0; col < Ckpt->header->n_columns; col++, node++)	/* March across this row */
+			v[node] = (gmt_grdfloat)((v[node] * C->z_rms) + (evaluate_plane (C, col, y_up)));
+	}
+	strcpy (Ckpt->header->title, "surface checkpoint (intermediate solution)");
+	if (GMT_Write_Data (GMT->parent, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_CONTAINER_AND_DATA, NULL, C->ckpt_file, Ckpt) != GMT_NOERROR)
+		GMT_Report (GMT->parent, GMT_MSG_WARNING, "Unable to write checkpoint file %s\n", C->ckpt_file);
+	else
+		GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "Checkpoint written to %s after %" PRIu64 " total iterations\n", C->ckpt_file, C->total_iterations);
+	if (GMT_Destroy_Data (GMT->parent, &Ckpt) != GMT_NOERROR)
+		GMT_Report (GMT->parent, GMT_MSG_WARNING, "Failed to free checkpoint grid copy\n");
+}
+
 GMT_LOCAL uint64_t surface_iterate (struct GMT_CTRL *GMT, struct SURFACE_INFO *C, int mode) {
 	/* Main finite difference solver */
-	uint64_t node, briggs_index, iteration_count = 0, node_final = 0;
-	unsigned int set, quadrant, current_max_iterations = C->max_iterations * C->current_stride;
-	int col, row, k, *d_node = C->offset;	/* Relative changes in node index from present node */
+	uint64_t node, iteration_count = 0;
+#ifndef _OPENMP		/* These are only needed by the sequential sweep; the parallel one lives in surface_relax_node */
+	uint64_t node_final = 0;
+	unsigned int set, quadrant;
+	int k, *d_node = C->offset;	/* Relative changes in node index from present node */
+	double sum_bk_uk, u_00;
+	gmt_grdfloat *b = NULL;
+	gmt_grdfloat *u_new = C->Grid->data;
+#else
+	int t, n_threads = omp_get_max_threads ();
+	double *blk_partial = NULL;		/* Per-thread partial block maxima for the multicolor sweep */
+#endif
+	unsigned int current_max_iterations = C->max_iterations * C->current_stride;
+	int col, row, blk, brow, bcol, nbx, nby, nb;
 	unsigned char *status = C->status;	/* Quadrant or status information for each node */
+	unsigned char *blk_active = NULL, *blk_next = NULL;
 	char *mode_name[2] = {"node", "data"};
-	bool finished;
+	bool finished, full_sweep;
 	double current_limit = C->converge_limit / C->current_stride;
-	double u_change, max_u_change, max_z_change, sum_bk_uk, u_00;
-	gmt_grdfloat *b = NULL;
-	gmt_grdfloat *u_new = C->Grid->data, *u_old = C->Grid->data;
+	double u_change, max_u_change, max_z_change;
+	double *blk_change = NULL;		/* Per-block max |change| from the sweep that last visited the block, in scaled u units */
+	gmt_grdfloat *u_old = C->Grid->data;
+
+	/* Active-set bookkeeping: the interior is tiled into square blocks and a block whose residual
+	 * dropped below the convergence limit is skipped until the residual of a neighboring block
+	 * exceeds the limit again, since updates can only reach it through the 2-node stencil halo.
+	 * Sparse data sets converge quickly over their empty regions so most sweeps then touch only
+	 * the blocks that still move.  Before we accept convergence from a partial sweep we re-arm
+	 * every block and demand one final full sweep, so the -C criterion is met exactly. */
+	nbx = (C->current_nx + SURFACE_ACTIVE_BLOCK - 1) / SURFACE_ACTIVE_BLOCK;
+	nby = (C->current_ny + SURFACE_ACTIVE_BLOCK - 1) / SURFACE_ACTIVE_BLOCK;
+	nb  = nbx * nby;
+	blk_change = gmt_M_memory (GMT, NULL, nb, double);
+	blk_active = gmt_M_memory (GMT, NULL, nb, unsigned char);
+	blk_next   = gmt_M_memory (GMT, NULL, nb, unsigned char);
+	for (blk = 0; blk < nb; blk++) blk_active[blk] = 1;	/* Every block participates in the first sweep */
+#ifdef _OPENMP
+	blk_partial = gmt_M_memory (GMT, NULL, (size_t)n_threads * nb, double);
+#endif
 
 	GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Starting iterations, mode = %s Max iterations = %d [stride = %d]\n", mode_name[mode], current_max_iterations, C->current_stride);
 
@@ -1099,16 +1266,56 @@ GMT_LOCAL uint64_t surface_iterate (struct GMT_CTRL *GMT, struct SURFACE_INFO *C
 
 		surface_set_BCs (GMT, C, u_old);	/* Set the boundary rows and columns */
 
-		briggs_index = 0;	/* Reset the Briggs constraint table index  */
-		max_u_change = -1.0;	/* Ensure max_u_change is < 0 for starters */
+		for (blk = 0, full_sweep = true; blk < nb; blk++) {	/* Reset the residuals of the blocks this sweep will visit */
+			if (blk_active[blk])
+				blk_change[blk] = 0.0;
+			else
+				full_sweep = false;
+		}
 
-		/* Now loop over all interior data nodes */
+		/* Now loop over all interior data nodes in the active blocks */
 		GMT_Report (GMT->parent, GMT_MSG_DEBUG, "Iteration %d\n", iteration_count);
 
+#ifdef _OPENMP
+		/* Multicolor ordered relaxation: the 12-point biharmonic stencil reaches at most
+		 * +/- 2 nodes away in row and col, so nodes that agree in both (row mod 3) and
+		 * (col mod 3) never interact and each of the nine color classes can be swept in
+		 * parallel, in place, with deterministic results.  A plain red-black (2-color)
+		 * split does not decouple this stencil since the distance-2 neighbors share color. */
+		{
+			int color_row, color_col;
+			for (blk = 0; blk < n_threads * nb; blk++) blk_partial[blk] = 0.0;
+			for (color_row = 0; color_row < 3; color_row++) for (color_col = 0; color_col < 3; color_col++) {
+#pragma omp parallel for private(row,col,node,u_change) shared(C,status,color_row,color_col,blk_active,blk_partial,nbx,nb)
+				for (row = color_row; row < C->current_ny; row += 3) {
+					double *partial = blk_partial + (size_t)omp_get_thread_num () * nb;	/* This thread's block maxima */
+					int boff = (row / SURFACE_ACTIVE_BLOCK) * nbx, bi;
+					for (col = color_col; col < C->current_nx; col += 3) {
+						bi = boff + col / SURFACE_ACTIVE_BLOCK;
+						if (!blk_active[bi]) continue;	/* Block and its neighborhood were below tolerance last sweep */
+						node = C->node_nw_corner + (uint64_t)row * C->current_mx + col;
+						if (status[node] == SURFACE_IS_CONSTRAINED)	/* Data constraint fell exactly on the node, keep it as is */
+							continue;
+						u_change = surface_relax_node (C, node, row, col);
+						if (u_change > partial[bi]) partial[bi] = u_change;
+					}
+				}
+			}
+		}
+		for (blk = 0; blk < nb; blk++) {	/* Fold the per-thread partials into the per-block residuals */
+			if (!blk_active[blk]) continue;	/* Keeps the residual from the sweep that last visited this block */
+			for (t = 0; t < n_threads; t++)
+				if (blk_partial[(size_t)t * nb + blk] > blk_change[blk]) blk_change[blk] = blk_partial[(size_t)t * nb + blk];
+		}
+#else
 		for (row = 0; row < C->current_ny; row++) {	/* Loop over rows */
+			int boff = (row / SURFACE_ACTIVE_BLOCK) * nbx;
 			node = C->node_nw_corner + row * C->current_mx;	/* Node at left side of this row */
 			if (C->constrained) node_final = gmt_M_ijp (C->Bh, C->current_stride * row, 0);
 			for (col = 0; col < C->current_nx; col++, node++, node_final += C->current_stride) {	/* Loop over all columns */
+				blk = boff + col / SURFACE_ACTIVE_BLOCK;
+				if (!blk_active[blk])	/* Block and its neighborhood were below tolerance last sweep */
+					continue;
 				if (status[node] == SURFACE_IS_CONSTRAINED) {	/* Data constraint fell exactly on the node, keep it as is */
 					continue;
 				}
@@ -1120,13 +1327,12 @@ GMT_LOCAL uint64_t surface_iterate (struct GMT_CTRL *GMT, struct SURFACE_INFO *C
 					u_00 += (u_old[node+d_node[k]] * C->coeff[set][k]);
 				}
 				if (set == SURFACE_CONSTRAINED) {	/* Solution is (A-7) and modifications depend on which quadrant the point lies in */
-					b = C->Briggs[briggs_index].b;		/* Shorthand to this node's Briggs b-array */
+					b = C->Briggs[C->briggs_index[node]].b;	/* Shorthand to this node's Briggs b-array; skipping blocks means we cannot count sequentially */
 					quadrant = status[node];		/* Which quadrant did the point fall in? */
 					for (k = 0, sum_bk_uk = 0.0; k < 4; k++) {	/* Sum over b[k]*u[k] for nodes A-D in Fig A-1 */
 						sum_bk_uk += b[k] * u_old[node+d_node[C->p[quadrant][k]]];
 					}
 					u_00 = (u_00 + C->a0_const_2 * (sum_bk_uk + b[4])) * b[5];	/* Add point E in Fig A-1 to sum_bk_uk and normalize */
-					briggs_index++;	/* Got to next sequential Briggs array index */
 				}
 				/* We now apply the over-relaxation: */
 				u_00 = u_old[node] * C->relax_old + u_00 * C->relax_new;
@@ -1139,9 +1345,13 @@ GMT_LOCAL uint64_t surface_iterate (struct GMT_CTRL *GMT, struct SURFACE_INFO *C
 				}
 				u_change = fabs (u_00 - u_old[node]);		/* Change in node value between iterations */
 				u_new[node] = (gmt_grdfloat)u_00;			/* Our updated estimate at this node */
-				if (u_change > max_u_change) max_u_change = u_change;	/* Keep track of max u_change across all nodes */
+				if (u_change > blk_change[blk]) blk_change[blk] = u_change;	/* Keep track of max u_change per block */
 			}	/* End of loop over columns */
-		}	/* End of loop over rows [and possibly threads via OpenMP] */
+		}	/* End of loop over rows */
+#endif	/* !_OPENMP */
+
+		for (blk = 0, max_u_change = 0.0; blk < nb; blk++)	/* Global residual is the max over all blocks, visited or not */
+			if (blk_change[blk] > max_u_change) max_u_change = blk_change[blk];
 
 		iteration_count++;	C->total_iterations++;	/* Update iteration counts for this stride and for total */
 		max_z_change = max_u_change * C->z_rms;		/* Scale max_u_change back into original z units -> max_z_change */
@@ -1149,12 +1359,47 @@ GMT_LOCAL uint64_t surface_iterate (struct GMT_CTRL *GMT, struct SURFACE_INFO *C
 			C->current_stride, C->mode_type[mode], iteration_count, max_z_change, current_limit, C->total_iterations);
 		if (C->logging) fprintf (C->fp_log, "%d\t%c\t%" PRIu64 "\t%.8g\t%.8g\t%" PRIu64 "\n", C->current_stride, C->mode_type[mode], iteration_count, max_z_change, current_limit, C->total_iterations);
 		finished = (max_z_change <= current_limit || iteration_count >= current_max_iterations);
+		if (finished && max_z_change <= current_limit && iteration_count < current_max_iterations && !full_sweep) {
+			/* Residuals of skipped blocks are from the sweep that parked them, so re-arm every block
+			 * and verify convergence with one full sweep before we accept the -C criterion as met */
+			for (blk = 0; blk < nb; blk++) blk_active[blk] = 1;
+			finished = false;
+		}
+		else if (!finished) {	/* Schedule the next sweep: every block above tolerance plus a one-block halo around each */
+			gmt_M_memset (blk_next, nb, unsigned char);
+			for (brow = 0; brow < nby; brow++) for (bcol = 0; bcol < nbx; bcol++) {
+				int b2row, b2col;
+				if (blk_change[brow * nbx + bcol] * C->z_rms <= current_limit) continue;
+				for (b2row = MAX (0, brow - 1); b2row <= MIN (nby - 1, brow + 1); b2row++)
+					for (b2col = MAX (0, bcol - 1); b2col <= MIN (nbx - 1, bcol + 1); b2col++)
+						blk_next[b2row * nbx + b2col] = 1;
+			}
+			gmt_M_memcpy (blk_active, blk_next, nb, unsigned char);
+		}
+		if (GMT->parent->cancel) {	/* The embedder has asked us to stop; quit with the current estimate */
+			GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "Iterations stopped: cancellation requested via GMT_Cancel_Module\n");
+			finished = true;
+		}
+		else	/* Publish how far into this relaxation stage we are for GMT_Get_Progress pollers */
+			GMT->parent->progress = (double)iteration_count / current_max_iterations;
+
+		if (C->ckpt_file && C->current_stride == 1 && gmtlib_wall_clock () >= C->ckpt_next) {	/* Time to save the solution */
+			surface_checkpoint (GMT, C);
+			C->ckpt_next = gmtlib_wall_clock () + C->ckpt_interval;
+		}
 
 	} while (!finished);
 
 	GMT_Report (GMT->parent, GMT_MSG_INFORMATION, C->format,
 		C->current_stride, C->mode_type[mode], iteration_count, max_z_change, current_limit, C->total_iterations);
 
+	gmt_M_free (GMT, blk_change);
+	gmt_M_free (GMT, blk_active);
+	gmt_M_free (GMT, blk_next);
+#ifdef _OPENMP
+	gmt_M_free (GMT, blk_partial);
+#endif
+
 	return (iteration_count);
 }
 
@@ -1699,6 +1944,7 @@ static void *New_Ctrl (struct GMT_CTRL *GMT) {	/* Allocate and initialize a new
 	/* Initialize values whose defaults are not 0/false/NULL */
 	C->N.value = SURFACE_MAX_ITERATIONS;
 	C->A.value = 1.0;	/* Real xinc == yinc in terms of distances */
+	C->E.interval = 60.0 * SURFACE_CKPT_INTERVAL;	/* Default time between checkpoints, in seconds */
 	C->W.file = strdup ("surface_log.txt");
 	C->Z.value = SURFACE_OVERRELAXATION;
 
@@ -1709,6 +1955,8 @@ static void Free_Ctrl (struct GMT_CTRL *GMT, struct SURFACE_CTRL *C) {	/* Deallo
 	if (!C) return;
 	gmt_M_str_free (C->G.file);
 	if (C->D.file) gmt_M_str_free (C->D.file);
+	if (C->E.file) gmt_M_str_free (C->E.file);
+	if (C->E.ckfile) gmt_M_str_free (C->E.ckfile);
 	if (C->L.file[LO]) gmt_M_str_free (C->L.file[LO]);
 	if (C->L.file[HI]) gmt_M_str_free (C->L.file[HI]);
 	if (C->M.arg) gmt_M_str_free (C->M.arg);
@@ -1721,7 +1969,7 @@ static int usage (struct GMTAPI_CTRL *API, int level) {
 	const char *name = gmt_show_name_and_purpose (API, THIS_MODULE_LIB, THIS_MODULE_CLASSIC_NAME, THIS_MODULE_PURPOSE);
 	if (level == GMT_MODULE_PURPOSE) return (GMT_NOERROR);
 	GMT_Usage (API, 0, "usage: %s [<table>] -G%s %s %s [-A<aspect_ratio>|m] [-C<convergence_limit>] "
-		"[-D<breakline>[+z[<zlevel>]]] [%s] [-Ll|u<limit>] [-M<radius>] [-N<n_iterations>] [-Q[r]] "
+		"[-D<breakline>[+z[<zlevel>]]] [-E[<prior_grid>][+c[<interval>]]] [%s] [-Ll|u<limit>] [-M<radius>] [-N<n_iterations>] [-Q[r]] "
 		"[-S<search_radius>[m|s]] [-T[b|i]<tension>] [%s] [-W[<logfile>]] [-Z<over_relaxation>] "
 		"[%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] [%s] %s[%s] [%s]\n",
 		name, GMT_OUTGRID, GMT_I_OPT, GMT_Rgeo_OPT, GMT_J_OPT, GMT_V_OPT, GMT_a_OPT, GMT_bi_OPT, GMT_di_OPT, GMT_e_OPT, GMT_f_OPT,
@@ -1747,6 +1995,13 @@ static int usage (struct GMTAPI_CTRL *API, int level) {
 	GMT_Usage (API, 1, "\n-D<breakline>[+z[<zlevel>]]");
 	GMT_Usage (API, -2, "Use xyz data in the <breakline> file as a 'soft breakline'. Optional modifier:");
 	GMT_Usage (API, 3, "+z Override any z from the <breakline> file with the appended <z_level> [0].");
+	GMT_Usage (API, 1, "\n-E[<prior_grid>][+c[<interval>]]");
+	GMT_Usage (API, -2, "Warm-start the iterations from a previous solution grid (resampled to the current "
+		"node locations).  Coarse multigrid levels whose convergence limits the prior already "
+		"satisfies are skipped, so re-gridding slowly changing data takes only a few fine-level sweeps. "
+		"Overrides -S as the initial guess.  Optional modifier:");
+	GMT_Usage (API, 3, "+c Periodically write the current solution to %s [every %g minutes] "
+		"so a preempted run can be resumed via -E<that_file>.", SURFACE_CKPT_FILE, SURFACE_CKPT_INTERVAL);
 	GMT_Usage (API, 1, "\n%s", GMT_J_OPT);
 	GMT_Usage (API, -2, "Select the data map projection. This projection is only used to add CRS info to the "
 		"grid formats that support it, i.e., netCDF, GeoTIFF, and others supported by GDAL.");
@@ -1849,6 +2104,17 @@ static int parse (struct GMT_CTRL *GMT, struct SURFACE_CTRL *Ctrl, struct GMT_OP
 				if (c) c[0] = '+';	/* Restore original string */
 				if (d) d[0] = '+';	/* Restore original string */
 				break;
+			case 'E':	/* Warm-start from a prior solution grid and/or periodic checkpointing */
+				n_errors += gmt_M_repeated_module_option (API, Ctrl->E.active);
+				if ((c = strstr (opt->arg, "+c"))) {
+					c[0] = '\0';	/* Temporarily chop off +c part */
+					Ctrl->E.checkpoint = true;
+					if (c[2]) Ctrl->E.interval = 60.0 * atof (&c[2]);	/* Interval given in minutes; stored in seconds */
+				}
+				if (opt->arg[0]) Ctrl->E.file = strdup (opt->arg);
+				if (Ctrl->E.file && GMT_Get_FilePath (API, GMT_IS_GRID, GMT_IN, GMT_FILE_REMOTE, &(Ctrl->E.file))) n_errors++;
+				if (c) c[0] = '+';	/* Restore original string */
+				break;
 			case 'G':
 				n_errors += gmt_M_repeated_module_option (API, Ctrl->G.active);
 				n_errors += gmt_get_required_file (GMT, opt->arg, opt->option, 0, GMT_IS_GRID, GMT_OUT, GMT_FILE_LOCAL, &(Ctrl->G.file));
@@ -1968,6 +2234,8 @@ static int parse (struct GMT_CTRL *GMT, struct SURFACE_CTRL *Ctrl, struct GMT_OP
 	n_errors += gmt_M_check_condition (GMT, Ctrl->Z.value < 0.0 || Ctrl->Z.value > 2.0,
 	                                   "Option -Z: Relaxation value must be 1 <= z <= 2\n");
 	n_errors += gmt_M_check_condition (GMT, !Ctrl->G.file && !Ctrl->Q.active, "Option -G: Must specify output grid file\n");
+	n_errors += gmt_M_check_condition (GMT, Ctrl->E.active && !Ctrl->E.file && !Ctrl->E.checkpoint, "Option -E: Must specify a prior solution grid file and/or modifier +c\n");
+	n_errors += gmt_M_check_condition (GMT, Ctrl->E.checkpoint && Ctrl->E.interval <= 0.0, "Option -E: Checkpoint interval must be positive\n");
 	n_errors += gmt_M_check_condition (GMT, Ctrl->A.mode && gmt_M_is_cartesian (GMT, GMT_IN),
 	                                   "Option -Am: Requires geographic input data\n");
 	n_errors += gmt_check_binary_io (GMT, 3);
@@ -1986,6 +2254,7 @@ EXTERN_MSC int GMT_surface (void *V_API, int mode, void *args) {
 
 	struct SURFACE_INFO C;
 	struct SURFACE_CTRL *Ctrl = NULL;
+	struct GMT_GRID *Prior = NULL;
 	struct GMT_CTRL *GMT = NULL, *GMT_cpy = NULL;
 	struct GMT_OPTION *options = NULL;
 	struct GMTAPI_CTRL *API = gmt_get_api_ptr (V_API);	/* Cast from void to GMTAPI_CTRL pointer */
@@ -2129,6 +2398,13 @@ EXTERN_MSC int GMT_surface (void *V_API, int mode, void *args) {
 		Return (GMT_RUNTIME_ERROR);	/* Clean up and return */
 	}
 
+	if (Ctrl->E.file) {	/* Read the prior solution we will warm-start from */
+		if ((Prior = GMT_Read_Data (API, GMT_IS_GRID, GMT_IS_FILE, GMT_IS_SURFACE, GMT_READ_NORMAL, NULL, Ctrl->E.file, NULL)) == NULL) {
+			gmt_M_free (GMT, C.data);
+			Return (API->error);
+		}
+	}
+
 	/* Set up factors and reset current_stride to its initial (and largest) value  */
 
 	C.current_stride = gmt_gcd_euclid (C.n_columns-1, C.n_rows-1);
@@ -2138,6 +2414,19 @@ EXTERN_MSC int GMT_surface (void *V_API, int mode, void *args) {
 		surface_smart_divide (&C);
 		surface_set_grid_parameters (&C);
 	}
+	if (Ctrl->E.file) {	/* See if the prior solution lets us skip the coarsest multigrid levels */
+		unsigned int n_skipped = 0;
+		double misfit = surface_warm_start_residual (GMT, &C, Prior);
+		while (C.current_stride > 1 && misfit < (C.converge_limit / C.current_stride)) {
+			surface_smart_divide (&C);
+			surface_set_grid_parameters (&C);
+			n_skipped++;
+		}
+		if (n_skipped)
+			GMT_Report (API, GMT_MSG_INFORMATION, "Warm start: prior misfit %g is below the coarse convergence limits - skipping %u multigrid level(s) [stride = %d]\n", misfit, n_skipped, C.current_stride);
+		else
+			GMT_Report (API, GMT_MSG_INFORMATION, "Warm start: prior misfit %g requires the full multigrid schedule [stride = %d]\n", misfit, C.current_stride);
+	}
 	surface_set_offset (&C);	/* Initialize the node-jumps across rows for this grid size */
 	surface_set_index (GMT, &C);	/* Determine the nearest data constraint for this grid size */
 
@@ -2150,6 +2439,21 @@ EXTERN_MSC int GMT_surface (void *V_API, int mode, void *args) {
 		fprintf (C.fp_log, "#grid\tmode\tgrid_iteration\tchange\tlimit\ttotal_iteration\n");
 	}
 
+	if (Ctrl->E.checkpoint) {	/* Arm the periodic checkpoint timer */
+		if (Ctrl->E.ckfile == NULL) {	/* Compose default name in the session dir (modern mode) or cwd (classic) */
+			char path[PATH_MAX] = {""};
+			if (API->gwf_dir)
+				snprintf (path, PATH_MAX, "%s/%s", API->gwf_dir, SURFACE_CKPT_FILE);
+			else
+				snprintf (path, PATH_MAX, "%s", SURFACE_CKPT_FILE);
+			Ctrl->E.ckfile = strdup (path);
+		}
+		C.ckpt_file = Ctrl->E.ckfile;
+		C.ckpt_interval = Ctrl->E.interval;
+		C.ckpt_next = gmtlib_wall_clock () + C.ckpt_interval;
+		GMT_Report (API, GMT_MSG_INFORMATION, "Checkpointing solution to %s every %g minute(s)\n", C.ckpt_file, C.ckpt_interval / 60.0);
+	}
+
 	/* Now the data are ready to go for the first iteration.  */
 
 	if (gmt_M_is_verbose (GMT, GMT_MSG_INFORMATION)) {	/* Report on memory usage for this run */
@@ -2175,11 +2479,17 @@ EXTERN_MSC int GMT_surface (void *V_API, int mode, void *args) {
 	/* Allocate the memory needed to perform the gridding  */
 
 	C.Briggs   = gmt_M_memory (GMT, NULL, C.npoints, struct SURFACE_BRIGGS);
+	C.briggs_index = gmt_M_memory (GMT, NULL, C.mxmy, uint64_t);
 	C.status   = gmt_M_memory (GMT, NULL, C.mxmy, char);
 	C.fraction = gmt_M_memory (GMT, NULL, C.current_stride, double);
 	if (GMT_Create_Data (API, GMT_IS_GRID, GMT_IS_SURFACE, GMT_DATA_ONLY, NULL, NULL, NULL, 0, 0, C.Grid) == NULL)
 		Return (API->error);
-	if (C.radius > 0) surface_initialize_grid (GMT, &C); /* Fill in nodes with a weighted average in a search radius  */
+	if (Ctrl->E.file) {	/* Start from the prior solution instead of zero (or the -S moving average) */
+		surface_warm_start_grid (GMT, &C, Prior);
+		if (GMT_Destroy_Data (API, &Prior) != GMT_NOERROR)	/* No longer needed */
+			GMT_Report (API, GMT_MSG_ERROR, "Failed to free prior solution grid\n");
+	}
+	else if (C.radius > 0) surface_initialize_grid (GMT, &C); /* Fill in nodes with a weighted average in a search radius  */
 	GMT_Report (API, GMT_MSG_INFORMATION, "Grid\tMode\tIteration\tMax Change\tConv Limit\tTotal Iterations\n");
 
 	surface_set_coefficients (GMT, &C);	/* Initialize the coefficients needed in the finite-difference expressions */
@@ -2191,7 +2501,7 @@ EXTERN_MSC int GMT_surface (void *V_API, int mode, void *args) {
 	surface_find_nearest_constraint (GMT, &C);		/* Assign nearest data value to nodes and evaluate Briggs coefficients */
 	surface_iterate (GMT, &C, GRID_DATA);			/* Grid the data using the data constraints */
 
-	while (C.current_stride > 1) {	/* More intermediate grids remain, go to next */
+	while (C.current_stride > 1 && !API->cancel) {	/* More intermediate grids remain, go to next */
 		surface_smart_divide (&C);			/* Set the new current_stride */
 		surface_set_grid_parameters (&C);		/* Update node book-keeping constants */
 		surface_set_offset (&C);			/* Reset the node-jumps across rows for this grid size */
@@ -2203,6 +2513,22 @@ EXTERN_MSC int GMT_surface (void *V_API, int mode, void *args) {
 		C.previous_stride = C.current_stride;	/* Remember previous stride before we smart-divide again */
 	}
 
+	if (Ctrl->E.file)	/* Let the operator gauge what the warm start saved relative to a cold run */
+		GMT_Report (API, GMT_MSG_INFORMATION, "Warm start: converged using %" PRIu64 " total iterations\n", C.total_iterations);
+
+	if (API->cancel) {	/* Cancellation was requested: drop the unfinished surface and wind down cleanly */
+		GMT_Report (API, GMT_MSG_INFORMATION, "surface stopped: cancellation requested via GMT_Cancel_Module\n");
+		if (Ctrl->W.active) gmt_fclose (GMT, C.fp_log);
+		gmt_M_free (GMT, C.Briggs);
+		gmt_M_free (GMT, C.briggs_index);
+		gmt_M_free (GMT, C.status);
+		gmt_M_free (GMT, C.fraction);
+		gmt_M_free (GMT, C.data);
+		for (end = LO; end <= HI; end++) if (C.set_limit[end] && GMT_Destroy_Data (API, &C.Bound[end]) != GMT_NOERROR)
+			GMT_Report (API, GMT_MSG_ERROR, "Failed to free grid with %s bounds\n", limit[end]);
+		Return (GMT_MODULE_CANCELLED);
+	}
+
 	if (gmt_M_is_verbose (GMT, GMT_MSG_WARNING)) surface_check_errors (GMT, &C);	/* Report on mean misfit and curvature */
 
 	surface_restore_planar_trend (&C);	/* Restore the least-square plane we removed earlier */
@@ -2213,6 +2539,7 @@ EXTERN_MSC int GMT_surface (void *V_API, int mode, void *args) {
 	/* Clean up after ourselves */
 
 	gmt_M_free (GMT, C.Briggs);
+	gmt_M_free (GMT, C.briggs_index);
 	gmt_M_free (GMT, C.status);
 	gmt_M_free (GMT, C.fraction);
 	for (end = LO; end <= HI; end++) if (C.set_limit[end]) {	/* Free lower|upper surface constrain grids */
@@ -777,7 +777,15 @@ EXTERN_MSC int GMT_triangulate(void *V_API, int mode, void *args) {
 		double inv_delta_min = 1.0 / MIN (GMT->common.R.inc[GMT_X], GMT->common.R.inc[GMT_Y]);	/* Inverse minimum spacing */
 		double s_H = 1.0, distSum = 0.0, sigma = 0.0;
 		double *CoordsX = NULL, *CoordsY = NULL;
+		int band, n_bands = 1, rows_per_band, col_a, col_b, e;
+		openmp_int brow_min, brow_max;
+		double xl, xr, xe1, ye1, xe2, ye2, tt, u;
+		double x0 = Grid->header->wesn[XLO], xinc_i = 1.0 / Grid->header->inc[GMT_X];
 		GMT_Report (API, GMT_MSG_INFORMATION, "Perform Delaunay triangle gridding\n");
+#ifdef _OPENMP
+		n_bands = omp_get_max_threads ();
+#endif
+		rows_per_band = (n_rows + n_bands - 1) / n_bands;
 		if (!Ctrl->F.active) {
 			if (!Ctrl->E.active) Ctrl->E.value = GMT->session.d_NaN;
 			for (p = 0; p < Grid->header->size; p++) Grid->data[p] = (gmt_grdfloat)Ctrl->E.value;	/* initialize grid */
@@ -789,10 +797,19 @@ EXTERN_MSC int GMT_triangulate(void *V_API, int mode, void *args) {
 			for (p = 0; p < Grid->header->size; p++) Slopes->data[p] = (gmt_grdfloat)tan (D2R * Slopes->data[p]);	/* Take tan or slopes here instead of later */
 		}
 
-		for (k = ij = 0; k < np; k++) {
+#ifdef _OPENMP
+#pragma omp parallel for private(band,brow_min,brow_max,k,ij,p,row,col,xp,yp,zj,zk,zl,vx,vy,xkj,ykj,zkj,xlj,ylj,zlj,f,a,b,c,col_min,col_max,row_min,row_max,col_a,col_b,e,xl,xr,xe1,ye1,xe2,ye2,tt,u,hj,hk,hl,vj,vk,vl,distv1,distv2,distv3,uv1,uv2,uv3,dv1,dv2,dv3,distSum,sigma) shared(GMT,Grid,Slopes,Ctrl,np,link,xx,yy,zz,hh,vv,CoordsX,CoordsY,n_columns,n_rows,n_bands,rows_per_band,inv_delta_min,s_H,x0,xinc_i)
+#endif
+		for (band = 0; band < n_bands; band++) {
+			/* Each band owns a disjoint set of grid rows; every thread scans all the triangles but
+			 * only fills spans inside its own band, so no node is ever written by two threads */
+			brow_min = (openmp_int)(band * rows_per_band);
+			brow_max = (openmp_int)(MIN ((band + 1) * rows_per_band, n_rows) - 1);
+			for (k = 0; k < np; k++) {
 
 			/* Find equation for the plane as z = ax + by + c */
 
+			ij = 3 * k;
 			vx[0] = vx[3] = xx[link[ij]];	vy[0] = vy[3] = yy[link[ij]];	zj = zz[link[ij++]];
 			vx[1] = xx[link[ij]];		vy[1] = yy[link[ij]];		zk = zz[link[ij++]];
 			vx[2] = xx[link[ij]];		vy[2] = yy[link[ij]];		zl = zz[link[ij++]];
@@ -823,18 +840,44 @@ EXTERN_MSC int GMT_triangulate(void *V_API, int mode, void *args) {
 			/* Triangle covers boundary, left or right. */
 			if (col_min < 0) col_min = 0;
 			if (col_max >= n_columns) col_max = Grid->header->n_columns - 1;
-			/* Triangle covers boundary, top or bottom. */
-			if (row_min < 0) row_min = 0;
-			if (row_max >= n_rows) row_max = Grid->header->n_rows - 1;
+			/* Clip the triangle rows to the region and to this band. */
+			if (row_min < (int)brow_min) row_min = (int)brow_min;
+			if (row_max > (int)brow_max) row_max = (int)brow_max;
+			if (row_min > row_max) continue;	/* Triangle does not reach this band */
 
 			for (row = (openmp_int)row_min; row <= (openmp_int)row_max; row++) {
 				yp = gmt_M_grd_row_to_y (GMT, row, Grid->header);
-				p = gmt_M_ijp (Grid->header, row, col_min);
-				for (col = (openmp_int)col_min; col <= (openmp_int)col_max; col++, p++) {
-					if (Ctrl->F.active && !gmt_M_is_fnan (Grid->data[p])) continue;	/* Only do interpolation at this point if grid == NaN so check before doing gmt_non_zero_winding */
+
+				/* Scanline fill: intersect the triangle edges with this row to get the span of
+				 * inside nodes directly instead of running a winding test per node */
+				xl = DBL_MAX;	xr = -DBL_MAX;
+				for (e = 0; e < 3; e++) {
+					xe1 = vx[e];	ye1 = vy[e];	xe2 = vx[e+1];	ye2 = vy[e+1];
+					if ((ye1 < yp && ye2 < yp) || (ye1 > yp && ye2 > yp)) continue;	/* Edge does not reach this row */
+					if (ye1 == ye2) {	/* Horizontal edge lying on this row */
+						if (MIN (xe1, xe2) < xl) xl = MIN (xe1, xe2);
+						if (MAX (xe1, xe2) > xr) xr = MAX (xe1, xe2);
+					}
+					else {	/* Edge crosses (or touches) this row */
+						tt = xe1 + (yp - ye1) * (xe2 - xe1) / (ye2 - ye1);
+						if (tt < xl) xl = tt;
+						if (tt > xr) xr = tt;
+					}
+				}
+				if (xl > xr) continue;	/* Row misses the triangle */
+				/* Convert the span to node columns, keeping nodes exactly on the edges as before */
+				u = (xl - x0) * xinc_i - Grid->header->xy_off;
+				col_a = (int)ceil (u - GMT_CONV8_LIMIT);
+				u = (xr - x0) * xinc_i - Grid->header->xy_off;
+				col_b = (int)floor (u + GMT_CONV8_LIMIT);
+				if (col_a < col_min) col_a = col_min;
+				if (col_b > col_max) col_b = col_max;
+
+				p = gmt_M_ijp (Grid->header, row, col_a);
+				for (col = (openmp_int)col_a; col <= (openmp_int)col_b; col++, p++) {
+					if (Ctrl->F.active && !gmt_M_is_fnan (Grid->data[p])) continue;	/* Only do interpolation at this point if grid == NaN */
 
 					xp = gmt_M_grd_col_to_x (GMT, col, Grid->header);
-					if (!gmt_non_zero_winding (GMT, xp, yp, vx, vy, 4)) continue;	/* Outside */
 
 					if (Ctrl->D.dir == GMT_X)	/* d/dx of solution */
 						Grid->data[p] = (gmt_grdfloat)a;
@@ -869,7 +912,8 @@ EXTERN_MSC int GMT_triangulate(void *V_API, int mode, void *args) {
 						Grid->data[p] = (gmt_grdfloat)(a * xp + b * yp + c);
 				}
 			}
-		}
+			}	/* End of triangle loop */
+		}	/* End of band loop */
 
 		if (GMT_Set_Comment (API, GMT_IS_GRID, GMT_COMMENT_IS_OPTION | GMT_COMMENT_IS_COMMAND, options, Grid)) {
 			error = API->error;	goto time_to_let_go;
@@ -76,6 +76,14 @@ struct GRDBARB_CTRL {
 	} Z;
 };
 
+struct GRDBARB_DATA {	/* Precomputed geometry for one wind barb */
+	double x, y;		/* User coordinates of the node */
+	double plot_x, plot_y;	/* Plot coordinates of the (justified) barb origin */
+	double azim;		/* Data azimuth, later replaced by the plot direction */
+	double length;		/* Wind speed in user units */
+	double value;		/* The value used for CPT lookups */
+};
+
 GMT_LOCAL void *New_Ctrl (struct GMT_CTRL *GMT) {	/* Allocate and initialize a new control structure */
 	struct GRDBARB_CTRL *C = NULL;
 	
@@ -238,12 +246,16 @@ GMT_LOCAL int parse (struct GMT_CTRL *GMT, struct GRDBARB_CTRL *Ctrl, struct GMT
 EXTERN_MSC int GMT_grdbarb (void *V_API, int mode, void *args) {
 	unsigned int justify, row, col, col_0, row_0, d_col, d_row, k, n_warn[1] = {0};
 	int error = 0;
-	
-	uint64_t ij;
+	openmp_int i;	/* Must be signed due to OpenMP restrictions */
+
+	uint64_t ij, n = 0;
+	size_t n_alloc = 0;
 
 	double tmp, x, y, plot_x, plot_y, x_off, y_off;
 	double x2, y2, wesn[4], value, vec_length, vec_azim, c, s;
 
+	struct GRDBARB_DATA *data = NULL;
+	struct GMT_BARB_GLYPH glyph;
 	struct GMT_GRID *Grid[2] = {NULL, NULL};
 	struct GMT_PALETTE *P = NULL;
 	struct GRDBARB_CTRL *Ctrl = NULL;
@@ -384,7 +396,10 @@ EXTERN_MSC int GMT_grdbarb (void *V_API, int mode, void *args) {
 			gmt_M_rgb_copy (Ctrl->G.fill.rgb, GMT->session.no_rgb);
 	}
 
-	PSL_command (GMT->PSL, "V\n");
+	/* First pass: Collect the nodes that survive the -I stride, NaN, and inside tests.
+	 * Note: gmt_map_outside updates GMT->current.map.this_x|y_status so it must stay serial. */
+
+	gmt_set_meminc (GMT, GMT_BIG_CHUNK);	/* Only allocate a sizeable amount of GRDBARB_DATA structures at the time */
 	for (row = row_0; row < Grid[1]->header->n_rows; row += d_row) {
 		y = gmt_M_grd_row_to_y (GMT, row, Grid[0]->header);	/* Latitude OR y OR radius */
 		for (col = col_0; col < Grid[1]->header->n_columns; col += d_col) {
@@ -414,48 +429,76 @@ EXTERN_MSC int GMT_grdbarb (void *V_API, int mode, void *args) {
 				vec_azim = atan2d (-Grid[GMT_X]->data[ij], -Grid[GMT_Y]->data[ij]);	/* Convert dy,dx to azimuth */
 				value = vec_length;
 			}
-			
-			if (Ctrl->C.active) {	/* Get color based on the wind speed */
-				gmt_get_fill_from_z (GMT, P, value, &Ctrl->G.fill);
-			}
-			if (Ctrl->W.cpt_effect) {	/* Should color apply to pen, fill, or both [fill] */
-				if (Ctrl->W.pen.cptmode & 1)	/* Change pen color via CPT */
-					gmt_M_rgb_copy (Ctrl->W.pen.rgb, Ctrl->G.fill.rgb);
-			}
-			if (Ctrl->C.active) {	/* Update pen and fill color settings */
-				gmt_M_rgb_copy (Ctrl->W.pen.rgb, Ctrl->G.fill.rgb);
-				gmt_setpen (GMT, &Ctrl->W.pen);
-				gmt_setfill (GMT, &Ctrl->G.fill, Ctrl->W.active);
-				gmt_init_barb_param (GMT, &Ctrl->Q.B, true, Ctrl->W.active, &Ctrl->W.pen, true, &Ctrl->G.fill);
-			}
 
-			gmt_geo_to_xy (GMT, x, y, &plot_x, &plot_y);
-			if (Ctrl->T.active)	/* Deal with negative scales in x and/or y which affect the azimuths */
-				gmt_flip_azim_d (GMT, &vec_azim);
-			if (!gmt_M_is_geographic (GMT, GMT_IN))	/* Cartesian angle; change to azimuth */
-				vec_azim = 90.0 - vec_azim;
-			else	/* Convert geo azimuth to map direction */
-				vec_azim = gmt_azim_to_angle (GMT, x, y, 0.1, vec_azim);
-			if (GMT->current.proj.projection == GMT_POLAR) {	/* Must rotate azimuth since circular projection */
-				double x_orient;
-				x_orient = (GMT->current.proj.got_azimuths) ? -(x + GMT->current.proj.p_base_angle) : x - GMT->current.proj.p_base_angle - 90.0;
-				vec_azim += x_orient;
-			}
-			sincosd (vec_azim, &s, &c);
-			x2 = plot_x + Ctrl->Q.B.length * c;
-			y2 = plot_y + Ctrl->Q.B.length * s;
-
-			justify = PSL_vec_justify (Ctrl->Q.B.status);	/* Return justification as 0-2 */
-			if (justify) {	/* Justify wind barb at center, or tip [beginning] */
-				x_off = justify * 0.5 * (x2 - plot_x);	y_off = justify * 0.5 * (y2 - plot_y);
-				plot_x -= x_off;	plot_y -= y_off;
-				x2 -= x_off;		y2 -= y_off;
-			}
-			n_warn[0]++;
-			gmt_draw_barb (GMT, plot_x, plot_y, y, vec_azim, vec_length, Ctrl->Q.B, &Ctrl->W.pen, &Ctrl->G.fill, Ctrl->W.active);
+			if (n == n_alloc) data = gmt_M_malloc (GMT, data, n, &n_alloc, struct GRDBARB_DATA);
+			data[n].x = x;	data[n].y = y;
+			data[n].azim = vec_azim;	data[n].length = vec_length;	data[n].value = value;
+			n++;
+		}
+	}
+
+	/* Second pass: Convert the surviving nodes to plot coordinates and directions.  The per-point
+	 * projection functions are stateless for all projections except GMT_GENPER, whose forward
+	 * routine updates GMT->current.proj.g_outside (see gmt_grd_project), so unless that projection
+	 * was selected we can spread the nodes among the available threads. */
+
+	justify = PSL_vec_justify (Ctrl->Q.B.status);	/* Return justification as 0-2 */
+#ifdef _OPENMP
+#pragma omp parallel for if (GMT->current.proj.projection_GMT != GMT_GENPER) private(i,vec_azim,plot_x,plot_y,x2,y2,s,c,x_off,y_off) shared(GMT,Ctrl,data,n,justify)
+#endif
+	for (i = 0; i < (openmp_int)n; i++) {
+		vec_azim = data[i].azim;
+		gmt_geo_to_xy (GMT, data[i].x, data[i].y, &plot_x, &plot_y);
+		if (Ctrl->T.active)	/* Deal with negative scales in x and/or y which affect the azimuths */
+			gmt_flip_azim_d (GMT, &vec_azim);
+		if (!gmt_M_is_geographic (GMT, GMT_IN))	/* Cartesian angle; change to azimuth */
+			vec_azim = 90.0 - vec_azim;
+		else	/* Convert geo azimuth to map direction */
+			vec_azim = gmt_azim_to_angle (GMT, data[i].x, data[i].y, 0.1, vec_azim);
+		if (GMT->current.proj.projection == GMT_POLAR) {	/* Must rotate azimuth since circular projection */
+			double x_orient;
+			x_orient = (GMT->current.proj.got_azimuths) ? -(data[i].x + GMT->current.proj.p_base_angle) : data[i].x - GMT->current.proj.p_base_angle - 90.0;
+			vec_azim += x_orient;
+		}
+		sincosd (vec_azim, &s, &c);
+		x2 = plot_x + Ctrl->Q.B.length * c;
+		y2 = plot_y + Ctrl->Q.B.length * s;
+
+		if (justify) {	/* Justify wind barb at center, or tip [beginning] */
+			x_off = justify * 0.5 * (x2 - plot_x);	y_off = justify * 0.5 * (y2 - plot_y);
+			plot_x -= x_off;	plot_y -= y_off;
 		}
+		data[i].plot_x = plot_x;	data[i].plot_y = plot_y;
+		data[i].azim = vec_azim;	/* Now the plot direction */
+	}
+
+	/* Final pass: Emit the barbs in node order.  Both the CPT machinery and PSL are serial, but
+	 * consecutive barbs of the same glyph class reuse the symbol chain via the glyph cache. */
+
+	gmt_M_memset (&glyph, 1, struct GMT_BARB_GLYPH);
+	glyph.ispd = -1;	/* Mark the glyph cache as empty */
+	PSL_command (GMT->PSL, "V\n");
+	for (i = 0; i < (openmp_int)n; i++) {
+		if (Ctrl->C.active) {	/* Get color based on the wind speed */
+			gmt_get_fill_from_z (GMT, P, data[i].value, &Ctrl->G.fill);
+		}
+		if (Ctrl->W.cpt_effect) {	/* Should color apply to pen, fill, or both [fill] */
+			if (Ctrl->W.pen.cptmode & 1)	/* Change pen color via CPT */
+				gmt_M_rgb_copy (Ctrl->W.pen.rgb, Ctrl->G.fill.rgb);
+		}
+		if (Ctrl->C.active) {	/* Update pen and fill color settings */
+			gmt_M_rgb_copy (Ctrl->W.pen.rgb, Ctrl->G.fill.rgb);
+			gmt_setpen (GMT, &Ctrl->W.pen);
+			gmt_setfill (GMT, &Ctrl->G.fill, Ctrl->W.active);
+			gmt_init_barb_param (GMT, &Ctrl->Q.B, true, Ctrl->W.active, &Ctrl->W.pen, true, &Ctrl->G.fill);
+		}
+
+		n_warn[0]++;
+		gmt_draw_barb_glyph (GMT, data[i].plot_x, data[i].plot_y, data[i].y, data[i].azim, data[i].length, Ctrl->Q.B, &Ctrl->W.pen, &Ctrl->G.fill, Ctrl->W.active, &glyph);
 	}
 	PSL_command (GMT->PSL, "U\n");
+	gmt_M_free (GMT, data);
+	gmt_reset_meminc (GMT);
 	PSL->current.linewidth = 0.0;	/* Since we changed things under clip; this will force it to be set next */
 
 	if (!Ctrl->N.active) gmt_map_clip_off (GMT);
@@ -311,6 +311,7 @@ EXTERN_MSC int GMT_psbarb (void *V_API, int mode, void *args) {
 
 	struct GMT_PEN default_pen, current_pen;
 	struct GMT_FILL default_fill, current_fill, black, no_fill;
+	struct GMT_BARB_GLYPH glyph;
 	struct GMT_SYMBOL S;
 	struct GMT_PALETTE *P = NULL;
 	struct PSBARB_DATA *data = NULL;
@@ -594,8 +595,10 @@ EXTERN_MSC int GMT_psbarb (void *V_API, int mode, void *args) {
 		n_alloc = n;
 		data = gmt_M_malloc (GMT, data, 0, &n_alloc, struct PSBARB_DATA);
 
-		/* Now plot these symbols one at the time */
+		/* Now plot these symbols one at the time; barbs of the same glyph class reuse the symbol chain via the glyph cache */
 
+		gmt_M_memset (&glyph, 1, struct GMT_BARB_GLYPH);
+		glyph.ispd = -1;	/* Mark the glyph cache as empty */
 		PSL_command (GMT->PSL, "V\n");
 		for (i = 0; i < n; i++) {
 
@@ -616,7 +619,7 @@ EXTERN_MSC int GMT_psbarb (void *V_API, int mode, void *args) {
 					Ctrl->Q.B.length = data[i].dim[3];
 					Ctrl->Q.B.width  = data[i].dim[4];
 				}
-				gmt_draw_barb (GMT, xpos[item], data[i].y, data[i].dim[2], data[i].dim[0], data[i].dim[1], Ctrl->Q.B, &data[i].p, &data[i].f, data[i].outline);
+				gmt_draw_barb_glyph (GMT, xpos[item], data[i].y, data[i].dim[2], data[i].dim[0], data[i].dim[1], Ctrl->Q.B, &data[i].p, &data[i].f, data[i].outline, &glyph);
 			}
 		}
 		PSL_command (GMT->PSL, "U\n");
@@ -26,10 +26,11 @@
  * Date:	1-JUN-2017
  * Version:	6 API
  *
- * PUBLIC Functions include (4):
+ * PUBLIC Functions include (5):
  *
  *      gmt_barb_syntax          : Show wind barb option syntax
  *      gmt_draw_barb            : Plot wind barb
+ *      gmt_draw_barb_glyph      : Plot wind barb, reusing a cached glyph chain
  *      gmt_init_barb_param      : Initialize wind barb parameters
  *      gmt_parse_barb           : Parse wind barb options
  *
@@ -55,29 +56,29 @@ void gmt_barb_syntax (struct GMT_CTRL *GMT, char option, char *string, unsigned
 	if (mode & 1) GMT_Usage (API, 3, "+z Wind components (u,v) are given instead of (azimuth,speed) on input.");
 }
 
-int gmt_draw_barb (struct GMT_CTRL *GMT, double x0, double y0, double lat, double theta, double spd, struct GMT_BARB_ATTR B, struct GMT_PEN *pen, struct GMT_FILL *fill, unsigned int outline)
-{
+GMT_LOCAL void windbarb_build_glyph (int ispd, bool south, struct GMT_BARB_ATTR B, struct GMT_BARB_GLYPH *G)
+{	/* Build the custom symbol item chain for one glyph class: ispd quantized speed units on the
+	 * given hemisphere with the current -Q attributes.  The rotation (item 0) is set at draw time. */
 	double w1, dx, dy, y;
 	double s, c;
-	int i, ispd, n = 0, n_pennant, n_barb;
-	struct GMT_CUSTOM_SYMBOL symbol;
-	struct GMT_CUSTOM_SYMBOL_ITEM bs[GMT_LEN256];
-	double size[1];
-	char *text = "\0";
+	int i, n = 0, n_pennant, n_barb;
+	struct GMT_CUSTOM_SYMBOL_ITEM *bs = G->bs;
 
-	if (spd == 0.) return 0;
+	/* Remember the class this chain is built for so it can be reused */
+	G->ispd  = ispd;	G->south = south;
+	G->width = B.width;	G->length = B.length;	G->angle = B.angle;
 
 	/* make struct of custom symbol for wind barbs */
-	strcpy (symbol.name, "barb");
-	symbol.first = bs;
+	gmt_M_memset (&G->symbol, 1, struct GMT_CUSTOM_SYMBOL);
+	strcpy (G->symbol.name, "barb");
+	G->symbol.first = bs;
 
 	bs[n].action = GMT_SYMBOL_ROTATE;
-	bs[n].p[0] = theta-90.;
+	bs[n].p[0] = 0.;	/* Placeholder; each barb supplies its own rotation */
 	bs[n].next = bs+1;
 	n ++;
 
 	/* staff of wind barb */
-	ispd = irint (spd / B.scale * 2.);
 	n_pennant =  ispd / 10;
 	n_barb    = (ispd % 10) / 2;
 	if (ispd % 2) n_barb ++;
@@ -100,7 +101,7 @@ int gmt_draw_barb (struct GMT_CTRL *GMT, double x0, double y0, double lat, doubl
 	if (ispd == 1) y -= w1;  /* space for short barb */
 
 	/* on the southern hemisphere, put barbs on the righthand side of staff */
-	sincosd (copysign(B.angle, lat), &s, &c);
+	sincosd ((south) ? -B.angle : B.angle, &s, &c);
 	dx =  s * B.width / B.length;
 	dy = -c * B.width / B.length;
 
@@ -145,9 +146,36 @@ int gmt_draw_barb (struct GMT_CTRL *GMT, double x0, double y0, double lat, doubl
 		bs[i].pen  = NULL;
 	}
 	bs[n-1].next = NULL;
+}
+
+int gmt_draw_barb_glyph (struct GMT_CTRL *GMT, double x0, double y0, double lat, double theta, double spd, struct GMT_BARB_ATTR B, struct GMT_PEN *pen, struct GMT_FILL *fill, unsigned int outline, struct GMT_BARB_GLYPH *G)
+{	/* As gmt_draw_barb, but the caller owns the glyph cache so consecutive barbs of the same
+	 * class (i.e., same quantized speed and hemisphere) reuse the symbol item chain. */
+	int ispd;
+	bool south;
+	double size[1];
+	char *text = "\0";
+
+	if (spd == 0.) return 0;
+
+	ispd = irint (spd / B.scale * 2.);
+	south = (lat < 0.);
+	if (G->ispd != ispd || G->south != south || G->width != B.width || G->length != B.length || G->angle != B.angle)
+		windbarb_build_glyph (ispd, south, B, G);	/* First barb of this class; must build the chain */
+
+	G->bs[0].p[0] = theta-90.;	/* Only the rotation differs within a glyph class */
 
 	size[0] = B.length;
-	return gmt_draw_custom_symbol (GMT, x0, y0, size, text, &symbol, pen, fill, outline);
+	return gmt_draw_custom_symbol (GMT, x0, y0, size, text, &G->symbol, pen, fill, outline);
+}
+
+int gmt_draw_barb (struct GMT_CTRL *GMT, double x0, double y0, double lat, double theta, double spd, struct GMT_BARB_ATTR B, struct GMT_PEN *pen, struct GMT_FILL *fill, unsigned int outline)
+{	/* Draw a single wind barb with no glyph reuse */
+	struct GMT_BARB_GLYPH G;
+
+	gmt_M_memset (&G, 1, struct GMT_BARB_GLYPH);
+	G.ispd = -1;	/* Mark the cache as empty */
+	return gmt_draw_barb_glyph (GMT, x0, y0, lat, theta, spd, B, pen, fill, outline, &G);
 }
 
 /*! Deal with pen/fill settings */
@@ -32,8 +32,22 @@ struct GMT_BARB_ATTR {
 	struct GMT_FILL fill;	/* Fill */
 };
 
+struct GMT_BARB_GLYPH {
+	/* Cache for the symbol item chain of one wind barb glyph class.  Barbs with the same
+	 * quantized speed, hemisphere, and -Q attributes share identical geometry apart from the
+	 * rotation, so modules plotting many barbs reuse the chain instead of rebuilding it. */
+	int ispd;		/* Quantized speed class the chain was built for [-1 means empty cache] */
+	bool south;		/* True if the chain was built for a southern hemisphere station */
+	float width;		/* Width of wind barb the chain was built with */
+	float length;		/* Length of wind barb the chain was built with */
+	float angle;		/* Angle of wind barb the chain was built with */
+	struct GMT_CUSTOM_SYMBOL symbol;
+	struct GMT_CUSTOM_SYMBOL_ITEM bs[GMT_LEN256];
+};
+
 EXTERN_MSC void gmt_barb_syntax (struct GMT_CTRL *GMT, char option, char *string, unsigned int mode);
 EXTERN_MSC int gmt_draw_barb (struct GMT_CTRL *GMT, double x0, double y0, double lat, double theta, double spd, struct GMT_BARB_ATTR B, struct GMT_PEN *pen, struct GMT_FILL *fill, unsigned int outline);
+EXTERN_MSC int gmt_draw_barb_glyph (struct GMT_CTRL *GMT, double x0, double y0, double lat, double theta, double spd, struct GMT_BARB_ATTR B, struct GMT_PEN *pen, struct GMT_FILL *fill, unsigned int outline, struct GMT_BARB_GLYPH *G);
 EXTERN_MSC int gmt_init_barb_param (struct GMT_CTRL *GMT, struct GMT_BARB_ATTR *B, bool set, bool outline, struct GMT_PEN *pen, bool do_fill, struct GMT_FILL *fill);
 EXTERN_MSC int gmt_parse_barb (struct GMT_CTRL *GMT, char *text, struct GMT_BARB_ATTR *B, unsigned int mode);
 
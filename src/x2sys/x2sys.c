@@ -1416,7 +1416,8 @@ int x2sys_bix_read_index (struct GMT_CTRL *GMT, struct X2SYS_INFO *S, struct X2S
 	/* Reads the binned index file which is native binary and thus swab is an issue */
 	char index_file[PATH_MAX] = {""}, index_path[PATH_MAX] = {""};
 	FILE *fbin = NULL;
-	uint32_t i, index = 0, flag, no_of_tracks, id; /* These must remain uint32_t */
+	uint32_t i, index = 0, flag, no_of_tracks, id, *buf = NULL; /* These must remain uint32_t */
+	size_t n_buf = 0;
 
 	sprintf (index_file, "%s/%s_index.b", S->TAG, S->TAG);
 	x2sys_path (GMT, index_file, index_path);
@@ -1440,20 +1441,23 @@ int x2sys_bix_read_index (struct GMT_CTRL *GMT, struct X2SYS_INFO *S, struct X2S
 		if (index >= B->nm_bin) {
 			GMT_Report (GMT->parent, GMT_MSG_ERROR, "Bad bin index obtained from index file\n");
 			fclose (fbin);
+			gmt_M_free (GMT, buf);
+			return (GMT_GRDIO_READ_FAILED);
+		}
+		if (2 * (size_t)no_of_tracks > n_buf) {	/* Grow the scratch buffer so the whole bin can be read at once */
+			n_buf = 2 * (size_t)no_of_tracks;
+			buf = gmt_M_memory (GMT, buf, n_buf, uint32_t);
+		}
+		if (no_of_tracks && fread (buf, sizeof (uint32_t), 2 * (size_t)no_of_tracks, fbin) != 2 * (size_t)no_of_tracks) {
+			GMT_Report (GMT->parent, GMT_MSG_ERROR, "Read error bin index file\n");
+			fclose (fbin);
+			gmt_M_free (GMT, buf);
 			return (GMT_GRDIO_READ_FAILED);
 		}
 		B->base[index].first_track = B->base[index].last_track = x2sys_bix_make_track (GMT, 0, 0);
 		for (i = 0; i < no_of_tracks; i++) {
-			if (fread (&id, sizeof (uint32_t), 1U, fbin) != 1U) {
-				GMT_Report (GMT->parent, GMT_MSG_ERROR, "Read error bin index file\n");
-				fclose (fbin);
-				return (GMT_GRDIO_READ_FAILED);
-			}
-			if (fread (&flag, sizeof (uint32_t), 1U, fbin) != 1U) {
-				GMT_Report (GMT->parent, GMT_MSG_ERROR, "Read error bin index file\n");
-				fclose (fbin);
-				return (GMT_GRDIO_READ_FAILED);
-			}
+			id   = buf[2*i];
+			flag = buf[2*i+1];
 			if (swap) {
 				id = bswap32 (id);
 				flag = bswap32 (flag);
@@ -1464,6 +1468,7 @@ int x2sys_bix_read_index (struct GMT_CTRL *GMT, struct X2SYS_INFO *S, struct X2S
 		}
 	}
 	fclose (fbin);
+	gmt_M_free (GMT, buf);
 	return (X2SYS_NOERROR);
 }
 
@@ -1669,6 +1674,117 @@ int x2sys_err_fail (struct GMT_CTRL *GMT, int err, char *file) {
 
 /* Functions dealing with the reading of the COE ASCII database */
 
+#define X2SYS_COE_IDX_SUFFIX	"idx"		/* A COE dbase <file> may have a binary sidecar index <file>.idx */
+#define X2SYS_COE_IDX_MAGIC	"X2SYSCOEIDX1"	/* Magic string identifying version 1 of that index */
+
+struct X2SYS_COE_IDX {	/* One index entry per segment (crossing pair) in a COE dbase */
+	char trk[2][GMT_LEN64];	/* Name of the two tracks as given in the segment header */
+	uint64_t start;		/* File offset of the segment header record */
+	uint64_t stop;		/* File offset of the next segment header (or of EOF for the last segment) */
+};
+
+GMT_LOCAL int64_t x2sys_make_coe_index (struct GMT_CTRL *GMT, char *dbase, char *ifile, struct X2SYS_COE_IDX **I) {
+	/* Scan the ASCII COE dbase once, building the segment index, and save it as the binary
+	 * sidecar file ifile so later invocations can skip the scan.  Failure to write the sidecar
+	 * is not fatal (e.g., a read-only archive); the in-memory index is still returned.
+	 * Return the number of segments indexed, or 0 if the dbase could not be scanned. */
+	char line[GMT_BUFSIZ] = {""}, magic[GMT_LEN16] = {""};
+	int64_t d_mtime;
+	uint64_t n_seg = 0, d_size, offset, here;
+	size_t n_alloc = GMT_CHUNK;
+	FILE *fp = NULL, *fpi = NULL;
+	struct stat buf;
+	struct X2SYS_COE_IDX *idx = NULL;
+
+	if (stat (dbase, &buf)) return (0);	/* Inquiry about file failed somehow */
+	d_size = (uint64_t)buf.st_size;	d_mtime = (int64_t)buf.st_mtime;	/* For staleness detection on reuse */
+	if ((fp = fopen (dbase, "r")) == NULL) return (0);
+	idx = gmt_M_memory (GMT, NULL, n_alloc, struct X2SYS_COE_IDX);
+	offset = (uint64_t)ftell (fp);
+	while (fgets (line, GMT_BUFSIZ, fp)) {
+		here = offset;	offset = (uint64_t)ftell (fp);	/* here is the offset of the record just read */
+		if (line[0] != '>') continue;	/* Only segment headers enter the index */
+		if (n_seg) idx[n_seg-1].stop = here;
+		idx[n_seg].start = here;
+		sscanf (&line[2], "%s %*s %s", idx[n_seg].trk[0], idx[n_seg].trk[1]);	/* Format is trk_1 year_1 trk_2 year_2 ... */
+		n_seg++;
+		if (n_seg == n_alloc) {
+			size_t old_n_alloc = n_alloc;
+			n_alloc <<= 1;
+			idx = gmt_M_memory (GMT, idx, n_alloc, struct X2SYS_COE_IDX);
+			gmt_M_memset (&(idx[old_n_alloc]), n_alloc - old_n_alloc, struct X2SYS_COE_IDX);	/* Set to NULL/0 */
+		}
+	}
+	fclose (fp);
+	if (n_seg == 0) {	/* No segments found; nothing worth indexing */
+		gmt_M_free (GMT, idx);
+		return (0);
+	}
+	idx[n_seg-1].stop = offset;	/* Last segment runs to EOF */
+	strncpy (magic, X2SYS_COE_IDX_MAGIC, GMT_LEN16-1);
+	if ((fpi = fopen (ifile, "wb")) == NULL)	/* Cannot save the sidecar; we must rescan next time */
+		GMT_Report (GMT->parent, GMT_MSG_DEBUG, "x2sys_make_coe_index: Unable to create index file %s\n", ifile);
+	else {
+		if (fwrite (magic, sizeof (char), GMT_LEN16, fpi) != GMT_LEN16 || fwrite (&d_size, sizeof (uint64_t), 1, fpi) != 1 ||
+		    fwrite (&d_mtime, sizeof (int64_t), 1, fpi) != 1 || fwrite (&n_seg, sizeof (uint64_t), 1, fpi) != 1 ||
+		    fwrite (idx, sizeof (struct X2SYS_COE_IDX), n_seg, fpi) != n_seg) {
+			GMT_Report (GMT->parent, GMT_MSG_DEBUG, "x2sys_make_coe_index: Error writing index file %s\n", ifile);
+			fclose (fpi);
+			gmt_remove_file (GMT, ifile);	/* Do not leave a truncated index behind */
+		}
+		else {
+			fclose (fpi);
+			GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "Saved index of %" PRIu64 " crossing pairs to %s\n", n_seg, ifile);
+		}
+	}
+	idx = gmt_M_memory (GMT, idx, n_seg, struct X2SYS_COE_IDX);
+	*I = idx;
+	return ((int64_t)n_seg);
+}
+
+GMT_LOCAL bool x2sys_idx_involves (struct X2SYS_COE_IDX *E, char *trk) {
+	/* Return true if either track in this index entry matches trk, ignoring any file extension */
+	size_t len = strlen (trk);
+	unsigned int k;
+	for (k = 0; k < 2; k++)
+		if (!strncmp (E->trk[k], trk, len) && (E->trk[k][len] == '\0' || E->trk[k][len] == '.')) return (true);
+	return (false);
+}
+
+GMT_LOCAL int64_t x2sys_get_coe_index (struct GMT_CTRL *GMT, char *dbase, struct X2SYS_COE_IDX **I) {
+	/* Obtain the segment index for the given COE dbase, reading the binary sidecar <dbase>.idx
+	 * if it exists and is fresh, else (re)building it from scratch.  Return the number of index
+	 * entries, or 0 if no index could be obtained (caller then reads the dbase sequentially). */
+	bool ok = true;
+	char ifile[PATH_MAX] = {""}, magic[GMT_LEN16] = {""};
+	int64_t d_mtime = 0;
+	uint64_t n_seg = 0, d_size = 0;
+	FILE *fpi = NULL;
+	struct stat buf;
+	struct X2SYS_COE_IDX *idx = NULL;
+
+	if (stat (dbase, &buf)) return (0);	/* Inquiry about file failed somehow */
+	sprintf (ifile, "%s.%s", dbase, X2SYS_COE_IDX_SUFFIX);
+	if ((fpi = fopen (ifile, "rb")) != NULL) {	/* Found a sidecar index; see if we can trust it */
+		ok = (fread (magic, sizeof (char), GMT_LEN16, fpi) == GMT_LEN16 && !strncmp (magic, X2SYS_COE_IDX_MAGIC, GMT_LEN16) &&
+		      fread (&d_size, sizeof (uint64_t), 1, fpi) == 1 && d_size == (uint64_t)buf.st_size &&
+		      fread (&d_mtime, sizeof (int64_t), 1, fpi) == 1 && d_mtime == (int64_t)buf.st_mtime &&
+		      fread (&n_seg, sizeof (uint64_t), 1, fpi) == 1 && n_seg > 0);
+		if (ok) {
+			idx = gmt_M_memory (GMT, NULL, n_seg, struct X2SYS_COE_IDX);
+			ok = (fread (idx, sizeof (struct X2SYS_COE_IDX), n_seg, fpi) == n_seg);
+		}
+		fclose (fpi);
+		if (ok) {
+			*I = idx;
+			return ((int64_t)n_seg);
+		}
+		gmt_M_free (GMT, idx);
+		GMT_Report (GMT->parent, GMT_MSG_DEBUG, "x2sys_get_coe_index: Index %s is stale or unreadable - rebuilding\n", ifile);
+	}
+	return (x2sys_make_coe_index (GMT, dbase, ifile, I));
+}
+
 int64_t x2sys_read_coe_dbase (struct GMT_CTRL *GMT, struct X2SYS_INFO *S, char *dbase, char *ignorefile, double *wesn, char *fflag, int coe_kind, char *one_trk, struct X2SYS_COE_PAIR **xpairs, uint64_t *nx, uint64_t *nt) {
 	 /* S:		The X2SYS_INFO structure
 	 * dbase:	Name of the crossover data file [NULL for stdin]
@@ -1689,8 +1805,10 @@ int64_t x2sys_read_coe_dbase (struct GMT_CTRL *GMT, struct X2SYS_INFO *S, char *
 	unsigned int id[2], n_ignore = 0, n_tracks = 0;
 	bool more, skip, two_values = false, check_box, keep = true, no_time = false;
 	size_t n_alloc_x, n_alloc_p, n_alloc_t;
-	uint64_t k, p, n_pairs, rec_no = 0;
+	int64_t n_idx = 0;
+	uint64_t k, p, n_pairs, rec_no = 0, seg_no = 0;
 	double x, m, lon, dist[2], d_val;
+	struct X2SYS_COE_IDX *idx = NULL;
 
 	fp = stdin;	/* Default to stdin if dbase is NULL */
 	if (dbase && (fp = fopen (dbase, "r")) == NULL) {
@@ -1755,6 +1873,11 @@ int64_t x2sys_read_coe_dbase (struct GMT_CTRL *GMT, struct X2SYS_INFO *S, char *
 
 	check_box = (wesn && !(wesn[XLO] == wesn[XHI] && wesn[YLO] == wesn[YHI]));	/* Specified a rectangular box */
 
+	if (one_trk && dbase) {	/* Single-track query: get (or build) the sidecar index so unrelated pairs are skipped by seeking */
+		if ((n_idx = x2sys_get_coe_index (GMT, dbase, &idx)) > 0)
+			GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "Using index of %" PRId64 " crossing pairs to limit scan of %s\n", n_idx, dbase);
+	}
+
 	/* OK, our file has the required column name, lets build the format statement */
 
 	sprintf (fmt, "%%s %%s %%s %%s %%s %%s %%s %%s %%s %%s");	/* The standard 10 items up front */
@@ -1778,6 +1901,7 @@ int64_t x2sys_read_coe_dbase (struct GMT_CTRL *GMT, struct X2SYS_INFO *S, char *
 			return (-GMT_RUNTIME_ERROR);
 		}
 		n_items = sscanf (&line[2], "%s %d %s %d %s %s", trk[0], &year[0], trk[1], &year[1], info[0], info[1]);
+		seg_no++;	/* Segment number in the file; the current segment is idx[seg_no-1] when an index is available */
 		for (k = 0; k < strlen (trk[0]); k++) if (trk[0][k] == '.') trk[0][k] = '\0';
 		for (k = 0; k < strlen (trk[1]); k++) if (trk[1][k] == '.') trk[1][k] = '\0';
 		skip = false;
@@ -1789,7 +1913,15 @@ int64_t x2sys_read_coe_dbase (struct GMT_CTRL *GMT, struct X2SYS_INFO *S, char *
 				if (!strcmp (trk[0], ignore[k]) || !strcmp (trk[1], ignore[k])) skip = true;
 		}
 		if (skip) {	/* Skip this pair's data records */
-			while ((t = fgets (line, GMT_BUFSIZ, fp)) != NULL && line[0] != '>') rec_no++;
+			if (n_idx) {	/* Use the index to jump straight to the next pair involving one_trk */
+				while (seg_no < (uint64_t)n_idx && !x2sys_idx_involves (&idx[seg_no], one_trk)) seg_no++;
+				if (seg_no == (uint64_t)n_idx || fseek (fp, (off_t)idx[seg_no].start, SEEK_SET))
+					t = NULL;	/* No more candidate pairs (or the dbase shrank under us) */
+				else
+					t = fgets (line, GMT_BUFSIZ, fp);
+			}
+			else
+				while ((t = fgets (line, GMT_BUFSIZ, fp)) != NULL && line[0] != '>') rec_no++;
 			more = (t != NULL);
 			continue;	/* Back to top of loop */
 		}
@@ -1815,8 +1947,16 @@ int64_t x2sys_read_coe_dbase (struct GMT_CTRL *GMT, struct X2SYS_INFO *S, char *
 				skip = true;
 			}
 		}
-		if (skip) {
-			while ((t = fgets (line, GMT_BUFSIZ, fp)) != NULL && line[0] != '>') rec_no++;	/* Skip this pair's data records */
+		if (skip) {	/* Skip this duplicated pair's data records */
+			if (n_idx) {	/* Jump to the next pair involving one_trk as above */
+				while (seg_no < (uint64_t)n_idx && !x2sys_idx_involves (&idx[seg_no], one_trk)) seg_no++;
+				if (seg_no == (uint64_t)n_idx || fseek (fp, (off_t)idx[seg_no].start, SEEK_SET))
+					t = NULL;
+				else
+					t = fgets (line, GMT_BUFSIZ, fp);
+			}
+			else
+				while ((t = fgets (line, GMT_BUFSIZ, fp)) != NULL && line[0] != '>') rec_no++;
 			more = (t != NULL);
 			continue;	/* Back to top of loop */
 		}
@@ -1936,6 +2076,7 @@ int64_t x2sys_read_coe_dbase (struct GMT_CTRL *GMT, struct X2SYS_INFO *S, char *
 	}
 	x2sys_free_list (GMT, trk_list, n_tracks);
 	x2sys_free_list (GMT, ignore, n_ignore);
+	gmt_M_free (GMT, idx);
 
 	*nt = n_tracks;
 	return (n_pairs);
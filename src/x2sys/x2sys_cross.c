@@ -331,6 +331,82 @@ GMT_LOCAL void x2syscross_free_pairs (struct X2SYS_CROSS_PAIR *pair, uint64_t n_
 	}
 }
 
+GMT_LOCAL void x2syscross_strip_suffix (char *name, char *suffix) {
+	/* Chop off a trailing .<suffix> extension, if present, so names can be compared */
+	char *c = strrchr (name, '.');
+	if (c && !strcmp (&c[1], suffix)) c[0] = '\0';
+}
+
+GMT_LOCAL char *x2syscross_bin_candidates (struct GMT_CTRL *GMT, struct X2SYS_INFO *s, struct X2SYS_BIX *B, char **trk_name, uint64_t n_tracks) {
+	/* Use the TAG's track bin index (built by x2sys_binlist/x2sys_put, if available) as a
+	 * spatial candidate generator: only track pairs that co-occupy at least one bin can
+	 * possibly generate crossovers, so all other pairs can be skipped without even reading
+	 * the second track.  Returns NULL if no index databases exist for this TAG, else a
+	 * n_tracks by n_tracks matrix where entry [A*n_tracks+B] is 1 if the pair must be
+	 * examined.  Tracks absent from the index are conservatively paired with everyone. */
+	char track_file[PATH_MAX] = {""}, index_path[PATH_MAX] = {""}, name[PATH_MAX] = {""};
+	char **bix_name = NULL, *may_cross = NULL;
+	bool found;
+	uint64_t A, C, k, bin;
+	uint32_t n_bix_tracks = 0;
+	int64_t *inv = NULL;			/* Map from bin-index track id to input track number */
+	struct X2SYS_BIX_TRACK *trk1 = NULL, *trk2 = NULL;
+
+	sprintf (track_file, "%s/%s_index.b", s->TAG, s->TAG);
+	x2sys_path (GMT, track_file, index_path);
+	if (access (index_path, R_OK)) {	/* No bin index has been built for this TAG */
+		GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "No track bin index found for tag %s - must examine all track pairs\n", s->TAG);
+		return (NULL);
+	}
+	x2sys_bix_init (GMT, B, false);
+	if (x2sys_bix_read_tracks (GMT, s, B, 1, &n_bix_tracks) || x2sys_bix_read_index (GMT, s, B, false)) {
+		GMT_Report (GMT->parent, GMT_MSG_WARNING, "Unable to read the track bin index for tag %s - must examine all track pairs\n", s->TAG);
+		return (NULL);
+	}
+	may_cross = gmt_M_memory (GMT, NULL, n_tracks * n_tracks, char);
+	inv = gmt_M_memory (GMT, NULL, n_bix_tracks, int64_t);
+	bix_name = gmt_M_memory (GMT, NULL, n_bix_tracks, char *);
+	for (k = 0; k < n_bix_tracks; k++) {	/* Get index track names without any extension */
+		inv[k] = GMT_NOTSET;
+		if (B->head[k].trackname == NULL) continue;	/* Unused id */
+		bix_name[k] = strdup (B->head[k].trackname);
+		x2syscross_strip_suffix (bix_name[k], s->suffix);
+	}
+	for (A = 0; A < n_tracks; A++) {	/* Match the input tracks to the index entries */
+		may_cross[A*n_tracks+A] = 1;	/* Internal crossovers are always possible */
+		strncpy (name, trk_name[A], PATH_MAX-1);
+		x2syscross_strip_suffix (name, s->suffix);
+		for (k = 0, found = false; !found && k < n_bix_tracks; k++) {
+			if (bix_name[k] && !strcmp (name, bix_name[k])) {
+				inv[k] = A;
+				found = true;
+			}
+		}
+		if (!found) {	/* Not in the index so we cannot rule out any partner */
+			GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "Track %s not in the bin index - will examine all its pairs\n", trk_name[A]);
+			for (C = 0; C < n_tracks; C++)
+				may_cross[A*n_tracks+C] = may_cross[C*n_tracks+A] = 1;
+		}
+	}
+	for (bin = 0; bin < B->nm_bin; bin++) {	/* Flag all pairs of input tracks that share a bin */
+		if (B->base[bin].n_tracks == 0) continue;	/* Empty bin */
+		for (trk1 = B->base[bin].first_track->next_track; trk1; trk1 = trk1->next_track) {	/* First entry is just the list anchor */
+			if (trk1->track_id >= n_bix_tracks || inv[trk1->track_id] == GMT_NOTSET) continue;	/* Not an input track */
+			A = inv[trk1->track_id];
+			for (trk2 = trk1->next_track; trk2; trk2 = trk2->next_track) {
+				if (trk2->track_id >= n_bix_tracks || inv[trk2->track_id] == GMT_NOTSET) continue;	/* Not an input track */
+				C = inv[trk2->track_id];
+				may_cross[A*n_tracks+C] = may_cross[C*n_tracks+A] = 1;
+			}
+		}
+	}
+	for (k = 0; k < n_bix_tracks; k++) gmt_M_str_free (bix_name[k]);
+	gmt_M_free (GMT, bix_name);
+	gmt_M_free (GMT, inv);
+	x2sys_bix_free (GMT, B);	/* Done with the index databases; the gap settings in B are unaffected */
+	return (may_cross);
+}
+
 GMT_LOCAL bool x2syscross_is_outside_region (struct GMT_CTRL *GMT, double lon, double lat, bool geo) {
 	if (!GMT->common.R.active[RSET]) return false;	/* Requires -R to be outside */
 	if (lat < GMT->common.R.wesn[YLO] || lat > GMT->common.R.wesn[YHI]) return true;	/* Outside y range */
@@ -403,6 +479,7 @@ EXTERN_MSC int GMT_x2sys_cross (void *V_API, int mode, void *args) {
 	bool has_time[2];			/* true for each tracks that actually has a time column */
 	bool *duplicate = NULL;			/* Array, true for any track that is already listed */
 	bool cmdline_files = false;		/* true if files where given directly on the command line */
+	char *may_cross = NULL;			/* Matrix flagging which track pairs share at least one bin (if bin index exists) */
 
 	size_t n_alloc = 1;
 
@@ -665,6 +742,9 @@ EXTERN_MSC int GMT_x2sys_cross (void *V_API, int mode, void *args) {
 		Crashout (error);
 	}
 
+	/* See if the TAG's track bin index can tell us which pairs never share a bin */
+	may_cross = x2syscross_bin_candidates (GMT, s, &Bix, trk_name, n_tracks);
+
 	for (A = 0; A < n_tracks; A++) {	/* Loop over all files */
 		if (duplicate[A]) continue;
 
@@ -723,6 +803,8 @@ EXTERN_MSC int GMT_x2sys_cross (void *V_API, int mode, void *args) {
 
 			if (Ctrl->A.active && !x2syscross_combo_ok (trk_name[A], trk_name[B], pair, n_pairs)) continue;	/* Do not want this combo */
 
+			if (may_cross && !may_cross[A*n_tracks+B]) continue;	/* These two tracks never share a bin so no crossovers are possible */
+
 			if (Ctrl->C.active) tic = clock();	/* To report execution time from this pair */
 
 			if (same) {	/* Just set pointers */
@@ -1085,6 +1167,7 @@ EXTERN_MSC int GMT_x2sys_cross (void *V_API, int mode, void *args) {
 	gmt_M_free (GMT, xdata[SET_B]);
 	gmt_M_free (GMT, out);
 	gmt_M_free (GMT, duplicate);
+	gmt_M_free (GMT, may_cross);
 	if (n_data_col) {
 		gmt_M_free (GMT, t);
 		gmt_M_free (GMT, y);
@@ -46,9 +46,6 @@ struct X2SYS_MERGE_CTRL {
 	} M;
 };
 
-GMT_LOCAL void x2sysmerge_clear_mem (struct GMT_CTRL *GMT, char **pairs_base, char **pairs_merge, uint64_t *map_base_start, uint64_t *map_base_end,
-                          uint64_t *map_merge_start, uint64_t *map_merge_end, uint64_t n_base, uint64_t n_merge);
-
 static void *New_Ctrl (struct GMT_CTRL *GMT) {	/* Allocate and initialize a new control structure */
 	struct X2SYS_MERGE_CTRL *C;
 
@@ -136,11 +133,9 @@ static int parse (struct GMT_CTRL *GMT, struct X2SYS_MERGE_CTRL *Ctrl, struct GM
 #define Return(code) {Free_Ctrl (GMT, Ctrl); gmt_end_module (GMT, GMT_cpy); bailout (code);}
 
 EXTERN_MSC int GMT_x2sys_merge (void *V_API, int mode, void *args) {
-	uint64_t  i, j, k, n_base, n_merge, merge_start, *map_merge_end = NULL;
-	uint64_t *map_base_start = NULL, *map_base_end = NULL, *map_merge_start = NULL;
+	uint64_t n_merged = 0, n_left;
 	int error;
-	size_t n_alloc;
-	char line[GMT_BUFSIZ] = {""}, **pairs_base = NULL, **pairs_merge = NULL;
+	char line[GMT_BUFSIZ] = {""}, merge_line[GMT_BUFSIZ] = {""}, *t = NULL, *tm = NULL;
 	FILE *fp_base = NULL, *fp_merge = NULL;
 	struct GMT_RECORD *Out = NULL;
 	struct X2SYS_MERGE_CTRL *Ctrl = NULL;
@@ -176,140 +171,68 @@ EXTERN_MSC int GMT_x2sys_merge (void *V_API, int mode, void *args) {
 		Return (GMT_ERROR_ON_FOPEN);
 	}
 
-	n_alloc = GMT_CHUNK;
-	map_base_start = gmt_M_memory (GMT, NULL, n_alloc, uint64_t);
-	map_base_end =   gmt_M_memory (GMT, NULL, n_alloc, uint64_t);
-	pairs_base =     gmt_M_memory (GMT, NULL, n_alloc, char *);
-
-	map_merge_start = gmt_M_memory (GMT, NULL, n_alloc, uint64_t);
-	map_merge_end =   gmt_M_memory (GMT, NULL, n_alloc, uint64_t);
-	pairs_merge =     gmt_M_memory (GMT, NULL, n_alloc, char *);
-
-	/* Read in the main COEs dbase and store the pair track names */
-	n_base = 0;		k = 1;
-	while (fgets (line, GMT_BUFSIZ, fp_base)) {	/*  */
-		if (line[0] == '>') {
-			map_base_start[n_base] = k;
-			if (n_base) map_base_end[n_base-1] = k - 1;
-			pairs_base[n_base] = gmt_M_memory (GMT, NULL, 24, char);
-			strncpy(pairs_base[n_base], &line[2], 19);
-			n_base++;
-			if (n_base == n_alloc) {
-				n_alloc <<= 1;
-				map_base_start = gmt_M_memory (GMT, map_base_start, n_alloc, uint64_t);
-				map_base_end =   gmt_M_memory (GMT, map_base_end, n_alloc, uint64_t);
-				pairs_base =     gmt_M_memory (GMT, pairs_base, n_alloc, char *);
-			}
-		}
-
-		k++;
-	}
-	map_base_end[n_base - 1] = k - 1;	/* This one was not yet assigned */
-	rewind (fp_base);
-
-	/* Read in the updated COEs dbase and store the pair track names */
-	n_alloc = GMT_CHUNK;
-	n_merge = 0;		k = 1;
-	while (fgets (line, GMT_BUFSIZ, fp_merge)) {	/*  */
-		if (line[0] == '>') {
-			map_merge_start[n_merge] = k;
-			if (n_merge) map_merge_end[n_merge-1] = k - 1;
-			pairs_merge[n_merge] = gmt_M_memory (GMT, NULL, 24, char);
-			strncpy(pairs_merge[n_merge], &line[2], 19);
-			n_merge++;
-			if (n_merge == n_alloc) {
-				n_alloc <<= 1;
-				map_merge_start = gmt_M_memory (GMT, map_merge_start, n_alloc, uint64_t);
-				map_merge_end   = gmt_M_memory (GMT, map_merge_end, n_alloc, uint64_t);
-				pairs_merge     = gmt_M_memory (GMT, pairs_merge, n_alloc, char *);
-			}
-		}
-
-		k++;
-	}
-	map_merge_end[n_merge - 1] = k - 1;	/* This one was not yet assigned */
-	rewind (fp_merge);
-
 	if (GMT_Init_IO (API, GMT_IS_DATASET, GMT_IS_TEXT, GMT_OUT, GMT_ADD_DEFAULT, 0, options) != GMT_NOERROR) {	/* Establishes data output */
 		fclose (fp_merge);
 		fclose (fp_base);
-		x2sysmerge_clear_mem (GMT, pairs_base, pairs_merge, map_base_start, map_base_end, map_merge_start, map_merge_end, n_base, n_merge);
 		Return (API->error);
 	}
 	if (GMT_Begin_IO (API, GMT_IS_DATASET, GMT_OUT, GMT_HEADER_ON) != GMT_NOERROR) {
 		fclose (fp_merge);
 		fclose (fp_base);
-		x2sysmerge_clear_mem (GMT, pairs_base, pairs_merge, map_base_start, map_base_end, map_merge_start, map_merge_end, n_base, n_merge);
 		Return (API->error);	/* Enables data output and sets access mode */
 	}
 	Out = gmt_new_record (GMT, NULL, line);	/* Only text output */
 	gmt_set_tableheader (GMT, GMT_OUT, true);	/* Turn on -ho explicitly */
 
-	/* Jump comment lines in both files and osition the file pointer into the first data line */
-	k = i = 0;
-	while (fgets (line, GMT_BUFSIZ, fp_merge) && line[0] == '#') k++;	/* Jump the comment lines in the to-merge file */
-	rewind (fp_merge);
-	while (i < k && fgets (line, GMT_BUFSIZ, fp_merge)) i++;
+	/* Wind the to-merge file past its comment block so merge_line holds its first segment header */
+	while ((tm = fgets (merge_line, GMT_BUFSIZ, fp_merge)) != NULL && merge_line[0] == '#');
+	if (tm == NULL) merge_line[0] = '\0';	/* Empty update file; the merge becomes a straight copy */
 
-	k = i = 0;
-	while (fgets (line, GMT_BUFSIZ, fp_base) && line[0] == '#') {
+	/* Echo the comment block of the main file, leaving its first segment header in line */
+	while ((t = fgets (line, GMT_BUFSIZ, fp_base)) != NULL && line[0] == '#')
 		GMT_Put_Record (API, GMT_WRITE_TABLE_HEADER, line);
-		k++;
-	}
-	rewind (fp_base);
-	while (i < k && fgets (line, GMT_BUFSIZ, fp_base)) i++;
-
-	/* Do the merging. COEs present in file dbase2 replace their pairs in dbase1 */
-	merge_start = 0;
-	for (i = 0; i < n_base; i++) {
-		for (j = merge_start; j < n_merge; j++) {
-			if (!strcmp(pairs_base[i], pairs_merge[j])) {		 /* Update these COEs */
-				for (k = map_merge_start[j]; k <= map_merge_end[j]; k++) {
-					if (!fgets (line, GMT_BUFSIZ, fp_merge)) {
-						GMT_Report (API, GMT_MSG_ERROR, "Read error in merge file line\n");
-						fclose (fp_merge);
-						fclose (fp_base);
-						x2sysmerge_clear_mem (GMT, pairs_base, pairs_merge, map_base_start, map_base_end, map_merge_start, map_merge_end, n_base, n_merge);
-						Return (GMT_RUNTIME_ERROR);
-					}
-					GMT_Put_Record (API, GMT_WRITE_DATA, Out);
-				}
-				for (k = map_base_start[i]; k <= map_base_end[i]; k++) {	/* Advance also in the base file */
-					if (!fgets (line, GMT_BUFSIZ, fp_base)) {
-						GMT_Report (API, GMT_MSG_ERROR, "Read error in base file\n");
-						fclose (fp_merge);
-						fclose (fp_base);
-						x2sysmerge_clear_mem (GMT, pairs_base, pairs_merge, map_base_start, map_base_end, map_merge_start, map_merge_end, n_base, n_merge);
-						Return (GMT_RUNTIME_ERROR);
-					}
-				}
-
-				merge_start = j + 1;
-				break;		/* Since we found this to update, no need to continue seeking for another repetition */
-			}
-			else if (j == (n_merge - 1)) {	/* Not equal. So do not to update, just recopy */
-				for (k = map_base_start[i]; k <= map_base_end[i]; k++) {
-					if (!fgets (line, GMT_BUFSIZ, fp_base)) {
-						GMT_Report (API, GMT_MSG_ERROR, "Read error in base file\n");
-						fclose (fp_merge);
-						fclose (fp_base);
-						x2sysmerge_clear_mem (GMT, pairs_base, pairs_merge, map_base_start, map_base_end, map_merge_start, map_merge_end, n_base, n_merge);
-						Return (GMT_RUNTIME_ERROR);
-					}
-					GMT_Put_Record (API, GMT_WRITE_DATA, Out);
-				}
-			}
+
+	/* Do the merging in a single streaming pass.  COEs present in the -M file replace their pairs
+	 * from the -A file; all other -A segments are copied through verbatim.  Since both files list
+	 * their crossing pairs in the same order and the -M file introduces no new pairs, one lookahead
+	 * segment header per file is all the state we need, no matter how large the databases are. */
+
+	while (t) {	/* line holds the current segment header of the main file */
+		if (line[0] != '>') {	/* Trouble */
+			GMT_Report (API, GMT_MSG_ERROR, "Expected a segment header in %s but got: %s\n", Ctrl->A.file, line);
+			fclose (fp_merge);	fclose (fp_base);
+			gmt_M_free (GMT, Out);
+			Return (GMT_RUNTIME_ERROR);
+		}
+		if (merge_line[0] == '>' && !strncmp (&line[2], &merge_line[2], 19U)) {	/* Same pair: update these COEs */
+			strncpy (line, merge_line, GMT_BUFSIZ);
+			GMT_Put_Record (API, GMT_WRITE_DATA, Out);
+			while ((tm = fgets (line, GMT_BUFSIZ, fp_merge)) != NULL && line[0] != '>')
+				GMT_Put_Record (API, GMT_WRITE_DATA, Out);
+			if (tm)	/* Hold on to the next segment header of the to-merge file */
+				strncpy (merge_line, line, GMT_BUFSIZ);
+			else
+				merge_line[0] = '\0';	/* Exhausted the to-merge file */
+			n_merged++;
+			while ((t = fgets (line, GMT_BUFSIZ, fp_base)) != NULL && line[0] != '>');	/* Skip the superseded segment */
 		}
-		if (merge_start == n_merge) {	/* Copy the rest of dbase1 file and stop */
-			while (fgets (line, GMT_BUFSIZ, fp_base))
+		else {	/* Pair only present in the main file: just recopy */
+			GMT_Put_Record (API, GMT_WRITE_DATA, Out);
+			while ((t = fgets (line, GMT_BUFSIZ, fp_base)) != NULL && line[0] != '>')
 				GMT_Put_Record (API, GMT_WRITE_DATA, Out);
-			break;			/* Not very elegant way of stopping, but we are done */
 		}
 	}
 
+	if (merge_line[0] == '>') {	/* Update segments whose pair never appeared in the main file; these used to be dropped silently */
+		n_left = 1;
+		while (fgets (merge_line, GMT_BUFSIZ, fp_merge)) if (merge_line[0] == '>') n_left++;
+		GMT_Report (API, GMT_MSG_WARNING, "%" PRIu64 " segment(s) in %s had no matching pair in %s and were ignored\n", n_left, Ctrl->M.file, Ctrl->A.file);
+	}
+	GMT_Report (API, GMT_MSG_INFORMATION, "Replaced %" PRIu64 " crossing pair(s) with updated values from %s\n", n_merged, Ctrl->M.file);
+
 	if (GMT_End_IO (API, GMT_OUT, 0) != GMT_NOERROR) {	/* Disables further data output */
 		fclose (fp_base);	fclose (fp_merge);
-		x2sysmerge_clear_mem (GMT, pairs_base, pairs_merge, map_base_start, map_base_end, map_merge_start, map_merge_end, n_base, n_merge);
+		gmt_M_free (GMT, Out);
 		Return (API->error);
 	}
 
@@ -317,21 +240,6 @@ EXTERN_MSC int GMT_x2sys_merge (void *V_API, int mode, void *args) {
 	fclose (fp_merge);
 
 	gmt_M_free (GMT, Out);
-	x2sysmerge_clear_mem (GMT, pairs_base, pairs_merge, map_base_start, map_base_end, map_merge_start, map_merge_end, n_base, n_merge);
 
 	Return (GMT_NOERROR);
 }
-
-GMT_LOCAL void x2sysmerge_clear_mem (struct GMT_CTRL *GMT, char **pairs_base, char **pairs_merge, uint64_t *map_base_start, uint64_t *map_base_end,
-                          uint64_t *map_merge_start, uint64_t *map_merge_end, uint64_t n_base, uint64_t n_merge) {
-	uint64_t i;
-
-	for (i = 0; i < n_base; i++)  gmt_M_free (GMT, pairs_base[i]);
-	for (i = 0; i < n_merge; i++) gmt_M_free (GMT, pairs_merge[i]);
-	gmt_M_free (GMT, pairs_base);
-	gmt_M_free (GMT, pairs_merge);
-	gmt_M_free (GMT, map_base_start);
-	gmt_M_free (GMT, map_base_end);
-	gmt_M_free (GMT, map_merge_start);
-	gmt_M_free (GMT, map_merge_end);
-}
@@ -210,7 +210,8 @@ EXTERN_MSC int GMT_x2sys_put (void *V_API, int mode, void *args) {
 
 	FILE *fp = NULL, *fbin = NULL, *ftrack = NULL;
 
-	uint32_t last_id, index, id, free_id, max_flag, flag, i, bit, total_flag; /* These must remain uint32_t */
+	uint32_t last_id, index, id, free_id, max_flag, flag, i, bit, total_flag, *buf = NULL; /* These must remain uint32_t */
+	size_t n_buf = 0, n_in_buf;
 
 	struct X2SYS_PUT_CTRL *Ctrl = NULL;
 	struct GMT_CTRL *GMT = NULL, *GMT_cpy = NULL;
@@ -438,30 +439,26 @@ EXTERN_MSC int GMT_x2sys_put (void *V_API, int mode, void *args) {
 	for (index = 0; index < B.nm_bin; index++) {
 		if (B.base[index].n_tracks == 0) continue;
 
-		if (fwrite (&index, sizeof (uint32_t), 1U, fbin) != 1U) {
-			GMT_Report (API, GMT_MSG_ERROR, "Failed to write to binary file. Aborts!\n");
-			fclose (fbin);
-			Return (GMT_DATA_WRITE_ERROR);
+		if (2 * (size_t)(B.base[index].n_tracks + 1) > n_buf) {	/* Grow the scratch buffer so the whole bin can be written at once */
+			n_buf = 2 * (size_t)(B.base[index].n_tracks + 1);
+			buf = gmt_M_memory (GMT, buf, n_buf, uint32_t);
+		}
+		buf[0] = index;
+		buf[1] = B.base[index].n_tracks;
+		n_in_buf = 2;
+		for (this_track = B.base[index].first_track->next_track; this_track; this_track = this_track->next_track) {
+			buf[n_in_buf++] = this_track->track_id;
+			buf[n_in_buf++] = this_track->track_flag;
 		}
-		if (fwrite (&B.base[index].n_tracks, sizeof (uint32_t), 1U, fbin) != 1U) {
+		if (fwrite (buf, sizeof (uint32_t), n_in_buf, fbin) != n_in_buf) {
 			GMT_Report (API, GMT_MSG_ERROR, "Failed to write to binary file. Aborts!\n");
 			fclose (fbin);
+			gmt_M_free (GMT, buf);
 			Return (GMT_DATA_WRITE_ERROR);
 		}
-		for (this_track = B.base[index].first_track->next_track; this_track; this_track = this_track->next_track) {
-			if (fwrite (&this_track->track_id, sizeof (uint32_t), 1U, fbin) != 1U) {
-				GMT_Report (API, GMT_MSG_ERROR, "Failed to write to binary file. Aborts!\n");
-				fclose (fbin);
-				Return (GMT_DATA_WRITE_ERROR);
-			}
-			if (fwrite (&this_track->track_flag, sizeof (uint32_t), 1U, fbin) != 1U) {
-				GMT_Report (API, GMT_MSG_ERROR, "Failed to write to binary file. Aborts!\n");
-				fclose (fbin);
-				Return (GMT_DATA_WRITE_ERROR);
-			}
-		}
 	}
 	fclose (fbin);
+	gmt_M_free (GMT, buf);
 	if (chmod (index_file, (mode_t)S_RDONLY))
 		GMT_Report (API, GMT_MSG_WARNING, "Failed to change index file %s to read-only!\n", index_file);
 
@@ -58,6 +58,8 @@
 
 #define N_BASIS		7	/* Number of basis functions currently encoded */
 
+#define N_DENSE_MAX	2000	/* Normal systems up to this size are assembled densely and solved via Gauss-Jordan */
+
 /* The 7 different kinds of corrections coded so far */
 #define F_IS_CONSTANT	1	/* Subtract a constant from each track */
 #define F_IS_DRIFT_D	2	/* Subtract a trend with distance from each track */
@@ -297,19 +299,172 @@ GMT_LOCAL uint64_t x2syssolve_next_unused_track (uint64_t *cluster, uint64_t n)
 	return (n);	/* Found nothing so we are done */
 }
 
+GMT_LOCAL void x2syssolve_sparse_matvec (double (*basis[]) (double **, unsigned int, uint64_t), double **data, int *ID[], uint64_t *R, uint64_t *col_off, uint64_t *cluster, uint64_t *first, uint64_t *item, uint64_t n_tracks, uint64_t n_constraints, double w_pen, double *cdot, double *v, double *y) {
+	/* Evaluate y = N * v without forming the normal matrix N.  Each crossover only couples two
+	 * tracks, so we keep a track-ordered list of the crossovers (first/item) and compute the rows
+	 * belonging to one track at a time; this makes each track independent so the loop can run in
+	 * parallel without write conflicts.  The per-cluster zero-sum conditions on the constant
+	 * terms enter as penalty terms w_pen * e_g * e_g' and are added at the end. */
+	uint64_t p, k, idx, i, j, s, row0;
+	unsigned int t;
+	double u, sw2;
+	openmp_int pp;
+
+#ifdef _OPENMP
+#pragma omp parallel for private(pp,p,k,idx,i,j,s,row0,t,u,sw2) shared(basis,data,ID,R,col_off,first,item,n_tracks,v,y)
+#endif
+	for (pp = 0; pp < (openmp_int)n_tracks; pp++) {	/* For each track, compute its R[p] rows of N * v */
+		p = (uint64_t)pp;	row0 = col_off[p];
+		for (s = 0; s < R[p]; s++) y[row0+s] = 0.0;
+		for (idx = first[p]; idx < first[p+1]; idx++) {	/* For each crossover involving track p */
+			k = item[idx] >> 1;	t = (unsigned int)(item[idx] & 1);	/* COE id and whether p is track 1 or 2 of the pair */
+			i = ID[0][k];	j = ID[1][k];
+			sw2 = ((t) ? -1.0 : +1.0) * data[COL_WW][k] * data[COL_WW][k];
+			for (s = 0, u = 0.0; s < R[i]; s++) u += basis[s](data,0,k) * v[col_off[i]+s];	/* u = (design row k) dot v */
+			for (s = 0; s < R[j]; s++) u -= basis[s](data,1,k) * v[col_off[j]+s];
+			for (s = 0; s < R[p]; s++) y[row0+s] += sw2 * basis[s](data,t,k) * u;
+		}
+	}
+	if (n_constraints) {	/* Add the cluster penalty terms w_pen * e_g * (e_g dot v) */
+		for (p = 0; p < n_constraints; p++) cdot[p] = 0.0;
+		for (p = 0; p < n_tracks; p++) cdot[cluster[p]] += v[col_off[p]];
+		for (p = 0; p < n_tracks; p++) y[col_off[p]] += w_pen * cdot[cluster[p]];
+	}
+}
+
+GMT_LOCAL int x2syssolve_sparse_solve (struct GMT_CTRL *GMT, double (*basis[]) (double **, unsigned int, uint64_t), double **data, int *ID[], uint64_t *R, uint64_t *col_off, uint64_t *cluster, uint64_t n_COE, uint64_t n_tracks, uint64_t n, uint64_t n_constraints, double *x) {
+	/* Solve the normal equations N * x = b for large crossover surveys with a Jacobi-preconditioned
+	 * conjugate gradient method.  The COE graph is sparse (each crossover couples two tracks) so we
+	 * never assemble N; instead x2syssolve_sparse_matvec evaluates N * v from a track-ordered
+	 * crossover list.  The per-cluster conditions that the constant terms sum to zero are imposed
+	 * via penalty terms; because the right-hand side A'Wb is orthogonal to the nullspace the
+	 * constraints remove, the solution is the same as with the Lagrange multipliers of the dense
+	 * path (whose multipliers are all zero).  Returns 0 if converged, 1 otherwise. */
+	uint64_t k, p, s, i, j, it, n_items, max_it;
+	uint64_t *first = NULL, *item = NULL, *fill = NULL;
+	double *diag = NULL, *r_vec = NULL, *z = NULL, *pv = NULL, *q = NULL, *bb = NULL, *cdot = NULL;
+	double w_pen = 0.0, sw2, f, rz, rz_new, pq, alpha, beta, bnorm, rnorm = 0.0;
+	int error = 1;
+
+	/* Build the track-ordered crossover lists: item[] holds 2*k + t for crossover k in which the track is # t (0-1) */
+
+	for (k = n_items = 0; k < n_COE; k++) n_items += (ID[0][k] == ID[1][k]) ? 1 : 2;
+	first = gmt_M_memory (GMT, NULL, n_tracks + 1, uint64_t);
+	for (k = 0; k < n_COE; k++) {
+		first[ID[0][k]+1]++;
+		if (ID[1][k] != ID[0][k]) first[ID[1][k]+1]++;
+	}
+	for (p = 0; p < n_tracks; p++) first[p+1] += first[p];	/* Convert counts to offsets */
+	item = gmt_M_memory (GMT, NULL, n_items, uint64_t);
+	fill = gmt_M_memory (GMT, NULL, n_tracks, uint64_t);
+	gmt_M_memcpy (fill, first, n_tracks, uint64_t);
+	for (k = 0; k < n_COE; k++) {
+		item[fill[ID[0][k]]++] = k << 1;
+		if (ID[1][k] != ID[0][k]) item[fill[ID[1][k]]++] = (k << 1) | 1;
+	}
+	gmt_M_free (GMT, fill);
+
+	/* Build the right-hand side b = A'Wb and the diagonal of N for the Jacobi preconditioner */
+
+	bb   = gmt_M_memory (GMT, NULL, n, double);
+	diag = gmt_M_memory (GMT, NULL, n, double);
+	for (k = 0; k < n_COE; k++) {
+		i = ID[0][k];	j = ID[1][k];
+		sw2 = data[COL_WW][k] * data[COL_WW][k];
+		for (s = 0; s < R[i]; s++) {
+			f = basis[s](data,0,k);
+			bb[col_off[i]+s]   += sw2 * data[COL_COE][k] * f;
+			diag[col_off[i]+s] += sw2 * f * f;
+		}
+		if (j == i) continue;	/* Internal crossover was fully handled above */
+		for (s = 0; s < R[j]; s++) {
+			f = basis[s](data,1,k);
+			bb[col_off[j]+s]   -= sw2 * data[COL_COE][k] * f;
+			diag[col_off[j]+s] += sw2 * f * f;
+		}
+	}
+	if (n_constraints) {	/* Scale the penalty to the mean diagonal so the conditioning is reasonable */
+		for (s = 0, w_pen = 0.0; s < n; s++) w_pen += diag[s];
+		w_pen /= (double)n;
+		for (p = 0; p < n_tracks; p++) diag[col_off[p]] += w_pen;
+		cdot = gmt_M_memory (GMT, NULL, n_constraints, double);
+	}
+	for (s = 0; s < n; s++) if (diag[s] <= 0.0) diag[s] = 1.0;	/* Should not happen; avoid division by zero */
+
+	/* The preconditioned conjugate gradient iterations, starting from x = 0 */
+
+	r_vec = gmt_M_memory (GMT, NULL, n, double);
+	z     = gmt_M_memory (GMT, NULL, n, double);
+	pv    = gmt_M_memory (GMT, NULL, n, double);
+	q     = gmt_M_memory (GMT, NULL, n, double);
+
+	for (s = 0, bnorm = 0.0; s < n; s++) bnorm += bb[s] * bb[s];
+	bnorm = sqrt (bnorm);
+	if (bnorm == 0.0) {	/* Zero right-hand side means the zero solution */
+		error = 0;
+		goto FREE_CG;
+	}
+	gmt_M_memcpy (r_vec, bb, n, double);
+	for (s = 0, rz = 0.0; s < n; s++) {
+		z[s] = r_vec[s] / diag[s];
+		rz += r_vec[s] * z[s];
+	}
+	gmt_M_memcpy (pv, z, n, double);
+	max_it = MAX (1000, 2 * n);
+	for (it = 0; it < max_it; it++) {
+		x2syssolve_sparse_matvec (basis, data, ID, R, col_off, cluster, first, item, n_tracks, n_constraints, w_pen, cdot, pv, q);
+		for (s = 0, pq = 0.0; s < n; s++) pq += pv[s] * q[s];
+		if (pq <= 0.0) {	/* Matrix is not positive definite; give up and let the caller report */
+			GMT_Report (GMT->parent, GMT_MSG_DEBUG, "x2sys_solve: Conjugate gradients met a non-positive curvature after %" PRIu64 " iterations\n", it);
+			goto FREE_CG;
+		}
+		alpha = rz / pq;
+		for (s = 0; s < n; s++) {
+			x[s] += alpha * pv[s];
+			r_vec[s] -= alpha * q[s];
+		}
+		for (s = 0, rnorm = 0.0; s < n; s++) rnorm += r_vec[s] * r_vec[s];
+		rnorm = sqrt (rnorm);
+		if (rnorm <= GMT_CONV12_LIMIT * bnorm) {	/* Converged */
+			GMT_Report (GMT->parent, GMT_MSG_INFORMATION, "Sparse conjugate gradient solver converged in %" PRIu64 " iterations (|r|/|b| = %.3e)\n", it + 1, rnorm / bnorm);
+			error = 0;
+			goto FREE_CG;
+		}
+		for (s = 0, rz_new = 0.0; s < n; s++) {
+			z[s] = r_vec[s] / diag[s];
+			rz_new += r_vec[s] * z[s];
+		}
+		beta = rz_new / rz;	rz = rz_new;
+		for (s = 0; s < n; s++) pv[s] = z[s] + beta * pv[s];
+	}
+	GMT_Report (GMT->parent, GMT_MSG_DEBUG, "x2sys_solve: Conjugate gradients stopped at |r|/|b| = %.3e after %" PRIu64 " iterations\n", rnorm / bnorm, max_it);
+
+FREE_CG:
+	gmt_M_free (GMT, first);
+	gmt_M_free (GMT, item);
+	gmt_M_free (GMT, bb);
+	gmt_M_free (GMT, diag);
+	gmt_M_free (GMT, r_vec);
+	gmt_M_free (GMT, z);
+	gmt_M_free (GMT, pv);
+	gmt_M_free (GMT, q);
+	if (n_constraints) gmt_M_free (GMT, cdot);
+	return (error);
+}
+
 EXTERN_MSC int GMT_x2sys_solve (void *V_API, int mode, void *args) {
 	char **trk_list = NULL, text[GMT_BUFSIZ] = {""}, frmt_name[16] = {""};
 	char trk[2][GMT_LEN64], line[GMT_BUFSIZ] = {""};
 	char file_TAG[GMT_LEN64] = {""}, file_column[GMT_LEN64] = {""};
 	bool grow_list = false, normalize = false, first = true, active_col[N_COE_PARS];
-	int *ID[2] = {NULL, NULL}, ks, t, error = GMT_NOERROR, max_len;
+	int *ID[2] = {NULL, NULL}, ks, error = GMT_NOERROR, max_len;
 	int min_ID, max_ID;
 	unsigned int rec_mode;
 	uint64_t n_par = 0, n_in = 0, n, m, n_tracks = 0, n_active, n_constraints = 0;
 	uint64_t i, p, j, k, r, s, row_off, row, n_COE = 0, w_col, id_col, bin_expect, *R = NULL, *col_off = NULL, *cluster = NULL;
 	size_t n_alloc = GMT_INITIAL_MEM_ROW_ALLOC, n_alloc_t = GMT_CHUNK;
 
-	double *N = NULL, *a = NULL, *b = NULL, *in = NULL, *data[N_COE_PARS], sgn, old_mean, new_mean, sw2, C_i, C_j;
+	double *N = NULL, *a = NULL, *b = NULL, *in = NULL, *data[N_COE_PARS], bs, old_mean, new_mean, sw2, C_i, C_j;
 	double old_stdev, new_stdev, e_k, min_extent, max_extent, range = 0.0, Sw, Sx, Sxx, var[N_BASIS];
 	struct GMT_RECORD *In = NULL, *Out = NULL;
 	struct X2SYS_INFO *S = NULL;
@@ -729,37 +884,57 @@ EXTERN_MSC int GMT_x2sys_solve (void *V_API, int mode, void *args) {
 	/* Set up matrix and column vectors */
 
 	m = n + n_constraints;	/* Need extra row(s)/column(s) to handle Lagrange's multiplier(s) for unknown absolute level(s) */
-	/* Allocate arrays for N*x = b, the m x m linear system */
-	N = gmt_M_memory (GMT, NULL, m*m, double);
 	b = gmt_M_memory (GMT, NULL, m, double);
 
+	if (m > N_DENSE_MAX) {	/* Large survey; exploit that each crossover only couples two tracks and solve via sparse conjugate gradients */
+		GMT_Report (API, GMT_MSG_INFORMATION, "Matrix equation N * a = b: (N = %" PRIu64 " x %" PRIu64 "), using sparse conjugate gradients\n", m, m);
+		if (x2syssolve_sparse_solve (GMT, basis, data, ID, R, col_off, cluster, n_COE, n_tracks, n, n_constraints, b)) {
+			GMT_Report (API, GMT_MSG_ERROR, "Sparse conjugate gradient solver failed to converge - unable to solve!\n");
+			if (n_constraints) gmt_M_free (GMT, cluster);
+			error = GMT_RUNTIME_ERROR;
+			goto END;
+		}
+		if (n_constraints) gmt_M_free (GMT, cluster);
+	}
+	else {	/* Small enough that the dense assembly and Gauss-Jordan solution are the faster choice */
+
+	/* Allocate array for the m x m linear system N*x = b */
+	N = gmt_M_memory (GMT, NULL, m*m, double);
+
 	/* Build A'A and A'b ==> N*x = b normal equation matrices directly since A may be too big to do A'A by multiplication.
+	 * Since each crossover only involves two tracks we scatter its contributions into the few rows it touches rather
+	 * than scanning the entire crossover list once per matrix row.
 	 * For all corrections that involve a constant shift we must add the constraint that such shifts sum to zero; this
 	 * is implemented by adding extra rows/columns with the appropriate 0s and 1s and solve for Lagrange multipliers. */
 
-	for (p = row = 0; p < n_tracks; p++) {	/* For each track */
-		for (s = 0; s < R[p]; s++, row++) {	/* For each of this track's unknown parameters  */
-			row_off = m * row;	/* Start of current row in N */
-			for (k = 0; k < n_COE; k++) {	/* For each crossover */
-				i = ID[0][k];	/* Get track # 1 ID */
-				j = ID[1][k];	/* Get track # 2 ID */
-				if (i == p) {		/* p equals track # 1 */
-					sgn = +1.0;	t = 0;
-				} else if (p == j) {	/* p equals track # 2 */
-					sgn = -1.0;	t = 1;
-				} else continue;	/* COE did not involve track p, goto next crossover */
-				sw2 = sgn * data[COL_WW][k] * data[COL_WW][k];
-				for (r = 0; r < R[i]; r++)	/* For track i's parameters in f(p)  */
-					N[row_off+col_off[i]+r] += sw2 * (basis[r](data,0,k) * basis[s](data,t,k));
-				for (r = 0; r < R[j]; r++)	/* For track j's parameters in f(p)  */
-					N[row_off+col_off[j]+r] -= sw2 * (basis[r](data,1,k) * basis[s](data,t,k));
-				b[row] += sw2 * (data[COL_COE][k] * basis[s](data,t,k));
-			}
-			/* Augmented column entry for Lagrange multiplier for this cluster */
-			if (n_constraints) N[row_off+n+cluster[p]] = 1.0;
+	for (k = 0; k < n_COE; k++) {	/* For each crossover */
+		i = ID[0][k];	/* Get track # 1 ID */
+		j = ID[1][k];	/* Get track # 2 ID */
+		sw2 = data[COL_WW][k] * data[COL_WW][k];
+		for (s = 0; s < R[i]; s++) {	/* Scatter into the rows of track i's parameters */
+			row_off = m * (col_off[i] + s);	/* Start of current row in N */
+			bs = sw2 * basis[s](data,0,k);
+			for (r = 0; r < R[i]; r++)	/* For track i's parameters in f(p)  */
+				N[row_off+col_off[i]+r] += bs * basis[r](data,0,k);
+			for (r = 0; r < R[j]; r++)	/* For track j's parameters in f(p)  */
+				N[row_off+col_off[j]+r] -= bs * basis[r](data,1,k);
+			b[col_off[i]+s] += bs * data[COL_COE][k];
+		}
+		if (j == i) continue;	/* Internal crossover was fully handled by the rows above */
+		for (s = 0; s < R[j]; s++) {	/* Scatter into the rows of track j's parameters; all signs flip */
+			row_off = m * (col_off[j] + s);	/* Start of current row in N */
+			bs = sw2 * basis[s](data,1,k);
+			for (r = 0; r < R[i]; r++)	/* For track i's parameters in f(p)  */
+				N[row_off+col_off[i]+r] -= bs * basis[r](data,0,k);
+			for (r = 0; r < R[j]; r++)	/* For track j's parameters in f(p)  */
+				N[row_off+col_off[j]+r] += bs * basis[r](data,1,k);
+			b[col_off[j]+s] -= bs * data[COL_COE][k];
 		}
 	}
-	if (n_constraints) {	/* Append the constraint equations that each cluster's offset corrections add to zero */
+	if (n_constraints) {	/* Augmented column entry for Lagrange multiplier for each track's cluster */
+		for (p = row = 0; p < n_tracks; p++)
+			for (s = 0; s < R[p]; s++, row++) N[m*row+n+cluster[p]] = 1.0;
+		/* Append the constraint equations that each cluster's offset corrections add to zero */
 		for (k = 0, row_off = m * n; k < n_constraints; k++, row_off += m) {	/* For each cluster */
 			for (p = 0; p < n_tracks; p++) if (cluster[p] == k) N[row_off+col_off[p]] = 1.0;
 		}
@@ -788,6 +963,8 @@ EXTERN_MSC int GMT_x2sys_solve (void *V_API, int mode, void *args) {
 	}
 
 	gmt_M_free (GMT, N);
+
+	}	/* End of dense branch */
 	a = b;	/* Convenience since the solution is called a in the notes and in Wessel [2010] */
 
 	/* Estimate new st.dev. */
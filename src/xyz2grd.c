@@ -302,6 +302,100 @@ GMT_LOCAL void xyz2grd_protect_J (struct GMTAPI_CTRL *API, struct GMT_OPTION *op
 	}
 }
 
+#ifdef _OPENMP
+/* For the order-independent -A modes (l, u, d, n) the node a point maps to does not depend
+ * on any other point, so we buffer the input stream in blocks and let each thread assign its
+ * share of a block to a private grid/flag replica; the replicas are combined once all input
+ * has been consumed.  The results are identical to the serial path since min, max and counts
+ * are exact under any ordering.  The remaining modes either depend on input order (f, s) or
+ * sum floating-point values whose result would change with the ordering, so they keep the
+ * one-record-at-a-time code below. */
+
+#define XYZ2GRD_BLOCK_SIZE	262144	/* Number of points buffered before a parallel flush */
+
+GMT_LOCAL void xyz2grd_process_block (struct GMT_CTRL *GMT, struct GMT_GRID *Grid, double wesn[], char Amode, double *xb, double *yb, double *zb, uint64_t nb, gmt_grdfloat *t_grid, unsigned int *t_flag, gmt_grdfloat *t_data, uint64_t *n_used, uint64_t *n_confused) {
+	/* Assign the nb buffered points to nodes, each thread accumulating into its own replica */
+	openmp_int b;
+	uint64_t nused = 0, nconf = 0;
+#pragma omp parallel for private(b) shared(GMT,Grid,wesn,Amode,xb,yb,zb,nb,t_grid,t_flag,t_data) reduction(+:nused,nconf)
+	for (b = 0; b < (openmp_int)nb; b++) {
+		int scol, srow;
+		unsigned int row, col;
+		uint64_t ij;
+		double x = xb[b];
+		if (gmt_M_y_is_outside (GMT, yb[b], wesn[YLO], wesn[YHI])) continue;	/* Outside y-range */
+		if (gmt_x_is_outside (GMT, &x, wesn[XLO], wesn[XHI])) continue;		/* Outside x-range */
+		scol = (int)gmt_M_grd_x_to_col (GMT, x, Grid->header);
+		if (scol == -1) scol++, nconf++;
+		col = scol;
+		if (col == Grid->header->n_columns) col--, nconf++;
+		srow = (int)gmt_M_grd_y_to_row (GMT, yb[b], Grid->header);
+		if (srow == -1) srow++, nconf++;
+		row = srow;
+		if (row == Grid->header->n_rows) row--, nconf++;
+		ij = gmt_M_ij0 (Grid->header, row, col) + (uint64_t)omp_get_thread_num () * Grid->header->nm;
+		switch (Amode) {
+			case 'l':	/* Keep lowest value */
+				if (t_flag[ij] == 0 || zb[b] < (double)t_grid[ij]) t_grid[ij] = (gmt_grdfloat)zb[b];
+				t_flag[ij]++;
+				break;
+			case 'u':	/* Keep highest value */
+				if (t_flag[ij] == 0 || zb[b] > (double)t_grid[ij]) t_grid[ij] = (gmt_grdfloat)zb[b];
+				t_flag[ij]++;
+				break;
+			case 'd':	/* Keep highest and lowest value */
+				if (t_flag[ij]) {
+					if (zb[b] > (double)t_grid[ij]) t_grid[ij] = (gmt_grdfloat)zb[b];
+					if (zb[b] < (double)t_data[ij]) t_data[ij] = (gmt_grdfloat)zb[b];
+				}
+				else
+					t_grid[ij] = t_data[ij] = (gmt_grdfloat)zb[b];
+				t_flag[ij]++;
+				break;
+			default:	/* 'n': Only the count matters */
+				t_flag[ij]++;
+				break;
+		}
+		nused++;
+	}
+	*n_used += nused;	*n_confused += nconf;
+}
+
+GMT_LOCAL void xyz2grd_merge_threads (struct GMT_CTRL *GMT, struct GMT_GRID *Grid, char Amode, unsigned int n_threads, gmt_grdfloat *t_grid, unsigned int *t_flag, gmt_grdfloat *t_data, gmt_grdfloat *data, unsigned int *flag) {
+	/* Combine the per-thread replicas into the final grid/flag/data arrays (all still zero) */
+	unsigned int t;
+	uint64_t ij, k;
+	gmt_M_unused (GMT);
+	for (t = 0; t < n_threads; t++) {
+		for (ij = 0; ij < Grid->header->nm; ij++) {
+			k = (uint64_t)t * Grid->header->nm + ij;
+			if (t_flag[k] == 0) continue;	/* This thread never saw a point for this node */
+			switch (Amode) {
+				case 'l':	/* Keep lowest value */
+					if (flag[ij] == 0 || t_grid[k] < Grid->data[ij]) Grid->data[ij] = t_grid[k];
+					break;
+				case 'u':	/* Keep highest value */
+					if (flag[ij] == 0 || t_grid[k] > Grid->data[ij]) Grid->data[ij] = t_grid[k];
+					break;
+				case 'd':	/* Keep highest and lowest value */
+					if (flag[ij]) {
+						if (t_grid[k] > Grid->data[ij]) Grid->data[ij] = t_grid[k];
+						if (t_data[k] < data[ij]) data[ij] = t_data[k];
+					}
+					else {
+						Grid->data[ij] = t_grid[k];
+						data[ij] = t_data[k];
+					}
+					break;
+				default:	/* 'n': Only the count matters */
+					break;
+			}
+			flag[ij] += t_flag[k];
+		}
+	}
+}
+#endif
+
 EXTERN_MSC int GMT_xyz2grd (void *V_API, int mode, void *args) {
 	bool previous_bin_i = false, previous_bin_o = false;
 	int error = 0, scol, srow;
@@ -315,6 +409,14 @@ EXTERN_MSC int GMT_xyz2grd (void *V_API, int mode, void *args) {
 
 	gmt_grdfloat no_data_f, *data = NULL;
 
+#ifdef _OPENMP
+	bool parallel_fill = false;
+	unsigned int n_threads = 1, *t_flag = NULL;
+	uint64_t n_in_block = 0;
+	double *xb = NULL, *yb = NULL, *zb = NULL;
+	gmt_grdfloat *t_grid = NULL, *t_data = NULL;
+#endif
+
 	void * (*save_i) (struct GMT_CTRL *, FILE *, uint64_t *, int *) = NULL;
 	int (*save_o) (struct GMT_CTRL *, FILE *, uint64_t, double *, char *);
 
@@ -590,6 +692,18 @@ EXTERN_MSC int GMT_xyz2grd (void *V_API, int mode, void *args) {
 		}
 		gmt_M_memset (Grid->header->pad, 4, unsigned int);	/* Algorithm below expects no padding; we repad at the end */
 		GMT->current.setting.io_nan_records = false;	/* Cannot have x,y as NaNs here */
+#ifdef _OPENMP
+		if (strchr ("dlnu", (int)Amode) && (n_threads = omp_get_max_threads ()) > 1) {	/* Order-independent modes can be accumulated in parallel */
+			parallel_fill = true;
+			xb = gmt_M_memory (GMT, NULL, XYZ2GRD_BLOCK_SIZE, double);
+			yb = gmt_M_memory (GMT, NULL, XYZ2GRD_BLOCK_SIZE, double);
+			zb = gmt_M_memory (GMT, NULL, XYZ2GRD_BLOCK_SIZE, double);
+			t_grid = gmt_M_memory (GMT, NULL, (size_t)n_threads * Grid->header->nm, gmt_grdfloat);
+			t_flag = gmt_M_memory (GMT, NULL, (size_t)n_threads * Grid->header->nm, unsigned int);
+			if (Amode == 'd') t_data = gmt_M_memory (GMT, NULL, (size_t)n_threads * Grid->header->nm, gmt_grdfloat);
+			GMT_Report (API, GMT_MSG_INFORMATION, "Accumulating nodes in parallel using %u threads\n", n_threads);
+		}
+#endif
 	}
 
 	if ((error = GMT_Set_Columns (API, GMT_IN, (unsigned int)n_req, GMT_COL_FIX_NO_TEXT)) != GMT_NOERROR) {
@@ -649,6 +763,16 @@ EXTERN_MSC int GMT_xyz2grd (void *V_API, int mode, void *args) {
 			ij++;
 		}
 		else {	/* Get x, y, z */
+#ifdef _OPENMP
+			if (parallel_fill) {	/* Just buffer this point; full blocks are assigned to nodes in parallel */
+				xb[n_in_block] = in[GMT_X];	yb[n_in_block] = in[GMT_Y];	zb[n_in_block] = in[zcol];
+				if (++n_in_block == XYZ2GRD_BLOCK_SIZE) {
+					xyz2grd_process_block (GMT, Grid, wesn, Amode, xb, yb, zb, n_in_block, t_grid, t_flag, t_data, &n_used, &n_confused);
+					n_in_block = 0;
+				}
+				continue;
+			}
+#endif
 			if (gmt_M_y_is_outside (GMT, in[GMT_Y],  wesn[YLO], wesn[YHI])) continue;	/* Outside y-range */
 			if (gmt_x_is_outside (GMT, &in[GMT_X], wesn[XLO], wesn[XHI])) continue;	/* Outside x-range */
 
@@ -718,6 +842,15 @@ EXTERN_MSC int GMT_xyz2grd (void *V_API, int mode, void *args) {
 		}
 	} while (true);
 
+#ifdef _OPENMP
+	if (parallel_fill) {	/* Process any final partial block, then merge the per-thread replicas */
+		if (n_in_block) xyz2grd_process_block (GMT, Grid, wesn, Amode, xb, yb, zb, n_in_block, t_grid, t_flag, t_data, &n_used, &n_confused);
+		xyz2grd_merge_threads (GMT, Grid, Amode, n_threads, t_grid, t_flag, t_data, data, flag);
+		gmt_M_free (GMT, xb);	gmt_M_free (GMT, yb);	gmt_M_free (GMT, zb);
+		gmt_M_free (GMT, t_grid);	gmt_M_free (GMT, t_flag);	gmt_M_free (GMT, t_data);
+	}
+#endif
+
 	if (GMT_End_IO (API, GMT_IN, 0) != GMT_NOERROR) {	/* Disables further data input */
 		gmt_M_free (GMT, flag);		gmt_M_free (GMT, data);
 		Return (API->error);
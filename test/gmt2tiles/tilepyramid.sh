@@ -0,0 +1,36 @@
+#!/usr/bin/env bash
+#
+# Render a small XYZ tile pyramid from a global grid and verify the tile
+# counts per zoom level, that the tiles land in the right columns, and
+# that the batched parallel rendering is deterministic.
+
+log=tilepyramid.log
+rm -f $log fail
+
+# Global grid whose value is just the longitude, with a monotonic gray CPT
+gmt grdmath -Rd -I1 -fg X = lixo.nc
+gmt makecpt -Cgray -T-180/180 > t.cpt
+
+gmt gmt2tiles lixo.nc -Ct.cpt -Z0/2 -Dtiles
+
+# A global grid must yield the full 1, 4, and 16 tiles at zooms 0-2
+for zoom in 0 1 2; do
+	n=$(find tiles/$zoom -name '*.png' | wc -l)
+	echo "zoom $zoom n_tiles $n" >> $log
+done
+
+# Tile placement: with z = longitude and a gray CPT every pixel of the
+# western zoom-1 tiles must be darker than every pixel of the eastern ones
+west_max=$(gmt grdinfo -C tiles/1/0/0.png | cut -f7)
+east_min=$(gmt grdinfo -C tiles/1/1/0.png | cut -f6)
+echo $west_max $east_min | $AWK '{if ($1 > $2) print "tiles swapped"}' >> $log
+
+# Each tile must be a plain 256 x 256 pixel raster
+gmt grdinfo -C tiles/2/1/1.png | $AWK '{if ($10 != 256 || $11 != 256) print "bad tile dimension", $10, $11}' >> $log
+
+# The batch of tiles is rendered in parallel but must not depend on thread
+# scheduling: a second run must reproduce the first tree byte for byte
+gmt gmt2tiles lixo.nc -Ct.cpt -Z0/2 -Dtiles2
+diff -r tiles tiles2 >> $log
+
+$AWK '{if (NF != 4 || $1 != "zoom" || $4 != 4^$2) print}' $log > fail
@@ -0,0 +1,31 @@
+#!/usr/bin/env bash
+#
+# Round-trip the zstd-compressed native format (=zf) and compare with =bf,
+# including a subregion read that only decompresses intersecting blocks
+
+log=reformat_zf.log
+
+# Skip when GMT was built without zstd support
+gmt grdconvert 2>&1 | grep -q "zf = " || exit 0
+
+gmt grdmath -R-10/10/-10/10 -I0.05 X Y MUL = lixo.nc
+
+# Full reads via zf and bf must decode identical values
+gmt grdconvert lixo.nc lixo.zf=zf
+gmt grdconvert lixo.nc lixo.bf=bf
+gmt grdmath lixo.zf=zf lixo.bf=bf SUB = lixo_dif.nc
+gmt grd2xyz lixo_dif.nc -ZTLa > $log
+
+# So must a subregion read, which seeks over the non-intersecting blocks
+gmt grdcut lixo.zf=zf -R-3/4/2/9 -Glixo_cut_zf.nc
+gmt grdcut lixo.bf=bf -R-3/4/2/9 -Glixo_cut_bf.nc
+gmt grdmath lixo_cut_zf.nc lixo_cut_bf.nc SUB = lixo_dif.nc
+gmt grd2xyz lixo_dif.nc -ZTLa >> $log
+
+# Now convert back to .nc
+gmt grdconvert lixo.zf=zf lixo2.nc
+gmt grdmath lixo.nc lixo2.nc SUB = lixo_dif.nc
+gmt grd2xyz lixo_dif.nc -ZTLa >> $log
+
+res=$(gmt info -C $log)
+echo ${res[0]} ${res[1]} | $AWK '{if($1 != 0 || $2 != 0) print 1}' > fail
@@ -0,0 +1,38 @@
+#!/usr/bin/env bash
+#
+# Build overview levels with grdpyramid and verify the halved dimensions
+# and values, then that grdsample picks a suitable overview sidecar.
+
+log=pyramid.log
+rm -f $log fail
+
+# Pixel-registered grid of a linear surface; averaging 2x2 cells is then exact
+gmt grdmath -R0/256/0/256 -I1 -rp X Y ADD = lixo.nc
+
+gmt grdpyramid lixo.nc
+
+# Default halving goes 128 then 64 and must stop before dropping below 64
+for factor in 2 4; do
+	gmt grdinfo -C lixo_pyr${factor}.nc | $AWK -v f=$factor \
+		'{if ($8 != f || $9 != f || $10 != 256/f || $11 != 256/f) print "bad level", f, ":", $8, $9, $10, $11}' >> $log
+done
+test -f lixo_pyr8.nc && echo "pyramid too deep" >> $log
+
+# Every level of a linear surface must equal that surface at its own nodes
+for factor in 2 4; do
+	gmt grdmath lixo_pyr${factor}.nc X Y ADD SUB = lixo_dif.nc
+	gmt grdinfo -C lixo_dif.nc | $AWK -v f=$factor '{if ($6 != 0 || $7 != 0) print "level", f, "values off:", $6, $7}' >> $log
+done
+
+# A gridline-registered parent must halve to half the intervals plus one node
+gmt grdmath -R0/256/0/256 -I1 X Y MUL = lixo_g.nc
+gmt grdpyramid lixo_g.nc -L1
+gmt grdinfo -C lixo_g_pyr2.nc | $AWK '{if ($8 != 2 || $9 != 2 || $10 != 129 || $11 != 129) print "bad gridline level:", $8, $9, $10, $11}' >> $log
+
+# Overview selection in the grid i/o layer: plant a recognizable constant in
+# the factor-4 sidecar and verify grdsample -I4 reads that instead of the base
+gmt grdmath -R0/256/0/256 -I4 -rp 1 = lixo_pyr4.nc
+gmt grdsample lixo.nc -I4 -Glixo_out.nc
+gmt grdinfo -C lixo_out.nc | $AWK '{if ($6 != 1 || $7 != 1) print "overview not selected:", $6, $7}' >> $log
+
+cat $log > fail